@@ -0,0 +1,122 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "glad/glad.h"
+#include "gl_state.h"
+#include "batch.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+/*
+    N small triangles (100k by default) spread over the framebuffer, every
+    other one using a different shader. Drawn two ways:
+      direct - all shapes in one static VBO, shader_use + glDrawArrays per shape
+               (the cheapest form of one draw per object)
+      batch  - batch_push per shape and one batch_flush per frame
+    Submit time is the CPU time to issue the frame, frame time adds glFinish.
+*/
+
+static void make_triangles(BatchVertex* vertices, int triangles) {
+    srand(42);
+    for (int i = 0; i < triangles; i++) {
+        float x = (rand() / (float)RAND_MAX) * 1.9f - 0.95f;
+        float y = (rand() / (float)RAND_MAX) * 1.9f - 0.95f;
+        float size = 0.01f;
+        BatchVertex* v = &vertices[i * 3];
+        v[0] = (BatchVertex){ x + size, y - size, 0.0f, 1.0f, 0.0f, 0.0f };
+        v[1] = (BatchVertex){ x - size, y - size, 0.0f, 0.0f, 1.0f, 0.0f };
+        v[2] = (BatchVertex){ x, y + size, 0.0f, 0.0f, 0.0f, 1.0f };
+    }
+}
+
+int bench_batch(int argc, char** argv) {
+    int triangles = bench_arg_int(argc, argv, "--triangles", 100000);
+    int frames = bench_arg_int(argc, argv, "--frames", 10);
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+
+    Shader shaders[2];
+    shaders[0] = create_shader(GSL_SHADER_DIR "/model.vs", GSL_SHADER_DIR "/model.fs");
+    shaders[1] = create_shader(GSL_SHADER_DIR "/model.vs", GSL_SHADER_DIR "/tint.fs");
+    if (!shaders[0].ID || !shaders[1].ID) {
+        headless_destroy(&headless);
+        return -1;
+    }
+    shader_use(&shaders[1]);
+    shader_set_float(&shaders[1], "brightness", 0.8f);
+    shader_set_float(&shaders[1], "alpha", 1.0f);
+
+    BatchVertex* vertices = (BatchVertex*)malloc(triangles * 3 * sizeof(BatchVertex));
+    make_triangles(vertices, triangles);
+
+    double* submit = (double*)malloc(frames * sizeof(double));
+    double* total = (double*)malloc(frames * sizeof(double));
+
+    // -- Direct -- //
+    unsigned int VAO, VBO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    gl_state_bind_vertex_array(VAO);
+    gl_state_bind_buffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, triangles * 3 * sizeof(BatchVertex), vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(BatchVertex), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(BatchVertex), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glFinish();
+
+    for (int f = 0; f < frames; f++) {
+        double start = bench_now_ms();
+        glClear(GL_COLOR_BUFFER_BIT);
+        gl_state_bind_vertex_array(VAO);
+        for (int i = 0; i < triangles; i++) {
+            shader_use(&shaders[i & 1]);
+            glDrawArrays(GL_TRIANGLES, i * 3, 3);
+        }
+        submit[f] = bench_now_ms() - start;
+        glFinish();
+        total[f] = bench_now_ms() - start;
+        bench_end_frame();
+    }
+    printf("batch: %d triangles, %d frames\n", triangles, frames);
+    printf("  direct: %d draw calls per frame\n", triangles);
+    bench_print_stats("submit", bench_stats(submit, frames));
+    bench_print_stats("frame", bench_stats(total, frames));
+
+    gl_state_delete_vertex_arrays(1, &VAO);
+    gl_state_delete_buffers(1, &VBO);
+
+    // -- Batched -- //
+    Batch batch;
+    batch_init(&batch);
+    for (int f = 0; f < frames; f++) {
+        double start = bench_now_ms();
+        glClear(GL_COLOR_BUFFER_BIT);
+        batch_reset_stats(&batch);
+        for (int i = 0; i < triangles; i++) {
+            batch_push(&batch, &shaders[i & 1], &vertices[i * 3], 3);
+        }
+        batch_flush(&batch);
+        submit[f] = bench_now_ms() - start;
+        glFinish();
+        total[f] = bench_now_ms() - start;
+        bench_end_frame();
+    }
+    printf("  batch: %d draw calls per frame\n", batch.draw_calls);
+    bench_print_stats("submit", bench_stats(submit, frames));
+    bench_print_stats("frame", bench_stats(total, frames));
+
+    batch_destroy(&batch);
+    free(submit);
+    free(total);
+    free(vertices);
+    shader_destroy(&shaders[0]);
+    shader_destroy(&shaders[1]);
+    headless_destroy(&headless);
+    return 0;
+}
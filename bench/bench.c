@@ -0,0 +1,104 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "glad/glad.h"
+#include "timer.h"
+#include "gl_intercept.h"
+#include "gl_capture.h"
+#include "gl_debug.h"
+
+double bench_now_ms(void) {
+    return timer_now_ms();
+}
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+BenchStats bench_stats(double* samples, int count) {
+    BenchStats stats = {0};
+    if (count <= 0) {
+        return stats;
+    }
+
+    qsort(samples, count, sizeof(double), compare_double);
+
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) {
+        sum += samples[i];
+    }
+
+    stats.min = samples[0];
+    stats.median = samples[count / 2];
+    stats.p99 = samples[(int)((count - 1) * 0.99)];
+    stats.mean = sum / count;
+    return stats;
+}
+
+void bench_print_stats(const char* label, BenchStats stats) {
+    printf("  %-10s min %8.4f  median %8.4f  p99 %8.4f  mean %8.4f ms\n",
+           label, stats.min, stats.median, stats.p99, stats.mean);
+}
+
+int bench_arg_int(int argc, char** argv, const char* name, int fallback) {
+    for (int i = 0; i + 1 < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return atoi(argv[i + 1]);
+        }
+    }
+    return fallback;
+}
+
+const char* bench_arg_string(int argc, char** argv, const char* name, const char* fallback) {
+    for (int i = 0; i + 1 < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return argv[i + 1];
+        }
+    }
+    return fallback;
+}
+
+int bench_arg_flag(int argc, char** argv, const char* name) {
+    for (int i = 0; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void bench_end_frame(void) {
+    gl_intercept_frame();
+    gl_debug_frame();
+}
+
+int bench_context(Headless* headless, int argc, char** argv) {
+    int width = bench_arg_int(argc, argv, "--width", 640);
+    int height = bench_arg_int(argc, argv, "--height", 480);
+
+    int debug = bench_arg_flag(argc, argv, "--gl-debug");
+
+    headless_set_debug(debug);
+    if (headless_create(headless, width, height) != 0) {
+        return -1;
+    }
+
+    printf("renderer: %s | %s\n", (const char*)glGetString(GL_RENDERER), (const char*)glGetString(GL_VERSION));
+    if (bench_arg_flag(argc, argv, "--gl-stats") && gl_intercept_install() != 0) {
+        headless_destroy(headless);
+        return -1;
+    }
+    const char* capture = bench_arg_string(argc, argv, "--capture", NULL);
+    if (capture && gl_capture_start(capture, width, height) != 0) {
+        headless_destroy(headless);
+        return -1;
+    }
+    if (debug && gl_debug_install() != 0) {
+        headless_destroy(headless);
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+#ifndef BENCH_H
+#define BENCH_H
+#include "headless.h"
+
+/*
+    Shared helpers for the gsl_bench scenarios. Every scenario runs against a
+    headless context so the numbers can be collected on CI machines without a
+    display.
+*/
+
+typedef struct {
+    double min;
+    double median;
+    double p99;
+    double mean;
+} BenchStats;
+
+double bench_now_ms(void);
+
+// sorts samples in place
+BenchStats bench_stats(double* samples, int count);
+void bench_print_stats(const char* label, BenchStats stats);
+
+// "--name value" lookup, returns fallback when the option is missing
+int bench_arg_int(int argc, char** argv, const char* name, int fallback);
+const char* bench_arg_string(int argc, char** argv, const char* name, const char* fallback);
+// 1 when the bare "--name" flag is present
+int bench_arg_flag(int argc, char** argv, const char* name);
+
+// also installs the GL call interception with --gl-stats, starts a GL capture with --capture FILE
+// and collects the driver's debug messages with --gl-debug
+int bench_context(Headless* headless, int argc, char** argv);
+// end of a scenario frame: closes the frame of --gl-stats and --capture and
+// prints the new --gl-debug messages. Scenarios without a frame loop get one
+// frame around the whole run from gsl_bench
+void bench_end_frame(void);
+
+// -- Scenarios -- //
+int bench_frame(int argc, char** argv);
+int bench_uniforms(int argc, char** argv);
+int bench_shaders(int argc, char** argv);
+int bench_reload(int argc, char** argv);
+int bench_batch(int argc, char** argv);
+int bench_stream(int argc, char** argv);
+int bench_instancing(int argc, char** argv);
+int bench_mesh(int argc, char** argv);
+int bench_vertex_format(int argc, char** argv);
+int bench_indirect(int argc, char** argv);
+int bench_math(int argc, char** argv);
+int bench_cull(int argc, char** argv);
+int bench_jobs(int argc, char** argv);
+int bench_commands(int argc, char** argv);
+int bench_input(int argc, char** argv);
+int bench_pacing(int argc, char** argv);
+int bench_textures(int argc, char** argv);
+
+#endif // BENCH_H
@@ -0,0 +1,267 @@
+#include "bench.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "glad/glad.h"
+#include "gl_state.h"
+#include "command_buffer.h"
+#include "figure.h"
+#include "jobs.h"
+#include "shader.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+/*
+    N animated triangles (50k by default), each with its own draw call and
+    offset/scale/tint uniforms (shaders/figure.vs):
+      direct   - the GL thread animates every object and issues its calls
+      recorded - job workers animate and record into per-worker command
+                 buffers (--grain objects per job) while the GL thread
+                 replays the previous frame, in object order
+    "gl thread" is everything the GL thread does for a frame: animate + issue
+    for direct; for recorded, the replay plus the chunks it recorded itself
+    as worker 0 while waiting for the others. With --submit-only the job
+    system is JOB_SUBMIT_ONLY and the GL thread records nothing. The share
+    of the recording that ran on other threads is reported too (0% with a
+    single worker). The last frame of both modes is read back and compared.
+*/
+
+#define SETS 2 // frame being recorded + frame being replayed
+
+typedef struct {
+    GLuint program;
+    GLuint vertex_array;
+    UniformHandle offset_scale;
+    UniformHandle tint;
+    long count;
+    long grain;
+    float time;
+    CommandBuffer* buffers; // one per worker, for the set being recorded
+} RecordFrame;
+
+typedef struct {
+    RecordFrame* frame;
+    long chunk;
+    int worker;   // where it was recorded
+    size_t begin;
+    size_t end;
+    double ms;
+} RecordChunk;
+
+static void animate(long i, float time, float* offset_scale, float* tint) {
+    float column = (float)(i % 250);
+    float row = (float)(i / 250 % 200);
+    float angle = time * (1.0f + (i % 7) * 0.3f) + i * 0.01f;
+    offset_scale[0] = -0.98f + column * 0.0078f + 0.004f * cosf(angle);
+    offset_scale[1] = -0.98f + row * 0.0098f + 0.004f * sinf(angle);
+    offset_scale[2] = 0.0f;
+    offset_scale[3] = 0.012f + 0.004f * sinf(angle * 2.0f);
+    tint[0] = 0.5f + 0.5f * sinf(angle);
+    tint[1] = 0.5f + 0.5f * sinf(angle + 2.1f);
+    tint[2] = 0.5f + 0.5f * sinf(angle + 4.2f);
+}
+
+static void record_chunk(void* data) {
+    RecordChunk* chunk = (RecordChunk*)data;
+    RecordFrame* frame = chunk->frame;
+    double start = bench_now_ms();
+
+    chunk->worker = job_worker_index();
+    CommandBuffer* buffer = &frame->buffers[chunk->worker];
+    chunk->begin = command_buffer_mark(buffer);
+
+    command_buffer_use_program(buffer, frame->program);
+    command_buffer_bind_vertex_array(buffer, frame->vertex_array);
+    long first = chunk->chunk * frame->grain;
+    long end = first + frame->grain < frame->count ? first + frame->grain : frame->count;
+    for (long i = first; i < end; i++) {
+        float offset_scale[4], tint[3];
+        animate(i, frame->time, offset_scale, tint);
+        command_buffer_uniform_4f(buffer, frame->offset_scale, offset_scale[0], offset_scale[1], offset_scale[2], offset_scale[3]);
+        command_buffer_uniform_3f(buffer, frame->tint, tint[0], tint[1], tint[2]);
+        command_buffer_draw_arrays(buffer, GL_TRIANGLES, 0, 3);
+    }
+
+    chunk->end = command_buffer_mark(buffer);
+    chunk->ms = bench_now_ms() - start;
+}
+
+static void replay(RecordFrame* frame, RecordChunk* chunks, long chunk_count) {
+    glClear(GL_COLOR_BUFFER_BIT);
+    for (long c = 0; c < chunk_count; c++) {
+        command_buffer_replay_range(&frame->buffers[chunks[c].worker], chunks[c].begin, chunks[c].end);
+    }
+}
+
+int bench_commands(int argc, char** argv) {
+    long count = bench_arg_int(argc, argv, "--draws", 50000);
+    int frames = bench_arg_int(argc, argv, "--frames", 20);
+    int workers = bench_arg_int(argc, argv, "--workers", (int)sysconf(_SC_NPROCESSORS_ONLN));
+    long grain = bench_arg_int(argc, argv, "--grain", 1024);
+    int submit_only = bench_arg_flag(argc, argv, "--submit-only");
+    grain = grain < 1 ? 1 : grain;
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+    Shader shader = create_shader(GSL_SHADER_DIR "/figure.vs", GSL_SHADER_DIR "/model.fs");
+    if (!shader.ID) {
+        headless_destroy(&headless);
+        return -1;
+    }
+    float vertices[] = {
+         0.5f, -0.5f, 0.0f,  1.0f, 0.0f, 0.0f,
+        -0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f,
+         0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f
+    };
+    Figure figure;
+    figure_init(&figure, vertices, 3, NULL, 0);
+    UniformHandle offset_scale = shader_uniform_handle(&shader, "offset_scale");
+    UniformHandle tint = shader_uniform_handle(&shader, "tint");
+
+    size_t pixels_size = (size_t)headless.width * headless.height * 4;
+    unsigned char* direct_pixels = (unsigned char*)malloc(pixels_size);
+    unsigned char* recorded_pixels = (unsigned char*)malloc(pixels_size);
+    double* gl_thread = (double*)malloc(frames * sizeof(double));
+    double* total = (double*)malloc(frames * sizeof(double));
+    double* recording = (double*)malloc(frames * sizeof(double));
+    double* gl_recording = (double*)malloc(frames * sizeof(double)); // recorded by the GL thread
+    printf("commands: %ld draws, %d frames\n", count, frames);
+
+    // -- Direct -- //
+    for (int f = 0; f < frames; f++) {
+        double start = bench_now_ms();
+        glClear(GL_COLOR_BUFFER_BIT);
+        shader_use(&shader);
+        gl_state_bind_vertex_array(figure.VAO);
+        for (long i = 0; i < count; i++) {
+            float os[4], t[3];
+            animate(i, f * 0.016f, os, t);
+            shader_set_vec4_h(&shader, offset_scale, os[0], os[1], os[2], os[3]);
+            shader_set_vec3_h(&shader, tint, t[0], t[1], t[2]);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+        gl_thread[f] = bench_now_ms() - start;
+        glFinish();
+        total[f] = bench_now_ms() - start;
+        bench_end_frame();
+    }
+    glReadPixels(0, 0, headless.width, headless.height, GL_RGBA, GL_UNSIGNED_BYTE, direct_pixels);
+    double direct_gl = bench_stats(gl_thread, frames).median;
+    printf("  direct\n");
+    bench_print_stats("gl thread", bench_stats(gl_thread, frames));
+    bench_print_stats("frame", bench_stats(total, frames));
+
+    // -- Recorded -- //
+    JobSystem jobs;
+    if (job_system_init(&jobs, workers, submit_only ? JOB_SUBMIT_ONLY : 0) != 0) {
+        free(direct_pixels);
+        free(recorded_pixels);
+        free(gl_thread);
+        free(total);
+        free(recording);
+        free(gl_recording);
+        figure_destroy(&figure);
+        shader_destroy(&shader);
+        headless_destroy(&headless);
+        return -1;
+    }
+    long chunk_count = (count + grain - 1) / grain;
+    RecordFrame sets[SETS];
+    RecordChunk* chunks[SETS];
+    for (int s = 0; s < SETS; s++) {
+        sets[s] = (RecordFrame){ shader.ID, figure.VAO, offset_scale, tint, count, grain, 0.0f, NULL };
+        sets[s].buffers = (CommandBuffer*)malloc(jobs.worker_count * sizeof(CommandBuffer));
+        for (int w = 0; w < jobs.worker_count; w++) {
+            command_buffer_init(&sets[s].buffers[w], 1 << 20);
+        }
+        chunks[s] = (RecordChunk*)calloc(chunk_count, sizeof(RecordChunk));
+    }
+
+    // worker 0 is the GL thread unless it only submits
+    int gl_worker = submit_only ? -1 : 0;
+    double record_total = 0.0, gl_record_total = 0.0;
+    size_t bytes = 0;
+    // frame f is recorded while f - 1 is replayed, one extra iteration drains it
+    for (int f = 0; f <= frames; f++) {
+        double start = bench_now_ms();
+        RecordFrame* recording_set = &sets[f % SETS];
+        JobCounter recorded = JOB_COUNTER_INIT;
+        if (f < frames) {
+            recording_set->time = f * 0.016f;
+            for (int w = 0; w < jobs.worker_count; w++) {
+                command_buffer_reset(&recording_set->buffers[w]);
+            }
+            for (long c = 0; c < chunk_count; c++) {
+                chunks[f % SETS][c] = (RecordChunk){ recording_set, c, 0, 0, 0, 0.0 };
+                job_run(&jobs, record_chunk, &chunks[f % SETS][c], &recorded);
+            }
+        }
+
+        double replay_ms = 0.0;
+        if (f > 0) {
+            double replay_start = bench_now_ms();
+            replay(&sets[(f - 1) % SETS], chunks[(f - 1) % SETS], chunk_count);
+            replay_ms = bench_now_ms() - replay_start;
+        }
+        job_wait(&jobs, &recorded);
+
+        if (f > 0) {
+            glFinish();
+            gl_thread[f - 1] = replay_ms + gl_recording[f - 1];
+            total[f - 1] = bench_now_ms() - start;
+            bench_end_frame();
+        }
+        if (f < frames) {
+            double record_ms = 0.0, gl_record_ms = 0.0;
+            bytes = 0;
+            for (long c = 0; c < chunk_count; c++) {
+                const RecordChunk* chunk = &chunks[f % SETS][c];
+                record_ms += chunk->ms;
+                gl_record_ms += chunk->worker == gl_worker ? chunk->ms : 0.0;
+                bytes += chunk->end - chunk->begin;
+            }
+            recording[f] = record_ms;
+            gl_recording[f] = gl_record_ms;
+            record_total += record_ms;
+            gl_record_total += gl_record_ms;
+        }
+    }
+    glReadPixels(0, 0, headless.width, headless.height, GL_RGBA, GL_UNSIGNED_BYTE, recorded_pixels);
+
+    double recorded_gl = bench_stats(gl_thread, frames).median;
+    printf("  recorded: %d workers%s, %ld jobs per frame, %.2f MB of commands per frame\n",
+           jobs.worker_count, submit_only ? " (GL thread submit only)" : "", chunk_count, bytes / (1024.0 * 1024.0));
+    bench_print_stats("gl thread", bench_stats(gl_thread, frames));
+    bench_print_stats("recording", bench_stats(recording, frames));
+    bench_print_stats("frame", bench_stats(total, frames));
+    printf("  %.1f%% of the recording ran off the GL thread, GL thread time %+.1f%% against direct, last frame %s\n",
+           record_total > 0.0 ? 100.0 * (1.0 - gl_record_total / record_total) : 0.0,
+           100.0 * (recorded_gl / direct_gl - 1.0),
+           memcmp(direct_pixels, recorded_pixels, pixels_size) == 0 ? "identical" : "DIFFERENT");
+
+    int worker_count = jobs.worker_count;
+    job_system_shutdown(&jobs);
+    for (int s = 0; s < SETS; s++) {
+        for (int w = 0; w < worker_count; w++) {
+            command_buffer_free(&sets[s].buffers[w]);
+        }
+        free(sets[s].buffers);
+        free(chunks[s]);
+    }
+    free(direct_pixels);
+    free(recorded_pixels);
+    free(gl_thread);
+    free(total);
+    free(recording);
+    free(gl_recording);
+    figure_destroy(&figure);
+    shader_destroy(&shader);
+    headless_destroy(&headless);
+    return 0;
+}
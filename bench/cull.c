@@ -0,0 +1,150 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "cull.h"
+#include "jobs.h"
+
+/*
+    Frustum culling of N objects (1M by default) scattered around a
+    perspective camera, as bounding spheres and as AABBs:
+      every ISA level on one thread, the visible list checked against scalar
+      the best level on a job system with --threads workers (default: online
+      cores), job_parallel_for over --grain objects per job, each chunk
+      culled into its own part of the output which is then compacted
+*/
+
+typedef struct {
+    const Frustum* frustum;
+    const CullSpheres* spheres;
+    const CullBoxes* boxes;
+    long grain;
+    unsigned int* visible;
+    long* chunk_visible; // visible count of each grain sized chunk
+} CullPass;
+
+// one grain at a time: with a single worker the whole range comes in one call
+static void cull_range(void* data, long first, long end) {
+    CullPass* pass = (CullPass*)data;
+    for (; first < end; first += pass->grain) {
+        long count = end - first < pass->grain ? end - first : pass->grain;
+        long n;
+        if (pass->spheres) {
+            n = cull_spheres(pass->frustum, pass->spheres, first, count, pass->visible + first);
+        } else {
+            n = cull_boxes(pass->frustum, pass->boxes, first, count, pass->visible + first);
+        }
+        pass->chunk_visible[first / pass->grain] = n;
+    }
+}
+
+// every chunk writes into its own part of visible, then the parts are moved together
+static long cull_parallel(JobSystem* jobs, CullPass* pass, long count) {
+    job_parallel_for(jobs, count, pass->grain, cull_range, pass);
+    long total = 0;
+    for (long first = 0; first < count; first += pass->grain) {
+        long n = pass->chunk_visible[first / pass->grain];
+        memmove(pass->visible + total, pass->visible + first, n * sizeof(unsigned int));
+        total += n;
+    }
+    return total;
+}
+
+static float random_range(float low, float high) {
+    return low + (rand() / (float)RAND_MAX) * (high - low);
+}
+
+static void report(const char* label, long count, long visible, double* times, int rounds, int matches) {
+    BenchStats stats = bench_stats(times, rounds);
+    printf("  %-22s %8.3f ms  %7.1f M objects/s  %ld visible%s\n", label, stats.median,
+           count / stats.median / 1000.0, visible, matches ? "" : "  MISMATCH");
+}
+
+int bench_cull(int argc, char** argv) {
+    long count = bench_arg_int(argc, argv, "--objects", 1000000);
+    int rounds = bench_arg_int(argc, argv, "--rounds", 20);
+    int threads = bench_arg_int(argc, argv, "--threads", (int)sysconf(_SC_NPROCESSORS_ONLN));
+    long grain = bench_arg_int(argc, argv, "--grain", 16384);
+    threads = threads < 1 ? 1 : threads > JOB_MAX_WORKERS ? JOB_MAX_WORKERS : threads;
+    grain = grain < 1 ? 1 : grain;
+    // job_parallel_for keeps the grain as long as the chunks fit
+    if ((count + grain - 1) / grain > JOB_PARALLEL_MAX_CHUNKS) {
+        grain = (count + JOB_PARALLEL_MAX_CHUNKS - 1) / JOB_PARALLEL_MAX_CHUNKS;
+    }
+
+    CullSpheres spheres = {0};
+    CullBoxes boxes = {0};
+    srand(5);
+    for (long i = 0; i < count; i++) {
+        Vec3 center = { random_range(-500.0f, 500.0f), random_range(-50.0f, 50.0f), random_range(-500.0f, 500.0f) };
+        Vec3 extent = { random_range(0.5f, 4.0f), random_range(0.5f, 4.0f), random_range(0.5f, 4.0f) };
+        cull_spheres_push(&spheres, center, vec3_length(extent));
+        cull_boxes_push(&boxes, center, extent);
+    }
+
+    // 90 degree camera looking down -z from the middle: roughly a quarter is visible
+    Mat4 projection = mat4_perspective(1.5708f, 16.0f / 9.0f, 0.1f, 400.0f);
+    Mat4 view = mat4_look_at((Vec3){ 0.0f, 0.0f, 0.0f }, (Vec3){ 0.0f, 0.0f, -1.0f }, (Vec3){ 0.0f, 1.0f, 0.0f });
+    Mat4 view_projection = mat4_mul(&projection, &view);
+    Frustum frustum;
+    frustum_from_matrix(&frustum, &view_projection);
+
+    unsigned int* reference = (unsigned int*)malloc(count * sizeof(unsigned int));
+    unsigned int* visible = (unsigned int*)malloc(count * sizeof(unsigned int));
+    double* times = (double*)malloc(rounds * sizeof(double));
+    long* chunk_visible = (long*)calloc((count + grain - 1) / grain, sizeof(long));
+    printf("cull: %ld objects, %d rounds, %d threads\n", count, rounds, threads);
+
+    JobSystem single;
+    JobSystem jobs;
+    if (job_system_init(&single, 1, 0) != 0 || job_system_init(&jobs, threads, 0) != 0) {
+        return -1;
+    }
+
+    for (int kind = 0; kind < 2; kind++) {
+        const CullSpheres* s = kind == 0 ? &spheres : NULL;
+        const CullBoxes* b = kind == 0 ? NULL : &boxes;
+        const char* kind_name = kind == 0 ? "spheres" : "boxes";
+        char label[64];
+        CullPass pass = { &frustum, s, b, grain, reference, chunk_visible };
+
+        vecmath_set_isa(VECMATH_SCALAR);
+        long expected = cull_parallel(&single, &pass, count);
+        pass.visible = visible;
+
+        for (int level = VECMATH_SCALAR; level <= (int)vecmath_isa_supported(); level++) {
+            VecmathIsa isa = vecmath_set_isa((VecmathIsa)level);
+            long n = 0;
+            for (int r = 0; r < rounds; r++) {
+                double start = bench_now_ms();
+                n = cull_parallel(&single, &pass, count);
+                times[r] = bench_now_ms() - start;
+            }
+            int matches = n == expected && memcmp(visible, reference, n * sizeof(unsigned int)) == 0;
+            snprintf(label, sizeof(label), "%s %s", kind_name, vecmath_isa_name(isa));
+            report(label, count, n, times, rounds, matches);
+        }
+
+        VecmathIsa isa = vecmath_set_isa(vecmath_isa_supported());
+        long n = 0;
+        for (int r = 0; r < rounds; r++) {
+            double start = bench_now_ms();
+            n = cull_parallel(&jobs, &pass, count);
+            times[r] = bench_now_ms() - start;
+        }
+        int matches = n == expected && memcmp(visible, reference, n * sizeof(unsigned int)) == 0;
+        snprintf(label, sizeof(label), "%s %s x%d", kind_name, vecmath_isa_name(isa), threads);
+        report(label, count, n, times, rounds, matches);
+    }
+
+    job_system_shutdown(&jobs);
+    job_system_shutdown(&single);
+    free(chunk_visible);
+    free(reference);
+    free(visible);
+    free(times);
+    cull_spheres_free(&spheres);
+    cull_boxes_free(&boxes);
+    return 0;
+}
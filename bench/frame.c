@@ -0,0 +1,96 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "glad/glad.h"
+#include "scene.h"
+#include "cull.h"
+#include "gl_state.h"
+#include "shader_cache.h"
+#include "gl_intercept.h"
+#include "gl_debug.h"
+
+/*
+    Renders the scene from main.c N times into the offscreen framebuffer.
+
+    CPU time is the time spent issuing the frame. GPU time comes from
+    GL_TIME_ELAPSED queries kept in a small ring: the result for frame i is
+    read back at frame i + QUERY_RING, which also keeps the CPU from running
+    more than QUERY_RING frames ahead of the GPU (what a swap chain would do).
+*/
+
+#define QUERY_RING 4
+#define WARMUP_FRAMES 16
+
+int bench_frame(int argc, char** argv) {
+    int frames = bench_arg_int(argc, argv, "--frames", 1000);
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+
+    gl_state_set_blend(1);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    Scene scene;
+    if (scene_init(&scene) != 0) {
+        headless_destroy(&headless);
+        return -1;
+    }
+    shader_cache_report();
+
+    // same per frame work as the loop in main.c
+    Mat4 view_projection = mat4_identity();
+    Frustum frustum;
+    frustum_from_matrix(&frustum, &view_projection);
+
+    for (int i = 0; i < WARMUP_FRAMES; i++) {
+        scene_cull(&scene, &frustum);
+        scene_draw(&scene);
+    }
+    glFinish();
+
+    double* cpu = (double*)malloc(frames * sizeof(double));
+    double* gpu = (double*)malloc(frames * sizeof(double));
+    unsigned int queries[QUERY_RING];
+    glGenQueries(QUERY_RING, queries);
+    gl_state_reset_stats();
+    gl_intercept_reset();
+
+    for (int i = 0; i < frames + QUERY_RING; i++) {
+        int slot = i % QUERY_RING;
+
+        if (i >= QUERY_RING) {
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(queries[slot], GL_QUERY_RESULT, &elapsed);
+            gpu[i - QUERY_RING] = elapsed / 1e6;
+        }
+        if (i >= frames) {
+            continue;
+        }
+
+        double start = bench_now_ms();
+        glBeginQuery(GL_TIME_ELAPSED, queries[slot]);
+        scene_cull(&scene, &frustum);
+        scene_draw(&scene);
+        glEndQuery(GL_TIME_ELAPSED);
+        glFlush();
+        cpu[i] = bench_now_ms() - start;
+        bench_end_frame();
+    }
+
+    printf("frame: %d frames at %dx%d\n", frames, headless.width, headless.height);
+    bench_print_stats("cpu", bench_stats(cpu, frames));
+    bench_print_stats("gpu", bench_stats(gpu, frames));
+
+    GLStateStats state = gl_state_stats();
+    printf("  state calls per frame: %.2f issued, %.2f elided\n",
+           (double)state.issued / frames, (double)state.elided / frames);
+
+    glDeleteQueries(QUERY_RING, queries);
+    free(cpu);
+    free(gpu);
+    scene_destroy(&scene);
+    headless_destroy(&headless);
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "glad/glad.h"
+#include "draw_indirect.h"
+#include "shader.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+/*
+    N small draws per frame (20k by default), half triangles and half
+    indexed quads, each with its own offset/scale/tint:
+      direct   - one glDrawArrays / glDrawElementsBaseVertex per draw (3.3 path)
+      indirect - one glMultiDraw*Indirect per kind, per-draw data via base instance
+    "submit" is the CPU time of draw_queue_submit, "frame" adds the GPU work.
+*/
+
+static int run(const char* label, int allow_indirect, int draws, int frames, double* submit, double* frame) {
+    float triangle[] = {
+         0.5f, -0.5f, 0.0f,  1.0f, 0.0f, 0.0f,
+        -0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f,
+         0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f
+    };
+    float quad[] = {
+        -0.5f, -0.5f, 0.0f,  1.0f, 1.0f, 0.0f,
+         0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 1.0f,
+         0.5f,  0.5f, 0.0f,  1.0f, 0.0f, 1.0f,
+        -0.5f,  0.5f, 0.0f,  1.0f, 1.0f, 1.0f
+    };
+    unsigned int quad_indices[] = { 0, 1, 2, 2, 3, 0 };
+
+    DrawQueue queue;
+    if (draw_queue_init(&queue, 64, 64, draws, allow_indirect) != 0) {
+        return -1;
+    }
+    if (allow_indirect && !queue.indirect) {
+        printf("  %s: GL 4.3 not available, skipped\n", label);
+        draw_queue_destroy(&queue);
+        return 1;
+    }
+    int meshes[2];
+    meshes[0] = draw_queue_add_mesh(&queue, triangle, 3, NULL, 0);
+    meshes[1] = draw_queue_add_mesh(&queue, quad, 4, quad_indices, 6);
+
+    srand(13);
+    FigureInstance* instances = (FigureInstance*)malloc(draws * sizeof(FigureInstance));
+    for (int i = 0; i < draws; i++) {
+        instances[i].x = (rand() / (float)RAND_MAX) * 1.9f - 0.95f;
+        instances[i].y = (rand() / (float)RAND_MAX) * 1.9f - 0.95f;
+        instances[i].z = 0.0f;
+        instances[i].scale = 0.02f;
+        instances[i].r = instances[i].g = instances[i].b = rand() / (float)RAND_MAX;
+    }
+
+    for (int f = 0; f < frames; f++) {
+        double start = bench_now_ms();
+        glClear(GL_COLOR_BUFFER_BIT);
+        draw_queue_begin(&queue);
+        for (int i = 0; i < draws; i++) {
+            draw_queue_push(&queue, meshes[i & 1], &instances[i]);
+        }
+        draw_queue_submit(&queue);
+        glFinish();
+        frame[f] = bench_now_ms() - start;
+        submit[f] = queue.submit_ms;
+        bench_end_frame();
+    }
+
+    printf("  %s: %d draw calls per frame\n", label, queue.draw_calls);
+    bench_print_stats("submit", bench_stats(submit, frames));
+    bench_print_stats("frame", bench_stats(frame, frames));
+
+    free(instances);
+    draw_queue_destroy(&queue);
+    return 0;
+}
+
+int bench_indirect(int argc, char** argv) {
+    int draws = bench_arg_int(argc, argv, "--draws", 20000);
+    int frames = bench_arg_int(argc, argv, "--frames", 30);
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+    Shader shader = create_shader(GSL_SHADER_DIR "/instanced.vs", GSL_SHADER_DIR "/model.fs");
+    if (!shader.ID) {
+        headless_destroy(&headless);
+        return -1;
+    }
+    shader_use(&shader);
+
+    double* submit = (double*)malloc(frames * sizeof(double));
+    double* frame = (double*)malloc(frames * sizeof(double));
+    printf("indirect: %d draws, %d frames\n", draws, frames);
+
+    int result = run("direct", 0, draws, frames, submit, frame);
+    double direct_submit = bench_stats(submit, frames).median;
+    if (result == 0 && run("indirect", 1, draws, frames, submit, frame) == 0) {
+        printf("  submit speedup %.1fx\n", direct_submit / bench_stats(submit, frames).median);
+    }
+
+    free(submit);
+    free(frame);
+    shader_destroy(&shader);
+    headless_destroy(&headless);
+    return result < 0 ? -1 : 0;
+}
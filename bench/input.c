@@ -0,0 +1,206 @@
+#include "bench.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "glad/glad.h"
+#include "cull.h"
+#include "event_queue.h"
+#include "gl_state.h"
+#include "scene.h"
+
+/*
+    Input-to-frame latency of the two loops in main.c, without a window.
+
+    A source thread plays the OS: it emits cursor events at --rate per second
+    into a queue. "Polling" that queue costs --event-cost microseconds per
+    event (the GLFW callbacks and whatever the platform does around them).
+    The swap is a glFinish followed by a sleep to the next --interval ms
+    boundary, like a blocking vsync swap.
+      single   - input, draw, swap, poll, all on the GL thread
+      threaded - an event thread polls and forwards into an EventQueue, the
+                 GL thread drains it at the start of each frame
+    Latency is from the event being emitted to the return of the swap of the
+    first frame that saw it.
+*/
+
+typedef struct {
+    EventQueue* os;
+    int rate;
+    atomic_int running;
+} Source;
+
+typedef struct {
+    EventQueue* os;
+    EventQueue* app;
+    int cost_us;
+    atomic_int running;
+} EventThread;
+
+typedef struct {
+    double* samples;
+    int count;
+    int capacity;
+} Latencies;
+
+static void sleep_ms(double ms) {
+    if (ms <= 0.0) {
+        return;
+    }
+    struct timespec ts = { (time_t)(ms / 1e3), (long)((ms - (time_t)(ms / 1e3) * 1e3) * 1e6) };
+    nanosleep(&ts, NULL);
+}
+
+static void* source_main(void* data) {
+    Source* source = (Source*)data;
+    while (atomic_load(&source->running)) {
+        WindowEvent event = { .type = EVENT_CURSOR, .time_ms = bench_now_ms() };
+        event_queue_push(source->os, &event);
+        sleep_ms(1e3 / source->rate);
+    }
+    return NULL;
+}
+
+// moves what the "OS" had queued when called into app, paying cost_us per event
+static int poll_events(EventQueue* os, EventQueue* app, int cost_us) {
+    double start = bench_now_ms();
+    WindowEvent event;
+    int polled = 0;
+    while (event_queue_pop(os, &event)) {
+        double until = bench_now_ms() + cost_us / 1e3;
+        while (bench_now_ms() < until) {
+        }
+        event_queue_push(app, &event);
+        polled++;
+        if (event.time_ms > start) {
+            break;
+        }
+    }
+    return polled;
+}
+
+static void* event_thread_main(void* data) {
+    EventThread* events = (EventThread*)data;
+    while (atomic_load(&events->running)) {
+        if (!poll_events(events->os, events->app, events->cost_us)) {
+            sleep_ms(0.1); // glfwWaitEvents
+        }
+    }
+    return NULL;
+}
+
+static void present(double start, double interval) {
+    glFinish();
+    if (interval > 0.0) {
+        double now = bench_now_ms();
+        double next = start + interval * ((long)((now - start) / interval) + 1);
+        sleep_ms(next - now);
+    }
+}
+
+static void run(const char* label, int threaded, Scene* scene, const Frustum* frustum, int frames, int rate, double interval, int cost_us) {
+    EventQueue* os = event_queue_create();
+    EventQueue* app = event_queue_create();
+    if (!os || !app) {
+        fprintf(stderr, "input: out of memory\n");
+        free(os);
+        free(app);
+        return;
+    }
+
+    Latencies latencies = { NULL, 0, 0 };
+    double* frame_times = (double*)malloc(frames * sizeof(double));
+    double* pending = (double*)malloc(EVENT_QUEUE_SIZE * sizeof(double));
+
+    Source source = { os, rate, 1 };
+    EventThread events = { os, app, cost_us, 1 };
+    pthread_t source_thread, event_thread;
+    pthread_create(&source_thread, NULL, source_main, &source);
+    if (threaded) {
+        pthread_create(&event_thread, NULL, event_thread_main, &events);
+    }
+
+    double start = bench_now_ms();
+    for (int f = 0; f < frames; f++) {
+        double frame_start = bench_now_ms();
+
+        // -- Input -- //
+        int count = 0;
+        WindowEvent event;
+        while (event_queue_pop(app, &event)) {
+            pending[count++] = event.time_ms;
+        }
+
+        scene_cull(scene, frustum);
+        scene_draw(scene);
+        present(start, interval);
+
+        double now = bench_now_ms();
+        if (latencies.count + count > latencies.capacity) {
+            latencies.capacity = (latencies.count + count) * 2;
+            latencies.samples = (double*)realloc(latencies.samples, latencies.capacity * sizeof(double));
+        }
+        for (int i = 0; i < count; i++) {
+            latencies.samples[latencies.count++] = now - pending[i];
+        }
+
+        if (!threaded) {
+            poll_events(os, app, cost_us);
+        }
+        frame_times[f] = bench_now_ms() - frame_start;
+        bench_end_frame();
+    }
+
+    atomic_store(&source.running, 0);
+    pthread_join(source_thread, NULL);
+    if (threaded) {
+        atomic_store(&events.running, 0);
+        pthread_join(event_thread, NULL);
+    }
+
+    printf("  %s: %d events, %u dropped\n", label, latencies.count,
+           atomic_load(&os->dropped) + atomic_load(&app->dropped));
+    bench_print_stats("latency", bench_stats(latencies.samples, latencies.count));
+    bench_print_stats("frame", bench_stats(frame_times, frames));
+
+    free(latencies.samples);
+    free(frame_times);
+    free(pending);
+    free(os);
+    free(app);
+}
+
+int bench_input(int argc, char** argv) {
+    int frames = bench_arg_int(argc, argv, "--frames", 300);
+    int rate = bench_arg_int(argc, argv, "--rate", 1000);
+    int interval = bench_arg_int(argc, argv, "--interval", 16);
+    int cost_us = bench_arg_int(argc, argv, "--event-cost", 20);
+    rate = rate < 1 ? 1 : rate;
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+
+    gl_state_set_blend(1);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    Scene scene;
+    if (scene_init(&scene) != 0) {
+        headless_destroy(&headless);
+        return -1;
+    }
+
+    Mat4 view_projection = mat4_identity();
+    Frustum frustum;
+    frustum_from_matrix(&frustum, &view_projection);
+
+    printf("input: %d frames, %d events/s, %d ms swap interval, %d us per event\n", frames, rate, interval, cost_us);
+    run("single", 0, &scene, &frustum, frames, rate, interval, cost_us);
+    run("threaded", 1, &scene, &frustum, frames, rate, interval, cost_us);
+
+    scene_destroy(&scene);
+    headless_destroy(&headless);
+    return 0;
+}
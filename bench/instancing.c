@@ -0,0 +1,105 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "glad/glad.h"
+#include "figure.h"
+#include "shader.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+/*
+    Draws the scene triangle N times (1M by default):
+      naive     - shaders/figure.vs, set offset/tint uniforms + one draw per copy
+      instanced - shaders/instanced.vs, one glDrawArraysInstanced for all copies
+    The naive loop is much slower, --naive limits how many copies it draws
+    per frame; its time is scaled to N for the comparison.
+*/
+
+int bench_instancing(int argc, char** argv) {
+    int instances = bench_arg_int(argc, argv, "--instances", 1000000);
+    int naive_count = bench_arg_int(argc, argv, "--naive", instances < 100000 ? instances : 100000);
+    int frames = bench_arg_int(argc, argv, "--frames", 5);
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+
+    Shader uniform_shader = create_shader(GSL_SHADER_DIR "/figure.vs", GSL_SHADER_DIR "/model.fs");
+    Shader instanced_shader = create_shader(GSL_SHADER_DIR "/instanced.vs", GSL_SHADER_DIR "/model.fs");
+    if (!uniform_shader.ID || !instanced_shader.ID) {
+        headless_destroy(&headless);
+        return -1;
+    }
+
+    float vertices[] = {
+         0.5f, -0.5f, 0.0f,  1.0f, 0.0f, 0.0f,
+        -0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f,
+         0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f
+    };
+    Figure figure;
+    figure_init(&figure, vertices, 3, NULL, 0);
+
+    FigureInstance* data = (FigureInstance*)malloc(instances * sizeof(FigureInstance));
+    srand(7);
+    for (int i = 0; i < instances; i++) {
+        data[i].x = (rand() / (float)RAND_MAX) * 1.9f - 0.95f;
+        data[i].y = (rand() / (float)RAND_MAX) * 1.9f - 0.95f;
+        data[i].z = 0.0f;
+        data[i].scale = 0.01f;
+        data[i].r = data[i].g = data[i].b = rand() / (float)RAND_MAX;
+    }
+
+    double* times = (double*)malloc(frames * sizeof(double));
+
+    // -- Naive -- //
+    shader_use(&uniform_shader);
+    UniformHandle offset_scale = shader_uniform_handle(&uniform_shader, "offset_scale");
+    UniformHandle tint = shader_uniform_handle(&uniform_shader, "tint");
+    for (int f = 0; f < frames; f++) {
+        double start = bench_now_ms();
+        glClear(GL_COLOR_BUFFER_BIT);
+        for (int i = 0; i < naive_count; i++) {
+            shader_set_vec4_h(&uniform_shader, offset_scale, data[i].x, data[i].y, data[i].z, data[i].scale);
+            shader_set_vec3_h(&uniform_shader, tint, data[i].r, data[i].g, data[i].b);
+            figure_draw(&figure);
+        }
+        glFinish();
+        times[f] = (bench_now_ms() - start) * instances / naive_count;
+        bench_end_frame();
+    }
+    printf("instancing: %d instances, %d frames\n", instances, frames);
+    printf("  naive: %d draw calls per frame (measured %d, scaled)\n", instances, naive_count);
+    BenchStats naive = bench_stats(times, frames);
+    bench_print_stats("frame", naive);
+
+    // -- Instanced -- //
+    double upload_start = bench_now_ms();
+    figure_set_instances(&figure, data, instances);
+    glFinish();
+    double upload_ms = bench_now_ms() - upload_start;
+
+    shader_use(&instanced_shader);
+    for (int f = 0; f < frames; f++) {
+        double start = bench_now_ms();
+        glClear(GL_COLOR_BUFFER_BIT);
+        figure_draw_instanced(&figure);
+        glFinish();
+        times[f] = bench_now_ms() - start;
+        bench_end_frame();
+    }
+    printf("  instanced: 1 draw call per frame (instance upload %.2f ms)\n", upload_ms);
+    BenchStats instanced = bench_stats(times, frames);
+    bench_print_stats("frame", instanced);
+    printf("  speedup %.1fx\n", naive.median / instanced.median);
+
+    free(times);
+    free(data);
+    figure_destroy(&figure);
+    shader_destroy(&uniform_shader);
+    shader_destroy(&instanced_shader);
+    headless_destroy(&headless);
+    return 0;
+}
@@ -0,0 +1,192 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "jobs.h"
+#include "cull.h"
+
+/*
+    Synthetic per-object frame on 1..N workers (N = --workers, default the
+    online cores), 200k objects by default:
+      update - integrate position, spin the rotation, rebuild the model
+               matrix and the bounding sphere (one job per --grain objects)
+      cull   - cull the spheres of each chunk, queued with job_run_after so
+               it starts as soon as every update job is done
+    The visible count must be the same for every worker count. Utilization
+    is the share of the frame time each worker spent inside jobs.
+
+    --submit-only creates the systems with JOB_SUBMIT_ONLY: the bench thread
+    only queues the frame and waits, N worker threads run it.
+*/
+
+typedef struct {
+    long count;
+    Vec3* positions;
+    Vec3* velocities;
+    Quat* rotations;
+    Quat spin;
+    Mat4* models;
+    CullSpheres bounds;
+    Frustum frustum;
+    unsigned int* visible;  // one slot per object, each chunk fills its own part
+    long* chunk_visible;
+    long grain;
+} World;
+
+typedef struct {
+    World* world;
+    long chunk;
+} Chunk;
+
+static void update_chunk(void* data) {
+    Chunk* c = (Chunk*)data;
+    World* world = c->world;
+    long first = c->chunk * world->grain;
+    long end = first + world->grain < world->count ? first + world->grain : world->count;
+    const float dt = 1.0f / 60.0f;
+
+    for (long i = first; i < end; i++) {
+        Vec3 p = vec3_add(world->positions[i], vec3_scale(world->velocities[i], dt));
+        if (p.x < -100.0f || p.x > 100.0f) world->velocities[i].x = -world->velocities[i].x;
+        if (p.y < -100.0f || p.y > 100.0f) world->velocities[i].y = -world->velocities[i].y;
+        if (p.z < -100.0f || p.z > 100.0f) world->velocities[i].z = -world->velocities[i].z;
+        world->positions[i] = p;
+        world->rotations[i] = quat_normalize(quat_mul(world->spin, world->rotations[i]));
+        world->models[i] = mat4_from_trs(p, world->rotations[i], (Vec3){ 1.0f, 1.0f, 1.0f });
+        world->bounds.x[i] = p.x;
+        world->bounds.y[i] = p.y;
+        world->bounds.z[i] = p.z;
+    }
+}
+
+static void cull_chunk(void* data) {
+    Chunk* c = (Chunk*)data;
+    World* world = c->world;
+    long first = c->chunk * world->grain;
+    long count = first + world->grain < world->count ? world->grain : world->count - first;
+    world->chunk_visible[c->chunk] = cull_spheres(&world->frustum, &world->bounds, first, count, world->visible + first);
+}
+
+static long run_frame(JobSystem* system, World* world, Chunk* chunks, long chunk_count) {
+    JobCounter updated = JOB_COUNTER_INIT;
+    JobCounter culled = JOB_COUNTER_INIT;
+    for (long c = 0; c < chunk_count; c++) {
+        job_run(system, update_chunk, &chunks[c], &updated);
+    }
+    for (long c = 0; c < chunk_count; c++) {
+        job_run_after(system, &updated, cull_chunk, &chunks[c], &culled);
+    }
+    job_wait(system, &culled);
+
+    long visible = 0;
+    for (long c = 0; c < chunk_count; c++) {
+        visible += world->chunk_visible[c];
+    }
+    return visible;
+}
+
+static float random_range(float low, float high) {
+    return low + (rand() / (float)RAND_MAX) * (high - low);
+}
+
+static void reset_world(World* world) {
+    srand(3);
+    for (long i = 0; i < world->count; i++) {
+        world->positions[i] = (Vec3){ random_range(-100.0f, 100.0f), random_range(-100.0f, 100.0f), random_range(-100.0f, 100.0f) };
+        world->velocities[i] = (Vec3){ random_range(-20.0f, 20.0f), random_range(-20.0f, 20.0f), random_range(-20.0f, 20.0f) };
+        world->rotations[i] = quat_identity();
+        world->bounds.x[i] = world->positions[i].x;
+        world->bounds.y[i] = world->positions[i].y;
+        world->bounds.z[i] = world->positions[i].z;
+    }
+}
+
+int bench_jobs(int argc, char** argv) {
+    long count = bench_arg_int(argc, argv, "--objects", 200000);
+    int frames = bench_arg_int(argc, argv, "--frames", 20);
+    int max_workers = bench_arg_int(argc, argv, "--workers", (int)sysconf(_SC_NPROCESSORS_ONLN));
+    long grain = bench_arg_int(argc, argv, "--grain", 1024);
+    int flags = bench_arg_flag(argc, argv, "--submit-only") ? JOB_SUBMIT_ONLY : 0;
+    max_workers = max_workers < 1 ? 1 : max_workers > JOB_MAX_WORKERS ? JOB_MAX_WORKERS : max_workers;
+    grain = grain < 1 ? 1 : grain;
+
+    World world;
+    memset(&world, 0, sizeof(world));
+    world.count = count;
+    world.grain = grain;
+    world.positions = (Vec3*)malloc(count * sizeof(Vec3));
+    world.velocities = (Vec3*)malloc(count * sizeof(Vec3));
+    world.rotations = (Quat*)malloc(count * sizeof(Quat));
+    world.models = (Mat4*)malloc(count * sizeof(Mat4));
+    world.visible = (unsigned int*)malloc(count * sizeof(unsigned int));
+    world.spin = quat_from_axis_angle((Vec3){ 0.3f, 1.0f, 0.1f }, 0.02f);
+    for (long i = 0; i < count; i++) {
+        cull_spheres_push(&world.bounds, (Vec3){ 0.0f, 0.0f, 0.0f }, 1.7f);
+    }
+
+    Mat4 projection = mat4_perspective(1.2f, 16.0f / 9.0f, 0.1f, 300.0f);
+    Mat4 view = mat4_look_at((Vec3){ 0.0f, 0.0f, 150.0f }, (Vec3){ 0.0f, 0.0f, 0.0f }, (Vec3){ 0.0f, 1.0f, 0.0f });
+    Mat4 view_projection = mat4_mul(&projection, &view);
+    frustum_from_matrix(&world.frustum, &view_projection);
+
+    long chunk_count = (count + grain - 1) / grain;
+    if (chunk_count > JOB_POOL_SIZE / 2) {
+        fprintf(stderr, "jobs: %ld chunks, raise --grain to stay under %d\n", chunk_count, JOB_POOL_SIZE / 2);
+        return -1;
+    }
+    Chunk* chunks = (Chunk*)malloc(chunk_count * sizeof(Chunk));
+    for (long c = 0; c < chunk_count; c++) {
+        chunks[c] = (Chunk){ &world, c };
+    }
+    world.chunk_visible = (long*)calloc(chunk_count, sizeof(long));
+    double* times = (double*)malloc(frames * sizeof(double));
+
+    printf("jobs: %ld objects, %ld jobs per phase, %d frames%s\n", count, chunk_count, frames,
+           flags ? ", submit only" : "");
+    double single = 0.0;
+    for (int workers = 1; workers <= max_workers; workers++) {
+        JobSystem system;
+        if (job_system_init(&system, workers, flags) != 0) {
+            break;
+        }
+        reset_world(&world);
+        job_system_reset_stats(&system);
+
+        long visible = 0;
+        for (int f = 0; f < frames; f++) {
+            double start = bench_now_ms();
+            visible = run_frame(&system, &world, chunks, chunk_count);
+            times[f] = bench_now_ms() - start;
+        }
+
+        BenchStats stats = bench_stats(times, frames);
+        if (workers == 1) {
+            single = stats.median;
+        }
+        printf("  %2d workers  frame median %8.3f ms  speedup %5.2fx  visible %ld\n",
+               workers, stats.median, single / stats.median, visible);
+        printf("             utilization");
+        for (int w = 0; w < workers; w++) {
+            JobWorkerStats worker = job_worker_stats(&system, w);
+            printf(" %3.0f%%", worker.utilization * 100.0);
+        }
+        printf("  steals");
+        for (int w = 0; w < workers; w++) {
+            printf(" %lu", job_worker_stats(&system, w).steals);
+        }
+        printf("\n");
+        job_system_shutdown(&system);
+    }
+
+    free(times);
+    free(chunks);
+    free(world.chunk_visible);
+    free(world.positions);
+    free(world.velocities);
+    free(world.rotations);
+    free(world.models);
+    free(world.visible);
+    cull_spheres_free(&world.bounds);
+    return 0;
+}
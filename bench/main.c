@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "gl_intercept.h"
+#include "gl_capture.h"
+#include "gl_debug.h"
+
+/*
+    gsl_bench <scenario> [options]
+
+    Runs one benchmark scenario headless and prints its statistics. With no
+    scenario the frame benchmark runs, which is the regression baseline for
+    the renderer.
+
+    Every scenario also takes --gl-stats: the GL calls it made are counted
+    and timed (see gl_intercept.h, needs -DGSL_GL_INTERCEPT=ON) and the most
+    expensive ones printed at the end. --capture FILE records the GL calls
+    of the scenario (gl_capture.h, same build option) for gsl_replay. Both
+    split the run at bench_end_frame; a scenario that never calls it is
+    one frame.
+    --gl-debug runs it on a debug context and summarizes the driver's
+    messages (gl_debug.h).
+*/
+
+typedef struct {
+    const char* name;
+    int (*run)(int argc, char** argv);
+    const char* help;
+} BenchScenario;
+
+static const BenchScenario scenarios[] = {
+    { "frame", bench_frame, "render the main scene offscreen [--frames N --width W --height H]" },
+    { "uniforms", bench_uniforms, "string vs handle uniform setters [--sets N]" },
+    { "shaders", bench_shaders, "sequential vs async program creation [--programs N]" },
+    { "reload", bench_reload, "shader hot reload latency [--rounds N]" },
+    { "batch", bench_batch, "one draw per shape vs batch renderer [--triangles N --frames N]" },
+    { "stream", bench_stream, "glBufferData vs streaming ring buffer [--mb N --frames N]" },
+    { "instancing", bench_instancing, "draw loop vs instanced figure [--instances N --naive N --frames N]" },
+    { "mesh", bench_mesh, "ACMR/ATVR before and after mesh_optimize [--frames N]" },
+    { "vertex_format", bench_vertex_format, "size, pack, upload and draw per vertex layout [--vertices N --frames N]" },
+    { "indirect", bench_indirect, "direct draw loop vs multi-draw indirect [--draws N --frames N]" },
+    { "math", bench_math, "matrices/second of the vecmath kernels per ISA level [--count N --rounds N]" },
+    { "cull", bench_cull, "frustum culling throughput per ISA level and thread count [--objects N --rounds N --threads N]" },
+    { "jobs", bench_jobs, "job system scaling on a per-object update + cull [--objects N --frames N --workers N --grain N]" },
+    { "commands", bench_commands, "GL thread issuing every draw vs worker-recorded command buffers [--draws N --frames N --workers N]" },
+    { "input", bench_input, "input-to-frame latency, polling on the GL thread vs an event thread [--frames N --rate N --interval MS --event-cost US]" },
+    { "pacing", bench_pacing, "frame time and jitter under several frame pacing specs [--frames N --draws N --spec SPEC]" },
+    { "textures", bench_textures, "texture load throughput, GL thread decode vs workers + PBO uploads [--dir DIR | --count N --size N] [--workers N]" },
+};
+
+static void print_usage(const char* program) {
+    printf("Usage: %s <scenario> [options]\n", program);
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        printf("  %-14s %s\n", scenarios[i].name, scenarios[i].help);
+    }
+    printf("every scenario: --gl-stats to count and time its GL calls, --capture FILE to record them for gsl_replay\n");
+    printf("                (both need a build with -DGSL_GL_INTERCEPT=ON), --gl-debug to summarize driver messages\n");
+}
+
+int main(int argc, char** argv) {
+    const char* name = argc > 1 ? argv[1] : "frame";
+
+    if (strcmp(name, "--help") == 0 || strcmp(name, "-h") == 0) {
+        print_usage(argv[0]);
+        return 0;
+    }
+
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        if (strcmp(name, scenarios[i].name) == 0) {
+            int status = scenarios[i].run(argc - 1, argv + 1);
+            // without a frame loop the whole run is one frame
+            if (gl_intercept_installed() && gl_intercept_frame_stats().frames == 0) {
+                bench_end_frame();
+            }
+            gl_capture_stop();
+            if (bench_arg_flag(argc, argv, "--gl-stats")) {
+                gl_intercept_report(25);
+            }
+            if (bench_arg_flag(argc, argv, "--gl-debug")) {
+                gl_debug_report();
+            }
+            return status == 0 ? 0 : 1;
+        }
+    }
+
+    fprintf(stderr, "unknown scenario: %s\n", name);
+    print_usage(argv[0]);
+    return 1;
+}
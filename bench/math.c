@@ -0,0 +1,108 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "vecmath.h"
+
+/*
+    Throughput of the vecmath batch kernels at every ISA level this CPU
+    runs, on N random transforms (1M by default):
+      trs       - mat4_from_trs_batch
+      mul       - mat4_mul_batch (view-projection * model)
+      transform - mat4_transform_points_batch
+    Results are compared with the scalar kernels, "max diff" is the largest
+    absolute difference over every float.
+*/
+
+static float random_range(float low, float high) {
+    return low + (rand() / (float)RAND_MAX) * (high - low);
+}
+
+static float max_diff(const float* a, const float* b, long count) {
+    float diff = 0.0f;
+    for (long i = 0; i < count; i++) {
+        float d = fabsf(a[i] - b[i]);
+        diff = d > diff ? d : diff;
+    }
+    return diff;
+}
+
+int bench_math(int argc, char** argv) {
+    long count = bench_arg_int(argc, argv, "--count", 1000000);
+    int rounds = bench_arg_int(argc, argv, "--rounds", 10);
+
+    Vec3* translations = (Vec3*)malloc(count * sizeof(Vec3));
+    Quat* rotations = (Quat*)malloc(count * sizeof(Quat));
+    Vec3* scales = (Vec3*)malloc(count * sizeof(Vec3));
+    Mat4* models = (Mat4*)malloc(count * sizeof(Mat4));
+    Mat4* products = (Mat4*)malloc(count * sizeof(Mat4));
+    Mat4* results = (Mat4*)malloc(count * sizeof(Mat4));
+    Vec4* reference_points = (Vec4*)malloc(count * sizeof(Vec4));
+    Vec4* points = (Vec4*)malloc(count * sizeof(Vec4));
+    double* times = (double*)malloc(rounds * sizeof(double));
+
+    srand(21);
+    for (long i = 0; i < count; i++) {
+        translations[i] = (Vec3){ random_range(-50.0f, 50.0f), random_range(-50.0f, 50.0f), random_range(-50.0f, 50.0f) };
+        Vec3 axis = { random_range(-1.0f, 1.0f), random_range(-1.0f, 1.0f), random_range(-1.0f, 1.0f) + 0.01f };
+        rotations[i] = quat_from_axis_angle(axis, random_range(0.0f, 6.28f));
+        float s = random_range(0.5f, 2.0f);
+        scales[i] = (Vec3){ s, s, s };
+    }
+    Mat4 projection = mat4_perspective(1.0f, 16.0f / 9.0f, 0.1f, 200.0f);
+    Mat4 view = mat4_look_at((Vec3){ 0.0f, 20.0f, 80.0f }, (Vec3){ 0.0f, 0.0f, 0.0f }, (Vec3){ 0.0f, 1.0f, 0.0f });
+    Mat4 view_projection = mat4_mul(&projection, &view);
+
+    // scalar results every level is compared with
+    vecmath_set_isa(VECMATH_SCALAR);
+    mat4_from_trs_batch(translations, rotations, scales, models, count);
+    mat4_mul_batch(&view_projection, models, products, count);
+    mat4_transform_points_batch(&view_projection, translations, reference_points, count);
+
+    printf("math: %ld transforms, %d rounds, best ISA %s\n", count, rounds, vecmath_isa_name(vecmath_isa_supported()));
+    printf("  %-8s %-10s %12s %10s\n", "isa", "kernel", "M/s", "max diff");
+
+    for (int level = VECMATH_SCALAR; level <= (int)vecmath_isa_supported(); level++) {
+        VecmathIsa isa = vecmath_set_isa((VecmathIsa)level);
+        const char* name = vecmath_isa_name(isa);
+
+        // -- TRS -- //
+        for (int r = 0; r < rounds; r++) {
+            double start = bench_now_ms();
+            mat4_from_trs_batch(translations, rotations, scales, results, count);
+            times[r] = bench_now_ms() - start;
+        }
+        printf("  %-8s %-10s %12.1f %10.2g\n", name, "trs", count / bench_stats(times, rounds).median / 1000.0,
+               max_diff(results[0].m, models[0].m, count * 16));
+
+        // -- View-projection * model -- //
+        for (int r = 0; r < rounds; r++) {
+            double start = bench_now_ms();
+            mat4_mul_batch(&view_projection, models, results, count);
+            times[r] = bench_now_ms() - start;
+        }
+        printf("  %-8s %-10s %12.1f %10.2g\n", name, "mul", count / bench_stats(times, rounds).median / 1000.0,
+               max_diff(results[0].m, products[0].m, count * 16));
+
+        // -- Points -- //
+        for (int r = 0; r < rounds; r++) {
+            double start = bench_now_ms();
+            mat4_transform_points_batch(&view_projection, translations, points, count);
+            times[r] = bench_now_ms() - start;
+        }
+        printf("  %-8s %-10s %12.1f %10.2g\n", name, "transform", count / bench_stats(times, rounds).median / 1000.0,
+               max_diff(&points[0].x, &reference_points[0].x, count * 4));
+    }
+    vecmath_set_isa(vecmath_isa_supported());
+
+    free(translations);
+    free(rotations);
+    free(scales);
+    free(models);
+    free(products);
+    free(results);
+    free(points);
+    free(reference_points);
+    free(times);
+    return 0;
+}
@@ -0,0 +1,208 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "glad/glad.h"
+#include "figure.h"
+#include "mesh_optimize.h"
+#include "shader.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+/*
+    Generates a few test meshes, scrambles their triangle and vertex order
+    (what an exporter that does not care gives us) and reports ACMR/ATVR for
+    a 16 and 32 entry FIFO cache before and after mesh_optimize, together
+    with the index type figure_init picks and the draw time.
+*/
+
+typedef struct {
+    const char* name;
+    float* vertices;
+    unsigned int* indices;
+    int vertex_count;
+    int index_count;
+} TestMesh;
+
+static void set_vertex(float* v, float x, float y, float z) {
+    v[0] = x;
+    v[1] = y;
+    v[2] = z;
+    v[3] = x * 0.5f + 0.5f;
+    v[4] = y * 0.5f + 0.5f;
+    v[5] = z * 0.5f + 0.5f;
+}
+
+static TestMesh make_grid(const char* name, int size) {
+    TestMesh mesh = { name, NULL, NULL, (size + 1) * (size + 1), size * size * 6 };
+    mesh.vertices = (float*)malloc(mesh.vertex_count * FIGURE_VERTEX_FLOATS * sizeof(float));
+    mesh.indices = (unsigned int*)malloc(mesh.index_count * sizeof(unsigned int));
+
+    for (int y = 0; y <= size; y++) {
+        for (int x = 0; x <= size; x++) {
+            set_vertex(mesh.vertices + (y * (size + 1) + x) * FIGURE_VERTEX_FLOATS,
+                       x / (float)size * 1.8f - 0.9f, y / (float)size * 1.8f - 0.9f, 0.0f);
+        }
+    }
+    int i = 0;
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            unsigned int a = y * (size + 1) + x;
+            unsigned int b = a + 1;
+            unsigned int c = a + size + 1;
+            unsigned int d = c + 1;
+            unsigned int quad[6] = { a, b, c, b, d, c };
+            memcpy(mesh.indices + i, quad, sizeof(quad));
+            i += 6;
+        }
+    }
+    return mesh;
+}
+
+static TestMesh make_sphere(const char* name, int rings, int segments) {
+    TestMesh mesh = { name, NULL, NULL, (rings + 1) * (segments + 1), rings * segments * 6 };
+    mesh.vertices = (float*)malloc(mesh.vertex_count * FIGURE_VERTEX_FLOATS * sizeof(float));
+    mesh.indices = (unsigned int*)malloc(mesh.index_count * sizeof(unsigned int));
+
+    for (int r = 0; r <= rings; r++) {
+        float phi = (float)M_PI * r / rings;
+        for (int s = 0; s <= segments; s++) {
+            float theta = 2.0f * (float)M_PI * s / segments;
+            set_vertex(mesh.vertices + (r * (segments + 1) + s) * FIGURE_VERTEX_FLOATS,
+                       0.9f * sinf(phi) * cosf(theta), 0.9f * cosf(phi), 0.9f * sinf(phi) * sinf(theta));
+        }
+    }
+    int i = 0;
+    for (int r = 0; r < rings; r++) {
+        for (int s = 0; s < segments; s++) {
+            unsigned int a = r * (segments + 1) + s;
+            unsigned int b = a + 1;
+            unsigned int c = a + segments + 1;
+            unsigned int d = c + 1;
+            unsigned int quad[6] = { a, c, b, b, c, d };
+            memcpy(mesh.indices + i, quad, sizeof(quad));
+            i += 6;
+        }
+    }
+    return mesh;
+}
+
+// shuffles triangle order and vertex numbering
+static void scramble(TestMesh* mesh) {
+    int triangles = mesh->index_count / 3;
+    for (int t = triangles - 1; t > 0; t--) {
+        int j = rand() % (t + 1);
+        for (int c = 0; c < 3; c++) {
+            unsigned int swap = mesh->indices[t * 3 + c];
+            mesh->indices[t * 3 + c] = mesh->indices[j * 3 + c];
+            mesh->indices[j * 3 + c] = swap;
+        }
+    }
+
+    unsigned int* permutation = (unsigned int*)malloc(mesh->vertex_count * sizeof(unsigned int));
+    for (int v = 0; v < mesh->vertex_count; v++) {
+        permutation[v] = v;
+    }
+    for (int v = mesh->vertex_count - 1; v > 0; v--) {
+        int j = rand() % (v + 1);
+        unsigned int swap = permutation[v];
+        permutation[v] = permutation[j];
+        permutation[j] = swap;
+    }
+
+    size_t stride = FIGURE_VERTEX_FLOATS * sizeof(float);
+    float* moved = (float*)malloc(mesh->vertex_count * stride);
+    for (int v = 0; v < mesh->vertex_count; v++) {
+        memcpy(moved + permutation[v] * FIGURE_VERTEX_FLOATS, mesh->vertices + v * FIGURE_VERTEX_FLOATS, stride);
+    }
+    for (int i = 0; i < mesh->index_count; i++) {
+        mesh->indices[i] = permutation[mesh->indices[i]];
+    }
+    memcpy(mesh->vertices, moved, mesh->vertex_count * stride);
+    free(moved);
+    free(permutation);
+}
+
+static double draw_time(TestMesh* mesh, int frames, unsigned int* index_type) {
+    Figure figure;
+    figure_init(&figure, mesh->vertices, mesh->vertex_count, mesh->indices, mesh->index_count);
+    *index_type = figure.index_type;
+
+    double* times = (double*)malloc(frames * sizeof(double));
+    for (int f = 0; f < frames; f++) {
+        double start = bench_now_ms();
+        glClear(GL_COLOR_BUFFER_BIT);
+        figure_draw(&figure);
+        glFinish();
+        times[f] = bench_now_ms() - start;
+        bench_end_frame();
+    }
+    double median = bench_stats(times, frames).median;
+    free(times);
+    figure_destroy(&figure);
+    return median;
+}
+
+static void report(TestMesh* mesh, int frames) {
+    MeshCacheStats before16 = mesh_analyze_vertex_cache(mesh->indices, mesh->index_count, mesh->vertex_count, 16);
+    MeshCacheStats before32 = mesh_analyze_vertex_cache(mesh->indices, mesh->index_count, mesh->vertex_count, 32);
+    unsigned int index_type;
+    double before_ms = draw_time(mesh, frames, &index_type);
+
+    double start = bench_now_ms();
+    int vertex_count = mesh_optimize(mesh->vertices, FIGURE_VERTEX_FLOATS, mesh->vertex_count,
+                                     mesh->indices, mesh->index_count);
+    double optimize_ms = bench_now_ms() - start;
+    if (vertex_count < 0) {
+        printf("  %-8s mesh_optimize failed\n", mesh->name);
+        return;
+    }
+    mesh->vertex_count = vertex_count;
+
+    MeshCacheStats after16 = mesh_analyze_vertex_cache(mesh->indices, mesh->index_count, mesh->vertex_count, 16);
+    MeshCacheStats after32 = mesh_analyze_vertex_cache(mesh->indices, mesh->index_count, mesh->vertex_count, 32);
+    double after_ms = draw_time(mesh, frames, &index_type);
+
+    printf("  %-8s %7d verts %8d tris  %s indices  optimize %7.2f ms\n", mesh->name, mesh->vertex_count,
+           mesh->index_count / 3, index_type == GL_UNSIGNED_SHORT ? "16-bit" : "32-bit", optimize_ms);
+    printf("           ACMR(16) %.3f -> %.3f  ATVR(16) %.3f -> %.3f\n", before16.acmr, after16.acmr, before16.atvr, after16.atvr);
+    printf("           ACMR(32) %.3f -> %.3f  ATVR(32) %.3f -> %.3f\n", before32.acmr, after32.acmr, before32.atvr, after32.atvr);
+    printf("           draw %.3f -> %.3f ms\n", before_ms, after_ms);
+}
+
+int bench_mesh(int argc, char** argv) {
+    int frames = bench_arg_int(argc, argv, "--frames", 20);
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+    Shader shader = create_shader(GSL_SHADER_DIR "/model.vs", GSL_SHADER_DIR "/model.fs");
+    if (!shader.ID) {
+        headless_destroy(&headless);
+        return -1;
+    }
+    shader_use(&shader);
+
+    TestMesh meshes[] = {
+        make_grid("grid", 100),
+        make_sphere("sphere", 96, 192),
+        make_grid("grid-big", 400),
+    };
+
+    srand(1234);
+    printf("mesh: scrambled input vs mesh_optimize\n");
+    for (size_t i = 0; i < sizeof(meshes) / sizeof(meshes[0]); i++) {
+        scramble(&meshes[i]);
+        report(&meshes[i], frames);
+        free(meshes[i].vertices);
+        free(meshes[i].indices);
+    }
+
+    shader_destroy(&shader);
+    headless_destroy(&headless);
+    return 0;
+}
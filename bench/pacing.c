@@ -0,0 +1,92 @@
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+#include "glad/glad.h"
+#include "cull.h"
+#include "frame_pacing.h"
+#include "gl_state.h"
+#include "scene.h"
+
+/*
+    The scene (drawn --draws times per frame to give the GPU some work)
+    under several frame pacing specs, or only the one given with --spec.
+    Prints the pacer statistics for each: mean frame time, jitter, time
+    spent in the limiter and waiting for the GPU. There is no swap, so vsync
+    behaves like uncapped here, and without fences nothing flushes the
+    queue, so "inflight=0" only measures how fast commands are queued.
+*/
+
+static const char* default_specs[] = {
+    "uncapped,inflight=0",
+    "uncapped,inflight=1",
+    "uncapped,inflight=3",
+    "cap=120,inflight=2,spin=0",
+    "cap=120,inflight=2",
+};
+
+static void run(const char* spec, Scene* scene, const Frustum* frustum, int frames, int draws) {
+    FramePacingConfig config = frame_pacing_default();
+    if (frame_pacing_parse(&config, spec) != 0) {
+        return;
+    }
+    FramePacer pacer;
+    frame_pacer_init(&pacer, &config);
+
+    for (int f = 0; f < frames; f++) {
+        frame_pacer_begin(&pacer);
+        for (int d = 0; d < draws; d++) {
+            scene_cull(scene, frustum);
+            scene_draw(scene);
+        }
+        frame_pacer_end(&pacer);
+        bench_end_frame();
+    }
+    glFinish();
+
+    FramePacingStats stats = frame_pacer_stats(&pacer);
+    printf("  %-28s mean %7.3f  jitter %6.3f  p99 %7.3f  max %7.3f  limiter %6.3f  gpu wait %6.3f ms\n",
+           spec, stats.mean_ms, stats.jitter_ms, stats.p99_ms, stats.max_ms, stats.limiter_ms, stats.fence_ms);
+    frame_pacer_destroy(&pacer);
+}
+
+int bench_pacing(int argc, char** argv) {
+    int frames = bench_arg_int(argc, argv, "--frames", 240);
+    int draws = bench_arg_int(argc, argv, "--draws", 5);
+    const char* spec = NULL;
+    for (int i = 0; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--spec") == 0) {
+            spec = argv[i + 1];
+        }
+    }
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+
+    gl_state_set_blend(1);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    Scene scene;
+    if (scene_init(&scene) != 0) {
+        headless_destroy(&headless);
+        return -1;
+    }
+
+    Mat4 view_projection = mat4_identity();
+    Frustum frustum;
+    frustum_from_matrix(&frustum, &view_projection);
+
+    printf("pacing: %d frames, %d scene draws per frame\n", frames, draws);
+    if (spec) {
+        run(spec, &scene, &frustum, frames, draws);
+    } else {
+        for (size_t i = 0; i < sizeof(default_specs) / sizeof(default_specs[0]); i++) {
+            run(default_specs[i], &scene, &frustum, frames, draws);
+        }
+    }
+
+    scene_destroy(&scene);
+    headless_destroy(&headless);
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "glad/glad.h"
+#include "shader_reload.h"
+#include "file.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+/*
+    Copies the model shaders into a temporary directory, watches them and
+    rewrites the fragment shader N times, running frames (update, a draw with
+    the watched program, finish) until the new program has been drawn.
+    Reports the latency from the write to the end of that frame. The last
+    round writes a broken shader, which must leave the previous program in
+    place.
+*/
+
+static int write_file(const char* path, const char* data, size_t size) {
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return -1;
+    }
+    int ok = fwrite(data, 1, size, file) == size;
+    return (fclose(file) == 0 && ok) ? 0 : -1;
+}
+
+static int write_variant(const char* path, const FileView* source, int variant) {
+    const char* body = memchr(source->data, '\n', source->size);
+    body = body ? body + 1 : source->data;
+    size_t version_length = body - source->data;
+
+    size_t size = source->size + 64;
+    char* text = (char*)malloc(size);
+    int length = snprintf(text, size, "%.*s#define GSL_VARIANT %d\n%.*s",
+                          (int)version_length, source->data, variant,
+                          (int)(source->size - version_length), body);
+    int result = write_file(path, text, (size_t)length);
+    free(text);
+    return result;
+}
+
+// returns the latency in ms, or -1 if no new program reached a frame within the timeout
+static double wait_for_swap(ShaderWatcher* watcher, const Shader* shader, double timeout_ms) {
+    double start = bench_now_ms();
+    while (bench_now_ms() - start < timeout_ms) {
+        shader_watcher_update(watcher);
+        glUseProgram(shader->ID);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glFinish();
+        if (shader_watcher_frame_end(watcher) > 0) {
+            return watcher->last_latency_ms;
+        }
+        usleep(100);
+    }
+    return -1.0;
+}
+
+int bench_reload(int argc, char** argv) {
+    int rounds = bench_arg_int(argc, argv, "--rounds", 20);
+
+    // every round is a real compile
+    setenv("GSL_SHADER_CACHE_DIR", "", 1);
+    setenv("MESA_SHADER_CACHE_DISABLE", "true", 1);
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+
+    char dir[] = "/tmp/gsl_reload_XXXXXX";
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        headless_destroy(&headless);
+        return -1;
+    }
+    char vertex_path[256], fragment_path[256];
+    snprintf(vertex_path, sizeof(vertex_path), "%s/model.vs", dir);
+    snprintf(fragment_path, sizeof(fragment_path), "%s/model.fs", dir);
+
+    FileView vertex, fragment;
+    if (file_load(GSL_SHADER_DIR "/model.vs", &vertex) != 0 || file_load(GSL_SHADER_DIR "/model.fs", &fragment) != 0) {
+        perror(GSL_SHADER_DIR);
+        headless_destroy(&headless);
+        return -1;
+    }
+    write_file(vertex_path, vertex.data, vertex.size);
+    write_file(fragment_path, fragment.data, fragment.size);
+
+    Shader shader = create_shader(vertex_path, fragment_path);
+    ShaderWatcher watcher;
+    if (shader_watcher_start(&watcher) != 0 || shader_watch(&watcher, &shader, vertex_path, fragment_path) != 0) {
+        shader_destroy(&shader);
+        headless_destroy(&headless);
+        return -1;
+    }
+
+    // attributes come from the defaults, the draw only has to use the program
+    unsigned int vao;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    double* latencies = (double*)malloc(rounds * sizeof(double));
+    int reloaded = 0;
+    for (int i = 0; i < rounds; i++) {
+        write_variant(fragment_path, &fragment, i);
+        double latency = wait_for_swap(&watcher, &shader, 2000.0);
+        if (latency >= 0.0) {
+            latencies[reloaded++] = latency;
+        }
+        bench_end_frame();
+    }
+
+    // a shader that does not compile keeps the current program
+    unsigned int before = shader.ID;
+    const char broken[] = "#version 330 core\nvoid main() { this does not compile }\n";
+    write_file(fragment_path, broken, sizeof(broken) - 1);
+    int swapped = wait_for_swap(&watcher, &shader, 500.0) >= 0.0;
+
+    printf("reload: %d/%d rounds swapped, broken shader %s\n", reloaded, rounds,
+           (!swapped && shader.ID == before) ? "kept the old program" : "WAS SWAPPED IN");
+    bench_print_stats("latency", bench_stats(latencies, reloaded));
+
+    shader_watcher_stop(&watcher);
+    glDeleteVertexArrays(1, &vao);
+    shader_destroy(&shader);
+    free(latencies);
+    file_release(&vertex);
+    file_release(&fragment);
+    unlink(vertex_path);
+    unlink(fragment_path);
+    rmdir(dir);
+    headless_destroy(&headless);
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "glad/glad.h"
+#include "gl_replay.h"
+#include "gl_intercept.h"
+
+/*
+    gsl_replay <capture> [--loops N] [--finish] [--gl-stats]
+
+    Plays back a GL capture (gsl --capture FILE, gsl_bench <scenario>
+    --capture FILE, see gl_capture.h) headless at the size it was recorded
+    at, so a frame can be benchmarked without the program that made it:
+    no scene setup, no culling, no input, the same calls every run.
+
+    The setup (and first frame) runs once, then the remaining frames are
+    replayed --loops times. The CPU time to issue each frame is reported;
+    --finish waits for the GPU after every frame so the time covers both.
+    The checksum of the final image makes it easy to see that two builds
+    or two drivers rendered the same thing.
+*/
+
+static unsigned int image_checksum(int width, int height) {
+    unsigned char* pixels = (unsigned char*)malloc((size_t)width * height * 4);
+    if (!pixels) {
+        return 0;
+    }
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    // FNV-1a
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < (size_t)width * height * 4; i++) {
+        hash = (hash ^ pixels[i]) * 16777619u;
+    }
+    free(pixels);
+    return hash;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argv[1][0] == '-') {
+        printf("Usage: %s <capture> [--loops N] [--finish] [--gl-stats]\n", argv[0]);
+        return 1;
+    }
+    int loops = bench_arg_int(argc, argv, "--loops", 10);
+    int finish = bench_arg_flag(argc, argv, "--finish");
+
+    GlReplay replay;
+    if (gl_replay_open(&replay, argv[1]) != 0) {
+        return 1;
+    }
+
+    Headless headless;
+    if (headless_create(&headless, replay.width, replay.height) != 0) {
+        gl_replay_close(&replay);
+        return 1;
+    }
+    printf("renderer: %s | %s\n", (const char*)glGetString(GL_RENDERER), (const char*)glGetString(GL_VERSION));
+    if (bench_arg_flag(argc, argv, "--gl-stats") && gl_intercept_install() != 0) {
+        headless_destroy(&headless);
+        gl_replay_close(&replay);
+        return 1;
+    }
+
+    double start = bench_now_ms();
+    int status = gl_replay_frame(&replay);
+    glFinish();
+    double setup_ms = bench_now_ms() - start;
+    unsigned long setup_calls = replay.calls;
+    printf("replay: %s, %dx%d, %d frames, %.2f MB\n", argv[1], replay.width, replay.height,
+           replay.frame_count, replay.file.size / (1024.0 * 1024.0));
+    printf("  setup + first frame: %lu calls, %.2f ms\n", setup_calls, setup_ms);
+
+    // a capture that was cut short has no frame count, play it once to the end
+    int frames = replay.frame_count - 1;
+    if (!replay.frame_count) {
+        loops = 1;
+        frames = INT_MAX;
+    }
+    double* samples = NULL;
+    int count = 0, capacity = 0;
+    gl_intercept_reset();
+
+    for (int loop = 0; loop < loops && status == 1 && frames > 0; loop++) {
+        gl_replay_rewind(&replay);
+        for (int i = 0; i < frames; i++) {
+            double frame_start = bench_now_ms();
+            status = gl_replay_frame(&replay);
+            if (finish) {
+                glFinish();
+            }
+            if (status != 1) {
+                break;
+            }
+            if (count == capacity) {
+                capacity = capacity ? capacity * 2 : 1024;
+                double* grown = (double*)realloc(samples, capacity * sizeof(double));
+                if (!grown) {
+                    status = -1;
+                    break;
+                }
+                samples = grown;
+            }
+            samples[count++] = bench_now_ms() - frame_start;
+            gl_intercept_frame();
+        }
+    }
+    glFinish();
+
+    if (status < 0) {
+        printf("replay stopped after %lu calls\n", replay.calls);
+    } else if (count) {
+        printf("  %d frames (%d loops), %.1f calls per frame\n", count, loops,
+               (double)(replay.calls - setup_calls) / count);
+        bench_print_stats(finish ? "cpu+gpu" : "cpu", bench_stats(samples, count));
+    } else {
+        printf("  no frames to loop over\n");
+    }
+    printf("  checksum of the last frame: %08x\n", image_checksum(replay.width, replay.height));
+    if (bench_arg_flag(argc, argv, "--gl-stats")) {
+        gl_intercept_report(25);
+    }
+
+    free(samples);
+    headless_destroy(&headless);
+    gl_replay_close(&replay);
+    return status < 0 ? 1 : 0;
+}
@@ -0,0 +1,104 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "glad/glad.h"
+#include "shader.h"
+#include "file.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+/*
+    Creates N distinct programs (50 by default) from the model shaders, first
+    one after the other with create_shader, then all submitted with
+    shader_compile_async and waited on at the end. Every program gets its own
+    "#define GSL_VARIANT i" so neither our binary cache nor the driver's caches
+    can hand back an earlier result.
+*/
+
+// inserts the variant define right after the #version line
+static char* make_variant(const FileView* file, int variant, size_t* length) {
+    const char* end = file->data + file->size;
+    const char* body = memchr(file->data, '\n', file->size);
+    body = body ? body + 1 : file->data;
+
+    size_t size = file->size + 64;
+    char* out = (char*)malloc(size);
+    int written = snprintf(out, size, "%.*s#define GSL_VARIANT %d\n%.*s",
+                           (int)(body - file->data), file->data, variant, (int)(end - body), body);
+    *length = (size_t)written;
+    return out;
+}
+
+static double create_programs(const FileView* vertex, const FileView* fragment, int first, int count, int async) {
+    Shader* shaders = (Shader*)malloc(count * sizeof(Shader));
+    PendingShader* pending = (PendingShader*)malloc(count * sizeof(PendingShader));
+
+    double start = bench_now_ms();
+    for (int i = 0; i < count; i++) {
+        size_t vertex_length, fragment_length;
+        char* vertex_code = make_variant(vertex, first + i, &vertex_length);
+        char* fragment_code = make_variant(fragment, first + i, &fragment_length);
+        pending[i] = shader_compile_async(vertex_code, vertex_length, fragment_code, fragment_length);
+        if (!async) {
+            shaders[i] = shader_wait(&pending[i]);
+        }
+        free(vertex_code);
+        free(fragment_code);
+    }
+    if (async) {
+        for (int i = 0; i < count; i++) {
+            shaders[i] = shader_wait(&pending[i]);
+        }
+    }
+    double elapsed = bench_now_ms() - start;
+
+    for (int i = 0; i < count; i++) {
+        shader_destroy(&shaders[i]);
+    }
+    free(shaders);
+    free(pending);
+    return elapsed;
+}
+
+int bench_shaders(int argc, char** argv) {
+    int programs = bench_arg_int(argc, argv, "--programs", 50);
+
+    // measure real compiles, not cache lookups
+    setenv("GSL_SHADER_CACHE_DIR", "", 1);
+    setenv("MESA_SHADER_CACHE_DISABLE", "true", 1);
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+
+    FileView vertex, fragment;
+    if (file_load(GSL_SHADER_DIR "/model.vs", &vertex) != 0) {
+        perror(GSL_SHADER_DIR "/model.vs");
+        headless_destroy(&headless);
+        return -1;
+    }
+    if (file_load(GSL_SHADER_DIR "/model.fs", &fragment) != 0) {
+        perror(GSL_SHADER_DIR "/model.fs");
+        file_release(&vertex);
+        headless_destroy(&headless);
+        return -1;
+    }
+
+    double sequential_ms = create_programs(&vertex, &fragment, 0, programs, 0);
+    double async_ms = create_programs(&vertex, &fragment, programs, programs, 1);
+
+    printf("shaders: %d programs, GL_KHR_parallel_shader_compile %s\n",
+           programs, GLAD_GL_KHR_parallel_shader_compile ? "yes" : "no");
+    printf("  sequential %9.2f ms  %7.3f ms/program\n", sequential_ms, sequential_ms / programs);
+    printf("  async      %9.2f ms  %7.3f ms/program  (%.2fx)\n",
+           async_ms, async_ms / programs, sequential_ms / async_ms);
+
+    file_release(&vertex);
+    file_release(&fragment);
+    headless_destroy(&headless);
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "glad/glad.h"
+#include "gl_state.h"
+#include "stream_buffer.h"
+#include "shader.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+/*
+    Rewrites a large vertex buffer every frame (16 MB by default) and draws
+    from it, comparing:
+      bufferdata - glBufferData with the new contents every frame
+      orphan     - StreamBuffer fallback (orphan + glMapBufferRange)
+      persistent - StreamBuffer with a persistent coherent mapping
+    Upload is the CPU time to get the data into GL, stall is the time spent
+    waiting for fences.
+*/
+
+#define VERTEX_SIZE (6 * sizeof(float))
+
+typedef enum { MODE_BUFFER_DATA, MODE_ORPHAN, MODE_PERSISTENT } StreamMode;
+
+static void setup_attributes(GLintptr base) {
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VERTEX_SIZE, (void*)base);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, VERTEX_SIZE, (void*)(base + 3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+}
+
+static int run_mode(StreamMode mode, const char* name, Shader* shader, const char* source, long bytes, int frames) {
+    double* upload = (double*)malloc(frames * sizeof(double));
+    double* stall = (double*)malloc(frames * sizeof(double));
+
+    unsigned int VAO;
+    glGenVertexArrays(1, &VAO);
+    gl_state_bind_vertex_array(VAO);
+
+    StreamBuffer stream;
+    unsigned int VBO = 0;
+    if (mode == MODE_BUFFER_DATA) {
+        glGenBuffers(1, &VBO);
+        gl_state_bind_buffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, bytes, NULL, GL_STREAM_DRAW);
+    } else if (stream_buffer_init(&stream, GL_ARRAY_BUFFER, bytes, mode == MODE_PERSISTENT) != 0) {
+        gl_state_delete_vertex_arrays(1, &VAO);
+        free(upload);
+        free(stall);
+        return -1;
+    }
+    setup_attributes(0);
+    shader_use(shader);
+
+    for (int f = 0; f < frames; f++) {
+        GLintptr offset = 0;
+        double start = bench_now_ms();
+        double stalled = 0.0;
+
+        if (mode == MODE_BUFFER_DATA) {
+            gl_state_bind_buffer(GL_ARRAY_BUFFER, VBO);
+            glBufferData(GL_ARRAY_BUFFER, bytes, source, GL_STREAM_DRAW);
+        } else {
+            double before = stream.stall_ms;
+            stream_buffer_begin(&stream);
+            stalled = stream.stall_ms - before;
+            void* data = stream_buffer_alloc(&stream, bytes, VERTEX_SIZE, &offset);
+            memcpy(data, source, bytes);
+            stream_buffer_commit(&stream);
+        }
+        upload[f] = bench_now_ms() - start - stalled;
+        stall[f] = stalled;
+
+        // read from this frame's data so the fences actually guard something
+        glClear(GL_COLOR_BUFFER_BIT);
+        glDrawArrays(GL_TRIANGLES, (GLint)(offset / VERTEX_SIZE), 3);
+        glFlush();
+        bench_end_frame();
+    }
+    glFinish();
+
+    BenchStats upload_stats = bench_stats(upload, frames);
+    printf("  %-10s %8.1f MB/s  ", name, (bytes / (1024.0 * 1024.0)) / (upload_stats.median / 1e3));
+    printf("upload median %7.3f ms  stall median %7.3f ms  p99 %7.3f ms\n",
+           upload_stats.median, bench_stats(stall, frames).median, bench_stats(stall, frames).p99);
+
+    if (mode == MODE_BUFFER_DATA) {
+        gl_state_delete_buffers(1, &VBO);
+    } else {
+        stream_buffer_destroy(&stream);
+    }
+    gl_state_delete_vertex_arrays(1, &VAO);
+    free(upload);
+    free(stall);
+    return 0;
+}
+
+int bench_stream(int argc, char** argv) {
+    long megabytes = bench_arg_int(argc, argv, "--mb", 16);
+    int frames = bench_arg_int(argc, argv, "--frames", 60);
+    long bytes = megabytes * 1024 * 1024;
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+
+    Shader shader = create_shader(GSL_SHADER_DIR "/model.vs", GSL_SHADER_DIR "/model.fs");
+    if (!shader.ID) {
+        headless_destroy(&headless);
+        return -1;
+    }
+
+    // the scene triangle repeated, so whatever gets drawn is valid
+    float* source = (float*)malloc(bytes);
+    float triangle[18] = {
+         0.5f, -0.5f, 0.0f,  1.0f, 0.0f, 0.0f,
+        -0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f,
+         0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f
+    };
+    for (long i = 0; i < bytes / (long)sizeof(float); i++) {
+        source[i] = triangle[i % 18];
+    }
+
+    printf("stream: %ld MB per frame, %d frames, GL 4.4 %s\n", megabytes, frames, GLAD_GL_VERSION_4_4 ? "yes" : "no");
+    run_mode(MODE_BUFFER_DATA, "bufferdata", &shader, (const char*)source, bytes, frames);
+    run_mode(MODE_ORPHAN, "orphan", &shader, (const char*)source, bytes, frames);
+    if (GLAD_GL_VERSION_4_4) {
+        run_mode(MODE_PERSISTENT, "persistent", &shader, (const char*)source, bytes, frames);
+    }
+
+    free(source);
+    shader_destroy(&shader);
+    headless_destroy(&headless);
+    return 0;
+}
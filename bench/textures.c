@@ -0,0 +1,277 @@
+#include "bench.h"
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "glad/glad.h"
+#include "jobs.h"
+#include "texture.h"
+#ifdef GSL_HAS_PNG
+#include <png.h>
+#endif
+
+/*
+    Texture load throughput for a directory of images (--dir DIR, every
+    .png in it). Without --dir, --count images of --size x --size pixels are
+    written to a temporary directory first (smooth gradients plus noise, so
+    they compress roughly like real textures).
+
+      sync   - the GL thread decodes each image and uploads it with
+               glTexImage2D + glGenerateMipmap, the way a loading screen does
+      async  - texture_loader: decode on --workers job workers (default one
+               per core) with the GL thread submit only, PBO uploads under
+               the per-frame budget, texture_loader_update once a frame
+
+    Both report textures/s, MB/s of files read and of pixels uploaded, and
+    the longest the GL thread was blocked in one go (one texture for sync,
+    one update for async). The first texture is read back from both to check
+    they hold the same pixels.
+*/
+
+typedef struct {
+    char** paths;
+    int count;
+} ImageList;
+
+static int compare_path(const void* a, const void* b) {
+    return strcmp(*(const char* const*)a, *(const char* const*)b);
+}
+
+static int list_images(const char* dir, ImageList* list) {
+    DIR* handle = opendir(dir);
+    if (!handle) {
+        fprintf(stderr, "cannot open %s\n", dir);
+        return -1;
+    }
+    int capacity = 0;
+    struct dirent* entry;
+    while ((entry = readdir(handle))) {
+        size_t length = strlen(entry->d_name);
+        if (length < 5 || strcmp(entry->d_name + length - 4, ".png") != 0) {
+            continue;
+        }
+        if (list->count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            list->paths = (char**)realloc(list->paths, capacity * sizeof(char*));
+        }
+        list->paths[list->count] = (char*)malloc(strlen(dir) + length + 2);
+        sprintf(list->paths[list->count++], "%s/%s", dir, entry->d_name);
+    }
+    closedir(handle);
+    qsort(list->paths, list->count, sizeof(char*), compare_path);
+    return 0;
+}
+
+static void free_images(ImageList* list) {
+    for (int i = 0; i < list->count; i++) {
+        free(list->paths[i]);
+    }
+    free(list->paths);
+}
+
+// writes count test images into a new directory, returns its path in dir
+static int generate_images(char* dir, int count, int size) {
+#ifdef GSL_HAS_PNG
+    unsigned char* pixels = (unsigned char*)malloc((size_t)size * size * 4);
+    if (!pixels || !mkdtemp(dir)) {
+        free(pixels);
+        return -1;
+    }
+    unsigned int random = 12345;
+    for (int i = 0; i < count; i++) {
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x < size; x++) {
+                random = random * 1664525u + 1013904223u;
+                unsigned char* p = pixels + ((size_t)y * size + x) * 4;
+                p[0] = (unsigned char)(x * 255 / size + (i * 37) + (random >> 29));
+                p[1] = (unsigned char)(y * 255 / size + (i * 11) + (random >> 28 & 3));
+                p[2] = (unsigned char)((x + y) * 127 / size + (random >> 30));
+                p[3] = 255;
+            }
+        }
+        png_image image;
+        memset(&image, 0, sizeof(image));
+        image.version = PNG_IMAGE_VERSION;
+        image.width = size;
+        image.height = size;
+        image.format = PNG_FORMAT_RGBA;
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%04d.png", dir, i);
+        if (!png_image_write_to_file(&image, path, 0, pixels, 0, NULL)) {
+            fprintf(stderr, "cannot write %s: %s\n", path, image.message);
+            free(pixels);
+            return -1;
+        }
+    }
+    free(pixels);
+    return 0;
+#else
+    (void)dir;
+    (void)count;
+    (void)size;
+    fprintf(stderr, "built without libpng, textures cannot be decoded\n");
+    return -1;
+#endif
+}
+
+static void remove_images(const char* dir, ImageList* list) {
+    for (int i = 0; i < list->count; i++) {
+        unlink(list->paths[i]);
+    }
+    rmdir(dir);
+}
+
+static unsigned int texture_checksum(GLuint texture) {
+    GLint width = 0, height = 0;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    unsigned char* pixels = (unsigned char*)malloc((size_t)width * height * 4 + 1);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < (size_t)width * height * 4; i++) {
+        hash = (hash ^ pixels[i]) * 16777619u;
+    }
+    free(pixels);
+    return hash;
+}
+
+static void print_throughput(const char* label, int textures, double total_ms, double file_mb, double pixel_mb, double max_block_ms) {
+    double seconds = total_ms / 1000.0;
+    printf("  %-6s %8.1f ms  %8.1f textures/s  %8.1f MB/s files  %8.1f MB/s pixels  longest GL block %7.2f ms\n",
+           label, total_ms, textures / seconds, file_mb / seconds, pixel_mb / seconds, max_block_ms);
+}
+
+// -- Sync -- //
+static unsigned int run_sync(const ImageList* list) {
+    GLuint* textures = (GLuint*)calloc(list->count, sizeof(GLuint));
+    double file_mb = 0.0, pixel_mb = 0.0, max_block = 0.0;
+    int loaded = 0;
+
+    double start = bench_now_ms();
+    for (int i = 0; i < list->count; i++) {
+        double texture_start = bench_now_ms();
+        int width, height;
+        size_t file_bytes = 0;
+        unsigned char* pixels = texture_decode_png(list->paths[i], &width, &height, &file_bytes);
+        if (!pixels) {
+            continue;
+        }
+        glGenTextures(1, &textures[i]);
+        glBindTexture(GL_TEXTURE_2D, textures[i]);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        free(pixels);
+
+        file_mb += file_bytes / (1024.0 * 1024.0);
+        pixel_mb += (double)width * height * 4 / (1024.0 * 1024.0);
+        loaded++;
+        double block = bench_now_ms() - texture_start;
+        max_block = block > max_block ? block : max_block;
+        bench_end_frame(); // one texture per frame, as on a loading screen
+    }
+    glFinish();
+    print_throughput("sync", loaded, bench_now_ms() - start, file_mb, pixel_mb, max_block);
+
+    unsigned int checksum = textures[0] ? texture_checksum(textures[0]) : 0;
+    glDeleteTextures(list->count, textures);
+    free(textures);
+    return checksum;
+}
+
+// -- Async -- //
+static unsigned int run_async(const ImageList* list, int workers) {
+    JobSystem jobs;
+    if (job_system_init(&jobs, workers, JOB_SUBMIT_ONLY) != 0) {
+        return 0;
+    }
+    TextureLoader loader;
+    if (texture_loader_init(&loader, &jobs, list->count, 0, 0) != 0) {
+        job_system_shutdown(&jobs);
+        return 0;
+    }
+
+    double start = bench_now_ms();
+    TextureHandle first = -1;
+    for (int i = 0; i < list->count; i++) {
+        TextureHandle handle = texture_load(&loader, list->paths[i]);
+        first = i == 0 ? handle : first;
+    }
+    // one update per frame; the rest of the frame goes to the workers
+    int frames = 0;
+    while (!texture_loader_idle(&loader)) {
+        texture_loader_update(&loader);
+        glFlush();
+        bench_end_frame();
+        frames++;
+        if (!texture_loader_idle(&loader)) {
+            usleep(1000);
+        }
+    }
+    glFinish();
+    double total_ms = bench_now_ms() - start;
+
+    TextureLoaderStats stats = texture_loader_stats(&loader);
+    print_throughput("async", (int)stats.ready, total_ms, stats.file_bytes / (1024.0 * 1024.0),
+                     stats.pixel_bytes / (1024.0 * 1024.0), stats.max_update_ms);
+    printf("         %d workers, %d frames, %.2f ms decoding per texture, %.2f ms GL thread per frame, %lu failed\n",
+           jobs.worker_count, frames, stats.ready ? stats.decode_ms / stats.ready : 0.0,
+           frames ? stats.upload_ms / frames : 0.0, stats.failed);
+
+    unsigned int checksum = texture_state(&loader, first) == TEXTURE_READY ? texture_checksum(texture_get(&loader, first)) : 0;
+    texture_loader_destroy(&loader);
+    job_system_shutdown(&jobs);
+    return checksum;
+}
+
+int bench_textures(int argc, char** argv) {
+    int count = bench_arg_int(argc, argv, "--count", 300);
+    int size = bench_arg_int(argc, argv, "--size", 256);
+    int workers = bench_arg_int(argc, argv, "--workers", 0);
+    const char* dir = bench_arg_string(argc, argv, "--dir", NULL);
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+
+    char generated[] = "/tmp/gsl_textures_XXXXXX";
+    if (!dir) {
+        if (generate_images(generated, count, size) != 0) {
+            headless_destroy(&headless);
+            return -1;
+        }
+        dir = generated;
+    }
+    ImageList list = { NULL, 0 };
+    if (list_images(dir, &list) != 0 || list.count == 0) {
+        fprintf(stderr, "no .png files in %s\n", dir);
+        free_images(&list);
+        headless_destroy(&headless);
+        return -1;
+    }
+
+    printf("textures: %d images from %s\n", list.count, dir);
+    // warm the page cache so both runs read from memory
+    for (int i = 0; i < list.count; i++) {
+        int width, height;
+        free(texture_decode_png(list.paths[i], &width, &height, NULL));
+    }
+
+    unsigned int sync_checksum = run_sync(&list);
+    unsigned int async_checksum = run_async(&list, workers);
+    printf("  first texture: %s\n", sync_checksum == async_checksum && sync_checksum ? "same pixels" : "DIFFERENT pixels");
+
+    if (dir == generated) {
+        remove_images(generated, &list);
+    }
+    free_images(&list);
+    headless_destroy(&headless);
+    return 0;
+}
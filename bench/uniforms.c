@@ -0,0 +1,76 @@
+#include "bench.h"
+#include <stdio.h>
+#include "glad/glad.h"
+#include "shader.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+/*
+    Sets the three uniforms of shaders/tint.fs N times (1M by default) through
+    the three available paths:
+      driver  - glGetUniformLocation on every set (what shader_set_* used to do)
+      string  - shader_set_* resolving names through the Shader uniform table
+      handle  - shader_set_*_h with handles resolved once
+*/
+
+int bench_uniforms(int argc, char** argv) {
+    int sets = bench_arg_int(argc, argv, "--sets", 1000000);
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+
+    Shader shader = create_shader(GSL_SHADER_DIR "/model.vs", GSL_SHADER_DIR "/tint.fs");
+    if (!shader.ID) {
+        headless_destroy(&headless);
+        return -1;
+    }
+    shader_use(&shader);
+
+    double start = bench_now_ms();
+    for (int i = 0; i < sets; i += 3) {
+        glUniform1f(glGetUniformLocation(shader.ID, "brightness"), (float)i);
+        glUniform1f(glGetUniformLocation(shader.ID, "alpha"), 0.5f);
+        glUniform1i(glGetUniformLocation(shader.ID, "invert"), i & 1);
+    }
+    glFinish();
+    double driver_ms = bench_now_ms() - start;
+    bench_end_frame(); // one frame per setter flavor
+
+    start = bench_now_ms();
+    for (int i = 0; i < sets; i += 3) {
+        shader_set_float(&shader, "brightness", (float)i);
+        shader_set_float(&shader, "alpha", 0.5f);
+        shader_set_bool(&shader, "invert", i & 1);
+    }
+    glFinish();
+    double string_ms = bench_now_ms() - start;
+    bench_end_frame();
+
+    UniformHandle brightness = shader_uniform_handle(&shader, "brightness");
+    UniformHandle alpha = shader_uniform_handle(&shader, "alpha");
+    UniformHandle invert = shader_uniform_handle(&shader, "invert");
+
+    start = bench_now_ms();
+    for (int i = 0; i < sets; i += 3) {
+        shader_set_float_h(&shader, brightness, (float)i);
+        shader_set_float_h(&shader, alpha, 0.5f);
+        shader_set_bool_h(&shader, invert, i & 1);
+    }
+    glFinish();
+    double handle_ms = bench_now_ms() - start;
+    bench_end_frame();
+
+    printf("uniforms: %d sets\n", sets);
+    printf("  driver   %9.2f ms  %7.2f ns/set\n", driver_ms, driver_ms * 1e6 / sets);
+    printf("  string   %9.2f ms  %7.2f ns/set\n", string_ms, string_ms * 1e6 / sets);
+    printf("  handle   %9.2f ms  %7.2f ns/set  (%.2fx faster than driver)\n",
+           handle_ms, handle_ms * 1e6 / sets, driver_ms / handle_ms);
+
+    shader_destroy(&shader);
+    headless_destroy(&headless);
+    return 0;
+}
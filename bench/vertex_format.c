@@ -0,0 +1,121 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "glad/glad.h"
+#include "gl_state.h"
+#include "vertex_format.h"
+#include "shader.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+/*
+    N vertices (10M by default) with position, color and normal, packed in
+    each layout below. Reports the size, SIMD vs scalar pack time (and that
+    both give the same bytes), upload time and the time to draw them as
+    points with the model shader.
+*/
+
+typedef struct {
+    const char* name;
+    VertexAttrib attribs[3];
+    int count;
+} Layout;
+
+static const Layout layouts[] = {
+    { "float pos+color (current)", { { 0, VERTEX_FLOAT3 }, { 1, VERTEX_FLOAT3 } }, 2 },
+    { "float pos, unorm8 color", { { 0, VERTEX_FLOAT3 }, { 1, VERTEX_UNORM8X4 } }, 2 },
+    { "half pos, unorm8 color", { { 0, VERTEX_HALF4 }, { 1, VERTEX_UNORM8X4 } }, 2 },
+    { "snorm16 pos, unorm8 color", { { 0, VERTEX_SNORM16X4 }, { 1, VERTEX_UNORM8X4 } }, 2 },
+    { "float pos/color/normal", { { 0, VERTEX_FLOAT3 }, { 1, VERTEX_FLOAT3 }, { 2, VERTEX_FLOAT3 } }, 3 },
+    { "snorm16 pos, unorm8, 10_10_10_2", { { 0, VERTEX_SNORM16X4 }, { 1, VERTEX_UNORM8X4 }, { 2, VERTEX_SNORM_2_10_10_10 } }, 3 },
+};
+
+int bench_vertex_format(int argc, char** argv) {
+    long vertices = bench_arg_int(argc, argv, "--vertices", 10000000);
+    int frames = bench_arg_int(argc, argv, "--frames", 5);
+
+    Headless headless;
+    if (bench_context(&headless, argc, argv) != 0) {
+        return -1;
+    }
+    Shader shader = create_shader(GSL_SHADER_DIR "/model.vs", GSL_SHADER_DIR "/model.fs");
+    if (!shader.ID) {
+        headless_destroy(&headless);
+        return -1;
+    }
+    shader_use(&shader);
+
+    float* positions = (float*)malloc(vertices * 3 * sizeof(float));
+    float* colors = (float*)malloc(vertices * 3 * sizeof(float));
+    float* normals = (float*)malloc(vertices * 3 * sizeof(float));
+    srand(99);
+    for (long i = 0; i < vertices * 3; i++) {
+        positions[i] = (rand() / (float)RAND_MAX) * 1.8f - 0.9f;
+        colors[i] = rand() / (float)RAND_MAX;
+        normals[i] = (rand() / (float)RAND_MAX) * 2.0f - 1.0f;
+    }
+    const float* sources[3] = { positions, colors, normals };
+
+    printf("vertex formats: %ld vertices, packing with %s\n", vertices, vertex_format_simd_level());
+    double* times = (double*)malloc(frames * sizeof(double));
+
+    for (size_t l = 0; l < sizeof(layouts) / sizeof(layouts[0]); l++) {
+        VertexFormat format;
+        vertex_format_init(&format, layouts[l].attribs, layouts[l].count);
+        size_t bytes = (size_t)format.stride * vertices;
+
+        char* packed = (char*)calloc(bytes, 1);
+        char* reference = (char*)calloc(bytes, 1);
+
+        double start = bench_now_ms();
+        vertex_format_pack_scalar(&format, reference, sources, vertices);
+        double scalar_ms = bench_now_ms() - start;
+
+        start = bench_now_ms();
+        vertex_format_pack(&format, packed, sources, vertices);
+        double simd_ms = bench_now_ms() - start;
+        int match = memcmp(packed, reference, bytes) == 0;
+
+        unsigned int VAO, VBO;
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        gl_state_bind_vertex_array(VAO);
+        gl_state_bind_buffer(GL_ARRAY_BUFFER, VBO);
+
+        start = bench_now_ms();
+        glBufferData(GL_ARRAY_BUFFER, bytes, packed, GL_STATIC_DRAW);
+        glFinish();
+        double upload_ms = bench_now_ms() - start;
+        vertex_format_apply(&format, 0);
+
+        for (int f = 0; f < frames; f++) {
+            start = bench_now_ms();
+            glClear(GL_COLOR_BUFFER_BIT);
+            glDrawArrays(GL_POINTS, 0, (GLsizei)vertices);
+            glFinish();
+            times[f] = bench_now_ms() - start;
+            bench_end_frame();
+        }
+
+        printf("  %-32s %2d B/vertex %7.1f MB\n", layouts[l].name, format.stride, bytes / (1024.0 * 1024.0));
+        printf("      pack simd %8.2f ms  scalar %8.2f ms  %s\n", simd_ms, scalar_ms, match ? "identical" : "MISMATCH");
+        printf("      upload %8.2f ms  draw median %8.2f ms\n", upload_ms, bench_stats(times, frames).median);
+
+        gl_state_delete_vertex_arrays(1, &VAO);
+        gl_state_delete_buffers(1, &VBO);
+        free(packed);
+        free(reference);
+    }
+
+    free(times);
+    free(positions);
+    free(colors);
+    free(normals);
+    shader_destroy(&shader);
+    headless_destroy(&headless);
+    return 0;
+}
@@ -0,0 +1,53 @@
+#ifndef BATCH_H
+#define BATCH_H
+#include "shader.h"
+
+/*
+    Batch renderer for many small shapes. Triangles pushed during a frame are
+    grouped by shader on the CPU; batch_flush() uploads all of them into one
+    streaming vertex buffer (orphaned every flush) and issues a single
+    glDrawArrays per shader.
+
+    Triangles that use the same shader keep their submission order, but the
+    order between different shaders is lost, so overlapping blended shapes
+    with different shaders should be flushed in between.
+*/
+
+#define BATCH_MAX_SHADERS 16
+
+// same layout as the scene vertices: position + color
+typedef struct {
+    float x, y, z;
+    float r, g, b;
+} BatchVertex;
+
+typedef struct {
+    Shader* shader;
+    BatchVertex* vertices;
+    int count;
+    int capacity;
+} BatchBucket;
+
+typedef struct {
+    unsigned int VAO;
+    unsigned int VBO;
+    long buffer_size; // bytes currently allocated for VBO
+    BatchBucket buckets[BATCH_MAX_SHADERS];
+    int bucket_count;
+    int last_bucket; // most shapes reuse the shader of the previous one
+
+    // summed over the flushes since batch_reset_stats, a frame's worth
+    // when the caller resets once a frame (running out of buckets flushes early)
+    int draw_calls;
+    int vertex_count;
+} Batch;
+
+void batch_init(Batch* batch);
+// vertex_count must be a multiple of 3. returns 0 on success, -1 when out
+// of memory (the vertices are dropped)
+int batch_push(Batch* batch, Shader* shader, const BatchVertex* vertices, int vertex_count);
+void batch_flush(Batch* batch);
+void batch_reset_stats(Batch* batch);
+void batch_destroy(Batch* batch);
+
+#endif // BATCH_H
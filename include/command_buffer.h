@@ -0,0 +1,51 @@
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+#include <stddef.h>
+#include "glad/glad.h"
+
+/*
+    Compact binary stream of GL commands. Any thread can record into its own
+    CommandBuffer (no GL calls are made while recording); the GL thread
+    replays the streams in whatever order it wants with
+    command_buffer_replay. Program and VAO binds go through gl_state on
+    replay, so redundant binds between streams are dropped.
+
+    Each command is a 4-byte header (type + payload size) followed by its
+    arguments. The buffer is a linear arena: command_buffer_reset keeps the
+    memory for the next frame. Uniform locations must be resolved on the GL
+    thread beforehand (shader_uniform_handle).
+
+    To replay part of a buffer, note command_buffer_mark before and after
+    recording it and pass both to command_buffer_replay_range.
+*/
+
+typedef struct {
+    char* data;
+    size_t size;
+    size_t capacity;
+    int failed; // an allocation failed, the rest of the frame was dropped
+} CommandBuffer;
+
+void command_buffer_init(CommandBuffer* buffer, size_t capacity);
+void command_buffer_reset(CommandBuffer* buffer);
+void command_buffer_free(CommandBuffer* buffer);
+
+// -- Recording -- //
+void command_buffer_use_program(CommandBuffer* buffer, GLuint program);
+void command_buffer_bind_vertex_array(CommandBuffer* buffer, GLuint vertex_array);
+void command_buffer_uniform_1i(CommandBuffer* buffer, GLint location, GLint value);
+void command_buffer_uniform_1f(CommandBuffer* buffer, GLint location, GLfloat value);
+void command_buffer_uniform_3f(CommandBuffer* buffer, GLint location, GLfloat x, GLfloat y, GLfloat z);
+void command_buffer_uniform_4f(CommandBuffer* buffer, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+// copies the 16 floats, column-major
+void command_buffer_uniform_mat4(CommandBuffer* buffer, GLint location, const GLfloat* matrix);
+void command_buffer_draw_arrays(CommandBuffer* buffer, GLenum mode, GLint first, GLsizei count);
+void command_buffer_draw_elements(CommandBuffer* buffer, GLenum mode, GLsizei count, GLenum type, size_t offset);
+void command_buffer_draw_arrays_instanced(CommandBuffer* buffer, GLenum mode, GLint first, GLsizei count, GLsizei instances);
+
+// -- Replay (GL thread) -- //
+size_t command_buffer_mark(const CommandBuffer* buffer);
+void command_buffer_replay(const CommandBuffer* buffer);
+void command_buffer_replay_range(const CommandBuffer* buffer, size_t begin, size_t end);
+
+#endif // COMMAND_BUFFER_H
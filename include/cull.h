@@ -0,0 +1,54 @@
+#ifndef CULL_H
+#define CULL_H
+#include "vecmath.h"
+
+/*
+    Frustum culling over bounding volumes stored as structure of arrays, so
+    the SIMD kernels test 8 (AVX2) or 4 (SSE) objects per iteration against
+    the six planes. The ISA follows vecmath_isa().
+
+    cull_spheres / cull_boxes write the indices of the visible objects in
+    [first, first + count) to visible, in order, and return how many there
+    are. visible needs room for count indices. Disjoint ranges can be culled
+    from different threads into different outputs.
+*/
+
+typedef struct {
+    float planes[6][4]; // a x + b y + c z + d >= 0 inside, (a, b, c) normalized
+} Frustum;
+
+typedef struct {
+    float* x;
+    float* y;
+    float* z;
+    float* radius;
+    long count;
+    long capacity;
+} CullSpheres;
+
+typedef struct {
+    float* center_x;
+    float* center_y;
+    float* center_z;
+    float* extent_x; // half sizes
+    float* extent_y;
+    float* extent_z;
+    long count;
+    long capacity;
+} CullBoxes;
+
+// planes of the clip volume of view_projection, in world space
+void frustum_from_matrix(Frustum* frustum, const Mat4* view_projection);
+
+// return the index of the new object, -1 when out of memory
+long cull_spheres_push(CullSpheres* spheres, Vec3 center, float radius);
+void cull_spheres_clear(CullSpheres* spheres);
+void cull_spheres_free(CullSpheres* spheres);
+long cull_boxes_push(CullBoxes* boxes, Vec3 center, Vec3 extent);
+void cull_boxes_clear(CullBoxes* boxes);
+void cull_boxes_free(CullBoxes* boxes);
+
+long cull_spheres(const Frustum* frustum, const CullSpheres* spheres, long first, long count, unsigned int* visible);
+long cull_boxes(const Frustum* frustum, const CullBoxes* boxes, long first, long count, unsigned int* visible);
+
+#endif // CULL_H
@@ -0,0 +1,95 @@
+#ifndef DRAW_INDIRECT_H
+#define DRAW_INDIRECT_H
+#include "glad/glad.h"
+#include "figure.h"
+
+/*
+    Submits every draw of a frame with one glMultiDrawArraysIndirect and one
+    glMultiDrawElementsIndirect (GL 4.3).
+
+    Meshes are appended once into a shared vertex/index buffer pair. Each
+    draw_queue_push records a command plus a FigureInstance; the command's
+    baseInstance points at that instance, so shaders/instanced.vs reads the
+    per-draw offset/scale/tint from attributes 2 and 3 like any other
+    instance. This needs no gl_DrawID (4.6 / ARB_shader_draw_parameters).
+
+    On 3.3 contexts (or allow_indirect = 0) draw_queue_submit loops over the
+    draws instead. The instance arrays stay disabled and each draw sets
+    attributes 2 and 3 with glVertexAttrib* before its glDrawArrays or
+    glDrawElementsBaseVertex, so the same shader works on both paths.
+
+    The indirect path draws every non-indexed mesh before the indexed ones;
+    the fallback keeps the push order.
+
+    Per frame:
+        draw_queue_begin(&queue);
+        draw_queue_push(&queue, mesh, &instance);  // any number
+        draw_queue_submit(&queue);
+*/
+
+typedef struct {
+    GLuint count;
+    GLuint instance_count;
+    GLuint first;
+    GLuint base_instance;
+} DrawArraysCommand;
+
+typedef struct {
+    GLuint count;
+    GLuint instance_count;
+    GLuint first_index;
+    GLint base_vertex;
+    GLuint base_instance;
+} DrawElementsCommand;
+
+typedef struct {
+    int first;       // first vertex, or first index for indexed meshes
+    int count;       // vertices, or indices
+    int base_vertex;
+    int indexed;
+} DrawMesh;
+
+typedef struct {
+    unsigned int VAO;
+    unsigned int VBO;
+    unsigned int EBO;
+    unsigned int instance_VBO;
+    unsigned int command_buffer;
+    int indirect; // 0 on the direct-draw fallback
+
+    DrawMesh* meshes;
+    int mesh_count;
+    int mesh_capacity;
+    int vertex_count;  // vertices used in VBO
+    int vertex_capacity;
+    int index_count;   // indices used in EBO
+    int index_capacity;
+
+    // recorded by draw_queue_push, in submission order
+    int* draw_meshes;
+    FigureInstance* instances;
+    int draw_count;
+    int draw_capacity;
+
+    // packed by draw_queue_submit on the indirect path
+    DrawArraysCommand* array_commands;
+    DrawElementsCommand* element_commands;
+
+    // filled by the last submit
+    int draw_calls;
+    double submit_ms; // CPU time spent inside draw_queue_submit
+} DrawQueue;
+
+// vertices use the figure layout (FIGURE_VERTEX_FLOATS). returns 0 on success, -1 on failure
+int draw_queue_init(DrawQueue* queue, int max_vertices, int max_indices, int max_draws, int allow_indirect);
+// indices may be NULL. returns the mesh id, -1 when the shared buffers are full
+int draw_queue_add_mesh(DrawQueue* queue, const float* vertices, int vertex_count,
+                        const unsigned int* indices, int index_count);
+void draw_queue_begin(DrawQueue* queue);
+// returns -1 when max_draws is reached
+int draw_queue_push(DrawQueue* queue, int mesh, const FigureInstance* instance);
+// with whatever shader is bound
+void draw_queue_submit(DrawQueue* queue);
+void draw_queue_destroy(DrawQueue* queue);
+
+#endif // DRAW_INDIRECT_H
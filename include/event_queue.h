@@ -0,0 +1,56 @@
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+#include <stdatomic.h>
+
+/*
+    Lock-free single-producer single-consumer ring of window events. The
+    GLFW callbacks push on the main thread, the render thread pops at the
+    start of each frame.
+
+    head is only written by the consumer and tail only by the producer, each
+    on its own cache line. Both sides keep a cached copy of the other index
+    so the shared line is only read when the ring looks full or empty.
+    A full ring drops the event and counts it in dropped.
+*/
+
+#define EVENT_QUEUE_SIZE 1024 // power of two
+
+typedef enum {
+    EVENT_KEY,
+    EVENT_MOUSE_BUTTON,
+    EVENT_CURSOR,
+    EVENT_RESIZE,
+    EVENT_CLOSE,
+} EventType;
+
+typedef struct {
+    EventType type;
+    double time_ms; // timer_now_ms when the event was received
+    int key;        // EVENT_KEY, or the button for EVENT_MOUSE_BUTTON
+    int action;
+    int mods;
+    int width;      // EVENT_RESIZE, framebuffer size
+    int height;
+    double x;       // EVENT_CURSOR
+    double y;
+} WindowEvent;
+
+typedef struct {
+    _Alignas(64) atomic_uint head; // next slot to pop
+    unsigned int tail_cache;
+    _Alignas(64) atomic_uint tail; // next slot to push
+    unsigned int head_cache;
+    atomic_uint dropped;
+    _Alignas(64) WindowEvent events[EVENT_QUEUE_SIZE];
+} EventQueue;
+
+// allocated with the 64-byte alignment the members ask for (plain malloc
+// does not give it) and initialized; release with free. NULL when out of memory
+EventQueue* event_queue_create(void);
+void event_queue_init(EventQueue* queue);
+// producer side, returns 0 on success, -1 when the ring is full
+int event_queue_push(EventQueue* queue, const WindowEvent* event);
+// consumer side, returns 1 when an event was popped, 0 when empty
+int event_queue_pop(EventQueue* queue, WindowEvent* event);
+
+#endif // EVENT_QUEUE_H
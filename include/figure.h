@@ -0,0 +1,43 @@
+#ifndef FIGURE_H
+#define FIGURE_H
+
+/*
+    A shape uploaded once (positions + colors, optionally indexed) that can
+    be drawn many times with a single instanced draw call. Every instance
+    has an offset, a scale and a tint, read by shaders/instanced.vs from
+    attributes 2 and 3 with glVertexAttribDivisor(1).
+*/
+
+// vertex layout shared with the scene: x y z r g b
+#define FIGURE_VERTEX_FLOATS 6
+
+typedef struct {
+    float x, y, z;
+    float scale;
+    float r, g, b;
+} FigureInstance;
+
+typedef struct {
+    unsigned int VAO;
+    unsigned int VBO;
+    unsigned int EBO;          // 0 for non-indexed figures
+    unsigned int index_type;   // GL_UNSIGNED_SHORT when every index fits, else GL_UNSIGNED_INT
+    unsigned int instance_VBO;
+    int vertex_count;
+    int index_count;
+    int instance_count;
+    int instance_capacity;
+} Figure;
+
+// indices may be NULL to draw the vertices as a plain triangle list. Run
+// mesh_optimize (mesh_optimize.h) on indexed data first
+void figure_init(Figure* figure, const float* vertices, int vertex_count,
+                 const unsigned int* indices, int index_count);
+void figure_set_instances(Figure* figure, const FigureInstance* instances, int count);
+// one copy, with whatever the bound shader does with it
+void figure_draw(Figure* figure);
+// every instance set with figure_set_instances in one call
+void figure_draw_instanced(Figure* figure);
+void figure_destroy(Figure* figure);
+
+#endif // FIGURE_H
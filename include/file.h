@@ -0,0 +1,24 @@
+#ifndef FILE_H
+#define FILE_H
+#include <stddef.h>
+
+/*
+    Read-only view of a whole file, used for shader sources and meant for
+    every other asset that is loaded from disk. Regular files are mmapped, so
+    loading is one syscall and no copy; anything that cannot be mapped is read
+    into a heap buffer instead. The data is NOT NUL terminated, always pass
+    size along.
+*/
+
+typedef struct {
+    const char* data;
+    size_t size;
+    void* mapping;       // mmap base, NULL when data is a heap buffer
+    size_t mapping_size;
+} FileView;
+
+// returns 0 on success, -1 on failure with errno set
+int file_load(const char* path, FileView* file);
+void file_release(FileView* file);
+
+#endif // FILE_H
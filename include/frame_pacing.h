@@ -0,0 +1,91 @@
+#ifndef FRAME_PACING_H
+#define FRAME_PACING_H
+#include "glad/glad.h"
+
+/*
+    Frame pacing: how fast frames are produced and how far the CPU may run
+    ahead of the GPU, chosen at runtime so latency can be traded against
+    throughput per deployment.
+
+      vsync     the swap blocks on the display (swap interval N)
+      uncapped  swap interval 0, no limiter
+      cap       swap interval 0, frames start on a fixed cadence; the wait
+                sleeps until spin_ms before the deadline and spins the rest
+
+    Independently of the mode, max_in_flight > 0 puts a fence after every
+    swap and makes frame_pacer_begin wait until no more than max_in_flight
+    frames are queued on the GPU. 1 gives the lowest latency, larger values
+    more throughput.
+
+    frame_pacer_begin goes before input is read, so the waits do not add to
+    the input latency; frame_pacer_end goes right after the swap. Both on
+    the GL thread.
+
+    Specs are comma separated: "vsync", "vsync=2", "uncapped", "cap=120",
+    "inflight=2", "spin=0.5", e.g. "cap=144,inflight=1".
+*/
+
+#define FRAME_PACING_MAX_IN_FLIGHT 8
+#define FRAME_PACING_HISTORY 240 // frames kept for the statistics
+
+typedef enum {
+    PACING_VSYNC,
+    PACING_UNCAPPED,
+    PACING_CAP,
+} PacingMode;
+
+typedef struct {
+    PacingMode mode;
+    int swap_interval;   // vsync
+    double target_fps;   // cap
+    double spin_ms;      // cap, part of the wait that is spun instead of slept
+    int max_in_flight;   // 0 = no limit
+} FramePacingConfig;
+
+typedef struct {
+    double mean_ms;      // time between consecutive frame_pacer_end calls
+    double min_ms;
+    double max_ms;
+    double p99_ms;
+    double jitter_ms;    // standard deviation of the frame time
+    double limiter_ms;   // average wait for the cap deadline per frame
+    double fence_ms;     // average wait for the GPU per frame
+    int in_flight;       // frames queued on the GPU right now
+    int frames;          // frames in the window
+} FramePacingStats;
+
+typedef struct {
+    FramePacingConfig config;
+    GLsync fences[FRAME_PACING_MAX_IN_FLIGHT];
+    unsigned long frame;
+    double deadline_ms;  // when the next capped frame may start
+    double last_end_ms;
+    // history ring
+    double frame_ms[FRAME_PACING_HISTORY];
+    double limiter_ms[FRAME_PACING_HISTORY];
+    double fence_ms[FRAME_PACING_HISTORY];
+    int count;
+    int next;
+    double pending_limiter_ms; // waits of the frame in progress
+    double pending_fence_ms;
+} FramePacer;
+
+// vsync, interval 1, two frames in flight
+FramePacingConfig frame_pacing_default(void);
+// applies spec on top of config, returns 0 on success, -1 (config untouched) on a bad spec
+int frame_pacing_parse(FramePacingConfig* config, const char* spec);
+const char* frame_pacing_mode_name(PacingMode mode);
+
+void frame_pacer_init(FramePacer* pacer, const FramePacingConfig* config);
+// GL thread, deletes the pending fences
+void frame_pacer_destroy(FramePacer* pacer);
+// argument for glfwSwapInterval
+int frame_pacer_swap_interval(const FramePacer* pacer);
+
+void frame_pacer_begin(FramePacer* pacer);
+void frame_pacer_end(FramePacer* pacer);
+
+FramePacingStats frame_pacer_stats(const FramePacer* pacer);
+void frame_pacer_print_stats(const FramePacer* pacer);
+
+#endif // FRAME_PACING_H
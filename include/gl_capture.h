@@ -0,0 +1,74 @@
+#ifndef GL_CAPTURE_H
+#define GL_CAPTURE_H
+#include <stdint.h>
+#include "glad/glad.h"
+
+/*
+    GL capture: serializes every GL call the program makes, with its
+    payloads, into a compact binary file that gsl_replay (bench/replay.c,
+    gl_replay.h) plays back headless. Built on the interception wrappers
+    (gl_intercept.h), so it needs -DGSL_GL_INTERCEPT=ON; gl_capture_start
+    installs them. Start it right after the context is created so the
+    stream has every object the program makes.
+
+    File layout (host byte order):
+      "GSLCAP\0\0", u32 version, u32 width, u32 height, u32 frame count
+      (filled in by gl_capture_stop, 0 when the capture was cut short),
+      u32 function count, then that many NUL terminated function names
+      records: u16 function index into that table, or GL_CAPTURE_FRAME at
+      every gl_intercept_frame, followed by the arguments as the wrapper
+      for that function writes them: integers and enums as u32, floats as
+      f32, doubles as f64, 64-bit and pointer-sized values (offsets, syncs)
+      as u64, payloads as u64 size + bytes (GL_CAPTURE_NULL for a NULL
+      pointer), strings the same with their NUL. Texture images start
+      with the unpack alignment, row length, skip pixels and skip rows
+      (u32 each) and a u32 that is 1 when the pixels are a u64 offset into
+      the bound pixel unpack buffer, 0 when a payload follows.
+
+    Object names are written as the driver returned them; the replay maps
+    them to the names it gets back. Mappings are told apart by the buffer
+    bound to their target, on both sides. Payloads are captured for buffer data,
+    shader sources, program binaries, uniform arrays, 2D texture images and
+    glMapBufferRange/glFlushMappedBufferRange/glUnmapBuffer. Persistent and
+    coherent mappings are written to while they stay mapped, so what the
+    program stores in them is not captured. Queries (glGet*, glIs*,
+    glReadPixels...) are not recorded; persistent and coherent mappings and
+    other calls with pointer arguments the capture does not understand are
+    counted and listed by gl_capture_stop.
+*/
+
+#define GL_CAPTURE_VERSION 2
+#define GL_CAPTURE_FRAME 0xffff
+#define GL_CAPTURE_NULL UINT64_MAX
+
+// returns 0 on success, -1 when the file cannot be created or the interception is compiled out
+int gl_capture_start(const char* path, int width, int height);
+void gl_capture_stop(void);
+int gl_capture_active(void);
+
+// -- Used by the generated wrappers -- //
+extern int gl_capture_on;
+
+void gl_capture_call(int function);
+void gl_capture_frame(void);
+void gl_capture_unsupported(int function);
+void gl_capture_u32(uint32_t value);
+void gl_capture_u64(uint64_t value);
+void gl_capture_f32(float value);
+void gl_capture_f64(double value);
+void gl_capture_bytes(const void* data, uint64_t size);
+void gl_capture_string(const char* text, int length); // length < 0: up to the NUL
+void gl_capture_strings(GLsizei count, const GLchar* const* strings, const GLint* lengths);
+
+// pixels of glTexImage2D/glTexSubImage2D: the unpack state, then the bytes
+// GL reads with it, or the offset when a pixel unpack buffer is bound
+void gl_capture_image(const void* pixels, GLsizei width, GLsizei height, GLenum format, GLenum type);
+// the buffer bound to a buffer target, 0 for none or an unknown target.
+// Both query past the interception wrappers
+GLuint gl_capture_bound_buffer(GLenum target);
+
+void gl_capture_mapped(GLenum target, void* pointer, GLintptr offset, GLsizeiptr length, GLbitfield access);
+// writes what the program stored in the mapping of target (whole range, or [offset, offset + length) when flushing)
+void gl_capture_mapped_contents(GLenum target, int flush, GLintptr offset, GLsizeiptr length);
+
+#endif // GL_CAPTURE_H
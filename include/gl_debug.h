@@ -0,0 +1,74 @@
+#ifndef GL_DEBUG_H
+#define GL_DEBUG_H
+#include "glad/glad.h"
+
+/*
+    Collects the driver's debug output (KHR_debug, core since GL 4.3):
+    errors, performance warnings (buffers moved between memory types,
+    shaders recompiled for the current state, stalls), undefined behavior
+    and portability problems.
+
+    gl_debug_install, called after GLAD is loaded, installs a
+    glDebugMessageCallback with synchronous output, so a message arrives on
+    the GL thread inside the call that caused it. Messages are
+    de-duplicated by source, type and id: each one keeps its occurrence
+    count, the frames it showed up in and the text of its first
+    occurrence. Nothing is printed from the callback. gl_debug_frame, at
+    the end of a frame, prints each message the first time it is seen and
+    a one line summary of that frame; repeats are only counted.
+    gl_debug_report prints the per-run summary.
+
+    Drivers only promise messages in a debug context (GLFW_OPENGL_DEBUG_CONTEXT,
+    headless_set_debug); in other contexts what comes through is up to the
+    driver. GL thread only.
+*/
+
+#define GL_DEBUG_MAX_MESSAGES 256 // distinct messages, more are only counted
+#define GL_DEBUG_TEXT_SIZE 256
+
+typedef enum {
+    GL_MESSAGE_ERROR,
+    GL_MESSAGE_PERFORMANCE,
+    GL_MESSAGE_UNDEFINED,   // undefined behavior
+    GL_MESSAGE_PORTABILITY, // also deprecated behavior
+    GL_MESSAGE_OTHER,
+    GL_MESSAGE_CLASSES,
+} GlMessageClass;
+
+typedef struct {
+    GLenum source;
+    GLenum type;
+    GLuint id;
+    GLenum severity;        // of the first occurrence
+    GlMessageClass message_class;
+    unsigned long count;
+    unsigned long frames;   // frames it showed up in
+    unsigned long first_frame; // gl_debug_frame calls before it was first seen
+    unsigned long last_frame;
+    char text[GL_DEBUG_TEXT_SIZE]; // first occurrence, truncated
+} GlDebugMessage;
+
+typedef struct {
+    unsigned long frame;
+    unsigned long messages;     // every occurrence
+    unsigned long new_messages; // seen for the first time
+    unsigned long by_class[GL_MESSAGE_CLASSES];
+} GlDebugFrameStats;
+
+// returns 0 on success, -1 when the context has no debug output
+int gl_debug_install(void);
+void gl_debug_uninstall(void);
+int gl_debug_installed(void);
+
+// end of frame: prints the new messages and the frame summary when there were any
+void gl_debug_frame(void);
+GlDebugFrameStats gl_debug_last_frame(void);
+void gl_debug_reset(void);
+
+const GlDebugMessage* gl_debug_messages(int* count);
+// totals per class and every distinct message, most frequent first (ties by class)
+void gl_debug_report(void);
+
+const char* gl_debug_class_name(GlMessageClass message_class);
+
+#endif // GL_DEBUG_H
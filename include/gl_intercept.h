@@ -0,0 +1,64 @@
+#ifndef GL_INTERCEPT_H
+#define GL_INTERCEPT_H
+#include <stdint.h>
+#include "glad/glad.h"
+
+/*
+    GL call interception: counts and times every GL call the program makes.
+
+    tools/gl_intercept.py generates a wrapper for each glad_gl* pointer
+    (src/gl_intercept_wrappers.c). gl_intercept_install, called after
+    gladLoadGLLoader, saves the real pointers and puts the wrappers in their
+    place, so every glFoo() in the program goes through one of them. Each
+    wrapper reads the clock around the real call and adds to that
+    function's counters for the current frame; gl_intercept_frame folds the
+    frame into the totals and keeps per-frame totals (calls and CPU time
+    spent inside GL). While a capture is running (gl_capture.h) the
+    wrappers also write each call to it and gl_intercept_frame writes the
+    frame marker.
+
+    Only built with the GSL_GL_INTERCEPT CMake option. Without it the
+    wrappers are not compiled, gl_intercept_install fails and the rest does
+    nothing, so normal builds pay nothing. The counters are not atomic: GL
+    calls from a single thread only.
+*/
+
+typedef struct {
+    const char* name;
+    unsigned long calls;     // up to the last gl_intercept_frame
+    uint64_t time_ns;
+    unsigned long frame_calls; // in the current frame
+    uint64_t frame_time_ns;
+} GlCallStats;
+
+typedef struct {
+    unsigned long frames;
+    unsigned long calls;     // over every frame
+    uint64_t time_ns;
+    unsigned long last_calls;
+    uint64_t last_time_ns;
+    unsigned long max_calls;
+    uint64_t max_time_ns;
+} GlFrameStats;
+
+// returns 0 on success, -1 when compiled without GSL_GL_INTERCEPT
+int gl_intercept_install(void);
+// puts the real pointers back
+void gl_intercept_uninstall(void);
+int gl_intercept_installed(void);
+
+// end of frame, after the swap (also the frame marker of a capture)
+void gl_intercept_frame(void);
+void gl_intercept_reset(void);
+
+// glGetIntegerv past the wrappers: not counted and not captured, for the
+// state the capture itself needs
+void gl_intercept_get_integerv(GLenum pname, GLint* data);
+
+// one entry per GL function, NULL and 0 when compiled out
+const GlCallStats* gl_intercept_stats(int* count);
+GlFrameStats gl_intercept_frame_stats(void);
+// the top functions by time spent inside them
+void gl_intercept_report(int top);
+
+#endif // GL_INTERCEPT_H
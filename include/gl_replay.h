@@ -0,0 +1,123 @@
+#ifndef GL_REPLAY_H
+#define GL_REPLAY_H
+#include <stdint.h>
+#include "glad/glad.h"
+#include "file.h"
+
+/*
+    Plays back a GL capture (gl_capture.h) on the current context. The file
+    is mapped, payloads are passed to GL straight from the mapping.
+
+    Functions are matched by name, so a capture stays readable after glad is
+    regenerated; calls to functions this build does not know are an error.
+    Object names from the capture are mapped to the names the driver returns
+    on replay; names that were never created in the stream (the default
+    framebuffer, the headless one) pass through unchanged.
+
+    Everything before the first frame marker is setup (context state,
+    programs, buffers) plus the first frame, as frame markers are written at
+    the end of every frame. gl_replay_rewind goes back to the second frame
+    so the frames can be replayed again without repeating the setup; stop
+    after frame_count frames to loop without running the teardown that
+    follows the last marker.
+*/
+
+typedef enum {
+    GL_NAME_BUFFER,
+    GL_NAME_VERTEX_ARRAY,
+    GL_NAME_TEXTURE,
+    GL_NAME_FRAMEBUFFER,
+    GL_NAME_RENDERBUFFER,
+    GL_NAME_PROGRAM,
+    GL_NAME_SHADER,
+    GL_NAME_QUERY,
+    GL_NAME_SAMPLER,
+    GL_NAME_PIPELINE,
+    GL_NAME_KINDS,
+} GlNameKind;
+
+typedef struct {
+    GLuint* names;      // indexed by the captured name, 0 when unmapped
+    uint32_t capacity;
+} GlNameMap;
+
+typedef struct {
+    uint64_t captured;
+    GLsync sync;
+} GlSyncEntry;
+
+typedef struct {
+    GLuint buffer;  // bound to the target when it was mapped, replay name
+    char* pointer;
+    GLsizeiptr length;
+} GlReplayMapping;
+
+typedef struct {
+    FileView file;
+    const char* cursor;
+    const char* end;
+    const char* first_frame; // right after the setup
+    int failed;
+    int width;
+    int height;
+    int frame_count;     // frame markers in the stream, 0 when the capture was cut short
+
+    int function_count;
+    const char** names;  // capture index -> function name, in the file
+    int* functions;      // capture index -> replay call index, -1 when unknown
+
+    GlNameMap maps[GL_NAME_KINDS];
+    GlSyncEntry* syncs;
+    int sync_count;
+    int sync_capacity;
+    GlReplayMapping mappings[16];
+
+    void* scratch;       // arrays of remapped names
+    size_t scratch_size;
+
+    unsigned long calls;
+    unsigned long frames;
+} GlReplay;
+
+// returns 0 on success, -1 when the file cannot be read or is not a capture
+int gl_replay_open(GlReplay* replay, const char* path);
+void gl_replay_close(GlReplay* replay);
+
+// replays the setup (the first call) or the next frame.
+// returns 1 when a frame marker was reached, 0 at the end of the stream, -1 on a corrupt stream
+int gl_replay_frame(GlReplay* replay);
+void gl_replay_rewind(GlReplay* replay);
+
+// -- Used by the generated readers -- //
+uint32_t gl_replay_u32(GlReplay* replay);
+uint64_t gl_replay_u64(GlReplay* replay);
+float gl_replay_f32(GlReplay* replay);
+double gl_replay_f64(GlReplay* replay);
+// payload or string in place, NULL for a NULL pointer; size may be NULL
+const void* gl_replay_bytes(GlReplay* replay, uint64_t* size);
+// texture image pixels (gl_capture_image): restores the unpack state they
+// were captured with, returns the payload or the pixel unpack buffer offset
+const void* gl_replay_image(GlReplay* replay);
+// count strings and their lengths, for glShaderSource
+const GLchar* const* gl_replay_strings(GlReplay* replay, GLsizei count, const GLint** lengths);
+void* gl_replay_scratch(GlReplay* replay, size_t size);
+
+GLuint gl_replay_name(GlReplay* replay, GlNameKind kind);
+// reads count captured names and returns them remapped (scratch memory)
+const GLuint* gl_replay_names(GlReplay* replay, GlNameKind kind, GLsizei count);
+// reads count captured names and records that they are now created[i]
+void gl_replay_created(GlReplay* replay, GlNameKind kind, GLsizei count, const GLuint* created);
+GLsync gl_replay_sync(GlReplay* replay);
+void gl_replay_created_sync(GlReplay* replay, GLsync sync);
+
+void gl_replay_mapped(GlReplay* replay, GLenum target, void* pointer, GLsizeiptr length);
+// copies the next payload into the mapping of target at offset; a payload
+// that does not fit in the mapped range is a corrupt stream
+void gl_replay_mapped_contents(GlReplay* replay, GLenum target, GLintptr offset);
+
+// src/gl_replay_calls.c
+extern const char* const gl_replay_function_names[];
+extern const int gl_replay_function_count;
+extern void (*const gl_replay_calls[])(GlReplay* replay);
+
+#endif // GL_REPLAY_H
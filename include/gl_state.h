@@ -0,0 +1,39 @@
+#ifndef GL_STATE_H
+#define GL_STATE_H
+#include "glad/glad.h"
+
+/*
+    Shadow copy of the GL state we touch every frame. Binds and state changes
+    go through here and are only sent to the driver when the value actually
+    changes. There is one context per process so the cache is global; call
+    gl_state_reset() right after a context is made current.
+
+    Objects must be deleted through gl_state_delete_* so the cache forgets
+    them (GL reuses names, a stale entry would elide a real bind).
+*/
+
+typedef struct {
+    unsigned long issued; // calls that reached the driver
+    unsigned long elided; // calls dropped because the state already matched
+} GLStateStats;
+
+void gl_state_reset(void);
+
+void gl_state_use_program(GLuint program);
+void gl_state_bind_vertex_array(GLuint vertex_array);
+// GL_ARRAY_BUFFER and GL_ELEMENT_ARRAY_BUFFER are cached, other targets go straight through
+void gl_state_bind_buffer(GLenum target, GLuint buffer);
+
+void gl_state_set_blend(int enabled);
+void gl_state_blend_func(GLenum src, GLenum dst);
+void gl_state_viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_state_clear_color(GLfloat r, GLfloat g, GLfloat b, GLfloat a);
+
+void gl_state_delete_program(GLuint program);
+void gl_state_delete_vertex_arrays(GLsizei count, const GLuint* vertex_arrays);
+void gl_state_delete_buffers(GLsizei count, const GLuint* buffers);
+
+GLStateStats gl_state_stats(void);
+void gl_state_reset_stats(void);
+
+#endif // GL_STATE_H
@@ -0,0 +1,107 @@
+#ifndef GPU_PROFILER_H
+#define GPU_PROFILER_H
+#include "glad/glad.h"
+
+/*
+    GPU profiler with nested named scopes ("frame" > "draw" > ...).
+
+    GL_TIME_ELAPSED queries cannot be nested, so every scope writes a
+    GL_TIMESTAMP at push and at pop and the GPU time is the difference.
+    Queries live in a ring of GPU_PROFILER_FRAMES frames: the results of a
+    frame are read when its slot comes round again, GPU_PROFILER_FRAMES - 1
+    frames later. If they are still not available then, the frame is
+    dropped instead of stalling. The CPU time between push and pop is
+    recorded too, so both can be compared per scope.
+
+    Results are aggregated per scope name (average and max per frame) over
+    windows of window_frames frames; gpu_profiler_results returns the last
+    complete window. gpu_profiler_flush waits for the frames still in the
+    ring and publishes the window collected so far, for reports at exit of
+    runs shorter than a window. Scope names are not copied, pass string
+    literals.
+
+    Every function accepts a NULL profiler and does nothing, so code can be
+    instrumented unconditionally. GL thread only.
+*/
+
+#define GPU_PROFILER_FRAMES 4
+#define GPU_PROFILER_MAX_SCOPES 64 // per frame
+#define GPU_PROFILER_MAX_DEPTH 16
+
+typedef struct {
+    const char* name;
+    int depth;
+    double calls;       // per frame
+    double gpu_avg_ms;  // per frame, summed over the calls
+    double gpu_max_ms;
+    double cpu_avg_ms;
+    double cpu_max_ms;
+} GpuScopeStats;
+
+typedef struct {
+    const char* name;
+    int depth;
+    double cpu_begin_ms;
+    double cpu_end_ms;
+} GpuScopeRecord;
+
+typedef struct {
+    GpuScopeRecord scopes[GPU_PROFILER_MAX_SCOPES];
+    int scope_count;
+    int pending; // queries issued, results not read yet
+} GpuProfilerFrame;
+
+// running totals for one scope name in the current window
+typedef struct {
+    const char* name;
+    int depth;
+    int calls;
+    double gpu_sum_ms;
+    double gpu_max_ms;
+    double cpu_sum_ms;
+    double cpu_max_ms;
+    double frame_gpu_ms; // of the frame being collected
+    double frame_cpu_ms;
+} GpuScopeTotals;
+
+typedef struct {
+    GLuint queries[GPU_PROFILER_FRAMES][GPU_PROFILER_MAX_SCOPES * 2];
+    GpuProfilerFrame frames[GPU_PROFILER_FRAMES];
+    unsigned long frame;
+    int stack[GPU_PROFILER_MAX_DEPTH];
+    int depth;
+    int overflow;        // scopes past the limits of the current frame
+
+    int window_frames;
+    int window_count;    // frames collected in the current window
+    GpuScopeTotals totals[GPU_PROFILER_MAX_SCOPES];
+    int total_count;
+
+    GpuScopeStats results[GPU_PROFILER_MAX_SCOPES];
+    int result_count;
+    int result_frames;   // frames in the published window
+    unsigned long dropped;
+} GpuProfiler;
+
+// returns 0 on success, -1 when timer queries are not supported
+int gpu_profiler_init(GpuProfiler* profiler, int window_frames);
+void gpu_profiler_destroy(GpuProfiler* profiler);
+
+// collects the frame that used this slot and opens the "frame" scope
+void gpu_profiler_begin_frame(GpuProfiler* profiler);
+void gpu_profiler_end_frame(GpuProfiler* profiler);
+
+void gpu_profiler_push(GpuProfiler* profiler, const char* name);
+void gpu_profiler_pop(GpuProfiler* profiler);
+
+// stalls until the GPU is done, then publishes the partial window if any
+void gpu_profiler_flush(GpuProfiler* profiler);
+
+// last complete window, in first use order (parents before children)
+const GpuScopeStats* gpu_profiler_results(const GpuProfiler* profiler, int* count);
+void gpu_profiler_print(const GpuProfiler* profiler);
+// scope,depth,calls,gpu_avg_ms,gpu_max_ms,cpu_avg_ms,cpu_max_ms; returns 0 on
+// success, -1 when there are no results or the file can't be written
+int gpu_profiler_write_csv(const GpuProfiler* profiler, const char* path);
+
+#endif // GPU_PROFILER_H
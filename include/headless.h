@@ -0,0 +1,27 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+/*
+    Offscreen rendering without a window or a display. The context is created
+    with EGL on the surfaceless platform (Mesa's llvmpipe works on machines with
+    no GPU) and every frame is rendered into a framebuffer object instead of a
+    window back buffer.
+*/
+
+typedef struct {
+    void* display;          // EGLDisplay
+    void* context;          // EGLContext
+    unsigned int FBO;
+    unsigned int color_RBO;
+    int width;
+    int height;
+} Headless;
+
+// creates the context, loads GLAD and binds the offscreen framebuffer.
+// returns 0 on success, -1 on failure
+int headless_create(Headless* headless, int width, int height);
+// the next headless_create asks for a debug context (see gl_debug.h)
+void headless_set_debug(int debug);
+void headless_destroy(Headless* headless);
+
+#endif // HEADLESS_H
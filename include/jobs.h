@@ -0,0 +1,122 @@
+#ifndef JOBS_H
+#define JOBS_H
+#include <pthread.h>
+#include <stdatomic.h>
+
+/*
+    Work-stealing job system for per-frame CPU work (scene update, culling,
+    sorting, decoding) so the GL thread only has to submit.
+
+    Each worker owns a Chase-Lev deque: it pushes and pops jobs at the
+    bottom, idle workers steal from the top of a random victim. The thread
+    that calls job_system_init is worker 0; it runs jobs whenever it waits
+    in job_wait or job_parallel_for. Jobs can only be submitted from worker
+    threads (including worker 0), anywhere else they run inline.
+
+    With JOB_SUBMIT_ONLY the calling thread is not a worker: every worker
+    is a thread of its own, and the caller pushes into a deque of its own
+    that the workers steal from (checked right after their own). It never
+    runs a job: job_wait and job_parallel_for block until the workers are
+    done, and a full deque or job ring makes it wait for room.
+
+    A JobCounter counts unfinished jobs. job_wait helps until it reaches
+    zero; job_run_after queues a job that only starts once another counter
+    reaches zero. Counters must be zero-initialized (JOB_COUNTER_INIT).
+
+    Jobs come from a per-worker ring of JOB_POOL_SIZE entries, so a thread
+    can have at most that many jobs in flight. When a deque is full, or the
+    next ring entry still holds a queued or deferred job, the job runs
+    immediately on the submitting worker.
+*/
+
+#define JOB_MAX_WORKERS 64
+#define JOB_DEQUE_SIZE 4096 // power of two
+#define JOB_POOL_SIZE 4096
+#define JOB_PARALLEL_MAX_CHUNKS 1024
+
+// job_system_init flags
+#define JOB_SUBMIT_ONLY 1 // the calling thread only submits and waits
+
+typedef void (*JobFunction)(void* data);
+// runs [first, end) of a job_parallel_for range
+typedef void (*JobRangeFunction)(void* data, long first, long end);
+
+typedef struct Job Job;
+
+typedef struct {
+    atomic_long pending;
+    atomic_flag lock;     // guards dependents
+    Job* dependents;      // queued by job_run_after until pending is zero
+} JobCounter;
+
+#define JOB_COUNTER_INIT { 0, ATOMIC_FLAG_INIT, NULL }
+
+struct Job {
+    JobFunction function;
+    void* data;
+    JobCounter* counter;
+    Job* next; // in a JobCounter dependents list
+    atomic_int live; // pool entry queued or deferred, not started yet
+};
+
+typedef struct {
+    atomic_long top;
+    atomic_long bottom;
+    _Atomic(Job*) jobs[JOB_DEQUE_SIZE];
+} JobDeque;
+
+typedef struct {
+    unsigned long jobs;   // jobs run by this worker
+    unsigned long steals; // of those, taken from another worker
+    double busy_ms;       // time spent inside jobs
+    double utilization;   // busy_ms over the time since the last reset
+} JobWorkerStats;
+
+typedef struct JobSystem JobSystem;
+
+typedef struct {
+    JobSystem* system;
+    int index;
+    pthread_t thread;
+    JobDeque deque;
+    Job pool[JOB_POOL_SIZE];
+    unsigned int pool_next;
+    unsigned int random;
+    // stats, written by the worker only
+    atomic_ulong jobs;
+    atomic_ulong steals;
+    atomic_ulong busy_ns;
+} JobWorker;
+
+struct JobSystem {
+    JobWorker* workers;
+    int worker_count;
+    JobWorker* submitter; // the calling thread with JOB_SUBMIT_ONLY, NULL otherwise
+    atomic_int running;
+    atomic_long queued;   // jobs sitting in deques
+    atomic_int sleeping;  // workers parked on wake
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;
+    double stats_start_ms;
+};
+
+// worker_count includes the calling thread unless flags has JOB_SUBMIT_ONLY,
+// 0 uses one worker per online core. returns 0 on success, -1 on failure
+int job_system_init(JobSystem* system, int worker_count, int flags);
+void job_system_shutdown(JobSystem* system);
+
+void job_run(JobSystem* system, JobFunction function, void* data, JobCounter* counter);
+// counter (may be NULL) is incremented now, the job is queued once dependency reaches zero
+void job_run_after(JobSystem* system, JobCounter* dependency, JobFunction function, void* data, JobCounter* counter);
+// runs other jobs until counter reaches zero (blocks on a submit-only thread)
+void job_wait(JobSystem* system, JobCounter* counter);
+// splits [0, count) into chunks of at most grain items and waits for all of them.
+// grain is raised when needed so one call never queues more than JOB_PARALLEL_MAX_CHUNKS jobs
+void job_parallel_for(JobSystem* system, long count, long grain, JobRangeFunction function, void* data);
+
+// index of the calling thread, -1 outside the system and on a submit-only thread
+int job_worker_index(void);
+JobWorkerStats job_worker_stats(JobSystem* system, int worker);
+void job_system_reset_stats(JobSystem* system);
+
+#endif // JOBS_H
@@ -0,0 +1,55 @@
+#ifndef MESH_OPTIMIZE_H
+#define MESH_OPTIMIZE_H
+
+/*
+    Load-time optimizations for indexed triangle meshes, run before the data
+    is handed to figure_init:
+
+    1. mesh_optimize_vertex_cache - Tipsify (Sander, Nehab, Barczak 2007)
+       reorders triangles so the post-transform vertex cache hits more often.
+    2. mesh_optimize_overdraw - sorts the clusters Tipsify produced so the
+       ones facing outwards are drawn first, which lets early depth testing
+       reject more of what is behind them.
+    3. mesh_optimize_vertex_fetch - renumbers vertices in first-use order so
+       vertex fetches walk memory linearly.
+
+    ACMR is the average number of vertex shader runs per triangle (0.5 is
+    the ideal for large regular meshes, 3 the worst), ATVR the same per
+    unique vertex (1 is ideal).
+*/
+
+#define MESH_CACHE_SIZE 16
+
+typedef struct {
+    float acmr;
+    float atvr;
+} MeshCacheStats;
+
+// simulated FIFO post-transform cache of cache_size entries, zeros when out of memory
+MeshCacheStats mesh_analyze_vertex_cache(const unsigned int* indices, int index_count,
+                                         int vertex_count, int cache_size);
+
+// reorders triangles in place. clusters (may be NULL) receives the index of
+// the first triangle of each cluster, capacity index_count / 3 + 1; returns
+// the number of clusters, -1 with indices unchanged when out of memory
+int mesh_optimize_vertex_cache(unsigned int* indices, int index_count, int vertex_count,
+                               int cache_size, int* clusters);
+
+// reorders the clusters found by mesh_optimize_vertex_cache in place,
+// returns 0 or -1 with indices unchanged
+int mesh_optimize_overdraw(unsigned int* indices, int index_count,
+                           const float* vertices, int vertex_stride,
+                           const int* clusters, int cluster_count);
+
+// reorders vertices (vertex_stride floats each) and remaps indices in place,
+// unused vertices are dropped. returns the new vertex count, -1 with the
+// mesh unchanged when out of memory
+int mesh_optimize_vertex_fetch(float* vertices, int vertex_stride, int vertex_count,
+                               unsigned int* indices, int index_count);
+
+// all three steps with MESH_CACHE_SIZE, returns the new vertex count or -1
+// with the mesh unchanged
+int mesh_optimize(float* vertices, int vertex_stride, int vertex_count,
+                  unsigned int* indices, int index_count);
+
+#endif // MESH_OPTIMIZE_H
@@ -0,0 +1,49 @@
+#ifndef SCENE_H
+#define SCENE_H
+#include "shader.h"
+#include "shader_reload.h"
+#include "figure.h"
+#include "cull.h"
+#include "gpu_profiler.h"
+
+/*
+    The triangle drawn by the program, as a figure with one instance per
+    copy (just one for now) and the model shader. Shared by the windowed loop
+    in main.c and the headless benchmark so both render exactly the same
+    thing.
+
+    Every instance has a bounding sphere. scene_cull keeps the instances
+    inside the frustum and scene_draw only draws those; until the first
+    scene_cull every instance is drawn.
+
+    After scene_profile, scene_draw reports "clear" and "draw" scopes to the
+    GpuProfiler.
+*/
+
+typedef struct {
+    Shader model_shader;
+    Figure figure;
+    FigureInstance* instances;
+    int instance_count;
+    int instance_capacity;
+    CullSpheres bounds;                // one per instance, same order
+    unsigned int* visible;             // indices left by the last scene_cull
+    FigureInstance* visible_instances; // what the next scene_draw uploads
+    int visible_count;
+    int visible_dirty;
+    GpuProfiler* profiler;             // NULL unless scene_profile was called
+} Scene;
+
+// returns 0 on success, -1 when the shaders could not be loaded
+int scene_init(Scene* scene);
+// returns the instance index, -1 when out of memory
+int scene_add_instance(Scene* scene, const FigureInstance* instance);
+// hot reload the scene shaders while the program runs
+int scene_watch(Scene* scene, ShaderWatcher* watcher);
+// profiler may be NULL to stop reporting
+void scene_profile(Scene* scene, GpuProfiler* profiler);
+void scene_cull(Scene* scene, const Frustum* frustum);
+void scene_draw(Scene* scene);
+void scene_destroy(Scene* scene);
+
+#endif // SCENE_H
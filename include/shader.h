@@ -3,16 +3,64 @@
 #include <glad/glad.h>
 #include <string.h>
 
+// a uniform location resolved once, -1 when the uniform is not active
+typedef int UniformHandle;
+
+typedef struct {
+    unsigned int hash; // FNV-1a of the name, 0 marks an empty slot
+    int location;
+    unsigned int name;   // offset into uniform_names, not terminated for "name" of "name[0]"
+    unsigned int length;
+} ShaderUniform;
+
 typedef struct {
     unsigned int ID;
+    // active uniforms introspected after linking, open addressing table
+    ShaderUniform* uniforms;
+    unsigned int uniform_mask; // table size - 1
+    char* uniform_names;       // every active uniform name, back to back
 } Shader;
 
+// a program whose compile and link were submitted but not checked yet
+typedef struct {
+    unsigned int program;
+    unsigned int vertex;   // 0 when the program came from the binary cache
+    unsigned int fragment;
+    unsigned long long cache_key;
+    double start_ms;
+} PendingShader;
+
+// returns a Shader with ID 0 when a source file cannot be read
 Shader create_shader(const char* vertex_path, const char* fragment_path);
+
+// submit compiles and link without waiting, GL_KHR_parallel_shader_compile
+// lets the driver run them on its own threads. Sources need no terminator.
+PendingShader shader_create_async(const char* vertex_path, const char* fragment_path);
+PendingShader shader_compile_async(const char* vertex_code, size_t vertex_length,
+                                   const char* fragment_code, size_t fragment_length);
+// 1 when shader_wait will not block (always 1 without the extension)
+int shader_poll(PendingShader* pending);
+Shader shader_wait(PendingShader* pending);
+void shader_destroy(Shader* shader);
 void shader_use(Shader* shader);
 
 void shader_set_int(Shader* shader, const char* name, int value);
 void shader_set_float(Shader* shader, const char* name, float value);
 void shader_set_bool(Shader* shader, const char* name, int value);
+void shader_set_vec3(Shader* shader, const char* name, float x, float y, float z);
+void shader_set_vec4(Shader* shader, const char* name, float x, float y, float z, float w);
+// 16 floats, column-major (vecmath.h Mat4)
+void shader_set_mat4(Shader* shader, const char* name, const float* matrix);
+
+// per-frame code resolves handles once and never touches strings again
+UniformHandle shader_uniform_handle(Shader* shader, const char* name);
+void shader_set_int_h(Shader* shader, UniformHandle handle, int value);
+void shader_set_float_h(Shader* shader, UniformHandle handle, float value);
+void shader_set_bool_h(Shader* shader, UniformHandle handle, int value);
+void shader_set_vec3_h(Shader* shader, UniformHandle handle, float x, float y, float z);
+void shader_set_vec4_h(Shader* shader, UniformHandle handle, float x, float y, float z, float w);
+void shader_set_mat4_h(Shader* shader, UniformHandle handle, const float* matrix);
+
 void check_compile_errors(unsigned int shader, const char* type);
 
 #endif // SHADER_H
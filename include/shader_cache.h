@@ -0,0 +1,37 @@
+#ifndef SHADER_CACHE_H
+#define SHADER_CACHE_H
+#include <stddef.h>
+
+/*
+    On-disk cache of linked program binaries (glGetProgramBinary /
+    glProgramBinary, GL 4.1). Entries are keyed by a hash of the shader sources
+    and the driver vendor, renderer and version strings, so a driver update
+    simply misses. A binary the driver rejects is treated as a miss and the
+    program is compiled from source again.
+
+    The directory is GSL_SHADER_CACHE_DIR from the environment, or the one
+    given at build time. An empty value disables the cache.
+*/
+
+typedef struct {
+    int hits;
+    int misses;
+    int rejected;    // binaries found on disk but refused by the driver
+    double load_ms;  // time spent loading binaries
+    double saved_ms; // compile time recorded for the hits minus load_ms
+} ShaderCacheStats;
+
+unsigned long long shader_cache_key(const char* vertex_code, size_t vertex_length,
+                                    const char* fragment_code, size_t fragment_length);
+
+// returns 1 when the program was loaded from the cache and linked
+int shader_cache_load(unsigned long long key, unsigned int program);
+// marks the program retrievable, call before glLinkProgram
+void shader_cache_prepare(unsigned int program);
+// compile_ms is stored with the binary to report the time saved on later hits
+void shader_cache_store(unsigned long long key, unsigned int program, double compile_ms);
+
+ShaderCacheStats shader_cache_stats(void);
+void shader_cache_report(void);
+
+#endif // SHADER_CACHE_H
@@ -0,0 +1,63 @@
+#ifndef SHADER_RELOAD_H
+#define SHADER_RELOAD_H
+#include <pthread.h>
+#include "shader.h"
+
+/*
+    Shader hot reload. A background thread waits on inotify for writes to the
+    watched source files and only flags them; the GL thread calls
+    shader_watcher_update() once per frame, which submits the rebuild with
+    shader_compile_async and polls it on later frames, so the compile never
+    stalls a frame. The new program replaces Shader.ID between frames only if
+    it links, otherwise the old one stays in use. shader_watcher_frame_end,
+    after the swap of every frame, closes the reload latency: from the file
+    write to the end of the first frame drawn with the new program.
+
+    UniformHandles belong to a program: re-resolve them when update reports
+    a swap.
+*/
+
+#define SHADER_WATCH_MAX 32
+#define SHADER_WATCH_PATH_MAX 512
+
+typedef struct {
+    Shader* shader;
+    char vertex_path[SHADER_WATCH_PATH_MAX];
+    char fragment_path[SHADER_WATCH_PATH_MAX];
+    int vertex_wd;
+    int fragment_wd;
+    const char* vertex_name;   // points into vertex_path
+    const char* fragment_name; // points into fragment_path
+
+    // written by the watcher thread, guarded by the watcher mutex
+    int dirty;
+    double changed_ms; // first write not yet picked up
+
+    // GL thread only
+    int compiling;
+    double compile_changed_ms;
+    int presented;             // swapped in, latency closed at the next frame end
+    PendingShader pending;
+} WatchedShader;
+
+typedef struct {
+    int inotify_fd;
+    int wake_fds[2]; // pipe used to stop the thread
+    pthread_t thread;
+    int running;
+    pthread_mutex_t mutex;
+    WatchedShader shaders[SHADER_WATCH_MAX];
+    int count;
+    double last_latency_ms; // write to the end of the first frame using the program
+} ShaderWatcher;
+
+// returns 0 on success, -1 when inotify or the thread are not available
+int shader_watcher_start(ShaderWatcher* watcher);
+int shader_watch(ShaderWatcher* watcher, Shader* shader, const char* vertex_path, const char* fragment_path);
+// GL thread, at a frame boundary. returns how many programs were swapped
+int shader_watcher_update(ShaderWatcher* watcher);
+// GL thread, after the swap. returns how many reloads reached the screen
+int shader_watcher_frame_end(ShaderWatcher* watcher);
+void shader_watcher_stop(ShaderWatcher* watcher);
+
+#endif // SHADER_RELOAD_H
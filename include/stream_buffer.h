@@ -0,0 +1,47 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+#include "glad/glad.h"
+
+/*
+    Ring buffer for data rewritten every frame (vertices, uniforms).
+
+    With GL 4.4 the buffer is created with glBufferStorage and mapped once,
+    persistent and coherent, split into STREAM_BUFFER_FRAMES regions. Each
+    frame writes into its own region; a fence placed when the frame ends is
+    waited on before the region is written again, so the CPU only blocks if
+    the GPU is more than STREAM_BUFFER_FRAMES - 1 frames behind.
+
+    On 3.3 contexts there is a single region that is orphaned with
+    glBufferData and mapped with glMapBufferRange every frame.
+
+    Per frame:
+        stream_buffer_begin(&stream);
+        ptr = stream_buffer_alloc(&stream, size, alignment, &offset);  // any number
+        stream_buffer_commit(&stream);   // before drawing from it
+        draws using offset...
+*/
+
+#define STREAM_BUFFER_FRAMES 3
+
+typedef struct {
+    GLuint buffer;
+    GLenum target;
+    GLsizeiptr frame_size;  // bytes each frame can allocate
+    int persistent;         // 0 on the orphaning fallback
+    char* mapped;           // current mapping, NULL between commit and begin on the fallback
+    GLsync fences[STREAM_BUFFER_FRAMES];
+    int frame;              // region being written
+    int started;
+    GLsizeiptr offset;      // write head inside the region
+    double stall_ms;        // total time spent waiting for the GPU
+} StreamBuffer;
+
+// allow_persistent = 0 forces the 3.3 path. returns 0 on success, -1 on failure
+int stream_buffer_init(StreamBuffer* stream, GLenum target, GLsizeiptr frame_size, int allow_persistent);
+void stream_buffer_begin(StreamBuffer* stream);
+// returns NULL when the frame is out of space, offset is relative to the buffer
+void* stream_buffer_alloc(StreamBuffer* stream, GLsizeiptr size, GLsizeiptr alignment, GLintptr* offset);
+void stream_buffer_commit(StreamBuffer* stream);
+void stream_buffer_destroy(StreamBuffer* stream);
+
+#endif // STREAM_BUFFER_H
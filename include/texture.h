@@ -0,0 +1,118 @@
+#ifndef TEXTURE_H
+#define TEXTURE_H
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "glad/glad.h"
+#include "jobs.h"
+
+/*
+    Asynchronous texture loading. texture_load returns a handle right away;
+    the image is decoded on the job system's workers and uploaded by
+    texture_loader_update, which the GL thread calls once a frame. Until the
+    texture is ready texture_get returns a placeholder (a grey and magenta
+    checker), so draws can use the handle from the first frame.
+
+    Uploads go through pixel buffer objects: the decoded pixels are copied
+    into an orphaned PBO and glTexSubImage2D reads from it, so the call
+    returns without waiting for the transfer. Mipmaps are generated on the
+    GPU right after. A fence per upload tells when the texture is complete;
+    only then does the handle resolve to it. At most
+    TEXTURE_UPLOAD_BUFFERS uploads are in flight, and each update uploads
+    up to upload_budget bytes (at least one texture), so a burst of loads
+    never turns into one long frame.
+
+    Decoding is throttled too: at most max_decoding images are queued,
+    decoding or waiting for upload at a time, which bounds the memory held
+    in decoded pixels. Images are PNG (libpng, GSL_HAS_PNG), decoded to
+    RGBA8 with the bottom row first as GL expects.
+
+    The loader is GL thread only, and that thread must be the one that
+    called job_system_init (best with JOB_SUBMIT_ONLY, so it never runs a
+    decode itself), otherwise the decodes run inline. A NULL job system, or
+    one whose only worker is the GL thread, decodes inline as well.
+*/
+
+#define TEXTURE_UPLOAD_BUFFERS 4
+
+typedef int TextureHandle; // -1 when the loader is full
+
+typedef enum {
+    TEXTURE_QUEUED,
+    TEXTURE_DECODING,
+    TEXTURE_DECODED,
+    TEXTURE_UPLOADING,
+    TEXTURE_READY,
+    TEXTURE_FAILED,
+} TextureState;
+
+typedef struct {
+    char* path;
+    atomic_int state;       // TextureState
+    unsigned char* pixels;  // from decode to upload
+    int width;
+    int height;
+    size_t file_bytes;
+    double decode_ms;
+    GLuint texture;
+    int counted;            // a failure already in the stats (GL thread)
+} TextureSlot;
+
+typedef struct {
+    GLuint buffer;
+    GLsync fence;           // NULL when free
+    int slot;
+} TextureUpload;
+
+typedef struct {
+    unsigned long requested;
+    unsigned long ready;
+    unsigned long failed;
+    uint64_t file_bytes;    // compressed, of the decoded images
+    uint64_t pixel_bytes;   // RGBA8 level 0, of the uploaded images
+    double decode_ms;       // summed over the workers
+    double upload_ms;       // GL thread time spent in texture_loader_update
+    double max_update_ms;
+} TextureLoaderStats;
+
+typedef struct {
+    JobSystem* jobs;
+    JobCounter decodes;
+    TextureSlot* slots;
+    int slot_count;
+    int capacity;
+    int next_decode;        // first slot not handed to a decode job yet
+    int next_upload;        // first slot not uploaded (or failed) yet
+    int in_flight;          // decoding or decoded, not uploaded
+    int max_decoding;
+    size_t upload_budget;   // bytes per texture_loader_update
+    TextureUpload uploads[TEXTURE_UPLOAD_BUFFERS];
+    GLuint placeholder;
+    TextureLoaderStats stats;
+} TextureLoader;
+
+// capacity: textures the loader can hold. max_decoding 0 uses two per worker,
+// upload_budget 0 uses 16 MB. returns 0 on success, -1 on failure
+int texture_loader_init(TextureLoader* loader, JobSystem* jobs, int capacity, int max_decoding, size_t upload_budget);
+// waits for the decodes in flight and deletes every texture
+void texture_loader_destroy(TextureLoader* loader);
+
+// the path is copied
+TextureHandle texture_load(TextureLoader* loader, const char* path);
+// once a frame: queues decodes, starts uploads, completes finished ones
+void texture_loader_update(TextureLoader* loader);
+// updates (and helps decode) until nothing is pending
+void texture_loader_finish(TextureLoader* loader);
+
+// the texture once ready, the placeholder before that and on failure
+GLuint texture_get(const TextureLoader* loader, TextureHandle handle);
+TextureState texture_state(const TextureLoader* loader, TextureHandle handle);
+// 1 when every requested texture is ready or failed
+int texture_loader_idle(const TextureLoader* loader);
+TextureLoaderStats texture_loader_stats(const TextureLoader* loader);
+
+// decodes a PNG file into RGBA8, bottom row first. free the result.
+// returns NULL on failure; file_bytes may be NULL
+unsigned char* texture_decode_png(const char* path, int* width, int* height, size_t* file_bytes);
+
+#endif // TEXTURE_H
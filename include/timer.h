@@ -0,0 +1,7 @@
+#ifndef TIMER_H
+#define TIMER_H
+
+// monotonic wall clock in milliseconds, only differences are meaningful
+double timer_now_ms(void);
+
+#endif // TIMER_H
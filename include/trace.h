@@ -0,0 +1,64 @@
+#ifndef TRACE_H
+#define TRACE_H
+#include <stdatomic.h>
+#include <stdint.h>
+
+/*
+    CPU scope profiler. TRACE_BEGIN("name") and TRACE_END() mark a zone on
+    the calling thread; zones nest and must be closed on the same thread.
+    Each thread writes its events into its own ring of TRACE_RING_SIZE
+    entries (allocated on its first event), so recording takes no lock: a
+    timestamp, a store and a release of the write index. When a ring wraps
+    the oldest events are overwritten. Rings are never freed; when a thread
+    exits its ring goes to the next new thread, and the old events with it.
+
+    trace_write_chrome dumps every ring as Chrome trace event JSON, which
+    chrome://tracing and ui.perfetto.dev both open. Zones still open at that
+    point end at the last recorded event. Threads keep recording while it
+    runs; events written during the dump may be missing or torn, so dump at
+    shutdown or when the threads are idle.
+
+    Nothing is recorded until trace_set_enabled(1) (gsl --trace); before
+    that a zone costs one relaxed load and no ring is allocated. The macros
+    only exist with GSL_TRACE defined (the GSL_TRACE CMake option),
+    otherwise they compile to nothing. Names are not copied, pass string
+    literals.
+*/
+
+#define TRACE_RING_SIZE 65536 // events per thread, power of two
+
+typedef struct {
+    uint64_t time_ns;
+    const char* name;   // NULL for an end
+} TraceEvent;
+
+typedef struct TraceRing {
+    TraceEvent events[TRACE_RING_SIZE];
+    atomic_ulong written; // total events, the ring holds the last TRACE_RING_SIZE
+    const char* thread_name;
+    int thread_id;
+    atomic_int owned;       // 0 once the thread exited, the ring is free to take
+    struct TraceRing* next; // list of every ring, pushed lock-free
+} TraceRing;
+
+void trace_set_enabled(int enabled);
+int trace_enabled(void);
+
+void trace_begin(const char* name);
+void trace_end(void);
+// names the calling thread in the trace, also when recording starts later
+void trace_thread_name(const char* name);
+// returns 0 on success, -1 when the file could not be written
+int trace_write_chrome(const char* path);
+
+#ifdef GSL_TRACE
+#define TRACE_BEGIN(name) trace_begin(name)
+#define TRACE_END() trace_end()
+#define TRACE_THREAD_NAME(name) trace_thread_name(name)
+#else
+#define TRACE_BEGIN(name) ((void)0)
+#define TRACE_END() ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,87 @@
+#ifndef VECMATH_H
+#define VECMATH_H
+
+/*
+    Vectors, quaternions and 4x4 matrices for the CPU side of the renderer.
+
+    Matrices are column-major (m[column * 4 + row]), the layout
+    glUniformMatrix4fv expects with transpose = GL_FALSE. Points are
+    column vectors: mat4_mul(a, b) applies b first.
+
+    The *_batch functions run SSE or AVX2+FMA kernels picked at runtime
+    (CPUID through __builtin_cpu_supports), with a scalar fallback.
+    vecmath_set_isa can force a lower level to compare them.
+*/
+
+typedef struct {
+    float x, y, z;
+} Vec3;
+
+typedef struct {
+    float x, y, z, w;
+} Vec4;
+
+typedef struct {
+    float x, y, z, w; // w is the real part
+} Quat;
+
+typedef struct {
+    float m[16];
+} Mat4;
+
+// -- Vectors -- //
+Vec3 vec3_add(Vec3 a, Vec3 b);
+Vec3 vec3_sub(Vec3 a, Vec3 b);
+Vec3 vec3_scale(Vec3 v, float s);
+float vec3_dot(Vec3 a, Vec3 b);
+Vec3 vec3_cross(Vec3 a, Vec3 b);
+float vec3_length(Vec3 v);
+Vec3 vec3_normalize(Vec3 v);
+
+// -- Quaternions -- //
+Quat quat_identity(void);
+// axis does not need to be normalized
+Quat quat_from_axis_angle(Vec3 axis, float radians);
+// rotation b followed by rotation a
+Quat quat_mul(Quat a, Quat b);
+Quat quat_normalize(Quat q);
+Vec3 quat_rotate(Quat q, Vec3 v);
+
+// -- Matrices -- //
+Mat4 mat4_identity(void);
+Mat4 mat4_mul(const Mat4* a, const Mat4* b);
+Vec4 mat4_mul_vec4(const Mat4* m, Vec4 v);
+Mat4 mat4_translation(Vec3 t);
+Mat4 mat4_scaling(Vec3 s);
+// q must be normalized
+Mat4 mat4_from_quat(Quat q);
+// translate * rotate * scale
+Mat4 mat4_from_trs(Vec3 t, Quat r, Vec3 s);
+Mat4 mat4_perspective(float fovy_radians, float aspect, float near, float far);
+Mat4 mat4_ortho(float left, float right, float bottom, float top, float near, float far);
+Mat4 mat4_look_at(Vec3 eye, Vec3 center, Vec3 up);
+
+// -- Batches -- //
+// out[i] = m * (points[i], 1)
+void mat4_transform_points_batch(const Mat4* m, const Vec3* points, Vec4* out, long count);
+// out[i] = mat4_from_trs(translations[i], rotations[i], scales[i])
+void mat4_from_trs_batch(const Vec3* translations, const Quat* rotations, const Vec3* scales, Mat4* out, long count);
+// out[i] = a * b[i], e.g. view-projection times every model matrix
+void mat4_mul_batch(const Mat4* a, const Mat4* b, Mat4* out, long count);
+
+// -- ISA -- //
+typedef enum {
+    VECMATH_SCALAR,
+    VECMATH_SSE,
+    VECMATH_AVX2,
+} VecmathIsa;
+
+// best level this CPU runs
+VecmathIsa vecmath_isa_supported(void);
+// level the batch functions use now
+VecmathIsa vecmath_isa(void);
+// clamped to vecmath_isa_supported(), returns the level actually selected
+VecmathIsa vecmath_set_isa(VecmathIsa isa);
+const char* vecmath_isa_name(VecmathIsa isa);
+
+#endif // VECMATH_H
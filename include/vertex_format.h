@@ -0,0 +1,54 @@
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+#include "glad/glad.h"
+
+/*
+    Declarative vertex layouts. A VertexFormat lists the attributes and how
+    each one is stored on the GPU; from that it computes offsets and stride,
+    emits the glVertexAttribPointer calls and packs float source data into
+    the interleaved buffer.
+
+    Storage types and their cost per vertex:
+        VERTEX_FLOAT3             12 bytes  anything
+        VERTEX_HALF4               8 bytes  positions (w = 1), F16C when available
+        VERTEX_SNORM16X4           8 bytes  positions in [-1, 1] (w = 1)
+        VERTEX_UNORM8X4            4 bytes  colors in [0, 1] (alpha = 1)
+        VERTEX_SNORM_2_10_10_10    4 bytes  normals in [-1, 1]
+
+    Sources are 3 floats per vertex for every attribute.
+*/
+
+#define VERTEX_FORMAT_MAX_ATTRIBS 8
+
+typedef enum {
+    VERTEX_FLOAT3,
+    VERTEX_HALF4,
+    VERTEX_SNORM16X4,
+    VERTEX_UNORM8X4,
+    VERTEX_SNORM_2_10_10_10,
+} VertexStorage;
+
+typedef struct {
+    unsigned int location;
+    VertexStorage storage;
+} VertexAttrib;
+
+typedef struct {
+    VertexAttrib attribs[VERTEX_FORMAT_MAX_ATTRIBS];
+    int offsets[VERTEX_FORMAT_MAX_ATTRIBS];
+    int count;
+    int stride;
+} VertexFormat;
+
+void vertex_format_init(VertexFormat* format, const VertexAttrib* attribs, int count);
+// sets and enables the attributes of the bound VAO for the bound GL_ARRAY_BUFFER
+void vertex_format_apply(const VertexFormat* format, GLintptr base);
+// sources[i] holds 3 floats per vertex for attribs[i]; dst needs stride * vertex_count bytes
+void vertex_format_pack(const VertexFormat* format, void* dst, const float* const* sources, long vertex_count);
+// same result, never uses SIMD (reference and benchmark baseline)
+void vertex_format_pack_scalar(const VertexFormat* format, void* dst, const float* const* sources, long vertex_count);
+
+// "f16c", "sse2" or "scalar": what vertex_format_pack uses on this CPU
+const char* vertex_format_simd_level(void);
+
+#endif // VERTEX_FORMAT_H
@@ -3,9 +3,18 @@
 
 #include "glad/glad.h"
 #include <GLFW/glfw3.h>
+#include "event_queue.h"
 
-void process_input(GLFWwindow* window);
+/*
+    Input and window state changes are not handled in the GLFW callbacks:
+    they are timestamped and pushed into an EventQueue (main thread), and
+    the thread that owns the context applies them with window_handle_event.
+*/
 
-void framebuffer_size_callback(GLFWwindow* window, int w, int h);
+// installs the key, mouse, cursor and framebuffer size callbacks, uses the window user pointer
+void window_forward_events(GLFWwindow* window, EventQueue* events);
+
+// runs on the context thread: escape closes the window, resizes update the viewport
+void window_handle_event(GLFWwindow* window, const WindowEvent* event);
 
 #endif // WINDOW_H
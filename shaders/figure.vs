@@ -0,0 +1,15 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+
+// same transform as instanced.vs, one draw per figure
+uniform vec4 offset_scale; // xyz offset, w scale
+uniform vec3 tint;
+
+out vec3 ourColor;
+
+void main()
+{
+    gl_Position = vec4(aPos * offset_scale.w + offset_scale.xyz, 1.0);
+    ourColor = aColor * tint;
+}
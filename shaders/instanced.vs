@@ -0,0 +1,14 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+// per instance (glVertexAttribDivisor = 1)
+layout (location = 2) in vec4 aOffsetScale; // xyz offset, w scale
+layout (location = 3) in vec3 aTint;
+
+out vec3 ourColor;
+
+void main()
+{
+    gl_Position = vec4(aPos * aOffsetScale.w + aOffsetScale.xyz, 1.0);
+    ourColor = aColor * aTint;
+}
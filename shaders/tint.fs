@@ -0,0 +1,14 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 ourColor;
+
+uniform float brightness;
+uniform float alpha;
+uniform bool invert;
+
+void main()
+{
+    vec3 color = invert ? vec3(1.0) - ourColor : ourColor;
+    FragColor = vec4(color * brightness, alpha);
+}
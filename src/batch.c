@@ -0,0 +1,123 @@
+#include "batch.h"
+#include <stdlib.h>
+#include <string.h>
+#include "glad/glad.h"
+#include "gl_state.h"
+
+void batch_init(Batch* batch) {
+    memset(batch, 0, sizeof(*batch));
+
+    glGenVertexArrays(1, &batch->VAO);
+    glGenBuffers(1, &batch->VBO);
+
+    gl_state_bind_vertex_array(batch->VAO);
+    gl_state_bind_buffer(GL_ARRAY_BUFFER, batch->VBO);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(BatchVertex), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(BatchVertex), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+}
+
+static BatchBucket* find_bucket(Batch* batch, Shader* shader) {
+    if (batch->bucket_count > 0 && batch->buckets[batch->last_bucket].shader == shader) {
+        return &batch->buckets[batch->last_bucket];
+    }
+    for (int i = 0; i < batch->bucket_count; i++) {
+        if (batch->buckets[i].shader == shader) {
+            batch->last_bucket = i;
+            return &batch->buckets[i];
+        }
+    }
+
+    if (batch->bucket_count == BATCH_MAX_SHADERS) {
+        // out of buckets, draw what we have and start over
+        batch_flush(batch);
+        for (int i = 0; i < BATCH_MAX_SHADERS; i++) {
+            batch->buckets[i].shader = NULL;
+        }
+        batch->bucket_count = 0;
+    }
+
+    // buckets stay assigned across flushes, so this only runs for new shaders
+    int index = batch->bucket_count;
+    batch->buckets[index].shader = shader;
+    batch->bucket_count++;
+    batch->last_bucket = index;
+    return &batch->buckets[index];
+}
+
+int batch_push(Batch* batch, Shader* shader, const BatchVertex* vertices, int vertex_count) {
+    BatchBucket* bucket = find_bucket(batch, shader);
+
+    if (bucket->count + vertex_count > bucket->capacity) {
+        int capacity = bucket->capacity ? bucket->capacity : 1024;
+        while (capacity < bucket->count + vertex_count) {
+            capacity *= 2;
+        }
+        BatchVertex* grown = (BatchVertex*)realloc(bucket->vertices, capacity * sizeof(BatchVertex));
+        if (!grown) {
+            return -1;
+        }
+        bucket->vertices = grown;
+        bucket->capacity = capacity;
+    }
+
+    memcpy(bucket->vertices + bucket->count, vertices, vertex_count * sizeof(BatchVertex));
+    bucket->count += vertex_count;
+    return 0;
+}
+
+void batch_flush(Batch* batch) {
+    long total = 0;
+    for (int i = 0; i < batch->bucket_count; i++) {
+        total += batch->buckets[i].count;
+    }
+
+    batch->vertex_count += (int)total;
+    if (total == 0) {
+        return;
+    }
+
+    gl_state_bind_vertex_array(batch->VAO);
+    gl_state_bind_buffer(GL_ARRAY_BUFFER, batch->VBO);
+
+    // orphan the previous storage so we never wait for the GPU to finish with it
+    long bytes = total * (long)sizeof(BatchVertex);
+    if (bytes > batch->buffer_size) {
+        batch->buffer_size = bytes;
+    }
+    glBufferData(GL_ARRAY_BUFFER, batch->buffer_size, NULL, GL_STREAM_DRAW);
+
+    long first = 0;
+    for (int i = 0; i < batch->bucket_count; i++) {
+        BatchBucket* bucket = &batch->buckets[i];
+        if (bucket->count == 0) {
+            continue;
+        }
+
+        glBufferSubData(GL_ARRAY_BUFFER, first * (long)sizeof(BatchVertex),
+                        bucket->count * (long)sizeof(BatchVertex), bucket->vertices);
+        shader_use(bucket->shader);
+        glDrawArrays(GL_TRIANGLES, (GLint)first, bucket->count);
+
+        first += bucket->count;
+        bucket->count = 0;
+        batch->draw_calls++;
+    }
+}
+
+void batch_reset_stats(Batch* batch) {
+    batch->draw_calls = 0;
+    batch->vertex_count = 0;
+}
+
+void batch_destroy(Batch* batch) {
+    for (int i = 0; i < BATCH_MAX_SHADERS; i++) {
+        free(batch->buckets[i].vertices);
+    }
+    gl_state_delete_vertex_arrays(1, &batch->VAO);
+    gl_state_delete_buffers(1, &batch->VBO);
+    memset(batch, 0, sizeof(*batch));
+}
@@ -0,0 +1,209 @@
+#include "command_buffer.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gl_state.h"
+
+typedef enum {
+    COMMAND_USE_PROGRAM,
+    COMMAND_BIND_VERTEX_ARRAY,
+    COMMAND_UNIFORM_1I,
+    COMMAND_UNIFORM_1F,
+    COMMAND_UNIFORM_3F,
+    COMMAND_UNIFORM_4F,
+    COMMAND_UNIFORM_MAT4,
+    COMMAND_DRAW_ARRAYS,
+    COMMAND_DRAW_ELEMENTS,
+    COMMAND_DRAW_ARRAYS_INSTANCED,
+} CommandType;
+
+typedef struct {
+    uint16_t type;
+    uint16_t size; // payload bytes after the header
+} CommandHeader;
+
+// -- Payloads -- //
+typedef struct { GLuint name; } NameCommand;
+typedef struct { GLint location; GLint value; } Uniform1iCommand;
+typedef struct { GLint location; GLfloat value; } Uniform1fCommand;
+typedef struct { GLint location; GLfloat v[3]; } Uniform3fCommand;
+typedef struct { GLint location; GLfloat v[4]; } Uniform4fCommand;
+typedef struct { GLint location; GLfloat m[16]; } UniformMat4Command;
+typedef struct { GLenum mode; GLint first; GLsizei count; } DrawArraysCommand;
+typedef struct { GLenum mode; GLsizei count; GLenum type; GLuint offset; } DrawElementsCommand;
+typedef struct { GLenum mode; GLint first; GLsizei count; GLsizei instances; } DrawArraysInstancedCommand;
+
+void command_buffer_init(CommandBuffer* buffer, size_t capacity) {
+    buffer->data = capacity ? (char*)malloc(capacity) : NULL;
+    buffer->size = 0;
+    buffer->capacity = buffer->data ? capacity : 0;
+    buffer->failed = 0;
+}
+
+void command_buffer_reset(CommandBuffer* buffer) {
+    buffer->size = 0;
+    buffer->failed = 0;
+}
+
+void command_buffer_free(CommandBuffer* buffer) {
+    free(buffer->data);
+    buffer->data = NULL;
+    buffer->size = 0;
+    buffer->capacity = 0;
+}
+
+// room for one command, NULL (and failed set) when out of memory
+static void* push(CommandBuffer* buffer, CommandType type, size_t size) {
+    size_t needed = buffer->size + sizeof(CommandHeader) + size;
+    if (buffer->failed) {
+        return NULL;
+    }
+    if (needed > buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity * 2 : 4096;
+        while (capacity < needed) {
+            capacity *= 2;
+        }
+        char* data = (char*)realloc(buffer->data, capacity);
+        if (!data) {
+            printf("ERROR::COMMAND_BUFFER::OUT_OF_MEMORY\n");
+            buffer->failed = 1;
+            return NULL;
+        }
+        buffer->data = data;
+        buffer->capacity = capacity;
+    }
+
+    CommandHeader header = { (uint16_t)type, (uint16_t)size };
+    memcpy(buffer->data + buffer->size, &header, sizeof(header));
+    void* payload = buffer->data + buffer->size + sizeof(header);
+    buffer->size = needed;
+    return payload;
+}
+
+#define RECORD(buffer, type, Payload, ...)                         \
+    do {                                                          \
+        Payload command = __VA_ARGS__;                            \
+        void* payload = push(buffer, type, sizeof(Payload));      \
+        if (payload) {                                            \
+            memcpy(payload, &command, sizeof(Payload));           \
+        }                                                         \
+    } while (0)
+
+// -- Recording -- //
+void command_buffer_use_program(CommandBuffer* buffer, GLuint program) {
+    RECORD(buffer, COMMAND_USE_PROGRAM, NameCommand, { program });
+}
+
+void command_buffer_bind_vertex_array(CommandBuffer* buffer, GLuint vertex_array) {
+    RECORD(buffer, COMMAND_BIND_VERTEX_ARRAY, NameCommand, { vertex_array });
+}
+
+void command_buffer_uniform_1i(CommandBuffer* buffer, GLint location, GLint value) {
+    RECORD(buffer, COMMAND_UNIFORM_1I, Uniform1iCommand, { location, value });
+}
+
+void command_buffer_uniform_1f(CommandBuffer* buffer, GLint location, GLfloat value) {
+    RECORD(buffer, COMMAND_UNIFORM_1F, Uniform1fCommand, { location, value });
+}
+
+void command_buffer_uniform_3f(CommandBuffer* buffer, GLint location, GLfloat x, GLfloat y, GLfloat z) {
+    RECORD(buffer, COMMAND_UNIFORM_3F, Uniform3fCommand, { location, { x, y, z } });
+}
+
+void command_buffer_uniform_4f(CommandBuffer* buffer, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    RECORD(buffer, COMMAND_UNIFORM_4F, Uniform4fCommand, { location, { x, y, z, w } });
+}
+
+void command_buffer_uniform_mat4(CommandBuffer* buffer, GLint location, const GLfloat* matrix) {
+    UniformMat4Command command;
+    command.location = location;
+    memcpy(command.m, matrix, sizeof(command.m));
+    void* payload = push(buffer, COMMAND_UNIFORM_MAT4, sizeof(command));
+    if (payload) {
+        memcpy(payload, &command, sizeof(command));
+    }
+}
+
+void command_buffer_draw_arrays(CommandBuffer* buffer, GLenum mode, GLint first, GLsizei count) {
+    RECORD(buffer, COMMAND_DRAW_ARRAYS, DrawArraysCommand, { mode, first, count });
+}
+
+void command_buffer_draw_elements(CommandBuffer* buffer, GLenum mode, GLsizei count, GLenum type, size_t offset) {
+    RECORD(buffer, COMMAND_DRAW_ELEMENTS, DrawElementsCommand, { mode, count, type, (GLuint)offset });
+}
+
+void command_buffer_draw_arrays_instanced(CommandBuffer* buffer, GLenum mode, GLint first, GLsizei count, GLsizei instances) {
+    RECORD(buffer, COMMAND_DRAW_ARRAYS_INSTANCED, DrawArraysInstancedCommand, { mode, first, count, instances });
+}
+
+// -- Replay -- //
+size_t command_buffer_mark(const CommandBuffer* buffer) {
+    return buffer->size;
+}
+
+void command_buffer_replay(const CommandBuffer* buffer) {
+    command_buffer_replay_range(buffer, 0, buffer->size);
+}
+
+void command_buffer_replay_range(const CommandBuffer* buffer, size_t begin, size_t end) {
+    const char* cursor = buffer->data + begin;
+    const char* stop = buffer->data + end;
+
+    while (cursor < stop) {
+        CommandHeader header;
+        memcpy(&header, cursor, sizeof(header));
+        const char* payload = cursor + sizeof(header);
+        cursor = payload + header.size;
+
+        // every payload is a multiple of 4 bytes, so they stay 4-byte aligned
+        switch ((CommandType)header.type) {
+            case COMMAND_USE_PROGRAM:
+                gl_state_use_program(((const NameCommand*)payload)->name);
+                break;
+            case COMMAND_BIND_VERTEX_ARRAY:
+                gl_state_bind_vertex_array(((const NameCommand*)payload)->name);
+                break;
+            case COMMAND_UNIFORM_1I: {
+                const Uniform1iCommand* c = (const Uniform1iCommand*)payload;
+                glUniform1i(c->location, c->value);
+                break;
+            }
+            case COMMAND_UNIFORM_1F: {
+                const Uniform1fCommand* c = (const Uniform1fCommand*)payload;
+                glUniform1f(c->location, c->value);
+                break;
+            }
+            case COMMAND_UNIFORM_3F: {
+                const Uniform3fCommand* c = (const Uniform3fCommand*)payload;
+                glUniform3f(c->location, c->v[0], c->v[1], c->v[2]);
+                break;
+            }
+            case COMMAND_UNIFORM_4F: {
+                const Uniform4fCommand* c = (const Uniform4fCommand*)payload;
+                glUniform4f(c->location, c->v[0], c->v[1], c->v[2], c->v[3]);
+                break;
+            }
+            case COMMAND_UNIFORM_MAT4: {
+                const UniformMat4Command* c = (const UniformMat4Command*)payload;
+                glUniformMatrix4fv(c->location, 1, GL_FALSE, c->m);
+                break;
+            }
+            case COMMAND_DRAW_ARRAYS: {
+                const DrawArraysCommand* c = (const DrawArraysCommand*)payload;
+                glDrawArrays(c->mode, c->first, c->count);
+                break;
+            }
+            case COMMAND_DRAW_ELEMENTS: {
+                const DrawElementsCommand* c = (const DrawElementsCommand*)payload;
+                glDrawElements(c->mode, c->count, c->type, (const void*)(size_t)c->offset);
+                break;
+            }
+            case COMMAND_DRAW_ARRAYS_INSTANCED: {
+                const DrawArraysInstancedCommand* c = (const DrawArraysInstancedCommand*)payload;
+                glDrawArraysInstanced(c->mode, c->first, c->count, c->instances);
+                break;
+            }
+        }
+    }
+}
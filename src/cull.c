@@ -0,0 +1,314 @@
+#include "cull.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CULL_X86 1
+#include <immintrin.h>
+#endif
+
+// -- Frustum -- //
+void frustum_from_matrix(Frustum* frustum, const Mat4* view_projection) {
+    // Gribb/Hartmann: each plane is the last row plus or minus one of the others
+    const float* m = view_projection->m;
+    for (int p = 0; p < 6; p++) {
+        int row = p / 2;
+        float sign = (p % 2) ? -1.0f : 1.0f; // left, right, bottom, top, near, far
+        float* plane = frustum->planes[p];
+        for (int column = 0; column < 4; column++) {
+            plane[column] = m[column * 4 + 3] + sign * m[column * 4 + row];
+        }
+        float length = sqrtf(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        if (length > 0.0f) {
+            for (int i = 0; i < 4; i++) {
+                plane[i] /= length;
+            }
+        }
+    }
+}
+
+// -- Storage -- //
+static int grow(float** arrays, int array_count, long* capacity, long needed) {
+    if (needed <= *capacity) {
+        return 0;
+    }
+    long new_capacity = *capacity ? *capacity * 2 : 256;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+    for (int i = 0; i < array_count; i++) {
+        float* array = (float*)realloc(arrays[i], new_capacity * sizeof(float));
+        if (!array) {
+            return -1;
+        }
+        arrays[i] = array;
+    }
+    *capacity = new_capacity;
+    return 0;
+}
+
+long cull_spheres_push(CullSpheres* spheres, Vec3 center, float radius) {
+    float* arrays[4] = { spheres->x, spheres->y, spheres->z, spheres->radius };
+    int result = grow(arrays, 4, &spheres->capacity, spheres->count + 1);
+    spheres->x = arrays[0];
+    spheres->y = arrays[1];
+    spheres->z = arrays[2];
+    spheres->radius = arrays[3];
+    if (result != 0) {
+        return -1;
+    }
+
+    long i = spheres->count++;
+    spheres->x[i] = center.x;
+    spheres->y[i] = center.y;
+    spheres->z[i] = center.z;
+    spheres->radius[i] = radius;
+    return i;
+}
+
+void cull_spheres_clear(CullSpheres* spheres) {
+    spheres->count = 0;
+}
+
+void cull_spheres_free(CullSpheres* spheres) {
+    free(spheres->x);
+    free(spheres->y);
+    free(spheres->z);
+    free(spheres->radius);
+    memset(spheres, 0, sizeof(*spheres));
+}
+
+long cull_boxes_push(CullBoxes* boxes, Vec3 center, Vec3 extent) {
+    float* arrays[6] = { boxes->center_x, boxes->center_y, boxes->center_z,
+                         boxes->extent_x, boxes->extent_y, boxes->extent_z };
+    int result = grow(arrays, 6, &boxes->capacity, boxes->count + 1);
+    boxes->center_x = arrays[0];
+    boxes->center_y = arrays[1];
+    boxes->center_z = arrays[2];
+    boxes->extent_x = arrays[3];
+    boxes->extent_y = arrays[4];
+    boxes->extent_z = arrays[5];
+    if (result != 0) {
+        return -1;
+    }
+
+    long i = boxes->count++;
+    boxes->center_x[i] = center.x;
+    boxes->center_y[i] = center.y;
+    boxes->center_z[i] = center.z;
+    boxes->extent_x[i] = extent.x;
+    boxes->extent_y[i] = extent.y;
+    boxes->extent_z[i] = extent.z;
+    return i;
+}
+
+void cull_boxes_clear(CullBoxes* boxes) {
+    boxes->count = 0;
+}
+
+void cull_boxes_free(CullBoxes* boxes) {
+    free(boxes->center_x);
+    free(boxes->center_y);
+    free(boxes->center_z);
+    free(boxes->extent_x);
+    free(boxes->extent_y);
+    free(boxes->extent_z);
+    memset(boxes, 0, sizeof(*boxes));
+}
+
+// -- Scalar kernels -- //
+static long spheres_scalar(const Frustum* frustum, const CullSpheres* spheres, long first, long end,
+                           unsigned int* visible) {
+    long n = 0;
+    for (long i = first; i < end; i++) {
+        int inside = 1;
+        for (int p = 0; p < 6; p++) {
+            const float* plane = frustum->planes[p];
+            float d = plane[0] * spheres->x[i] + plane[1] * spheres->y[i] + plane[2] * spheres->z[i] + plane[3];
+            inside &= d + spheres->radius[i] >= 0.0f;
+        }
+        visible[n] = (unsigned int)i;
+        n += inside;
+    }
+    return n;
+}
+
+static long boxes_scalar(const Frustum* frustum, const CullBoxes* boxes, long first, long end,
+                         unsigned int* visible) {
+    long n = 0;
+    for (long i = first; i < end; i++) {
+        int inside = 1;
+        for (int p = 0; p < 6; p++) {
+            const float* plane = frustum->planes[p];
+            float d = plane[0] * boxes->center_x[i] + plane[1] * boxes->center_y[i] +
+                      plane[2] * boxes->center_z[i] + plane[3];
+            float r = fabsf(plane[0]) * boxes->extent_x[i] + fabsf(plane[1]) * boxes->extent_y[i] +
+                      fabsf(plane[2]) * boxes->extent_z[i];
+            inside &= d + r >= 0.0f;
+        }
+        visible[n] = (unsigned int)i;
+        n += inside;
+    }
+    return n;
+}
+
+// every lane's index is written, only the visible ones advance the output
+static inline long compact(unsigned int* visible, long n, long base, int mask, int lanes) {
+    for (int lane = 0; lane < lanes; lane++) {
+        visible[n] = (unsigned int)(base + lane);
+        n += (mask >> lane) & 1;
+    }
+    return n;
+}
+
+#ifdef CULL_X86
+// -- SSE kernels -- //
+static long spheres_sse(const Frustum* frustum, const CullSpheres* spheres, long first, long end,
+                        unsigned int* visible) {
+    const __m128 zero = _mm_setzero_ps();
+    long n = 0;
+    long i = first;
+    for (; i + 4 <= end; i += 4) {
+        __m128 x = _mm_loadu_ps(spheres->x + i);
+        __m128 y = _mm_loadu_ps(spheres->y + i);
+        __m128 z = _mm_loadu_ps(spheres->z + i);
+        __m128 r = _mm_loadu_ps(spheres->radius + i);
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            const float* plane = frustum->planes[p];
+            __m128 d = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane[0])), _mm_set1_ps(plane[3]));
+            d = _mm_add_ps(d, _mm_mul_ps(y, _mm_set1_ps(plane[1])));
+            d = _mm_add_ps(d, _mm_mul_ps(z, _mm_set1_ps(plane[2])));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(d, r), zero));
+        }
+        n = compact(visible, n, i, _mm_movemask_ps(inside), 4);
+    }
+    return n + spheres_scalar(frustum, spheres, i, end, visible + n);
+}
+
+static long boxes_sse(const Frustum* frustum, const CullBoxes* boxes, long first, long end,
+                      unsigned int* visible) {
+    const __m128 zero = _mm_setzero_ps();
+    long n = 0;
+    long i = first;
+    for (; i + 4 <= end; i += 4) {
+        __m128 cx = _mm_loadu_ps(boxes->center_x + i);
+        __m128 cy = _mm_loadu_ps(boxes->center_y + i);
+        __m128 cz = _mm_loadu_ps(boxes->center_z + i);
+        __m128 ex = _mm_loadu_ps(boxes->extent_x + i);
+        __m128 ey = _mm_loadu_ps(boxes->extent_y + i);
+        __m128 ez = _mm_loadu_ps(boxes->extent_z + i);
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            const float* plane = frustum->planes[p];
+            __m128 d = _mm_add_ps(_mm_mul_ps(cx, _mm_set1_ps(plane[0])), _mm_set1_ps(plane[3]));
+            d = _mm_add_ps(d, _mm_mul_ps(cy, _mm_set1_ps(plane[1])));
+            d = _mm_add_ps(d, _mm_mul_ps(cz, _mm_set1_ps(plane[2])));
+            // projected extent: |a| ex + |b| ey + |c| ez
+            d = _mm_add_ps(d, _mm_mul_ps(ex, _mm_set1_ps(fabsf(plane[0]))));
+            d = _mm_add_ps(d, _mm_mul_ps(ey, _mm_set1_ps(fabsf(plane[1]))));
+            d = _mm_add_ps(d, _mm_mul_ps(ez, _mm_set1_ps(fabsf(plane[2]))));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(d, zero));
+        }
+        n = compact(visible, n, i, _mm_movemask_ps(inside), 4);
+    }
+    return n + boxes_scalar(frustum, boxes, i, end, visible + n);
+}
+
+// -- AVX2 kernels -- //
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+
+AVX2_TARGET
+static long spheres_avx2(const Frustum* frustum, const CullSpheres* spheres, long first, long end,
+                         unsigned int* visible) {
+    __m256 a[6], b[6], c[6], w[6];
+    for (int p = 0; p < 6; p++) {
+        a[p] = _mm256_set1_ps(frustum->planes[p][0]);
+        b[p] = _mm256_set1_ps(frustum->planes[p][1]);
+        c[p] = _mm256_set1_ps(frustum->planes[p][2]);
+        w[p] = _mm256_set1_ps(frustum->planes[p][3]);
+    }
+    const __m256 zero = _mm256_setzero_ps();
+    long n = 0;
+    long i = first;
+    for (; i + 8 <= end; i += 8) {
+        __m256 x = _mm256_loadu_ps(spheres->x + i);
+        __m256 y = _mm256_loadu_ps(spheres->y + i);
+        __m256 z = _mm256_loadu_ps(spheres->z + i);
+        __m256 r = _mm256_loadu_ps(spheres->radius + i);
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            // plane distance plus radius, in one chain of fmas
+            __m256 d = _mm256_fmadd_ps(x, a[p], _mm256_add_ps(w[p], r));
+            d = _mm256_fmadd_ps(y, b[p], d);
+            d = _mm256_fmadd_ps(z, c[p], d);
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(d, zero, _CMP_GE_OQ));
+        }
+        n = compact(visible, n, i, _mm256_movemask_ps(inside), 8);
+    }
+    return n + spheres_sse(frustum, spheres, i, end, visible + n);
+}
+
+AVX2_TARGET
+static long boxes_avx2(const Frustum* frustum, const CullBoxes* boxes, long first, long end,
+                       unsigned int* visible) {
+    __m256 a[6], b[6], c[6], w[6];
+    __m256 abs_a[6], abs_b[6], abs_c[6];
+    for (int p = 0; p < 6; p++) {
+        a[p] = _mm256_set1_ps(frustum->planes[p][0]);
+        b[p] = _mm256_set1_ps(frustum->planes[p][1]);
+        c[p] = _mm256_set1_ps(frustum->planes[p][2]);
+        w[p] = _mm256_set1_ps(frustum->planes[p][3]);
+        abs_a[p] = _mm256_set1_ps(fabsf(frustum->planes[p][0]));
+        abs_b[p] = _mm256_set1_ps(fabsf(frustum->planes[p][1]));
+        abs_c[p] = _mm256_set1_ps(fabsf(frustum->planes[p][2]));
+    }
+    const __m256 zero = _mm256_setzero_ps();
+    long n = 0;
+    long i = first;
+    for (; i + 8 <= end; i += 8) {
+        __m256 cx = _mm256_loadu_ps(boxes->center_x + i);
+        __m256 cy = _mm256_loadu_ps(boxes->center_y + i);
+        __m256 cz = _mm256_loadu_ps(boxes->center_z + i);
+        __m256 ex = _mm256_loadu_ps(boxes->extent_x + i);
+        __m256 ey = _mm256_loadu_ps(boxes->extent_y + i);
+        __m256 ez = _mm256_loadu_ps(boxes->extent_z + i);
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            __m256 d = _mm256_fmadd_ps(cx, a[p], w[p]);
+            d = _mm256_fmadd_ps(cy, b[p], d);
+            d = _mm256_fmadd_ps(cz, c[p], d);
+            d = _mm256_fmadd_ps(ex, abs_a[p], d);
+            d = _mm256_fmadd_ps(ey, abs_b[p], d);
+            d = _mm256_fmadd_ps(ez, abs_c[p], d);
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(d, zero, _CMP_GE_OQ));
+        }
+        n = compact(visible, n, i, _mm256_movemask_ps(inside), 8);
+    }
+    return n + boxes_sse(frustum, boxes, i, end, visible + n);
+}
+#endif
+
+// -- Dispatch -- //
+long cull_spheres(const Frustum* frustum, const CullSpheres* spheres, long first, long count, unsigned int* visible) {
+    long end = first + count;
+    switch (vecmath_isa()) {
+#ifdef CULL_X86
+        case VECMATH_AVX2: return spheres_avx2(frustum, spheres, first, end, visible);
+        case VECMATH_SSE: return spheres_sse(frustum, spheres, first, end, visible);
+#endif
+        default: return spheres_scalar(frustum, spheres, first, end, visible);
+    }
+}
+
+long cull_boxes(const Frustum* frustum, const CullBoxes* boxes, long first, long count, unsigned int* visible) {
+    long end = first + count;
+    switch (vecmath_isa()) {
+#ifdef CULL_X86
+        case VECMATH_AVX2: return boxes_avx2(frustum, boxes, first, end, visible);
+        case VECMATH_SSE: return boxes_sse(frustum, boxes, first, end, visible);
+#endif
+        default: return boxes_scalar(frustum, boxes, first, end, visible);
+    }
+}
@@ -0,0 +1,212 @@
+#include "draw_indirect.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "glad/glad.h"
+#include "gl_state.h"
+#include "timer.h"
+
+int draw_queue_init(DrawQueue* queue, int max_vertices, int max_indices, int max_draws, int allow_indirect) {
+    memset(queue, 0, sizeof(*queue));
+    queue->indirect = allow_indirect && GLAD_GL_VERSION_4_3 && glMultiDrawArraysIndirect && glMultiDrawElementsIndirect;
+    queue->vertex_capacity = max_vertices;
+    queue->index_capacity = max_indices;
+    queue->draw_capacity = max_draws;
+
+    queue->draw_meshes = (int*)malloc(max_draws * sizeof(int));
+    queue->instances = (FigureInstance*)malloc(max_draws * sizeof(FigureInstance));
+    if (queue->indirect) {
+        queue->array_commands = (DrawArraysCommand*)malloc(max_draws * sizeof(DrawArraysCommand));
+        queue->element_commands = (DrawElementsCommand*)malloc(max_draws * sizeof(DrawElementsCommand));
+    }
+    if (!queue->draw_meshes || !queue->instances ||
+        (queue->indirect && (!queue->array_commands || !queue->element_commands))) {
+        printf("ERROR::DRAW_QUEUE::OUT_OF_MEMORY\n");
+        draw_queue_destroy(queue);
+        return -1;
+    }
+
+    glGenVertexArrays(1, &queue->VAO);
+    glGenBuffers(1, &queue->VBO);
+    glGenBuffers(1, &queue->EBO);
+    glGenBuffers(1, &queue->instance_VBO);
+
+    gl_state_bind_vertex_array(queue->VAO);
+
+    // -- Shared geometry -- //
+    gl_state_bind_buffer(GL_ARRAY_BUFFER, queue->VBO);
+    glBufferData(GL_ARRAY_BUFFER, (long)max_vertices * FIGURE_VERTEX_FLOATS * sizeof(float), NULL, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, FIGURE_VERTEX_FLOATS * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, FIGURE_VERTEX_FLOATS * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    gl_state_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, queue->EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (long)(max_indices ? max_indices : 1) * sizeof(unsigned int), NULL, GL_STATIC_DRAW);
+
+    // -- Per draw data -- //
+    if (queue->indirect) {
+        // baseInstance of each command selects its FigureInstance
+        gl_state_bind_buffer(GL_ARRAY_BUFFER, queue->instance_VBO);
+        glBufferData(GL_ARRAY_BUFFER, (long)max_draws * sizeof(FigureInstance), NULL, GL_STREAM_DRAW);
+        glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(FigureInstance), (void*)0);
+        glEnableVertexAttribArray(2);
+        glVertexAttribDivisor(2, 1);
+        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(FigureInstance), (void*)(4 * sizeof(float)));
+        glEnableVertexAttribArray(3);
+        glVertexAttribDivisor(3, 1);
+
+        glGenBuffers(1, &queue->command_buffer);
+        gl_state_bind_buffer(GL_DRAW_INDIRECT_BUFFER, queue->command_buffer);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER,
+            (long)max_draws * (sizeof(DrawArraysCommand) + sizeof(DrawElementsCommand)), NULL, GL_STREAM_DRAW);
+    }
+    // the fallback leaves attributes 2 and 3 disabled and sets their current value per draw
+    return 0;
+}
+
+int draw_queue_add_mesh(DrawQueue* queue, const float* vertices, int vertex_count,
+                        const unsigned int* indices, int index_count) {
+    if (!indices) {
+        index_count = 0;
+    }
+    if (queue->vertex_count + vertex_count > queue->vertex_capacity ||
+        queue->index_count + index_count > queue->index_capacity) {
+        return -1;
+    }
+    if (queue->mesh_count == queue->mesh_capacity) {
+        int capacity = queue->mesh_capacity ? queue->mesh_capacity * 2 : 16;
+        DrawMesh* meshes = (DrawMesh*)realloc(queue->meshes, capacity * sizeof(DrawMesh));
+        if (!meshes) {
+            return -1;
+        }
+        queue->meshes = meshes;
+        queue->mesh_capacity = capacity;
+    }
+
+    DrawMesh* mesh = &queue->meshes[queue->mesh_count];
+    mesh->base_vertex = queue->vertex_count;
+    mesh->indexed = index_count > 0;
+    mesh->first = mesh->indexed ? queue->index_count : queue->vertex_count;
+    mesh->count = mesh->indexed ? index_count : vertex_count;
+
+    gl_state_bind_vertex_array(queue->VAO);
+    gl_state_bind_buffer(GL_ARRAY_BUFFER, queue->VBO);
+    glBufferSubData(GL_ARRAY_BUFFER, (long)queue->vertex_count * FIGURE_VERTEX_FLOATS * sizeof(float),
+        (long)vertex_count * FIGURE_VERTEX_FLOATS * sizeof(float), vertices);
+    if (mesh->indexed) {
+        // indices stay relative to the mesh, base_vertex moves them into the shared buffer
+        gl_state_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, queue->EBO);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, (long)queue->index_count * sizeof(unsigned int),
+            (long)index_count * sizeof(unsigned int), indices);
+    }
+
+    queue->vertex_count += vertex_count;
+    queue->index_count += index_count;
+    return queue->mesh_count++;
+}
+
+void draw_queue_begin(DrawQueue* queue) {
+    queue->draw_count = 0;
+}
+
+int draw_queue_push(DrawQueue* queue, int mesh, const FigureInstance* instance) {
+    if (queue->draw_count == queue->draw_capacity) {
+        return -1;
+    }
+    queue->draw_meshes[queue->draw_count] = mesh;
+    queue->instances[queue->draw_count] = *instance;
+    queue->draw_count++;
+    return 0;
+}
+
+// -- Submission -- //
+
+static void submit_indirect(DrawQueue* queue) {
+    int array_count = 0;
+    int element_count = 0;
+    for (int i = 0; i < queue->draw_count; i++) {
+        const DrawMesh* mesh = &queue->meshes[queue->draw_meshes[i]];
+        if (mesh->indexed) {
+            DrawElementsCommand* command = &queue->element_commands[element_count++];
+            command->count = mesh->count;
+            command->instance_count = 1;
+            command->first_index = mesh->first;
+            command->base_vertex = mesh->base_vertex;
+            command->base_instance = i;
+        } else {
+            DrawArraysCommand* command = &queue->array_commands[array_count++];
+            command->count = mesh->count;
+            command->instance_count = 1;
+            command->first = mesh->first;
+            command->base_instance = i;
+        }
+    }
+
+    // orphan both buffers, the previous frame may still be reading them
+    long array_bytes = array_count * sizeof(DrawArraysCommand);
+    long element_bytes = element_count * sizeof(DrawElementsCommand);
+    gl_state_bind_buffer(GL_DRAW_INDIRECT_BUFFER, queue->command_buffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER,
+        (long)queue->draw_capacity * (sizeof(DrawArraysCommand) + sizeof(DrawElementsCommand)), NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, array_bytes, queue->array_commands);
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, array_bytes, element_bytes, queue->element_commands);
+
+    gl_state_bind_buffer(GL_ARRAY_BUFFER, queue->instance_VBO);
+    glBufferData(GL_ARRAY_BUFFER, (long)queue->draw_capacity * sizeof(FigureInstance), NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, (long)queue->draw_count * sizeof(FigureInstance), queue->instances);
+
+    if (array_count) {
+        glMultiDrawArraysIndirect(GL_TRIANGLES, (void*)0, array_count, 0);
+        queue->draw_calls++;
+    }
+    if (element_count) {
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (void*)array_bytes, element_count, 0);
+        queue->draw_calls++;
+    }
+}
+
+static void submit_direct(DrawQueue* queue) {
+    for (int i = 0; i < queue->draw_count; i++) {
+        const DrawMesh* mesh = &queue->meshes[queue->draw_meshes[i]];
+        const FigureInstance* instance = &queue->instances[i];
+        glVertexAttrib4f(2, instance->x, instance->y, instance->z, instance->scale);
+        glVertexAttrib3f(3, instance->r, instance->g, instance->b);
+        if (mesh->indexed) {
+            glDrawElementsBaseVertex(GL_TRIANGLES, mesh->count, GL_UNSIGNED_INT,
+                (void*)((long)mesh->first * sizeof(unsigned int)), mesh->base_vertex);
+        } else {
+            glDrawArrays(GL_TRIANGLES, mesh->first, mesh->count);
+        }
+    }
+    queue->draw_calls = queue->draw_count;
+}
+
+void draw_queue_submit(DrawQueue* queue) {
+    double start = timer_now_ms();
+    queue->draw_calls = 0;
+    if (queue->draw_count) {
+        gl_state_bind_vertex_array(queue->VAO);
+        if (queue->indirect) {
+            submit_indirect(queue);
+        } else {
+            submit_direct(queue);
+        }
+    }
+    queue->submit_ms = timer_now_ms() - start;
+}
+
+void draw_queue_destroy(DrawQueue* queue) {
+    if (queue->VAO) {
+        gl_state_delete_vertex_arrays(1, &queue->VAO);
+    }
+    GLuint buffers[4] = { queue->VBO, queue->EBO, queue->instance_VBO, queue->command_buffer };
+    gl_state_delete_buffers(4, buffers);
+
+    free(queue->meshes);
+    free(queue->draw_meshes);
+    free(queue->instances);
+    free(queue->array_commands);
+    free(queue->element_commands);
+    memset(queue, 0, sizeof(*queue));
+}
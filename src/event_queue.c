@@ -0,0 +1,47 @@
+#include "event_queue.h"
+#include <stdlib.h>
+
+EventQueue* event_queue_create(void) {
+    // aligned_alloc wants a multiple of the alignment
+    size_t size = (sizeof(EventQueue) + 63) & ~(size_t)63;
+    EventQueue* queue = (EventQueue*)aligned_alloc(64, size);
+    if (queue) {
+        event_queue_init(queue);
+    }
+    return queue;
+}
+
+void event_queue_init(EventQueue* queue) {
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->dropped, 0);
+    queue->tail_cache = 0;
+    queue->head_cache = 0;
+}
+
+int event_queue_push(EventQueue* queue, const WindowEvent* event) {
+    unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if (tail - queue->head_cache == EVENT_QUEUE_SIZE) {
+        queue->head_cache = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if (tail - queue->head_cache == EVENT_QUEUE_SIZE) {
+            atomic_fetch_add_explicit(&queue->dropped, 1, memory_order_relaxed);
+            return -1;
+        }
+    }
+    queue->events[tail & (EVENT_QUEUE_SIZE - 1)] = *event;
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return 0;
+}
+
+int event_queue_pop(EventQueue* queue, WindowEvent* event) {
+    unsigned int head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (head == queue->tail_cache) {
+        queue->tail_cache = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if (head == queue->tail_cache) {
+            return 0;
+        }
+    }
+    *event = queue->events[head & (EVENT_QUEUE_SIZE - 1)];
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    return 1;
+}
@@ -0,0 +1,108 @@
+#include "figure.h"
+#include <stdlib.h>
+#include <string.h>
+#include "glad/glad.h"
+#include "gl_state.h"
+
+void figure_init(Figure* figure, const float* vertices, int vertex_count,
+                 const unsigned int* indices, int index_count) {
+    memset(figure, 0, sizeof(*figure));
+    figure->vertex_count = vertex_count;
+    figure->index_count = indices ? index_count : 0;
+
+    glGenVertexArrays(1, &figure->VAO);
+    glGenBuffers(1, &figure->VBO);
+    glGenBuffers(1, &figure->instance_VBO);
+
+    gl_state_bind_vertex_array(figure->VAO);
+
+    // -- Shape -- //
+    gl_state_bind_buffer(GL_ARRAY_BUFFER, figure->VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertex_count * FIGURE_VERTEX_FLOATS * sizeof(float), vertices, GL_STATIC_DRAW);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, FIGURE_VERTEX_FLOATS * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, FIGURE_VERTEX_FLOATS * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    if (figure->index_count) {
+        glGenBuffers(1, &figure->EBO);
+        gl_state_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, figure->EBO);
+
+        // half the index bandwidth when every vertex is reachable with 16 bits,
+        // 32-bit indices still work if the copy can't be allocated
+        unsigned short* short_indices = NULL;
+        if (vertex_count <= 65536) {
+            short_indices = (unsigned short*)malloc(index_count * sizeof(unsigned short));
+        }
+        if (short_indices) {
+            for (int i = 0; i < index_count; i++) {
+                short_indices[i] = (unsigned short)indices[i];
+            }
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_count * sizeof(unsigned short), short_indices, GL_STATIC_DRAW);
+            free(short_indices);
+            figure->index_type = GL_UNSIGNED_SHORT;
+        } else {
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_count * sizeof(unsigned int), indices, GL_STATIC_DRAW);
+            figure->index_type = GL_UNSIGNED_INT;
+        }
+    }
+
+    // -- Instances -- //
+    gl_state_bind_buffer(GL_ARRAY_BUFFER, figure->instance_VBO);
+
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(FigureInstance), (void*)0);
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1); // advance once per instance, not per vertex
+
+    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(FigureInstance), (void*)(4 * sizeof(float)));
+    glEnableVertexAttribArray(3);
+    glVertexAttribDivisor(3, 1);
+
+    // a single identity instance so figure_draw works before any upload
+    FigureInstance identity = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    figure_set_instances(figure, &identity, 1);
+}
+
+void figure_set_instances(Figure* figure, const FigureInstance* instances, int count) {
+    gl_state_bind_buffer(GL_ARRAY_BUFFER, figure->instance_VBO);
+
+    if (count > figure->instance_capacity) {
+        glBufferData(GL_ARRAY_BUFFER, count * sizeof(FigureInstance), instances, GL_DYNAMIC_DRAW);
+        figure->instance_capacity = count;
+    } else {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(FigureInstance), instances);
+    }
+    figure->instance_count = count;
+}
+
+void figure_draw(Figure* figure) {
+    gl_state_bind_vertex_array(figure->VAO);
+    if (figure->index_count) {
+        glDrawElements(GL_TRIANGLES, figure->index_count, figure->index_type, (void*)0);
+    } else {
+        glDrawArrays(GL_TRIANGLES, 0, figure->vertex_count);
+    }
+}
+
+void figure_draw_instanced(Figure* figure) {
+    if (figure->instance_count == 0) {
+        return;
+    }
+    gl_state_bind_vertex_array(figure->VAO);
+    if (figure->index_count) {
+        glDrawElementsInstanced(GL_TRIANGLES, figure->index_count, figure->index_type, (void*)0, figure->instance_count);
+    } else {
+        glDrawArraysInstanced(GL_TRIANGLES, 0, figure->vertex_count, figure->instance_count);
+    }
+}
+
+void figure_destroy(Figure* figure) {
+    gl_state_delete_vertex_arrays(1, &figure->VAO);
+    gl_state_delete_buffers(1, &figure->VBO);
+    gl_state_delete_buffers(1, &figure->instance_VBO);
+    if (figure->EBO) {
+        gl_state_delete_buffers(1, &figure->EBO);
+    }
+    memset(figure, 0, sizeof(*figure));
+}
@@ -0,0 +1,109 @@
+#include "file.h"
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// shared by every empty file, mmap refuses zero length
+static const char empty_file[1] = "";
+
+// -- Fallback -- //
+static int read_all(int fd, FileView* file) {
+    size_t capacity = 4096;
+    size_t size = 0;
+    char* buffer = (char*)malloc(capacity);
+    if (!buffer) {
+        return -1;
+    }
+
+    for (;;) {
+        if (size == capacity) {
+            char* grown = (char*)realloc(buffer, capacity * 2);
+            if (!grown) {
+                free(buffer);
+                errno = ENOMEM;
+                return -1;
+            }
+            buffer = grown;
+            capacity *= 2;
+        }
+        ssize_t count = read(fd, buffer + size, capacity - size);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            int error = errno;
+            free(buffer);
+            errno = error;
+            return -1;
+        }
+        if (count == 0) {
+            break;
+        }
+        size += (size_t)count;
+    }
+
+    if (size == 0) {
+        free(buffer);
+        file->data = empty_file;
+        return 0;
+    }
+    file->data = buffer;
+    file->size = size;
+    return 0;
+}
+
+int file_load(const char* path, FileView* file) {
+    file->data = NULL;
+    file->size = 0;
+    file->mapping = NULL;
+    file->mapping_size = 0;
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        int error = errno;
+        close(fd);
+        errno = error;
+        return -1;
+    }
+
+    int result = 0;
+    if (S_ISREG(info.st_mode) && info.st_size > 0) {
+        void* mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            file->data = (const char*)mapping;
+            file->size = (size_t)info.st_size;
+            file->mapping = mapping;
+            file->mapping_size = (size_t)info.st_size;
+        } else {
+            result = read_all(fd, file);
+        }
+    } else {
+        // empty files, pipes and /proc entries (which report size 0)
+        result = read_all(fd, file);
+    }
+
+    int error = errno;
+    close(fd);
+    errno = error;
+    return result;
+}
+
+void file_release(FileView* file) {
+    if (file->mapping) {
+        munmap(file->mapping, file->mapping_size);
+    } else if (file->data != empty_file) {
+        free((void*)file->data);
+    }
+    file->data = NULL;
+    file->size = 0;
+    file->mapping = NULL;
+    file->mapping_size = 0;
+}
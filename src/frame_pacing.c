@@ -0,0 +1,214 @@
+#include "frame_pacing.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "timer.h"
+
+FramePacingConfig frame_pacing_default(void) {
+    FramePacingConfig config = { PACING_VSYNC, 1, 60.0, 1.0, 2 };
+    return config;
+}
+
+const char* frame_pacing_mode_name(PacingMode mode) {
+    switch (mode) {
+        case PACING_VSYNC: return "vsync";
+        case PACING_UNCAPPED: return "uncapped";
+        case PACING_CAP: return "cap";
+    }
+    return "?";
+}
+
+// -- Spec -- //
+static int parse_token(FramePacingConfig* config, char* token) {
+    char* value = strchr(token, '=');
+    if (value) {
+        *value++ = '\0';
+    }
+    char* end = NULL;
+    double number = value ? strtod(value, &end) : 0.0;
+    if (value && (end == value || *end != '\0')) {
+        return -1;
+    }
+
+    if (strcmp(token, "vsync") == 0) {
+        config->mode = PACING_VSYNC;
+        config->swap_interval = value ? (int)number : 1;
+        return config->swap_interval >= 1 ? 0 : -1;
+    }
+    if (strcmp(token, "uncapped") == 0 && !value) {
+        config->mode = PACING_UNCAPPED;
+        return 0;
+    }
+    if (strcmp(token, "cap") == 0 && value) {
+        config->mode = PACING_CAP;
+        config->target_fps = number;
+        return number > 0.0 ? 0 : -1;
+    }
+    if (strcmp(token, "inflight") == 0 && value) {
+        config->max_in_flight = (int)number;
+        return number >= 0 && number <= FRAME_PACING_MAX_IN_FLIGHT ? 0 : -1;
+    }
+    if (strcmp(token, "spin") == 0 && value) {
+        config->spin_ms = number;
+        return number >= 0.0 ? 0 : -1;
+    }
+    return -1;
+}
+
+int frame_pacing_parse(FramePacingConfig* config, const char* spec) {
+    FramePacingConfig parsed = *config;
+    char buffer[256];
+    if (snprintf(buffer, sizeof(buffer), "%s", spec) >= (int)sizeof(buffer)) {
+        printf("ERROR::FRAME_PACING::BAD_SPEC %s\n", spec);
+        return -1;
+    }
+
+    char* save = NULL;
+    for (char* token = strtok_r(buffer, ",", &save); token; token = strtok_r(NULL, ",", &save)) {
+        if (parse_token(&parsed, token) != 0) {
+            printf("ERROR::FRAME_PACING::BAD_SPEC %s\n", spec);
+            return -1;
+        }
+    }
+    *config = parsed;
+    return 0;
+}
+
+// -- Pacer -- //
+void frame_pacer_init(FramePacer* pacer, const FramePacingConfig* config) {
+    memset(pacer, 0, sizeof(*pacer));
+    pacer->config = *config;
+}
+
+void frame_pacer_destroy(FramePacer* pacer) {
+    for (int i = 0; i < FRAME_PACING_MAX_IN_FLIGHT; i++) {
+        if (pacer->fences[i]) {
+            glDeleteSync(pacer->fences[i]);
+            pacer->fences[i] = NULL;
+        }
+    }
+}
+
+int frame_pacer_swap_interval(const FramePacer* pacer) {
+    return pacer->config.mode == PACING_VSYNC ? pacer->config.swap_interval : 0;
+}
+
+// sleeps until spin_ms before the deadline, then spins
+static void wait_until(double deadline_ms, double spin_ms) {
+    double remaining = deadline_ms - timer_now_ms() - spin_ms;
+    if (remaining > 0.0) {
+        struct timespec ts = { (time_t)(remaining / 1e3), (long)(fmod(remaining, 1e3) * 1e6) };
+        nanosleep(&ts, NULL);
+    }
+    while (timer_now_ms() < deadline_ms) {
+    }
+}
+
+void frame_pacer_begin(FramePacer* pacer) {
+    const FramePacingConfig* config = &pacer->config;
+    double start = timer_now_ms();
+
+    if (config->mode == PACING_CAP) {
+        double period = 1e3 / config->target_fps;
+        pacer->deadline_ms += period;
+        if (pacer->deadline_ms < start - period) {
+            // more than a frame behind: start over instead of bursting to catch up
+            pacer->deadline_ms = start;
+        }
+        wait_until(pacer->deadline_ms, config->spin_ms);
+    }
+    double limited = timer_now_ms();
+    pacer->pending_limiter_ms = limited - start;
+
+    // the fence of frame - max_in_flight sits in the slot this frame will use
+    pacer->pending_fence_ms = 0.0;
+    if (config->max_in_flight > 0) {
+        GLsync* fence = &pacer->fences[pacer->frame % config->max_in_flight];
+        if (*fence) {
+            while (glClientWaitSync(*fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED) {
+            }
+            glDeleteSync(*fence);
+            *fence = NULL;
+            pacer->pending_fence_ms = timer_now_ms() - limited;
+        }
+    }
+}
+
+void frame_pacer_end(FramePacer* pacer) {
+    const FramePacingConfig* config = &pacer->config;
+    if (config->max_in_flight > 0) {
+        pacer->fences[pacer->frame % config->max_in_flight] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    pacer->frame++;
+
+    double now = timer_now_ms();
+    if (pacer->last_end_ms > 0.0) {
+        pacer->frame_ms[pacer->next] = now - pacer->last_end_ms;
+        pacer->limiter_ms[pacer->next] = pacer->pending_limiter_ms;
+        pacer->fence_ms[pacer->next] = pacer->pending_fence_ms;
+        pacer->next = (pacer->next + 1) % FRAME_PACING_HISTORY;
+        pacer->count += pacer->count < FRAME_PACING_HISTORY;
+    }
+    pacer->last_end_ms = now;
+}
+
+// -- Stats -- //
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+FramePacingStats frame_pacer_stats(const FramePacer* pacer) {
+    FramePacingStats stats;
+    memset(&stats, 0, sizeof(stats));
+    stats.frames = pacer->count;
+
+    for (int i = 0; i < FRAME_PACING_MAX_IN_FLIGHT; i++) {
+        GLint status = GL_SIGNALED;
+        if (pacer->fences[i]) {
+            glGetSynciv(pacer->fences[i], GL_SYNC_STATUS, 1, NULL, &status);
+        }
+        stats.in_flight += status == GL_UNSIGNALED;
+    }
+    if (!pacer->count) {
+        return stats;
+    }
+
+    double sorted[FRAME_PACING_HISTORY];
+    memcpy(sorted, pacer->frame_ms, pacer->count * sizeof(double));
+    qsort(sorted, pacer->count, sizeof(double), compare_double);
+    stats.min_ms = sorted[0];
+    stats.max_ms = sorted[pacer->count - 1];
+    stats.p99_ms = sorted[(int)((pacer->count - 1) * 0.99)];
+
+    for (int i = 0; i < pacer->count; i++) {
+        stats.mean_ms += pacer->frame_ms[i];
+        stats.limiter_ms += pacer->limiter_ms[i];
+        stats.fence_ms += pacer->fence_ms[i];
+    }
+    stats.mean_ms /= pacer->count;
+    stats.limiter_ms /= pacer->count;
+    stats.fence_ms /= pacer->count;
+
+    double variance = 0.0;
+    for (int i = 0; i < pacer->count; i++) {
+        double d = pacer->frame_ms[i] - stats.mean_ms;
+        variance += d * d;
+    }
+    stats.jitter_ms = sqrt(variance / pacer->count);
+    return stats;
+}
+
+void frame_pacer_print_stats(const FramePacer* pacer) {
+    FramePacingStats stats = frame_pacer_stats(pacer);
+    printf("frame pacing (%s", frame_pacing_mode_name(pacer->config.mode));
+    if (pacer->config.mode == PACING_CAP) {
+        printf(" %.0f fps", pacer->config.target_fps);
+    }
+    printf(", %d in flight max): last %d frames mean %.2f ms, jitter %.3f ms, p99 %.2f ms, max %.2f ms, "
+           "limiter %.2f ms, gpu wait %.2f ms, %d queued\n",
+           pacer->config.max_in_flight, stats.frames, stats.mean_ms, stats.jitter_ms, stats.p99_ms, stats.max_ms,
+           stats.limiter_ms, stats.fence_ms, stats.in_flight);
+}
@@ -0,0 +1,339 @@
+#include "gl_capture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gl_intercept.h"
+
+#define BUFFER_SIZE (1 << 20)
+#define MAX_MAPPINGS 16
+#define FRAME_COUNT_OFFSET 20 // magic, version, width, height
+
+typedef struct {
+    GLuint buffer;
+    char* pointer;
+    GLsizeiptr length;
+} Mapping;
+
+int gl_capture_on = 0;
+
+static struct {
+    FILE* file;
+    char* buffer;
+    size_t used;
+    int failed;
+    unsigned long calls;
+    unsigned long frames;
+    uint64_t bytes;
+    unsigned long* unsupported; // per function
+    int function_count;
+    Mapping mappings[MAX_MAPPINGS];
+    unsigned long persistent;   // mappings whose writes can't be seen
+} capture;
+
+static void flush_buffer(void) {
+    if (capture.used && !capture.failed && fwrite(capture.buffer, 1, capture.used, capture.file) != capture.used) {
+        printf("ERROR::GL_CAPTURE::WRITE_FAILED\n");
+        capture.failed = 1;
+    }
+    capture.bytes += capture.used;
+    capture.used = 0;
+}
+
+static void append(const void* data, size_t size) {
+    if (capture.used + size > BUFFER_SIZE) {
+        flush_buffer();
+        if (size > BUFFER_SIZE) {
+            if (!capture.failed && fwrite(data, 1, size, capture.file) != size) {
+                printf("ERROR::GL_CAPTURE::WRITE_FAILED\n");
+                capture.failed = 1;
+            }
+            capture.bytes += size;
+            return;
+        }
+    }
+    memcpy(capture.buffer + capture.used, data, size);
+    capture.used += size;
+}
+
+// -- Session -- //
+int gl_capture_start(const char* path, int width, int height) {
+    if (capture.file) {
+        return 0;
+    }
+    if (gl_intercept_install() != 0) {
+        return -1;
+    }
+    int function_count = 0;
+    const GlCallStats* functions = gl_intercept_stats(&function_count);
+
+    capture.file = fopen(path, "wb");
+    capture.buffer = (char*)malloc(BUFFER_SIZE);
+    capture.unsupported = (unsigned long*)calloc(function_count, sizeof(unsigned long));
+    if (!capture.file || !capture.buffer || !capture.unsupported) {
+        printf("ERROR::GL_CAPTURE::FILE_NOT_CREATED %s\n", path);
+        if (capture.file) {
+            fclose(capture.file);
+        }
+        free(capture.buffer);
+        free(capture.unsupported);
+        memset(&capture, 0, sizeof(capture));
+        return -1;
+    }
+    capture.function_count = function_count;
+
+    append("GSLCAP\0\0", 8);
+    gl_capture_u32(GL_CAPTURE_VERSION);
+    gl_capture_u32((uint32_t)width);
+    gl_capture_u32((uint32_t)height);
+    gl_capture_u32(0); // frame count
+    gl_capture_u32((uint32_t)function_count);
+    for (int i = 0; i < function_count; i++) {
+        append(functions[i].name, strlen(functions[i].name) + 1);
+    }
+    gl_capture_on = 1;
+    return 0;
+}
+
+void gl_capture_stop(void) {
+    if (!capture.file) {
+        return;
+    }
+    gl_capture_on = 0;
+    flush_buffer();
+    uint32_t frames = (uint32_t)capture.frames;
+    if (fseek(capture.file, FRAME_COUNT_OFFSET, SEEK_SET) != 0 || fwrite(&frames, sizeof(frames), 1, capture.file) != 1) {
+        printf("ERROR::GL_CAPTURE::WRITE_FAILED\n");
+    }
+    if (fclose(capture.file) != 0) {
+        printf("ERROR::GL_CAPTURE::WRITE_FAILED\n");
+    }
+
+    printf("gl capture: %lu calls, %lu frames, %.2f MB\n", capture.calls, capture.frames, capture.bytes / (1024.0 * 1024.0));
+    int function_count = 0;
+    const GlCallStats* functions = gl_intercept_stats(&function_count);
+    for (int i = 0; i < capture.function_count && i < function_count; i++) {
+        if (capture.unsupported[i]) {
+            printf("  not captured: %s (%lu calls)\n", functions[i].name, capture.unsupported[i]);
+        }
+    }
+    if (capture.persistent) {
+        printf("  not captured: writes to %lu persistent or coherent mappings\n", capture.persistent);
+    }
+    free(capture.buffer);
+    free(capture.unsupported);
+    memset(&capture, 0, sizeof(capture));
+}
+
+int gl_capture_active(void) {
+    return gl_capture_on;
+}
+
+// -- Records -- //
+void gl_capture_call(int function) {
+    uint16_t id = (uint16_t)function;
+    append(&id, sizeof(id));
+    capture.calls++;
+}
+
+void gl_capture_frame(void) {
+    if (!gl_capture_on) {
+        return;
+    }
+    uint16_t id = GL_CAPTURE_FRAME;
+    append(&id, sizeof(id));
+    capture.frames++;
+}
+
+void gl_capture_unsupported(int function) {
+    if (function < capture.function_count) {
+        capture.unsupported[function]++;
+    }
+}
+
+void gl_capture_u32(uint32_t value) {
+    append(&value, sizeof(value));
+}
+
+void gl_capture_u64(uint64_t value) {
+    append(&value, sizeof(value));
+}
+
+void gl_capture_f32(float value) {
+    append(&value, sizeof(value));
+}
+
+void gl_capture_f64(double value) {
+    append(&value, sizeof(value));
+}
+
+void gl_capture_bytes(const void* data, uint64_t size) {
+    if (!data) {
+        gl_capture_u64(GL_CAPTURE_NULL);
+        return;
+    }
+    gl_capture_u64(size);
+    append(data, size);
+}
+
+void gl_capture_string(const char* text, int length) {
+    if (!text) {
+        gl_capture_u64(GL_CAPTURE_NULL);
+        return;
+    }
+    size_t size = length < 0 ? strlen(text) : (size_t)length;
+    gl_capture_u64(size + 1);
+    append(text, size);
+    append("", 1);
+}
+
+void gl_capture_strings(GLsizei count, const GLchar* const* strings, const GLint* lengths) {
+    for (GLsizei i = 0; i < count; i++) {
+        gl_capture_string(strings[i], lengths && lengths[i] >= 0 ? lengths[i] : -1);
+    }
+}
+
+// -- Images -- //
+static int component_count(GLenum format) {
+    switch (format) {
+        case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX: return 1;
+        case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL: return 2;
+        case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER: return 3;
+        default: return 4;
+    }
+}
+
+static int pixel_size(GLenum format, GLenum type) {
+    switch (type) {
+        case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV: return 1;
+        case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+        case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+        case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV: return 2;
+        case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+        case GL_UNSIGNED_INT_10_10_10_2: case GL_UNSIGNED_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV: return 4;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: return 8;
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: return 2 * component_count(format);
+        case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: return 4 * component_count(format);
+        default: return component_count(format);
+    }
+}
+
+typedef struct {
+    GLint alignment;
+    GLint row_length;
+    GLint skip_pixels;
+    GLint skip_rows;
+} UnpackState;
+
+// the bytes from pixels up to the end of the last pixel GL reads: the last
+// row is not padded to the alignment
+static uint64_t image_size(const UnpackState* unpack, GLsizei width, GLsizei height, GLenum format, GLenum type) {
+    if (width <= 0 || height <= 0) {
+        return 0;
+    }
+    uint64_t pixel = (uint64_t)pixel_size(format, type);
+    uint64_t alignment = unpack->alignment > 0 ? (uint64_t)unpack->alignment : 1;
+    uint64_t stride = (uint64_t)(unpack->row_length > 0 ? unpack->row_length : width) * pixel;
+    stride = (stride + alignment - 1) / alignment * alignment;
+    return (uint64_t)unpack->skip_rows * stride + (uint64_t)unpack->skip_pixels * pixel +
+           (uint64_t)(height - 1) * stride + (uint64_t)width * pixel;
+}
+
+void gl_capture_image(const void* pixels, GLsizei width, GLsizei height, GLenum format, GLenum type) {
+    UnpackState unpack = { 4, 0, 0, 0 };
+    gl_intercept_get_integerv(GL_UNPACK_ALIGNMENT, &unpack.alignment);
+    gl_intercept_get_integerv(GL_UNPACK_ROW_LENGTH, &unpack.row_length);
+    gl_intercept_get_integerv(GL_UNPACK_SKIP_PIXELS, &unpack.skip_pixels);
+    gl_intercept_get_integerv(GL_UNPACK_SKIP_ROWS, &unpack.skip_rows);
+    gl_capture_u32((uint32_t)unpack.alignment);
+    gl_capture_u32((uint32_t)unpack.row_length);
+    gl_capture_u32((uint32_t)unpack.skip_pixels);
+    gl_capture_u32((uint32_t)unpack.skip_rows);
+
+    if (gl_capture_bound_buffer(GL_PIXEL_UNPACK_BUFFER)) {
+        gl_capture_u32(1);
+        gl_capture_u64((uint64_t)(uintptr_t)pixels);
+    } else {
+        gl_capture_u32(0);
+        gl_capture_bytes(pixels, pixels ? image_size(&unpack, width, height, format, type) : 0);
+    }
+}
+
+// -- Mappings -- //
+static GLenum buffer_binding(GLenum target) {
+    switch (target) {
+        case GL_ARRAY_BUFFER: return GL_ARRAY_BUFFER_BINDING;
+        case GL_ELEMENT_ARRAY_BUFFER: return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+        case GL_PIXEL_PACK_BUFFER: return GL_PIXEL_PACK_BUFFER_BINDING;
+        case GL_PIXEL_UNPACK_BUFFER: return GL_PIXEL_UNPACK_BUFFER_BINDING;
+        case GL_UNIFORM_BUFFER: return GL_UNIFORM_BUFFER_BINDING;
+        case GL_TEXTURE_BUFFER: return GL_TEXTURE_BUFFER_BINDING;
+        case GL_TRANSFORM_FEEDBACK_BUFFER: return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+        case GL_COPY_READ_BUFFER: return GL_COPY_READ_BUFFER_BINDING;
+        case GL_COPY_WRITE_BUFFER: return GL_COPY_WRITE_BUFFER_BINDING;
+        case GL_DRAW_INDIRECT_BUFFER: return GL_DRAW_INDIRECT_BUFFER_BINDING;
+        case GL_DISPATCH_INDIRECT_BUFFER: return GL_DISPATCH_INDIRECT_BUFFER_BINDING;
+        case GL_SHADER_STORAGE_BUFFER: return GL_SHADER_STORAGE_BUFFER_BINDING;
+        case GL_ATOMIC_COUNTER_BUFFER: return GL_ATOMIC_COUNTER_BUFFER_BINDING;
+        case GL_QUERY_BUFFER: return GL_QUERY_BUFFER_BINDING;
+        default: return 0;
+    }
+}
+
+GLuint gl_capture_bound_buffer(GLenum target) {
+    GLenum binding = buffer_binding(target);
+    GLint bound = 0;
+    if (binding) {
+        gl_intercept_get_integerv(binding, &bound);
+    }
+    return (GLuint)bound;
+}
+
+// keyed by buffer: two buffers can be mapped through the same target in turn
+static Mapping* find_mapping(GLuint buffer, int create) {
+    Mapping* free_slot = NULL;
+    for (int i = 0; i < MAX_MAPPINGS; i++) {
+        if (capture.mappings[i].pointer && capture.mappings[i].buffer == buffer) {
+            return &capture.mappings[i];
+        }
+        if (!capture.mappings[i].pointer && !free_slot) {
+            free_slot = &capture.mappings[i];
+        }
+    }
+    return create ? free_slot : NULL;
+}
+
+void gl_capture_mapped(GLenum target, void* pointer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    (void)offset;
+    // written to behind GL's back, without a flush or unmap to capture them at
+    if (pointer && (access & (GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT))) {
+        capture.persistent++;
+    }
+    GLuint buffer = gl_capture_bound_buffer(target);
+    Mapping* mapping = find_mapping(buffer, 1);
+    if (mapping) {
+        mapping->buffer = buffer;
+        mapping->pointer = (char*)pointer;
+        mapping->length = pointer ? length : 0;
+    }
+}
+
+void gl_capture_mapped_contents(GLenum target, int flush, GLintptr offset, GLsizeiptr length) {
+    Mapping* mapping = find_mapping(gl_capture_bound_buffer(target), 0);
+    if (!mapping) {
+        gl_capture_bytes(NULL, 0);
+        return;
+    }
+    if (!flush) {
+        offset = 0;
+        length = mapping->length;
+    }
+    if (offset < 0 || length < 0 || offset + length > mapping->length) {
+        gl_capture_bytes(NULL, 0);
+        return;
+    }
+    gl_capture_bytes(mapping->pointer + offset, (uint64_t)length);
+    if (!flush) {
+        mapping->pointer = NULL;
+    }
+}
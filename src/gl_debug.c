@@ -0,0 +1,258 @@
+#include "gl_debug.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TABLE_SIZE (GL_DEBUG_MAX_MESSAGES * 2) // open addressing, power of two
+
+static struct {
+    int installed;
+    GlDebugMessage messages[GL_DEBUG_MAX_MESSAGES];
+    int message_count;
+    short table[TABLE_SIZE];      // index + 1 into messages, 0 when empty
+    unsigned long frame;          // frames ended so far
+    GlDebugFrameStats current;
+    GlDebugFrameStats last;
+    unsigned long totals[GL_MESSAGE_CLASSES];
+    unsigned long dropped;        // occurrences of messages that did not fit
+    int first_new;                // first message new in the current frame
+} debug;
+
+// -- Names -- //
+const char* gl_debug_class_name(GlMessageClass message_class) {
+    switch (message_class) {
+        case GL_MESSAGE_ERROR: return "error";
+        case GL_MESSAGE_PERFORMANCE: return "performance";
+        case GL_MESSAGE_UNDEFINED: return "undefined";
+        case GL_MESSAGE_PORTABILITY: return "portability";
+        default: return "other";
+    }
+}
+
+static const char* severity_name(GLenum severity) {
+    switch (severity) {
+        case GL_DEBUG_SEVERITY_HIGH: return "high";
+        case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+        case GL_DEBUG_SEVERITY_LOW: return "low";
+        default: return "note";
+    }
+}
+
+static const char* source_name(GLenum source) {
+    switch (source) {
+        case GL_DEBUG_SOURCE_API: return "api";
+        case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "window";
+        case GL_DEBUG_SOURCE_SHADER_COMPILER: return "compiler";
+        case GL_DEBUG_SOURCE_THIRD_PARTY: return "third party";
+        case GL_DEBUG_SOURCE_APPLICATION: return "app";
+        default: return "other";
+    }
+}
+
+static GlMessageClass classify(GLenum type) {
+    switch (type) {
+        case GL_DEBUG_TYPE_ERROR: return GL_MESSAGE_ERROR;
+        case GL_DEBUG_TYPE_PERFORMANCE: return GL_MESSAGE_PERFORMANCE;
+        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return GL_MESSAGE_UNDEFINED;
+        case GL_DEBUG_TYPE_PORTABILITY:
+        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return GL_MESSAGE_PORTABILITY;
+        default: return GL_MESSAGE_OTHER;
+    }
+}
+
+// -- Callback -- //
+static GlDebugMessage* find_message(GLenum source, GLenum type, GLuint id, int* created) {
+    unsigned int hash = (id * 2654435761u) ^ (source * 40503u) ^ type;
+    *created = 0;
+    for (int probe = 0; probe < TABLE_SIZE; probe++) {
+        short* slot = &debug.table[(hash + probe) & (TABLE_SIZE - 1)];
+        if (*slot) {
+            GlDebugMessage* message = &debug.messages[*slot - 1];
+            if (message->id == id && message->source == source && message->type == type) {
+                return message;
+            }
+            continue;
+        }
+        if (debug.message_count == GL_DEBUG_MAX_MESSAGES) {
+            return NULL;
+        }
+        *slot = (short)(++debug.message_count);
+        *created = 1;
+        return &debug.messages[*slot - 1];
+    }
+    return NULL;
+}
+
+static void APIENTRY on_message(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                GLsizei length, const GLchar* text, const void* user) {
+    (void)user;
+    // our own debug groups and markers are not diagnostics
+    if (type == GL_DEBUG_TYPE_PUSH_GROUP || type == GL_DEBUG_TYPE_POP_GROUP || type == GL_DEBUG_TYPE_MARKER) {
+        return;
+    }
+    GlMessageClass message_class = classify(type);
+    debug.current.messages++;
+    debug.current.by_class[message_class]++;
+    debug.totals[message_class]++;
+
+    int created;
+    GlDebugMessage* message = find_message(source, type, id, &created);
+    if (!message) {
+        debug.dropped++;
+        return;
+    }
+    if (created) {
+        message->source = source;
+        message->type = type;
+        message->id = id;
+        message->severity = severity;
+        message->message_class = message_class;
+        message->first_frame = debug.frame;
+        message->last_frame = debug.frame;
+        message->frames = 1;
+
+        size_t size = length < 0 ? strlen(text) : (size_t)length;
+        while (size && (text[size - 1] == '\n' || text[size - 1] == '\0')) {
+            size--;
+        }
+        size = size < GL_DEBUG_TEXT_SIZE - 1 ? size : GL_DEBUG_TEXT_SIZE - 1;
+        memcpy(message->text, text, size);
+        message->text[size] = '\0';
+
+        if (!debug.current.new_messages) {
+            debug.first_new = (int)(message - debug.messages);
+        }
+        debug.current.new_messages++;
+    } else if (message->last_frame != debug.frame) {
+        message->last_frame = debug.frame;
+        message->frames++;
+    }
+    message->count++;
+}
+
+// -- Install -- //
+int gl_debug_install(void) {
+    if (debug.installed) {
+        return 0;
+    }
+    if (!glad_glDebugMessageCallback || !glad_glDebugMessageControl) {
+        printf("ERROR::GL_DEBUG::NOT_SUPPORTED (needs GL 4.3 or KHR_debug)\n");
+        return -1;
+    }
+    GLint flags = 0;
+    glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+    if (!(flags & GL_CONTEXT_FLAG_DEBUG_BIT)) {
+        printf("gl debug: not a debug context, the driver may leave messages out\n");
+    }
+
+    glEnable(GL_DEBUG_OUTPUT);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glDebugMessageCallback(on_message, NULL);
+    // low severity is off by default, and that is where most performance warnings are
+    glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+    debug.installed = 1;
+    return 0;
+}
+
+void gl_debug_uninstall(void) {
+    if (!debug.installed) {
+        return;
+    }
+    glDebugMessageCallback(NULL, NULL);
+    glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glDisable(GL_DEBUG_OUTPUT);
+    debug.installed = 0;
+}
+
+int gl_debug_installed(void) {
+    return debug.installed;
+}
+
+// -- Frames -- //
+void gl_debug_frame(void) {
+    if (!debug.installed) {
+        return;
+    }
+    debug.current.frame = debug.frame;
+    if (debug.current.new_messages) {
+        const GlDebugFrameStats* stats = &debug.current;
+        printf("gl debug: frame %lu: %lu messages (", stats->frame, stats->messages);
+        const char* separator = "";
+        for (int i = 0; i < GL_MESSAGE_CLASSES; i++) {
+            if (stats->by_class[i]) {
+                printf("%s%lu %s", separator, stats->by_class[i], gl_debug_class_name((GlMessageClass)i));
+                separator = ", ";
+            }
+        }
+        printf("), %lu new\n", stats->new_messages);
+
+        // messages are appended, so every one from first_new on is new
+        for (int i = debug.first_new; i < debug.message_count; i++) {
+            const GlDebugMessage* message = &debug.messages[i];
+            printf("  [%s %s %s 0x%x] %s\n", gl_debug_class_name(message->message_class),
+                   severity_name(message->severity), source_name(message->source), message->id, message->text);
+        }
+    }
+    debug.last = debug.current;
+    memset(&debug.current, 0, sizeof(debug.current));
+    debug.frame++;
+}
+
+GlDebugFrameStats gl_debug_last_frame(void) {
+    return debug.last;
+}
+
+void gl_debug_reset(void) {
+    int installed = debug.installed;
+    memset(&debug, 0, sizeof(debug));
+    debug.installed = installed;
+}
+
+const GlDebugMessage* gl_debug_messages(int* count) {
+    *count = debug.message_count;
+    return debug.messages;
+}
+
+// -- Report -- //
+static int compare_count(const void* a, const void* b) {
+    const GlDebugMessage* x = *(const GlDebugMessage* const*)a;
+    const GlDebugMessage* y = *(const GlDebugMessage* const*)b;
+    if (x->count != y->count) {
+        return (x->count < y->count) - (x->count > y->count);
+    }
+    return (int)x->message_class - (int)y->message_class;
+}
+
+void gl_debug_report(void) {
+    unsigned long total = 0;
+    for (int i = 0; i < GL_MESSAGE_CLASSES; i++) {
+        total += debug.totals[i];
+    }
+    printf("gl debug: %lu messages, %d distinct, over %lu frames", total, debug.message_count, debug.frame);
+    if (debug.dropped) {
+        printf(" (%lu from messages past the first %d not itemized)", debug.dropped, GL_DEBUG_MAX_MESSAGES);
+    }
+    printf("\n");
+    if (!total) {
+        return;
+    }
+    for (int i = 0; i < GL_MESSAGE_CLASSES; i++) {
+        if (debug.totals[i]) {
+            printf("  %-12s %10lu\n", gl_debug_class_name((GlMessageClass)i), debug.totals[i]);
+        }
+    }
+
+    const GlDebugMessage* sorted[GL_DEBUG_MAX_MESSAGES];
+    for (int i = 0; i < debug.message_count; i++) {
+        sorted[i] = &debug.messages[i];
+    }
+    qsort(sorted, debug.message_count, sizeof(sorted[0]), compare_count);
+
+    printf("  %-12s %-6s %-8s %10s %10s %8s %10s  %s\n", "class", "level", "id", "count", "frames", "first", "per frame", "message");
+    for (int i = 0; i < debug.message_count; i++) {
+        const GlDebugMessage* message = sorted[i];
+        printf("  %-12s %-6s 0x%-6x %10lu %10lu %8lu %10.2f  %s\n", gl_debug_class_name(message->message_class),
+               severity_name(message->severity), message->id, message->count, message->frames, message->first_frame,
+               (double)message->count / message->frames, message->text);
+    }
+}
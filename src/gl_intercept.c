@@ -0,0 +1,173 @@
+#include "gl_intercept.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gl_capture.h"
+
+#ifdef GSL_GL_INTERCEPT
+
+// src/gl_intercept_wrappers.c
+extern GlCallStats gl_intercept_calls[];
+extern const int gl_intercept_call_count;
+int gl_intercept_swap(int install);
+
+static int installed = 0;
+static GlFrameStats frame_stats;
+
+int gl_intercept_install(void) {
+    if (!installed) {
+        gl_intercept_swap(1);
+        installed = 1;
+    }
+    return 0;
+}
+
+void gl_intercept_uninstall(void) {
+    if (installed) {
+        gl_intercept_swap(0);
+        installed = 0;
+    }
+}
+
+int gl_intercept_installed(void) {
+    return installed;
+}
+
+void gl_intercept_frame(void) {
+    if (!installed) {
+        return;
+    }
+    unsigned long calls = 0;
+    uint64_t time_ns = 0;
+    for (int i = 0; i < gl_intercept_call_count; i++) {
+        GlCallStats* stats = &gl_intercept_calls[i];
+        if (!stats->frame_calls) {
+            continue;
+        }
+        calls += stats->frame_calls;
+        time_ns += stats->frame_time_ns;
+        stats->calls += stats->frame_calls;
+        stats->time_ns += stats->frame_time_ns;
+        stats->frame_calls = 0;
+        stats->frame_time_ns = 0;
+    }
+
+    frame_stats.frames++;
+    frame_stats.calls += calls;
+    frame_stats.time_ns += time_ns;
+    frame_stats.last_calls = calls;
+    frame_stats.last_time_ns = time_ns;
+    frame_stats.max_calls = calls > frame_stats.max_calls ? calls : frame_stats.max_calls;
+    frame_stats.max_time_ns = time_ns > frame_stats.max_time_ns ? time_ns : frame_stats.max_time_ns;
+    gl_capture_frame();
+}
+
+void gl_intercept_reset(void) {
+    for (int i = 0; i < gl_intercept_call_count; i++) {
+        GlCallStats* stats = &gl_intercept_calls[i];
+        stats->calls = 0;
+        stats->time_ns = 0;
+        stats->frame_calls = 0;
+        stats->frame_time_ns = 0;
+    }
+    memset(&frame_stats, 0, sizeof(frame_stats));
+}
+
+const GlCallStats* gl_intercept_stats(int* count) {
+    *count = gl_intercept_call_count;
+    return gl_intercept_calls;
+}
+
+GlFrameStats gl_intercept_frame_stats(void) {
+    return frame_stats;
+}
+
+// -- Report -- //
+static int compare_time(const void* a, const void* b) {
+    const GlCallStats* x = *(const GlCallStats* const*)a;
+    const GlCallStats* y = *(const GlCallStats* const*)b;
+    uint64_t tx = x->time_ns + x->frame_time_ns, ty = y->time_ns + y->frame_time_ns;
+    return (tx < ty) - (tx > ty);
+}
+
+void gl_intercept_report(int top) {
+    const GlCallStats** used = (const GlCallStats**)malloc(gl_intercept_call_count * sizeof(GlCallStats*));
+    if (!used) {
+        return;
+    }
+    int used_count = 0;
+    uint64_t total_ns = 0;
+    for (int i = 0; i < gl_intercept_call_count; i++) {
+        const GlCallStats* stats = &gl_intercept_calls[i];
+        if (stats->calls + stats->frame_calls) {
+            used[used_count++] = stats;
+            total_ns += stats->time_ns + stats->frame_time_ns;
+        }
+    }
+    qsort(used, used_count, sizeof(used[0]), compare_time);
+
+    // calls made after the last gl_intercept_frame count in the totals, not in the frames
+    double frames = frame_stats.frames ? (double)frame_stats.frames : 1.0;
+    printf("gl calls: %d functions used, %.3f ms inside GL", used_count, total_ns / 1e6);
+    if (frame_stats.frames) {
+        printf(", %lu frames: %.1f calls and %.3f ms per frame (max %lu calls, %.3f ms)",
+               frame_stats.frames, frame_stats.calls / frames, frame_stats.time_ns / 1e6 / frames,
+               frame_stats.max_calls, frame_stats.max_time_ns / 1e6);
+    }
+    printf("\n  %-36s %12s %12s %12s %10s %7s\n", "function", "calls", frame_stats.frames ? "per frame" : "", "total ms", "ns/call", "time");
+
+    for (int i = 0; i < used_count && i < top; i++) {
+        const GlCallStats* stats = used[i];
+        unsigned long calls = stats->calls + stats->frame_calls;
+        uint64_t time_ns = stats->time_ns + stats->frame_time_ns;
+        printf("  %-36s %12lu ", stats->name, calls);
+        if (frame_stats.frames) {
+            printf("%12.1f ", stats->calls / frames);
+        } else {
+            printf("%12s ", "");
+        }
+        printf("%12.3f %10.0f %6.1f%%\n", time_ns / 1e6, (double)time_ns / calls, total_ns ? 100.0 * time_ns / total_ns : 0.0);
+    }
+    free(used);
+}
+
+#else
+
+int gl_intercept_install(void) {
+    printf("ERROR::GL_INTERCEPT::NOT_COMPILED (configure with -DGSL_GL_INTERCEPT=ON)\n");
+    return -1;
+}
+
+void gl_intercept_uninstall(void) {
+}
+
+int gl_intercept_installed(void) {
+    return 0;
+}
+
+void gl_intercept_frame(void) {
+}
+
+void gl_intercept_get_integerv(GLenum pname, GLint* data) {
+    glGetIntegerv(pname, data);
+}
+
+void gl_intercept_reset(void) {
+}
+
+const GlCallStats* gl_intercept_stats(int* count) {
+    *count = 0;
+    return NULL;
+}
+
+GlFrameStats gl_intercept_frame_stats(void) {
+    GlFrameStats stats;
+    memset(&stats, 0, sizeof(stats));
+    return stats;
+}
+
+void gl_intercept_report(int top) {
+    (void)top;
+}
+
+#endif // GSL_GL_INTERCEPT
@@ -0,0 +1,15100 @@
+// generated by tools/gl_intercept.py from include/glad/glad.h, do not edit
+#include "gl_intercept.h"
+#include <time.h>
+#include "gl_capture.h"
+
+#define FUNCTION_COUNT 1049
+
+GlCallStats gl_intercept_calls[FUNCTION_COUNT] = {
+    { "glCullFace", 0, 0, 0, 0 },
+    { "glFrontFace", 0, 0, 0, 0 },
+    { "glHint", 0, 0, 0, 0 },
+    { "glLineWidth", 0, 0, 0, 0 },
+    { "glPointSize", 0, 0, 0, 0 },
+    { "glPolygonMode", 0, 0, 0, 0 },
+    { "glScissor", 0, 0, 0, 0 },
+    { "glTexParameterf", 0, 0, 0, 0 },
+    { "glTexParameterfv", 0, 0, 0, 0 },
+    { "glTexParameteri", 0, 0, 0, 0 },
+    { "glTexParameteriv", 0, 0, 0, 0 },
+    { "glTexImage1D", 0, 0, 0, 0 },
+    { "glTexImage2D", 0, 0, 0, 0 },
+    { "glDrawBuffer", 0, 0, 0, 0 },
+    { "glClear", 0, 0, 0, 0 },
+    { "glClearColor", 0, 0, 0, 0 },
+    { "glClearStencil", 0, 0, 0, 0 },
+    { "glClearDepth", 0, 0, 0, 0 },
+    { "glStencilMask", 0, 0, 0, 0 },
+    { "glColorMask", 0, 0, 0, 0 },
+    { "glDepthMask", 0, 0, 0, 0 },
+    { "glDisable", 0, 0, 0, 0 },
+    { "glEnable", 0, 0, 0, 0 },
+    { "glFinish", 0, 0, 0, 0 },
+    { "glFlush", 0, 0, 0, 0 },
+    { "glBlendFunc", 0, 0, 0, 0 },
+    { "glLogicOp", 0, 0, 0, 0 },
+    { "glStencilFunc", 0, 0, 0, 0 },
+    { "glStencilOp", 0, 0, 0, 0 },
+    { "glDepthFunc", 0, 0, 0, 0 },
+    { "glPixelStoref", 0, 0, 0, 0 },
+    { "glPixelStorei", 0, 0, 0, 0 },
+    { "glReadBuffer", 0, 0, 0, 0 },
+    { "glReadPixels", 0, 0, 0, 0 },
+    { "glGetBooleanv", 0, 0, 0, 0 },
+    { "glGetDoublev", 0, 0, 0, 0 },
+    { "glGetError", 0, 0, 0, 0 },
+    { "glGetFloatv", 0, 0, 0, 0 },
+    { "glGetIntegerv", 0, 0, 0, 0 },
+    { "glGetString", 0, 0, 0, 0 },
+    { "glGetTexImage", 0, 0, 0, 0 },
+    { "glGetTexParameterfv", 0, 0, 0, 0 },
+    { "glGetTexParameteriv", 0, 0, 0, 0 },
+    { "glGetTexLevelParameterfv", 0, 0, 0, 0 },
+    { "glGetTexLevelParameteriv", 0, 0, 0, 0 },
+    { "glIsEnabled", 0, 0, 0, 0 },
+    { "glDepthRange", 0, 0, 0, 0 },
+    { "glViewport", 0, 0, 0, 0 },
+    { "glNewList", 0, 0, 0, 0 },
+    { "glEndList", 0, 0, 0, 0 },
+    { "glCallList", 0, 0, 0, 0 },
+    { "glCallLists", 0, 0, 0, 0 },
+    { "glDeleteLists", 0, 0, 0, 0 },
+    { "glGenLists", 0, 0, 0, 0 },
+    { "glListBase", 0, 0, 0, 0 },
+    { "glBegin", 0, 0, 0, 0 },
+    { "glBitmap", 0, 0, 0, 0 },
+    { "glColor3b", 0, 0, 0, 0 },
+    { "glColor3bv", 0, 0, 0, 0 },
+    { "glColor3d", 0, 0, 0, 0 },
+    { "glColor3dv", 0, 0, 0, 0 },
+    { "glColor3f", 0, 0, 0, 0 },
+    { "glColor3fv", 0, 0, 0, 0 },
+    { "glColor3i", 0, 0, 0, 0 },
+    { "glColor3iv", 0, 0, 0, 0 },
+    { "glColor3s", 0, 0, 0, 0 },
+    { "glColor3sv", 0, 0, 0, 0 },
+    { "glColor3ub", 0, 0, 0, 0 },
+    { "glColor3ubv", 0, 0, 0, 0 },
+    { "glColor3ui", 0, 0, 0, 0 },
+    { "glColor3uiv", 0, 0, 0, 0 },
+    { "glColor3us", 0, 0, 0, 0 },
+    { "glColor3usv", 0, 0, 0, 0 },
+    { "glColor4b", 0, 0, 0, 0 },
+    { "glColor4bv", 0, 0, 0, 0 },
+    { "glColor4d", 0, 0, 0, 0 },
+    { "glColor4dv", 0, 0, 0, 0 },
+    { "glColor4f", 0, 0, 0, 0 },
+    { "glColor4fv", 0, 0, 0, 0 },
+    { "glColor4i", 0, 0, 0, 0 },
+    { "glColor4iv", 0, 0, 0, 0 },
+    { "glColor4s", 0, 0, 0, 0 },
+    { "glColor4sv", 0, 0, 0, 0 },
+    { "glColor4ub", 0, 0, 0, 0 },
+    { "glColor4ubv", 0, 0, 0, 0 },
+    { "glColor4ui", 0, 0, 0, 0 },
+    { "glColor4uiv", 0, 0, 0, 0 },
+    { "glColor4us", 0, 0, 0, 0 },
+    { "glColor4usv", 0, 0, 0, 0 },
+    { "glEdgeFlag", 0, 0, 0, 0 },
+    { "glEdgeFlagv", 0, 0, 0, 0 },
+    { "glEnd", 0, 0, 0, 0 },
+    { "glIndexd", 0, 0, 0, 0 },
+    { "glIndexdv", 0, 0, 0, 0 },
+    { "glIndexf", 0, 0, 0, 0 },
+    { "glIndexfv", 0, 0, 0, 0 },
+    { "glIndexi", 0, 0, 0, 0 },
+    { "glIndexiv", 0, 0, 0, 0 },
+    { "glIndexs", 0, 0, 0, 0 },
+    { "glIndexsv", 0, 0, 0, 0 },
+    { "glNormal3b", 0, 0, 0, 0 },
+    { "glNormal3bv", 0, 0, 0, 0 },
+    { "glNormal3d", 0, 0, 0, 0 },
+    { "glNormal3dv", 0, 0, 0, 0 },
+    { "glNormal3f", 0, 0, 0, 0 },
+    { "glNormal3fv", 0, 0, 0, 0 },
+    { "glNormal3i", 0, 0, 0, 0 },
+    { "glNormal3iv", 0, 0, 0, 0 },
+    { "glNormal3s", 0, 0, 0, 0 },
+    { "glNormal3sv", 0, 0, 0, 0 },
+    { "glRasterPos2d", 0, 0, 0, 0 },
+    { "glRasterPos2dv", 0, 0, 0, 0 },
+    { "glRasterPos2f", 0, 0, 0, 0 },
+    { "glRasterPos2fv", 0, 0, 0, 0 },
+    { "glRasterPos2i", 0, 0, 0, 0 },
+    { "glRasterPos2iv", 0, 0, 0, 0 },
+    { "glRasterPos2s", 0, 0, 0, 0 },
+    { "glRasterPos2sv", 0, 0, 0, 0 },
+    { "glRasterPos3d", 0, 0, 0, 0 },
+    { "glRasterPos3dv", 0, 0, 0, 0 },
+    { "glRasterPos3f", 0, 0, 0, 0 },
+    { "glRasterPos3fv", 0, 0, 0, 0 },
+    { "glRasterPos3i", 0, 0, 0, 0 },
+    { "glRasterPos3iv", 0, 0, 0, 0 },
+    { "glRasterPos3s", 0, 0, 0, 0 },
+    { "glRasterPos3sv", 0, 0, 0, 0 },
+    { "glRasterPos4d", 0, 0, 0, 0 },
+    { "glRasterPos4dv", 0, 0, 0, 0 },
+    { "glRasterPos4f", 0, 0, 0, 0 },
+    { "glRasterPos4fv", 0, 0, 0, 0 },
+    { "glRasterPos4i", 0, 0, 0, 0 },
+    { "glRasterPos4iv", 0, 0, 0, 0 },
+    { "glRasterPos4s", 0, 0, 0, 0 },
+    { "glRasterPos4sv", 0, 0, 0, 0 },
+    { "glRectd", 0, 0, 0, 0 },
+    { "glRectdv", 0, 0, 0, 0 },
+    { "glRectf", 0, 0, 0, 0 },
+    { "glRectfv", 0, 0, 0, 0 },
+    { "glRecti", 0, 0, 0, 0 },
+    { "glRectiv", 0, 0, 0, 0 },
+    { "glRects", 0, 0, 0, 0 },
+    { "glRectsv", 0, 0, 0, 0 },
+    { "glTexCoord1d", 0, 0, 0, 0 },
+    { "glTexCoord1dv", 0, 0, 0, 0 },
+    { "glTexCoord1f", 0, 0, 0, 0 },
+    { "glTexCoord1fv", 0, 0, 0, 0 },
+    { "glTexCoord1i", 0, 0, 0, 0 },
+    { "glTexCoord1iv", 0, 0, 0, 0 },
+    { "glTexCoord1s", 0, 0, 0, 0 },
+    { "glTexCoord1sv", 0, 0, 0, 0 },
+    { "glTexCoord2d", 0, 0, 0, 0 },
+    { "glTexCoord2dv", 0, 0, 0, 0 },
+    { "glTexCoord2f", 0, 0, 0, 0 },
+    { "glTexCoord2fv", 0, 0, 0, 0 },
+    { "glTexCoord2i", 0, 0, 0, 0 },
+    { "glTexCoord2iv", 0, 0, 0, 0 },
+    { "glTexCoord2s", 0, 0, 0, 0 },
+    { "glTexCoord2sv", 0, 0, 0, 0 },
+    { "glTexCoord3d", 0, 0, 0, 0 },
+    { "glTexCoord3dv", 0, 0, 0, 0 },
+    { "glTexCoord3f", 0, 0, 0, 0 },
+    { "glTexCoord3fv", 0, 0, 0, 0 },
+    { "glTexCoord3i", 0, 0, 0, 0 },
+    { "glTexCoord3iv", 0, 0, 0, 0 },
+    { "glTexCoord3s", 0, 0, 0, 0 },
+    { "glTexCoord3sv", 0, 0, 0, 0 },
+    { "glTexCoord4d", 0, 0, 0, 0 },
+    { "glTexCoord4dv", 0, 0, 0, 0 },
+    { "glTexCoord4f", 0, 0, 0, 0 },
+    { "glTexCoord4fv", 0, 0, 0, 0 },
+    { "glTexCoord4i", 0, 0, 0, 0 },
+    { "glTexCoord4iv", 0, 0, 0, 0 },
+    { "glTexCoord4s", 0, 0, 0, 0 },
+    { "glTexCoord4sv", 0, 0, 0, 0 },
+    { "glVertex2d", 0, 0, 0, 0 },
+    { "glVertex2dv", 0, 0, 0, 0 },
+    { "glVertex2f", 0, 0, 0, 0 },
+    { "glVertex2fv", 0, 0, 0, 0 },
+    { "glVertex2i", 0, 0, 0, 0 },
+    { "glVertex2iv", 0, 0, 0, 0 },
+    { "glVertex2s", 0, 0, 0, 0 },
+    { "glVertex2sv", 0, 0, 0, 0 },
+    { "glVertex3d", 0, 0, 0, 0 },
+    { "glVertex3dv", 0, 0, 0, 0 },
+    { "glVertex3f", 0, 0, 0, 0 },
+    { "glVertex3fv", 0, 0, 0, 0 },
+    { "glVertex3i", 0, 0, 0, 0 },
+    { "glVertex3iv", 0, 0, 0, 0 },
+    { "glVertex3s", 0, 0, 0, 0 },
+    { "glVertex3sv", 0, 0, 0, 0 },
+    { "glVertex4d", 0, 0, 0, 0 },
+    { "glVertex4dv", 0, 0, 0, 0 },
+    { "glVertex4f", 0, 0, 0, 0 },
+    { "glVertex4fv", 0, 0, 0, 0 },
+    { "glVertex4i", 0, 0, 0, 0 },
+    { "glVertex4iv", 0, 0, 0, 0 },
+    { "glVertex4s", 0, 0, 0, 0 },
+    { "glVertex4sv", 0, 0, 0, 0 },
+    { "glClipPlane", 0, 0, 0, 0 },
+    { "glColorMaterial", 0, 0, 0, 0 },
+    { "glFogf", 0, 0, 0, 0 },
+    { "glFogfv", 0, 0, 0, 0 },
+    { "glFogi", 0, 0, 0, 0 },
+    { "glFogiv", 0, 0, 0, 0 },
+    { "glLightf", 0, 0, 0, 0 },
+    { "glLightfv", 0, 0, 0, 0 },
+    { "glLighti", 0, 0, 0, 0 },
+    { "glLightiv", 0, 0, 0, 0 },
+    { "glLightModelf", 0, 0, 0, 0 },
+    { "glLightModelfv", 0, 0, 0, 0 },
+    { "glLightModeli", 0, 0, 0, 0 },
+    { "glLightModeliv", 0, 0, 0, 0 },
+    { "glLineStipple", 0, 0, 0, 0 },
+    { "glMaterialf", 0, 0, 0, 0 },
+    { "glMaterialfv", 0, 0, 0, 0 },
+    { "glMateriali", 0, 0, 0, 0 },
+    { "glMaterialiv", 0, 0, 0, 0 },
+    { "glPolygonStipple", 0, 0, 0, 0 },
+    { "glShadeModel", 0, 0, 0, 0 },
+    { "glTexEnvf", 0, 0, 0, 0 },
+    { "glTexEnvfv", 0, 0, 0, 0 },
+    { "glTexEnvi", 0, 0, 0, 0 },
+    { "glTexEnviv", 0, 0, 0, 0 },
+    { "glTexGend", 0, 0, 0, 0 },
+    { "glTexGendv", 0, 0, 0, 0 },
+    { "glTexGenf", 0, 0, 0, 0 },
+    { "glTexGenfv", 0, 0, 0, 0 },
+    { "glTexGeni", 0, 0, 0, 0 },
+    { "glTexGeniv", 0, 0, 0, 0 },
+    { "glFeedbackBuffer", 0, 0, 0, 0 },
+    { "glSelectBuffer", 0, 0, 0, 0 },
+    { "glRenderMode", 0, 0, 0, 0 },
+    { "glInitNames", 0, 0, 0, 0 },
+    { "glLoadName", 0, 0, 0, 0 },
+    { "glPassThrough", 0, 0, 0, 0 },
+    { "glPopName", 0, 0, 0, 0 },
+    { "glPushName", 0, 0, 0, 0 },
+    { "glClearAccum", 0, 0, 0, 0 },
+    { "glClearIndex", 0, 0, 0, 0 },
+    { "glIndexMask", 0, 0, 0, 0 },
+    { "glAccum", 0, 0, 0, 0 },
+    { "glPopAttrib", 0, 0, 0, 0 },
+    { "glPushAttrib", 0, 0, 0, 0 },
+    { "glMap1d", 0, 0, 0, 0 },
+    { "glMap1f", 0, 0, 0, 0 },
+    { "glMap2d", 0, 0, 0, 0 },
+    { "glMap2f", 0, 0, 0, 0 },
+    { "glMapGrid1d", 0, 0, 0, 0 },
+    { "glMapGrid1f", 0, 0, 0, 0 },
+    { "glMapGrid2d", 0, 0, 0, 0 },
+    { "glMapGrid2f", 0, 0, 0, 0 },
+    { "glEvalCoord1d", 0, 0, 0, 0 },
+    { "glEvalCoord1dv", 0, 0, 0, 0 },
+    { "glEvalCoord1f", 0, 0, 0, 0 },
+    { "glEvalCoord1fv", 0, 0, 0, 0 },
+    { "glEvalCoord2d", 0, 0, 0, 0 },
+    { "glEvalCoord2dv", 0, 0, 0, 0 },
+    { "glEvalCoord2f", 0, 0, 0, 0 },
+    { "glEvalCoord2fv", 0, 0, 0, 0 },
+    { "glEvalMesh1", 0, 0, 0, 0 },
+    { "glEvalPoint1", 0, 0, 0, 0 },
+    { "glEvalMesh2", 0, 0, 0, 0 },
+    { "glEvalPoint2", 0, 0, 0, 0 },
+    { "glAlphaFunc", 0, 0, 0, 0 },
+    { "glPixelZoom", 0, 0, 0, 0 },
+    { "glPixelTransferf", 0, 0, 0, 0 },
+    { "glPixelTransferi", 0, 0, 0, 0 },
+    { "glPixelMapfv", 0, 0, 0, 0 },
+    { "glPixelMapuiv", 0, 0, 0, 0 },
+    { "glPixelMapusv", 0, 0, 0, 0 },
+    { "glCopyPixels", 0, 0, 0, 0 },
+    { "glDrawPixels", 0, 0, 0, 0 },
+    { "glGetClipPlane", 0, 0, 0, 0 },
+    { "glGetLightfv", 0, 0, 0, 0 },
+    { "glGetLightiv", 0, 0, 0, 0 },
+    { "glGetMapdv", 0, 0, 0, 0 },
+    { "glGetMapfv", 0, 0, 0, 0 },
+    { "glGetMapiv", 0, 0, 0, 0 },
+    { "glGetMaterialfv", 0, 0, 0, 0 },
+    { "glGetMaterialiv", 0, 0, 0, 0 },
+    { "glGetPixelMapfv", 0, 0, 0, 0 },
+    { "glGetPixelMapuiv", 0, 0, 0, 0 },
+    { "glGetPixelMapusv", 0, 0, 0, 0 },
+    { "glGetPolygonStipple", 0, 0, 0, 0 },
+    { "glGetTexEnvfv", 0, 0, 0, 0 },
+    { "glGetTexEnviv", 0, 0, 0, 0 },
+    { "glGetTexGendv", 0, 0, 0, 0 },
+    { "glGetTexGenfv", 0, 0, 0, 0 },
+    { "glGetTexGeniv", 0, 0, 0, 0 },
+    { "glIsList", 0, 0, 0, 0 },
+    { "glFrustum", 0, 0, 0, 0 },
+    { "glLoadIdentity", 0, 0, 0, 0 },
+    { "glLoadMatrixf", 0, 0, 0, 0 },
+    { "glLoadMatrixd", 0, 0, 0, 0 },
+    { "glMatrixMode", 0, 0, 0, 0 },
+    { "glMultMatrixf", 0, 0, 0, 0 },
+    { "glMultMatrixd", 0, 0, 0, 0 },
+    { "glOrtho", 0, 0, 0, 0 },
+    { "glPopMatrix", 0, 0, 0, 0 },
+    { "glPushMatrix", 0, 0, 0, 0 },
+    { "glRotated", 0, 0, 0, 0 },
+    { "glRotatef", 0, 0, 0, 0 },
+    { "glScaled", 0, 0, 0, 0 },
+    { "glScalef", 0, 0, 0, 0 },
+    { "glTranslated", 0, 0, 0, 0 },
+    { "glTranslatef", 0, 0, 0, 0 },
+    { "glDrawArrays", 0, 0, 0, 0 },
+    { "glDrawElements", 0, 0, 0, 0 },
+    { "glGetPointerv", 0, 0, 0, 0 },
+    { "glPolygonOffset", 0, 0, 0, 0 },
+    { "glCopyTexImage1D", 0, 0, 0, 0 },
+    { "glCopyTexImage2D", 0, 0, 0, 0 },
+    { "glCopyTexSubImage1D", 0, 0, 0, 0 },
+    { "glCopyTexSubImage2D", 0, 0, 0, 0 },
+    { "glTexSubImage1D", 0, 0, 0, 0 },
+    { "glTexSubImage2D", 0, 0, 0, 0 },
+    { "glBindTexture", 0, 0, 0, 0 },
+    { "glDeleteTextures", 0, 0, 0, 0 },
+    { "glGenTextures", 0, 0, 0, 0 },
+    { "glIsTexture", 0, 0, 0, 0 },
+    { "glArrayElement", 0, 0, 0, 0 },
+    { "glColorPointer", 0, 0, 0, 0 },
+    { "glDisableClientState", 0, 0, 0, 0 },
+    { "glEdgeFlagPointer", 0, 0, 0, 0 },
+    { "glEnableClientState", 0, 0, 0, 0 },
+    { "glIndexPointer", 0, 0, 0, 0 },
+    { "glInterleavedArrays", 0, 0, 0, 0 },
+    { "glNormalPointer", 0, 0, 0, 0 },
+    { "glTexCoordPointer", 0, 0, 0, 0 },
+    { "glVertexPointer", 0, 0, 0, 0 },
+    { "glAreTexturesResident", 0, 0, 0, 0 },
+    { "glPrioritizeTextures", 0, 0, 0, 0 },
+    { "glIndexub", 0, 0, 0, 0 },
+    { "glIndexubv", 0, 0, 0, 0 },
+    { "glPopClientAttrib", 0, 0, 0, 0 },
+    { "glPushClientAttrib", 0, 0, 0, 0 },
+    { "glDrawRangeElements", 0, 0, 0, 0 },
+    { "glTexImage3D", 0, 0, 0, 0 },
+    { "glTexSubImage3D", 0, 0, 0, 0 },
+    { "glCopyTexSubImage3D", 0, 0, 0, 0 },
+    { "glActiveTexture", 0, 0, 0, 0 },
+    { "glSampleCoverage", 0, 0, 0, 0 },
+    { "glCompressedTexImage3D", 0, 0, 0, 0 },
+    { "glCompressedTexImage2D", 0, 0, 0, 0 },
+    { "glCompressedTexImage1D", 0, 0, 0, 0 },
+    { "glCompressedTexSubImage3D", 0, 0, 0, 0 },
+    { "glCompressedTexSubImage2D", 0, 0, 0, 0 },
+    { "glCompressedTexSubImage1D", 0, 0, 0, 0 },
+    { "glGetCompressedTexImage", 0, 0, 0, 0 },
+    { "glClientActiveTexture", 0, 0, 0, 0 },
+    { "glMultiTexCoord1d", 0, 0, 0, 0 },
+    { "glMultiTexCoord1dv", 0, 0, 0, 0 },
+    { "glMultiTexCoord1f", 0, 0, 0, 0 },
+    { "glMultiTexCoord1fv", 0, 0, 0, 0 },
+    { "glMultiTexCoord1i", 0, 0, 0, 0 },
+    { "glMultiTexCoord1iv", 0, 0, 0, 0 },
+    { "glMultiTexCoord1s", 0, 0, 0, 0 },
+    { "glMultiTexCoord1sv", 0, 0, 0, 0 },
+    { "glMultiTexCoord2d", 0, 0, 0, 0 },
+    { "glMultiTexCoord2dv", 0, 0, 0, 0 },
+    { "glMultiTexCoord2f", 0, 0, 0, 0 },
+    { "glMultiTexCoord2fv", 0, 0, 0, 0 },
+    { "glMultiTexCoord2i", 0, 0, 0, 0 },
+    { "glMultiTexCoord2iv", 0, 0, 0, 0 },
+    { "glMultiTexCoord2s", 0, 0, 0, 0 },
+    { "glMultiTexCoord2sv", 0, 0, 0, 0 },
+    { "glMultiTexCoord3d", 0, 0, 0, 0 },
+    { "glMultiTexCoord3dv", 0, 0, 0, 0 },
+    { "glMultiTexCoord3f", 0, 0, 0, 0 },
+    { "glMultiTexCoord3fv", 0, 0, 0, 0 },
+    { "glMultiTexCoord3i", 0, 0, 0, 0 },
+    { "glMultiTexCoord3iv", 0, 0, 0, 0 },
+    { "glMultiTexCoord3s", 0, 0, 0, 0 },
+    { "glMultiTexCoord3sv", 0, 0, 0, 0 },
+    { "glMultiTexCoord4d", 0, 0, 0, 0 },
+    { "glMultiTexCoord4dv", 0, 0, 0, 0 },
+    { "glMultiTexCoord4f", 0, 0, 0, 0 },
+    { "glMultiTexCoord4fv", 0, 0, 0, 0 },
+    { "glMultiTexCoord4i", 0, 0, 0, 0 },
+    { "glMultiTexCoord4iv", 0, 0, 0, 0 },
+    { "glMultiTexCoord4s", 0, 0, 0, 0 },
+    { "glMultiTexCoord4sv", 0, 0, 0, 0 },
+    { "glLoadTransposeMatrixf", 0, 0, 0, 0 },
+    { "glLoadTransposeMatrixd", 0, 0, 0, 0 },
+    { "glMultTransposeMatrixf", 0, 0, 0, 0 },
+    { "glMultTransposeMatrixd", 0, 0, 0, 0 },
+    { "glBlendFuncSeparate", 0, 0, 0, 0 },
+    { "glMultiDrawArrays", 0, 0, 0, 0 },
+    { "glMultiDrawElements", 0, 0, 0, 0 },
+    { "glPointParameterf", 0, 0, 0, 0 },
+    { "glPointParameterfv", 0, 0, 0, 0 },
+    { "glPointParameteri", 0, 0, 0, 0 },
+    { "glPointParameteriv", 0, 0, 0, 0 },
+    { "glFogCoordf", 0, 0, 0, 0 },
+    { "glFogCoordfv", 0, 0, 0, 0 },
+    { "glFogCoordd", 0, 0, 0, 0 },
+    { "glFogCoorddv", 0, 0, 0, 0 },
+    { "glFogCoordPointer", 0, 0, 0, 0 },
+    { "glSecondaryColor3b", 0, 0, 0, 0 },
+    { "glSecondaryColor3bv", 0, 0, 0, 0 },
+    { "glSecondaryColor3d", 0, 0, 0, 0 },
+    { "glSecondaryColor3dv", 0, 0, 0, 0 },
+    { "glSecondaryColor3f", 0, 0, 0, 0 },
+    { "glSecondaryColor3fv", 0, 0, 0, 0 },
+    { "glSecondaryColor3i", 0, 0, 0, 0 },
+    { "glSecondaryColor3iv", 0, 0, 0, 0 },
+    { "glSecondaryColor3s", 0, 0, 0, 0 },
+    { "glSecondaryColor3sv", 0, 0, 0, 0 },
+    { "glSecondaryColor3ub", 0, 0, 0, 0 },
+    { "glSecondaryColor3ubv", 0, 0, 0, 0 },
+    { "glSecondaryColor3ui", 0, 0, 0, 0 },
+    { "glSecondaryColor3uiv", 0, 0, 0, 0 },
+    { "glSecondaryColor3us", 0, 0, 0, 0 },
+    { "glSecondaryColor3usv", 0, 0, 0, 0 },
+    { "glSecondaryColorPointer", 0, 0, 0, 0 },
+    { "glWindowPos2d", 0, 0, 0, 0 },
+    { "glWindowPos2dv", 0, 0, 0, 0 },
+    { "glWindowPos2f", 0, 0, 0, 0 },
+    { "glWindowPos2fv", 0, 0, 0, 0 },
+    { "glWindowPos2i", 0, 0, 0, 0 },
+    { "glWindowPos2iv", 0, 0, 0, 0 },
+    { "glWindowPos2s", 0, 0, 0, 0 },
+    { "glWindowPos2sv", 0, 0, 0, 0 },
+    { "glWindowPos3d", 0, 0, 0, 0 },
+    { "glWindowPos3dv", 0, 0, 0, 0 },
+    { "glWindowPos3f", 0, 0, 0, 0 },
+    { "glWindowPos3fv", 0, 0, 0, 0 },
+    { "glWindowPos3i", 0, 0, 0, 0 },
+    { "glWindowPos3iv", 0, 0, 0, 0 },
+    { "glWindowPos3s", 0, 0, 0, 0 },
+    { "glWindowPos3sv", 0, 0, 0, 0 },
+    { "glBlendColor", 0, 0, 0, 0 },
+    { "glBlendEquation", 0, 0, 0, 0 },
+    { "glGenQueries", 0, 0, 0, 0 },
+    { "glDeleteQueries", 0, 0, 0, 0 },
+    { "glIsQuery", 0, 0, 0, 0 },
+    { "glBeginQuery", 0, 0, 0, 0 },
+    { "glEndQuery", 0, 0, 0, 0 },
+    { "glGetQueryiv", 0, 0, 0, 0 },
+    { "glGetQueryObjectiv", 0, 0, 0, 0 },
+    { "glGetQueryObjectuiv", 0, 0, 0, 0 },
+    { "glBindBuffer", 0, 0, 0, 0 },
+    { "glDeleteBuffers", 0, 0, 0, 0 },
+    { "glGenBuffers", 0, 0, 0, 0 },
+    { "glIsBuffer", 0, 0, 0, 0 },
+    { "glBufferData", 0, 0, 0, 0 },
+    { "glBufferSubData", 0, 0, 0, 0 },
+    { "glGetBufferSubData", 0, 0, 0, 0 },
+    { "glMapBuffer", 0, 0, 0, 0 },
+    { "glUnmapBuffer", 0, 0, 0, 0 },
+    { "glGetBufferParameteriv", 0, 0, 0, 0 },
+    { "glGetBufferPointerv", 0, 0, 0, 0 },
+    { "glBlendEquationSeparate", 0, 0, 0, 0 },
+    { "glDrawBuffers", 0, 0, 0, 0 },
+    { "glStencilOpSeparate", 0, 0, 0, 0 },
+    { "glStencilFuncSeparate", 0, 0, 0, 0 },
+    { "glStencilMaskSeparate", 0, 0, 0, 0 },
+    { "glAttachShader", 0, 0, 0, 0 },
+    { "glBindAttribLocation", 0, 0, 0, 0 },
+    { "glCompileShader", 0, 0, 0, 0 },
+    { "glCreateProgram", 0, 0, 0, 0 },
+    { "glCreateShader", 0, 0, 0, 0 },
+    { "glDeleteProgram", 0, 0, 0, 0 },
+    { "glDeleteShader", 0, 0, 0, 0 },
+    { "glDetachShader", 0, 0, 0, 0 },
+    { "glDisableVertexAttribArray", 0, 0, 0, 0 },
+    { "glEnableVertexAttribArray", 0, 0, 0, 0 },
+    { "glGetActiveAttrib", 0, 0, 0, 0 },
+    { "glGetActiveUniform", 0, 0, 0, 0 },
+    { "glGetAttachedShaders", 0, 0, 0, 0 },
+    { "glGetAttribLocation", 0, 0, 0, 0 },
+    { "glGetProgramiv", 0, 0, 0, 0 },
+    { "glGetProgramInfoLog", 0, 0, 0, 0 },
+    { "glGetShaderiv", 0, 0, 0, 0 },
+    { "glGetShaderInfoLog", 0, 0, 0, 0 },
+    { "glGetShaderSource", 0, 0, 0, 0 },
+    { "glGetUniformLocation", 0, 0, 0, 0 },
+    { "glGetUniformfv", 0, 0, 0, 0 },
+    { "glGetUniformiv", 0, 0, 0, 0 },
+    { "glGetVertexAttribdv", 0, 0, 0, 0 },
+    { "glGetVertexAttribfv", 0, 0, 0, 0 },
+    { "glGetVertexAttribiv", 0, 0, 0, 0 },
+    { "glGetVertexAttribPointerv", 0, 0, 0, 0 },
+    { "glIsProgram", 0, 0, 0, 0 },
+    { "glIsShader", 0, 0, 0, 0 },
+    { "glLinkProgram", 0, 0, 0, 0 },
+    { "glShaderSource", 0, 0, 0, 0 },
+    { "glUseProgram", 0, 0, 0, 0 },
+    { "glUniform1f", 0, 0, 0, 0 },
+    { "glUniform2f", 0, 0, 0, 0 },
+    { "glUniform3f", 0, 0, 0, 0 },
+    { "glUniform4f", 0, 0, 0, 0 },
+    { "glUniform1i", 0, 0, 0, 0 },
+    { "glUniform2i", 0, 0, 0, 0 },
+    { "glUniform3i", 0, 0, 0, 0 },
+    { "glUniform4i", 0, 0, 0, 0 },
+    { "glUniform1fv", 0, 0, 0, 0 },
+    { "glUniform2fv", 0, 0, 0, 0 },
+    { "glUniform3fv", 0, 0, 0, 0 },
+    { "glUniform4fv", 0, 0, 0, 0 },
+    { "glUniform1iv", 0, 0, 0, 0 },
+    { "glUniform2iv", 0, 0, 0, 0 },
+    { "glUniform3iv", 0, 0, 0, 0 },
+    { "glUniform4iv", 0, 0, 0, 0 },
+    { "glUniformMatrix2fv", 0, 0, 0, 0 },
+    { "glUniformMatrix3fv", 0, 0, 0, 0 },
+    { "glUniformMatrix4fv", 0, 0, 0, 0 },
+    { "glValidateProgram", 0, 0, 0, 0 },
+    { "glVertexAttrib1d", 0, 0, 0, 0 },
+    { "glVertexAttrib1dv", 0, 0, 0, 0 },
+    { "glVertexAttrib1f", 0, 0, 0, 0 },
+    { "glVertexAttrib1fv", 0, 0, 0, 0 },
+    { "glVertexAttrib1s", 0, 0, 0, 0 },
+    { "glVertexAttrib1sv", 0, 0, 0, 0 },
+    { "glVertexAttrib2d", 0, 0, 0, 0 },
+    { "glVertexAttrib2dv", 0, 0, 0, 0 },
+    { "glVertexAttrib2f", 0, 0, 0, 0 },
+    { "glVertexAttrib2fv", 0, 0, 0, 0 },
+    { "glVertexAttrib2s", 0, 0, 0, 0 },
+    { "glVertexAttrib2sv", 0, 0, 0, 0 },
+    { "glVertexAttrib3d", 0, 0, 0, 0 },
+    { "glVertexAttrib3dv", 0, 0, 0, 0 },
+    { "glVertexAttrib3f", 0, 0, 0, 0 },
+    { "glVertexAttrib3fv", 0, 0, 0, 0 },
+    { "glVertexAttrib3s", 0, 0, 0, 0 },
+    { "glVertexAttrib3sv", 0, 0, 0, 0 },
+    { "glVertexAttrib4Nbv", 0, 0, 0, 0 },
+    { "glVertexAttrib4Niv", 0, 0, 0, 0 },
+    { "glVertexAttrib4Nsv", 0, 0, 0, 0 },
+    { "glVertexAttrib4Nub", 0, 0, 0, 0 },
+    { "glVertexAttrib4Nubv", 0, 0, 0, 0 },
+    { "glVertexAttrib4Nuiv", 0, 0, 0, 0 },
+    { "glVertexAttrib4Nusv", 0, 0, 0, 0 },
+    { "glVertexAttrib4bv", 0, 0, 0, 0 },
+    { "glVertexAttrib4d", 0, 0, 0, 0 },
+    { "glVertexAttrib4dv", 0, 0, 0, 0 },
+    { "glVertexAttrib4f", 0, 0, 0, 0 },
+    { "glVertexAttrib4fv", 0, 0, 0, 0 },
+    { "glVertexAttrib4iv", 0, 0, 0, 0 },
+    { "glVertexAttrib4s", 0, 0, 0, 0 },
+    { "glVertexAttrib4sv", 0, 0, 0, 0 },
+    { "glVertexAttrib4ubv", 0, 0, 0, 0 },
+    { "glVertexAttrib4uiv", 0, 0, 0, 0 },
+    { "glVertexAttrib4usv", 0, 0, 0, 0 },
+    { "glVertexAttribPointer", 0, 0, 0, 0 },
+    { "glUniformMatrix2x3fv", 0, 0, 0, 0 },
+    { "glUniformMatrix3x2fv", 0, 0, 0, 0 },
+    { "glUniformMatrix2x4fv", 0, 0, 0, 0 },
+    { "glUniformMatrix4x2fv", 0, 0, 0, 0 },
+    { "glUniformMatrix3x4fv", 0, 0, 0, 0 },
+    { "glUniformMatrix4x3fv", 0, 0, 0, 0 },
+    { "glColorMaski", 0, 0, 0, 0 },
+    { "glGetBooleani_v", 0, 0, 0, 0 },
+    { "glGetIntegeri_v", 0, 0, 0, 0 },
+    { "glEnablei", 0, 0, 0, 0 },
+    { "glDisablei", 0, 0, 0, 0 },
+    { "glIsEnabledi", 0, 0, 0, 0 },
+    { "glBeginTransformFeedback", 0, 0, 0, 0 },
+    { "glEndTransformFeedback", 0, 0, 0, 0 },
+    { "glBindBufferRange", 0, 0, 0, 0 },
+    { "glBindBufferBase", 0, 0, 0, 0 },
+    { "glTransformFeedbackVaryings", 0, 0, 0, 0 },
+    { "glGetTransformFeedbackVarying", 0, 0, 0, 0 },
+    { "glClampColor", 0, 0, 0, 0 },
+    { "glBeginConditionalRender", 0, 0, 0, 0 },
+    { "glEndConditionalRender", 0, 0, 0, 0 },
+    { "glVertexAttribIPointer", 0, 0, 0, 0 },
+    { "glGetVertexAttribIiv", 0, 0, 0, 0 },
+    { "glGetVertexAttribIuiv", 0, 0, 0, 0 },
+    { "glVertexAttribI1i", 0, 0, 0, 0 },
+    { "glVertexAttribI2i", 0, 0, 0, 0 },
+    { "glVertexAttribI3i", 0, 0, 0, 0 },
+    { "glVertexAttribI4i", 0, 0, 0, 0 },
+    { "glVertexAttribI1ui", 0, 0, 0, 0 },
+    { "glVertexAttribI2ui", 0, 0, 0, 0 },
+    { "glVertexAttribI3ui", 0, 0, 0, 0 },
+    { "glVertexAttribI4ui", 0, 0, 0, 0 },
+    { "glVertexAttribI1iv", 0, 0, 0, 0 },
+    { "glVertexAttribI2iv", 0, 0, 0, 0 },
+    { "glVertexAttribI3iv", 0, 0, 0, 0 },
+    { "glVertexAttribI4iv", 0, 0, 0, 0 },
+    { "glVertexAttribI1uiv", 0, 0, 0, 0 },
+    { "glVertexAttribI2uiv", 0, 0, 0, 0 },
+    { "glVertexAttribI3uiv", 0, 0, 0, 0 },
+    { "glVertexAttribI4uiv", 0, 0, 0, 0 },
+    { "glVertexAttribI4bv", 0, 0, 0, 0 },
+    { "glVertexAttribI4sv", 0, 0, 0, 0 },
+    { "glVertexAttribI4ubv", 0, 0, 0, 0 },
+    { "glVertexAttribI4usv", 0, 0, 0, 0 },
+    { "glGetUniformuiv", 0, 0, 0, 0 },
+    { "glBindFragDataLocation", 0, 0, 0, 0 },
+    { "glGetFragDataLocation", 0, 0, 0, 0 },
+    { "glUniform1ui", 0, 0, 0, 0 },
+    { "glUniform2ui", 0, 0, 0, 0 },
+    { "glUniform3ui", 0, 0, 0, 0 },
+    { "glUniform4ui", 0, 0, 0, 0 },
+    { "glUniform1uiv", 0, 0, 0, 0 },
+    { "glUniform2uiv", 0, 0, 0, 0 },
+    { "glUniform3uiv", 0, 0, 0, 0 },
+    { "glUniform4uiv", 0, 0, 0, 0 },
+    { "glTexParameterIiv", 0, 0, 0, 0 },
+    { "glTexParameterIuiv", 0, 0, 0, 0 },
+    { "glGetTexParameterIiv", 0, 0, 0, 0 },
+    { "glGetTexParameterIuiv", 0, 0, 0, 0 },
+    { "glClearBufferiv", 0, 0, 0, 0 },
+    { "glClearBufferuiv", 0, 0, 0, 0 },
+    { "glClearBufferfv", 0, 0, 0, 0 },
+    { "glClearBufferfi", 0, 0, 0, 0 },
+    { "glGetStringi", 0, 0, 0, 0 },
+    { "glIsRenderbuffer", 0, 0, 0, 0 },
+    { "glBindRenderbuffer", 0, 0, 0, 0 },
+    { "glDeleteRenderbuffers", 0, 0, 0, 0 },
+    { "glGenRenderbuffers", 0, 0, 0, 0 },
+    { "glRenderbufferStorage", 0, 0, 0, 0 },
+    { "glGetRenderbufferParameteriv", 0, 0, 0, 0 },
+    { "glIsFramebuffer", 0, 0, 0, 0 },
+    { "glBindFramebuffer", 0, 0, 0, 0 },
+    { "glDeleteFramebuffers", 0, 0, 0, 0 },
+    { "glGenFramebuffers", 0, 0, 0, 0 },
+    { "glCheckFramebufferStatus", 0, 0, 0, 0 },
+    { "glFramebufferTexture1D", 0, 0, 0, 0 },
+    { "glFramebufferTexture2D", 0, 0, 0, 0 },
+    { "glFramebufferTexture3D", 0, 0, 0, 0 },
+    { "glFramebufferRenderbuffer", 0, 0, 0, 0 },
+    { "glGetFramebufferAttachmentParameteriv", 0, 0, 0, 0 },
+    { "glGenerateMipmap", 0, 0, 0, 0 },
+    { "glBlitFramebuffer", 0, 0, 0, 0 },
+    { "glRenderbufferStorageMultisample", 0, 0, 0, 0 },
+    { "glFramebufferTextureLayer", 0, 0, 0, 0 },
+    { "glMapBufferRange", 0, 0, 0, 0 },
+    { "glFlushMappedBufferRange", 0, 0, 0, 0 },
+    { "glBindVertexArray", 0, 0, 0, 0 },
+    { "glDeleteVertexArrays", 0, 0, 0, 0 },
+    { "glGenVertexArrays", 0, 0, 0, 0 },
+    { "glIsVertexArray", 0, 0, 0, 0 },
+    { "glDrawArraysInstanced", 0, 0, 0, 0 },
+    { "glDrawElementsInstanced", 0, 0, 0, 0 },
+    { "glTexBuffer", 0, 0, 0, 0 },
+    { "glPrimitiveRestartIndex", 0, 0, 0, 0 },
+    { "glCopyBufferSubData", 0, 0, 0, 0 },
+    { "glGetUniformIndices", 0, 0, 0, 0 },
+    { "glGetActiveUniformsiv", 0, 0, 0, 0 },
+    { "glGetActiveUniformName", 0, 0, 0, 0 },
+    { "glGetUniformBlockIndex", 0, 0, 0, 0 },
+    { "glGetActiveUniformBlockiv", 0, 0, 0, 0 },
+    { "glGetActiveUniformBlockName", 0, 0, 0, 0 },
+    { "glUniformBlockBinding", 0, 0, 0, 0 },
+    { "glDrawElementsBaseVertex", 0, 0, 0, 0 },
+    { "glDrawRangeElementsBaseVertex", 0, 0, 0, 0 },
+    { "glDrawElementsInstancedBaseVertex", 0, 0, 0, 0 },
+    { "glMultiDrawElementsBaseVertex", 0, 0, 0, 0 },
+    { "glProvokingVertex", 0, 0, 0, 0 },
+    { "glFenceSync", 0, 0, 0, 0 },
+    { "glIsSync", 0, 0, 0, 0 },
+    { "glDeleteSync", 0, 0, 0, 0 },
+    { "glClientWaitSync", 0, 0, 0, 0 },
+    { "glWaitSync", 0, 0, 0, 0 },
+    { "glGetInteger64v", 0, 0, 0, 0 },
+    { "glGetSynciv", 0, 0, 0, 0 },
+    { "glGetInteger64i_v", 0, 0, 0, 0 },
+    { "glGetBufferParameteri64v", 0, 0, 0, 0 },
+    { "glFramebufferTexture", 0, 0, 0, 0 },
+    { "glTexImage2DMultisample", 0, 0, 0, 0 },
+    { "glTexImage3DMultisample", 0, 0, 0, 0 },
+    { "glGetMultisamplefv", 0, 0, 0, 0 },
+    { "glSampleMaski", 0, 0, 0, 0 },
+    { "glBindFragDataLocationIndexed", 0, 0, 0, 0 },
+    { "glGetFragDataIndex", 0, 0, 0, 0 },
+    { "glGenSamplers", 0, 0, 0, 0 },
+    { "glDeleteSamplers", 0, 0, 0, 0 },
+    { "glIsSampler", 0, 0, 0, 0 },
+    { "glBindSampler", 0, 0, 0, 0 },
+    { "glSamplerParameteri", 0, 0, 0, 0 },
+    { "glSamplerParameteriv", 0, 0, 0, 0 },
+    { "glSamplerParameterf", 0, 0, 0, 0 },
+    { "glSamplerParameterfv", 0, 0, 0, 0 },
+    { "glSamplerParameterIiv", 0, 0, 0, 0 },
+    { "glSamplerParameterIuiv", 0, 0, 0, 0 },
+    { "glGetSamplerParameteriv", 0, 0, 0, 0 },
+    { "glGetSamplerParameterIiv", 0, 0, 0, 0 },
+    { "glGetSamplerParameterfv", 0, 0, 0, 0 },
+    { "glGetSamplerParameterIuiv", 0, 0, 0, 0 },
+    { "glQueryCounter", 0, 0, 0, 0 },
+    { "glGetQueryObjecti64v", 0, 0, 0, 0 },
+    { "glGetQueryObjectui64v", 0, 0, 0, 0 },
+    { "glVertexAttribDivisor", 0, 0, 0, 0 },
+    { "glVertexAttribP1ui", 0, 0, 0, 0 },
+    { "glVertexAttribP1uiv", 0, 0, 0, 0 },
+    { "glVertexAttribP2ui", 0, 0, 0, 0 },
+    { "glVertexAttribP2uiv", 0, 0, 0, 0 },
+    { "glVertexAttribP3ui", 0, 0, 0, 0 },
+    { "glVertexAttribP3uiv", 0, 0, 0, 0 },
+    { "glVertexAttribP4ui", 0, 0, 0, 0 },
+    { "glVertexAttribP4uiv", 0, 0, 0, 0 },
+    { "glVertexP2ui", 0, 0, 0, 0 },
+    { "glVertexP2uiv", 0, 0, 0, 0 },
+    { "glVertexP3ui", 0, 0, 0, 0 },
+    { "glVertexP3uiv", 0, 0, 0, 0 },
+    { "glVertexP4ui", 0, 0, 0, 0 },
+    { "glVertexP4uiv", 0, 0, 0, 0 },
+    { "glTexCoordP1ui", 0, 0, 0, 0 },
+    { "glTexCoordP1uiv", 0, 0, 0, 0 },
+    { "glTexCoordP2ui", 0, 0, 0, 0 },
+    { "glTexCoordP2uiv", 0, 0, 0, 0 },
+    { "glTexCoordP3ui", 0, 0, 0, 0 },
+    { "glTexCoordP3uiv", 0, 0, 0, 0 },
+    { "glTexCoordP4ui", 0, 0, 0, 0 },
+    { "glTexCoordP4uiv", 0, 0, 0, 0 },
+    { "glMultiTexCoordP1ui", 0, 0, 0, 0 },
+    { "glMultiTexCoordP1uiv", 0, 0, 0, 0 },
+    { "glMultiTexCoordP2ui", 0, 0, 0, 0 },
+    { "glMultiTexCoordP2uiv", 0, 0, 0, 0 },
+    { "glMultiTexCoordP3ui", 0, 0, 0, 0 },
+    { "glMultiTexCoordP3uiv", 0, 0, 0, 0 },
+    { "glMultiTexCoordP4ui", 0, 0, 0, 0 },
+    { "glMultiTexCoordP4uiv", 0, 0, 0, 0 },
+    { "glNormalP3ui", 0, 0, 0, 0 },
+    { "glNormalP3uiv", 0, 0, 0, 0 },
+    { "glColorP3ui", 0, 0, 0, 0 },
+    { "glColorP3uiv", 0, 0, 0, 0 },
+    { "glColorP4ui", 0, 0, 0, 0 },
+    { "glColorP4uiv", 0, 0, 0, 0 },
+    { "glSecondaryColorP3ui", 0, 0, 0, 0 },
+    { "glSecondaryColorP3uiv", 0, 0, 0, 0 },
+    { "glMinSampleShading", 0, 0, 0, 0 },
+    { "glBlendEquationi", 0, 0, 0, 0 },
+    { "glBlendEquationSeparatei", 0, 0, 0, 0 },
+    { "glBlendFunci", 0, 0, 0, 0 },
+    { "glBlendFuncSeparatei", 0, 0, 0, 0 },
+    { "glDrawArraysIndirect", 0, 0, 0, 0 },
+    { "glDrawElementsIndirect", 0, 0, 0, 0 },
+    { "glUniform1d", 0, 0, 0, 0 },
+    { "glUniform2d", 0, 0, 0, 0 },
+    { "glUniform3d", 0, 0, 0, 0 },
+    { "glUniform4d", 0, 0, 0, 0 },
+    { "glUniform1dv", 0, 0, 0, 0 },
+    { "glUniform2dv", 0, 0, 0, 0 },
+    { "glUniform3dv", 0, 0, 0, 0 },
+    { "glUniform4dv", 0, 0, 0, 0 },
+    { "glUniformMatrix2dv", 0, 0, 0, 0 },
+    { "glUniformMatrix3dv", 0, 0, 0, 0 },
+    { "glUniformMatrix4dv", 0, 0, 0, 0 },
+    { "glUniformMatrix2x3dv", 0, 0, 0, 0 },
+    { "glUniformMatrix2x4dv", 0, 0, 0, 0 },
+    { "glUniformMatrix3x2dv", 0, 0, 0, 0 },
+    { "glUniformMatrix3x4dv", 0, 0, 0, 0 },
+    { "glUniformMatrix4x2dv", 0, 0, 0, 0 },
+    { "glUniformMatrix4x3dv", 0, 0, 0, 0 },
+    { "glGetUniformdv", 0, 0, 0, 0 },
+    { "glGetSubroutineUniformLocation", 0, 0, 0, 0 },
+    { "glGetSubroutineIndex", 0, 0, 0, 0 },
+    { "glGetActiveSubroutineUniformiv", 0, 0, 0, 0 },
+    { "glGetActiveSubroutineUniformName", 0, 0, 0, 0 },
+    { "glGetActiveSubroutineName", 0, 0, 0, 0 },
+    { "glUniformSubroutinesuiv", 0, 0, 0, 0 },
+    { "glGetUniformSubroutineuiv", 0, 0, 0, 0 },
+    { "glGetProgramStageiv", 0, 0, 0, 0 },
+    { "glPatchParameteri", 0, 0, 0, 0 },
+    { "glPatchParameterfv", 0, 0, 0, 0 },
+    { "glBindTransformFeedback", 0, 0, 0, 0 },
+    { "glDeleteTransformFeedbacks", 0, 0, 0, 0 },
+    { "glGenTransformFeedbacks", 0, 0, 0, 0 },
+    { "glIsTransformFeedback", 0, 0, 0, 0 },
+    { "glPauseTransformFeedback", 0, 0, 0, 0 },
+    { "glResumeTransformFeedback", 0, 0, 0, 0 },
+    { "glDrawTransformFeedback", 0, 0, 0, 0 },
+    { "glDrawTransformFeedbackStream", 0, 0, 0, 0 },
+    { "glBeginQueryIndexed", 0, 0, 0, 0 },
+    { "glEndQueryIndexed", 0, 0, 0, 0 },
+    { "glGetQueryIndexediv", 0, 0, 0, 0 },
+    { "glReleaseShaderCompiler", 0, 0, 0, 0 },
+    { "glShaderBinary", 0, 0, 0, 0 },
+    { "glGetShaderPrecisionFormat", 0, 0, 0, 0 },
+    { "glDepthRangef", 0, 0, 0, 0 },
+    { "glClearDepthf", 0, 0, 0, 0 },
+    { "glGetProgramBinary", 0, 0, 0, 0 },
+    { "glProgramBinary", 0, 0, 0, 0 },
+    { "glProgramParameteri", 0, 0, 0, 0 },
+    { "glUseProgramStages", 0, 0, 0, 0 },
+    { "glActiveShaderProgram", 0, 0, 0, 0 },
+    { "glCreateShaderProgramv", 0, 0, 0, 0 },
+    { "glBindProgramPipeline", 0, 0, 0, 0 },
+    { "glDeleteProgramPipelines", 0, 0, 0, 0 },
+    { "glGenProgramPipelines", 0, 0, 0, 0 },
+    { "glIsProgramPipeline", 0, 0, 0, 0 },
+    { "glGetProgramPipelineiv", 0, 0, 0, 0 },
+    { "glProgramUniform1i", 0, 0, 0, 0 },
+    { "glProgramUniform1iv", 0, 0, 0, 0 },
+    { "glProgramUniform1f", 0, 0, 0, 0 },
+    { "glProgramUniform1fv", 0, 0, 0, 0 },
+    { "glProgramUniform1d", 0, 0, 0, 0 },
+    { "glProgramUniform1dv", 0, 0, 0, 0 },
+    { "glProgramUniform1ui", 0, 0, 0, 0 },
+    { "glProgramUniform1uiv", 0, 0, 0, 0 },
+    { "glProgramUniform2i", 0, 0, 0, 0 },
+    { "glProgramUniform2iv", 0, 0, 0, 0 },
+    { "glProgramUniform2f", 0, 0, 0, 0 },
+    { "glProgramUniform2fv", 0, 0, 0, 0 },
+    { "glProgramUniform2d", 0, 0, 0, 0 },
+    { "glProgramUniform2dv", 0, 0, 0, 0 },
+    { "glProgramUniform2ui", 0, 0, 0, 0 },
+    { "glProgramUniform2uiv", 0, 0, 0, 0 },
+    { "glProgramUniform3i", 0, 0, 0, 0 },
+    { "glProgramUniform3iv", 0, 0, 0, 0 },
+    { "glProgramUniform3f", 0, 0, 0, 0 },
+    { "glProgramUniform3fv", 0, 0, 0, 0 },
+    { "glProgramUniform3d", 0, 0, 0, 0 },
+    { "glProgramUniform3dv", 0, 0, 0, 0 },
+    { "glProgramUniform3ui", 0, 0, 0, 0 },
+    { "glProgramUniform3uiv", 0, 0, 0, 0 },
+    { "glProgramUniform4i", 0, 0, 0, 0 },
+    { "glProgramUniform4iv", 0, 0, 0, 0 },
+    { "glProgramUniform4f", 0, 0, 0, 0 },
+    { "glProgramUniform4fv", 0, 0, 0, 0 },
+    { "glProgramUniform4d", 0, 0, 0, 0 },
+    { "glProgramUniform4dv", 0, 0, 0, 0 },
+    { "glProgramUniform4ui", 0, 0, 0, 0 },
+    { "glProgramUniform4uiv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix2fv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix3fv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix4fv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix2dv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix3dv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix4dv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix2x3fv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix3x2fv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix2x4fv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix4x2fv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix3x4fv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix4x3fv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix2x3dv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix3x2dv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix2x4dv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix4x2dv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix3x4dv", 0, 0, 0, 0 },
+    { "glProgramUniformMatrix4x3dv", 0, 0, 0, 0 },
+    { "glValidateProgramPipeline", 0, 0, 0, 0 },
+    { "glGetProgramPipelineInfoLog", 0, 0, 0, 0 },
+    { "glVertexAttribL1d", 0, 0, 0, 0 },
+    { "glVertexAttribL2d", 0, 0, 0, 0 },
+    { "glVertexAttribL3d", 0, 0, 0, 0 },
+    { "glVertexAttribL4d", 0, 0, 0, 0 },
+    { "glVertexAttribL1dv", 0, 0, 0, 0 },
+    { "glVertexAttribL2dv", 0, 0, 0, 0 },
+    { "glVertexAttribL3dv", 0, 0, 0, 0 },
+    { "glVertexAttribL4dv", 0, 0, 0, 0 },
+    { "glVertexAttribLPointer", 0, 0, 0, 0 },
+    { "glGetVertexAttribLdv", 0, 0, 0, 0 },
+    { "glViewportArrayv", 0, 0, 0, 0 },
+    { "glViewportIndexedf", 0, 0, 0, 0 },
+    { "glViewportIndexedfv", 0, 0, 0, 0 },
+    { "glScissorArrayv", 0, 0, 0, 0 },
+    { "glScissorIndexed", 0, 0, 0, 0 },
+    { "glScissorIndexedv", 0, 0, 0, 0 },
+    { "glDepthRangeArrayv", 0, 0, 0, 0 },
+    { "glDepthRangeIndexed", 0, 0, 0, 0 },
+    { "glGetFloati_v", 0, 0, 0, 0 },
+    { "glGetDoublei_v", 0, 0, 0, 0 },
+    { "glDrawArraysInstancedBaseInstance", 0, 0, 0, 0 },
+    { "glDrawElementsInstancedBaseInstance", 0, 0, 0, 0 },
+    { "glDrawElementsInstancedBaseVertexBaseInstance", 0, 0, 0, 0 },
+    { "glGetInternalformativ", 0, 0, 0, 0 },
+    { "glGetActiveAtomicCounterBufferiv", 0, 0, 0, 0 },
+    { "glBindImageTexture", 0, 0, 0, 0 },
+    { "glMemoryBarrier", 0, 0, 0, 0 },
+    { "glTexStorage1D", 0, 0, 0, 0 },
+    { "glTexStorage2D", 0, 0, 0, 0 },
+    { "glTexStorage3D", 0, 0, 0, 0 },
+    { "glDrawTransformFeedbackInstanced", 0, 0, 0, 0 },
+    { "glDrawTransformFeedbackStreamInstanced", 0, 0, 0, 0 },
+    { "glClearBufferData", 0, 0, 0, 0 },
+    { "glClearBufferSubData", 0, 0, 0, 0 },
+    { "glDispatchCompute", 0, 0, 0, 0 },
+    { "glDispatchComputeIndirect", 0, 0, 0, 0 },
+    { "glCopyImageSubData", 0, 0, 0, 0 },
+    { "glFramebufferParameteri", 0, 0, 0, 0 },
+    { "glGetFramebufferParameteriv", 0, 0, 0, 0 },
+    { "glGetInternalformati64v", 0, 0, 0, 0 },
+    { "glInvalidateTexSubImage", 0, 0, 0, 0 },
+    { "glInvalidateTexImage", 0, 0, 0, 0 },
+    { "glInvalidateBufferSubData", 0, 0, 0, 0 },
+    { "glInvalidateBufferData", 0, 0, 0, 0 },
+    { "glInvalidateFramebuffer", 0, 0, 0, 0 },
+    { "glInvalidateSubFramebuffer", 0, 0, 0, 0 },
+    { "glMultiDrawArraysIndirect", 0, 0, 0, 0 },
+    { "glMultiDrawElementsIndirect", 0, 0, 0, 0 },
+    { "glGetProgramInterfaceiv", 0, 0, 0, 0 },
+    { "glGetProgramResourceIndex", 0, 0, 0, 0 },
+    { "glGetProgramResourceName", 0, 0, 0, 0 },
+    { "glGetProgramResourceiv", 0, 0, 0, 0 },
+    { "glGetProgramResourceLocation", 0, 0, 0, 0 },
+    { "glGetProgramResourceLocationIndex", 0, 0, 0, 0 },
+    { "glShaderStorageBlockBinding", 0, 0, 0, 0 },
+    { "glTexBufferRange", 0, 0, 0, 0 },
+    { "glTexStorage2DMultisample", 0, 0, 0, 0 },
+    { "glTexStorage3DMultisample", 0, 0, 0, 0 },
+    { "glTextureView", 0, 0, 0, 0 },
+    { "glBindVertexBuffer", 0, 0, 0, 0 },
+    { "glVertexAttribFormat", 0, 0, 0, 0 },
+    { "glVertexAttribIFormat", 0, 0, 0, 0 },
+    { "glVertexAttribLFormat", 0, 0, 0, 0 },
+    { "glVertexAttribBinding", 0, 0, 0, 0 },
+    { "glVertexBindingDivisor", 0, 0, 0, 0 },
+    { "glDebugMessageControl", 0, 0, 0, 0 },
+    { "glDebugMessageInsert", 0, 0, 0, 0 },
+    { "glDebugMessageCallback", 0, 0, 0, 0 },
+    { "glGetDebugMessageLog", 0, 0, 0, 0 },
+    { "glPushDebugGroup", 0, 0, 0, 0 },
+    { "glPopDebugGroup", 0, 0, 0, 0 },
+    { "glObjectLabel", 0, 0, 0, 0 },
+    { "glGetObjectLabel", 0, 0, 0, 0 },
+    { "glObjectPtrLabel", 0, 0, 0, 0 },
+    { "glGetObjectPtrLabel", 0, 0, 0, 0 },
+    { "glBufferStorage", 0, 0, 0, 0 },
+    { "glClearTexImage", 0, 0, 0, 0 },
+    { "glClearTexSubImage", 0, 0, 0, 0 },
+    { "glBindBuffersBase", 0, 0, 0, 0 },
+    { "glBindBuffersRange", 0, 0, 0, 0 },
+    { "glBindTextures", 0, 0, 0, 0 },
+    { "glBindSamplers", 0, 0, 0, 0 },
+    { "glBindImageTextures", 0, 0, 0, 0 },
+    { "glBindVertexBuffers", 0, 0, 0, 0 },
+    { "glClipControl", 0, 0, 0, 0 },
+    { "glCreateTransformFeedbacks", 0, 0, 0, 0 },
+    { "glTransformFeedbackBufferBase", 0, 0, 0, 0 },
+    { "glTransformFeedbackBufferRange", 0, 0, 0, 0 },
+    { "glGetTransformFeedbackiv", 0, 0, 0, 0 },
+    { "glGetTransformFeedbacki_v", 0, 0, 0, 0 },
+    { "glGetTransformFeedbacki64_v", 0, 0, 0, 0 },
+    { "glCreateBuffers", 0, 0, 0, 0 },
+    { "glNamedBufferStorage", 0, 0, 0, 0 },
+    { "glNamedBufferData", 0, 0, 0, 0 },
+    { "glNamedBufferSubData", 0, 0, 0, 0 },
+    { "glCopyNamedBufferSubData", 0, 0, 0, 0 },
+    { "glClearNamedBufferData", 0, 0, 0, 0 },
+    { "glClearNamedBufferSubData", 0, 0, 0, 0 },
+    { "glMapNamedBuffer", 0, 0, 0, 0 },
+    { "glMapNamedBufferRange", 0, 0, 0, 0 },
+    { "glUnmapNamedBuffer", 0, 0, 0, 0 },
+    { "glFlushMappedNamedBufferRange", 0, 0, 0, 0 },
+    { "glGetNamedBufferParameteriv", 0, 0, 0, 0 },
+    { "glGetNamedBufferParameteri64v", 0, 0, 0, 0 },
+    { "glGetNamedBufferPointerv", 0, 0, 0, 0 },
+    { "glGetNamedBufferSubData", 0, 0, 0, 0 },
+    { "glCreateFramebuffers", 0, 0, 0, 0 },
+    { "glNamedFramebufferRenderbuffer", 0, 0, 0, 0 },
+    { "glNamedFramebufferParameteri", 0, 0, 0, 0 },
+    { "glNamedFramebufferTexture", 0, 0, 0, 0 },
+    { "glNamedFramebufferTextureLayer", 0, 0, 0, 0 },
+    { "glNamedFramebufferDrawBuffer", 0, 0, 0, 0 },
+    { "glNamedFramebufferDrawBuffers", 0, 0, 0, 0 },
+    { "glNamedFramebufferReadBuffer", 0, 0, 0, 0 },
+    { "glInvalidateNamedFramebufferData", 0, 0, 0, 0 },
+    { "glInvalidateNamedFramebufferSubData", 0, 0, 0, 0 },
+    { "glClearNamedFramebufferiv", 0, 0, 0, 0 },
+    { "glClearNamedFramebufferuiv", 0, 0, 0, 0 },
+    { "glClearNamedFramebufferfv", 0, 0, 0, 0 },
+    { "glClearNamedFramebufferfi", 0, 0, 0, 0 },
+    { "glBlitNamedFramebuffer", 0, 0, 0, 0 },
+    { "glCheckNamedFramebufferStatus", 0, 0, 0, 0 },
+    { "glGetNamedFramebufferParameteriv", 0, 0, 0, 0 },
+    { "glGetNamedFramebufferAttachmentParameteriv", 0, 0, 0, 0 },
+    { "glCreateRenderbuffers", 0, 0, 0, 0 },
+    { "glNamedRenderbufferStorage", 0, 0, 0, 0 },
+    { "glNamedRenderbufferStorageMultisample", 0, 0, 0, 0 },
+    { "glGetNamedRenderbufferParameteriv", 0, 0, 0, 0 },
+    { "glCreateTextures", 0, 0, 0, 0 },
+    { "glTextureBuffer", 0, 0, 0, 0 },
+    { "glTextureBufferRange", 0, 0, 0, 0 },
+    { "glTextureStorage1D", 0, 0, 0, 0 },
+    { "glTextureStorage2D", 0, 0, 0, 0 },
+    { "glTextureStorage3D", 0, 0, 0, 0 },
+    { "glTextureStorage2DMultisample", 0, 0, 0, 0 },
+    { "glTextureStorage3DMultisample", 0, 0, 0, 0 },
+    { "glTextureSubImage1D", 0, 0, 0, 0 },
+    { "glTextureSubImage2D", 0, 0, 0, 0 },
+    { "glTextureSubImage3D", 0, 0, 0, 0 },
+    { "glCompressedTextureSubImage1D", 0, 0, 0, 0 },
+    { "glCompressedTextureSubImage2D", 0, 0, 0, 0 },
+    { "glCompressedTextureSubImage3D", 0, 0, 0, 0 },
+    { "glCopyTextureSubImage1D", 0, 0, 0, 0 },
+    { "glCopyTextureSubImage2D", 0, 0, 0, 0 },
+    { "glCopyTextureSubImage3D", 0, 0, 0, 0 },
+    { "glTextureParameterf", 0, 0, 0, 0 },
+    { "glTextureParameterfv", 0, 0, 0, 0 },
+    { "glTextureParameteri", 0, 0, 0, 0 },
+    { "glTextureParameterIiv", 0, 0, 0, 0 },
+    { "glTextureParameterIuiv", 0, 0, 0, 0 },
+    { "glTextureParameteriv", 0, 0, 0, 0 },
+    { "glGenerateTextureMipmap", 0, 0, 0, 0 },
+    { "glBindTextureUnit", 0, 0, 0, 0 },
+    { "glGetTextureImage", 0, 0, 0, 0 },
+    { "glGetCompressedTextureImage", 0, 0, 0, 0 },
+    { "glGetTextureLevelParameterfv", 0, 0, 0, 0 },
+    { "glGetTextureLevelParameteriv", 0, 0, 0, 0 },
+    { "glGetTextureParameterfv", 0, 0, 0, 0 },
+    { "glGetTextureParameterIiv", 0, 0, 0, 0 },
+    { "glGetTextureParameterIuiv", 0, 0, 0, 0 },
+    { "glGetTextureParameteriv", 0, 0, 0, 0 },
+    { "glCreateVertexArrays", 0, 0, 0, 0 },
+    { "glDisableVertexArrayAttrib", 0, 0, 0, 0 },
+    { "glEnableVertexArrayAttrib", 0, 0, 0, 0 },
+    { "glVertexArrayElementBuffer", 0, 0, 0, 0 },
+    { "glVertexArrayVertexBuffer", 0, 0, 0, 0 },
+    { "glVertexArrayVertexBuffers", 0, 0, 0, 0 },
+    { "glVertexArrayAttribBinding", 0, 0, 0, 0 },
+    { "glVertexArrayAttribFormat", 0, 0, 0, 0 },
+    { "glVertexArrayAttribIFormat", 0, 0, 0, 0 },
+    { "glVertexArrayAttribLFormat", 0, 0, 0, 0 },
+    { "glVertexArrayBindingDivisor", 0, 0, 0, 0 },
+    { "glGetVertexArrayiv", 0, 0, 0, 0 },
+    { "glGetVertexArrayIndexediv", 0, 0, 0, 0 },
+    { "glGetVertexArrayIndexed64iv", 0, 0, 0, 0 },
+    { "glCreateSamplers", 0, 0, 0, 0 },
+    { "glCreateProgramPipelines", 0, 0, 0, 0 },
+    { "glCreateQueries", 0, 0, 0, 0 },
+    { "glGetQueryBufferObjecti64v", 0, 0, 0, 0 },
+    { "glGetQueryBufferObjectiv", 0, 0, 0, 0 },
+    { "glGetQueryBufferObjectui64v", 0, 0, 0, 0 },
+    { "glGetQueryBufferObjectuiv", 0, 0, 0, 0 },
+    { "glMemoryBarrierByRegion", 0, 0, 0, 0 },
+    { "glGetTextureSubImage", 0, 0, 0, 0 },
+    { "glGetCompressedTextureSubImage", 0, 0, 0, 0 },
+    { "glGetGraphicsResetStatus", 0, 0, 0, 0 },
+    { "glGetnCompressedTexImage", 0, 0, 0, 0 },
+    { "glGetnTexImage", 0, 0, 0, 0 },
+    { "glGetnUniformdv", 0, 0, 0, 0 },
+    { "glGetnUniformfv", 0, 0, 0, 0 },
+    { "glGetnUniformiv", 0, 0, 0, 0 },
+    { "glGetnUniformuiv", 0, 0, 0, 0 },
+    { "glReadnPixels", 0, 0, 0, 0 },
+    { "glGetnMapdv", 0, 0, 0, 0 },
+    { "glGetnMapfv", 0, 0, 0, 0 },
+    { "glGetnMapiv", 0, 0, 0, 0 },
+    { "glGetnPixelMapfv", 0, 0, 0, 0 },
+    { "glGetnPixelMapuiv", 0, 0, 0, 0 },
+    { "glGetnPixelMapusv", 0, 0, 0, 0 },
+    { "glGetnPolygonStipple", 0, 0, 0, 0 },
+    { "glGetnColorTable", 0, 0, 0, 0 },
+    { "glGetnConvolutionFilter", 0, 0, 0, 0 },
+    { "glGetnSeparableFilter", 0, 0, 0, 0 },
+    { "glGetnHistogram", 0, 0, 0, 0 },
+    { "glGetnMinmax", 0, 0, 0, 0 },
+    { "glTextureBarrier", 0, 0, 0, 0 },
+    { "glSpecializeShader", 0, 0, 0, 0 },
+    { "glMultiDrawArraysIndirectCount", 0, 0, 0, 0 },
+    { "glMultiDrawElementsIndirectCount", 0, 0, 0, 0 },
+    { "glPolygonOffsetClamp", 0, 0, 0, 0 },
+    { "glMaxShaderCompilerThreadsKHR", 0, 0, 0, 0 },
+};
+const int gl_intercept_call_count = FUNCTION_COUNT;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void record(int index, uint64_t start) {
+    uint64_t elapsed = now_ns() - start;
+    GlCallStats* stats = &gl_intercept_calls[index];
+    stats->frame_calls++;
+    stats->frame_time_ns += elapsed;
+}
+
+// -- Wrappers -- //
+static PFNGLCULLFACEPROC real_glCullFace;
+static void APIENTRY wrap_glCullFace(GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(0);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCullFace(mode);
+    record(0, intercept_start);
+}
+
+static PFNGLFRONTFACEPROC real_glFrontFace;
+static void APIENTRY wrap_glFrontFace(GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(1);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFrontFace(mode);
+    record(1, intercept_start);
+}
+
+static PFNGLHINTPROC real_glHint;
+static void APIENTRY wrap_glHint(GLenum target, GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(2);
+        gl_capture_u32(target);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glHint(target, mode);
+    record(2, intercept_start);
+}
+
+static PFNGLLINEWIDTHPROC real_glLineWidth;
+static void APIENTRY wrap_glLineWidth(GLfloat width) {
+    if (gl_capture_on) {
+        gl_capture_call(3);
+        gl_capture_f32(width);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLineWidth(width);
+    record(3, intercept_start);
+}
+
+static PFNGLPOINTSIZEPROC real_glPointSize;
+static void APIENTRY wrap_glPointSize(GLfloat size) {
+    if (gl_capture_on) {
+        gl_capture_call(4);
+        gl_capture_f32(size);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPointSize(size);
+    record(4, intercept_start);
+}
+
+static PFNGLPOLYGONMODEPROC real_glPolygonMode;
+static void APIENTRY wrap_glPolygonMode(GLenum face, GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(5);
+        gl_capture_u32(face);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPolygonMode(face, mode);
+    record(5, intercept_start);
+}
+
+static PFNGLSCISSORPROC real_glScissor;
+static void APIENTRY wrap_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(6);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glScissor(x, y, width, height);
+    record(6, intercept_start);
+}
+
+static PFNGLTEXPARAMETERFPROC real_glTexParameterf;
+static void APIENTRY wrap_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(7);
+        gl_capture_u32(target);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexParameterf(target, pname, param);
+    record(7, intercept_start);
+}
+
+static PFNGLTEXPARAMETERFVPROC real_glTexParameterfv;
+static void APIENTRY wrap_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(8);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexParameterfv(target, pname, params);
+    record(8, intercept_start);
+}
+
+static PFNGLTEXPARAMETERIPROC real_glTexParameteri;
+static void APIENTRY wrap_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(9);
+        gl_capture_u32(target);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexParameteri(target, pname, param);
+    record(9, intercept_start);
+}
+
+static PFNGLTEXPARAMETERIVPROC real_glTexParameteriv;
+static void APIENTRY wrap_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(10);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexParameteriv(target, pname, params);
+    record(10, intercept_start);
+}
+
+static PFNGLTEXIMAGE1DPROC real_glTexImage1D;
+static void APIENTRY wrap_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(11);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+    record(11, intercept_start);
+}
+
+static PFNGLTEXIMAGE2DPROC real_glTexImage2D;
+static void APIENTRY wrap_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if (gl_capture_on) {
+        gl_capture_call(12);
+        gl_capture_u32(target);
+        gl_capture_u32(level);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(border);
+        gl_capture_u32(format);
+        gl_capture_u32(type);
+        gl_capture_image(pixels, width, height, format, type);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+    record(12, intercept_start);
+}
+
+static PFNGLDRAWBUFFERPROC real_glDrawBuffer;
+static void APIENTRY wrap_glDrawBuffer(GLenum buf) {
+    if (gl_capture_on) {
+        gl_capture_call(13);
+        gl_capture_u32(buf);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawBuffer(buf);
+    record(13, intercept_start);
+}
+
+static PFNGLCLEARPROC real_glClear;
+static void APIENTRY wrap_glClear(GLbitfield mask) {
+    if (gl_capture_on) {
+        gl_capture_call(14);
+        gl_capture_u32(mask);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClear(mask);
+    record(14, intercept_start);
+}
+
+static PFNGLCLEARCOLORPROC real_glClearColor;
+static void APIENTRY wrap_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(15);
+        gl_capture_f32(red);
+        gl_capture_f32(green);
+        gl_capture_f32(blue);
+        gl_capture_f32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearColor(red, green, blue, alpha);
+    record(15, intercept_start);
+}
+
+static PFNGLCLEARSTENCILPROC real_glClearStencil;
+static void APIENTRY wrap_glClearStencil(GLint s) {
+    if (gl_capture_on) {
+        gl_capture_call(16);
+        gl_capture_u32(s);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearStencil(s);
+    record(16, intercept_start);
+}
+
+static PFNGLCLEARDEPTHPROC real_glClearDepth;
+static void APIENTRY wrap_glClearDepth(GLdouble depth) {
+    if (gl_capture_on) {
+        gl_capture_call(17);
+        gl_capture_f64(depth);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearDepth(depth);
+    record(17, intercept_start);
+}
+
+static PFNGLSTENCILMASKPROC real_glStencilMask;
+static void APIENTRY wrap_glStencilMask(GLuint mask) {
+    if (gl_capture_on) {
+        gl_capture_call(18);
+        gl_capture_u32(mask);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glStencilMask(mask);
+    record(18, intercept_start);
+}
+
+static PFNGLCOLORMASKPROC real_glColorMask;
+static void APIENTRY wrap_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(19);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+        gl_capture_u32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColorMask(red, green, blue, alpha);
+    record(19, intercept_start);
+}
+
+static PFNGLDEPTHMASKPROC real_glDepthMask;
+static void APIENTRY wrap_glDepthMask(GLboolean flag) {
+    if (gl_capture_on) {
+        gl_capture_call(20);
+        gl_capture_u32(flag);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDepthMask(flag);
+    record(20, intercept_start);
+}
+
+static PFNGLDISABLEPROC real_glDisable;
+static void APIENTRY wrap_glDisable(GLenum cap) {
+    if (gl_capture_on) {
+        gl_capture_call(21);
+        gl_capture_u32(cap);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDisable(cap);
+    record(21, intercept_start);
+}
+
+static PFNGLENABLEPROC real_glEnable;
+static void APIENTRY wrap_glEnable(GLenum cap) {
+    if (gl_capture_on) {
+        gl_capture_call(22);
+        gl_capture_u32(cap);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEnable(cap);
+    record(22, intercept_start);
+}
+
+static PFNGLFINISHPROC real_glFinish;
+static void APIENTRY wrap_glFinish(void) {
+    if (gl_capture_on) {
+        gl_capture_call(23);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFinish();
+    record(23, intercept_start);
+}
+
+static PFNGLFLUSHPROC real_glFlush;
+static void APIENTRY wrap_glFlush(void) {
+    if (gl_capture_on) {
+        gl_capture_call(24);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFlush();
+    record(24, intercept_start);
+}
+
+static PFNGLBLENDFUNCPROC real_glBlendFunc;
+static void APIENTRY wrap_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    if (gl_capture_on) {
+        gl_capture_call(25);
+        gl_capture_u32(sfactor);
+        gl_capture_u32(dfactor);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlendFunc(sfactor, dfactor);
+    record(25, intercept_start);
+}
+
+static PFNGLLOGICOPPROC real_glLogicOp;
+static void APIENTRY wrap_glLogicOp(GLenum opcode) {
+    if (gl_capture_on) {
+        gl_capture_call(26);
+        gl_capture_u32(opcode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLogicOp(opcode);
+    record(26, intercept_start);
+}
+
+static PFNGLSTENCILFUNCPROC real_glStencilFunc;
+static void APIENTRY wrap_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    if (gl_capture_on) {
+        gl_capture_call(27);
+        gl_capture_u32(func);
+        gl_capture_u32(ref);
+        gl_capture_u32(mask);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glStencilFunc(func, ref, mask);
+    record(27, intercept_start);
+}
+
+static PFNGLSTENCILOPPROC real_glStencilOp;
+static void APIENTRY wrap_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    if (gl_capture_on) {
+        gl_capture_call(28);
+        gl_capture_u32(fail);
+        gl_capture_u32(zfail);
+        gl_capture_u32(zpass);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glStencilOp(fail, zfail, zpass);
+    record(28, intercept_start);
+}
+
+static PFNGLDEPTHFUNCPROC real_glDepthFunc;
+static void APIENTRY wrap_glDepthFunc(GLenum func) {
+    if (gl_capture_on) {
+        gl_capture_call(29);
+        gl_capture_u32(func);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDepthFunc(func);
+    record(29, intercept_start);
+}
+
+static PFNGLPIXELSTOREFPROC real_glPixelStoref;
+static void APIENTRY wrap_glPixelStoref(GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(30);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPixelStoref(pname, param);
+    record(30, intercept_start);
+}
+
+static PFNGLPIXELSTOREIPROC real_glPixelStorei;
+static void APIENTRY wrap_glPixelStorei(GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(31);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPixelStorei(pname, param);
+    record(31, intercept_start);
+}
+
+static PFNGLREADBUFFERPROC real_glReadBuffer;
+static void APIENTRY wrap_glReadBuffer(GLenum src) {
+    if (gl_capture_on) {
+        gl_capture_call(32);
+        gl_capture_u32(src);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glReadBuffer(src);
+    record(32, intercept_start);
+}
+
+static PFNGLREADPIXELSPROC real_glReadPixels;
+static void APIENTRY wrap_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    uint64_t intercept_start = now_ns();
+    real_glReadPixels(x, y, width, height, format, type, pixels);
+    record(33, intercept_start);
+}
+
+static PFNGLGETBOOLEANVPROC real_glGetBooleanv;
+static void APIENTRY wrap_glGetBooleanv(GLenum pname, GLboolean *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetBooleanv(pname, data);
+    record(34, intercept_start);
+}
+
+static PFNGLGETDOUBLEVPROC real_glGetDoublev;
+static void APIENTRY wrap_glGetDoublev(GLenum pname, GLdouble *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetDoublev(pname, data);
+    record(35, intercept_start);
+}
+
+static PFNGLGETERRORPROC real_glGetError;
+static GLenum APIENTRY wrap_glGetError(void) {
+    uint64_t intercept_start = now_ns();
+    GLenum intercept_result = real_glGetError();
+    record(36, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETFLOATVPROC real_glGetFloatv;
+static void APIENTRY wrap_glGetFloatv(GLenum pname, GLfloat *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetFloatv(pname, data);
+    record(37, intercept_start);
+}
+
+static PFNGLGETINTEGERVPROC real_glGetIntegerv;
+static void APIENTRY wrap_glGetIntegerv(GLenum pname, GLint *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetIntegerv(pname, data);
+    record(38, intercept_start);
+}
+
+static PFNGLGETSTRINGPROC real_glGetString;
+static const GLubyte * APIENTRY wrap_glGetString(GLenum name) {
+    uint64_t intercept_start = now_ns();
+    const GLubyte * intercept_result = real_glGetString(name);
+    record(39, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETTEXIMAGEPROC real_glGetTexImage;
+static void APIENTRY wrap_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexImage(target, level, format, type, pixels);
+    record(40, intercept_start);
+}
+
+static PFNGLGETTEXPARAMETERFVPROC real_glGetTexParameterfv;
+static void APIENTRY wrap_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexParameterfv(target, pname, params);
+    record(41, intercept_start);
+}
+
+static PFNGLGETTEXPARAMETERIVPROC real_glGetTexParameteriv;
+static void APIENTRY wrap_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexParameteriv(target, pname, params);
+    record(42, intercept_start);
+}
+
+static PFNGLGETTEXLEVELPARAMETERFVPROC real_glGetTexLevelParameterfv;
+static void APIENTRY wrap_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexLevelParameterfv(target, level, pname, params);
+    record(43, intercept_start);
+}
+
+static PFNGLGETTEXLEVELPARAMETERIVPROC real_glGetTexLevelParameteriv;
+static void APIENTRY wrap_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexLevelParameteriv(target, level, pname, params);
+    record(44, intercept_start);
+}
+
+static PFNGLISENABLEDPROC real_glIsEnabled;
+static GLboolean APIENTRY wrap_glIsEnabled(GLenum cap) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsEnabled(cap);
+    record(45, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLDEPTHRANGEPROC real_glDepthRange;
+static void APIENTRY wrap_glDepthRange(GLdouble n, GLdouble f) {
+    if (gl_capture_on) {
+        gl_capture_call(46);
+        gl_capture_f64(n);
+        gl_capture_f64(f);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDepthRange(n, f);
+    record(46, intercept_start);
+}
+
+static PFNGLVIEWPORTPROC real_glViewport;
+static void APIENTRY wrap_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(47);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glViewport(x, y, width, height);
+    record(47, intercept_start);
+}
+
+static PFNGLNEWLISTPROC real_glNewList;
+static void APIENTRY wrap_glNewList(GLuint list, GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(48);
+        gl_capture_u32(list);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNewList(list, mode);
+    record(48, intercept_start);
+}
+
+static PFNGLENDLISTPROC real_glEndList;
+static void APIENTRY wrap_glEndList(void) {
+    if (gl_capture_on) {
+        gl_capture_call(49);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEndList();
+    record(49, intercept_start);
+}
+
+static PFNGLCALLLISTPROC real_glCallList;
+static void APIENTRY wrap_glCallList(GLuint list) {
+    if (gl_capture_on) {
+        gl_capture_call(50);
+        gl_capture_u32(list);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCallList(list);
+    record(50, intercept_start);
+}
+
+static PFNGLCALLLISTSPROC real_glCallLists;
+static void APIENTRY wrap_glCallLists(GLsizei n, GLenum type, const void *lists) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(51);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCallLists(n, type, lists);
+    record(51, intercept_start);
+}
+
+static PFNGLDELETELISTSPROC real_glDeleteLists;
+static void APIENTRY wrap_glDeleteLists(GLuint list, GLsizei range) {
+    if (gl_capture_on) {
+        gl_capture_call(52);
+        gl_capture_u32(list);
+        gl_capture_u32(range);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteLists(list, range);
+    record(52, intercept_start);
+}
+
+static PFNGLGENLISTSPROC real_glGenLists;
+static GLuint APIENTRY wrap_glGenLists(GLsizei range) {
+    if (gl_capture_on) {
+        gl_capture_call(53);
+        gl_capture_u32(range);
+    }
+    uint64_t intercept_start = now_ns();
+    GLuint intercept_result = real_glGenLists(range);
+    record(53, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLLISTBASEPROC real_glListBase;
+static void APIENTRY wrap_glListBase(GLuint base) {
+    if (gl_capture_on) {
+        gl_capture_call(54);
+        gl_capture_u32(base);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glListBase(base);
+    record(54, intercept_start);
+}
+
+static PFNGLBEGINPROC real_glBegin;
+static void APIENTRY wrap_glBegin(GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(55);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBegin(mode);
+    record(55, intercept_start);
+}
+
+static PFNGLBITMAPPROC real_glBitmap;
+static void APIENTRY wrap_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(56);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+    record(56, intercept_start);
+}
+
+static PFNGLCOLOR3BPROC real_glColor3b;
+static void APIENTRY wrap_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    if (gl_capture_on) {
+        gl_capture_call(57);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3b(red, green, blue);
+    record(57, intercept_start);
+}
+
+static PFNGLCOLOR3BVPROC real_glColor3bv;
+static void APIENTRY wrap_glColor3bv(const GLbyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(58);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3bv(v);
+    record(58, intercept_start);
+}
+
+static PFNGLCOLOR3DPROC real_glColor3d;
+static void APIENTRY wrap_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    if (gl_capture_on) {
+        gl_capture_call(59);
+        gl_capture_f64(red);
+        gl_capture_f64(green);
+        gl_capture_f64(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3d(red, green, blue);
+    record(59, intercept_start);
+}
+
+static PFNGLCOLOR3DVPROC real_glColor3dv;
+static void APIENTRY wrap_glColor3dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(60);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3dv(v);
+    record(60, intercept_start);
+}
+
+static PFNGLCOLOR3FPROC real_glColor3f;
+static void APIENTRY wrap_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    if (gl_capture_on) {
+        gl_capture_call(61);
+        gl_capture_f32(red);
+        gl_capture_f32(green);
+        gl_capture_f32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3f(red, green, blue);
+    record(61, intercept_start);
+}
+
+static PFNGLCOLOR3FVPROC real_glColor3fv;
+static void APIENTRY wrap_glColor3fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(62);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3fv(v);
+    record(62, intercept_start);
+}
+
+static PFNGLCOLOR3IPROC real_glColor3i;
+static void APIENTRY wrap_glColor3i(GLint red, GLint green, GLint blue) {
+    if (gl_capture_on) {
+        gl_capture_call(63);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3i(red, green, blue);
+    record(63, intercept_start);
+}
+
+static PFNGLCOLOR3IVPROC real_glColor3iv;
+static void APIENTRY wrap_glColor3iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(64);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3iv(v);
+    record(64, intercept_start);
+}
+
+static PFNGLCOLOR3SPROC real_glColor3s;
+static void APIENTRY wrap_glColor3s(GLshort red, GLshort green, GLshort blue) {
+    if (gl_capture_on) {
+        gl_capture_call(65);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3s(red, green, blue);
+    record(65, intercept_start);
+}
+
+static PFNGLCOLOR3SVPROC real_glColor3sv;
+static void APIENTRY wrap_glColor3sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(66);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3sv(v);
+    record(66, intercept_start);
+}
+
+static PFNGLCOLOR3UBPROC real_glColor3ub;
+static void APIENTRY wrap_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    if (gl_capture_on) {
+        gl_capture_call(67);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3ub(red, green, blue);
+    record(67, intercept_start);
+}
+
+static PFNGLCOLOR3UBVPROC real_glColor3ubv;
+static void APIENTRY wrap_glColor3ubv(const GLubyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(68);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3ubv(v);
+    record(68, intercept_start);
+}
+
+static PFNGLCOLOR3UIPROC real_glColor3ui;
+static void APIENTRY wrap_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+    if (gl_capture_on) {
+        gl_capture_call(69);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3ui(red, green, blue);
+    record(69, intercept_start);
+}
+
+static PFNGLCOLOR3UIVPROC real_glColor3uiv;
+static void APIENTRY wrap_glColor3uiv(const GLuint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(70);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3uiv(v);
+    record(70, intercept_start);
+}
+
+static PFNGLCOLOR3USPROC real_glColor3us;
+static void APIENTRY wrap_glColor3us(GLushort red, GLushort green, GLushort blue) {
+    if (gl_capture_on) {
+        gl_capture_call(71);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3us(red, green, blue);
+    record(71, intercept_start);
+}
+
+static PFNGLCOLOR3USVPROC real_glColor3usv;
+static void APIENTRY wrap_glColor3usv(const GLushort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(72);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor3usv(v);
+    record(72, intercept_start);
+}
+
+static PFNGLCOLOR4BPROC real_glColor4b;
+static void APIENTRY wrap_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(73);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+        gl_capture_u32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4b(red, green, blue, alpha);
+    record(73, intercept_start);
+}
+
+static PFNGLCOLOR4BVPROC real_glColor4bv;
+static void APIENTRY wrap_glColor4bv(const GLbyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(74);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4bv(v);
+    record(74, intercept_start);
+}
+
+static PFNGLCOLOR4DPROC real_glColor4d;
+static void APIENTRY wrap_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(75);
+        gl_capture_f64(red);
+        gl_capture_f64(green);
+        gl_capture_f64(blue);
+        gl_capture_f64(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4d(red, green, blue, alpha);
+    record(75, intercept_start);
+}
+
+static PFNGLCOLOR4DVPROC real_glColor4dv;
+static void APIENTRY wrap_glColor4dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(76);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4dv(v);
+    record(76, intercept_start);
+}
+
+static PFNGLCOLOR4FPROC real_glColor4f;
+static void APIENTRY wrap_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(77);
+        gl_capture_f32(red);
+        gl_capture_f32(green);
+        gl_capture_f32(blue);
+        gl_capture_f32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4f(red, green, blue, alpha);
+    record(77, intercept_start);
+}
+
+static PFNGLCOLOR4FVPROC real_glColor4fv;
+static void APIENTRY wrap_glColor4fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(78);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4fv(v);
+    record(78, intercept_start);
+}
+
+static PFNGLCOLOR4IPROC real_glColor4i;
+static void APIENTRY wrap_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(79);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+        gl_capture_u32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4i(red, green, blue, alpha);
+    record(79, intercept_start);
+}
+
+static PFNGLCOLOR4IVPROC real_glColor4iv;
+static void APIENTRY wrap_glColor4iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(80);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4iv(v);
+    record(80, intercept_start);
+}
+
+static PFNGLCOLOR4SPROC real_glColor4s;
+static void APIENTRY wrap_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(81);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+        gl_capture_u32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4s(red, green, blue, alpha);
+    record(81, intercept_start);
+}
+
+static PFNGLCOLOR4SVPROC real_glColor4sv;
+static void APIENTRY wrap_glColor4sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(82);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4sv(v);
+    record(82, intercept_start);
+}
+
+static PFNGLCOLOR4UBPROC real_glColor4ub;
+static void APIENTRY wrap_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(83);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+        gl_capture_u32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4ub(red, green, blue, alpha);
+    record(83, intercept_start);
+}
+
+static PFNGLCOLOR4UBVPROC real_glColor4ubv;
+static void APIENTRY wrap_glColor4ubv(const GLubyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(84);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4ubv(v);
+    record(84, intercept_start);
+}
+
+static PFNGLCOLOR4UIPROC real_glColor4ui;
+static void APIENTRY wrap_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(85);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+        gl_capture_u32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4ui(red, green, blue, alpha);
+    record(85, intercept_start);
+}
+
+static PFNGLCOLOR4UIVPROC real_glColor4uiv;
+static void APIENTRY wrap_glColor4uiv(const GLuint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(86);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4uiv(v);
+    record(86, intercept_start);
+}
+
+static PFNGLCOLOR4USPROC real_glColor4us;
+static void APIENTRY wrap_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(87);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+        gl_capture_u32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4us(red, green, blue, alpha);
+    record(87, intercept_start);
+}
+
+static PFNGLCOLOR4USVPROC real_glColor4usv;
+static void APIENTRY wrap_glColor4usv(const GLushort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(88);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColor4usv(v);
+    record(88, intercept_start);
+}
+
+static PFNGLEDGEFLAGPROC real_glEdgeFlag;
+static void APIENTRY wrap_glEdgeFlag(GLboolean flag) {
+    if (gl_capture_on) {
+        gl_capture_call(89);
+        gl_capture_u32(flag);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEdgeFlag(flag);
+    record(89, intercept_start);
+}
+
+static PFNGLEDGEFLAGVPROC real_glEdgeFlagv;
+static void APIENTRY wrap_glEdgeFlagv(const GLboolean *flag) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(90);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEdgeFlagv(flag);
+    record(90, intercept_start);
+}
+
+static PFNGLENDPROC real_glEnd;
+static void APIENTRY wrap_glEnd(void) {
+    if (gl_capture_on) {
+        gl_capture_call(91);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEnd();
+    record(91, intercept_start);
+}
+
+static PFNGLINDEXDPROC real_glIndexd;
+static void APIENTRY wrap_glIndexd(GLdouble c) {
+    if (gl_capture_on) {
+        gl_capture_call(92);
+        gl_capture_f64(c);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexd(c);
+    record(92, intercept_start);
+}
+
+static PFNGLINDEXDVPROC real_glIndexdv;
+static void APIENTRY wrap_glIndexdv(const GLdouble *c) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(93);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexdv(c);
+    record(93, intercept_start);
+}
+
+static PFNGLINDEXFPROC real_glIndexf;
+static void APIENTRY wrap_glIndexf(GLfloat c) {
+    if (gl_capture_on) {
+        gl_capture_call(94);
+        gl_capture_f32(c);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexf(c);
+    record(94, intercept_start);
+}
+
+static PFNGLINDEXFVPROC real_glIndexfv;
+static void APIENTRY wrap_glIndexfv(const GLfloat *c) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(95);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexfv(c);
+    record(95, intercept_start);
+}
+
+static PFNGLINDEXIPROC real_glIndexi;
+static void APIENTRY wrap_glIndexi(GLint c) {
+    if (gl_capture_on) {
+        gl_capture_call(96);
+        gl_capture_u32(c);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexi(c);
+    record(96, intercept_start);
+}
+
+static PFNGLINDEXIVPROC real_glIndexiv;
+static void APIENTRY wrap_glIndexiv(const GLint *c) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(97);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexiv(c);
+    record(97, intercept_start);
+}
+
+static PFNGLINDEXSPROC real_glIndexs;
+static void APIENTRY wrap_glIndexs(GLshort c) {
+    if (gl_capture_on) {
+        gl_capture_call(98);
+        gl_capture_u32(c);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexs(c);
+    record(98, intercept_start);
+}
+
+static PFNGLINDEXSVPROC real_glIndexsv;
+static void APIENTRY wrap_glIndexsv(const GLshort *c) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(99);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexsv(c);
+    record(99, intercept_start);
+}
+
+static PFNGLNORMAL3BPROC real_glNormal3b;
+static void APIENTRY wrap_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+    if (gl_capture_on) {
+        gl_capture_call(100);
+        gl_capture_u32(nx);
+        gl_capture_u32(ny);
+        gl_capture_u32(nz);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormal3b(nx, ny, nz);
+    record(100, intercept_start);
+}
+
+static PFNGLNORMAL3BVPROC real_glNormal3bv;
+static void APIENTRY wrap_glNormal3bv(const GLbyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(101);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormal3bv(v);
+    record(101, intercept_start);
+}
+
+static PFNGLNORMAL3DPROC real_glNormal3d;
+static void APIENTRY wrap_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+    if (gl_capture_on) {
+        gl_capture_call(102);
+        gl_capture_f64(nx);
+        gl_capture_f64(ny);
+        gl_capture_f64(nz);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormal3d(nx, ny, nz);
+    record(102, intercept_start);
+}
+
+static PFNGLNORMAL3DVPROC real_glNormal3dv;
+static void APIENTRY wrap_glNormal3dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(103);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormal3dv(v);
+    record(103, intercept_start);
+}
+
+static PFNGLNORMAL3FPROC real_glNormal3f;
+static void APIENTRY wrap_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+    if (gl_capture_on) {
+        gl_capture_call(104);
+        gl_capture_f32(nx);
+        gl_capture_f32(ny);
+        gl_capture_f32(nz);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormal3f(nx, ny, nz);
+    record(104, intercept_start);
+}
+
+static PFNGLNORMAL3FVPROC real_glNormal3fv;
+static void APIENTRY wrap_glNormal3fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(105);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormal3fv(v);
+    record(105, intercept_start);
+}
+
+static PFNGLNORMAL3IPROC real_glNormal3i;
+static void APIENTRY wrap_glNormal3i(GLint nx, GLint ny, GLint nz) {
+    if (gl_capture_on) {
+        gl_capture_call(106);
+        gl_capture_u32(nx);
+        gl_capture_u32(ny);
+        gl_capture_u32(nz);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormal3i(nx, ny, nz);
+    record(106, intercept_start);
+}
+
+static PFNGLNORMAL3IVPROC real_glNormal3iv;
+static void APIENTRY wrap_glNormal3iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(107);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormal3iv(v);
+    record(107, intercept_start);
+}
+
+static PFNGLNORMAL3SPROC real_glNormal3s;
+static void APIENTRY wrap_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+    if (gl_capture_on) {
+        gl_capture_call(108);
+        gl_capture_u32(nx);
+        gl_capture_u32(ny);
+        gl_capture_u32(nz);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormal3s(nx, ny, nz);
+    record(108, intercept_start);
+}
+
+static PFNGLNORMAL3SVPROC real_glNormal3sv;
+static void APIENTRY wrap_glNormal3sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(109);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormal3sv(v);
+    record(109, intercept_start);
+}
+
+static PFNGLRASTERPOS2DPROC real_glRasterPos2d;
+static void APIENTRY wrap_glRasterPos2d(GLdouble x, GLdouble y) {
+    if (gl_capture_on) {
+        gl_capture_call(110);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos2d(x, y);
+    record(110, intercept_start);
+}
+
+static PFNGLRASTERPOS2DVPROC real_glRasterPos2dv;
+static void APIENTRY wrap_glRasterPos2dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(111);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos2dv(v);
+    record(111, intercept_start);
+}
+
+static PFNGLRASTERPOS2FPROC real_glRasterPos2f;
+static void APIENTRY wrap_glRasterPos2f(GLfloat x, GLfloat y) {
+    if (gl_capture_on) {
+        gl_capture_call(112);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos2f(x, y);
+    record(112, intercept_start);
+}
+
+static PFNGLRASTERPOS2FVPROC real_glRasterPos2fv;
+static void APIENTRY wrap_glRasterPos2fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(113);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos2fv(v);
+    record(113, intercept_start);
+}
+
+static PFNGLRASTERPOS2IPROC real_glRasterPos2i;
+static void APIENTRY wrap_glRasterPos2i(GLint x, GLint y) {
+    if (gl_capture_on) {
+        gl_capture_call(114);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos2i(x, y);
+    record(114, intercept_start);
+}
+
+static PFNGLRASTERPOS2IVPROC real_glRasterPos2iv;
+static void APIENTRY wrap_glRasterPos2iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(115);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos2iv(v);
+    record(115, intercept_start);
+}
+
+static PFNGLRASTERPOS2SPROC real_glRasterPos2s;
+static void APIENTRY wrap_glRasterPos2s(GLshort x, GLshort y) {
+    if (gl_capture_on) {
+        gl_capture_call(116);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos2s(x, y);
+    record(116, intercept_start);
+}
+
+static PFNGLRASTERPOS2SVPROC real_glRasterPos2sv;
+static void APIENTRY wrap_glRasterPos2sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(117);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos2sv(v);
+    record(117, intercept_start);
+}
+
+static PFNGLRASTERPOS3DPROC real_glRasterPos3d;
+static void APIENTRY wrap_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    if (gl_capture_on) {
+        gl_capture_call(118);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos3d(x, y, z);
+    record(118, intercept_start);
+}
+
+static PFNGLRASTERPOS3DVPROC real_glRasterPos3dv;
+static void APIENTRY wrap_glRasterPos3dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(119);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos3dv(v);
+    record(119, intercept_start);
+}
+
+static PFNGLRASTERPOS3FPROC real_glRasterPos3f;
+static void APIENTRY wrap_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    if (gl_capture_on) {
+        gl_capture_call(120);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos3f(x, y, z);
+    record(120, intercept_start);
+}
+
+static PFNGLRASTERPOS3FVPROC real_glRasterPos3fv;
+static void APIENTRY wrap_glRasterPos3fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(121);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos3fv(v);
+    record(121, intercept_start);
+}
+
+static PFNGLRASTERPOS3IPROC real_glRasterPos3i;
+static void APIENTRY wrap_glRasterPos3i(GLint x, GLint y, GLint z) {
+    if (gl_capture_on) {
+        gl_capture_call(122);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos3i(x, y, z);
+    record(122, intercept_start);
+}
+
+static PFNGLRASTERPOS3IVPROC real_glRasterPos3iv;
+static void APIENTRY wrap_glRasterPos3iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(123);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos3iv(v);
+    record(123, intercept_start);
+}
+
+static PFNGLRASTERPOS3SPROC real_glRasterPos3s;
+static void APIENTRY wrap_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+    if (gl_capture_on) {
+        gl_capture_call(124);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos3s(x, y, z);
+    record(124, intercept_start);
+}
+
+static PFNGLRASTERPOS3SVPROC real_glRasterPos3sv;
+static void APIENTRY wrap_glRasterPos3sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(125);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos3sv(v);
+    record(125, intercept_start);
+}
+
+static PFNGLRASTERPOS4DPROC real_glRasterPos4d;
+static void APIENTRY wrap_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if (gl_capture_on) {
+        gl_capture_call(126);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+        gl_capture_f64(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos4d(x, y, z, w);
+    record(126, intercept_start);
+}
+
+static PFNGLRASTERPOS4DVPROC real_glRasterPos4dv;
+static void APIENTRY wrap_glRasterPos4dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(127);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos4dv(v);
+    record(127, intercept_start);
+}
+
+static PFNGLRASTERPOS4FPROC real_glRasterPos4f;
+static void APIENTRY wrap_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    if (gl_capture_on) {
+        gl_capture_call(128);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(z);
+        gl_capture_f32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos4f(x, y, z, w);
+    record(128, intercept_start);
+}
+
+static PFNGLRASTERPOS4FVPROC real_glRasterPos4fv;
+static void APIENTRY wrap_glRasterPos4fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(129);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos4fv(v);
+    record(129, intercept_start);
+}
+
+static PFNGLRASTERPOS4IPROC real_glRasterPos4i;
+static void APIENTRY wrap_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+    if (gl_capture_on) {
+        gl_capture_call(130);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+        gl_capture_u32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos4i(x, y, z, w);
+    record(130, intercept_start);
+}
+
+static PFNGLRASTERPOS4IVPROC real_glRasterPos4iv;
+static void APIENTRY wrap_glRasterPos4iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(131);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos4iv(v);
+    record(131, intercept_start);
+}
+
+static PFNGLRASTERPOS4SPROC real_glRasterPos4s;
+static void APIENTRY wrap_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    if (gl_capture_on) {
+        gl_capture_call(132);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+        gl_capture_u32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos4s(x, y, z, w);
+    record(132, intercept_start);
+}
+
+static PFNGLRASTERPOS4SVPROC real_glRasterPos4sv;
+static void APIENTRY wrap_glRasterPos4sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(133);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRasterPos4sv(v);
+    record(133, intercept_start);
+}
+
+static PFNGLRECTDPROC real_glRectd;
+static void APIENTRY wrap_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+    if (gl_capture_on) {
+        gl_capture_call(134);
+        gl_capture_f64(x1);
+        gl_capture_f64(y1);
+        gl_capture_f64(x2);
+        gl_capture_f64(y2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRectd(x1, y1, x2, y2);
+    record(134, intercept_start);
+}
+
+static PFNGLRECTDVPROC real_glRectdv;
+static void APIENTRY wrap_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(135);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRectdv(v1, v2);
+    record(135, intercept_start);
+}
+
+static PFNGLRECTFPROC real_glRectf;
+static void APIENTRY wrap_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+    if (gl_capture_on) {
+        gl_capture_call(136);
+        gl_capture_f32(x1);
+        gl_capture_f32(y1);
+        gl_capture_f32(x2);
+        gl_capture_f32(y2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRectf(x1, y1, x2, y2);
+    record(136, intercept_start);
+}
+
+static PFNGLRECTFVPROC real_glRectfv;
+static void APIENTRY wrap_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(137);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRectfv(v1, v2);
+    record(137, intercept_start);
+}
+
+static PFNGLRECTIPROC real_glRecti;
+static void APIENTRY wrap_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+    if (gl_capture_on) {
+        gl_capture_call(138);
+        gl_capture_u32(x1);
+        gl_capture_u32(y1);
+        gl_capture_u32(x2);
+        gl_capture_u32(y2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRecti(x1, y1, x2, y2);
+    record(138, intercept_start);
+}
+
+static PFNGLRECTIVPROC real_glRectiv;
+static void APIENTRY wrap_glRectiv(const GLint *v1, const GLint *v2) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(139);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRectiv(v1, v2);
+    record(139, intercept_start);
+}
+
+static PFNGLRECTSPROC real_glRects;
+static void APIENTRY wrap_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+    if (gl_capture_on) {
+        gl_capture_call(140);
+        gl_capture_u32(x1);
+        gl_capture_u32(y1);
+        gl_capture_u32(x2);
+        gl_capture_u32(y2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRects(x1, y1, x2, y2);
+    record(140, intercept_start);
+}
+
+static PFNGLRECTSVPROC real_glRectsv;
+static void APIENTRY wrap_glRectsv(const GLshort *v1, const GLshort *v2) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(141);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRectsv(v1, v2);
+    record(141, intercept_start);
+}
+
+static PFNGLTEXCOORD1DPROC real_glTexCoord1d;
+static void APIENTRY wrap_glTexCoord1d(GLdouble s) {
+    if (gl_capture_on) {
+        gl_capture_call(142);
+        gl_capture_f64(s);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord1d(s);
+    record(142, intercept_start);
+}
+
+static PFNGLTEXCOORD1DVPROC real_glTexCoord1dv;
+static void APIENTRY wrap_glTexCoord1dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(143);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord1dv(v);
+    record(143, intercept_start);
+}
+
+static PFNGLTEXCOORD1FPROC real_glTexCoord1f;
+static void APIENTRY wrap_glTexCoord1f(GLfloat s) {
+    if (gl_capture_on) {
+        gl_capture_call(144);
+        gl_capture_f32(s);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord1f(s);
+    record(144, intercept_start);
+}
+
+static PFNGLTEXCOORD1FVPROC real_glTexCoord1fv;
+static void APIENTRY wrap_glTexCoord1fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(145);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord1fv(v);
+    record(145, intercept_start);
+}
+
+static PFNGLTEXCOORD1IPROC real_glTexCoord1i;
+static void APIENTRY wrap_glTexCoord1i(GLint s) {
+    if (gl_capture_on) {
+        gl_capture_call(146);
+        gl_capture_u32(s);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord1i(s);
+    record(146, intercept_start);
+}
+
+static PFNGLTEXCOORD1IVPROC real_glTexCoord1iv;
+static void APIENTRY wrap_glTexCoord1iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(147);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord1iv(v);
+    record(147, intercept_start);
+}
+
+static PFNGLTEXCOORD1SPROC real_glTexCoord1s;
+static void APIENTRY wrap_glTexCoord1s(GLshort s) {
+    if (gl_capture_on) {
+        gl_capture_call(148);
+        gl_capture_u32(s);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord1s(s);
+    record(148, intercept_start);
+}
+
+static PFNGLTEXCOORD1SVPROC real_glTexCoord1sv;
+static void APIENTRY wrap_glTexCoord1sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(149);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord1sv(v);
+    record(149, intercept_start);
+}
+
+static PFNGLTEXCOORD2DPROC real_glTexCoord2d;
+static void APIENTRY wrap_glTexCoord2d(GLdouble s, GLdouble t) {
+    if (gl_capture_on) {
+        gl_capture_call(150);
+        gl_capture_f64(s);
+        gl_capture_f64(t);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord2d(s, t);
+    record(150, intercept_start);
+}
+
+static PFNGLTEXCOORD2DVPROC real_glTexCoord2dv;
+static void APIENTRY wrap_glTexCoord2dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(151);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord2dv(v);
+    record(151, intercept_start);
+}
+
+static PFNGLTEXCOORD2FPROC real_glTexCoord2f;
+static void APIENTRY wrap_glTexCoord2f(GLfloat s, GLfloat t) {
+    if (gl_capture_on) {
+        gl_capture_call(152);
+        gl_capture_f32(s);
+        gl_capture_f32(t);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord2f(s, t);
+    record(152, intercept_start);
+}
+
+static PFNGLTEXCOORD2FVPROC real_glTexCoord2fv;
+static void APIENTRY wrap_glTexCoord2fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(153);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord2fv(v);
+    record(153, intercept_start);
+}
+
+static PFNGLTEXCOORD2IPROC real_glTexCoord2i;
+static void APIENTRY wrap_glTexCoord2i(GLint s, GLint t) {
+    if (gl_capture_on) {
+        gl_capture_call(154);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord2i(s, t);
+    record(154, intercept_start);
+}
+
+static PFNGLTEXCOORD2IVPROC real_glTexCoord2iv;
+static void APIENTRY wrap_glTexCoord2iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(155);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord2iv(v);
+    record(155, intercept_start);
+}
+
+static PFNGLTEXCOORD2SPROC real_glTexCoord2s;
+static void APIENTRY wrap_glTexCoord2s(GLshort s, GLshort t) {
+    if (gl_capture_on) {
+        gl_capture_call(156);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord2s(s, t);
+    record(156, intercept_start);
+}
+
+static PFNGLTEXCOORD2SVPROC real_glTexCoord2sv;
+static void APIENTRY wrap_glTexCoord2sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(157);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord2sv(v);
+    record(157, intercept_start);
+}
+
+static PFNGLTEXCOORD3DPROC real_glTexCoord3d;
+static void APIENTRY wrap_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+    if (gl_capture_on) {
+        gl_capture_call(158);
+        gl_capture_f64(s);
+        gl_capture_f64(t);
+        gl_capture_f64(r);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord3d(s, t, r);
+    record(158, intercept_start);
+}
+
+static PFNGLTEXCOORD3DVPROC real_glTexCoord3dv;
+static void APIENTRY wrap_glTexCoord3dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(159);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord3dv(v);
+    record(159, intercept_start);
+}
+
+static PFNGLTEXCOORD3FPROC real_glTexCoord3f;
+static void APIENTRY wrap_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+    if (gl_capture_on) {
+        gl_capture_call(160);
+        gl_capture_f32(s);
+        gl_capture_f32(t);
+        gl_capture_f32(r);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord3f(s, t, r);
+    record(160, intercept_start);
+}
+
+static PFNGLTEXCOORD3FVPROC real_glTexCoord3fv;
+static void APIENTRY wrap_glTexCoord3fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(161);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord3fv(v);
+    record(161, intercept_start);
+}
+
+static PFNGLTEXCOORD3IPROC real_glTexCoord3i;
+static void APIENTRY wrap_glTexCoord3i(GLint s, GLint t, GLint r) {
+    if (gl_capture_on) {
+        gl_capture_call(162);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+        gl_capture_u32(r);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord3i(s, t, r);
+    record(162, intercept_start);
+}
+
+static PFNGLTEXCOORD3IVPROC real_glTexCoord3iv;
+static void APIENTRY wrap_glTexCoord3iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(163);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord3iv(v);
+    record(163, intercept_start);
+}
+
+static PFNGLTEXCOORD3SPROC real_glTexCoord3s;
+static void APIENTRY wrap_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+    if (gl_capture_on) {
+        gl_capture_call(164);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+        gl_capture_u32(r);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord3s(s, t, r);
+    record(164, intercept_start);
+}
+
+static PFNGLTEXCOORD3SVPROC real_glTexCoord3sv;
+static void APIENTRY wrap_glTexCoord3sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(165);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord3sv(v);
+    record(165, intercept_start);
+}
+
+static PFNGLTEXCOORD4DPROC real_glTexCoord4d;
+static void APIENTRY wrap_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    if (gl_capture_on) {
+        gl_capture_call(166);
+        gl_capture_f64(s);
+        gl_capture_f64(t);
+        gl_capture_f64(r);
+        gl_capture_f64(q);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord4d(s, t, r, q);
+    record(166, intercept_start);
+}
+
+static PFNGLTEXCOORD4DVPROC real_glTexCoord4dv;
+static void APIENTRY wrap_glTexCoord4dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(167);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord4dv(v);
+    record(167, intercept_start);
+}
+
+static PFNGLTEXCOORD4FPROC real_glTexCoord4f;
+static void APIENTRY wrap_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    if (gl_capture_on) {
+        gl_capture_call(168);
+        gl_capture_f32(s);
+        gl_capture_f32(t);
+        gl_capture_f32(r);
+        gl_capture_f32(q);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord4f(s, t, r, q);
+    record(168, intercept_start);
+}
+
+static PFNGLTEXCOORD4FVPROC real_glTexCoord4fv;
+static void APIENTRY wrap_glTexCoord4fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(169);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord4fv(v);
+    record(169, intercept_start);
+}
+
+static PFNGLTEXCOORD4IPROC real_glTexCoord4i;
+static void APIENTRY wrap_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+    if (gl_capture_on) {
+        gl_capture_call(170);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+        gl_capture_u32(r);
+        gl_capture_u32(q);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord4i(s, t, r, q);
+    record(170, intercept_start);
+}
+
+static PFNGLTEXCOORD4IVPROC real_glTexCoord4iv;
+static void APIENTRY wrap_glTexCoord4iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(171);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord4iv(v);
+    record(171, intercept_start);
+}
+
+static PFNGLTEXCOORD4SPROC real_glTexCoord4s;
+static void APIENTRY wrap_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+    if (gl_capture_on) {
+        gl_capture_call(172);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+        gl_capture_u32(r);
+        gl_capture_u32(q);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord4s(s, t, r, q);
+    record(172, intercept_start);
+}
+
+static PFNGLTEXCOORD4SVPROC real_glTexCoord4sv;
+static void APIENTRY wrap_glTexCoord4sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(173);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoord4sv(v);
+    record(173, intercept_start);
+}
+
+static PFNGLVERTEX2DPROC real_glVertex2d;
+static void APIENTRY wrap_glVertex2d(GLdouble x, GLdouble y) {
+    if (gl_capture_on) {
+        gl_capture_call(174);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex2d(x, y);
+    record(174, intercept_start);
+}
+
+static PFNGLVERTEX2DVPROC real_glVertex2dv;
+static void APIENTRY wrap_glVertex2dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(175);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex2dv(v);
+    record(175, intercept_start);
+}
+
+static PFNGLVERTEX2FPROC real_glVertex2f;
+static void APIENTRY wrap_glVertex2f(GLfloat x, GLfloat y) {
+    if (gl_capture_on) {
+        gl_capture_call(176);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex2f(x, y);
+    record(176, intercept_start);
+}
+
+static PFNGLVERTEX2FVPROC real_glVertex2fv;
+static void APIENTRY wrap_glVertex2fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(177);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex2fv(v);
+    record(177, intercept_start);
+}
+
+static PFNGLVERTEX2IPROC real_glVertex2i;
+static void APIENTRY wrap_glVertex2i(GLint x, GLint y) {
+    if (gl_capture_on) {
+        gl_capture_call(178);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex2i(x, y);
+    record(178, intercept_start);
+}
+
+static PFNGLVERTEX2IVPROC real_glVertex2iv;
+static void APIENTRY wrap_glVertex2iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(179);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex2iv(v);
+    record(179, intercept_start);
+}
+
+static PFNGLVERTEX2SPROC real_glVertex2s;
+static void APIENTRY wrap_glVertex2s(GLshort x, GLshort y) {
+    if (gl_capture_on) {
+        gl_capture_call(180);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex2s(x, y);
+    record(180, intercept_start);
+}
+
+static PFNGLVERTEX2SVPROC real_glVertex2sv;
+static void APIENTRY wrap_glVertex2sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(181);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex2sv(v);
+    record(181, intercept_start);
+}
+
+static PFNGLVERTEX3DPROC real_glVertex3d;
+static void APIENTRY wrap_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+    if (gl_capture_on) {
+        gl_capture_call(182);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex3d(x, y, z);
+    record(182, intercept_start);
+}
+
+static PFNGLVERTEX3DVPROC real_glVertex3dv;
+static void APIENTRY wrap_glVertex3dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(183);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex3dv(v);
+    record(183, intercept_start);
+}
+
+static PFNGLVERTEX3FPROC real_glVertex3f;
+static void APIENTRY wrap_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+    if (gl_capture_on) {
+        gl_capture_call(184);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex3f(x, y, z);
+    record(184, intercept_start);
+}
+
+static PFNGLVERTEX3FVPROC real_glVertex3fv;
+static void APIENTRY wrap_glVertex3fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(185);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex3fv(v);
+    record(185, intercept_start);
+}
+
+static PFNGLVERTEX3IPROC real_glVertex3i;
+static void APIENTRY wrap_glVertex3i(GLint x, GLint y, GLint z) {
+    if (gl_capture_on) {
+        gl_capture_call(186);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex3i(x, y, z);
+    record(186, intercept_start);
+}
+
+static PFNGLVERTEX3IVPROC real_glVertex3iv;
+static void APIENTRY wrap_glVertex3iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(187);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex3iv(v);
+    record(187, intercept_start);
+}
+
+static PFNGLVERTEX3SPROC real_glVertex3s;
+static void APIENTRY wrap_glVertex3s(GLshort x, GLshort y, GLshort z) {
+    if (gl_capture_on) {
+        gl_capture_call(188);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex3s(x, y, z);
+    record(188, intercept_start);
+}
+
+static PFNGLVERTEX3SVPROC real_glVertex3sv;
+static void APIENTRY wrap_glVertex3sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(189);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex3sv(v);
+    record(189, intercept_start);
+}
+
+static PFNGLVERTEX4DPROC real_glVertex4d;
+static void APIENTRY wrap_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if (gl_capture_on) {
+        gl_capture_call(190);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+        gl_capture_f64(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex4d(x, y, z, w);
+    record(190, intercept_start);
+}
+
+static PFNGLVERTEX4DVPROC real_glVertex4dv;
+static void APIENTRY wrap_glVertex4dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(191);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex4dv(v);
+    record(191, intercept_start);
+}
+
+static PFNGLVERTEX4FPROC real_glVertex4f;
+static void APIENTRY wrap_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    if (gl_capture_on) {
+        gl_capture_call(192);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(z);
+        gl_capture_f32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex4f(x, y, z, w);
+    record(192, intercept_start);
+}
+
+static PFNGLVERTEX4FVPROC real_glVertex4fv;
+static void APIENTRY wrap_glVertex4fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(193);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex4fv(v);
+    record(193, intercept_start);
+}
+
+static PFNGLVERTEX4IPROC real_glVertex4i;
+static void APIENTRY wrap_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+    if (gl_capture_on) {
+        gl_capture_call(194);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+        gl_capture_u32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex4i(x, y, z, w);
+    record(194, intercept_start);
+}
+
+static PFNGLVERTEX4IVPROC real_glVertex4iv;
+static void APIENTRY wrap_glVertex4iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(195);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex4iv(v);
+    record(195, intercept_start);
+}
+
+static PFNGLVERTEX4SPROC real_glVertex4s;
+static void APIENTRY wrap_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    if (gl_capture_on) {
+        gl_capture_call(196);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+        gl_capture_u32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex4s(x, y, z, w);
+    record(196, intercept_start);
+}
+
+static PFNGLVERTEX4SVPROC real_glVertex4sv;
+static void APIENTRY wrap_glVertex4sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(197);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertex4sv(v);
+    record(197, intercept_start);
+}
+
+static PFNGLCLIPPLANEPROC real_glClipPlane;
+static void APIENTRY wrap_glClipPlane(GLenum plane, const GLdouble *equation) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(198);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClipPlane(plane, equation);
+    record(198, intercept_start);
+}
+
+static PFNGLCOLORMATERIALPROC real_glColorMaterial;
+static void APIENTRY wrap_glColorMaterial(GLenum face, GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(199);
+        gl_capture_u32(face);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColorMaterial(face, mode);
+    record(199, intercept_start);
+}
+
+static PFNGLFOGFPROC real_glFogf;
+static void APIENTRY wrap_glFogf(GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(200);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFogf(pname, param);
+    record(200, intercept_start);
+}
+
+static PFNGLFOGFVPROC real_glFogfv;
+static void APIENTRY wrap_glFogfv(GLenum pname, const GLfloat *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(201);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFogfv(pname, params);
+    record(201, intercept_start);
+}
+
+static PFNGLFOGIPROC real_glFogi;
+static void APIENTRY wrap_glFogi(GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(202);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFogi(pname, param);
+    record(202, intercept_start);
+}
+
+static PFNGLFOGIVPROC real_glFogiv;
+static void APIENTRY wrap_glFogiv(GLenum pname, const GLint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(203);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFogiv(pname, params);
+    record(203, intercept_start);
+}
+
+static PFNGLLIGHTFPROC real_glLightf;
+static void APIENTRY wrap_glLightf(GLenum light, GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(204);
+        gl_capture_u32(light);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLightf(light, pname, param);
+    record(204, intercept_start);
+}
+
+static PFNGLLIGHTFVPROC real_glLightfv;
+static void APIENTRY wrap_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(205);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLightfv(light, pname, params);
+    record(205, intercept_start);
+}
+
+static PFNGLLIGHTIPROC real_glLighti;
+static void APIENTRY wrap_glLighti(GLenum light, GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(206);
+        gl_capture_u32(light);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLighti(light, pname, param);
+    record(206, intercept_start);
+}
+
+static PFNGLLIGHTIVPROC real_glLightiv;
+static void APIENTRY wrap_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(207);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLightiv(light, pname, params);
+    record(207, intercept_start);
+}
+
+static PFNGLLIGHTMODELFPROC real_glLightModelf;
+static void APIENTRY wrap_glLightModelf(GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(208);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLightModelf(pname, param);
+    record(208, intercept_start);
+}
+
+static PFNGLLIGHTMODELFVPROC real_glLightModelfv;
+static void APIENTRY wrap_glLightModelfv(GLenum pname, const GLfloat *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(209);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLightModelfv(pname, params);
+    record(209, intercept_start);
+}
+
+static PFNGLLIGHTMODELIPROC real_glLightModeli;
+static void APIENTRY wrap_glLightModeli(GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(210);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLightModeli(pname, param);
+    record(210, intercept_start);
+}
+
+static PFNGLLIGHTMODELIVPROC real_glLightModeliv;
+static void APIENTRY wrap_glLightModeliv(GLenum pname, const GLint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(211);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLightModeliv(pname, params);
+    record(211, intercept_start);
+}
+
+static PFNGLLINESTIPPLEPROC real_glLineStipple;
+static void APIENTRY wrap_glLineStipple(GLint factor, GLushort pattern) {
+    if (gl_capture_on) {
+        gl_capture_call(212);
+        gl_capture_u32(factor);
+        gl_capture_u32(pattern);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLineStipple(factor, pattern);
+    record(212, intercept_start);
+}
+
+static PFNGLMATERIALFPROC real_glMaterialf;
+static void APIENTRY wrap_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(213);
+        gl_capture_u32(face);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMaterialf(face, pname, param);
+    record(213, intercept_start);
+}
+
+static PFNGLMATERIALFVPROC real_glMaterialfv;
+static void APIENTRY wrap_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(214);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMaterialfv(face, pname, params);
+    record(214, intercept_start);
+}
+
+static PFNGLMATERIALIPROC real_glMateriali;
+static void APIENTRY wrap_glMateriali(GLenum face, GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(215);
+        gl_capture_u32(face);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMateriali(face, pname, param);
+    record(215, intercept_start);
+}
+
+static PFNGLMATERIALIVPROC real_glMaterialiv;
+static void APIENTRY wrap_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(216);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMaterialiv(face, pname, params);
+    record(216, intercept_start);
+}
+
+static PFNGLPOLYGONSTIPPLEPROC real_glPolygonStipple;
+static void APIENTRY wrap_glPolygonStipple(const GLubyte *mask) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(217);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPolygonStipple(mask);
+    record(217, intercept_start);
+}
+
+static PFNGLSHADEMODELPROC real_glShadeModel;
+static void APIENTRY wrap_glShadeModel(GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(218);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glShadeModel(mode);
+    record(218, intercept_start);
+}
+
+static PFNGLTEXENVFPROC real_glTexEnvf;
+static void APIENTRY wrap_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(219);
+        gl_capture_u32(target);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexEnvf(target, pname, param);
+    record(219, intercept_start);
+}
+
+static PFNGLTEXENVFVPROC real_glTexEnvfv;
+static void APIENTRY wrap_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(220);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexEnvfv(target, pname, params);
+    record(220, intercept_start);
+}
+
+static PFNGLTEXENVIPROC real_glTexEnvi;
+static void APIENTRY wrap_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(221);
+        gl_capture_u32(target);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexEnvi(target, pname, param);
+    record(221, intercept_start);
+}
+
+static PFNGLTEXENVIVPROC real_glTexEnviv;
+static void APIENTRY wrap_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(222);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexEnviv(target, pname, params);
+    record(222, intercept_start);
+}
+
+static PFNGLTEXGENDPROC real_glTexGend;
+static void APIENTRY wrap_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+    if (gl_capture_on) {
+        gl_capture_call(223);
+        gl_capture_u32(coord);
+        gl_capture_u32(pname);
+        gl_capture_f64(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexGend(coord, pname, param);
+    record(223, intercept_start);
+}
+
+static PFNGLTEXGENDVPROC real_glTexGendv;
+static void APIENTRY wrap_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(224);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexGendv(coord, pname, params);
+    record(224, intercept_start);
+}
+
+static PFNGLTEXGENFPROC real_glTexGenf;
+static void APIENTRY wrap_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(225);
+        gl_capture_u32(coord);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexGenf(coord, pname, param);
+    record(225, intercept_start);
+}
+
+static PFNGLTEXGENFVPROC real_glTexGenfv;
+static void APIENTRY wrap_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(226);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexGenfv(coord, pname, params);
+    record(226, intercept_start);
+}
+
+static PFNGLTEXGENIPROC real_glTexGeni;
+static void APIENTRY wrap_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(227);
+        gl_capture_u32(coord);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexGeni(coord, pname, param);
+    record(227, intercept_start);
+}
+
+static PFNGLTEXGENIVPROC real_glTexGeniv;
+static void APIENTRY wrap_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(228);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexGeniv(coord, pname, params);
+    record(228, intercept_start);
+}
+
+static PFNGLFEEDBACKBUFFERPROC real_glFeedbackBuffer;
+static void APIENTRY wrap_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(229);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFeedbackBuffer(size, type, buffer);
+    record(229, intercept_start);
+}
+
+static PFNGLSELECTBUFFERPROC real_glSelectBuffer;
+static void APIENTRY wrap_glSelectBuffer(GLsizei size, GLuint *buffer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(230);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSelectBuffer(size, buffer);
+    record(230, intercept_start);
+}
+
+static PFNGLRENDERMODEPROC real_glRenderMode;
+static GLint APIENTRY wrap_glRenderMode(GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(231);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    GLint intercept_result = real_glRenderMode(mode);
+    record(231, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLINITNAMESPROC real_glInitNames;
+static void APIENTRY wrap_glInitNames(void) {
+    if (gl_capture_on) {
+        gl_capture_call(232);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glInitNames();
+    record(232, intercept_start);
+}
+
+static PFNGLLOADNAMEPROC real_glLoadName;
+static void APIENTRY wrap_glLoadName(GLuint name) {
+    if (gl_capture_on) {
+        gl_capture_call(233);
+        gl_capture_u32(name);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLoadName(name);
+    record(233, intercept_start);
+}
+
+static PFNGLPASSTHROUGHPROC real_glPassThrough;
+static void APIENTRY wrap_glPassThrough(GLfloat token) {
+    if (gl_capture_on) {
+        gl_capture_call(234);
+        gl_capture_f32(token);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPassThrough(token);
+    record(234, intercept_start);
+}
+
+static PFNGLPOPNAMEPROC real_glPopName;
+static void APIENTRY wrap_glPopName(void) {
+    if (gl_capture_on) {
+        gl_capture_call(235);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPopName();
+    record(235, intercept_start);
+}
+
+static PFNGLPUSHNAMEPROC real_glPushName;
+static void APIENTRY wrap_glPushName(GLuint name) {
+    if (gl_capture_on) {
+        gl_capture_call(236);
+        gl_capture_u32(name);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPushName(name);
+    record(236, intercept_start);
+}
+
+static PFNGLCLEARACCUMPROC real_glClearAccum;
+static void APIENTRY wrap_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(237);
+        gl_capture_f32(red);
+        gl_capture_f32(green);
+        gl_capture_f32(blue);
+        gl_capture_f32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearAccum(red, green, blue, alpha);
+    record(237, intercept_start);
+}
+
+static PFNGLCLEARINDEXPROC real_glClearIndex;
+static void APIENTRY wrap_glClearIndex(GLfloat c) {
+    if (gl_capture_on) {
+        gl_capture_call(238);
+        gl_capture_f32(c);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearIndex(c);
+    record(238, intercept_start);
+}
+
+static PFNGLINDEXMASKPROC real_glIndexMask;
+static void APIENTRY wrap_glIndexMask(GLuint mask) {
+    if (gl_capture_on) {
+        gl_capture_call(239);
+        gl_capture_u32(mask);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexMask(mask);
+    record(239, intercept_start);
+}
+
+static PFNGLACCUMPROC real_glAccum;
+static void APIENTRY wrap_glAccum(GLenum op, GLfloat value) {
+    if (gl_capture_on) {
+        gl_capture_call(240);
+        gl_capture_u32(op);
+        gl_capture_f32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glAccum(op, value);
+    record(240, intercept_start);
+}
+
+static PFNGLPOPATTRIBPROC real_glPopAttrib;
+static void APIENTRY wrap_glPopAttrib(void) {
+    if (gl_capture_on) {
+        gl_capture_call(241);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPopAttrib();
+    record(241, intercept_start);
+}
+
+static PFNGLPUSHATTRIBPROC real_glPushAttrib;
+static void APIENTRY wrap_glPushAttrib(GLbitfield mask) {
+    if (gl_capture_on) {
+        gl_capture_call(242);
+        gl_capture_u32(mask);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPushAttrib(mask);
+    record(242, intercept_start);
+}
+
+static PFNGLMAP1DPROC real_glMap1d;
+static void APIENTRY wrap_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(243);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMap1d(target, u1, u2, stride, order, points);
+    record(243, intercept_start);
+}
+
+static PFNGLMAP1FPROC real_glMap1f;
+static void APIENTRY wrap_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(244);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMap1f(target, u1, u2, stride, order, points);
+    record(244, intercept_start);
+}
+
+static PFNGLMAP2DPROC real_glMap2d;
+static void APIENTRY wrap_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(245);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+    record(245, intercept_start);
+}
+
+static PFNGLMAP2FPROC real_glMap2f;
+static void APIENTRY wrap_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(246);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+    record(246, intercept_start);
+}
+
+static PFNGLMAPGRID1DPROC real_glMapGrid1d;
+static void APIENTRY wrap_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+    if (gl_capture_on) {
+        gl_capture_call(247);
+        gl_capture_u32(un);
+        gl_capture_f64(u1);
+        gl_capture_f64(u2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMapGrid1d(un, u1, u2);
+    record(247, intercept_start);
+}
+
+static PFNGLMAPGRID1FPROC real_glMapGrid1f;
+static void APIENTRY wrap_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+    if (gl_capture_on) {
+        gl_capture_call(248);
+        gl_capture_u32(un);
+        gl_capture_f32(u1);
+        gl_capture_f32(u2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMapGrid1f(un, u1, u2);
+    record(248, intercept_start);
+}
+
+static PFNGLMAPGRID2DPROC real_glMapGrid2d;
+static void APIENTRY wrap_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+    if (gl_capture_on) {
+        gl_capture_call(249);
+        gl_capture_u32(un);
+        gl_capture_f64(u1);
+        gl_capture_f64(u2);
+        gl_capture_u32(vn);
+        gl_capture_f64(v1);
+        gl_capture_f64(v2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMapGrid2d(un, u1, u2, vn, v1, v2);
+    record(249, intercept_start);
+}
+
+static PFNGLMAPGRID2FPROC real_glMapGrid2f;
+static void APIENTRY wrap_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+    if (gl_capture_on) {
+        gl_capture_call(250);
+        gl_capture_u32(un);
+        gl_capture_f32(u1);
+        gl_capture_f32(u2);
+        gl_capture_u32(vn);
+        gl_capture_f32(v1);
+        gl_capture_f32(v2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMapGrid2f(un, u1, u2, vn, v1, v2);
+    record(250, intercept_start);
+}
+
+static PFNGLEVALCOORD1DPROC real_glEvalCoord1d;
+static void APIENTRY wrap_glEvalCoord1d(GLdouble u) {
+    if (gl_capture_on) {
+        gl_capture_call(251);
+        gl_capture_f64(u);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalCoord1d(u);
+    record(251, intercept_start);
+}
+
+static PFNGLEVALCOORD1DVPROC real_glEvalCoord1dv;
+static void APIENTRY wrap_glEvalCoord1dv(const GLdouble *u) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(252);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalCoord1dv(u);
+    record(252, intercept_start);
+}
+
+static PFNGLEVALCOORD1FPROC real_glEvalCoord1f;
+static void APIENTRY wrap_glEvalCoord1f(GLfloat u) {
+    if (gl_capture_on) {
+        gl_capture_call(253);
+        gl_capture_f32(u);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalCoord1f(u);
+    record(253, intercept_start);
+}
+
+static PFNGLEVALCOORD1FVPROC real_glEvalCoord1fv;
+static void APIENTRY wrap_glEvalCoord1fv(const GLfloat *u) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(254);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalCoord1fv(u);
+    record(254, intercept_start);
+}
+
+static PFNGLEVALCOORD2DPROC real_glEvalCoord2d;
+static void APIENTRY wrap_glEvalCoord2d(GLdouble u, GLdouble v) {
+    if (gl_capture_on) {
+        gl_capture_call(255);
+        gl_capture_f64(u);
+        gl_capture_f64(v);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalCoord2d(u, v);
+    record(255, intercept_start);
+}
+
+static PFNGLEVALCOORD2DVPROC real_glEvalCoord2dv;
+static void APIENTRY wrap_glEvalCoord2dv(const GLdouble *u) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(256);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalCoord2dv(u);
+    record(256, intercept_start);
+}
+
+static PFNGLEVALCOORD2FPROC real_glEvalCoord2f;
+static void APIENTRY wrap_glEvalCoord2f(GLfloat u, GLfloat v) {
+    if (gl_capture_on) {
+        gl_capture_call(257);
+        gl_capture_f32(u);
+        gl_capture_f32(v);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalCoord2f(u, v);
+    record(257, intercept_start);
+}
+
+static PFNGLEVALCOORD2FVPROC real_glEvalCoord2fv;
+static void APIENTRY wrap_glEvalCoord2fv(const GLfloat *u) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(258);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalCoord2fv(u);
+    record(258, intercept_start);
+}
+
+static PFNGLEVALMESH1PROC real_glEvalMesh1;
+static void APIENTRY wrap_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+    if (gl_capture_on) {
+        gl_capture_call(259);
+        gl_capture_u32(mode);
+        gl_capture_u32(i1);
+        gl_capture_u32(i2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalMesh1(mode, i1, i2);
+    record(259, intercept_start);
+}
+
+static PFNGLEVALPOINT1PROC real_glEvalPoint1;
+static void APIENTRY wrap_glEvalPoint1(GLint i) {
+    if (gl_capture_on) {
+        gl_capture_call(260);
+        gl_capture_u32(i);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalPoint1(i);
+    record(260, intercept_start);
+}
+
+static PFNGLEVALMESH2PROC real_glEvalMesh2;
+static void APIENTRY wrap_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+    if (gl_capture_on) {
+        gl_capture_call(261);
+        gl_capture_u32(mode);
+        gl_capture_u32(i1);
+        gl_capture_u32(i2);
+        gl_capture_u32(j1);
+        gl_capture_u32(j2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalMesh2(mode, i1, i2, j1, j2);
+    record(261, intercept_start);
+}
+
+static PFNGLEVALPOINT2PROC real_glEvalPoint2;
+static void APIENTRY wrap_glEvalPoint2(GLint i, GLint j) {
+    if (gl_capture_on) {
+        gl_capture_call(262);
+        gl_capture_u32(i);
+        gl_capture_u32(j);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEvalPoint2(i, j);
+    record(262, intercept_start);
+}
+
+static PFNGLALPHAFUNCPROC real_glAlphaFunc;
+static void APIENTRY wrap_glAlphaFunc(GLenum func, GLfloat ref) {
+    if (gl_capture_on) {
+        gl_capture_call(263);
+        gl_capture_u32(func);
+        gl_capture_f32(ref);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glAlphaFunc(func, ref);
+    record(263, intercept_start);
+}
+
+static PFNGLPIXELZOOMPROC real_glPixelZoom;
+static void APIENTRY wrap_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+    if (gl_capture_on) {
+        gl_capture_call(264);
+        gl_capture_f32(xfactor);
+        gl_capture_f32(yfactor);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPixelZoom(xfactor, yfactor);
+    record(264, intercept_start);
+}
+
+static PFNGLPIXELTRANSFERFPROC real_glPixelTransferf;
+static void APIENTRY wrap_glPixelTransferf(GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(265);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPixelTransferf(pname, param);
+    record(265, intercept_start);
+}
+
+static PFNGLPIXELTRANSFERIPROC real_glPixelTransferi;
+static void APIENTRY wrap_glPixelTransferi(GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(266);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPixelTransferi(pname, param);
+    record(266, intercept_start);
+}
+
+static PFNGLPIXELMAPFVPROC real_glPixelMapfv;
+static void APIENTRY wrap_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(267);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPixelMapfv(map, mapsize, values);
+    record(267, intercept_start);
+}
+
+static PFNGLPIXELMAPUIVPROC real_glPixelMapuiv;
+static void APIENTRY wrap_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(268);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPixelMapuiv(map, mapsize, values);
+    record(268, intercept_start);
+}
+
+static PFNGLPIXELMAPUSVPROC real_glPixelMapusv;
+static void APIENTRY wrap_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(269);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPixelMapusv(map, mapsize, values);
+    record(269, intercept_start);
+}
+
+static PFNGLCOPYPIXELSPROC real_glCopyPixels;
+static void APIENTRY wrap_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+    if (gl_capture_on) {
+        gl_capture_call(270);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(type);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyPixels(x, y, width, height, type);
+    record(270, intercept_start);
+}
+
+static PFNGLDRAWPIXELSPROC real_glDrawPixels;
+static void APIENTRY wrap_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(271);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawPixels(width, height, format, type, pixels);
+    record(271, intercept_start);
+}
+
+static PFNGLGETCLIPPLANEPROC real_glGetClipPlane;
+static void APIENTRY wrap_glGetClipPlane(GLenum plane, GLdouble *equation) {
+    uint64_t intercept_start = now_ns();
+    real_glGetClipPlane(plane, equation);
+    record(272, intercept_start);
+}
+
+static PFNGLGETLIGHTFVPROC real_glGetLightfv;
+static void APIENTRY wrap_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetLightfv(light, pname, params);
+    record(273, intercept_start);
+}
+
+static PFNGLGETLIGHTIVPROC real_glGetLightiv;
+static void APIENTRY wrap_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetLightiv(light, pname, params);
+    record(274, intercept_start);
+}
+
+static PFNGLGETMAPDVPROC real_glGetMapdv;
+static void APIENTRY wrap_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+    uint64_t intercept_start = now_ns();
+    real_glGetMapdv(target, query, v);
+    record(275, intercept_start);
+}
+
+static PFNGLGETMAPFVPROC real_glGetMapfv;
+static void APIENTRY wrap_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+    uint64_t intercept_start = now_ns();
+    real_glGetMapfv(target, query, v);
+    record(276, intercept_start);
+}
+
+static PFNGLGETMAPIVPROC real_glGetMapiv;
+static void APIENTRY wrap_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+    uint64_t intercept_start = now_ns();
+    real_glGetMapiv(target, query, v);
+    record(277, intercept_start);
+}
+
+static PFNGLGETMATERIALFVPROC real_glGetMaterialfv;
+static void APIENTRY wrap_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetMaterialfv(face, pname, params);
+    record(278, intercept_start);
+}
+
+static PFNGLGETMATERIALIVPROC real_glGetMaterialiv;
+static void APIENTRY wrap_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetMaterialiv(face, pname, params);
+    record(279, intercept_start);
+}
+
+static PFNGLGETPIXELMAPFVPROC real_glGetPixelMapfv;
+static void APIENTRY wrap_glGetPixelMapfv(GLenum map, GLfloat *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetPixelMapfv(map, values);
+    record(280, intercept_start);
+}
+
+static PFNGLGETPIXELMAPUIVPROC real_glGetPixelMapuiv;
+static void APIENTRY wrap_glGetPixelMapuiv(GLenum map, GLuint *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetPixelMapuiv(map, values);
+    record(281, intercept_start);
+}
+
+static PFNGLGETPIXELMAPUSVPROC real_glGetPixelMapusv;
+static void APIENTRY wrap_glGetPixelMapusv(GLenum map, GLushort *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetPixelMapusv(map, values);
+    record(282, intercept_start);
+}
+
+static PFNGLGETPOLYGONSTIPPLEPROC real_glGetPolygonStipple;
+static void APIENTRY wrap_glGetPolygonStipple(GLubyte *mask) {
+    uint64_t intercept_start = now_ns();
+    real_glGetPolygonStipple(mask);
+    record(283, intercept_start);
+}
+
+static PFNGLGETTEXENVFVPROC real_glGetTexEnvfv;
+static void APIENTRY wrap_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexEnvfv(target, pname, params);
+    record(284, intercept_start);
+}
+
+static PFNGLGETTEXENVIVPROC real_glGetTexEnviv;
+static void APIENTRY wrap_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexEnviv(target, pname, params);
+    record(285, intercept_start);
+}
+
+static PFNGLGETTEXGENDVPROC real_glGetTexGendv;
+static void APIENTRY wrap_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexGendv(coord, pname, params);
+    record(286, intercept_start);
+}
+
+static PFNGLGETTEXGENFVPROC real_glGetTexGenfv;
+static void APIENTRY wrap_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexGenfv(coord, pname, params);
+    record(287, intercept_start);
+}
+
+static PFNGLGETTEXGENIVPROC real_glGetTexGeniv;
+static void APIENTRY wrap_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexGeniv(coord, pname, params);
+    record(288, intercept_start);
+}
+
+static PFNGLISLISTPROC real_glIsList;
+static GLboolean APIENTRY wrap_glIsList(GLuint list) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsList(list);
+    record(289, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLFRUSTUMPROC real_glFrustum;
+static void APIENTRY wrap_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    if (gl_capture_on) {
+        gl_capture_call(290);
+        gl_capture_f64(left);
+        gl_capture_f64(right);
+        gl_capture_f64(bottom);
+        gl_capture_f64(top);
+        gl_capture_f64(zNear);
+        gl_capture_f64(zFar);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFrustum(left, right, bottom, top, zNear, zFar);
+    record(290, intercept_start);
+}
+
+static PFNGLLOADIDENTITYPROC real_glLoadIdentity;
+static void APIENTRY wrap_glLoadIdentity(void) {
+    if (gl_capture_on) {
+        gl_capture_call(291);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLoadIdentity();
+    record(291, intercept_start);
+}
+
+static PFNGLLOADMATRIXFPROC real_glLoadMatrixf;
+static void APIENTRY wrap_glLoadMatrixf(const GLfloat *m) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(292);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLoadMatrixf(m);
+    record(292, intercept_start);
+}
+
+static PFNGLLOADMATRIXDPROC real_glLoadMatrixd;
+static void APIENTRY wrap_glLoadMatrixd(const GLdouble *m) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(293);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLoadMatrixd(m);
+    record(293, intercept_start);
+}
+
+static PFNGLMATRIXMODEPROC real_glMatrixMode;
+static void APIENTRY wrap_glMatrixMode(GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(294);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMatrixMode(mode);
+    record(294, intercept_start);
+}
+
+static PFNGLMULTMATRIXFPROC real_glMultMatrixf;
+static void APIENTRY wrap_glMultMatrixf(const GLfloat *m) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(295);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultMatrixf(m);
+    record(295, intercept_start);
+}
+
+static PFNGLMULTMATRIXDPROC real_glMultMatrixd;
+static void APIENTRY wrap_glMultMatrixd(const GLdouble *m) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(296);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultMatrixd(m);
+    record(296, intercept_start);
+}
+
+static PFNGLORTHOPROC real_glOrtho;
+static void APIENTRY wrap_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    if (gl_capture_on) {
+        gl_capture_call(297);
+        gl_capture_f64(left);
+        gl_capture_f64(right);
+        gl_capture_f64(bottom);
+        gl_capture_f64(top);
+        gl_capture_f64(zNear);
+        gl_capture_f64(zFar);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glOrtho(left, right, bottom, top, zNear, zFar);
+    record(297, intercept_start);
+}
+
+static PFNGLPOPMATRIXPROC real_glPopMatrix;
+static void APIENTRY wrap_glPopMatrix(void) {
+    if (gl_capture_on) {
+        gl_capture_call(298);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPopMatrix();
+    record(298, intercept_start);
+}
+
+static PFNGLPUSHMATRIXPROC real_glPushMatrix;
+static void APIENTRY wrap_glPushMatrix(void) {
+    if (gl_capture_on) {
+        gl_capture_call(299);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPushMatrix();
+    record(299, intercept_start);
+}
+
+static PFNGLROTATEDPROC real_glRotated;
+static void APIENTRY wrap_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+    if (gl_capture_on) {
+        gl_capture_call(300);
+        gl_capture_f64(angle);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRotated(angle, x, y, z);
+    record(300, intercept_start);
+}
+
+static PFNGLROTATEFPROC real_glRotatef;
+static void APIENTRY wrap_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+    if (gl_capture_on) {
+        gl_capture_call(301);
+        gl_capture_f32(angle);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRotatef(angle, x, y, z);
+    record(301, intercept_start);
+}
+
+static PFNGLSCALEDPROC real_glScaled;
+static void APIENTRY wrap_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+    if (gl_capture_on) {
+        gl_capture_call(302);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glScaled(x, y, z);
+    record(302, intercept_start);
+}
+
+static PFNGLSCALEFPROC real_glScalef;
+static void APIENTRY wrap_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+    if (gl_capture_on) {
+        gl_capture_call(303);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glScalef(x, y, z);
+    record(303, intercept_start);
+}
+
+static PFNGLTRANSLATEDPROC real_glTranslated;
+static void APIENTRY wrap_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+    if (gl_capture_on) {
+        gl_capture_call(304);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTranslated(x, y, z);
+    record(304, intercept_start);
+}
+
+static PFNGLTRANSLATEFPROC real_glTranslatef;
+static void APIENTRY wrap_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+    if (gl_capture_on) {
+        gl_capture_call(305);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTranslatef(x, y, z);
+    record(305, intercept_start);
+}
+
+static PFNGLDRAWARRAYSPROC real_glDrawArrays;
+static void APIENTRY wrap_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    if (gl_capture_on) {
+        gl_capture_call(306);
+        gl_capture_u32(mode);
+        gl_capture_u32(first);
+        gl_capture_u32(count);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawArrays(mode, first, count);
+    record(306, intercept_start);
+}
+
+static PFNGLDRAWELEMENTSPROC real_glDrawElements;
+static void APIENTRY wrap_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    if (gl_capture_on) {
+        gl_capture_call(307);
+        gl_capture_u32(mode);
+        gl_capture_u32(count);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indices);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawElements(mode, count, type, indices);
+    record(307, intercept_start);
+}
+
+static PFNGLGETPOINTERVPROC real_glGetPointerv;
+static void APIENTRY wrap_glGetPointerv(GLenum pname, void **params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetPointerv(pname, params);
+    record(308, intercept_start);
+}
+
+static PFNGLPOLYGONOFFSETPROC real_glPolygonOffset;
+static void APIENTRY wrap_glPolygonOffset(GLfloat factor, GLfloat units) {
+    if (gl_capture_on) {
+        gl_capture_call(309);
+        gl_capture_f32(factor);
+        gl_capture_f32(units);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPolygonOffset(factor, units);
+    record(309, intercept_start);
+}
+
+static PFNGLCOPYTEXIMAGE1DPROC real_glCopyTexImage1D;
+static void APIENTRY wrap_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    if (gl_capture_on) {
+        gl_capture_call(310);
+        gl_capture_u32(target);
+        gl_capture_u32(level);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+        gl_capture_u32(border);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+    record(310, intercept_start);
+}
+
+static PFNGLCOPYTEXIMAGE2DPROC real_glCopyTexImage2D;
+static void APIENTRY wrap_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    if (gl_capture_on) {
+        gl_capture_call(311);
+        gl_capture_u32(target);
+        gl_capture_u32(level);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(border);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+    record(311, intercept_start);
+}
+
+static PFNGLCOPYTEXSUBIMAGE1DPROC real_glCopyTexSubImage1D;
+static void APIENTRY wrap_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    if (gl_capture_on) {
+        gl_capture_call(312);
+        gl_capture_u32(target);
+        gl_capture_u32(level);
+        gl_capture_u32(xoffset);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+    record(312, intercept_start);
+}
+
+static PFNGLCOPYTEXSUBIMAGE2DPROC real_glCopyTexSubImage2D;
+static void APIENTRY wrap_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(313);
+        gl_capture_u32(target);
+        gl_capture_u32(level);
+        gl_capture_u32(xoffset);
+        gl_capture_u32(yoffset);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+    record(313, intercept_start);
+}
+
+static PFNGLTEXSUBIMAGE1DPROC real_glTexSubImage1D;
+static void APIENTRY wrap_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(314);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+    record(314, intercept_start);
+}
+
+static PFNGLTEXSUBIMAGE2DPROC real_glTexSubImage2D;
+static void APIENTRY wrap_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    if (gl_capture_on) {
+        gl_capture_call(315);
+        gl_capture_u32(target);
+        gl_capture_u32(level);
+        gl_capture_u32(xoffset);
+        gl_capture_u32(yoffset);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(format);
+        gl_capture_u32(type);
+        gl_capture_image(pixels, width, height, format, type);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    record(315, intercept_start);
+}
+
+static PFNGLBINDTEXTUREPROC real_glBindTexture;
+static void APIENTRY wrap_glBindTexture(GLenum target, GLuint texture) {
+    if (gl_capture_on) {
+        gl_capture_call(316);
+        gl_capture_u32(target);
+        gl_capture_u32(texture);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindTexture(target, texture);
+    record(316, intercept_start);
+}
+
+static PFNGLDELETETEXTURESPROC real_glDeleteTextures;
+static void APIENTRY wrap_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    if (gl_capture_on) {
+        gl_capture_call(317);
+        gl_capture_u32(n);
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(textures[i]);
+        }
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteTextures(n, textures);
+    record(317, intercept_start);
+}
+
+static PFNGLGENTEXTURESPROC real_glGenTextures;
+static void APIENTRY wrap_glGenTextures(GLsizei n, GLuint *textures) {
+    if (gl_capture_on) {
+        gl_capture_call(318);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenTextures(n, textures);
+    record(318, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(textures[i]);
+        }
+    }
+}
+
+static PFNGLISTEXTUREPROC real_glIsTexture;
+static GLboolean APIENTRY wrap_glIsTexture(GLuint texture) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsTexture(texture);
+    record(319, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLARRAYELEMENTPROC real_glArrayElement;
+static void APIENTRY wrap_glArrayElement(GLint i) {
+    if (gl_capture_on) {
+        gl_capture_call(320);
+        gl_capture_u32(i);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glArrayElement(i);
+    record(320, intercept_start);
+}
+
+static PFNGLCOLORPOINTERPROC real_glColorPointer;
+static void APIENTRY wrap_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(321);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColorPointer(size, type, stride, pointer);
+    record(321, intercept_start);
+}
+
+static PFNGLDISABLECLIENTSTATEPROC real_glDisableClientState;
+static void APIENTRY wrap_glDisableClientState(GLenum array) {
+    if (gl_capture_on) {
+        gl_capture_call(322);
+        gl_capture_u32(array);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDisableClientState(array);
+    record(322, intercept_start);
+}
+
+static PFNGLEDGEFLAGPOINTERPROC real_glEdgeFlagPointer;
+static void APIENTRY wrap_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(323);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEdgeFlagPointer(stride, pointer);
+    record(323, intercept_start);
+}
+
+static PFNGLENABLECLIENTSTATEPROC real_glEnableClientState;
+static void APIENTRY wrap_glEnableClientState(GLenum array) {
+    if (gl_capture_on) {
+        gl_capture_call(324);
+        gl_capture_u32(array);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEnableClientState(array);
+    record(324, intercept_start);
+}
+
+static PFNGLINDEXPOINTERPROC real_glIndexPointer;
+static void APIENTRY wrap_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(325);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexPointer(type, stride, pointer);
+    record(325, intercept_start);
+}
+
+static PFNGLINTERLEAVEDARRAYSPROC real_glInterleavedArrays;
+static void APIENTRY wrap_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(326);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glInterleavedArrays(format, stride, pointer);
+    record(326, intercept_start);
+}
+
+static PFNGLNORMALPOINTERPROC real_glNormalPointer;
+static void APIENTRY wrap_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(327);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormalPointer(type, stride, pointer);
+    record(327, intercept_start);
+}
+
+static PFNGLTEXCOORDPOINTERPROC real_glTexCoordPointer;
+static void APIENTRY wrap_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(328);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoordPointer(size, type, stride, pointer);
+    record(328, intercept_start);
+}
+
+static PFNGLVERTEXPOINTERPROC real_glVertexPointer;
+static void APIENTRY wrap_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(329);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexPointer(size, type, stride, pointer);
+    record(329, intercept_start);
+}
+
+static PFNGLARETEXTURESRESIDENTPROC real_glAreTexturesResident;
+static GLboolean APIENTRY wrap_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glAreTexturesResident(n, textures, residences);
+    record(330, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLPRIORITIZETEXTURESPROC real_glPrioritizeTextures;
+static void APIENTRY wrap_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(331);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPrioritizeTextures(n, textures, priorities);
+    record(331, intercept_start);
+}
+
+static PFNGLINDEXUBPROC real_glIndexub;
+static void APIENTRY wrap_glIndexub(GLubyte c) {
+    if (gl_capture_on) {
+        gl_capture_call(332);
+        gl_capture_u32(c);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexub(c);
+    record(332, intercept_start);
+}
+
+static PFNGLINDEXUBVPROC real_glIndexubv;
+static void APIENTRY wrap_glIndexubv(const GLubyte *c) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(333);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glIndexubv(c);
+    record(333, intercept_start);
+}
+
+static PFNGLPOPCLIENTATTRIBPROC real_glPopClientAttrib;
+static void APIENTRY wrap_glPopClientAttrib(void) {
+    if (gl_capture_on) {
+        gl_capture_call(334);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPopClientAttrib();
+    record(334, intercept_start);
+}
+
+static PFNGLPUSHCLIENTATTRIBPROC real_glPushClientAttrib;
+static void APIENTRY wrap_glPushClientAttrib(GLbitfield mask) {
+    if (gl_capture_on) {
+        gl_capture_call(335);
+        gl_capture_u32(mask);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPushClientAttrib(mask);
+    record(335, intercept_start);
+}
+
+static PFNGLDRAWRANGEELEMENTSPROC real_glDrawRangeElements;
+static void APIENTRY wrap_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    if (gl_capture_on) {
+        gl_capture_call(336);
+        gl_capture_u32(mode);
+        gl_capture_u32(start);
+        gl_capture_u32(end);
+        gl_capture_u32(count);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indices);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawRangeElements(mode, start, end, count, type, indices);
+    record(336, intercept_start);
+}
+
+static PFNGLTEXIMAGE3DPROC real_glTexImage3D;
+static void APIENTRY wrap_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(337);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    record(337, intercept_start);
+}
+
+static PFNGLTEXSUBIMAGE3DPROC real_glTexSubImage3D;
+static void APIENTRY wrap_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(338);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    record(338, intercept_start);
+}
+
+static PFNGLCOPYTEXSUBIMAGE3DPROC real_glCopyTexSubImage3D;
+static void APIENTRY wrap_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(339);
+        gl_capture_u32(target);
+        gl_capture_u32(level);
+        gl_capture_u32(xoffset);
+        gl_capture_u32(yoffset);
+        gl_capture_u32(zoffset);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    record(339, intercept_start);
+}
+
+static PFNGLACTIVETEXTUREPROC real_glActiveTexture;
+static void APIENTRY wrap_glActiveTexture(GLenum texture) {
+    if (gl_capture_on) {
+        gl_capture_call(340);
+        gl_capture_u32(texture);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glActiveTexture(texture);
+    record(340, intercept_start);
+}
+
+static PFNGLSAMPLECOVERAGEPROC real_glSampleCoverage;
+static void APIENTRY wrap_glSampleCoverage(GLfloat value, GLboolean invert) {
+    if (gl_capture_on) {
+        gl_capture_call(341);
+        gl_capture_f32(value);
+        gl_capture_u32(invert);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSampleCoverage(value, invert);
+    record(341, intercept_start);
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC real_glCompressedTexImage3D;
+static void APIENTRY wrap_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(342);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+    record(342, intercept_start);
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC real_glCompressedTexImage2D;
+static void APIENTRY wrap_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(343);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+    record(343, intercept_start);
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC real_glCompressedTexImage1D;
+static void APIENTRY wrap_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(344);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+    record(344, intercept_start);
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC real_glCompressedTexSubImage3D;
+static void APIENTRY wrap_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(345);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    record(345, intercept_start);
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC real_glCompressedTexSubImage2D;
+static void APIENTRY wrap_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(346);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    record(346, intercept_start);
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC real_glCompressedTexSubImage1D;
+static void APIENTRY wrap_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(347);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+    record(347, intercept_start);
+}
+
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC real_glGetCompressedTexImage;
+static void APIENTRY wrap_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+    uint64_t intercept_start = now_ns();
+    real_glGetCompressedTexImage(target, level, img);
+    record(348, intercept_start);
+}
+
+static PFNGLCLIENTACTIVETEXTUREPROC real_glClientActiveTexture;
+static void APIENTRY wrap_glClientActiveTexture(GLenum texture) {
+    if (gl_capture_on) {
+        gl_capture_call(349);
+        gl_capture_u32(texture);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClientActiveTexture(texture);
+    record(349, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD1DPROC real_glMultiTexCoord1d;
+static void APIENTRY wrap_glMultiTexCoord1d(GLenum target, GLdouble s) {
+    if (gl_capture_on) {
+        gl_capture_call(350);
+        gl_capture_u32(target);
+        gl_capture_f64(s);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord1d(target, s);
+    record(350, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD1DVPROC real_glMultiTexCoord1dv;
+static void APIENTRY wrap_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(351);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord1dv(target, v);
+    record(351, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD1FPROC real_glMultiTexCoord1f;
+static void APIENTRY wrap_glMultiTexCoord1f(GLenum target, GLfloat s) {
+    if (gl_capture_on) {
+        gl_capture_call(352);
+        gl_capture_u32(target);
+        gl_capture_f32(s);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord1f(target, s);
+    record(352, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD1FVPROC real_glMultiTexCoord1fv;
+static void APIENTRY wrap_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(353);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord1fv(target, v);
+    record(353, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD1IPROC real_glMultiTexCoord1i;
+static void APIENTRY wrap_glMultiTexCoord1i(GLenum target, GLint s) {
+    if (gl_capture_on) {
+        gl_capture_call(354);
+        gl_capture_u32(target);
+        gl_capture_u32(s);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord1i(target, s);
+    record(354, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD1IVPROC real_glMultiTexCoord1iv;
+static void APIENTRY wrap_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(355);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord1iv(target, v);
+    record(355, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD1SPROC real_glMultiTexCoord1s;
+static void APIENTRY wrap_glMultiTexCoord1s(GLenum target, GLshort s) {
+    if (gl_capture_on) {
+        gl_capture_call(356);
+        gl_capture_u32(target);
+        gl_capture_u32(s);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord1s(target, s);
+    record(356, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD1SVPROC real_glMultiTexCoord1sv;
+static void APIENTRY wrap_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(357);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord1sv(target, v);
+    record(357, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD2DPROC real_glMultiTexCoord2d;
+static void APIENTRY wrap_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+    if (gl_capture_on) {
+        gl_capture_call(358);
+        gl_capture_u32(target);
+        gl_capture_f64(s);
+        gl_capture_f64(t);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord2d(target, s, t);
+    record(358, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD2DVPROC real_glMultiTexCoord2dv;
+static void APIENTRY wrap_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(359);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord2dv(target, v);
+    record(359, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD2FPROC real_glMultiTexCoord2f;
+static void APIENTRY wrap_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+    if (gl_capture_on) {
+        gl_capture_call(360);
+        gl_capture_u32(target);
+        gl_capture_f32(s);
+        gl_capture_f32(t);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord2f(target, s, t);
+    record(360, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD2FVPROC real_glMultiTexCoord2fv;
+static void APIENTRY wrap_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(361);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord2fv(target, v);
+    record(361, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD2IPROC real_glMultiTexCoord2i;
+static void APIENTRY wrap_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+    if (gl_capture_on) {
+        gl_capture_call(362);
+        gl_capture_u32(target);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord2i(target, s, t);
+    record(362, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD2IVPROC real_glMultiTexCoord2iv;
+static void APIENTRY wrap_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(363);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord2iv(target, v);
+    record(363, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD2SPROC real_glMultiTexCoord2s;
+static void APIENTRY wrap_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+    if (gl_capture_on) {
+        gl_capture_call(364);
+        gl_capture_u32(target);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord2s(target, s, t);
+    record(364, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD2SVPROC real_glMultiTexCoord2sv;
+static void APIENTRY wrap_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(365);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord2sv(target, v);
+    record(365, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD3DPROC real_glMultiTexCoord3d;
+static void APIENTRY wrap_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+    if (gl_capture_on) {
+        gl_capture_call(366);
+        gl_capture_u32(target);
+        gl_capture_f64(s);
+        gl_capture_f64(t);
+        gl_capture_f64(r);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord3d(target, s, t, r);
+    record(366, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD3DVPROC real_glMultiTexCoord3dv;
+static void APIENTRY wrap_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(367);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord3dv(target, v);
+    record(367, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD3FPROC real_glMultiTexCoord3f;
+static void APIENTRY wrap_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+    if (gl_capture_on) {
+        gl_capture_call(368);
+        gl_capture_u32(target);
+        gl_capture_f32(s);
+        gl_capture_f32(t);
+        gl_capture_f32(r);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord3f(target, s, t, r);
+    record(368, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD3FVPROC real_glMultiTexCoord3fv;
+static void APIENTRY wrap_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(369);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord3fv(target, v);
+    record(369, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD3IPROC real_glMultiTexCoord3i;
+static void APIENTRY wrap_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+    if (gl_capture_on) {
+        gl_capture_call(370);
+        gl_capture_u32(target);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+        gl_capture_u32(r);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord3i(target, s, t, r);
+    record(370, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD3IVPROC real_glMultiTexCoord3iv;
+static void APIENTRY wrap_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(371);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord3iv(target, v);
+    record(371, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD3SPROC real_glMultiTexCoord3s;
+static void APIENTRY wrap_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+    if (gl_capture_on) {
+        gl_capture_call(372);
+        gl_capture_u32(target);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+        gl_capture_u32(r);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord3s(target, s, t, r);
+    record(372, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD3SVPROC real_glMultiTexCoord3sv;
+static void APIENTRY wrap_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(373);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord3sv(target, v);
+    record(373, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD4DPROC real_glMultiTexCoord4d;
+static void APIENTRY wrap_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    if (gl_capture_on) {
+        gl_capture_call(374);
+        gl_capture_u32(target);
+        gl_capture_f64(s);
+        gl_capture_f64(t);
+        gl_capture_f64(r);
+        gl_capture_f64(q);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord4d(target, s, t, r, q);
+    record(374, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD4DVPROC real_glMultiTexCoord4dv;
+static void APIENTRY wrap_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(375);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord4dv(target, v);
+    record(375, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD4FPROC real_glMultiTexCoord4f;
+static void APIENTRY wrap_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    if (gl_capture_on) {
+        gl_capture_call(376);
+        gl_capture_u32(target);
+        gl_capture_f32(s);
+        gl_capture_f32(t);
+        gl_capture_f32(r);
+        gl_capture_f32(q);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord4f(target, s, t, r, q);
+    record(376, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD4FVPROC real_glMultiTexCoord4fv;
+static void APIENTRY wrap_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(377);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord4fv(target, v);
+    record(377, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD4IPROC real_glMultiTexCoord4i;
+static void APIENTRY wrap_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+    if (gl_capture_on) {
+        gl_capture_call(378);
+        gl_capture_u32(target);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+        gl_capture_u32(r);
+        gl_capture_u32(q);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord4i(target, s, t, r, q);
+    record(378, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD4IVPROC real_glMultiTexCoord4iv;
+static void APIENTRY wrap_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(379);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord4iv(target, v);
+    record(379, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD4SPROC real_glMultiTexCoord4s;
+static void APIENTRY wrap_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+    if (gl_capture_on) {
+        gl_capture_call(380);
+        gl_capture_u32(target);
+        gl_capture_u32(s);
+        gl_capture_u32(t);
+        gl_capture_u32(r);
+        gl_capture_u32(q);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord4s(target, s, t, r, q);
+    record(380, intercept_start);
+}
+
+static PFNGLMULTITEXCOORD4SVPROC real_glMultiTexCoord4sv;
+static void APIENTRY wrap_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(381);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoord4sv(target, v);
+    record(381, intercept_start);
+}
+
+static PFNGLLOADTRANSPOSEMATRIXFPROC real_glLoadTransposeMatrixf;
+static void APIENTRY wrap_glLoadTransposeMatrixf(const GLfloat *m) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(382);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLoadTransposeMatrixf(m);
+    record(382, intercept_start);
+}
+
+static PFNGLLOADTRANSPOSEMATRIXDPROC real_glLoadTransposeMatrixd;
+static void APIENTRY wrap_glLoadTransposeMatrixd(const GLdouble *m) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(383);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLoadTransposeMatrixd(m);
+    record(383, intercept_start);
+}
+
+static PFNGLMULTTRANSPOSEMATRIXFPROC real_glMultTransposeMatrixf;
+static void APIENTRY wrap_glMultTransposeMatrixf(const GLfloat *m) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(384);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultTransposeMatrixf(m);
+    record(384, intercept_start);
+}
+
+static PFNGLMULTTRANSPOSEMATRIXDPROC real_glMultTransposeMatrixd;
+static void APIENTRY wrap_glMultTransposeMatrixd(const GLdouble *m) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(385);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultTransposeMatrixd(m);
+    record(385, intercept_start);
+}
+
+static PFNGLBLENDFUNCSEPARATEPROC real_glBlendFuncSeparate;
+static void APIENTRY wrap_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    if (gl_capture_on) {
+        gl_capture_call(386);
+        gl_capture_u32(sfactorRGB);
+        gl_capture_u32(dfactorRGB);
+        gl_capture_u32(sfactorAlpha);
+        gl_capture_u32(dfactorAlpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    record(386, intercept_start);
+}
+
+static PFNGLMULTIDRAWARRAYSPROC real_glMultiDrawArrays;
+static void APIENTRY wrap_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(387);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiDrawArrays(mode, first, count, drawcount);
+    record(387, intercept_start);
+}
+
+static PFNGLMULTIDRAWELEMENTSPROC real_glMultiDrawElements;
+static void APIENTRY wrap_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(388);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiDrawElements(mode, count, type, indices, drawcount);
+    record(388, intercept_start);
+}
+
+static PFNGLPOINTPARAMETERFPROC real_glPointParameterf;
+static void APIENTRY wrap_glPointParameterf(GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(389);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPointParameterf(pname, param);
+    record(389, intercept_start);
+}
+
+static PFNGLPOINTPARAMETERFVPROC real_glPointParameterfv;
+static void APIENTRY wrap_glPointParameterfv(GLenum pname, const GLfloat *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(390);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPointParameterfv(pname, params);
+    record(390, intercept_start);
+}
+
+static PFNGLPOINTPARAMETERIPROC real_glPointParameteri;
+static void APIENTRY wrap_glPointParameteri(GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(391);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPointParameteri(pname, param);
+    record(391, intercept_start);
+}
+
+static PFNGLPOINTPARAMETERIVPROC real_glPointParameteriv;
+static void APIENTRY wrap_glPointParameteriv(GLenum pname, const GLint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(392);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPointParameteriv(pname, params);
+    record(392, intercept_start);
+}
+
+static PFNGLFOGCOORDFPROC real_glFogCoordf;
+static void APIENTRY wrap_glFogCoordf(GLfloat coord) {
+    if (gl_capture_on) {
+        gl_capture_call(393);
+        gl_capture_f32(coord);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFogCoordf(coord);
+    record(393, intercept_start);
+}
+
+static PFNGLFOGCOORDFVPROC real_glFogCoordfv;
+static void APIENTRY wrap_glFogCoordfv(const GLfloat *coord) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(394);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFogCoordfv(coord);
+    record(394, intercept_start);
+}
+
+static PFNGLFOGCOORDDPROC real_glFogCoordd;
+static void APIENTRY wrap_glFogCoordd(GLdouble coord) {
+    if (gl_capture_on) {
+        gl_capture_call(395);
+        gl_capture_f64(coord);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFogCoordd(coord);
+    record(395, intercept_start);
+}
+
+static PFNGLFOGCOORDDVPROC real_glFogCoorddv;
+static void APIENTRY wrap_glFogCoorddv(const GLdouble *coord) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(396);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFogCoorddv(coord);
+    record(396, intercept_start);
+}
+
+static PFNGLFOGCOORDPOINTERPROC real_glFogCoordPointer;
+static void APIENTRY wrap_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(397);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFogCoordPointer(type, stride, pointer);
+    record(397, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3BPROC real_glSecondaryColor3b;
+static void APIENTRY wrap_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    if (gl_capture_on) {
+        gl_capture_call(398);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3b(red, green, blue);
+    record(398, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3BVPROC real_glSecondaryColor3bv;
+static void APIENTRY wrap_glSecondaryColor3bv(const GLbyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(399);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3bv(v);
+    record(399, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3DPROC real_glSecondaryColor3d;
+static void APIENTRY wrap_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    if (gl_capture_on) {
+        gl_capture_call(400);
+        gl_capture_f64(red);
+        gl_capture_f64(green);
+        gl_capture_f64(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3d(red, green, blue);
+    record(400, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3DVPROC real_glSecondaryColor3dv;
+static void APIENTRY wrap_glSecondaryColor3dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(401);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3dv(v);
+    record(401, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3FPROC real_glSecondaryColor3f;
+static void APIENTRY wrap_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    if (gl_capture_on) {
+        gl_capture_call(402);
+        gl_capture_f32(red);
+        gl_capture_f32(green);
+        gl_capture_f32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3f(red, green, blue);
+    record(402, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3FVPROC real_glSecondaryColor3fv;
+static void APIENTRY wrap_glSecondaryColor3fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(403);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3fv(v);
+    record(403, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3IPROC real_glSecondaryColor3i;
+static void APIENTRY wrap_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+    if (gl_capture_on) {
+        gl_capture_call(404);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3i(red, green, blue);
+    record(404, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3IVPROC real_glSecondaryColor3iv;
+static void APIENTRY wrap_glSecondaryColor3iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(405);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3iv(v);
+    record(405, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3SPROC real_glSecondaryColor3s;
+static void APIENTRY wrap_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+    if (gl_capture_on) {
+        gl_capture_call(406);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3s(red, green, blue);
+    record(406, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3SVPROC real_glSecondaryColor3sv;
+static void APIENTRY wrap_glSecondaryColor3sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(407);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3sv(v);
+    record(407, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3UBPROC real_glSecondaryColor3ub;
+static void APIENTRY wrap_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    if (gl_capture_on) {
+        gl_capture_call(408);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3ub(red, green, blue);
+    record(408, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3UBVPROC real_glSecondaryColor3ubv;
+static void APIENTRY wrap_glSecondaryColor3ubv(const GLubyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(409);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3ubv(v);
+    record(409, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3UIPROC real_glSecondaryColor3ui;
+static void APIENTRY wrap_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+    if (gl_capture_on) {
+        gl_capture_call(410);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3ui(red, green, blue);
+    record(410, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3UIVPROC real_glSecondaryColor3uiv;
+static void APIENTRY wrap_glSecondaryColor3uiv(const GLuint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(411);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3uiv(v);
+    record(411, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3USPROC real_glSecondaryColor3us;
+static void APIENTRY wrap_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+    if (gl_capture_on) {
+        gl_capture_call(412);
+        gl_capture_u32(red);
+        gl_capture_u32(green);
+        gl_capture_u32(blue);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3us(red, green, blue);
+    record(412, intercept_start);
+}
+
+static PFNGLSECONDARYCOLOR3USVPROC real_glSecondaryColor3usv;
+static void APIENTRY wrap_glSecondaryColor3usv(const GLushort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(413);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColor3usv(v);
+    record(413, intercept_start);
+}
+
+static PFNGLSECONDARYCOLORPOINTERPROC real_glSecondaryColorPointer;
+static void APIENTRY wrap_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(414);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColorPointer(size, type, stride, pointer);
+    record(414, intercept_start);
+}
+
+static PFNGLWINDOWPOS2DPROC real_glWindowPos2d;
+static void APIENTRY wrap_glWindowPos2d(GLdouble x, GLdouble y) {
+    if (gl_capture_on) {
+        gl_capture_call(415);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos2d(x, y);
+    record(415, intercept_start);
+}
+
+static PFNGLWINDOWPOS2DVPROC real_glWindowPos2dv;
+static void APIENTRY wrap_glWindowPos2dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(416);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos2dv(v);
+    record(416, intercept_start);
+}
+
+static PFNGLWINDOWPOS2FPROC real_glWindowPos2f;
+static void APIENTRY wrap_glWindowPos2f(GLfloat x, GLfloat y) {
+    if (gl_capture_on) {
+        gl_capture_call(417);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos2f(x, y);
+    record(417, intercept_start);
+}
+
+static PFNGLWINDOWPOS2FVPROC real_glWindowPos2fv;
+static void APIENTRY wrap_glWindowPos2fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(418);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos2fv(v);
+    record(418, intercept_start);
+}
+
+static PFNGLWINDOWPOS2IPROC real_glWindowPos2i;
+static void APIENTRY wrap_glWindowPos2i(GLint x, GLint y) {
+    if (gl_capture_on) {
+        gl_capture_call(419);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos2i(x, y);
+    record(419, intercept_start);
+}
+
+static PFNGLWINDOWPOS2IVPROC real_glWindowPos2iv;
+static void APIENTRY wrap_glWindowPos2iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(420);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos2iv(v);
+    record(420, intercept_start);
+}
+
+static PFNGLWINDOWPOS2SPROC real_glWindowPos2s;
+static void APIENTRY wrap_glWindowPos2s(GLshort x, GLshort y) {
+    if (gl_capture_on) {
+        gl_capture_call(421);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos2s(x, y);
+    record(421, intercept_start);
+}
+
+static PFNGLWINDOWPOS2SVPROC real_glWindowPos2sv;
+static void APIENTRY wrap_glWindowPos2sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(422);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos2sv(v);
+    record(422, intercept_start);
+}
+
+static PFNGLWINDOWPOS3DPROC real_glWindowPos3d;
+static void APIENTRY wrap_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    if (gl_capture_on) {
+        gl_capture_call(423);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos3d(x, y, z);
+    record(423, intercept_start);
+}
+
+static PFNGLWINDOWPOS3DVPROC real_glWindowPos3dv;
+static void APIENTRY wrap_glWindowPos3dv(const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(424);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos3dv(v);
+    record(424, intercept_start);
+}
+
+static PFNGLWINDOWPOS3FPROC real_glWindowPos3f;
+static void APIENTRY wrap_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    if (gl_capture_on) {
+        gl_capture_call(425);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos3f(x, y, z);
+    record(425, intercept_start);
+}
+
+static PFNGLWINDOWPOS3FVPROC real_glWindowPos3fv;
+static void APIENTRY wrap_glWindowPos3fv(const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(426);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos3fv(v);
+    record(426, intercept_start);
+}
+
+static PFNGLWINDOWPOS3IPROC real_glWindowPos3i;
+static void APIENTRY wrap_glWindowPos3i(GLint x, GLint y, GLint z) {
+    if (gl_capture_on) {
+        gl_capture_call(427);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos3i(x, y, z);
+    record(427, intercept_start);
+}
+
+static PFNGLWINDOWPOS3IVPROC real_glWindowPos3iv;
+static void APIENTRY wrap_glWindowPos3iv(const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(428);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos3iv(v);
+    record(428, intercept_start);
+}
+
+static PFNGLWINDOWPOS3SPROC real_glWindowPos3s;
+static void APIENTRY wrap_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+    if (gl_capture_on) {
+        gl_capture_call(429);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos3s(x, y, z);
+    record(429, intercept_start);
+}
+
+static PFNGLWINDOWPOS3SVPROC real_glWindowPos3sv;
+static void APIENTRY wrap_glWindowPos3sv(const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(430);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWindowPos3sv(v);
+    record(430, intercept_start);
+}
+
+static PFNGLBLENDCOLORPROC real_glBlendColor;
+static void APIENTRY wrap_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    if (gl_capture_on) {
+        gl_capture_call(431);
+        gl_capture_f32(red);
+        gl_capture_f32(green);
+        gl_capture_f32(blue);
+        gl_capture_f32(alpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlendColor(red, green, blue, alpha);
+    record(431, intercept_start);
+}
+
+static PFNGLBLENDEQUATIONPROC real_glBlendEquation;
+static void APIENTRY wrap_glBlendEquation(GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(432);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlendEquation(mode);
+    record(432, intercept_start);
+}
+
+static PFNGLGENQUERIESPROC real_glGenQueries;
+static void APIENTRY wrap_glGenQueries(GLsizei n, GLuint *ids) {
+    if (gl_capture_on) {
+        gl_capture_call(433);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenQueries(n, ids);
+    record(433, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(ids[i]);
+        }
+    }
+}
+
+static PFNGLDELETEQUERIESPROC real_glDeleteQueries;
+static void APIENTRY wrap_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    if (gl_capture_on) {
+        gl_capture_call(434);
+        gl_capture_u32(n);
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(ids[i]);
+        }
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteQueries(n, ids);
+    record(434, intercept_start);
+}
+
+static PFNGLISQUERYPROC real_glIsQuery;
+static GLboolean APIENTRY wrap_glIsQuery(GLuint id) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsQuery(id);
+    record(435, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLBEGINQUERYPROC real_glBeginQuery;
+static void APIENTRY wrap_glBeginQuery(GLenum target, GLuint id) {
+    if (gl_capture_on) {
+        gl_capture_call(436);
+        gl_capture_u32(target);
+        gl_capture_u32(id);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBeginQuery(target, id);
+    record(436, intercept_start);
+}
+
+static PFNGLENDQUERYPROC real_glEndQuery;
+static void APIENTRY wrap_glEndQuery(GLenum target) {
+    if (gl_capture_on) {
+        gl_capture_call(437);
+        gl_capture_u32(target);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEndQuery(target);
+    record(437, intercept_start);
+}
+
+static PFNGLGETQUERYIVPROC real_glGetQueryiv;
+static void APIENTRY wrap_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetQueryiv(target, pname, params);
+    record(438, intercept_start);
+}
+
+static PFNGLGETQUERYOBJECTIVPROC real_glGetQueryObjectiv;
+static void APIENTRY wrap_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetQueryObjectiv(id, pname, params);
+    record(439, intercept_start);
+}
+
+static PFNGLGETQUERYOBJECTUIVPROC real_glGetQueryObjectuiv;
+static void APIENTRY wrap_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetQueryObjectuiv(id, pname, params);
+    record(440, intercept_start);
+}
+
+static PFNGLBINDBUFFERPROC real_glBindBuffer;
+static void APIENTRY wrap_glBindBuffer(GLenum target, GLuint buffer) {
+    if (gl_capture_on) {
+        gl_capture_call(441);
+        gl_capture_u32(target);
+        gl_capture_u32(buffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindBuffer(target, buffer);
+    record(441, intercept_start);
+}
+
+static PFNGLDELETEBUFFERSPROC real_glDeleteBuffers;
+static void APIENTRY wrap_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    if (gl_capture_on) {
+        gl_capture_call(442);
+        gl_capture_u32(n);
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(buffers[i]);
+        }
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteBuffers(n, buffers);
+    record(442, intercept_start);
+}
+
+static PFNGLGENBUFFERSPROC real_glGenBuffers;
+static void APIENTRY wrap_glGenBuffers(GLsizei n, GLuint *buffers) {
+    if (gl_capture_on) {
+        gl_capture_call(443);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenBuffers(n, buffers);
+    record(443, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(buffers[i]);
+        }
+    }
+}
+
+static PFNGLISBUFFERPROC real_glIsBuffer;
+static GLboolean APIENTRY wrap_glIsBuffer(GLuint buffer) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsBuffer(buffer);
+    record(444, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLBUFFERDATAPROC real_glBufferData;
+static void APIENTRY wrap_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    if (gl_capture_on) {
+        gl_capture_call(445);
+        gl_capture_u32(target);
+        gl_capture_u64(size);
+        gl_capture_bytes(data, (uint64_t)size);
+        gl_capture_u32(usage);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBufferData(target, size, data, usage);
+    record(445, intercept_start);
+}
+
+static PFNGLBUFFERSUBDATAPROC real_glBufferSubData;
+static void APIENTRY wrap_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_call(446);
+        gl_capture_u32(target);
+        gl_capture_u64(offset);
+        gl_capture_u64(size);
+        gl_capture_bytes(data, (uint64_t)size);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBufferSubData(target, offset, size, data);
+    record(446, intercept_start);
+}
+
+static PFNGLGETBUFFERSUBDATAPROC real_glGetBufferSubData;
+static void APIENTRY wrap_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetBufferSubData(target, offset, size, data);
+    record(447, intercept_start);
+}
+
+static PFNGLMAPBUFFERPROC real_glMapBuffer;
+static void * APIENTRY wrap_glMapBuffer(GLenum target, GLenum access) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(448);
+    }
+    uint64_t intercept_start = now_ns();
+    void * intercept_result = real_glMapBuffer(target, access);
+    record(448, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLUNMAPBUFFERPROC real_glUnmapBuffer;
+static GLboolean APIENTRY wrap_glUnmapBuffer(GLenum target) {
+    if (gl_capture_on) {
+        gl_capture_call(449);
+        gl_capture_u32(target);
+        gl_capture_mapped_contents(target, 0, 0, 0);
+    }
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glUnmapBuffer(target);
+    record(449, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETBUFFERPARAMETERIVPROC real_glGetBufferParameteriv;
+static void APIENTRY wrap_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetBufferParameteriv(target, pname, params);
+    record(450, intercept_start);
+}
+
+static PFNGLGETBUFFERPOINTERVPROC real_glGetBufferPointerv;
+static void APIENTRY wrap_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetBufferPointerv(target, pname, params);
+    record(451, intercept_start);
+}
+
+static PFNGLBLENDEQUATIONSEPARATEPROC real_glBlendEquationSeparate;
+static void APIENTRY wrap_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    if (gl_capture_on) {
+        gl_capture_call(452);
+        gl_capture_u32(modeRGB);
+        gl_capture_u32(modeAlpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlendEquationSeparate(modeRGB, modeAlpha);
+    record(452, intercept_start);
+}
+
+static PFNGLDRAWBUFFERSPROC real_glDrawBuffers;
+static void APIENTRY wrap_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    if (gl_capture_on) {
+        gl_capture_call(453);
+        gl_capture_u32(n);
+        gl_capture_bytes(bufs, (uint64_t)n * sizeof(GLenum));
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawBuffers(n, bufs);
+    record(453, intercept_start);
+}
+
+static PFNGLSTENCILOPSEPARATEPROC real_glStencilOpSeparate;
+static void APIENTRY wrap_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    if (gl_capture_on) {
+        gl_capture_call(454);
+        gl_capture_u32(face);
+        gl_capture_u32(sfail);
+        gl_capture_u32(dpfail);
+        gl_capture_u32(dppass);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glStencilOpSeparate(face, sfail, dpfail, dppass);
+    record(454, intercept_start);
+}
+
+static PFNGLSTENCILFUNCSEPARATEPROC real_glStencilFuncSeparate;
+static void APIENTRY wrap_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    if (gl_capture_on) {
+        gl_capture_call(455);
+        gl_capture_u32(face);
+        gl_capture_u32(func);
+        gl_capture_u32(ref);
+        gl_capture_u32(mask);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glStencilFuncSeparate(face, func, ref, mask);
+    record(455, intercept_start);
+}
+
+static PFNGLSTENCILMASKSEPARATEPROC real_glStencilMaskSeparate;
+static void APIENTRY wrap_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    if (gl_capture_on) {
+        gl_capture_call(456);
+        gl_capture_u32(face);
+        gl_capture_u32(mask);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glStencilMaskSeparate(face, mask);
+    record(456, intercept_start);
+}
+
+static PFNGLATTACHSHADERPROC real_glAttachShader;
+static void APIENTRY wrap_glAttachShader(GLuint program, GLuint shader) {
+    if (gl_capture_on) {
+        gl_capture_call(457);
+        gl_capture_u32(program);
+        gl_capture_u32(shader);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glAttachShader(program, shader);
+    record(457, intercept_start);
+}
+
+static PFNGLBINDATTRIBLOCATIONPROC real_glBindAttribLocation;
+static void APIENTRY wrap_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    if (gl_capture_on) {
+        gl_capture_call(458);
+        gl_capture_u32(program);
+        gl_capture_u32(index);
+        gl_capture_string(name, -1);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindAttribLocation(program, index, name);
+    record(458, intercept_start);
+}
+
+static PFNGLCOMPILESHADERPROC real_glCompileShader;
+static void APIENTRY wrap_glCompileShader(GLuint shader) {
+    if (gl_capture_on) {
+        gl_capture_call(459);
+        gl_capture_u32(shader);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCompileShader(shader);
+    record(459, intercept_start);
+}
+
+static PFNGLCREATEPROGRAMPROC real_glCreateProgram;
+static GLuint APIENTRY wrap_glCreateProgram(void) {
+    if (gl_capture_on) {
+        gl_capture_call(460);
+    }
+    uint64_t intercept_start = now_ns();
+    GLuint intercept_result = real_glCreateProgram();
+    record(460, intercept_start);
+    if (gl_capture_on) {
+        gl_capture_u32(intercept_result);
+    }
+    return intercept_result;
+}
+
+static PFNGLCREATESHADERPROC real_glCreateShader;
+static GLuint APIENTRY wrap_glCreateShader(GLenum type) {
+    if (gl_capture_on) {
+        gl_capture_call(461);
+        gl_capture_u32(type);
+    }
+    uint64_t intercept_start = now_ns();
+    GLuint intercept_result = real_glCreateShader(type);
+    record(461, intercept_start);
+    if (gl_capture_on) {
+        gl_capture_u32(intercept_result);
+    }
+    return intercept_result;
+}
+
+static PFNGLDELETEPROGRAMPROC real_glDeleteProgram;
+static void APIENTRY wrap_glDeleteProgram(GLuint program) {
+    if (gl_capture_on) {
+        gl_capture_call(462);
+        gl_capture_u32(program);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteProgram(program);
+    record(462, intercept_start);
+}
+
+static PFNGLDELETESHADERPROC real_glDeleteShader;
+static void APIENTRY wrap_glDeleteShader(GLuint shader) {
+    if (gl_capture_on) {
+        gl_capture_call(463);
+        gl_capture_u32(shader);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteShader(shader);
+    record(463, intercept_start);
+}
+
+static PFNGLDETACHSHADERPROC real_glDetachShader;
+static void APIENTRY wrap_glDetachShader(GLuint program, GLuint shader) {
+    if (gl_capture_on) {
+        gl_capture_call(464);
+        gl_capture_u32(program);
+        gl_capture_u32(shader);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDetachShader(program, shader);
+    record(464, intercept_start);
+}
+
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC real_glDisableVertexAttribArray;
+static void APIENTRY wrap_glDisableVertexAttribArray(GLuint index) {
+    if (gl_capture_on) {
+        gl_capture_call(465);
+        gl_capture_u32(index);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDisableVertexAttribArray(index);
+    record(465, intercept_start);
+}
+
+static PFNGLENABLEVERTEXATTRIBARRAYPROC real_glEnableVertexAttribArray;
+static void APIENTRY wrap_glEnableVertexAttribArray(GLuint index) {
+    if (gl_capture_on) {
+        gl_capture_call(466);
+        gl_capture_u32(index);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEnableVertexAttribArray(index);
+    record(466, intercept_start);
+}
+
+static PFNGLGETACTIVEATTRIBPROC real_glGetActiveAttrib;
+static void APIENTRY wrap_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    real_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+    record(467, intercept_start);
+}
+
+static PFNGLGETACTIVEUNIFORMPROC real_glGetActiveUniform;
+static void APIENTRY wrap_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    real_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+    record(468, intercept_start);
+}
+
+static PFNGLGETATTACHEDSHADERSPROC real_glGetAttachedShaders;
+static void APIENTRY wrap_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    uint64_t intercept_start = now_ns();
+    real_glGetAttachedShaders(program, maxCount, count, shaders);
+    record(469, intercept_start);
+}
+
+static PFNGLGETATTRIBLOCATIONPROC real_glGetAttribLocation;
+static GLint APIENTRY wrap_glGetAttribLocation(GLuint program, const GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    GLint intercept_result = real_glGetAttribLocation(program, name);
+    record(470, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETPROGRAMIVPROC real_glGetProgramiv;
+static void APIENTRY wrap_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetProgramiv(program, pname, params);
+    record(471, intercept_start);
+}
+
+static PFNGLGETPROGRAMINFOLOGPROC real_glGetProgramInfoLog;
+static void APIENTRY wrap_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    uint64_t intercept_start = now_ns();
+    real_glGetProgramInfoLog(program, bufSize, length, infoLog);
+    record(472, intercept_start);
+}
+
+static PFNGLGETSHADERIVPROC real_glGetShaderiv;
+static void APIENTRY wrap_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetShaderiv(shader, pname, params);
+    record(473, intercept_start);
+}
+
+static PFNGLGETSHADERINFOLOGPROC real_glGetShaderInfoLog;
+static void APIENTRY wrap_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    uint64_t intercept_start = now_ns();
+    real_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+    record(474, intercept_start);
+}
+
+static PFNGLGETSHADERSOURCEPROC real_glGetShaderSource;
+static void APIENTRY wrap_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    uint64_t intercept_start = now_ns();
+    real_glGetShaderSource(shader, bufSize, length, source);
+    record(475, intercept_start);
+}
+
+static PFNGLGETUNIFORMLOCATIONPROC real_glGetUniformLocation;
+static GLint APIENTRY wrap_glGetUniformLocation(GLuint program, const GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    GLint intercept_result = real_glGetUniformLocation(program, name);
+    record(476, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETUNIFORMFVPROC real_glGetUniformfv;
+static void APIENTRY wrap_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetUniformfv(program, location, params);
+    record(477, intercept_start);
+}
+
+static PFNGLGETUNIFORMIVPROC real_glGetUniformiv;
+static void APIENTRY wrap_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetUniformiv(program, location, params);
+    record(478, intercept_start);
+}
+
+static PFNGLGETVERTEXATTRIBDVPROC real_glGetVertexAttribdv;
+static void APIENTRY wrap_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetVertexAttribdv(index, pname, params);
+    record(479, intercept_start);
+}
+
+static PFNGLGETVERTEXATTRIBFVPROC real_glGetVertexAttribfv;
+static void APIENTRY wrap_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetVertexAttribfv(index, pname, params);
+    record(480, intercept_start);
+}
+
+static PFNGLGETVERTEXATTRIBIVPROC real_glGetVertexAttribiv;
+static void APIENTRY wrap_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetVertexAttribiv(index, pname, params);
+    record(481, intercept_start);
+}
+
+static PFNGLGETVERTEXATTRIBPOINTERVPROC real_glGetVertexAttribPointerv;
+static void APIENTRY wrap_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    uint64_t intercept_start = now_ns();
+    real_glGetVertexAttribPointerv(index, pname, pointer);
+    record(482, intercept_start);
+}
+
+static PFNGLISPROGRAMPROC real_glIsProgram;
+static GLboolean APIENTRY wrap_glIsProgram(GLuint program) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsProgram(program);
+    record(483, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLISSHADERPROC real_glIsShader;
+static GLboolean APIENTRY wrap_glIsShader(GLuint shader) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsShader(shader);
+    record(484, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLLINKPROGRAMPROC real_glLinkProgram;
+static void APIENTRY wrap_glLinkProgram(GLuint program) {
+    if (gl_capture_on) {
+        gl_capture_call(485);
+        gl_capture_u32(program);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glLinkProgram(program);
+    record(485, intercept_start);
+}
+
+static PFNGLSHADERSOURCEPROC real_glShaderSource;
+static void APIENTRY wrap_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    if (gl_capture_on) {
+        gl_capture_call(486);
+        gl_capture_u32(shader);
+        gl_capture_u32(count);
+        gl_capture_strings(count, string, length);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glShaderSource(shader, count, string, length);
+    record(486, intercept_start);
+}
+
+static PFNGLUSEPROGRAMPROC real_glUseProgram;
+static void APIENTRY wrap_glUseProgram(GLuint program) {
+    if (gl_capture_on) {
+        gl_capture_call(487);
+        gl_capture_u32(program);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUseProgram(program);
+    record(487, intercept_start);
+}
+
+static PFNGLUNIFORM1FPROC real_glUniform1f;
+static void APIENTRY wrap_glUniform1f(GLint location, GLfloat v0) {
+    if (gl_capture_on) {
+        gl_capture_call(488);
+        gl_capture_u32(location);
+        gl_capture_f32(v0);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform1f(location, v0);
+    record(488, intercept_start);
+}
+
+static PFNGLUNIFORM2FPROC real_glUniform2f;
+static void APIENTRY wrap_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    if (gl_capture_on) {
+        gl_capture_call(489);
+        gl_capture_u32(location);
+        gl_capture_f32(v0);
+        gl_capture_f32(v1);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform2f(location, v0, v1);
+    record(489, intercept_start);
+}
+
+static PFNGLUNIFORM3FPROC real_glUniform3f;
+static void APIENTRY wrap_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    if (gl_capture_on) {
+        gl_capture_call(490);
+        gl_capture_u32(location);
+        gl_capture_f32(v0);
+        gl_capture_f32(v1);
+        gl_capture_f32(v2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform3f(location, v0, v1, v2);
+    record(490, intercept_start);
+}
+
+static PFNGLUNIFORM4FPROC real_glUniform4f;
+static void APIENTRY wrap_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    if (gl_capture_on) {
+        gl_capture_call(491);
+        gl_capture_u32(location);
+        gl_capture_f32(v0);
+        gl_capture_f32(v1);
+        gl_capture_f32(v2);
+        gl_capture_f32(v3);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform4f(location, v0, v1, v2, v3);
+    record(491, intercept_start);
+}
+
+static PFNGLUNIFORM1IPROC real_glUniform1i;
+static void APIENTRY wrap_glUniform1i(GLint location, GLint v0) {
+    if (gl_capture_on) {
+        gl_capture_call(492);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform1i(location, v0);
+    record(492, intercept_start);
+}
+
+static PFNGLUNIFORM2IPROC real_glUniform2i;
+static void APIENTRY wrap_glUniform2i(GLint location, GLint v0, GLint v1) {
+    if (gl_capture_on) {
+        gl_capture_call(493);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform2i(location, v0, v1);
+    record(493, intercept_start);
+}
+
+static PFNGLUNIFORM3IPROC real_glUniform3i;
+static void APIENTRY wrap_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    if (gl_capture_on) {
+        gl_capture_call(494);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+        gl_capture_u32(v2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform3i(location, v0, v1, v2);
+    record(494, intercept_start);
+}
+
+static PFNGLUNIFORM4IPROC real_glUniform4i;
+static void APIENTRY wrap_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    if (gl_capture_on) {
+        gl_capture_call(495);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+        gl_capture_u32(v2);
+        gl_capture_u32(v3);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform4i(location, v0, v1, v2, v3);
+    record(495, intercept_start);
+}
+
+static PFNGLUNIFORM1FVPROC real_glUniform1fv;
+static void APIENTRY wrap_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(496);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 4);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform1fv(location, count, value);
+    record(496, intercept_start);
+}
+
+static PFNGLUNIFORM2FVPROC real_glUniform2fv;
+static void APIENTRY wrap_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(497);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 8);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform2fv(location, count, value);
+    record(497, intercept_start);
+}
+
+static PFNGLUNIFORM3FVPROC real_glUniform3fv;
+static void APIENTRY wrap_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(498);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 12);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform3fv(location, count, value);
+    record(498, intercept_start);
+}
+
+static PFNGLUNIFORM4FVPROC real_glUniform4fv;
+static void APIENTRY wrap_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(499);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 16);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform4fv(location, count, value);
+    record(499, intercept_start);
+}
+
+static PFNGLUNIFORM1IVPROC real_glUniform1iv;
+static void APIENTRY wrap_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(500);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 4);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform1iv(location, count, value);
+    record(500, intercept_start);
+}
+
+static PFNGLUNIFORM2IVPROC real_glUniform2iv;
+static void APIENTRY wrap_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(501);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 8);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform2iv(location, count, value);
+    record(501, intercept_start);
+}
+
+static PFNGLUNIFORM3IVPROC real_glUniform3iv;
+static void APIENTRY wrap_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(502);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 12);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform3iv(location, count, value);
+    record(502, intercept_start);
+}
+
+static PFNGLUNIFORM4IVPROC real_glUniform4iv;
+static void APIENTRY wrap_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(503);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 16);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform4iv(location, count, value);
+    record(503, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX2FVPROC real_glUniformMatrix2fv;
+static void APIENTRY wrap_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(504);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 16);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix2fv(location, count, transpose, value);
+    record(504, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX3FVPROC real_glUniformMatrix3fv;
+static void APIENTRY wrap_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(505);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 36);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix3fv(location, count, transpose, value);
+    record(505, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX4FVPROC real_glUniformMatrix4fv;
+static void APIENTRY wrap_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(506);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 64);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix4fv(location, count, transpose, value);
+    record(506, intercept_start);
+}
+
+static PFNGLVALIDATEPROGRAMPROC real_glValidateProgram;
+static void APIENTRY wrap_glValidateProgram(GLuint program) {
+    if (gl_capture_on) {
+        gl_capture_call(507);
+        gl_capture_u32(program);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glValidateProgram(program);
+    record(507, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB1DPROC real_glVertexAttrib1d;
+static void APIENTRY wrap_glVertexAttrib1d(GLuint index, GLdouble x) {
+    if (gl_capture_on) {
+        gl_capture_call(508);
+        gl_capture_u32(index);
+        gl_capture_f64(x);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib1d(index, x);
+    record(508, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB1DVPROC real_glVertexAttrib1dv;
+static void APIENTRY wrap_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(509);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib1dv(index, v);
+    record(509, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB1FPROC real_glVertexAttrib1f;
+static void APIENTRY wrap_glVertexAttrib1f(GLuint index, GLfloat x) {
+    if (gl_capture_on) {
+        gl_capture_call(510);
+        gl_capture_u32(index);
+        gl_capture_f32(x);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib1f(index, x);
+    record(510, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB1FVPROC real_glVertexAttrib1fv;
+static void APIENTRY wrap_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(511);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib1fv(index, v);
+    record(511, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB1SPROC real_glVertexAttrib1s;
+static void APIENTRY wrap_glVertexAttrib1s(GLuint index, GLshort x) {
+    if (gl_capture_on) {
+        gl_capture_call(512);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib1s(index, x);
+    record(512, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB1SVPROC real_glVertexAttrib1sv;
+static void APIENTRY wrap_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(513);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib1sv(index, v);
+    record(513, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB2DPROC real_glVertexAttrib2d;
+static void APIENTRY wrap_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    if (gl_capture_on) {
+        gl_capture_call(514);
+        gl_capture_u32(index);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib2d(index, x, y);
+    record(514, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB2DVPROC real_glVertexAttrib2dv;
+static void APIENTRY wrap_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(515);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib2dv(index, v);
+    record(515, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB2FPROC real_glVertexAttrib2f;
+static void APIENTRY wrap_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    if (gl_capture_on) {
+        gl_capture_call(516);
+        gl_capture_u32(index);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib2f(index, x, y);
+    record(516, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB2FVPROC real_glVertexAttrib2fv;
+static void APIENTRY wrap_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(517);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib2fv(index, v);
+    record(517, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB2SPROC real_glVertexAttrib2s;
+static void APIENTRY wrap_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    if (gl_capture_on) {
+        gl_capture_call(518);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib2s(index, x, y);
+    record(518, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB2SVPROC real_glVertexAttrib2sv;
+static void APIENTRY wrap_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(519);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib2sv(index, v);
+    record(519, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB3DPROC real_glVertexAttrib3d;
+static void APIENTRY wrap_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    if (gl_capture_on) {
+        gl_capture_call(520);
+        gl_capture_u32(index);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib3d(index, x, y, z);
+    record(520, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB3DVPROC real_glVertexAttrib3dv;
+static void APIENTRY wrap_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(521);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib3dv(index, v);
+    record(521, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB3FPROC real_glVertexAttrib3f;
+static void APIENTRY wrap_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    if (gl_capture_on) {
+        gl_capture_call(522);
+        gl_capture_u32(index);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib3f(index, x, y, z);
+    record(522, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB3FVPROC real_glVertexAttrib3fv;
+static void APIENTRY wrap_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(523);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib3fv(index, v);
+    record(523, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB3SPROC real_glVertexAttrib3s;
+static void APIENTRY wrap_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    if (gl_capture_on) {
+        gl_capture_call(524);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib3s(index, x, y, z);
+    record(524, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB3SVPROC real_glVertexAttrib3sv;
+static void APIENTRY wrap_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(525);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib3sv(index, v);
+    record(525, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4NBVPROC real_glVertexAttrib4Nbv;
+static void APIENTRY wrap_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(526);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4Nbv(index, v);
+    record(526, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4NIVPROC real_glVertexAttrib4Niv;
+static void APIENTRY wrap_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(527);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4Niv(index, v);
+    record(527, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4NSVPROC real_glVertexAttrib4Nsv;
+static void APIENTRY wrap_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(528);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4Nsv(index, v);
+    record(528, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4NUBPROC real_glVertexAttrib4Nub;
+static void APIENTRY wrap_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    if (gl_capture_on) {
+        gl_capture_call(529);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+        gl_capture_u32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4Nub(index, x, y, z, w);
+    record(529, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4NUBVPROC real_glVertexAttrib4Nubv;
+static void APIENTRY wrap_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(530);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4Nubv(index, v);
+    record(530, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4NUIVPROC real_glVertexAttrib4Nuiv;
+static void APIENTRY wrap_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(531);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4Nuiv(index, v);
+    record(531, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4NUSVPROC real_glVertexAttrib4Nusv;
+static void APIENTRY wrap_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(532);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4Nusv(index, v);
+    record(532, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4BVPROC real_glVertexAttrib4bv;
+static void APIENTRY wrap_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(533);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4bv(index, v);
+    record(533, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4DPROC real_glVertexAttrib4d;
+static void APIENTRY wrap_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if (gl_capture_on) {
+        gl_capture_call(534);
+        gl_capture_u32(index);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+        gl_capture_f64(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4d(index, x, y, z, w);
+    record(534, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4DVPROC real_glVertexAttrib4dv;
+static void APIENTRY wrap_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(535);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4dv(index, v);
+    record(535, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4FPROC real_glVertexAttrib4f;
+static void APIENTRY wrap_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    if (gl_capture_on) {
+        gl_capture_call(536);
+        gl_capture_u32(index);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(z);
+        gl_capture_f32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4f(index, x, y, z, w);
+    record(536, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4FVPROC real_glVertexAttrib4fv;
+static void APIENTRY wrap_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(537);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4fv(index, v);
+    record(537, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4IVPROC real_glVertexAttrib4iv;
+static void APIENTRY wrap_glVertexAttrib4iv(GLuint index, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(538);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4iv(index, v);
+    record(538, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4SPROC real_glVertexAttrib4s;
+static void APIENTRY wrap_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    if (gl_capture_on) {
+        gl_capture_call(539);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+        gl_capture_u32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4s(index, x, y, z, w);
+    record(539, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4SVPROC real_glVertexAttrib4sv;
+static void APIENTRY wrap_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(540);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4sv(index, v);
+    record(540, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4UBVPROC real_glVertexAttrib4ubv;
+static void APIENTRY wrap_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(541);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4ubv(index, v);
+    record(541, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4UIVPROC real_glVertexAttrib4uiv;
+static void APIENTRY wrap_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(542);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4uiv(index, v);
+    record(542, intercept_start);
+}
+
+static PFNGLVERTEXATTRIB4USVPROC real_glVertexAttrib4usv;
+static void APIENTRY wrap_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(543);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttrib4usv(index, v);
+    record(543, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBPOINTERPROC real_glVertexAttribPointer;
+static void APIENTRY wrap_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_call(544);
+        gl_capture_u32(index);
+        gl_capture_u32(size);
+        gl_capture_u32(type);
+        gl_capture_u32(normalized);
+        gl_capture_u32(stride);
+        gl_capture_u64((uint64_t)(uintptr_t)pointer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    record(544, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX2X3FVPROC real_glUniformMatrix2x3fv;
+static void APIENTRY wrap_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(545);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 24);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix2x3fv(location, count, transpose, value);
+    record(545, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX3X2FVPROC real_glUniformMatrix3x2fv;
+static void APIENTRY wrap_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(546);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 24);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix3x2fv(location, count, transpose, value);
+    record(546, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX2X4FVPROC real_glUniformMatrix2x4fv;
+static void APIENTRY wrap_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(547);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 32);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix2x4fv(location, count, transpose, value);
+    record(547, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX4X2FVPROC real_glUniformMatrix4x2fv;
+static void APIENTRY wrap_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(548);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 32);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix4x2fv(location, count, transpose, value);
+    record(548, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX3X4FVPROC real_glUniformMatrix3x4fv;
+static void APIENTRY wrap_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(549);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 48);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix3x4fv(location, count, transpose, value);
+    record(549, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX4X3FVPROC real_glUniformMatrix4x3fv;
+static void APIENTRY wrap_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(550);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 48);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix4x3fv(location, count, transpose, value);
+    record(550, intercept_start);
+}
+
+static PFNGLCOLORMASKIPROC real_glColorMaski;
+static void APIENTRY wrap_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    if (gl_capture_on) {
+        gl_capture_call(551);
+        gl_capture_u32(index);
+        gl_capture_u32(r);
+        gl_capture_u32(g);
+        gl_capture_u32(b);
+        gl_capture_u32(a);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColorMaski(index, r, g, b, a);
+    record(551, intercept_start);
+}
+
+static PFNGLGETBOOLEANI_VPROC real_glGetBooleani_v;
+static void APIENTRY wrap_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetBooleani_v(target, index, data);
+    record(552, intercept_start);
+}
+
+static PFNGLGETINTEGERI_VPROC real_glGetIntegeri_v;
+static void APIENTRY wrap_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetIntegeri_v(target, index, data);
+    record(553, intercept_start);
+}
+
+static PFNGLENABLEIPROC real_glEnablei;
+static void APIENTRY wrap_glEnablei(GLenum target, GLuint index) {
+    if (gl_capture_on) {
+        gl_capture_call(554);
+        gl_capture_u32(target);
+        gl_capture_u32(index);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEnablei(target, index);
+    record(554, intercept_start);
+}
+
+static PFNGLDISABLEIPROC real_glDisablei;
+static void APIENTRY wrap_glDisablei(GLenum target, GLuint index) {
+    if (gl_capture_on) {
+        gl_capture_call(555);
+        gl_capture_u32(target);
+        gl_capture_u32(index);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDisablei(target, index);
+    record(555, intercept_start);
+}
+
+static PFNGLISENABLEDIPROC real_glIsEnabledi;
+static GLboolean APIENTRY wrap_glIsEnabledi(GLenum target, GLuint index) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsEnabledi(target, index);
+    record(556, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLBEGINTRANSFORMFEEDBACKPROC real_glBeginTransformFeedback;
+static void APIENTRY wrap_glBeginTransformFeedback(GLenum primitiveMode) {
+    if (gl_capture_on) {
+        gl_capture_call(557);
+        gl_capture_u32(primitiveMode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBeginTransformFeedback(primitiveMode);
+    record(557, intercept_start);
+}
+
+static PFNGLENDTRANSFORMFEEDBACKPROC real_glEndTransformFeedback;
+static void APIENTRY wrap_glEndTransformFeedback(void) {
+    if (gl_capture_on) {
+        gl_capture_call(558);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEndTransformFeedback();
+    record(558, intercept_start);
+}
+
+static PFNGLBINDBUFFERRANGEPROC real_glBindBufferRange;
+static void APIENTRY wrap_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (gl_capture_on) {
+        gl_capture_call(559);
+        gl_capture_u32(target);
+        gl_capture_u32(index);
+        gl_capture_u32(buffer);
+        gl_capture_u64(offset);
+        gl_capture_u64(size);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindBufferRange(target, index, buffer, offset, size);
+    record(559, intercept_start);
+}
+
+static PFNGLBINDBUFFERBASEPROC real_glBindBufferBase;
+static void APIENTRY wrap_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    if (gl_capture_on) {
+        gl_capture_call(560);
+        gl_capture_u32(target);
+        gl_capture_u32(index);
+        gl_capture_u32(buffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindBufferBase(target, index, buffer);
+    record(560, intercept_start);
+}
+
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC real_glTransformFeedbackVaryings;
+static void APIENTRY wrap_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(561);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+    record(561, intercept_start);
+}
+
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC real_glGetTransformFeedbackVarying;
+static void APIENTRY wrap_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+    record(562, intercept_start);
+}
+
+static PFNGLCLAMPCOLORPROC real_glClampColor;
+static void APIENTRY wrap_glClampColor(GLenum target, GLenum clamp) {
+    if (gl_capture_on) {
+        gl_capture_call(563);
+        gl_capture_u32(target);
+        gl_capture_u32(clamp);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClampColor(target, clamp);
+    record(563, intercept_start);
+}
+
+static PFNGLBEGINCONDITIONALRENDERPROC real_glBeginConditionalRender;
+static void APIENTRY wrap_glBeginConditionalRender(GLuint id, GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(564);
+        gl_capture_u32(id);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBeginConditionalRender(id, mode);
+    record(564, intercept_start);
+}
+
+static PFNGLENDCONDITIONALRENDERPROC real_glEndConditionalRender;
+static void APIENTRY wrap_glEndConditionalRender(void) {
+    if (gl_capture_on) {
+        gl_capture_call(565);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEndConditionalRender();
+    record(565, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBIPOINTERPROC real_glVertexAttribIPointer;
+static void APIENTRY wrap_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_call(566);
+        gl_capture_u32(index);
+        gl_capture_u32(size);
+        gl_capture_u32(type);
+        gl_capture_u32(stride);
+        gl_capture_u64((uint64_t)(uintptr_t)pointer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribIPointer(index, size, type, stride, pointer);
+    record(566, intercept_start);
+}
+
+static PFNGLGETVERTEXATTRIBIIVPROC real_glGetVertexAttribIiv;
+static void APIENTRY wrap_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetVertexAttribIiv(index, pname, params);
+    record(567, intercept_start);
+}
+
+static PFNGLGETVERTEXATTRIBIUIVPROC real_glGetVertexAttribIuiv;
+static void APIENTRY wrap_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetVertexAttribIuiv(index, pname, params);
+    record(568, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI1IPROC real_glVertexAttribI1i;
+static void APIENTRY wrap_glVertexAttribI1i(GLuint index, GLint x) {
+    if (gl_capture_on) {
+        gl_capture_call(569);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI1i(index, x);
+    record(569, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI2IPROC real_glVertexAttribI2i;
+static void APIENTRY wrap_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    if (gl_capture_on) {
+        gl_capture_call(570);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI2i(index, x, y);
+    record(570, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI3IPROC real_glVertexAttribI3i;
+static void APIENTRY wrap_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    if (gl_capture_on) {
+        gl_capture_call(571);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI3i(index, x, y, z);
+    record(571, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI4IPROC real_glVertexAttribI4i;
+static void APIENTRY wrap_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    if (gl_capture_on) {
+        gl_capture_call(572);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+        gl_capture_u32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI4i(index, x, y, z, w);
+    record(572, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI1UIPROC real_glVertexAttribI1ui;
+static void APIENTRY wrap_glVertexAttribI1ui(GLuint index, GLuint x) {
+    if (gl_capture_on) {
+        gl_capture_call(573);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI1ui(index, x);
+    record(573, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI2UIPROC real_glVertexAttribI2ui;
+static void APIENTRY wrap_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    if (gl_capture_on) {
+        gl_capture_call(574);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI2ui(index, x, y);
+    record(574, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI3UIPROC real_glVertexAttribI3ui;
+static void APIENTRY wrap_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    if (gl_capture_on) {
+        gl_capture_call(575);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI3ui(index, x, y, z);
+    record(575, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI4UIPROC real_glVertexAttribI4ui;
+static void APIENTRY wrap_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    if (gl_capture_on) {
+        gl_capture_call(576);
+        gl_capture_u32(index);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(z);
+        gl_capture_u32(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI4ui(index, x, y, z, w);
+    record(576, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI1IVPROC real_glVertexAttribI1iv;
+static void APIENTRY wrap_glVertexAttribI1iv(GLuint index, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(577);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI1iv(index, v);
+    record(577, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI2IVPROC real_glVertexAttribI2iv;
+static void APIENTRY wrap_glVertexAttribI2iv(GLuint index, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(578);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI2iv(index, v);
+    record(578, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI3IVPROC real_glVertexAttribI3iv;
+static void APIENTRY wrap_glVertexAttribI3iv(GLuint index, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(579);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI3iv(index, v);
+    record(579, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI4IVPROC real_glVertexAttribI4iv;
+static void APIENTRY wrap_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(580);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI4iv(index, v);
+    record(580, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI1UIVPROC real_glVertexAttribI1uiv;
+static void APIENTRY wrap_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(581);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI1uiv(index, v);
+    record(581, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI2UIVPROC real_glVertexAttribI2uiv;
+static void APIENTRY wrap_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(582);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI2uiv(index, v);
+    record(582, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI3UIVPROC real_glVertexAttribI3uiv;
+static void APIENTRY wrap_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(583);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI3uiv(index, v);
+    record(583, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI4UIVPROC real_glVertexAttribI4uiv;
+static void APIENTRY wrap_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(584);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI4uiv(index, v);
+    record(584, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI4BVPROC real_glVertexAttribI4bv;
+static void APIENTRY wrap_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(585);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI4bv(index, v);
+    record(585, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI4SVPROC real_glVertexAttribI4sv;
+static void APIENTRY wrap_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(586);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI4sv(index, v);
+    record(586, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI4UBVPROC real_glVertexAttribI4ubv;
+static void APIENTRY wrap_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(587);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI4ubv(index, v);
+    record(587, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBI4USVPROC real_glVertexAttribI4usv;
+static void APIENTRY wrap_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(588);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribI4usv(index, v);
+    record(588, intercept_start);
+}
+
+static PFNGLGETUNIFORMUIVPROC real_glGetUniformuiv;
+static void APIENTRY wrap_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetUniformuiv(program, location, params);
+    record(589, intercept_start);
+}
+
+static PFNGLBINDFRAGDATALOCATIONPROC real_glBindFragDataLocation;
+static void APIENTRY wrap_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    if (gl_capture_on) {
+        gl_capture_call(590);
+        gl_capture_u32(program);
+        gl_capture_u32(color);
+        gl_capture_string(name, -1);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindFragDataLocation(program, color, name);
+    record(590, intercept_start);
+}
+
+static PFNGLGETFRAGDATALOCATIONPROC real_glGetFragDataLocation;
+static GLint APIENTRY wrap_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    GLint intercept_result = real_glGetFragDataLocation(program, name);
+    record(591, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLUNIFORM1UIPROC real_glUniform1ui;
+static void APIENTRY wrap_glUniform1ui(GLint location, GLuint v0) {
+    if (gl_capture_on) {
+        gl_capture_call(592);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform1ui(location, v0);
+    record(592, intercept_start);
+}
+
+static PFNGLUNIFORM2UIPROC real_glUniform2ui;
+static void APIENTRY wrap_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    if (gl_capture_on) {
+        gl_capture_call(593);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform2ui(location, v0, v1);
+    record(593, intercept_start);
+}
+
+static PFNGLUNIFORM3UIPROC real_glUniform3ui;
+static void APIENTRY wrap_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    if (gl_capture_on) {
+        gl_capture_call(594);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+        gl_capture_u32(v2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform3ui(location, v0, v1, v2);
+    record(594, intercept_start);
+}
+
+static PFNGLUNIFORM4UIPROC real_glUniform4ui;
+static void APIENTRY wrap_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    if (gl_capture_on) {
+        gl_capture_call(595);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+        gl_capture_u32(v2);
+        gl_capture_u32(v3);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform4ui(location, v0, v1, v2, v3);
+    record(595, intercept_start);
+}
+
+static PFNGLUNIFORM1UIVPROC real_glUniform1uiv;
+static void APIENTRY wrap_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(596);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 4);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform1uiv(location, count, value);
+    record(596, intercept_start);
+}
+
+static PFNGLUNIFORM2UIVPROC real_glUniform2uiv;
+static void APIENTRY wrap_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(597);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 8);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform2uiv(location, count, value);
+    record(597, intercept_start);
+}
+
+static PFNGLUNIFORM3UIVPROC real_glUniform3uiv;
+static void APIENTRY wrap_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(598);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 12);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform3uiv(location, count, value);
+    record(598, intercept_start);
+}
+
+static PFNGLUNIFORM4UIVPROC real_glUniform4uiv;
+static void APIENTRY wrap_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(599);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 16);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform4uiv(location, count, value);
+    record(599, intercept_start);
+}
+
+static PFNGLTEXPARAMETERIIVPROC real_glTexParameterIiv;
+static void APIENTRY wrap_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(600);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexParameterIiv(target, pname, params);
+    record(600, intercept_start);
+}
+
+static PFNGLTEXPARAMETERIUIVPROC real_glTexParameterIuiv;
+static void APIENTRY wrap_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(601);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexParameterIuiv(target, pname, params);
+    record(601, intercept_start);
+}
+
+static PFNGLGETTEXPARAMETERIIVPROC real_glGetTexParameterIiv;
+static void APIENTRY wrap_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexParameterIiv(target, pname, params);
+    record(602, intercept_start);
+}
+
+static PFNGLGETTEXPARAMETERIUIVPROC real_glGetTexParameterIuiv;
+static void APIENTRY wrap_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTexParameterIuiv(target, pname, params);
+    record(603, intercept_start);
+}
+
+static PFNGLCLEARBUFFERIVPROC real_glClearBufferiv;
+static void APIENTRY wrap_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(604);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearBufferiv(buffer, drawbuffer, value);
+    record(604, intercept_start);
+}
+
+static PFNGLCLEARBUFFERUIVPROC real_glClearBufferuiv;
+static void APIENTRY wrap_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(605);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearBufferuiv(buffer, drawbuffer, value);
+    record(605, intercept_start);
+}
+
+static PFNGLCLEARBUFFERFVPROC real_glClearBufferfv;
+static void APIENTRY wrap_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(606);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearBufferfv(buffer, drawbuffer, value);
+    record(606, intercept_start);
+}
+
+static PFNGLCLEARBUFFERFIPROC real_glClearBufferfi;
+static void APIENTRY wrap_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    if (gl_capture_on) {
+        gl_capture_call(607);
+        gl_capture_u32(buffer);
+        gl_capture_u32(drawbuffer);
+        gl_capture_f32(depth);
+        gl_capture_u32(stencil);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+    record(607, intercept_start);
+}
+
+static PFNGLGETSTRINGIPROC real_glGetStringi;
+static const GLubyte * APIENTRY wrap_glGetStringi(GLenum name, GLuint index) {
+    uint64_t intercept_start = now_ns();
+    const GLubyte * intercept_result = real_glGetStringi(name, index);
+    record(608, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLISRENDERBUFFERPROC real_glIsRenderbuffer;
+static GLboolean APIENTRY wrap_glIsRenderbuffer(GLuint renderbuffer) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsRenderbuffer(renderbuffer);
+    record(609, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLBINDRENDERBUFFERPROC real_glBindRenderbuffer;
+static void APIENTRY wrap_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    if (gl_capture_on) {
+        gl_capture_call(610);
+        gl_capture_u32(target);
+        gl_capture_u32(renderbuffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindRenderbuffer(target, renderbuffer);
+    record(610, intercept_start);
+}
+
+static PFNGLDELETERENDERBUFFERSPROC real_glDeleteRenderbuffers;
+static void APIENTRY wrap_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    if (gl_capture_on) {
+        gl_capture_call(611);
+        gl_capture_u32(n);
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(renderbuffers[i]);
+        }
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteRenderbuffers(n, renderbuffers);
+    record(611, intercept_start);
+}
+
+static PFNGLGENRENDERBUFFERSPROC real_glGenRenderbuffers;
+static void APIENTRY wrap_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    if (gl_capture_on) {
+        gl_capture_call(612);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenRenderbuffers(n, renderbuffers);
+    record(612, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(renderbuffers[i]);
+        }
+    }
+}
+
+static PFNGLRENDERBUFFERSTORAGEPROC real_glRenderbufferStorage;
+static void APIENTRY wrap_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(613);
+        gl_capture_u32(target);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRenderbufferStorage(target, internalformat, width, height);
+    record(613, intercept_start);
+}
+
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC real_glGetRenderbufferParameteriv;
+static void APIENTRY wrap_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetRenderbufferParameteriv(target, pname, params);
+    record(614, intercept_start);
+}
+
+static PFNGLISFRAMEBUFFERPROC real_glIsFramebuffer;
+static GLboolean APIENTRY wrap_glIsFramebuffer(GLuint framebuffer) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsFramebuffer(framebuffer);
+    record(615, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLBINDFRAMEBUFFERPROC real_glBindFramebuffer;
+static void APIENTRY wrap_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    if (gl_capture_on) {
+        gl_capture_call(616);
+        gl_capture_u32(target);
+        gl_capture_u32(framebuffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindFramebuffer(target, framebuffer);
+    record(616, intercept_start);
+}
+
+static PFNGLDELETEFRAMEBUFFERSPROC real_glDeleteFramebuffers;
+static void APIENTRY wrap_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    if (gl_capture_on) {
+        gl_capture_call(617);
+        gl_capture_u32(n);
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(framebuffers[i]);
+        }
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteFramebuffers(n, framebuffers);
+    record(617, intercept_start);
+}
+
+static PFNGLGENFRAMEBUFFERSPROC real_glGenFramebuffers;
+static void APIENTRY wrap_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    if (gl_capture_on) {
+        gl_capture_call(618);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenFramebuffers(n, framebuffers);
+    record(618, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(framebuffers[i]);
+        }
+    }
+}
+
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC real_glCheckFramebufferStatus;
+static GLenum APIENTRY wrap_glCheckFramebufferStatus(GLenum target) {
+    uint64_t intercept_start = now_ns();
+    GLenum intercept_result = real_glCheckFramebufferStatus(target);
+    record(619, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLFRAMEBUFFERTEXTURE1DPROC real_glFramebufferTexture1D;
+static void APIENTRY wrap_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    if (gl_capture_on) {
+        gl_capture_call(620);
+        gl_capture_u32(target);
+        gl_capture_u32(attachment);
+        gl_capture_u32(textarget);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+    record(620, intercept_start);
+}
+
+static PFNGLFRAMEBUFFERTEXTURE2DPROC real_glFramebufferTexture2D;
+static void APIENTRY wrap_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    if (gl_capture_on) {
+        gl_capture_call(621);
+        gl_capture_u32(target);
+        gl_capture_u32(attachment);
+        gl_capture_u32(textarget);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+    record(621, intercept_start);
+}
+
+static PFNGLFRAMEBUFFERTEXTURE3DPROC real_glFramebufferTexture3D;
+static void APIENTRY wrap_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    if (gl_capture_on) {
+        gl_capture_call(622);
+        gl_capture_u32(target);
+        gl_capture_u32(attachment);
+        gl_capture_u32(textarget);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+        gl_capture_u32(zoffset);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+    record(622, intercept_start);
+}
+
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC real_glFramebufferRenderbuffer;
+static void APIENTRY wrap_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    if (gl_capture_on) {
+        gl_capture_call(623);
+        gl_capture_u32(target);
+        gl_capture_u32(attachment);
+        gl_capture_u32(renderbuffertarget);
+        gl_capture_u32(renderbuffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+    record(623, intercept_start);
+}
+
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC real_glGetFramebufferAttachmentParameteriv;
+static void APIENTRY wrap_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+    record(624, intercept_start);
+}
+
+static PFNGLGENERATEMIPMAPPROC real_glGenerateMipmap;
+static void APIENTRY wrap_glGenerateMipmap(GLenum target) {
+    if (gl_capture_on) {
+        gl_capture_call(625);
+        gl_capture_u32(target);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenerateMipmap(target);
+    record(625, intercept_start);
+}
+
+static PFNGLBLITFRAMEBUFFERPROC real_glBlitFramebuffer;
+static void APIENTRY wrap_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    if (gl_capture_on) {
+        gl_capture_call(626);
+        gl_capture_u32(srcX0);
+        gl_capture_u32(srcY0);
+        gl_capture_u32(srcX1);
+        gl_capture_u32(srcY1);
+        gl_capture_u32(dstX0);
+        gl_capture_u32(dstY0);
+        gl_capture_u32(dstX1);
+        gl_capture_u32(dstY1);
+        gl_capture_u32(mask);
+        gl_capture_u32(filter);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    record(626, intercept_start);
+}
+
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC real_glRenderbufferStorageMultisample;
+static void APIENTRY wrap_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(627);
+        gl_capture_u32(target);
+        gl_capture_u32(samples);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+    record(627, intercept_start);
+}
+
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC real_glFramebufferTextureLayer;
+static void APIENTRY wrap_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    if (gl_capture_on) {
+        gl_capture_call(628);
+        gl_capture_u32(target);
+        gl_capture_u32(attachment);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+        gl_capture_u32(layer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+    record(628, intercept_start);
+}
+
+static PFNGLMAPBUFFERRANGEPROC real_glMapBufferRange;
+static void * APIENTRY wrap_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    if (gl_capture_on) {
+        gl_capture_call(629);
+        gl_capture_u32(target);
+        gl_capture_u64(offset);
+        gl_capture_u64(length);
+        gl_capture_u32(access);
+    }
+    uint64_t intercept_start = now_ns();
+    void * intercept_result = real_glMapBufferRange(target, offset, length, access);
+    record(629, intercept_start);
+    if (gl_capture_on) {
+        gl_capture_mapped(target, intercept_result, offset, length, access);
+    }
+    return intercept_result;
+}
+
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC real_glFlushMappedBufferRange;
+static void APIENTRY wrap_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    if (gl_capture_on) {
+        gl_capture_call(630);
+        gl_capture_u32(target);
+        gl_capture_u64(offset);
+        gl_capture_u64(length);
+        gl_capture_mapped_contents(target, 1, offset, length);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFlushMappedBufferRange(target, offset, length);
+    record(630, intercept_start);
+}
+
+static PFNGLBINDVERTEXARRAYPROC real_glBindVertexArray;
+static void APIENTRY wrap_glBindVertexArray(GLuint array) {
+    if (gl_capture_on) {
+        gl_capture_call(631);
+        gl_capture_u32(array);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindVertexArray(array);
+    record(631, intercept_start);
+}
+
+static PFNGLDELETEVERTEXARRAYSPROC real_glDeleteVertexArrays;
+static void APIENTRY wrap_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    if (gl_capture_on) {
+        gl_capture_call(632);
+        gl_capture_u32(n);
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(arrays[i]);
+        }
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteVertexArrays(n, arrays);
+    record(632, intercept_start);
+}
+
+static PFNGLGENVERTEXARRAYSPROC real_glGenVertexArrays;
+static void APIENTRY wrap_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    if (gl_capture_on) {
+        gl_capture_call(633);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenVertexArrays(n, arrays);
+    record(633, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(arrays[i]);
+        }
+    }
+}
+
+static PFNGLISVERTEXARRAYPROC real_glIsVertexArray;
+static GLboolean APIENTRY wrap_glIsVertexArray(GLuint array) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsVertexArray(array);
+    record(634, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLDRAWARRAYSINSTANCEDPROC real_glDrawArraysInstanced;
+static void APIENTRY wrap_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    if (gl_capture_on) {
+        gl_capture_call(635);
+        gl_capture_u32(mode);
+        gl_capture_u32(first);
+        gl_capture_u32(count);
+        gl_capture_u32(instancecount);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawArraysInstanced(mode, first, count, instancecount);
+    record(635, intercept_start);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDPROC real_glDrawElementsInstanced;
+static void APIENTRY wrap_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    if (gl_capture_on) {
+        gl_capture_call(636);
+        gl_capture_u32(mode);
+        gl_capture_u32(count);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indices);
+        gl_capture_u32(instancecount);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+    record(636, intercept_start);
+}
+
+static PFNGLTEXBUFFERPROC real_glTexBuffer;
+static void APIENTRY wrap_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    if (gl_capture_on) {
+        gl_capture_call(637);
+        gl_capture_u32(target);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(buffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexBuffer(target, internalformat, buffer);
+    record(637, intercept_start);
+}
+
+static PFNGLPRIMITIVERESTARTINDEXPROC real_glPrimitiveRestartIndex;
+static void APIENTRY wrap_glPrimitiveRestartIndex(GLuint index) {
+    if (gl_capture_on) {
+        gl_capture_call(638);
+        gl_capture_u32(index);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPrimitiveRestartIndex(index);
+    record(638, intercept_start);
+}
+
+static PFNGLCOPYBUFFERSUBDATAPROC real_glCopyBufferSubData;
+static void APIENTRY wrap_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    if (gl_capture_on) {
+        gl_capture_call(639);
+        gl_capture_u32(readTarget);
+        gl_capture_u32(writeTarget);
+        gl_capture_u64(readOffset);
+        gl_capture_u64(writeOffset);
+        gl_capture_u64(size);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+    record(639, intercept_start);
+}
+
+static PFNGLGETUNIFORMINDICESPROC real_glGetUniformIndices;
+static void APIENTRY wrap_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    uint64_t intercept_start = now_ns();
+    real_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+    record(640, intercept_start);
+}
+
+static PFNGLGETACTIVEUNIFORMSIVPROC real_glGetActiveUniformsiv;
+static void APIENTRY wrap_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+    record(641, intercept_start);
+}
+
+static PFNGLGETACTIVEUNIFORMNAMEPROC real_glGetActiveUniformName;
+static void APIENTRY wrap_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+    uint64_t intercept_start = now_ns();
+    real_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+    record(642, intercept_start);
+}
+
+static PFNGLGETUNIFORMBLOCKINDEXPROC real_glGetUniformBlockIndex;
+static GLuint APIENTRY wrap_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    uint64_t intercept_start = now_ns();
+    GLuint intercept_result = real_glGetUniformBlockIndex(program, uniformBlockName);
+    record(643, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC real_glGetActiveUniformBlockiv;
+static void APIENTRY wrap_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+    record(644, intercept_start);
+}
+
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC real_glGetActiveUniformBlockName;
+static void APIENTRY wrap_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    uint64_t intercept_start = now_ns();
+    real_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    record(645, intercept_start);
+}
+
+static PFNGLUNIFORMBLOCKBINDINGPROC real_glUniformBlockBinding;
+static void APIENTRY wrap_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    if (gl_capture_on) {
+        gl_capture_call(646);
+        gl_capture_u32(program);
+        gl_capture_u32(uniformBlockIndex);
+        gl_capture_u32(uniformBlockBinding);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+    record(646, intercept_start);
+}
+
+static PFNGLDRAWELEMENTSBASEVERTEXPROC real_glDrawElementsBaseVertex;
+static void APIENTRY wrap_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    if (gl_capture_on) {
+        gl_capture_call(647);
+        gl_capture_u32(mode);
+        gl_capture_u32(count);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indices);
+        gl_capture_u32(basevertex);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+    record(647, intercept_start);
+}
+
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC real_glDrawRangeElementsBaseVertex;
+static void APIENTRY wrap_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    if (gl_capture_on) {
+        gl_capture_call(648);
+        gl_capture_u32(mode);
+        gl_capture_u32(start);
+        gl_capture_u32(end);
+        gl_capture_u32(count);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indices);
+        gl_capture_u32(basevertex);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+    record(648, intercept_start);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC real_glDrawElementsInstancedBaseVertex;
+static void APIENTRY wrap_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    if (gl_capture_on) {
+        gl_capture_call(649);
+        gl_capture_u32(mode);
+        gl_capture_u32(count);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indices);
+        gl_capture_u32(instancecount);
+        gl_capture_u32(basevertex);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+    record(649, intercept_start);
+}
+
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC real_glMultiDrawElementsBaseVertex;
+static void APIENTRY wrap_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(650);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+    record(650, intercept_start);
+}
+
+static PFNGLPROVOKINGVERTEXPROC real_glProvokingVertex;
+static void APIENTRY wrap_glProvokingVertex(GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(651);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProvokingVertex(mode);
+    record(651, intercept_start);
+}
+
+static PFNGLFENCESYNCPROC real_glFenceSync;
+static GLsync APIENTRY wrap_glFenceSync(GLenum condition, GLbitfield flags) {
+    if (gl_capture_on) {
+        gl_capture_call(652);
+        gl_capture_u32(condition);
+        gl_capture_u32(flags);
+    }
+    uint64_t intercept_start = now_ns();
+    GLsync intercept_result = real_glFenceSync(condition, flags);
+    record(652, intercept_start);
+    if (gl_capture_on) {
+        gl_capture_u64((uint64_t)(uintptr_t)intercept_result);
+    }
+    return intercept_result;
+}
+
+static PFNGLISSYNCPROC real_glIsSync;
+static GLboolean APIENTRY wrap_glIsSync(GLsync sync) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsSync(sync);
+    record(653, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLDELETESYNCPROC real_glDeleteSync;
+static void APIENTRY wrap_glDeleteSync(GLsync sync) {
+    if (gl_capture_on) {
+        gl_capture_call(654);
+        gl_capture_u64((uint64_t)(uintptr_t)sync);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteSync(sync);
+    record(654, intercept_start);
+}
+
+static PFNGLCLIENTWAITSYNCPROC real_glClientWaitSync;
+static GLenum APIENTRY wrap_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    if (gl_capture_on) {
+        gl_capture_call(655);
+        gl_capture_u64((uint64_t)(uintptr_t)sync);
+        gl_capture_u32(flags);
+        gl_capture_u64(timeout);
+    }
+    uint64_t intercept_start = now_ns();
+    GLenum intercept_result = real_glClientWaitSync(sync, flags, timeout);
+    record(655, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLWAITSYNCPROC real_glWaitSync;
+static void APIENTRY wrap_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    if (gl_capture_on) {
+        gl_capture_call(656);
+        gl_capture_u64((uint64_t)(uintptr_t)sync);
+        gl_capture_u32(flags);
+        gl_capture_u64(timeout);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glWaitSync(sync, flags, timeout);
+    record(656, intercept_start);
+}
+
+static PFNGLGETINTEGER64VPROC real_glGetInteger64v;
+static void APIENTRY wrap_glGetInteger64v(GLenum pname, GLint64 *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetInteger64v(pname, data);
+    record(657, intercept_start);
+}
+
+static PFNGLGETSYNCIVPROC real_glGetSynciv;
+static void APIENTRY wrap_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetSynciv(sync, pname, count, length, values);
+    record(658, intercept_start);
+}
+
+static PFNGLGETINTEGER64I_VPROC real_glGetInteger64i_v;
+static void APIENTRY wrap_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetInteger64i_v(target, index, data);
+    record(659, intercept_start);
+}
+
+static PFNGLGETBUFFERPARAMETERI64VPROC real_glGetBufferParameteri64v;
+static void APIENTRY wrap_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetBufferParameteri64v(target, pname, params);
+    record(660, intercept_start);
+}
+
+static PFNGLFRAMEBUFFERTEXTUREPROC real_glFramebufferTexture;
+static void APIENTRY wrap_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    if (gl_capture_on) {
+        gl_capture_call(661);
+        gl_capture_u32(target);
+        gl_capture_u32(attachment);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFramebufferTexture(target, attachment, texture, level);
+    record(661, intercept_start);
+}
+
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC real_glTexImage2DMultisample;
+static void APIENTRY wrap_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    if (gl_capture_on) {
+        gl_capture_call(662);
+        gl_capture_u32(target);
+        gl_capture_u32(samples);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(fixedsamplelocations);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    record(662, intercept_start);
+}
+
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC real_glTexImage3DMultisample;
+static void APIENTRY wrap_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    if (gl_capture_on) {
+        gl_capture_call(663);
+        gl_capture_u32(target);
+        gl_capture_u32(samples);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(depth);
+        gl_capture_u32(fixedsamplelocations);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    record(663, intercept_start);
+}
+
+static PFNGLGETMULTISAMPLEFVPROC real_glGetMultisamplefv;
+static void APIENTRY wrap_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    uint64_t intercept_start = now_ns();
+    real_glGetMultisamplefv(pname, index, val);
+    record(664, intercept_start);
+}
+
+static PFNGLSAMPLEMASKIPROC real_glSampleMaski;
+static void APIENTRY wrap_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    if (gl_capture_on) {
+        gl_capture_call(665);
+        gl_capture_u32(maskNumber);
+        gl_capture_u32(mask);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSampleMaski(maskNumber, mask);
+    record(665, intercept_start);
+}
+
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC real_glBindFragDataLocationIndexed;
+static void APIENTRY wrap_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    if (gl_capture_on) {
+        gl_capture_call(666);
+        gl_capture_u32(program);
+        gl_capture_u32(colorNumber);
+        gl_capture_u32(index);
+        gl_capture_string(name, -1);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+    record(666, intercept_start);
+}
+
+static PFNGLGETFRAGDATAINDEXPROC real_glGetFragDataIndex;
+static GLint APIENTRY wrap_glGetFragDataIndex(GLuint program, const GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    GLint intercept_result = real_glGetFragDataIndex(program, name);
+    record(667, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGENSAMPLERSPROC real_glGenSamplers;
+static void APIENTRY wrap_glGenSamplers(GLsizei count, GLuint *samplers) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(668);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenSamplers(count, samplers);
+    record(668, intercept_start);
+}
+
+static PFNGLDELETESAMPLERSPROC real_glDeleteSamplers;
+static void APIENTRY wrap_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(669);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteSamplers(count, samplers);
+    record(669, intercept_start);
+}
+
+static PFNGLISSAMPLERPROC real_glIsSampler;
+static GLboolean APIENTRY wrap_glIsSampler(GLuint sampler) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsSampler(sampler);
+    record(670, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLBINDSAMPLERPROC real_glBindSampler;
+static void APIENTRY wrap_glBindSampler(GLuint unit, GLuint sampler) {
+    if (gl_capture_on) {
+        gl_capture_call(671);
+        gl_capture_u32(unit);
+        gl_capture_u32(sampler);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindSampler(unit, sampler);
+    record(671, intercept_start);
+}
+
+static PFNGLSAMPLERPARAMETERIPROC real_glSamplerParameteri;
+static void APIENTRY wrap_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(672);
+        gl_capture_u32(sampler);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSamplerParameteri(sampler, pname, param);
+    record(672, intercept_start);
+}
+
+static PFNGLSAMPLERPARAMETERIVPROC real_glSamplerParameteriv;
+static void APIENTRY wrap_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(673);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSamplerParameteriv(sampler, pname, param);
+    record(673, intercept_start);
+}
+
+static PFNGLSAMPLERPARAMETERFPROC real_glSamplerParameterf;
+static void APIENTRY wrap_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(674);
+        gl_capture_u32(sampler);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSamplerParameterf(sampler, pname, param);
+    record(674, intercept_start);
+}
+
+static PFNGLSAMPLERPARAMETERFVPROC real_glSamplerParameterfv;
+static void APIENTRY wrap_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(675);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSamplerParameterfv(sampler, pname, param);
+    record(675, intercept_start);
+}
+
+static PFNGLSAMPLERPARAMETERIIVPROC real_glSamplerParameterIiv;
+static void APIENTRY wrap_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(676);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSamplerParameterIiv(sampler, pname, param);
+    record(676, intercept_start);
+}
+
+static PFNGLSAMPLERPARAMETERIUIVPROC real_glSamplerParameterIuiv;
+static void APIENTRY wrap_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(677);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSamplerParameterIuiv(sampler, pname, param);
+    record(677, intercept_start);
+}
+
+static PFNGLGETSAMPLERPARAMETERIVPROC real_glGetSamplerParameteriv;
+static void APIENTRY wrap_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetSamplerParameteriv(sampler, pname, params);
+    record(678, intercept_start);
+}
+
+static PFNGLGETSAMPLERPARAMETERIIVPROC real_glGetSamplerParameterIiv;
+static void APIENTRY wrap_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetSamplerParameterIiv(sampler, pname, params);
+    record(679, intercept_start);
+}
+
+static PFNGLGETSAMPLERPARAMETERFVPROC real_glGetSamplerParameterfv;
+static void APIENTRY wrap_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetSamplerParameterfv(sampler, pname, params);
+    record(680, intercept_start);
+}
+
+static PFNGLGETSAMPLERPARAMETERIUIVPROC real_glGetSamplerParameterIuiv;
+static void APIENTRY wrap_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetSamplerParameterIuiv(sampler, pname, params);
+    record(681, intercept_start);
+}
+
+static PFNGLQUERYCOUNTERPROC real_glQueryCounter;
+static void APIENTRY wrap_glQueryCounter(GLuint id, GLenum target) {
+    if (gl_capture_on) {
+        gl_capture_call(682);
+        gl_capture_u32(id);
+        gl_capture_u32(target);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glQueryCounter(id, target);
+    record(682, intercept_start);
+}
+
+static PFNGLGETQUERYOBJECTI64VPROC real_glGetQueryObjecti64v;
+static void APIENTRY wrap_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetQueryObjecti64v(id, pname, params);
+    record(683, intercept_start);
+}
+
+static PFNGLGETQUERYOBJECTUI64VPROC real_glGetQueryObjectui64v;
+static void APIENTRY wrap_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetQueryObjectui64v(id, pname, params);
+    record(684, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBDIVISORPROC real_glVertexAttribDivisor;
+static void APIENTRY wrap_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    if (gl_capture_on) {
+        gl_capture_call(685);
+        gl_capture_u32(index);
+        gl_capture_u32(divisor);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribDivisor(index, divisor);
+    record(685, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBP1UIPROC real_glVertexAttribP1ui;
+static void APIENTRY wrap_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if (gl_capture_on) {
+        gl_capture_call(686);
+        gl_capture_u32(index);
+        gl_capture_u32(type);
+        gl_capture_u32(normalized);
+        gl_capture_u32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribP1ui(index, type, normalized, value);
+    record(686, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBP1UIVPROC real_glVertexAttribP1uiv;
+static void APIENTRY wrap_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(687);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribP1uiv(index, type, normalized, value);
+    record(687, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBP2UIPROC real_glVertexAttribP2ui;
+static void APIENTRY wrap_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if (gl_capture_on) {
+        gl_capture_call(688);
+        gl_capture_u32(index);
+        gl_capture_u32(type);
+        gl_capture_u32(normalized);
+        gl_capture_u32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribP2ui(index, type, normalized, value);
+    record(688, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBP2UIVPROC real_glVertexAttribP2uiv;
+static void APIENTRY wrap_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(689);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribP2uiv(index, type, normalized, value);
+    record(689, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBP3UIPROC real_glVertexAttribP3ui;
+static void APIENTRY wrap_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if (gl_capture_on) {
+        gl_capture_call(690);
+        gl_capture_u32(index);
+        gl_capture_u32(type);
+        gl_capture_u32(normalized);
+        gl_capture_u32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribP3ui(index, type, normalized, value);
+    record(690, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBP3UIVPROC real_glVertexAttribP3uiv;
+static void APIENTRY wrap_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(691);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribP3uiv(index, type, normalized, value);
+    record(691, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBP4UIPROC real_glVertexAttribP4ui;
+static void APIENTRY wrap_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    if (gl_capture_on) {
+        gl_capture_call(692);
+        gl_capture_u32(index);
+        gl_capture_u32(type);
+        gl_capture_u32(normalized);
+        gl_capture_u32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribP4ui(index, type, normalized, value);
+    record(692, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBP4UIVPROC real_glVertexAttribP4uiv;
+static void APIENTRY wrap_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(693);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribP4uiv(index, type, normalized, value);
+    record(693, intercept_start);
+}
+
+static PFNGLVERTEXP2UIPROC real_glVertexP2ui;
+static void APIENTRY wrap_glVertexP2ui(GLenum type, GLuint value) {
+    if (gl_capture_on) {
+        gl_capture_call(694);
+        gl_capture_u32(type);
+        gl_capture_u32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexP2ui(type, value);
+    record(694, intercept_start);
+}
+
+static PFNGLVERTEXP2UIVPROC real_glVertexP2uiv;
+static void APIENTRY wrap_glVertexP2uiv(GLenum type, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(695);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexP2uiv(type, value);
+    record(695, intercept_start);
+}
+
+static PFNGLVERTEXP3UIPROC real_glVertexP3ui;
+static void APIENTRY wrap_glVertexP3ui(GLenum type, GLuint value) {
+    if (gl_capture_on) {
+        gl_capture_call(696);
+        gl_capture_u32(type);
+        gl_capture_u32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexP3ui(type, value);
+    record(696, intercept_start);
+}
+
+static PFNGLVERTEXP3UIVPROC real_glVertexP3uiv;
+static void APIENTRY wrap_glVertexP3uiv(GLenum type, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(697);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexP3uiv(type, value);
+    record(697, intercept_start);
+}
+
+static PFNGLVERTEXP4UIPROC real_glVertexP4ui;
+static void APIENTRY wrap_glVertexP4ui(GLenum type, GLuint value) {
+    if (gl_capture_on) {
+        gl_capture_call(698);
+        gl_capture_u32(type);
+        gl_capture_u32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexP4ui(type, value);
+    record(698, intercept_start);
+}
+
+static PFNGLVERTEXP4UIVPROC real_glVertexP4uiv;
+static void APIENTRY wrap_glVertexP4uiv(GLenum type, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(699);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexP4uiv(type, value);
+    record(699, intercept_start);
+}
+
+static PFNGLTEXCOORDP1UIPROC real_glTexCoordP1ui;
+static void APIENTRY wrap_glTexCoordP1ui(GLenum type, GLuint coords) {
+    if (gl_capture_on) {
+        gl_capture_call(700);
+        gl_capture_u32(type);
+        gl_capture_u32(coords);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoordP1ui(type, coords);
+    record(700, intercept_start);
+}
+
+static PFNGLTEXCOORDP1UIVPROC real_glTexCoordP1uiv;
+static void APIENTRY wrap_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(701);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoordP1uiv(type, coords);
+    record(701, intercept_start);
+}
+
+static PFNGLTEXCOORDP2UIPROC real_glTexCoordP2ui;
+static void APIENTRY wrap_glTexCoordP2ui(GLenum type, GLuint coords) {
+    if (gl_capture_on) {
+        gl_capture_call(702);
+        gl_capture_u32(type);
+        gl_capture_u32(coords);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoordP2ui(type, coords);
+    record(702, intercept_start);
+}
+
+static PFNGLTEXCOORDP2UIVPROC real_glTexCoordP2uiv;
+static void APIENTRY wrap_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(703);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoordP2uiv(type, coords);
+    record(703, intercept_start);
+}
+
+static PFNGLTEXCOORDP3UIPROC real_glTexCoordP3ui;
+static void APIENTRY wrap_glTexCoordP3ui(GLenum type, GLuint coords) {
+    if (gl_capture_on) {
+        gl_capture_call(704);
+        gl_capture_u32(type);
+        gl_capture_u32(coords);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoordP3ui(type, coords);
+    record(704, intercept_start);
+}
+
+static PFNGLTEXCOORDP3UIVPROC real_glTexCoordP3uiv;
+static void APIENTRY wrap_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(705);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoordP3uiv(type, coords);
+    record(705, intercept_start);
+}
+
+static PFNGLTEXCOORDP4UIPROC real_glTexCoordP4ui;
+static void APIENTRY wrap_glTexCoordP4ui(GLenum type, GLuint coords) {
+    if (gl_capture_on) {
+        gl_capture_call(706);
+        gl_capture_u32(type);
+        gl_capture_u32(coords);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoordP4ui(type, coords);
+    record(706, intercept_start);
+}
+
+static PFNGLTEXCOORDP4UIVPROC real_glTexCoordP4uiv;
+static void APIENTRY wrap_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(707);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexCoordP4uiv(type, coords);
+    record(707, intercept_start);
+}
+
+static PFNGLMULTITEXCOORDP1UIPROC real_glMultiTexCoordP1ui;
+static void APIENTRY wrap_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    if (gl_capture_on) {
+        gl_capture_call(708);
+        gl_capture_u32(texture);
+        gl_capture_u32(type);
+        gl_capture_u32(coords);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoordP1ui(texture, type, coords);
+    record(708, intercept_start);
+}
+
+static PFNGLMULTITEXCOORDP1UIVPROC real_glMultiTexCoordP1uiv;
+static void APIENTRY wrap_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(709);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoordP1uiv(texture, type, coords);
+    record(709, intercept_start);
+}
+
+static PFNGLMULTITEXCOORDP2UIPROC real_glMultiTexCoordP2ui;
+static void APIENTRY wrap_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    if (gl_capture_on) {
+        gl_capture_call(710);
+        gl_capture_u32(texture);
+        gl_capture_u32(type);
+        gl_capture_u32(coords);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoordP2ui(texture, type, coords);
+    record(710, intercept_start);
+}
+
+static PFNGLMULTITEXCOORDP2UIVPROC real_glMultiTexCoordP2uiv;
+static void APIENTRY wrap_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(711);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoordP2uiv(texture, type, coords);
+    record(711, intercept_start);
+}
+
+static PFNGLMULTITEXCOORDP3UIPROC real_glMultiTexCoordP3ui;
+static void APIENTRY wrap_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    if (gl_capture_on) {
+        gl_capture_call(712);
+        gl_capture_u32(texture);
+        gl_capture_u32(type);
+        gl_capture_u32(coords);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoordP3ui(texture, type, coords);
+    record(712, intercept_start);
+}
+
+static PFNGLMULTITEXCOORDP3UIVPROC real_glMultiTexCoordP3uiv;
+static void APIENTRY wrap_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(713);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoordP3uiv(texture, type, coords);
+    record(713, intercept_start);
+}
+
+static PFNGLMULTITEXCOORDP4UIPROC real_glMultiTexCoordP4ui;
+static void APIENTRY wrap_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    if (gl_capture_on) {
+        gl_capture_call(714);
+        gl_capture_u32(texture);
+        gl_capture_u32(type);
+        gl_capture_u32(coords);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoordP4ui(texture, type, coords);
+    record(714, intercept_start);
+}
+
+static PFNGLMULTITEXCOORDP4UIVPROC real_glMultiTexCoordP4uiv;
+static void APIENTRY wrap_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(715);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiTexCoordP4uiv(texture, type, coords);
+    record(715, intercept_start);
+}
+
+static PFNGLNORMALP3UIPROC real_glNormalP3ui;
+static void APIENTRY wrap_glNormalP3ui(GLenum type, GLuint coords) {
+    if (gl_capture_on) {
+        gl_capture_call(716);
+        gl_capture_u32(type);
+        gl_capture_u32(coords);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormalP3ui(type, coords);
+    record(716, intercept_start);
+}
+
+static PFNGLNORMALP3UIVPROC real_glNormalP3uiv;
+static void APIENTRY wrap_glNormalP3uiv(GLenum type, const GLuint *coords) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(717);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNormalP3uiv(type, coords);
+    record(717, intercept_start);
+}
+
+static PFNGLCOLORP3UIPROC real_glColorP3ui;
+static void APIENTRY wrap_glColorP3ui(GLenum type, GLuint color) {
+    if (gl_capture_on) {
+        gl_capture_call(718);
+        gl_capture_u32(type);
+        gl_capture_u32(color);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColorP3ui(type, color);
+    record(718, intercept_start);
+}
+
+static PFNGLCOLORP3UIVPROC real_glColorP3uiv;
+static void APIENTRY wrap_glColorP3uiv(GLenum type, const GLuint *color) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(719);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColorP3uiv(type, color);
+    record(719, intercept_start);
+}
+
+static PFNGLCOLORP4UIPROC real_glColorP4ui;
+static void APIENTRY wrap_glColorP4ui(GLenum type, GLuint color) {
+    if (gl_capture_on) {
+        gl_capture_call(720);
+        gl_capture_u32(type);
+        gl_capture_u32(color);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColorP4ui(type, color);
+    record(720, intercept_start);
+}
+
+static PFNGLCOLORP4UIVPROC real_glColorP4uiv;
+static void APIENTRY wrap_glColorP4uiv(GLenum type, const GLuint *color) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(721);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glColorP4uiv(type, color);
+    record(721, intercept_start);
+}
+
+static PFNGLSECONDARYCOLORP3UIPROC real_glSecondaryColorP3ui;
+static void APIENTRY wrap_glSecondaryColorP3ui(GLenum type, GLuint color) {
+    if (gl_capture_on) {
+        gl_capture_call(722);
+        gl_capture_u32(type);
+        gl_capture_u32(color);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColorP3ui(type, color);
+    record(722, intercept_start);
+}
+
+static PFNGLSECONDARYCOLORP3UIVPROC real_glSecondaryColorP3uiv;
+static void APIENTRY wrap_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(723);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSecondaryColorP3uiv(type, color);
+    record(723, intercept_start);
+}
+
+static PFNGLMINSAMPLESHADINGPROC real_glMinSampleShading;
+static void APIENTRY wrap_glMinSampleShading(GLfloat value) {
+    if (gl_capture_on) {
+        gl_capture_call(724);
+        gl_capture_f32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMinSampleShading(value);
+    record(724, intercept_start);
+}
+
+static PFNGLBLENDEQUATIONIPROC real_glBlendEquationi;
+static void APIENTRY wrap_glBlendEquationi(GLuint buf, GLenum mode) {
+    if (gl_capture_on) {
+        gl_capture_call(725);
+        gl_capture_u32(buf);
+        gl_capture_u32(mode);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlendEquationi(buf, mode);
+    record(725, intercept_start);
+}
+
+static PFNGLBLENDEQUATIONSEPARATEIPROC real_glBlendEquationSeparatei;
+static void APIENTRY wrap_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    if (gl_capture_on) {
+        gl_capture_call(726);
+        gl_capture_u32(buf);
+        gl_capture_u32(modeRGB);
+        gl_capture_u32(modeAlpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+    record(726, intercept_start);
+}
+
+static PFNGLBLENDFUNCIPROC real_glBlendFunci;
+static void APIENTRY wrap_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    if (gl_capture_on) {
+        gl_capture_call(727);
+        gl_capture_u32(buf);
+        gl_capture_u32(src);
+        gl_capture_u32(dst);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlendFunci(buf, src, dst);
+    record(727, intercept_start);
+}
+
+static PFNGLBLENDFUNCSEPARATEIPROC real_glBlendFuncSeparatei;
+static void APIENTRY wrap_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    if (gl_capture_on) {
+        gl_capture_call(728);
+        gl_capture_u32(buf);
+        gl_capture_u32(srcRGB);
+        gl_capture_u32(dstRGB);
+        gl_capture_u32(srcAlpha);
+        gl_capture_u32(dstAlpha);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+    record(728, intercept_start);
+}
+
+static PFNGLDRAWARRAYSINDIRECTPROC real_glDrawArraysIndirect;
+static void APIENTRY wrap_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+    if (gl_capture_on) {
+        gl_capture_call(729);
+        gl_capture_u32(mode);
+        gl_capture_u64((uint64_t)(uintptr_t)indirect);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawArraysIndirect(mode, indirect);
+    record(729, intercept_start);
+}
+
+static PFNGLDRAWELEMENTSINDIRECTPROC real_glDrawElementsIndirect;
+static void APIENTRY wrap_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+    if (gl_capture_on) {
+        gl_capture_call(730);
+        gl_capture_u32(mode);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indirect);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawElementsIndirect(mode, type, indirect);
+    record(730, intercept_start);
+}
+
+static PFNGLUNIFORM1DPROC real_glUniform1d;
+static void APIENTRY wrap_glUniform1d(GLint location, GLdouble x) {
+    if (gl_capture_on) {
+        gl_capture_call(731);
+        gl_capture_u32(location);
+        gl_capture_f64(x);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform1d(location, x);
+    record(731, intercept_start);
+}
+
+static PFNGLUNIFORM2DPROC real_glUniform2d;
+static void APIENTRY wrap_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+    if (gl_capture_on) {
+        gl_capture_call(732);
+        gl_capture_u32(location);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform2d(location, x, y);
+    record(732, intercept_start);
+}
+
+static PFNGLUNIFORM3DPROC real_glUniform3d;
+static void APIENTRY wrap_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    if (gl_capture_on) {
+        gl_capture_call(733);
+        gl_capture_u32(location);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform3d(location, x, y, z);
+    record(733, intercept_start);
+}
+
+static PFNGLUNIFORM4DPROC real_glUniform4d;
+static void APIENTRY wrap_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if (gl_capture_on) {
+        gl_capture_call(734);
+        gl_capture_u32(location);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+        gl_capture_f64(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform4d(location, x, y, z, w);
+    record(734, intercept_start);
+}
+
+static PFNGLUNIFORM1DVPROC real_glUniform1dv;
+static void APIENTRY wrap_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(735);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 8);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform1dv(location, count, value);
+    record(735, intercept_start);
+}
+
+static PFNGLUNIFORM2DVPROC real_glUniform2dv;
+static void APIENTRY wrap_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(736);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 16);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform2dv(location, count, value);
+    record(736, intercept_start);
+}
+
+static PFNGLUNIFORM3DVPROC real_glUniform3dv;
+static void APIENTRY wrap_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(737);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 24);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform3dv(location, count, value);
+    record(737, intercept_start);
+}
+
+static PFNGLUNIFORM4DVPROC real_glUniform4dv;
+static void APIENTRY wrap_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(738);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 32);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniform4dv(location, count, value);
+    record(738, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX2DVPROC real_glUniformMatrix2dv;
+static void APIENTRY wrap_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(739);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 32);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix2dv(location, count, transpose, value);
+    record(739, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX3DVPROC real_glUniformMatrix3dv;
+static void APIENTRY wrap_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(740);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 72);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix3dv(location, count, transpose, value);
+    record(740, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX4DVPROC real_glUniformMatrix4dv;
+static void APIENTRY wrap_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(741);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 128);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix4dv(location, count, transpose, value);
+    record(741, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX2X3DVPROC real_glUniformMatrix2x3dv;
+static void APIENTRY wrap_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(742);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 48);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix2x3dv(location, count, transpose, value);
+    record(742, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX2X4DVPROC real_glUniformMatrix2x4dv;
+static void APIENTRY wrap_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(743);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 64);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix2x4dv(location, count, transpose, value);
+    record(743, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX3X2DVPROC real_glUniformMatrix3x2dv;
+static void APIENTRY wrap_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(744);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 48);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix3x2dv(location, count, transpose, value);
+    record(744, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX3X4DVPROC real_glUniformMatrix3x4dv;
+static void APIENTRY wrap_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(745);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 96);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix3x4dv(location, count, transpose, value);
+    record(745, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX4X2DVPROC real_glUniformMatrix4x2dv;
+static void APIENTRY wrap_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(746);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 64);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix4x2dv(location, count, transpose, value);
+    record(746, intercept_start);
+}
+
+static PFNGLUNIFORMMATRIX4X3DVPROC real_glUniformMatrix4x3dv;
+static void APIENTRY wrap_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(747);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 96);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformMatrix4x3dv(location, count, transpose, value);
+    record(747, intercept_start);
+}
+
+static PFNGLGETUNIFORMDVPROC real_glGetUniformdv;
+static void APIENTRY wrap_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetUniformdv(program, location, params);
+    record(748, intercept_start);
+}
+
+static PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC real_glGetSubroutineUniformLocation;
+static GLint APIENTRY wrap_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    GLint intercept_result = real_glGetSubroutineUniformLocation(program, shadertype, name);
+    record(749, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETSUBROUTINEINDEXPROC real_glGetSubroutineIndex;
+static GLuint APIENTRY wrap_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    GLuint intercept_result = real_glGetSubroutineIndex(program, shadertype, name);
+    record(750, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC real_glGetActiveSubroutineUniformiv;
+static void APIENTRY wrap_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+    record(751, intercept_start);
+}
+
+static PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC real_glGetActiveSubroutineUniformName;
+static void APIENTRY wrap_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    real_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+    record(752, intercept_start);
+}
+
+static PFNGLGETACTIVESUBROUTINENAMEPROC real_glGetActiveSubroutineName;
+static void APIENTRY wrap_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    real_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+    record(753, intercept_start);
+}
+
+static PFNGLUNIFORMSUBROUTINESUIVPROC real_glUniformSubroutinesuiv;
+static void APIENTRY wrap_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(754);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUniformSubroutinesuiv(shadertype, count, indices);
+    record(754, intercept_start);
+}
+
+static PFNGLGETUNIFORMSUBROUTINEUIVPROC real_glGetUniformSubroutineuiv;
+static void APIENTRY wrap_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetUniformSubroutineuiv(shadertype, location, params);
+    record(755, intercept_start);
+}
+
+static PFNGLGETPROGRAMSTAGEIVPROC real_glGetProgramStageiv;
+static void APIENTRY wrap_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetProgramStageiv(program, shadertype, pname, values);
+    record(756, intercept_start);
+}
+
+static PFNGLPATCHPARAMETERIPROC real_glPatchParameteri;
+static void APIENTRY wrap_glPatchParameteri(GLenum pname, GLint value) {
+    if (gl_capture_on) {
+        gl_capture_call(757);
+        gl_capture_u32(pname);
+        gl_capture_u32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPatchParameteri(pname, value);
+    record(757, intercept_start);
+}
+
+static PFNGLPATCHPARAMETERFVPROC real_glPatchParameterfv;
+static void APIENTRY wrap_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(758);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPatchParameterfv(pname, values);
+    record(758, intercept_start);
+}
+
+static PFNGLBINDTRANSFORMFEEDBACKPROC real_glBindTransformFeedback;
+static void APIENTRY wrap_glBindTransformFeedback(GLenum target, GLuint id) {
+    if (gl_capture_on) {
+        gl_capture_call(759);
+        gl_capture_u32(target);
+        gl_capture_u32(id);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindTransformFeedback(target, id);
+    record(759, intercept_start);
+}
+
+static PFNGLDELETETRANSFORMFEEDBACKSPROC real_glDeleteTransformFeedbacks;
+static void APIENTRY wrap_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(760);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteTransformFeedbacks(n, ids);
+    record(760, intercept_start);
+}
+
+static PFNGLGENTRANSFORMFEEDBACKSPROC real_glGenTransformFeedbacks;
+static void APIENTRY wrap_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(761);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenTransformFeedbacks(n, ids);
+    record(761, intercept_start);
+}
+
+static PFNGLISTRANSFORMFEEDBACKPROC real_glIsTransformFeedback;
+static GLboolean APIENTRY wrap_glIsTransformFeedback(GLuint id) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsTransformFeedback(id);
+    record(762, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLPAUSETRANSFORMFEEDBACKPROC real_glPauseTransformFeedback;
+static void APIENTRY wrap_glPauseTransformFeedback(void) {
+    if (gl_capture_on) {
+        gl_capture_call(763);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPauseTransformFeedback();
+    record(763, intercept_start);
+}
+
+static PFNGLRESUMETRANSFORMFEEDBACKPROC real_glResumeTransformFeedback;
+static void APIENTRY wrap_glResumeTransformFeedback(void) {
+    if (gl_capture_on) {
+        gl_capture_call(764);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glResumeTransformFeedback();
+    record(764, intercept_start);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKPROC real_glDrawTransformFeedback;
+static void APIENTRY wrap_glDrawTransformFeedback(GLenum mode, GLuint id) {
+    if (gl_capture_on) {
+        gl_capture_call(765);
+        gl_capture_u32(mode);
+        gl_capture_u32(id);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawTransformFeedback(mode, id);
+    record(765, intercept_start);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC real_glDrawTransformFeedbackStream;
+static void APIENTRY wrap_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    if (gl_capture_on) {
+        gl_capture_call(766);
+        gl_capture_u32(mode);
+        gl_capture_u32(id);
+        gl_capture_u32(stream);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawTransformFeedbackStream(mode, id, stream);
+    record(766, intercept_start);
+}
+
+static PFNGLBEGINQUERYINDEXEDPROC real_glBeginQueryIndexed;
+static void APIENTRY wrap_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    if (gl_capture_on) {
+        gl_capture_call(767);
+        gl_capture_u32(target);
+        gl_capture_u32(index);
+        gl_capture_u32(id);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBeginQueryIndexed(target, index, id);
+    record(767, intercept_start);
+}
+
+static PFNGLENDQUERYINDEXEDPROC real_glEndQueryIndexed;
+static void APIENTRY wrap_glEndQueryIndexed(GLenum target, GLuint index) {
+    if (gl_capture_on) {
+        gl_capture_call(768);
+        gl_capture_u32(target);
+        gl_capture_u32(index);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEndQueryIndexed(target, index);
+    record(768, intercept_start);
+}
+
+static PFNGLGETQUERYINDEXEDIVPROC real_glGetQueryIndexediv;
+static void APIENTRY wrap_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetQueryIndexediv(target, index, pname, params);
+    record(769, intercept_start);
+}
+
+static PFNGLRELEASESHADERCOMPILERPROC real_glReleaseShaderCompiler;
+static void APIENTRY wrap_glReleaseShaderCompiler(void) {
+    if (gl_capture_on) {
+        gl_capture_call(770);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glReleaseShaderCompiler();
+    record(770, intercept_start);
+}
+
+static PFNGLSHADERBINARYPROC real_glShaderBinary;
+static void APIENTRY wrap_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(771);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glShaderBinary(count, shaders, binaryFormat, binary, length);
+    record(771, intercept_start);
+}
+
+static PFNGLGETSHADERPRECISIONFORMATPROC real_glGetShaderPrecisionFormat;
+static void APIENTRY wrap_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+    uint64_t intercept_start = now_ns();
+    real_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+    record(772, intercept_start);
+}
+
+static PFNGLDEPTHRANGEFPROC real_glDepthRangef;
+static void APIENTRY wrap_glDepthRangef(GLfloat n, GLfloat f) {
+    if (gl_capture_on) {
+        gl_capture_call(773);
+        gl_capture_f32(n);
+        gl_capture_f32(f);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDepthRangef(n, f);
+    record(773, intercept_start);
+}
+
+static PFNGLCLEARDEPTHFPROC real_glClearDepthf;
+static void APIENTRY wrap_glClearDepthf(GLfloat d) {
+    if (gl_capture_on) {
+        gl_capture_call(774);
+        gl_capture_f32(d);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearDepthf(d);
+    record(774, intercept_start);
+}
+
+static PFNGLGETPROGRAMBINARYPROC real_glGetProgramBinary;
+static void APIENTRY wrap_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    uint64_t intercept_start = now_ns();
+    real_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+    record(775, intercept_start);
+}
+
+static PFNGLPROGRAMBINARYPROC real_glProgramBinary;
+static void APIENTRY wrap_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    if (gl_capture_on) {
+        gl_capture_call(776);
+        gl_capture_u32(program);
+        gl_capture_u32(binaryFormat);
+        gl_capture_bytes(binary, (uint64_t)length);
+        gl_capture_u32(length);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramBinary(program, binaryFormat, binary, length);
+    record(776, intercept_start);
+}
+
+static PFNGLPROGRAMPARAMETERIPROC real_glProgramParameteri;
+static void APIENTRY wrap_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    if (gl_capture_on) {
+        gl_capture_call(777);
+        gl_capture_u32(program);
+        gl_capture_u32(pname);
+        gl_capture_u32(value);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramParameteri(program, pname, value);
+    record(777, intercept_start);
+}
+
+static PFNGLUSEPROGRAMSTAGESPROC real_glUseProgramStages;
+static void APIENTRY wrap_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    if (gl_capture_on) {
+        gl_capture_call(778);
+        gl_capture_u32(pipeline);
+        gl_capture_u32(stages);
+        gl_capture_u32(program);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glUseProgramStages(pipeline, stages, program);
+    record(778, intercept_start);
+}
+
+static PFNGLACTIVESHADERPROGRAMPROC real_glActiveShaderProgram;
+static void APIENTRY wrap_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    if (gl_capture_on) {
+        gl_capture_call(779);
+        gl_capture_u32(pipeline);
+        gl_capture_u32(program);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glActiveShaderProgram(pipeline, program);
+    record(779, intercept_start);
+}
+
+static PFNGLCREATESHADERPROGRAMVPROC real_glCreateShaderProgramv;
+static GLuint APIENTRY wrap_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(780);
+    }
+    uint64_t intercept_start = now_ns();
+    GLuint intercept_result = real_glCreateShaderProgramv(type, count, strings);
+    record(780, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLBINDPROGRAMPIPELINEPROC real_glBindProgramPipeline;
+static void APIENTRY wrap_glBindProgramPipeline(GLuint pipeline) {
+    if (gl_capture_on) {
+        gl_capture_call(781);
+        gl_capture_u32(pipeline);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindProgramPipeline(pipeline);
+    record(781, intercept_start);
+}
+
+static PFNGLDELETEPROGRAMPIPELINESPROC real_glDeleteProgramPipelines;
+static void APIENTRY wrap_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+    if (gl_capture_on) {
+        gl_capture_call(782);
+        gl_capture_u32(n);
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(pipelines[i]);
+        }
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDeleteProgramPipelines(n, pipelines);
+    record(782, intercept_start);
+}
+
+static PFNGLGENPROGRAMPIPELINESPROC real_glGenProgramPipelines;
+static void APIENTRY wrap_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+    if (gl_capture_on) {
+        gl_capture_call(783);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenProgramPipelines(n, pipelines);
+    record(783, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(pipelines[i]);
+        }
+    }
+}
+
+static PFNGLISPROGRAMPIPELINEPROC real_glIsProgramPipeline;
+static GLboolean APIENTRY wrap_glIsProgramPipeline(GLuint pipeline) {
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glIsProgramPipeline(pipeline);
+    record(784, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETPROGRAMPIPELINEIVPROC real_glGetProgramPipelineiv;
+static void APIENTRY wrap_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetProgramPipelineiv(pipeline, pname, params);
+    record(785, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM1IPROC real_glProgramUniform1i;
+static void APIENTRY wrap_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    if (gl_capture_on) {
+        gl_capture_call(786);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform1i(program, location, v0);
+    record(786, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM1IVPROC real_glProgramUniform1iv;
+static void APIENTRY wrap_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(787);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 4);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform1iv(program, location, count, value);
+    record(787, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM1FPROC real_glProgramUniform1f;
+static void APIENTRY wrap_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    if (gl_capture_on) {
+        gl_capture_call(788);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_f32(v0);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform1f(program, location, v0);
+    record(788, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM1FVPROC real_glProgramUniform1fv;
+static void APIENTRY wrap_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(789);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 4);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform1fv(program, location, count, value);
+    record(789, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM1DPROC real_glProgramUniform1d;
+static void APIENTRY wrap_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    if (gl_capture_on) {
+        gl_capture_call(790);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_f64(v0);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform1d(program, location, v0);
+    record(790, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM1DVPROC real_glProgramUniform1dv;
+static void APIENTRY wrap_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(791);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 8);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform1dv(program, location, count, value);
+    record(791, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM1UIPROC real_glProgramUniform1ui;
+static void APIENTRY wrap_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    if (gl_capture_on) {
+        gl_capture_call(792);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform1ui(program, location, v0);
+    record(792, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM1UIVPROC real_glProgramUniform1uiv;
+static void APIENTRY wrap_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(793);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 4);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform1uiv(program, location, count, value);
+    record(793, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM2IPROC real_glProgramUniform2i;
+static void APIENTRY wrap_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    if (gl_capture_on) {
+        gl_capture_call(794);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform2i(program, location, v0, v1);
+    record(794, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM2IVPROC real_glProgramUniform2iv;
+static void APIENTRY wrap_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(795);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 8);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform2iv(program, location, count, value);
+    record(795, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM2FPROC real_glProgramUniform2f;
+static void APIENTRY wrap_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    if (gl_capture_on) {
+        gl_capture_call(796);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_f32(v0);
+        gl_capture_f32(v1);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform2f(program, location, v0, v1);
+    record(796, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM2FVPROC real_glProgramUniform2fv;
+static void APIENTRY wrap_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(797);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 8);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform2fv(program, location, count, value);
+    record(797, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM2DPROC real_glProgramUniform2d;
+static void APIENTRY wrap_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    if (gl_capture_on) {
+        gl_capture_call(798);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_f64(v0);
+        gl_capture_f64(v1);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform2d(program, location, v0, v1);
+    record(798, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM2DVPROC real_glProgramUniform2dv;
+static void APIENTRY wrap_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(799);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 16);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform2dv(program, location, count, value);
+    record(799, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM2UIPROC real_glProgramUniform2ui;
+static void APIENTRY wrap_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    if (gl_capture_on) {
+        gl_capture_call(800);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform2ui(program, location, v0, v1);
+    record(800, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM2UIVPROC real_glProgramUniform2uiv;
+static void APIENTRY wrap_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(801);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 8);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform2uiv(program, location, count, value);
+    record(801, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM3IPROC real_glProgramUniform3i;
+static void APIENTRY wrap_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    if (gl_capture_on) {
+        gl_capture_call(802);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+        gl_capture_u32(v2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform3i(program, location, v0, v1, v2);
+    record(802, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM3IVPROC real_glProgramUniform3iv;
+static void APIENTRY wrap_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(803);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 12);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform3iv(program, location, count, value);
+    record(803, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM3FPROC real_glProgramUniform3f;
+static void APIENTRY wrap_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    if (gl_capture_on) {
+        gl_capture_call(804);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_f32(v0);
+        gl_capture_f32(v1);
+        gl_capture_f32(v2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform3f(program, location, v0, v1, v2);
+    record(804, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM3FVPROC real_glProgramUniform3fv;
+static void APIENTRY wrap_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(805);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 12);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform3fv(program, location, count, value);
+    record(805, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM3DPROC real_glProgramUniform3d;
+static void APIENTRY wrap_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    if (gl_capture_on) {
+        gl_capture_call(806);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_f64(v0);
+        gl_capture_f64(v1);
+        gl_capture_f64(v2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform3d(program, location, v0, v1, v2);
+    record(806, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM3DVPROC real_glProgramUniform3dv;
+static void APIENTRY wrap_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(807);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 24);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform3dv(program, location, count, value);
+    record(807, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM3UIPROC real_glProgramUniform3ui;
+static void APIENTRY wrap_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    if (gl_capture_on) {
+        gl_capture_call(808);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+        gl_capture_u32(v2);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform3ui(program, location, v0, v1, v2);
+    record(808, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM3UIVPROC real_glProgramUniform3uiv;
+static void APIENTRY wrap_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(809);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 12);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform3uiv(program, location, count, value);
+    record(809, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM4IPROC real_glProgramUniform4i;
+static void APIENTRY wrap_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    if (gl_capture_on) {
+        gl_capture_call(810);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+        gl_capture_u32(v2);
+        gl_capture_u32(v3);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform4i(program, location, v0, v1, v2, v3);
+    record(810, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM4IVPROC real_glProgramUniform4iv;
+static void APIENTRY wrap_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(811);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 16);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform4iv(program, location, count, value);
+    record(811, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM4FPROC real_glProgramUniform4f;
+static void APIENTRY wrap_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    if (gl_capture_on) {
+        gl_capture_call(812);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_f32(v0);
+        gl_capture_f32(v1);
+        gl_capture_f32(v2);
+        gl_capture_f32(v3);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform4f(program, location, v0, v1, v2, v3);
+    record(812, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM4FVPROC real_glProgramUniform4fv;
+static void APIENTRY wrap_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(813);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 16);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform4fv(program, location, count, value);
+    record(813, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM4DPROC real_glProgramUniform4d;
+static void APIENTRY wrap_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    if (gl_capture_on) {
+        gl_capture_call(814);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_f64(v0);
+        gl_capture_f64(v1);
+        gl_capture_f64(v2);
+        gl_capture_f64(v3);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform4d(program, location, v0, v1, v2, v3);
+    record(814, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM4DVPROC real_glProgramUniform4dv;
+static void APIENTRY wrap_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(815);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 32);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform4dv(program, location, count, value);
+    record(815, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM4UIPROC real_glProgramUniform4ui;
+static void APIENTRY wrap_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    if (gl_capture_on) {
+        gl_capture_call(816);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(v0);
+        gl_capture_u32(v1);
+        gl_capture_u32(v2);
+        gl_capture_u32(v3);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+    record(816, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORM4UIVPROC real_glProgramUniform4uiv;
+static void APIENTRY wrap_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_call(817);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_bytes(value, (uint64_t)count * 16);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniform4uiv(program, location, count, value);
+    record(817, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC real_glProgramUniformMatrix2fv;
+static void APIENTRY wrap_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(818);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 16);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+    record(818, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC real_glProgramUniformMatrix3fv;
+static void APIENTRY wrap_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(819);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 36);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+    record(819, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC real_glProgramUniformMatrix4fv;
+static void APIENTRY wrap_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(820);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 64);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+    record(820, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC real_glProgramUniformMatrix2dv;
+static void APIENTRY wrap_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(821);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 32);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+    record(821, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC real_glProgramUniformMatrix3dv;
+static void APIENTRY wrap_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(822);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 72);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+    record(822, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC real_glProgramUniformMatrix4dv;
+static void APIENTRY wrap_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(823);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 128);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+    record(823, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC real_glProgramUniformMatrix2x3fv;
+static void APIENTRY wrap_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(824);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 24);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+    record(824, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC real_glProgramUniformMatrix3x2fv;
+static void APIENTRY wrap_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(825);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 24);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+    record(825, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC real_glProgramUniformMatrix2x4fv;
+static void APIENTRY wrap_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(826);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 32);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+    record(826, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC real_glProgramUniformMatrix4x2fv;
+static void APIENTRY wrap_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(827);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 32);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+    record(827, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC real_glProgramUniformMatrix3x4fv;
+static void APIENTRY wrap_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(828);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 48);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+    record(828, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC real_glProgramUniformMatrix4x3fv;
+static void APIENTRY wrap_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_call(829);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 48);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+    record(829, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC real_glProgramUniformMatrix2x3dv;
+static void APIENTRY wrap_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(830);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 48);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+    record(830, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC real_glProgramUniformMatrix3x2dv;
+static void APIENTRY wrap_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(831);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 48);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+    record(831, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC real_glProgramUniformMatrix2x4dv;
+static void APIENTRY wrap_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(832);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 64);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+    record(832, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC real_glProgramUniformMatrix4x2dv;
+static void APIENTRY wrap_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(833);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 64);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+    record(833, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC real_glProgramUniformMatrix3x4dv;
+static void APIENTRY wrap_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(834);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 96);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+    record(834, intercept_start);
+}
+
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC real_glProgramUniformMatrix4x3dv;
+static void APIENTRY wrap_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+    if (gl_capture_on) {
+        gl_capture_call(835);
+        gl_capture_u32(program);
+        gl_capture_u32(location);
+        gl_capture_u32(count);
+        gl_capture_u32(transpose);
+        gl_capture_bytes(value, (uint64_t)count * 96);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+    record(835, intercept_start);
+}
+
+static PFNGLVALIDATEPROGRAMPIPELINEPROC real_glValidateProgramPipeline;
+static void APIENTRY wrap_glValidateProgramPipeline(GLuint pipeline) {
+    if (gl_capture_on) {
+        gl_capture_call(836);
+        gl_capture_u32(pipeline);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glValidateProgramPipeline(pipeline);
+    record(836, intercept_start);
+}
+
+static PFNGLGETPROGRAMPIPELINEINFOLOGPROC real_glGetProgramPipelineInfoLog;
+static void APIENTRY wrap_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    uint64_t intercept_start = now_ns();
+    real_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+    record(837, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBL1DPROC real_glVertexAttribL1d;
+static void APIENTRY wrap_glVertexAttribL1d(GLuint index, GLdouble x) {
+    if (gl_capture_on) {
+        gl_capture_call(838);
+        gl_capture_u32(index);
+        gl_capture_f64(x);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribL1d(index, x);
+    record(838, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBL2DPROC real_glVertexAttribL2d;
+static void APIENTRY wrap_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    if (gl_capture_on) {
+        gl_capture_call(839);
+        gl_capture_u32(index);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribL2d(index, x, y);
+    record(839, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBL3DPROC real_glVertexAttribL3d;
+static void APIENTRY wrap_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    if (gl_capture_on) {
+        gl_capture_call(840);
+        gl_capture_u32(index);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribL3d(index, x, y, z);
+    record(840, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBL4DPROC real_glVertexAttribL4d;
+static void APIENTRY wrap_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    if (gl_capture_on) {
+        gl_capture_call(841);
+        gl_capture_u32(index);
+        gl_capture_f64(x);
+        gl_capture_f64(y);
+        gl_capture_f64(z);
+        gl_capture_f64(w);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribL4d(index, x, y, z, w);
+    record(841, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBL1DVPROC real_glVertexAttribL1dv;
+static void APIENTRY wrap_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(842);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribL1dv(index, v);
+    record(842, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBL2DVPROC real_glVertexAttribL2dv;
+static void APIENTRY wrap_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(843);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribL2dv(index, v);
+    record(843, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBL3DVPROC real_glVertexAttribL3dv;
+static void APIENTRY wrap_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(844);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribL3dv(index, v);
+    record(844, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBL4DVPROC real_glVertexAttribL4dv;
+static void APIENTRY wrap_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(845);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribL4dv(index, v);
+    record(845, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBLPOINTERPROC real_glVertexAttribLPointer;
+static void APIENTRY wrap_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    if (gl_capture_on) {
+        gl_capture_call(846);
+        gl_capture_u32(index);
+        gl_capture_u32(size);
+        gl_capture_u32(type);
+        gl_capture_u32(stride);
+        gl_capture_u64((uint64_t)(uintptr_t)pointer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribLPointer(index, size, type, stride, pointer);
+    record(846, intercept_start);
+}
+
+static PFNGLGETVERTEXATTRIBLDVPROC real_glGetVertexAttribLdv;
+static void APIENTRY wrap_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetVertexAttribLdv(index, pname, params);
+    record(847, intercept_start);
+}
+
+static PFNGLVIEWPORTARRAYVPROC real_glViewportArrayv;
+static void APIENTRY wrap_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(848);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glViewportArrayv(first, count, v);
+    record(848, intercept_start);
+}
+
+static PFNGLVIEWPORTINDEXEDFPROC real_glViewportIndexedf;
+static void APIENTRY wrap_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    if (gl_capture_on) {
+        gl_capture_call(849);
+        gl_capture_u32(index);
+        gl_capture_f32(x);
+        gl_capture_f32(y);
+        gl_capture_f32(w);
+        gl_capture_f32(h);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glViewportIndexedf(index, x, y, w, h);
+    record(849, intercept_start);
+}
+
+static PFNGLVIEWPORTINDEXEDFVPROC real_glViewportIndexedfv;
+static void APIENTRY wrap_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(850);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glViewportIndexedfv(index, v);
+    record(850, intercept_start);
+}
+
+static PFNGLSCISSORARRAYVPROC real_glScissorArrayv;
+static void APIENTRY wrap_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(851);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glScissorArrayv(first, count, v);
+    record(851, intercept_start);
+}
+
+static PFNGLSCISSORINDEXEDPROC real_glScissorIndexed;
+static void APIENTRY wrap_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(852);
+        gl_capture_u32(index);
+        gl_capture_u32(left);
+        gl_capture_u32(bottom);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glScissorIndexed(index, left, bottom, width, height);
+    record(852, intercept_start);
+}
+
+static PFNGLSCISSORINDEXEDVPROC real_glScissorIndexedv;
+static void APIENTRY wrap_glScissorIndexedv(GLuint index, const GLint *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(853);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glScissorIndexedv(index, v);
+    record(853, intercept_start);
+}
+
+static PFNGLDEPTHRANGEARRAYVPROC real_glDepthRangeArrayv;
+static void APIENTRY wrap_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(854);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDepthRangeArrayv(first, count, v);
+    record(854, intercept_start);
+}
+
+static PFNGLDEPTHRANGEINDEXEDPROC real_glDepthRangeIndexed;
+static void APIENTRY wrap_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    if (gl_capture_on) {
+        gl_capture_call(855);
+        gl_capture_u32(index);
+        gl_capture_f64(n);
+        gl_capture_f64(f);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDepthRangeIndexed(index, n, f);
+    record(855, intercept_start);
+}
+
+static PFNGLGETFLOATI_VPROC real_glGetFloati_v;
+static void APIENTRY wrap_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetFloati_v(target, index, data);
+    record(856, intercept_start);
+}
+
+static PFNGLGETDOUBLEI_VPROC real_glGetDoublei_v;
+static void APIENTRY wrap_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetDoublei_v(target, index, data);
+    record(857, intercept_start);
+}
+
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC real_glDrawArraysInstancedBaseInstance;
+static void APIENTRY wrap_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    if (gl_capture_on) {
+        gl_capture_call(858);
+        gl_capture_u32(mode);
+        gl_capture_u32(first);
+        gl_capture_u32(count);
+        gl_capture_u32(instancecount);
+        gl_capture_u32(baseinstance);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+    record(858, intercept_start);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC real_glDrawElementsInstancedBaseInstance;
+static void APIENTRY wrap_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+    if (gl_capture_on) {
+        gl_capture_call(859);
+        gl_capture_u32(mode);
+        gl_capture_u32(count);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indices);
+        gl_capture_u32(instancecount);
+        gl_capture_u32(baseinstance);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+    record(859, intercept_start);
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC real_glDrawElementsInstancedBaseVertexBaseInstance;
+static void APIENTRY wrap_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    if (gl_capture_on) {
+        gl_capture_call(860);
+        gl_capture_u32(mode);
+        gl_capture_u32(count);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indices);
+        gl_capture_u32(instancecount);
+        gl_capture_u32(basevertex);
+        gl_capture_u32(baseinstance);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+    record(860, intercept_start);
+}
+
+static PFNGLGETINTERNALFORMATIVPROC real_glGetInternalformativ;
+static void APIENTRY wrap_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetInternalformativ(target, internalformat, pname, count, params);
+    record(861, intercept_start);
+}
+
+static PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC real_glGetActiveAtomicCounterBufferiv;
+static void APIENTRY wrap_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+    record(862, intercept_start);
+}
+
+static PFNGLBINDIMAGETEXTUREPROC real_glBindImageTexture;
+static void APIENTRY wrap_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    if (gl_capture_on) {
+        gl_capture_call(863);
+        gl_capture_u32(unit);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+        gl_capture_u32(layered);
+        gl_capture_u32(layer);
+        gl_capture_u32(access);
+        gl_capture_u32(format);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+    record(863, intercept_start);
+}
+
+static PFNGLMEMORYBARRIERPROC real_glMemoryBarrier;
+static void APIENTRY wrap_glMemoryBarrier(GLbitfield barriers) {
+    if (gl_capture_on) {
+        gl_capture_call(864);
+        gl_capture_u32(barriers);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMemoryBarrier(barriers);
+    record(864, intercept_start);
+}
+
+static PFNGLTEXSTORAGE1DPROC real_glTexStorage1D;
+static void APIENTRY wrap_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    if (gl_capture_on) {
+        gl_capture_call(865);
+        gl_capture_u32(target);
+        gl_capture_u32(levels);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexStorage1D(target, levels, internalformat, width);
+    record(865, intercept_start);
+}
+
+static PFNGLTEXSTORAGE2DPROC real_glTexStorage2D;
+static void APIENTRY wrap_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(866);
+        gl_capture_u32(target);
+        gl_capture_u32(levels);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexStorage2D(target, levels, internalformat, width, height);
+    record(866, intercept_start);
+}
+
+static PFNGLTEXSTORAGE3DPROC real_glTexStorage3D;
+static void APIENTRY wrap_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    if (gl_capture_on) {
+        gl_capture_call(867);
+        gl_capture_u32(target);
+        gl_capture_u32(levels);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(depth);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexStorage3D(target, levels, internalformat, width, height, depth);
+    record(867, intercept_start);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC real_glDrawTransformFeedbackInstanced;
+static void APIENTRY wrap_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    if (gl_capture_on) {
+        gl_capture_call(868);
+        gl_capture_u32(mode);
+        gl_capture_u32(id);
+        gl_capture_u32(instancecount);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+    record(868, intercept_start);
+}
+
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC real_glDrawTransformFeedbackStreamInstanced;
+static void APIENTRY wrap_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    if (gl_capture_on) {
+        gl_capture_call(869);
+        gl_capture_u32(mode);
+        gl_capture_u32(id);
+        gl_capture_u32(stream);
+        gl_capture_u32(instancecount);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+    record(869, intercept_start);
+}
+
+static PFNGLCLEARBUFFERDATAPROC real_glClearBufferData;
+static void APIENTRY wrap_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(870);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearBufferData(target, internalformat, format, type, data);
+    record(870, intercept_start);
+}
+
+static PFNGLCLEARBUFFERSUBDATAPROC real_glClearBufferSubData;
+static void APIENTRY wrap_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(871);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+    record(871, intercept_start);
+}
+
+static PFNGLDISPATCHCOMPUTEPROC real_glDispatchCompute;
+static void APIENTRY wrap_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    if (gl_capture_on) {
+        gl_capture_call(872);
+        gl_capture_u32(num_groups_x);
+        gl_capture_u32(num_groups_y);
+        gl_capture_u32(num_groups_z);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+    record(872, intercept_start);
+}
+
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC real_glDispatchComputeIndirect;
+static void APIENTRY wrap_glDispatchComputeIndirect(GLintptr indirect) {
+    if (gl_capture_on) {
+        gl_capture_call(873);
+        gl_capture_u64(indirect);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDispatchComputeIndirect(indirect);
+    record(873, intercept_start);
+}
+
+static PFNGLCOPYIMAGESUBDATAPROC real_glCopyImageSubData;
+static void APIENTRY wrap_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    if (gl_capture_on) {
+        gl_capture_call(874);
+        gl_capture_u32(srcName);
+        gl_capture_u32(srcTarget);
+        gl_capture_u32(srcLevel);
+        gl_capture_u32(srcX);
+        gl_capture_u32(srcY);
+        gl_capture_u32(srcZ);
+        gl_capture_u32(dstName);
+        gl_capture_u32(dstTarget);
+        gl_capture_u32(dstLevel);
+        gl_capture_u32(dstX);
+        gl_capture_u32(dstY);
+        gl_capture_u32(dstZ);
+        gl_capture_u32(srcWidth);
+        gl_capture_u32(srcHeight);
+        gl_capture_u32(srcDepth);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+    record(874, intercept_start);
+}
+
+static PFNGLFRAMEBUFFERPARAMETERIPROC real_glFramebufferParameteri;
+static void APIENTRY wrap_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(875);
+        gl_capture_u32(target);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFramebufferParameteri(target, pname, param);
+    record(875, intercept_start);
+}
+
+static PFNGLGETFRAMEBUFFERPARAMETERIVPROC real_glGetFramebufferParameteriv;
+static void APIENTRY wrap_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetFramebufferParameteriv(target, pname, params);
+    record(876, intercept_start);
+}
+
+static PFNGLGETINTERNALFORMATI64VPROC real_glGetInternalformati64v;
+static void APIENTRY wrap_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetInternalformati64v(target, internalformat, pname, count, params);
+    record(877, intercept_start);
+}
+
+static PFNGLINVALIDATETEXSUBIMAGEPROC real_glInvalidateTexSubImage;
+static void APIENTRY wrap_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    if (gl_capture_on) {
+        gl_capture_call(878);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+        gl_capture_u32(xoffset);
+        gl_capture_u32(yoffset);
+        gl_capture_u32(zoffset);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(depth);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+    record(878, intercept_start);
+}
+
+static PFNGLINVALIDATETEXIMAGEPROC real_glInvalidateTexImage;
+static void APIENTRY wrap_glInvalidateTexImage(GLuint texture, GLint level) {
+    if (gl_capture_on) {
+        gl_capture_call(879);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glInvalidateTexImage(texture, level);
+    record(879, intercept_start);
+}
+
+static PFNGLINVALIDATEBUFFERSUBDATAPROC real_glInvalidateBufferSubData;
+static void APIENTRY wrap_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    if (gl_capture_on) {
+        gl_capture_call(880);
+        gl_capture_u32(buffer);
+        gl_capture_u64(offset);
+        gl_capture_u64(length);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glInvalidateBufferSubData(buffer, offset, length);
+    record(880, intercept_start);
+}
+
+static PFNGLINVALIDATEBUFFERDATAPROC real_glInvalidateBufferData;
+static void APIENTRY wrap_glInvalidateBufferData(GLuint buffer) {
+    if (gl_capture_on) {
+        gl_capture_call(881);
+        gl_capture_u32(buffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glInvalidateBufferData(buffer);
+    record(881, intercept_start);
+}
+
+static PFNGLINVALIDATEFRAMEBUFFERPROC real_glInvalidateFramebuffer;
+static void APIENTRY wrap_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(882);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glInvalidateFramebuffer(target, numAttachments, attachments);
+    record(882, intercept_start);
+}
+
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC real_glInvalidateSubFramebuffer;
+static void APIENTRY wrap_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(883);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+    record(883, intercept_start);
+}
+
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC real_glMultiDrawArraysIndirect;
+static void APIENTRY wrap_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    if (gl_capture_on) {
+        gl_capture_call(884);
+        gl_capture_u32(mode);
+        gl_capture_u64((uint64_t)(uintptr_t)indirect);
+        gl_capture_u32(drawcount);
+        gl_capture_u32(stride);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+    record(884, intercept_start);
+}
+
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC real_glMultiDrawElementsIndirect;
+static void APIENTRY wrap_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    if (gl_capture_on) {
+        gl_capture_call(885);
+        gl_capture_u32(mode);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indirect);
+        gl_capture_u32(drawcount);
+        gl_capture_u32(stride);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+    record(885, intercept_start);
+}
+
+static PFNGLGETPROGRAMINTERFACEIVPROC real_glGetProgramInterfaceiv;
+static void APIENTRY wrap_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetProgramInterfaceiv(program, programInterface, pname, params);
+    record(886, intercept_start);
+}
+
+static PFNGLGETPROGRAMRESOURCEINDEXPROC real_glGetProgramResourceIndex;
+static GLuint APIENTRY wrap_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    GLuint intercept_result = real_glGetProgramResourceIndex(program, programInterface, name);
+    record(887, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETPROGRAMRESOURCENAMEPROC real_glGetProgramResourceName;
+static void APIENTRY wrap_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    real_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+    record(888, intercept_start);
+}
+
+static PFNGLGETPROGRAMRESOURCEIVPROC real_glGetProgramResourceiv;
+static void APIENTRY wrap_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+    record(889, intercept_start);
+}
+
+static PFNGLGETPROGRAMRESOURCELOCATIONPROC real_glGetProgramResourceLocation;
+static GLint APIENTRY wrap_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    GLint intercept_result = real_glGetProgramResourceLocation(program, programInterface, name);
+    record(890, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC real_glGetProgramResourceLocationIndex;
+static GLint APIENTRY wrap_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+    uint64_t intercept_start = now_ns();
+    GLint intercept_result = real_glGetProgramResourceLocationIndex(program, programInterface, name);
+    record(891, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC real_glShaderStorageBlockBinding;
+static void APIENTRY wrap_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    if (gl_capture_on) {
+        gl_capture_call(892);
+        gl_capture_u32(program);
+        gl_capture_u32(storageBlockIndex);
+        gl_capture_u32(storageBlockBinding);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+    record(892, intercept_start);
+}
+
+static PFNGLTEXBUFFERRANGEPROC real_glTexBufferRange;
+static void APIENTRY wrap_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (gl_capture_on) {
+        gl_capture_call(893);
+        gl_capture_u32(target);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(buffer);
+        gl_capture_u64(offset);
+        gl_capture_u64(size);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexBufferRange(target, internalformat, buffer, offset, size);
+    record(893, intercept_start);
+}
+
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC real_glTexStorage2DMultisample;
+static void APIENTRY wrap_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    if (gl_capture_on) {
+        gl_capture_call(894);
+        gl_capture_u32(target);
+        gl_capture_u32(samples);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(fixedsamplelocations);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    record(894, intercept_start);
+}
+
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC real_glTexStorage3DMultisample;
+static void APIENTRY wrap_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    if (gl_capture_on) {
+        gl_capture_call(895);
+        gl_capture_u32(target);
+        gl_capture_u32(samples);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(depth);
+        gl_capture_u32(fixedsamplelocations);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    record(895, intercept_start);
+}
+
+static PFNGLTEXTUREVIEWPROC real_glTextureView;
+static void APIENTRY wrap_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    if (gl_capture_on) {
+        gl_capture_call(896);
+        gl_capture_u32(texture);
+        gl_capture_u32(target);
+        gl_capture_u32(origtexture);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(minlevel);
+        gl_capture_u32(numlevels);
+        gl_capture_u32(minlayer);
+        gl_capture_u32(numlayers);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+    record(896, intercept_start);
+}
+
+static PFNGLBINDVERTEXBUFFERPROC real_glBindVertexBuffer;
+static void APIENTRY wrap_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    if (gl_capture_on) {
+        gl_capture_call(897);
+        gl_capture_u32(bindingindex);
+        gl_capture_u32(buffer);
+        gl_capture_u64(offset);
+        gl_capture_u32(stride);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+    record(897, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBFORMATPROC real_glVertexAttribFormat;
+static void APIENTRY wrap_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    if (gl_capture_on) {
+        gl_capture_call(898);
+        gl_capture_u32(attribindex);
+        gl_capture_u32(size);
+        gl_capture_u32(type);
+        gl_capture_u32(normalized);
+        gl_capture_u32(relativeoffset);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+    record(898, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBIFORMATPROC real_glVertexAttribIFormat;
+static void APIENTRY wrap_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if (gl_capture_on) {
+        gl_capture_call(899);
+        gl_capture_u32(attribindex);
+        gl_capture_u32(size);
+        gl_capture_u32(type);
+        gl_capture_u32(relativeoffset);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+    record(899, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBLFORMATPROC real_glVertexAttribLFormat;
+static void APIENTRY wrap_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if (gl_capture_on) {
+        gl_capture_call(900);
+        gl_capture_u32(attribindex);
+        gl_capture_u32(size);
+        gl_capture_u32(type);
+        gl_capture_u32(relativeoffset);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+    record(900, intercept_start);
+}
+
+static PFNGLVERTEXATTRIBBINDINGPROC real_glVertexAttribBinding;
+static void APIENTRY wrap_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    if (gl_capture_on) {
+        gl_capture_call(901);
+        gl_capture_u32(attribindex);
+        gl_capture_u32(bindingindex);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexAttribBinding(attribindex, bindingindex);
+    record(901, intercept_start);
+}
+
+static PFNGLVERTEXBINDINGDIVISORPROC real_glVertexBindingDivisor;
+static void APIENTRY wrap_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    if (gl_capture_on) {
+        gl_capture_call(902);
+        gl_capture_u32(bindingindex);
+        gl_capture_u32(divisor);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexBindingDivisor(bindingindex, divisor);
+    record(902, intercept_start);
+}
+
+static PFNGLDEBUGMESSAGECONTROLPROC real_glDebugMessageControl;
+static void APIENTRY wrap_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(903);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDebugMessageControl(source, type, severity, count, ids, enabled);
+    record(903, intercept_start);
+}
+
+static PFNGLDEBUGMESSAGEINSERTPROC real_glDebugMessageInsert;
+static void APIENTRY wrap_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(904);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDebugMessageInsert(source, type, id, severity, length, buf);
+    record(904, intercept_start);
+}
+
+static PFNGLDEBUGMESSAGECALLBACKPROC real_glDebugMessageCallback;
+static void APIENTRY wrap_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(905);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDebugMessageCallback(callback, userParam);
+    record(905, intercept_start);
+}
+
+static PFNGLGETDEBUGMESSAGELOGPROC real_glGetDebugMessageLog;
+static GLuint APIENTRY wrap_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+    uint64_t intercept_start = now_ns();
+    GLuint intercept_result = real_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+    record(906, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLPUSHDEBUGGROUPPROC real_glPushDebugGroup;
+static void APIENTRY wrap_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(907);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPushDebugGroup(source, id, length, message);
+    record(907, intercept_start);
+}
+
+static PFNGLPOPDEBUGGROUPPROC real_glPopDebugGroup;
+static void APIENTRY wrap_glPopDebugGroup(void) {
+    if (gl_capture_on) {
+        gl_capture_call(908);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPopDebugGroup();
+    record(908, intercept_start);
+}
+
+static PFNGLOBJECTLABELPROC real_glObjectLabel;
+static void APIENTRY wrap_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(909);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glObjectLabel(identifier, name, length, label);
+    record(909, intercept_start);
+}
+
+static PFNGLGETOBJECTLABELPROC real_glGetObjectLabel;
+static void APIENTRY wrap_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    uint64_t intercept_start = now_ns();
+    real_glGetObjectLabel(identifier, name, bufSize, length, label);
+    record(910, intercept_start);
+}
+
+static PFNGLOBJECTPTRLABELPROC real_glObjectPtrLabel;
+static void APIENTRY wrap_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(911);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glObjectPtrLabel(ptr, length, label);
+    record(911, intercept_start);
+}
+
+static PFNGLGETOBJECTPTRLABELPROC real_glGetObjectPtrLabel;
+static void APIENTRY wrap_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    uint64_t intercept_start = now_ns();
+    real_glGetObjectPtrLabel(ptr, bufSize, length, label);
+    record(912, intercept_start);
+}
+
+static PFNGLBUFFERSTORAGEPROC real_glBufferStorage;
+static void APIENTRY wrap_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    if (gl_capture_on) {
+        gl_capture_call(913);
+        gl_capture_u32(target);
+        gl_capture_u64(size);
+        gl_capture_bytes(data, (uint64_t)size);
+        gl_capture_u32(flags);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBufferStorage(target, size, data, flags);
+    record(913, intercept_start);
+}
+
+static PFNGLCLEARTEXIMAGEPROC real_glClearTexImage;
+static void APIENTRY wrap_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(914);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearTexImage(texture, level, format, type, data);
+    record(914, intercept_start);
+}
+
+static PFNGLCLEARTEXSUBIMAGEPROC real_glClearTexSubImage;
+static void APIENTRY wrap_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(915);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+    record(915, intercept_start);
+}
+
+static PFNGLBINDBUFFERSBASEPROC real_glBindBuffersBase;
+static void APIENTRY wrap_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(916);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindBuffersBase(target, first, count, buffers);
+    record(916, intercept_start);
+}
+
+static PFNGLBINDBUFFERSRANGEPROC real_glBindBuffersRange;
+static void APIENTRY wrap_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(917);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+    record(917, intercept_start);
+}
+
+static PFNGLBINDTEXTURESPROC real_glBindTextures;
+static void APIENTRY wrap_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(918);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindTextures(first, count, textures);
+    record(918, intercept_start);
+}
+
+static PFNGLBINDSAMPLERSPROC real_glBindSamplers;
+static void APIENTRY wrap_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(919);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindSamplers(first, count, samplers);
+    record(919, intercept_start);
+}
+
+static PFNGLBINDIMAGETEXTURESPROC real_glBindImageTextures;
+static void APIENTRY wrap_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(920);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindImageTextures(first, count, textures);
+    record(920, intercept_start);
+}
+
+static PFNGLBINDVERTEXBUFFERSPROC real_glBindVertexBuffers;
+static void APIENTRY wrap_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(921);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindVertexBuffers(first, count, buffers, offsets, strides);
+    record(921, intercept_start);
+}
+
+static PFNGLCLIPCONTROLPROC real_glClipControl;
+static void APIENTRY wrap_glClipControl(GLenum origin, GLenum depth) {
+    if (gl_capture_on) {
+        gl_capture_call(922);
+        gl_capture_u32(origin);
+        gl_capture_u32(depth);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClipControl(origin, depth);
+    record(922, intercept_start);
+}
+
+static PFNGLCREATETRANSFORMFEEDBACKSPROC real_glCreateTransformFeedbacks;
+static void APIENTRY wrap_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(923);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCreateTransformFeedbacks(n, ids);
+    record(923, intercept_start);
+}
+
+static PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC real_glTransformFeedbackBufferBase;
+static void APIENTRY wrap_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+    if (gl_capture_on) {
+        gl_capture_call(924);
+        gl_capture_u32(xfb);
+        gl_capture_u32(index);
+        gl_capture_u32(buffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTransformFeedbackBufferBase(xfb, index, buffer);
+    record(924, intercept_start);
+}
+
+static PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC real_glTransformFeedbackBufferRange;
+static void APIENTRY wrap_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (gl_capture_on) {
+        gl_capture_call(925);
+        gl_capture_u32(xfb);
+        gl_capture_u32(index);
+        gl_capture_u32(buffer);
+        gl_capture_u64(offset);
+        gl_capture_u64(size);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+    record(925, intercept_start);
+}
+
+static PFNGLGETTRANSFORMFEEDBACKIVPROC real_glGetTransformFeedbackiv;
+static void APIENTRY wrap_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTransformFeedbackiv(xfb, pname, param);
+    record(926, intercept_start);
+}
+
+static PFNGLGETTRANSFORMFEEDBACKI_VPROC real_glGetTransformFeedbacki_v;
+static void APIENTRY wrap_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTransformFeedbacki_v(xfb, pname, index, param);
+    record(927, intercept_start);
+}
+
+static PFNGLGETTRANSFORMFEEDBACKI64_VPROC real_glGetTransformFeedbacki64_v;
+static void APIENTRY wrap_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+    record(928, intercept_start);
+}
+
+static PFNGLCREATEBUFFERSPROC real_glCreateBuffers;
+static void APIENTRY wrap_glCreateBuffers(GLsizei n, GLuint *buffers) {
+    if (gl_capture_on) {
+        gl_capture_call(929);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCreateBuffers(n, buffers);
+    record(929, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(buffers[i]);
+        }
+    }
+}
+
+static PFNGLNAMEDBUFFERSTORAGEPROC real_glNamedBufferStorage;
+static void APIENTRY wrap_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+    if (gl_capture_on) {
+        gl_capture_call(930);
+        gl_capture_u32(buffer);
+        gl_capture_u64(size);
+        gl_capture_bytes(data, (uint64_t)size);
+        gl_capture_u32(flags);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedBufferStorage(buffer, size, data, flags);
+    record(930, intercept_start);
+}
+
+static PFNGLNAMEDBUFFERDATAPROC real_glNamedBufferData;
+static void APIENTRY wrap_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+    if (gl_capture_on) {
+        gl_capture_call(931);
+        gl_capture_u32(buffer);
+        gl_capture_u64(size);
+        gl_capture_bytes(data, (uint64_t)size);
+        gl_capture_u32(usage);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedBufferData(buffer, size, data, usage);
+    record(931, intercept_start);
+}
+
+static PFNGLNAMEDBUFFERSUBDATAPROC real_glNamedBufferSubData;
+static void APIENTRY wrap_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_call(932);
+        gl_capture_u32(buffer);
+        gl_capture_u64(offset);
+        gl_capture_u64(size);
+        gl_capture_bytes(data, (uint64_t)size);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedBufferSubData(buffer, offset, size, data);
+    record(932, intercept_start);
+}
+
+static PFNGLCOPYNAMEDBUFFERSUBDATAPROC real_glCopyNamedBufferSubData;
+static void APIENTRY wrap_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    if (gl_capture_on) {
+        gl_capture_call(933);
+        gl_capture_u32(readBuffer);
+        gl_capture_u32(writeBuffer);
+        gl_capture_u64(readOffset);
+        gl_capture_u64(writeOffset);
+        gl_capture_u64(size);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+    record(933, intercept_start);
+}
+
+static PFNGLCLEARNAMEDBUFFERDATAPROC real_glClearNamedBufferData;
+static void APIENTRY wrap_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(934);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearNamedBufferData(buffer, internalformat, format, type, data);
+    record(934, intercept_start);
+}
+
+static PFNGLCLEARNAMEDBUFFERSUBDATAPROC real_glClearNamedBufferSubData;
+static void APIENTRY wrap_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(935);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+    record(935, intercept_start);
+}
+
+static PFNGLMAPNAMEDBUFFERPROC real_glMapNamedBuffer;
+static void * APIENTRY wrap_glMapNamedBuffer(GLuint buffer, GLenum access) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(936);
+    }
+    uint64_t intercept_start = now_ns();
+    void * intercept_result = real_glMapNamedBuffer(buffer, access);
+    record(936, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLMAPNAMEDBUFFERRANGEPROC real_glMapNamedBufferRange;
+static void * APIENTRY wrap_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(937);
+    }
+    uint64_t intercept_start = now_ns();
+    void * intercept_result = real_glMapNamedBufferRange(buffer, offset, length, access);
+    record(937, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLUNMAPNAMEDBUFFERPROC real_glUnmapNamedBuffer;
+static GLboolean APIENTRY wrap_glUnmapNamedBuffer(GLuint buffer) {
+    if (gl_capture_on) {
+        gl_capture_call(938);
+        gl_capture_u32(buffer);
+    }
+    uint64_t intercept_start = now_ns();
+    GLboolean intercept_result = real_glUnmapNamedBuffer(buffer);
+    record(938, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC real_glFlushMappedNamedBufferRange;
+static void APIENTRY wrap_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    if (gl_capture_on) {
+        gl_capture_call(939);
+        gl_capture_u32(buffer);
+        gl_capture_u64(offset);
+        gl_capture_u64(length);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glFlushMappedNamedBufferRange(buffer, offset, length);
+    record(939, intercept_start);
+}
+
+static PFNGLGETNAMEDBUFFERPARAMETERIVPROC real_glGetNamedBufferParameteriv;
+static void APIENTRY wrap_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetNamedBufferParameteriv(buffer, pname, params);
+    record(940, intercept_start);
+}
+
+static PFNGLGETNAMEDBUFFERPARAMETERI64VPROC real_glGetNamedBufferParameteri64v;
+static void APIENTRY wrap_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetNamedBufferParameteri64v(buffer, pname, params);
+    record(941, intercept_start);
+}
+
+static PFNGLGETNAMEDBUFFERPOINTERVPROC real_glGetNamedBufferPointerv;
+static void APIENTRY wrap_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetNamedBufferPointerv(buffer, pname, params);
+    record(942, intercept_start);
+}
+
+static PFNGLGETNAMEDBUFFERSUBDATAPROC real_glGetNamedBufferSubData;
+static void APIENTRY wrap_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+    uint64_t intercept_start = now_ns();
+    real_glGetNamedBufferSubData(buffer, offset, size, data);
+    record(943, intercept_start);
+}
+
+static PFNGLCREATEFRAMEBUFFERSPROC real_glCreateFramebuffers;
+static void APIENTRY wrap_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+    if (gl_capture_on) {
+        gl_capture_call(944);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCreateFramebuffers(n, framebuffers);
+    record(944, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(framebuffers[i]);
+        }
+    }
+}
+
+static PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC real_glNamedFramebufferRenderbuffer;
+static void APIENTRY wrap_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    if (gl_capture_on) {
+        gl_capture_call(945);
+        gl_capture_u32(framebuffer);
+        gl_capture_u32(attachment);
+        gl_capture_u32(renderbuffertarget);
+        gl_capture_u32(renderbuffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+    record(945, intercept_start);
+}
+
+static PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC real_glNamedFramebufferParameteri;
+static void APIENTRY wrap_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(946);
+        gl_capture_u32(framebuffer);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedFramebufferParameteri(framebuffer, pname, param);
+    record(946, intercept_start);
+}
+
+static PFNGLNAMEDFRAMEBUFFERTEXTUREPROC real_glNamedFramebufferTexture;
+static void APIENTRY wrap_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+    if (gl_capture_on) {
+        gl_capture_call(947);
+        gl_capture_u32(framebuffer);
+        gl_capture_u32(attachment);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+    record(947, intercept_start);
+}
+
+static PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC real_glNamedFramebufferTextureLayer;
+static void APIENTRY wrap_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    if (gl_capture_on) {
+        gl_capture_call(948);
+        gl_capture_u32(framebuffer);
+        gl_capture_u32(attachment);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+        gl_capture_u32(layer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+    record(948, intercept_start);
+}
+
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC real_glNamedFramebufferDrawBuffer;
+static void APIENTRY wrap_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+    if (gl_capture_on) {
+        gl_capture_call(949);
+        gl_capture_u32(framebuffer);
+        gl_capture_u32(buf);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedFramebufferDrawBuffer(framebuffer, buf);
+    record(949, intercept_start);
+}
+
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC real_glNamedFramebufferDrawBuffers;
+static void APIENTRY wrap_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(950);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+    record(950, intercept_start);
+}
+
+static PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC real_glNamedFramebufferReadBuffer;
+static void APIENTRY wrap_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+    if (gl_capture_on) {
+        gl_capture_call(951);
+        gl_capture_u32(framebuffer);
+        gl_capture_u32(src);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedFramebufferReadBuffer(framebuffer, src);
+    record(951, intercept_start);
+}
+
+static PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC real_glInvalidateNamedFramebufferData;
+static void APIENTRY wrap_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(952);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+    record(952, intercept_start);
+}
+
+static PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC real_glInvalidateNamedFramebufferSubData;
+static void APIENTRY wrap_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(953);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+    record(953, intercept_start);
+}
+
+static PFNGLCLEARNAMEDFRAMEBUFFERIVPROC real_glClearNamedFramebufferiv;
+static void APIENTRY wrap_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(954);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+    record(954, intercept_start);
+}
+
+static PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC real_glClearNamedFramebufferuiv;
+static void APIENTRY wrap_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(955);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+    record(955, intercept_start);
+}
+
+static PFNGLCLEARNAMEDFRAMEBUFFERFVPROC real_glClearNamedFramebufferfv;
+static void APIENTRY wrap_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(956);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+    record(956, intercept_start);
+}
+
+static PFNGLCLEARNAMEDFRAMEBUFFERFIPROC real_glClearNamedFramebufferfi;
+static void APIENTRY wrap_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    if (gl_capture_on) {
+        gl_capture_call(957);
+        gl_capture_u32(framebuffer);
+        gl_capture_u32(buffer);
+        gl_capture_u32(drawbuffer);
+        gl_capture_f32(depth);
+        gl_capture_u32(stencil);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+    record(957, intercept_start);
+}
+
+static PFNGLBLITNAMEDFRAMEBUFFERPROC real_glBlitNamedFramebuffer;
+static void APIENTRY wrap_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    if (gl_capture_on) {
+        gl_capture_call(958);
+        gl_capture_u32(readFramebuffer);
+        gl_capture_u32(drawFramebuffer);
+        gl_capture_u32(srcX0);
+        gl_capture_u32(srcY0);
+        gl_capture_u32(srcX1);
+        gl_capture_u32(srcY1);
+        gl_capture_u32(dstX0);
+        gl_capture_u32(dstY0);
+        gl_capture_u32(dstX1);
+        gl_capture_u32(dstY1);
+        gl_capture_u32(mask);
+        gl_capture_u32(filter);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    record(958, intercept_start);
+}
+
+static PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC real_glCheckNamedFramebufferStatus;
+static GLenum APIENTRY wrap_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+    uint64_t intercept_start = now_ns();
+    GLenum intercept_result = real_glCheckNamedFramebufferStatus(framebuffer, target);
+    record(959, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC real_glGetNamedFramebufferParameteriv;
+static void APIENTRY wrap_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+    uint64_t intercept_start = now_ns();
+    real_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+    record(960, intercept_start);
+}
+
+static PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC real_glGetNamedFramebufferAttachmentParameteriv;
+static void APIENTRY wrap_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+    record(961, intercept_start);
+}
+
+static PFNGLCREATERENDERBUFFERSPROC real_glCreateRenderbuffers;
+static void APIENTRY wrap_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    if (gl_capture_on) {
+        gl_capture_call(962);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCreateRenderbuffers(n, renderbuffers);
+    record(962, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(renderbuffers[i]);
+        }
+    }
+}
+
+static PFNGLNAMEDRENDERBUFFERSTORAGEPROC real_glNamedRenderbufferStorage;
+static void APIENTRY wrap_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(963);
+        gl_capture_u32(renderbuffer);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+    record(963, intercept_start);
+}
+
+static PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC real_glNamedRenderbufferStorageMultisample;
+static void APIENTRY wrap_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(964);
+        gl_capture_u32(renderbuffer);
+        gl_capture_u32(samples);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+    record(964, intercept_start);
+}
+
+static PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC real_glGetNamedRenderbufferParameteriv;
+static void APIENTRY wrap_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+    record(965, intercept_start);
+}
+
+static PFNGLCREATETEXTURESPROC real_glCreateTextures;
+static void APIENTRY wrap_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+    if (gl_capture_on) {
+        gl_capture_call(966);
+        gl_capture_u32(target);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCreateTextures(target, n, textures);
+    record(966, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(textures[i]);
+        }
+    }
+}
+
+static PFNGLTEXTUREBUFFERPROC real_glTextureBuffer;
+static void APIENTRY wrap_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+    if (gl_capture_on) {
+        gl_capture_call(967);
+        gl_capture_u32(texture);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(buffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureBuffer(texture, internalformat, buffer);
+    record(967, intercept_start);
+}
+
+static PFNGLTEXTUREBUFFERRANGEPROC real_glTextureBufferRange;
+static void APIENTRY wrap_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (gl_capture_on) {
+        gl_capture_call(968);
+        gl_capture_u32(texture);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(buffer);
+        gl_capture_u64(offset);
+        gl_capture_u64(size);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+    record(968, intercept_start);
+}
+
+static PFNGLTEXTURESTORAGE1DPROC real_glTextureStorage1D;
+static void APIENTRY wrap_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+    if (gl_capture_on) {
+        gl_capture_call(969);
+        gl_capture_u32(texture);
+        gl_capture_u32(levels);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureStorage1D(texture, levels, internalformat, width);
+    record(969, intercept_start);
+}
+
+static PFNGLTEXTURESTORAGE2DPROC real_glTextureStorage2D;
+static void APIENTRY wrap_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(970);
+        gl_capture_u32(texture);
+        gl_capture_u32(levels);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureStorage2D(texture, levels, internalformat, width, height);
+    record(970, intercept_start);
+}
+
+static PFNGLTEXTURESTORAGE3DPROC real_glTextureStorage3D;
+static void APIENTRY wrap_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    if (gl_capture_on) {
+        gl_capture_call(971);
+        gl_capture_u32(texture);
+        gl_capture_u32(levels);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(depth);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+    record(971, intercept_start);
+}
+
+static PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC real_glTextureStorage2DMultisample;
+static void APIENTRY wrap_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    if (gl_capture_on) {
+        gl_capture_call(972);
+        gl_capture_u32(texture);
+        gl_capture_u32(samples);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(fixedsamplelocations);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+    record(972, intercept_start);
+}
+
+static PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC real_glTextureStorage3DMultisample;
+static void APIENTRY wrap_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    if (gl_capture_on) {
+        gl_capture_call(973);
+        gl_capture_u32(texture);
+        gl_capture_u32(samples);
+        gl_capture_u32(internalformat);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+        gl_capture_u32(depth);
+        gl_capture_u32(fixedsamplelocations);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+    record(973, intercept_start);
+}
+
+static PFNGLTEXTURESUBIMAGE1DPROC real_glTextureSubImage1D;
+static void APIENTRY wrap_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(974);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+    record(974, intercept_start);
+}
+
+static PFNGLTEXTURESUBIMAGE2DPROC real_glTextureSubImage2D;
+static void APIENTRY wrap_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(975);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+    record(975, intercept_start);
+}
+
+static PFNGLTEXTURESUBIMAGE3DPROC real_glTextureSubImage3D;
+static void APIENTRY wrap_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(976);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    record(976, intercept_start);
+}
+
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC real_glCompressedTextureSubImage1D;
+static void APIENTRY wrap_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(977);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+    record(977, intercept_start);
+}
+
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC real_glCompressedTextureSubImage2D;
+static void APIENTRY wrap_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(978);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+    record(978, intercept_start);
+}
+
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC real_glCompressedTextureSubImage3D;
+static void APIENTRY wrap_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(979);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    record(979, intercept_start);
+}
+
+static PFNGLCOPYTEXTURESUBIMAGE1DPROC real_glCopyTextureSubImage1D;
+static void APIENTRY wrap_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    if (gl_capture_on) {
+        gl_capture_call(980);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+        gl_capture_u32(xoffset);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+    record(980, intercept_start);
+}
+
+static PFNGLCOPYTEXTURESUBIMAGE2DPROC real_glCopyTextureSubImage2D;
+static void APIENTRY wrap_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(981);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+        gl_capture_u32(xoffset);
+        gl_capture_u32(yoffset);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+    record(981, intercept_start);
+}
+
+static PFNGLCOPYTEXTURESUBIMAGE3DPROC real_glCopyTextureSubImage3D;
+static void APIENTRY wrap_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (gl_capture_on) {
+        gl_capture_call(982);
+        gl_capture_u32(texture);
+        gl_capture_u32(level);
+        gl_capture_u32(xoffset);
+        gl_capture_u32(yoffset);
+        gl_capture_u32(zoffset);
+        gl_capture_u32(x);
+        gl_capture_u32(y);
+        gl_capture_u32(width);
+        gl_capture_u32(height);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+    record(982, intercept_start);
+}
+
+static PFNGLTEXTUREPARAMETERFPROC real_glTextureParameterf;
+static void APIENTRY wrap_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+    if (gl_capture_on) {
+        gl_capture_call(983);
+        gl_capture_u32(texture);
+        gl_capture_u32(pname);
+        gl_capture_f32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureParameterf(texture, pname, param);
+    record(983, intercept_start);
+}
+
+static PFNGLTEXTUREPARAMETERFVPROC real_glTextureParameterfv;
+static void APIENTRY wrap_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(984);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureParameterfv(texture, pname, param);
+    record(984, intercept_start);
+}
+
+static PFNGLTEXTUREPARAMETERIPROC real_glTextureParameteri;
+static void APIENTRY wrap_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+    if (gl_capture_on) {
+        gl_capture_call(985);
+        gl_capture_u32(texture);
+        gl_capture_u32(pname);
+        gl_capture_u32(param);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureParameteri(texture, pname, param);
+    record(985, intercept_start);
+}
+
+static PFNGLTEXTUREPARAMETERIIVPROC real_glTextureParameterIiv;
+static void APIENTRY wrap_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(986);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureParameterIiv(texture, pname, params);
+    record(986, intercept_start);
+}
+
+static PFNGLTEXTUREPARAMETERIUIVPROC real_glTextureParameterIuiv;
+static void APIENTRY wrap_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(987);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureParameterIuiv(texture, pname, params);
+    record(987, intercept_start);
+}
+
+static PFNGLTEXTUREPARAMETERIVPROC real_glTextureParameteriv;
+static void APIENTRY wrap_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(988);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureParameteriv(texture, pname, param);
+    record(988, intercept_start);
+}
+
+static PFNGLGENERATETEXTUREMIPMAPPROC real_glGenerateTextureMipmap;
+static void APIENTRY wrap_glGenerateTextureMipmap(GLuint texture) {
+    if (gl_capture_on) {
+        gl_capture_call(989);
+        gl_capture_u32(texture);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glGenerateTextureMipmap(texture);
+    record(989, intercept_start);
+}
+
+static PFNGLBINDTEXTUREUNITPROC real_glBindTextureUnit;
+static void APIENTRY wrap_glBindTextureUnit(GLuint unit, GLuint texture) {
+    if (gl_capture_on) {
+        gl_capture_call(990);
+        gl_capture_u32(unit);
+        gl_capture_u32(texture);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glBindTextureUnit(unit, texture);
+    record(990, intercept_start);
+}
+
+static PFNGLGETTEXTUREIMAGEPROC real_glGetTextureImage;
+static void APIENTRY wrap_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+    record(991, intercept_start);
+}
+
+static PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC real_glGetCompressedTextureImage;
+static void APIENTRY wrap_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+    uint64_t intercept_start = now_ns();
+    real_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+    record(992, intercept_start);
+}
+
+static PFNGLGETTEXTURELEVELPARAMETERFVPROC real_glGetTextureLevelParameterfv;
+static void APIENTRY wrap_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTextureLevelParameterfv(texture, level, pname, params);
+    record(993, intercept_start);
+}
+
+static PFNGLGETTEXTURELEVELPARAMETERIVPROC real_glGetTextureLevelParameteriv;
+static void APIENTRY wrap_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTextureLevelParameteriv(texture, level, pname, params);
+    record(994, intercept_start);
+}
+
+static PFNGLGETTEXTUREPARAMETERFVPROC real_glGetTextureParameterfv;
+static void APIENTRY wrap_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTextureParameterfv(texture, pname, params);
+    record(995, intercept_start);
+}
+
+static PFNGLGETTEXTUREPARAMETERIIVPROC real_glGetTextureParameterIiv;
+static void APIENTRY wrap_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTextureParameterIiv(texture, pname, params);
+    record(996, intercept_start);
+}
+
+static PFNGLGETTEXTUREPARAMETERIUIVPROC real_glGetTextureParameterIuiv;
+static void APIENTRY wrap_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTextureParameterIuiv(texture, pname, params);
+    record(997, intercept_start);
+}
+
+static PFNGLGETTEXTUREPARAMETERIVPROC real_glGetTextureParameteriv;
+static void APIENTRY wrap_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTextureParameteriv(texture, pname, params);
+    record(998, intercept_start);
+}
+
+static PFNGLCREATEVERTEXARRAYSPROC real_glCreateVertexArrays;
+static void APIENTRY wrap_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+    if (gl_capture_on) {
+        gl_capture_call(999);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCreateVertexArrays(n, arrays);
+    record(999, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(arrays[i]);
+        }
+    }
+}
+
+static PFNGLDISABLEVERTEXARRAYATTRIBPROC real_glDisableVertexArrayAttrib;
+static void APIENTRY wrap_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    if (gl_capture_on) {
+        gl_capture_call(1000);
+        gl_capture_u32(vaobj);
+        gl_capture_u32(index);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glDisableVertexArrayAttrib(vaobj, index);
+    record(1000, intercept_start);
+}
+
+static PFNGLENABLEVERTEXARRAYATTRIBPROC real_glEnableVertexArrayAttrib;
+static void APIENTRY wrap_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    if (gl_capture_on) {
+        gl_capture_call(1001);
+        gl_capture_u32(vaobj);
+        gl_capture_u32(index);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glEnableVertexArrayAttrib(vaobj, index);
+    record(1001, intercept_start);
+}
+
+static PFNGLVERTEXARRAYELEMENTBUFFERPROC real_glVertexArrayElementBuffer;
+static void APIENTRY wrap_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+    if (gl_capture_on) {
+        gl_capture_call(1002);
+        gl_capture_u32(vaobj);
+        gl_capture_u32(buffer);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexArrayElementBuffer(vaobj, buffer);
+    record(1002, intercept_start);
+}
+
+static PFNGLVERTEXARRAYVERTEXBUFFERPROC real_glVertexArrayVertexBuffer;
+static void APIENTRY wrap_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    if (gl_capture_on) {
+        gl_capture_call(1003);
+        gl_capture_u32(vaobj);
+        gl_capture_u32(bindingindex);
+        gl_capture_u32(buffer);
+        gl_capture_u64(offset);
+        gl_capture_u32(stride);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+    record(1003, intercept_start);
+}
+
+static PFNGLVERTEXARRAYVERTEXBUFFERSPROC real_glVertexArrayVertexBuffers;
+static void APIENTRY wrap_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(1004);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+    record(1004, intercept_start);
+}
+
+static PFNGLVERTEXARRAYATTRIBBINDINGPROC real_glVertexArrayAttribBinding;
+static void APIENTRY wrap_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+    if (gl_capture_on) {
+        gl_capture_call(1005);
+        gl_capture_u32(vaobj);
+        gl_capture_u32(attribindex);
+        gl_capture_u32(bindingindex);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+    record(1005, intercept_start);
+}
+
+static PFNGLVERTEXARRAYATTRIBFORMATPROC real_glVertexArrayAttribFormat;
+static void APIENTRY wrap_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    if (gl_capture_on) {
+        gl_capture_call(1006);
+        gl_capture_u32(vaobj);
+        gl_capture_u32(attribindex);
+        gl_capture_u32(size);
+        gl_capture_u32(type);
+        gl_capture_u32(normalized);
+        gl_capture_u32(relativeoffset);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+    record(1006, intercept_start);
+}
+
+static PFNGLVERTEXARRAYATTRIBIFORMATPROC real_glVertexArrayAttribIFormat;
+static void APIENTRY wrap_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if (gl_capture_on) {
+        gl_capture_call(1007);
+        gl_capture_u32(vaobj);
+        gl_capture_u32(attribindex);
+        gl_capture_u32(size);
+        gl_capture_u32(type);
+        gl_capture_u32(relativeoffset);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+    record(1007, intercept_start);
+}
+
+static PFNGLVERTEXARRAYATTRIBLFORMATPROC real_glVertexArrayAttribLFormat;
+static void APIENTRY wrap_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    if (gl_capture_on) {
+        gl_capture_call(1008);
+        gl_capture_u32(vaobj);
+        gl_capture_u32(attribindex);
+        gl_capture_u32(size);
+        gl_capture_u32(type);
+        gl_capture_u32(relativeoffset);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+    record(1008, intercept_start);
+}
+
+static PFNGLVERTEXARRAYBINDINGDIVISORPROC real_glVertexArrayBindingDivisor;
+static void APIENTRY wrap_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+    if (gl_capture_on) {
+        gl_capture_call(1009);
+        gl_capture_u32(vaobj);
+        gl_capture_u32(bindingindex);
+        gl_capture_u32(divisor);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+    record(1009, intercept_start);
+}
+
+static PFNGLGETVERTEXARRAYIVPROC real_glGetVertexArrayiv;
+static void APIENTRY wrap_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+    uint64_t intercept_start = now_ns();
+    real_glGetVertexArrayiv(vaobj, pname, param);
+    record(1010, intercept_start);
+}
+
+static PFNGLGETVERTEXARRAYINDEXEDIVPROC real_glGetVertexArrayIndexediv;
+static void APIENTRY wrap_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+    uint64_t intercept_start = now_ns();
+    real_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+    record(1011, intercept_start);
+}
+
+static PFNGLGETVERTEXARRAYINDEXED64IVPROC real_glGetVertexArrayIndexed64iv;
+static void APIENTRY wrap_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+    uint64_t intercept_start = now_ns();
+    real_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+    record(1012, intercept_start);
+}
+
+static PFNGLCREATESAMPLERSPROC real_glCreateSamplers;
+static void APIENTRY wrap_glCreateSamplers(GLsizei n, GLuint *samplers) {
+    if (gl_capture_on) {
+        gl_capture_call(1013);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCreateSamplers(n, samplers);
+    record(1013, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(samplers[i]);
+        }
+    }
+}
+
+static PFNGLCREATEPROGRAMPIPELINESPROC real_glCreateProgramPipelines;
+static void APIENTRY wrap_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+    if (gl_capture_on) {
+        gl_capture_call(1014);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCreateProgramPipelines(n, pipelines);
+    record(1014, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(pipelines[i]);
+        }
+    }
+}
+
+static PFNGLCREATEQUERIESPROC real_glCreateQueries;
+static void APIENTRY wrap_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+    if (gl_capture_on) {
+        gl_capture_call(1015);
+        gl_capture_u32(target);
+        gl_capture_u32(n);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glCreateQueries(target, n, ids);
+    record(1015, intercept_start);
+    if (gl_capture_on) {
+        for (GLsizei i = 0; i < n; i++) {
+            gl_capture_u32(ids[i]);
+        }
+    }
+}
+
+static PFNGLGETQUERYBUFFEROBJECTI64VPROC real_glGetQueryBufferObjecti64v;
+static void APIENTRY wrap_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    uint64_t intercept_start = now_ns();
+    real_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+    record(1016, intercept_start);
+}
+
+static PFNGLGETQUERYBUFFEROBJECTIVPROC real_glGetQueryBufferObjectiv;
+static void APIENTRY wrap_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    uint64_t intercept_start = now_ns();
+    real_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+    record(1017, intercept_start);
+}
+
+static PFNGLGETQUERYBUFFEROBJECTUI64VPROC real_glGetQueryBufferObjectui64v;
+static void APIENTRY wrap_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    uint64_t intercept_start = now_ns();
+    real_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+    record(1018, intercept_start);
+}
+
+static PFNGLGETQUERYBUFFEROBJECTUIVPROC real_glGetQueryBufferObjectuiv;
+static void APIENTRY wrap_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    uint64_t intercept_start = now_ns();
+    real_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+    record(1019, intercept_start);
+}
+
+static PFNGLMEMORYBARRIERBYREGIONPROC real_glMemoryBarrierByRegion;
+static void APIENTRY wrap_glMemoryBarrierByRegion(GLbitfield barriers) {
+    if (gl_capture_on) {
+        gl_capture_call(1020);
+        gl_capture_u32(barriers);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMemoryBarrierByRegion(barriers);
+    record(1020, intercept_start);
+}
+
+static PFNGLGETTEXTURESUBIMAGEPROC real_glGetTextureSubImage;
+static void APIENTRY wrap_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+    uint64_t intercept_start = now_ns();
+    real_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+    record(1021, intercept_start);
+}
+
+static PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC real_glGetCompressedTextureSubImage;
+static void APIENTRY wrap_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+    uint64_t intercept_start = now_ns();
+    real_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+    record(1022, intercept_start);
+}
+
+static PFNGLGETGRAPHICSRESETSTATUSPROC real_glGetGraphicsResetStatus;
+static GLenum APIENTRY wrap_glGetGraphicsResetStatus(void) {
+    uint64_t intercept_start = now_ns();
+    GLenum intercept_result = real_glGetGraphicsResetStatus();
+    record(1023, intercept_start);
+    return intercept_result;
+}
+
+static PFNGLGETNCOMPRESSEDTEXIMAGEPROC real_glGetnCompressedTexImage;
+static void APIENTRY wrap_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+    record(1024, intercept_start);
+}
+
+static PFNGLGETNTEXIMAGEPROC real_glGetnTexImage;
+static void APIENTRY wrap_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnTexImage(target, level, format, type, bufSize, pixels);
+    record(1025, intercept_start);
+}
+
+static PFNGLGETNUNIFORMDVPROC real_glGetnUniformdv;
+static void APIENTRY wrap_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnUniformdv(program, location, bufSize, params);
+    record(1026, intercept_start);
+}
+
+static PFNGLGETNUNIFORMFVPROC real_glGetnUniformfv;
+static void APIENTRY wrap_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnUniformfv(program, location, bufSize, params);
+    record(1027, intercept_start);
+}
+
+static PFNGLGETNUNIFORMIVPROC real_glGetnUniformiv;
+static void APIENTRY wrap_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnUniformiv(program, location, bufSize, params);
+    record(1028, intercept_start);
+}
+
+static PFNGLGETNUNIFORMUIVPROC real_glGetnUniformuiv;
+static void APIENTRY wrap_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnUniformuiv(program, location, bufSize, params);
+    record(1029, intercept_start);
+}
+
+static PFNGLREADNPIXELSPROC real_glReadnPixels;
+static void APIENTRY wrap_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+    uint64_t intercept_start = now_ns();
+    real_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+    record(1030, intercept_start);
+}
+
+static PFNGLGETNMAPDVPROC real_glGetnMapdv;
+static void APIENTRY wrap_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnMapdv(target, query, bufSize, v);
+    record(1031, intercept_start);
+}
+
+static PFNGLGETNMAPFVPROC real_glGetnMapfv;
+static void APIENTRY wrap_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnMapfv(target, query, bufSize, v);
+    record(1032, intercept_start);
+}
+
+static PFNGLGETNMAPIVPROC real_glGetnMapiv;
+static void APIENTRY wrap_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnMapiv(target, query, bufSize, v);
+    record(1033, intercept_start);
+}
+
+static PFNGLGETNPIXELMAPFVPROC real_glGetnPixelMapfv;
+static void APIENTRY wrap_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnPixelMapfv(map, bufSize, values);
+    record(1034, intercept_start);
+}
+
+static PFNGLGETNPIXELMAPUIVPROC real_glGetnPixelMapuiv;
+static void APIENTRY wrap_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnPixelMapuiv(map, bufSize, values);
+    record(1035, intercept_start);
+}
+
+static PFNGLGETNPIXELMAPUSVPROC real_glGetnPixelMapusv;
+static void APIENTRY wrap_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnPixelMapusv(map, bufSize, values);
+    record(1036, intercept_start);
+}
+
+static PFNGLGETNPOLYGONSTIPPLEPROC real_glGetnPolygonStipple;
+static void APIENTRY wrap_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnPolygonStipple(bufSize, pattern);
+    record(1037, intercept_start);
+}
+
+static PFNGLGETNCOLORTABLEPROC real_glGetnColorTable;
+static void APIENTRY wrap_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnColorTable(target, format, type, bufSize, table);
+    record(1038, intercept_start);
+}
+
+static PFNGLGETNCONVOLUTIONFILTERPROC real_glGetnConvolutionFilter;
+static void APIENTRY wrap_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnConvolutionFilter(target, format, type, bufSize, image);
+    record(1039, intercept_start);
+}
+
+static PFNGLGETNSEPARABLEFILTERPROC real_glGetnSeparableFilter;
+static void APIENTRY wrap_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+    record(1040, intercept_start);
+}
+
+static PFNGLGETNHISTOGRAMPROC real_glGetnHistogram;
+static void APIENTRY wrap_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnHistogram(target, reset, format, type, bufSize, values);
+    record(1041, intercept_start);
+}
+
+static PFNGLGETNMINMAXPROC real_glGetnMinmax;
+static void APIENTRY wrap_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+    uint64_t intercept_start = now_ns();
+    real_glGetnMinmax(target, reset, format, type, bufSize, values);
+    record(1042, intercept_start);
+}
+
+static PFNGLTEXTUREBARRIERPROC real_glTextureBarrier;
+static void APIENTRY wrap_glTextureBarrier(void) {
+    if (gl_capture_on) {
+        gl_capture_call(1043);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glTextureBarrier();
+    record(1043, intercept_start);
+}
+
+static PFNGLSPECIALIZESHADERPROC real_glSpecializeShader;
+static void APIENTRY wrap_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) {
+    if (gl_capture_on) {
+        gl_capture_unsupported(1044);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+    record(1044, intercept_start);
+}
+
+static PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC real_glMultiDrawArraysIndirectCount;
+static void APIENTRY wrap_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    if (gl_capture_on) {
+        gl_capture_call(1045);
+        gl_capture_u32(mode);
+        gl_capture_u64((uint64_t)(uintptr_t)indirect);
+        gl_capture_u64(drawcount);
+        gl_capture_u32(maxdrawcount);
+        gl_capture_u32(stride);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+    record(1045, intercept_start);
+}
+
+static PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC real_glMultiDrawElementsIndirectCount;
+static void APIENTRY wrap_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    if (gl_capture_on) {
+        gl_capture_call(1046);
+        gl_capture_u32(mode);
+        gl_capture_u32(type);
+        gl_capture_u64((uint64_t)(uintptr_t)indirect);
+        gl_capture_u64(drawcount);
+        gl_capture_u32(maxdrawcount);
+        gl_capture_u32(stride);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+    record(1046, intercept_start);
+}
+
+static PFNGLPOLYGONOFFSETCLAMPPROC real_glPolygonOffsetClamp;
+static void APIENTRY wrap_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+    if (gl_capture_on) {
+        gl_capture_call(1047);
+        gl_capture_f32(factor);
+        gl_capture_f32(units);
+        gl_capture_f32(clamp);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glPolygonOffsetClamp(factor, units, clamp);
+    record(1047, intercept_start);
+}
+
+static PFNGLMAXSHADERCOMPILERTHREADSKHRPROC real_glMaxShaderCompilerThreadsKHR;
+static void APIENTRY wrap_glMaxShaderCompilerThreadsKHR(GLuint count) {
+    if (gl_capture_on) {
+        gl_capture_call(1048);
+        gl_capture_u32(count);
+    }
+    uint64_t intercept_start = now_ns();
+    real_glMaxShaderCompilerThreadsKHR(count);
+    record(1048, intercept_start);
+}
+
+// glGetIntegerv without the wrapper, for the capture's own state queries
+void gl_intercept_get_integerv(GLenum pname, GLint* data) {
+    (glad_glGetIntegerv == wrap_glGetIntegerv ? real_glGetIntegerv : glad_glGetIntegerv)(pname, data);
+}
+
+// -- Pointer table -- //
+int gl_intercept_swap(int install) {
+    int swapped = 0;
+    if (install) {
+        if (glad_glCullFace && glad_glCullFace != wrap_glCullFace) { real_glCullFace = glad_glCullFace; glad_glCullFace = wrap_glCullFace; swapped++; }
+        if (glad_glFrontFace && glad_glFrontFace != wrap_glFrontFace) { real_glFrontFace = glad_glFrontFace; glad_glFrontFace = wrap_glFrontFace; swapped++; }
+        if (glad_glHint && glad_glHint != wrap_glHint) { real_glHint = glad_glHint; glad_glHint = wrap_glHint; swapped++; }
+        if (glad_glLineWidth && glad_glLineWidth != wrap_glLineWidth) { real_glLineWidth = glad_glLineWidth; glad_glLineWidth = wrap_glLineWidth; swapped++; }
+        if (glad_glPointSize && glad_glPointSize != wrap_glPointSize) { real_glPointSize = glad_glPointSize; glad_glPointSize = wrap_glPointSize; swapped++; }
+        if (glad_glPolygonMode && glad_glPolygonMode != wrap_glPolygonMode) { real_glPolygonMode = glad_glPolygonMode; glad_glPolygonMode = wrap_glPolygonMode; swapped++; }
+        if (glad_glScissor && glad_glScissor != wrap_glScissor) { real_glScissor = glad_glScissor; glad_glScissor = wrap_glScissor; swapped++; }
+        if (glad_glTexParameterf && glad_glTexParameterf != wrap_glTexParameterf) { real_glTexParameterf = glad_glTexParameterf; glad_glTexParameterf = wrap_glTexParameterf; swapped++; }
+        if (glad_glTexParameterfv && glad_glTexParameterfv != wrap_glTexParameterfv) { real_glTexParameterfv = glad_glTexParameterfv; glad_glTexParameterfv = wrap_glTexParameterfv; swapped++; }
+        if (glad_glTexParameteri && glad_glTexParameteri != wrap_glTexParameteri) { real_glTexParameteri = glad_glTexParameteri; glad_glTexParameteri = wrap_glTexParameteri; swapped++; }
+        if (glad_glTexParameteriv && glad_glTexParameteriv != wrap_glTexParameteriv) { real_glTexParameteriv = glad_glTexParameteriv; glad_glTexParameteriv = wrap_glTexParameteriv; swapped++; }
+        if (glad_glTexImage1D && glad_glTexImage1D != wrap_glTexImage1D) { real_glTexImage1D = glad_glTexImage1D; glad_glTexImage1D = wrap_glTexImage1D; swapped++; }
+        if (glad_glTexImage2D && glad_glTexImage2D != wrap_glTexImage2D) { real_glTexImage2D = glad_glTexImage2D; glad_glTexImage2D = wrap_glTexImage2D; swapped++; }
+        if (glad_glDrawBuffer && glad_glDrawBuffer != wrap_glDrawBuffer) { real_glDrawBuffer = glad_glDrawBuffer; glad_glDrawBuffer = wrap_glDrawBuffer; swapped++; }
+        if (glad_glClear && glad_glClear != wrap_glClear) { real_glClear = glad_glClear; glad_glClear = wrap_glClear; swapped++; }
+        if (glad_glClearColor && glad_glClearColor != wrap_glClearColor) { real_glClearColor = glad_glClearColor; glad_glClearColor = wrap_glClearColor; swapped++; }
+        if (glad_glClearStencil && glad_glClearStencil != wrap_glClearStencil) { real_glClearStencil = glad_glClearStencil; glad_glClearStencil = wrap_glClearStencil; swapped++; }
+        if (glad_glClearDepth && glad_glClearDepth != wrap_glClearDepth) { real_glClearDepth = glad_glClearDepth; glad_glClearDepth = wrap_glClearDepth; swapped++; }
+        if (glad_glStencilMask && glad_glStencilMask != wrap_glStencilMask) { real_glStencilMask = glad_glStencilMask; glad_glStencilMask = wrap_glStencilMask; swapped++; }
+        if (glad_glColorMask && glad_glColorMask != wrap_glColorMask) { real_glColorMask = glad_glColorMask; glad_glColorMask = wrap_glColorMask; swapped++; }
+        if (glad_glDepthMask && glad_glDepthMask != wrap_glDepthMask) { real_glDepthMask = glad_glDepthMask; glad_glDepthMask = wrap_glDepthMask; swapped++; }
+        if (glad_glDisable && glad_glDisable != wrap_glDisable) { real_glDisable = glad_glDisable; glad_glDisable = wrap_glDisable; swapped++; }
+        if (glad_glEnable && glad_glEnable != wrap_glEnable) { real_glEnable = glad_glEnable; glad_glEnable = wrap_glEnable; swapped++; }
+        if (glad_glFinish && glad_glFinish != wrap_glFinish) { real_glFinish = glad_glFinish; glad_glFinish = wrap_glFinish; swapped++; }
+        if (glad_glFlush && glad_glFlush != wrap_glFlush) { real_glFlush = glad_glFlush; glad_glFlush = wrap_glFlush; swapped++; }
+        if (glad_glBlendFunc && glad_glBlendFunc != wrap_glBlendFunc) { real_glBlendFunc = glad_glBlendFunc; glad_glBlendFunc = wrap_glBlendFunc; swapped++; }
+        if (glad_glLogicOp && glad_glLogicOp != wrap_glLogicOp) { real_glLogicOp = glad_glLogicOp; glad_glLogicOp = wrap_glLogicOp; swapped++; }
+        if (glad_glStencilFunc && glad_glStencilFunc != wrap_glStencilFunc) { real_glStencilFunc = glad_glStencilFunc; glad_glStencilFunc = wrap_glStencilFunc; swapped++; }
+        if (glad_glStencilOp && glad_glStencilOp != wrap_glStencilOp) { real_glStencilOp = glad_glStencilOp; glad_glStencilOp = wrap_glStencilOp; swapped++; }
+        if (glad_glDepthFunc && glad_glDepthFunc != wrap_glDepthFunc) { real_glDepthFunc = glad_glDepthFunc; glad_glDepthFunc = wrap_glDepthFunc; swapped++; }
+        if (glad_glPixelStoref && glad_glPixelStoref != wrap_glPixelStoref) { real_glPixelStoref = glad_glPixelStoref; glad_glPixelStoref = wrap_glPixelStoref; swapped++; }
+        if (glad_glPixelStorei && glad_glPixelStorei != wrap_glPixelStorei) { real_glPixelStorei = glad_glPixelStorei; glad_glPixelStorei = wrap_glPixelStorei; swapped++; }
+        if (glad_glReadBuffer && glad_glReadBuffer != wrap_glReadBuffer) { real_glReadBuffer = glad_glReadBuffer; glad_glReadBuffer = wrap_glReadBuffer; swapped++; }
+        if (glad_glReadPixels && glad_glReadPixels != wrap_glReadPixels) { real_glReadPixels = glad_glReadPixels; glad_glReadPixels = wrap_glReadPixels; swapped++; }
+        if (glad_glGetBooleanv && glad_glGetBooleanv != wrap_glGetBooleanv) { real_glGetBooleanv = glad_glGetBooleanv; glad_glGetBooleanv = wrap_glGetBooleanv; swapped++; }
+        if (glad_glGetDoublev && glad_glGetDoublev != wrap_glGetDoublev) { real_glGetDoublev = glad_glGetDoublev; glad_glGetDoublev = wrap_glGetDoublev; swapped++; }
+        if (glad_glGetError && glad_glGetError != wrap_glGetError) { real_glGetError = glad_glGetError; glad_glGetError = wrap_glGetError; swapped++; }
+        if (glad_glGetFloatv && glad_glGetFloatv != wrap_glGetFloatv) { real_glGetFloatv = glad_glGetFloatv; glad_glGetFloatv = wrap_glGetFloatv; swapped++; }
+        if (glad_glGetIntegerv && glad_glGetIntegerv != wrap_glGetIntegerv) { real_glGetIntegerv = glad_glGetIntegerv; glad_glGetIntegerv = wrap_glGetIntegerv; swapped++; }
+        if (glad_glGetString && glad_glGetString != wrap_glGetString) { real_glGetString = glad_glGetString; glad_glGetString = wrap_glGetString; swapped++; }
+        if (glad_glGetTexImage && glad_glGetTexImage != wrap_glGetTexImage) { real_glGetTexImage = glad_glGetTexImage; glad_glGetTexImage = wrap_glGetTexImage; swapped++; }
+        if (glad_glGetTexParameterfv && glad_glGetTexParameterfv != wrap_glGetTexParameterfv) { real_glGetTexParameterfv = glad_glGetTexParameterfv; glad_glGetTexParameterfv = wrap_glGetTexParameterfv; swapped++; }
+        if (glad_glGetTexParameteriv && glad_glGetTexParameteriv != wrap_glGetTexParameteriv) { real_glGetTexParameteriv = glad_glGetTexParameteriv; glad_glGetTexParameteriv = wrap_glGetTexParameteriv; swapped++; }
+        if (glad_glGetTexLevelParameterfv && glad_glGetTexLevelParameterfv != wrap_glGetTexLevelParameterfv) { real_glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv; glad_glGetTexLevelParameterfv = wrap_glGetTexLevelParameterfv; swapped++; }
+        if (glad_glGetTexLevelParameteriv && glad_glGetTexLevelParameteriv != wrap_glGetTexLevelParameteriv) { real_glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv; glad_glGetTexLevelParameteriv = wrap_glGetTexLevelParameteriv; swapped++; }
+        if (glad_glIsEnabled && glad_glIsEnabled != wrap_glIsEnabled) { real_glIsEnabled = glad_glIsEnabled; glad_glIsEnabled = wrap_glIsEnabled; swapped++; }
+        if (glad_glDepthRange && glad_glDepthRange != wrap_glDepthRange) { real_glDepthRange = glad_glDepthRange; glad_glDepthRange = wrap_glDepthRange; swapped++; }
+        if (glad_glViewport && glad_glViewport != wrap_glViewport) { real_glViewport = glad_glViewport; glad_glViewport = wrap_glViewport; swapped++; }
+        if (glad_glNewList && glad_glNewList != wrap_glNewList) { real_glNewList = glad_glNewList; glad_glNewList = wrap_glNewList; swapped++; }
+        if (glad_glEndList && glad_glEndList != wrap_glEndList) { real_glEndList = glad_glEndList; glad_glEndList = wrap_glEndList; swapped++; }
+        if (glad_glCallList && glad_glCallList != wrap_glCallList) { real_glCallList = glad_glCallList; glad_glCallList = wrap_glCallList; swapped++; }
+        if (glad_glCallLists && glad_glCallLists != wrap_glCallLists) { real_glCallLists = glad_glCallLists; glad_glCallLists = wrap_glCallLists; swapped++; }
+        if (glad_glDeleteLists && glad_glDeleteLists != wrap_glDeleteLists) { real_glDeleteLists = glad_glDeleteLists; glad_glDeleteLists = wrap_glDeleteLists; swapped++; }
+        if (glad_glGenLists && glad_glGenLists != wrap_glGenLists) { real_glGenLists = glad_glGenLists; glad_glGenLists = wrap_glGenLists; swapped++; }
+        if (glad_glListBase && glad_glListBase != wrap_glListBase) { real_glListBase = glad_glListBase; glad_glListBase = wrap_glListBase; swapped++; }
+        if (glad_glBegin && glad_glBegin != wrap_glBegin) { real_glBegin = glad_glBegin; glad_glBegin = wrap_glBegin; swapped++; }
+        if (glad_glBitmap && glad_glBitmap != wrap_glBitmap) { real_glBitmap = glad_glBitmap; glad_glBitmap = wrap_glBitmap; swapped++; }
+        if (glad_glColor3b && glad_glColor3b != wrap_glColor3b) { real_glColor3b = glad_glColor3b; glad_glColor3b = wrap_glColor3b; swapped++; }
+        if (glad_glColor3bv && glad_glColor3bv != wrap_glColor3bv) { real_glColor3bv = glad_glColor3bv; glad_glColor3bv = wrap_glColor3bv; swapped++; }
+        if (glad_glColor3d && glad_glColor3d != wrap_glColor3d) { real_glColor3d = glad_glColor3d; glad_glColor3d = wrap_glColor3d; swapped++; }
+        if (glad_glColor3dv && glad_glColor3dv != wrap_glColor3dv) { real_glColor3dv = glad_glColor3dv; glad_glColor3dv = wrap_glColor3dv; swapped++; }
+        if (glad_glColor3f && glad_glColor3f != wrap_glColor3f) { real_glColor3f = glad_glColor3f; glad_glColor3f = wrap_glColor3f; swapped++; }
+        if (glad_glColor3fv && glad_glColor3fv != wrap_glColor3fv) { real_glColor3fv = glad_glColor3fv; glad_glColor3fv = wrap_glColor3fv; swapped++; }
+        if (glad_glColor3i && glad_glColor3i != wrap_glColor3i) { real_glColor3i = glad_glColor3i; glad_glColor3i = wrap_glColor3i; swapped++; }
+        if (glad_glColor3iv && glad_glColor3iv != wrap_glColor3iv) { real_glColor3iv = glad_glColor3iv; glad_glColor3iv = wrap_glColor3iv; swapped++; }
+        if (glad_glColor3s && glad_glColor3s != wrap_glColor3s) { real_glColor3s = glad_glColor3s; glad_glColor3s = wrap_glColor3s; swapped++; }
+        if (glad_glColor3sv && glad_glColor3sv != wrap_glColor3sv) { real_glColor3sv = glad_glColor3sv; glad_glColor3sv = wrap_glColor3sv; swapped++; }
+        if (glad_glColor3ub && glad_glColor3ub != wrap_glColor3ub) { real_glColor3ub = glad_glColor3ub; glad_glColor3ub = wrap_glColor3ub; swapped++; }
+        if (glad_glColor3ubv && glad_glColor3ubv != wrap_glColor3ubv) { real_glColor3ubv = glad_glColor3ubv; glad_glColor3ubv = wrap_glColor3ubv; swapped++; }
+        if (glad_glColor3ui && glad_glColor3ui != wrap_glColor3ui) { real_glColor3ui = glad_glColor3ui; glad_glColor3ui = wrap_glColor3ui; swapped++; }
+        if (glad_glColor3uiv && glad_glColor3uiv != wrap_glColor3uiv) { real_glColor3uiv = glad_glColor3uiv; glad_glColor3uiv = wrap_glColor3uiv; swapped++; }
+        if (glad_glColor3us && glad_glColor3us != wrap_glColor3us) { real_glColor3us = glad_glColor3us; glad_glColor3us = wrap_glColor3us; swapped++; }
+        if (glad_glColor3usv && glad_glColor3usv != wrap_glColor3usv) { real_glColor3usv = glad_glColor3usv; glad_glColor3usv = wrap_glColor3usv; swapped++; }
+        if (glad_glColor4b && glad_glColor4b != wrap_glColor4b) { real_glColor4b = glad_glColor4b; glad_glColor4b = wrap_glColor4b; swapped++; }
+        if (glad_glColor4bv && glad_glColor4bv != wrap_glColor4bv) { real_glColor4bv = glad_glColor4bv; glad_glColor4bv = wrap_glColor4bv; swapped++; }
+        if (glad_glColor4d && glad_glColor4d != wrap_glColor4d) { real_glColor4d = glad_glColor4d; glad_glColor4d = wrap_glColor4d; swapped++; }
+        if (glad_glColor4dv && glad_glColor4dv != wrap_glColor4dv) { real_glColor4dv = glad_glColor4dv; glad_glColor4dv = wrap_glColor4dv; swapped++; }
+        if (glad_glColor4f && glad_glColor4f != wrap_glColor4f) { real_glColor4f = glad_glColor4f; glad_glColor4f = wrap_glColor4f; swapped++; }
+        if (glad_glColor4fv && glad_glColor4fv != wrap_glColor4fv) { real_glColor4fv = glad_glColor4fv; glad_glColor4fv = wrap_glColor4fv; swapped++; }
+        if (glad_glColor4i && glad_glColor4i != wrap_glColor4i) { real_glColor4i = glad_glColor4i; glad_glColor4i = wrap_glColor4i; swapped++; }
+        if (glad_glColor4iv && glad_glColor4iv != wrap_glColor4iv) { real_glColor4iv = glad_glColor4iv; glad_glColor4iv = wrap_glColor4iv; swapped++; }
+        if (glad_glColor4s && glad_glColor4s != wrap_glColor4s) { real_glColor4s = glad_glColor4s; glad_glColor4s = wrap_glColor4s; swapped++; }
+        if (glad_glColor4sv && glad_glColor4sv != wrap_glColor4sv) { real_glColor4sv = glad_glColor4sv; glad_glColor4sv = wrap_glColor4sv; swapped++; }
+        if (glad_glColor4ub && glad_glColor4ub != wrap_glColor4ub) { real_glColor4ub = glad_glColor4ub; glad_glColor4ub = wrap_glColor4ub; swapped++; }
+        if (glad_glColor4ubv && glad_glColor4ubv != wrap_glColor4ubv) { real_glColor4ubv = glad_glColor4ubv; glad_glColor4ubv = wrap_glColor4ubv; swapped++; }
+        if (glad_glColor4ui && glad_glColor4ui != wrap_glColor4ui) { real_glColor4ui = glad_glColor4ui; glad_glColor4ui = wrap_glColor4ui; swapped++; }
+        if (glad_glColor4uiv && glad_glColor4uiv != wrap_glColor4uiv) { real_glColor4uiv = glad_glColor4uiv; glad_glColor4uiv = wrap_glColor4uiv; swapped++; }
+        if (glad_glColor4us && glad_glColor4us != wrap_glColor4us) { real_glColor4us = glad_glColor4us; glad_glColor4us = wrap_glColor4us; swapped++; }
+        if (glad_glColor4usv && glad_glColor4usv != wrap_glColor4usv) { real_glColor4usv = glad_glColor4usv; glad_glColor4usv = wrap_glColor4usv; swapped++; }
+        if (glad_glEdgeFlag && glad_glEdgeFlag != wrap_glEdgeFlag) { real_glEdgeFlag = glad_glEdgeFlag; glad_glEdgeFlag = wrap_glEdgeFlag; swapped++; }
+        if (glad_glEdgeFlagv && glad_glEdgeFlagv != wrap_glEdgeFlagv) { real_glEdgeFlagv = glad_glEdgeFlagv; glad_glEdgeFlagv = wrap_glEdgeFlagv; swapped++; }
+        if (glad_glEnd && glad_glEnd != wrap_glEnd) { real_glEnd = glad_glEnd; glad_glEnd = wrap_glEnd; swapped++; }
+        if (glad_glIndexd && glad_glIndexd != wrap_glIndexd) { real_glIndexd = glad_glIndexd; glad_glIndexd = wrap_glIndexd; swapped++; }
+        if (glad_glIndexdv && glad_glIndexdv != wrap_glIndexdv) { real_glIndexdv = glad_glIndexdv; glad_glIndexdv = wrap_glIndexdv; swapped++; }
+        if (glad_glIndexf && glad_glIndexf != wrap_glIndexf) { real_glIndexf = glad_glIndexf; glad_glIndexf = wrap_glIndexf; swapped++; }
+        if (glad_glIndexfv && glad_glIndexfv != wrap_glIndexfv) { real_glIndexfv = glad_glIndexfv; glad_glIndexfv = wrap_glIndexfv; swapped++; }
+        if (glad_glIndexi && glad_glIndexi != wrap_glIndexi) { real_glIndexi = glad_glIndexi; glad_glIndexi = wrap_glIndexi; swapped++; }
+        if (glad_glIndexiv && glad_glIndexiv != wrap_glIndexiv) { real_glIndexiv = glad_glIndexiv; glad_glIndexiv = wrap_glIndexiv; swapped++; }
+        if (glad_glIndexs && glad_glIndexs != wrap_glIndexs) { real_glIndexs = glad_glIndexs; glad_glIndexs = wrap_glIndexs; swapped++; }
+        if (glad_glIndexsv && glad_glIndexsv != wrap_glIndexsv) { real_glIndexsv = glad_glIndexsv; glad_glIndexsv = wrap_glIndexsv; swapped++; }
+        if (glad_glNormal3b && glad_glNormal3b != wrap_glNormal3b) { real_glNormal3b = glad_glNormal3b; glad_glNormal3b = wrap_glNormal3b; swapped++; }
+        if (glad_glNormal3bv && glad_glNormal3bv != wrap_glNormal3bv) { real_glNormal3bv = glad_glNormal3bv; glad_glNormal3bv = wrap_glNormal3bv; swapped++; }
+        if (glad_glNormal3d && glad_glNormal3d != wrap_glNormal3d) { real_glNormal3d = glad_glNormal3d; glad_glNormal3d = wrap_glNormal3d; swapped++; }
+        if (glad_glNormal3dv && glad_glNormal3dv != wrap_glNormal3dv) { real_glNormal3dv = glad_glNormal3dv; glad_glNormal3dv = wrap_glNormal3dv; swapped++; }
+        if (glad_glNormal3f && glad_glNormal3f != wrap_glNormal3f) { real_glNormal3f = glad_glNormal3f; glad_glNormal3f = wrap_glNormal3f; swapped++; }
+        if (glad_glNormal3fv && glad_glNormal3fv != wrap_glNormal3fv) { real_glNormal3fv = glad_glNormal3fv; glad_glNormal3fv = wrap_glNormal3fv; swapped++; }
+        if (glad_glNormal3i && glad_glNormal3i != wrap_glNormal3i) { real_glNormal3i = glad_glNormal3i; glad_glNormal3i = wrap_glNormal3i; swapped++; }
+        if (glad_glNormal3iv && glad_glNormal3iv != wrap_glNormal3iv) { real_glNormal3iv = glad_glNormal3iv; glad_glNormal3iv = wrap_glNormal3iv; swapped++; }
+        if (glad_glNormal3s && glad_glNormal3s != wrap_glNormal3s) { real_glNormal3s = glad_glNormal3s; glad_glNormal3s = wrap_glNormal3s; swapped++; }
+        if (glad_glNormal3sv && glad_glNormal3sv != wrap_glNormal3sv) { real_glNormal3sv = glad_glNormal3sv; glad_glNormal3sv = wrap_glNormal3sv; swapped++; }
+        if (glad_glRasterPos2d && glad_glRasterPos2d != wrap_glRasterPos2d) { real_glRasterPos2d = glad_glRasterPos2d; glad_glRasterPos2d = wrap_glRasterPos2d; swapped++; }
+        if (glad_glRasterPos2dv && glad_glRasterPos2dv != wrap_glRasterPos2dv) { real_glRasterPos2dv = glad_glRasterPos2dv; glad_glRasterPos2dv = wrap_glRasterPos2dv; swapped++; }
+        if (glad_glRasterPos2f && glad_glRasterPos2f != wrap_glRasterPos2f) { real_glRasterPos2f = glad_glRasterPos2f; glad_glRasterPos2f = wrap_glRasterPos2f; swapped++; }
+        if (glad_glRasterPos2fv && glad_glRasterPos2fv != wrap_glRasterPos2fv) { real_glRasterPos2fv = glad_glRasterPos2fv; glad_glRasterPos2fv = wrap_glRasterPos2fv; swapped++; }
+        if (glad_glRasterPos2i && glad_glRasterPos2i != wrap_glRasterPos2i) { real_glRasterPos2i = glad_glRasterPos2i; glad_glRasterPos2i = wrap_glRasterPos2i; swapped++; }
+        if (glad_glRasterPos2iv && glad_glRasterPos2iv != wrap_glRasterPos2iv) { real_glRasterPos2iv = glad_glRasterPos2iv; glad_glRasterPos2iv = wrap_glRasterPos2iv; swapped++; }
+        if (glad_glRasterPos2s && glad_glRasterPos2s != wrap_glRasterPos2s) { real_glRasterPos2s = glad_glRasterPos2s; glad_glRasterPos2s = wrap_glRasterPos2s; swapped++; }
+        if (glad_glRasterPos2sv && glad_glRasterPos2sv != wrap_glRasterPos2sv) { real_glRasterPos2sv = glad_glRasterPos2sv; glad_glRasterPos2sv = wrap_glRasterPos2sv; swapped++; }
+        if (glad_glRasterPos3d && glad_glRasterPos3d != wrap_glRasterPos3d) { real_glRasterPos3d = glad_glRasterPos3d; glad_glRasterPos3d = wrap_glRasterPos3d; swapped++; }
+        if (glad_glRasterPos3dv && glad_glRasterPos3dv != wrap_glRasterPos3dv) { real_glRasterPos3dv = glad_glRasterPos3dv; glad_glRasterPos3dv = wrap_glRasterPos3dv; swapped++; }
+        if (glad_glRasterPos3f && glad_glRasterPos3f != wrap_glRasterPos3f) { real_glRasterPos3f = glad_glRasterPos3f; glad_glRasterPos3f = wrap_glRasterPos3f; swapped++; }
+        if (glad_glRasterPos3fv && glad_glRasterPos3fv != wrap_glRasterPos3fv) { real_glRasterPos3fv = glad_glRasterPos3fv; glad_glRasterPos3fv = wrap_glRasterPos3fv; swapped++; }
+        if (glad_glRasterPos3i && glad_glRasterPos3i != wrap_glRasterPos3i) { real_glRasterPos3i = glad_glRasterPos3i; glad_glRasterPos3i = wrap_glRasterPos3i; swapped++; }
+        if (glad_glRasterPos3iv && glad_glRasterPos3iv != wrap_glRasterPos3iv) { real_glRasterPos3iv = glad_glRasterPos3iv; glad_glRasterPos3iv = wrap_glRasterPos3iv; swapped++; }
+        if (glad_glRasterPos3s && glad_glRasterPos3s != wrap_glRasterPos3s) { real_glRasterPos3s = glad_glRasterPos3s; glad_glRasterPos3s = wrap_glRasterPos3s; swapped++; }
+        if (glad_glRasterPos3sv && glad_glRasterPos3sv != wrap_glRasterPos3sv) { real_glRasterPos3sv = glad_glRasterPos3sv; glad_glRasterPos3sv = wrap_glRasterPos3sv; swapped++; }
+        if (glad_glRasterPos4d && glad_glRasterPos4d != wrap_glRasterPos4d) { real_glRasterPos4d = glad_glRasterPos4d; glad_glRasterPos4d = wrap_glRasterPos4d; swapped++; }
+        if (glad_glRasterPos4dv && glad_glRasterPos4dv != wrap_glRasterPos4dv) { real_glRasterPos4dv = glad_glRasterPos4dv; glad_glRasterPos4dv = wrap_glRasterPos4dv; swapped++; }
+        if (glad_glRasterPos4f && glad_glRasterPos4f != wrap_glRasterPos4f) { real_glRasterPos4f = glad_glRasterPos4f; glad_glRasterPos4f = wrap_glRasterPos4f; swapped++; }
+        if (glad_glRasterPos4fv && glad_glRasterPos4fv != wrap_glRasterPos4fv) { real_glRasterPos4fv = glad_glRasterPos4fv; glad_glRasterPos4fv = wrap_glRasterPos4fv; swapped++; }
+        if (glad_glRasterPos4i && glad_glRasterPos4i != wrap_glRasterPos4i) { real_glRasterPos4i = glad_glRasterPos4i; glad_glRasterPos4i = wrap_glRasterPos4i; swapped++; }
+        if (glad_glRasterPos4iv && glad_glRasterPos4iv != wrap_glRasterPos4iv) { real_glRasterPos4iv = glad_glRasterPos4iv; glad_glRasterPos4iv = wrap_glRasterPos4iv; swapped++; }
+        if (glad_glRasterPos4s && glad_glRasterPos4s != wrap_glRasterPos4s) { real_glRasterPos4s = glad_glRasterPos4s; glad_glRasterPos4s = wrap_glRasterPos4s; swapped++; }
+        if (glad_glRasterPos4sv && glad_glRasterPos4sv != wrap_glRasterPos4sv) { real_glRasterPos4sv = glad_glRasterPos4sv; glad_glRasterPos4sv = wrap_glRasterPos4sv; swapped++; }
+        if (glad_glRectd && glad_glRectd != wrap_glRectd) { real_glRectd = glad_glRectd; glad_glRectd = wrap_glRectd; swapped++; }
+        if (glad_glRectdv && glad_glRectdv != wrap_glRectdv) { real_glRectdv = glad_glRectdv; glad_glRectdv = wrap_glRectdv; swapped++; }
+        if (glad_glRectf && glad_glRectf != wrap_glRectf) { real_glRectf = glad_glRectf; glad_glRectf = wrap_glRectf; swapped++; }
+        if (glad_glRectfv && glad_glRectfv != wrap_glRectfv) { real_glRectfv = glad_glRectfv; glad_glRectfv = wrap_glRectfv; swapped++; }
+        if (glad_glRecti && glad_glRecti != wrap_glRecti) { real_glRecti = glad_glRecti; glad_glRecti = wrap_glRecti; swapped++; }
+        if (glad_glRectiv && glad_glRectiv != wrap_glRectiv) { real_glRectiv = glad_glRectiv; glad_glRectiv = wrap_glRectiv; swapped++; }
+        if (glad_glRects && glad_glRects != wrap_glRects) { real_glRects = glad_glRects; glad_glRects = wrap_glRects; swapped++; }
+        if (glad_glRectsv && glad_glRectsv != wrap_glRectsv) { real_glRectsv = glad_glRectsv; glad_glRectsv = wrap_glRectsv; swapped++; }
+        if (glad_glTexCoord1d && glad_glTexCoord1d != wrap_glTexCoord1d) { real_glTexCoord1d = glad_glTexCoord1d; glad_glTexCoord1d = wrap_glTexCoord1d; swapped++; }
+        if (glad_glTexCoord1dv && glad_glTexCoord1dv != wrap_glTexCoord1dv) { real_glTexCoord1dv = glad_glTexCoord1dv; glad_glTexCoord1dv = wrap_glTexCoord1dv; swapped++; }
+        if (glad_glTexCoord1f && glad_glTexCoord1f != wrap_glTexCoord1f) { real_glTexCoord1f = glad_glTexCoord1f; glad_glTexCoord1f = wrap_glTexCoord1f; swapped++; }
+        if (glad_glTexCoord1fv && glad_glTexCoord1fv != wrap_glTexCoord1fv) { real_glTexCoord1fv = glad_glTexCoord1fv; glad_glTexCoord1fv = wrap_glTexCoord1fv; swapped++; }
+        if (glad_glTexCoord1i && glad_glTexCoord1i != wrap_glTexCoord1i) { real_glTexCoord1i = glad_glTexCoord1i; glad_glTexCoord1i = wrap_glTexCoord1i; swapped++; }
+        if (glad_glTexCoord1iv && glad_glTexCoord1iv != wrap_glTexCoord1iv) { real_glTexCoord1iv = glad_glTexCoord1iv; glad_glTexCoord1iv = wrap_glTexCoord1iv; swapped++; }
+        if (glad_glTexCoord1s && glad_glTexCoord1s != wrap_glTexCoord1s) { real_glTexCoord1s = glad_glTexCoord1s; glad_glTexCoord1s = wrap_glTexCoord1s; swapped++; }
+        if (glad_glTexCoord1sv && glad_glTexCoord1sv != wrap_glTexCoord1sv) { real_glTexCoord1sv = glad_glTexCoord1sv; glad_glTexCoord1sv = wrap_glTexCoord1sv; swapped++; }
+        if (glad_glTexCoord2d && glad_glTexCoord2d != wrap_glTexCoord2d) { real_glTexCoord2d = glad_glTexCoord2d; glad_glTexCoord2d = wrap_glTexCoord2d; swapped++; }
+        if (glad_glTexCoord2dv && glad_glTexCoord2dv != wrap_glTexCoord2dv) { real_glTexCoord2dv = glad_glTexCoord2dv; glad_glTexCoord2dv = wrap_glTexCoord2dv; swapped++; }
+        if (glad_glTexCoord2f && glad_glTexCoord2f != wrap_glTexCoord2f) { real_glTexCoord2f = glad_glTexCoord2f; glad_glTexCoord2f = wrap_glTexCoord2f; swapped++; }
+        if (glad_glTexCoord2fv && glad_glTexCoord2fv != wrap_glTexCoord2fv) { real_glTexCoord2fv = glad_glTexCoord2fv; glad_glTexCoord2fv = wrap_glTexCoord2fv; swapped++; }
+        if (glad_glTexCoord2i && glad_glTexCoord2i != wrap_glTexCoord2i) { real_glTexCoord2i = glad_glTexCoord2i; glad_glTexCoord2i = wrap_glTexCoord2i; swapped++; }
+        if (glad_glTexCoord2iv && glad_glTexCoord2iv != wrap_glTexCoord2iv) { real_glTexCoord2iv = glad_glTexCoord2iv; glad_glTexCoord2iv = wrap_glTexCoord2iv; swapped++; }
+        if (glad_glTexCoord2s && glad_glTexCoord2s != wrap_glTexCoord2s) { real_glTexCoord2s = glad_glTexCoord2s; glad_glTexCoord2s = wrap_glTexCoord2s; swapped++; }
+        if (glad_glTexCoord2sv && glad_glTexCoord2sv != wrap_glTexCoord2sv) { real_glTexCoord2sv = glad_glTexCoord2sv; glad_glTexCoord2sv = wrap_glTexCoord2sv; swapped++; }
+        if (glad_glTexCoord3d && glad_glTexCoord3d != wrap_glTexCoord3d) { real_glTexCoord3d = glad_glTexCoord3d; glad_glTexCoord3d = wrap_glTexCoord3d; swapped++; }
+        if (glad_glTexCoord3dv && glad_glTexCoord3dv != wrap_glTexCoord3dv) { real_glTexCoord3dv = glad_glTexCoord3dv; glad_glTexCoord3dv = wrap_glTexCoord3dv; swapped++; }
+        if (glad_glTexCoord3f && glad_glTexCoord3f != wrap_glTexCoord3f) { real_glTexCoord3f = glad_glTexCoord3f; glad_glTexCoord3f = wrap_glTexCoord3f; swapped++; }
+        if (glad_glTexCoord3fv && glad_glTexCoord3fv != wrap_glTexCoord3fv) { real_glTexCoord3fv = glad_glTexCoord3fv; glad_glTexCoord3fv = wrap_glTexCoord3fv; swapped++; }
+        if (glad_glTexCoord3i && glad_glTexCoord3i != wrap_glTexCoord3i) { real_glTexCoord3i = glad_glTexCoord3i; glad_glTexCoord3i = wrap_glTexCoord3i; swapped++; }
+        if (glad_glTexCoord3iv && glad_glTexCoord3iv != wrap_glTexCoord3iv) { real_glTexCoord3iv = glad_glTexCoord3iv; glad_glTexCoord3iv = wrap_glTexCoord3iv; swapped++; }
+        if (glad_glTexCoord3s && glad_glTexCoord3s != wrap_glTexCoord3s) { real_glTexCoord3s = glad_glTexCoord3s; glad_glTexCoord3s = wrap_glTexCoord3s; swapped++; }
+        if (glad_glTexCoord3sv && glad_glTexCoord3sv != wrap_glTexCoord3sv) { real_glTexCoord3sv = glad_glTexCoord3sv; glad_glTexCoord3sv = wrap_glTexCoord3sv; swapped++; }
+        if (glad_glTexCoord4d && glad_glTexCoord4d != wrap_glTexCoord4d) { real_glTexCoord4d = glad_glTexCoord4d; glad_glTexCoord4d = wrap_glTexCoord4d; swapped++; }
+        if (glad_glTexCoord4dv && glad_glTexCoord4dv != wrap_glTexCoord4dv) { real_glTexCoord4dv = glad_glTexCoord4dv; glad_glTexCoord4dv = wrap_glTexCoord4dv; swapped++; }
+        if (glad_glTexCoord4f && glad_glTexCoord4f != wrap_glTexCoord4f) { real_glTexCoord4f = glad_glTexCoord4f; glad_glTexCoord4f = wrap_glTexCoord4f; swapped++; }
+        if (glad_glTexCoord4fv && glad_glTexCoord4fv != wrap_glTexCoord4fv) { real_glTexCoord4fv = glad_glTexCoord4fv; glad_glTexCoord4fv = wrap_glTexCoord4fv; swapped++; }
+        if (glad_glTexCoord4i && glad_glTexCoord4i != wrap_glTexCoord4i) { real_glTexCoord4i = glad_glTexCoord4i; glad_glTexCoord4i = wrap_glTexCoord4i; swapped++; }
+        if (glad_glTexCoord4iv && glad_glTexCoord4iv != wrap_glTexCoord4iv) { real_glTexCoord4iv = glad_glTexCoord4iv; glad_glTexCoord4iv = wrap_glTexCoord4iv; swapped++; }
+        if (glad_glTexCoord4s && glad_glTexCoord4s != wrap_glTexCoord4s) { real_glTexCoord4s = glad_glTexCoord4s; glad_glTexCoord4s = wrap_glTexCoord4s; swapped++; }
+        if (glad_glTexCoord4sv && glad_glTexCoord4sv != wrap_glTexCoord4sv) { real_glTexCoord4sv = glad_glTexCoord4sv; glad_glTexCoord4sv = wrap_glTexCoord4sv; swapped++; }
+        if (glad_glVertex2d && glad_glVertex2d != wrap_glVertex2d) { real_glVertex2d = glad_glVertex2d; glad_glVertex2d = wrap_glVertex2d; swapped++; }
+        if (glad_glVertex2dv && glad_glVertex2dv != wrap_glVertex2dv) { real_glVertex2dv = glad_glVertex2dv; glad_glVertex2dv = wrap_glVertex2dv; swapped++; }
+        if (glad_glVertex2f && glad_glVertex2f != wrap_glVertex2f) { real_glVertex2f = glad_glVertex2f; glad_glVertex2f = wrap_glVertex2f; swapped++; }
+        if (glad_glVertex2fv && glad_glVertex2fv != wrap_glVertex2fv) { real_glVertex2fv = glad_glVertex2fv; glad_glVertex2fv = wrap_glVertex2fv; swapped++; }
+        if (glad_glVertex2i && glad_glVertex2i != wrap_glVertex2i) { real_glVertex2i = glad_glVertex2i; glad_glVertex2i = wrap_glVertex2i; swapped++; }
+        if (glad_glVertex2iv && glad_glVertex2iv != wrap_glVertex2iv) { real_glVertex2iv = glad_glVertex2iv; glad_glVertex2iv = wrap_glVertex2iv; swapped++; }
+        if (glad_glVertex2s && glad_glVertex2s != wrap_glVertex2s) { real_glVertex2s = glad_glVertex2s; glad_glVertex2s = wrap_glVertex2s; swapped++; }
+        if (glad_glVertex2sv && glad_glVertex2sv != wrap_glVertex2sv) { real_glVertex2sv = glad_glVertex2sv; glad_glVertex2sv = wrap_glVertex2sv; swapped++; }
+        if (glad_glVertex3d && glad_glVertex3d != wrap_glVertex3d) { real_glVertex3d = glad_glVertex3d; glad_glVertex3d = wrap_glVertex3d; swapped++; }
+        if (glad_glVertex3dv && glad_glVertex3dv != wrap_glVertex3dv) { real_glVertex3dv = glad_glVertex3dv; glad_glVertex3dv = wrap_glVertex3dv; swapped++; }
+        if (glad_glVertex3f && glad_glVertex3f != wrap_glVertex3f) { real_glVertex3f = glad_glVertex3f; glad_glVertex3f = wrap_glVertex3f; swapped++; }
+        if (glad_glVertex3fv && glad_glVertex3fv != wrap_glVertex3fv) { real_glVertex3fv = glad_glVertex3fv; glad_glVertex3fv = wrap_glVertex3fv; swapped++; }
+        if (glad_glVertex3i && glad_glVertex3i != wrap_glVertex3i) { real_glVertex3i = glad_glVertex3i; glad_glVertex3i = wrap_glVertex3i; swapped++; }
+        if (glad_glVertex3iv && glad_glVertex3iv != wrap_glVertex3iv) { real_glVertex3iv = glad_glVertex3iv; glad_glVertex3iv = wrap_glVertex3iv; swapped++; }
+        if (glad_glVertex3s && glad_glVertex3s != wrap_glVertex3s) { real_glVertex3s = glad_glVertex3s; glad_glVertex3s = wrap_glVertex3s; swapped++; }
+        if (glad_glVertex3sv && glad_glVertex3sv != wrap_glVertex3sv) { real_glVertex3sv = glad_glVertex3sv; glad_glVertex3sv = wrap_glVertex3sv; swapped++; }
+        if (glad_glVertex4d && glad_glVertex4d != wrap_glVertex4d) { real_glVertex4d = glad_glVertex4d; glad_glVertex4d = wrap_glVertex4d; swapped++; }
+        if (glad_glVertex4dv && glad_glVertex4dv != wrap_glVertex4dv) { real_glVertex4dv = glad_glVertex4dv; glad_glVertex4dv = wrap_glVertex4dv; swapped++; }
+        if (glad_glVertex4f && glad_glVertex4f != wrap_glVertex4f) { real_glVertex4f = glad_glVertex4f; glad_glVertex4f = wrap_glVertex4f; swapped++; }
+        if (glad_glVertex4fv && glad_glVertex4fv != wrap_glVertex4fv) { real_glVertex4fv = glad_glVertex4fv; glad_glVertex4fv = wrap_glVertex4fv; swapped++; }
+        if (glad_glVertex4i && glad_glVertex4i != wrap_glVertex4i) { real_glVertex4i = glad_glVertex4i; glad_glVertex4i = wrap_glVertex4i; swapped++; }
+        if (glad_glVertex4iv && glad_glVertex4iv != wrap_glVertex4iv) { real_glVertex4iv = glad_glVertex4iv; glad_glVertex4iv = wrap_glVertex4iv; swapped++; }
+        if (glad_glVertex4s && glad_glVertex4s != wrap_glVertex4s) { real_glVertex4s = glad_glVertex4s; glad_glVertex4s = wrap_glVertex4s; swapped++; }
+        if (glad_glVertex4sv && glad_glVertex4sv != wrap_glVertex4sv) { real_glVertex4sv = glad_glVertex4sv; glad_glVertex4sv = wrap_glVertex4sv; swapped++; }
+        if (glad_glClipPlane && glad_glClipPlane != wrap_glClipPlane) { real_glClipPlane = glad_glClipPlane; glad_glClipPlane = wrap_glClipPlane; swapped++; }
+        if (glad_glColorMaterial && glad_glColorMaterial != wrap_glColorMaterial) { real_glColorMaterial = glad_glColorMaterial; glad_glColorMaterial = wrap_glColorMaterial; swapped++; }
+        if (glad_glFogf && glad_glFogf != wrap_glFogf) { real_glFogf = glad_glFogf; glad_glFogf = wrap_glFogf; swapped++; }
+        if (glad_glFogfv && glad_glFogfv != wrap_glFogfv) { real_glFogfv = glad_glFogfv; glad_glFogfv = wrap_glFogfv; swapped++; }
+        if (glad_glFogi && glad_glFogi != wrap_glFogi) { real_glFogi = glad_glFogi; glad_glFogi = wrap_glFogi; swapped++; }
+        if (glad_glFogiv && glad_glFogiv != wrap_glFogiv) { real_glFogiv = glad_glFogiv; glad_glFogiv = wrap_glFogiv; swapped++; }
+        if (glad_glLightf && glad_glLightf != wrap_glLightf) { real_glLightf = glad_glLightf; glad_glLightf = wrap_glLightf; swapped++; }
+        if (glad_glLightfv && glad_glLightfv != wrap_glLightfv) { real_glLightfv = glad_glLightfv; glad_glLightfv = wrap_glLightfv; swapped++; }
+        if (glad_glLighti && glad_glLighti != wrap_glLighti) { real_glLighti = glad_glLighti; glad_glLighti = wrap_glLighti; swapped++; }
+        if (glad_glLightiv && glad_glLightiv != wrap_glLightiv) { real_glLightiv = glad_glLightiv; glad_glLightiv = wrap_glLightiv; swapped++; }
+        if (glad_glLightModelf && glad_glLightModelf != wrap_glLightModelf) { real_glLightModelf = glad_glLightModelf; glad_glLightModelf = wrap_glLightModelf; swapped++; }
+        if (glad_glLightModelfv && glad_glLightModelfv != wrap_glLightModelfv) { real_glLightModelfv = glad_glLightModelfv; glad_glLightModelfv = wrap_glLightModelfv; swapped++; }
+        if (glad_glLightModeli && glad_glLightModeli != wrap_glLightModeli) { real_glLightModeli = glad_glLightModeli; glad_glLightModeli = wrap_glLightModeli; swapped++; }
+        if (glad_glLightModeliv && glad_glLightModeliv != wrap_glLightModeliv) { real_glLightModeliv = glad_glLightModeliv; glad_glLightModeliv = wrap_glLightModeliv; swapped++; }
+        if (glad_glLineStipple && glad_glLineStipple != wrap_glLineStipple) { real_glLineStipple = glad_glLineStipple; glad_glLineStipple = wrap_glLineStipple; swapped++; }
+        if (glad_glMaterialf && glad_glMaterialf != wrap_glMaterialf) { real_glMaterialf = glad_glMaterialf; glad_glMaterialf = wrap_glMaterialf; swapped++; }
+        if (glad_glMaterialfv && glad_glMaterialfv != wrap_glMaterialfv) { real_glMaterialfv = glad_glMaterialfv; glad_glMaterialfv = wrap_glMaterialfv; swapped++; }
+        if (glad_glMateriali && glad_glMateriali != wrap_glMateriali) { real_glMateriali = glad_glMateriali; glad_glMateriali = wrap_glMateriali; swapped++; }
+        if (glad_glMaterialiv && glad_glMaterialiv != wrap_glMaterialiv) { real_glMaterialiv = glad_glMaterialiv; glad_glMaterialiv = wrap_glMaterialiv; swapped++; }
+        if (glad_glPolygonStipple && glad_glPolygonStipple != wrap_glPolygonStipple) { real_glPolygonStipple = glad_glPolygonStipple; glad_glPolygonStipple = wrap_glPolygonStipple; swapped++; }
+        if (glad_glShadeModel && glad_glShadeModel != wrap_glShadeModel) { real_glShadeModel = glad_glShadeModel; glad_glShadeModel = wrap_glShadeModel; swapped++; }
+        if (glad_glTexEnvf && glad_glTexEnvf != wrap_glTexEnvf) { real_glTexEnvf = glad_glTexEnvf; glad_glTexEnvf = wrap_glTexEnvf; swapped++; }
+        if (glad_glTexEnvfv && glad_glTexEnvfv != wrap_glTexEnvfv) { real_glTexEnvfv = glad_glTexEnvfv; glad_glTexEnvfv = wrap_glTexEnvfv; swapped++; }
+        if (glad_glTexEnvi && glad_glTexEnvi != wrap_glTexEnvi) { real_glTexEnvi = glad_glTexEnvi; glad_glTexEnvi = wrap_glTexEnvi; swapped++; }
+        if (glad_glTexEnviv && glad_glTexEnviv != wrap_glTexEnviv) { real_glTexEnviv = glad_glTexEnviv; glad_glTexEnviv = wrap_glTexEnviv; swapped++; }
+        if (glad_glTexGend && glad_glTexGend != wrap_glTexGend) { real_glTexGend = glad_glTexGend; glad_glTexGend = wrap_glTexGend; swapped++; }
+        if (glad_glTexGendv && glad_glTexGendv != wrap_glTexGendv) { real_glTexGendv = glad_glTexGendv; glad_glTexGendv = wrap_glTexGendv; swapped++; }
+        if (glad_glTexGenf && glad_glTexGenf != wrap_glTexGenf) { real_glTexGenf = glad_glTexGenf; glad_glTexGenf = wrap_glTexGenf; swapped++; }
+        if (glad_glTexGenfv && glad_glTexGenfv != wrap_glTexGenfv) { real_glTexGenfv = glad_glTexGenfv; glad_glTexGenfv = wrap_glTexGenfv; swapped++; }
+        if (glad_glTexGeni && glad_glTexGeni != wrap_glTexGeni) { real_glTexGeni = glad_glTexGeni; glad_glTexGeni = wrap_glTexGeni; swapped++; }
+        if (glad_glTexGeniv && glad_glTexGeniv != wrap_glTexGeniv) { real_glTexGeniv = glad_glTexGeniv; glad_glTexGeniv = wrap_glTexGeniv; swapped++; }
+        if (glad_glFeedbackBuffer && glad_glFeedbackBuffer != wrap_glFeedbackBuffer) { real_glFeedbackBuffer = glad_glFeedbackBuffer; glad_glFeedbackBuffer = wrap_glFeedbackBuffer; swapped++; }
+        if (glad_glSelectBuffer && glad_glSelectBuffer != wrap_glSelectBuffer) { real_glSelectBuffer = glad_glSelectBuffer; glad_glSelectBuffer = wrap_glSelectBuffer; swapped++; }
+        if (glad_glRenderMode && glad_glRenderMode != wrap_glRenderMode) { real_glRenderMode = glad_glRenderMode; glad_glRenderMode = wrap_glRenderMode; swapped++; }
+        if (glad_glInitNames && glad_glInitNames != wrap_glInitNames) { real_glInitNames = glad_glInitNames; glad_glInitNames = wrap_glInitNames; swapped++; }
+        if (glad_glLoadName && glad_glLoadName != wrap_glLoadName) { real_glLoadName = glad_glLoadName; glad_glLoadName = wrap_glLoadName; swapped++; }
+        if (glad_glPassThrough && glad_glPassThrough != wrap_glPassThrough) { real_glPassThrough = glad_glPassThrough; glad_glPassThrough = wrap_glPassThrough; swapped++; }
+        if (glad_glPopName && glad_glPopName != wrap_glPopName) { real_glPopName = glad_glPopName; glad_glPopName = wrap_glPopName; swapped++; }
+        if (glad_glPushName && glad_glPushName != wrap_glPushName) { real_glPushName = glad_glPushName; glad_glPushName = wrap_glPushName; swapped++; }
+        if (glad_glClearAccum && glad_glClearAccum != wrap_glClearAccum) { real_glClearAccum = glad_glClearAccum; glad_glClearAccum = wrap_glClearAccum; swapped++; }
+        if (glad_glClearIndex && glad_glClearIndex != wrap_glClearIndex) { real_glClearIndex = glad_glClearIndex; glad_glClearIndex = wrap_glClearIndex; swapped++; }
+        if (glad_glIndexMask && glad_glIndexMask != wrap_glIndexMask) { real_glIndexMask = glad_glIndexMask; glad_glIndexMask = wrap_glIndexMask; swapped++; }
+        if (glad_glAccum && glad_glAccum != wrap_glAccum) { real_glAccum = glad_glAccum; glad_glAccum = wrap_glAccum; swapped++; }
+        if (glad_glPopAttrib && glad_glPopAttrib != wrap_glPopAttrib) { real_glPopAttrib = glad_glPopAttrib; glad_glPopAttrib = wrap_glPopAttrib; swapped++; }
+        if (glad_glPushAttrib && glad_glPushAttrib != wrap_glPushAttrib) { real_glPushAttrib = glad_glPushAttrib; glad_glPushAttrib = wrap_glPushAttrib; swapped++; }
+        if (glad_glMap1d && glad_glMap1d != wrap_glMap1d) { real_glMap1d = glad_glMap1d; glad_glMap1d = wrap_glMap1d; swapped++; }
+        if (glad_glMap1f && glad_glMap1f != wrap_glMap1f) { real_glMap1f = glad_glMap1f; glad_glMap1f = wrap_glMap1f; swapped++; }
+        if (glad_glMap2d && glad_glMap2d != wrap_glMap2d) { real_glMap2d = glad_glMap2d; glad_glMap2d = wrap_glMap2d; swapped++; }
+        if (glad_glMap2f && glad_glMap2f != wrap_glMap2f) { real_glMap2f = glad_glMap2f; glad_glMap2f = wrap_glMap2f; swapped++; }
+        if (glad_glMapGrid1d && glad_glMapGrid1d != wrap_glMapGrid1d) { real_glMapGrid1d = glad_glMapGrid1d; glad_glMapGrid1d = wrap_glMapGrid1d; swapped++; }
+        if (glad_glMapGrid1f && glad_glMapGrid1f != wrap_glMapGrid1f) { real_glMapGrid1f = glad_glMapGrid1f; glad_glMapGrid1f = wrap_glMapGrid1f; swapped++; }
+        if (glad_glMapGrid2d && glad_glMapGrid2d != wrap_glMapGrid2d) { real_glMapGrid2d = glad_glMapGrid2d; glad_glMapGrid2d = wrap_glMapGrid2d; swapped++; }
+        if (glad_glMapGrid2f && glad_glMapGrid2f != wrap_glMapGrid2f) { real_glMapGrid2f = glad_glMapGrid2f; glad_glMapGrid2f = wrap_glMapGrid2f; swapped++; }
+        if (glad_glEvalCoord1d && glad_glEvalCoord1d != wrap_glEvalCoord1d) { real_glEvalCoord1d = glad_glEvalCoord1d; glad_glEvalCoord1d = wrap_glEvalCoord1d; swapped++; }
+        if (glad_glEvalCoord1dv && glad_glEvalCoord1dv != wrap_glEvalCoord1dv) { real_glEvalCoord1dv = glad_glEvalCoord1dv; glad_glEvalCoord1dv = wrap_glEvalCoord1dv; swapped++; }
+        if (glad_glEvalCoord1f && glad_glEvalCoord1f != wrap_glEvalCoord1f) { real_glEvalCoord1f = glad_glEvalCoord1f; glad_glEvalCoord1f = wrap_glEvalCoord1f; swapped++; }
+        if (glad_glEvalCoord1fv && glad_glEvalCoord1fv != wrap_glEvalCoord1fv) { real_glEvalCoord1fv = glad_glEvalCoord1fv; glad_glEvalCoord1fv = wrap_glEvalCoord1fv; swapped++; }
+        if (glad_glEvalCoord2d && glad_glEvalCoord2d != wrap_glEvalCoord2d) { real_glEvalCoord2d = glad_glEvalCoord2d; glad_glEvalCoord2d = wrap_glEvalCoord2d; swapped++; }
+        if (glad_glEvalCoord2dv && glad_glEvalCoord2dv != wrap_glEvalCoord2dv) { real_glEvalCoord2dv = glad_glEvalCoord2dv; glad_glEvalCoord2dv = wrap_glEvalCoord2dv; swapped++; }
+        if (glad_glEvalCoord2f && glad_glEvalCoord2f != wrap_glEvalCoord2f) { real_glEvalCoord2f = glad_glEvalCoord2f; glad_glEvalCoord2f = wrap_glEvalCoord2f; swapped++; }
+        if (glad_glEvalCoord2fv && glad_glEvalCoord2fv != wrap_glEvalCoord2fv) { real_glEvalCoord2fv = glad_glEvalCoord2fv; glad_glEvalCoord2fv = wrap_glEvalCoord2fv; swapped++; }
+        if (glad_glEvalMesh1 && glad_glEvalMesh1 != wrap_glEvalMesh1) { real_glEvalMesh1 = glad_glEvalMesh1; glad_glEvalMesh1 = wrap_glEvalMesh1; swapped++; }
+        if (glad_glEvalPoint1 && glad_glEvalPoint1 != wrap_glEvalPoint1) { real_glEvalPoint1 = glad_glEvalPoint1; glad_glEvalPoint1 = wrap_glEvalPoint1; swapped++; }
+        if (glad_glEvalMesh2 && glad_glEvalMesh2 != wrap_glEvalMesh2) { real_glEvalMesh2 = glad_glEvalMesh2; glad_glEvalMesh2 = wrap_glEvalMesh2; swapped++; }
+        if (glad_glEvalPoint2 && glad_glEvalPoint2 != wrap_glEvalPoint2) { real_glEvalPoint2 = glad_glEvalPoint2; glad_glEvalPoint2 = wrap_glEvalPoint2; swapped++; }
+        if (glad_glAlphaFunc && glad_glAlphaFunc != wrap_glAlphaFunc) { real_glAlphaFunc = glad_glAlphaFunc; glad_glAlphaFunc = wrap_glAlphaFunc; swapped++; }
+        if (glad_glPixelZoom && glad_glPixelZoom != wrap_glPixelZoom) { real_glPixelZoom = glad_glPixelZoom; glad_glPixelZoom = wrap_glPixelZoom; swapped++; }
+        if (glad_glPixelTransferf && glad_glPixelTransferf != wrap_glPixelTransferf) { real_glPixelTransferf = glad_glPixelTransferf; glad_glPixelTransferf = wrap_glPixelTransferf; swapped++; }
+        if (glad_glPixelTransferi && glad_glPixelTransferi != wrap_glPixelTransferi) { real_glPixelTransferi = glad_glPixelTransferi; glad_glPixelTransferi = wrap_glPixelTransferi; swapped++; }
+        if (glad_glPixelMapfv && glad_glPixelMapfv != wrap_glPixelMapfv) { real_glPixelMapfv = glad_glPixelMapfv; glad_glPixelMapfv = wrap_glPixelMapfv; swapped++; }
+        if (glad_glPixelMapuiv && glad_glPixelMapuiv != wrap_glPixelMapuiv) { real_glPixelMapuiv = glad_glPixelMapuiv; glad_glPixelMapuiv = wrap_glPixelMapuiv; swapped++; }
+        if (glad_glPixelMapusv && glad_glPixelMapusv != wrap_glPixelMapusv) { real_glPixelMapusv = glad_glPixelMapusv; glad_glPixelMapusv = wrap_glPixelMapusv; swapped++; }
+        if (glad_glCopyPixels && glad_glCopyPixels != wrap_glCopyPixels) { real_glCopyPixels = glad_glCopyPixels; glad_glCopyPixels = wrap_glCopyPixels; swapped++; }
+        if (glad_glDrawPixels && glad_glDrawPixels != wrap_glDrawPixels) { real_glDrawPixels = glad_glDrawPixels; glad_glDrawPixels = wrap_glDrawPixels; swapped++; }
+        if (glad_glGetClipPlane && glad_glGetClipPlane != wrap_glGetClipPlane) { real_glGetClipPlane = glad_glGetClipPlane; glad_glGetClipPlane = wrap_glGetClipPlane; swapped++; }
+        if (glad_glGetLightfv && glad_glGetLightfv != wrap_glGetLightfv) { real_glGetLightfv = glad_glGetLightfv; glad_glGetLightfv = wrap_glGetLightfv; swapped++; }
+        if (glad_glGetLightiv && glad_glGetLightiv != wrap_glGetLightiv) { real_glGetLightiv = glad_glGetLightiv; glad_glGetLightiv = wrap_glGetLightiv; swapped++; }
+        if (glad_glGetMapdv && glad_glGetMapdv != wrap_glGetMapdv) { real_glGetMapdv = glad_glGetMapdv; glad_glGetMapdv = wrap_glGetMapdv; swapped++; }
+        if (glad_glGetMapfv && glad_glGetMapfv != wrap_glGetMapfv) { real_glGetMapfv = glad_glGetMapfv; glad_glGetMapfv = wrap_glGetMapfv; swapped++; }
+        if (glad_glGetMapiv && glad_glGetMapiv != wrap_glGetMapiv) { real_glGetMapiv = glad_glGetMapiv; glad_glGetMapiv = wrap_glGetMapiv; swapped++; }
+        if (glad_glGetMaterialfv && glad_glGetMaterialfv != wrap_glGetMaterialfv) { real_glGetMaterialfv = glad_glGetMaterialfv; glad_glGetMaterialfv = wrap_glGetMaterialfv; swapped++; }
+        if (glad_glGetMaterialiv && glad_glGetMaterialiv != wrap_glGetMaterialiv) { real_glGetMaterialiv = glad_glGetMaterialiv; glad_glGetMaterialiv = wrap_glGetMaterialiv; swapped++; }
+        if (glad_glGetPixelMapfv && glad_glGetPixelMapfv != wrap_glGetPixelMapfv) { real_glGetPixelMapfv = glad_glGetPixelMapfv; glad_glGetPixelMapfv = wrap_glGetPixelMapfv; swapped++; }
+        if (glad_glGetPixelMapuiv && glad_glGetPixelMapuiv != wrap_glGetPixelMapuiv) { real_glGetPixelMapuiv = glad_glGetPixelMapuiv; glad_glGetPixelMapuiv = wrap_glGetPixelMapuiv; swapped++; }
+        if (glad_glGetPixelMapusv && glad_glGetPixelMapusv != wrap_glGetPixelMapusv) { real_glGetPixelMapusv = glad_glGetPixelMapusv; glad_glGetPixelMapusv = wrap_glGetPixelMapusv; swapped++; }
+        if (glad_glGetPolygonStipple && glad_glGetPolygonStipple != wrap_glGetPolygonStipple) { real_glGetPolygonStipple = glad_glGetPolygonStipple; glad_glGetPolygonStipple = wrap_glGetPolygonStipple; swapped++; }
+        if (glad_glGetTexEnvfv && glad_glGetTexEnvfv != wrap_glGetTexEnvfv) { real_glGetTexEnvfv = glad_glGetTexEnvfv; glad_glGetTexEnvfv = wrap_glGetTexEnvfv; swapped++; }
+        if (glad_glGetTexEnviv && glad_glGetTexEnviv != wrap_glGetTexEnviv) { real_glGetTexEnviv = glad_glGetTexEnviv; glad_glGetTexEnviv = wrap_glGetTexEnviv; swapped++; }
+        if (glad_glGetTexGendv && glad_glGetTexGendv != wrap_glGetTexGendv) { real_glGetTexGendv = glad_glGetTexGendv; glad_glGetTexGendv = wrap_glGetTexGendv; swapped++; }
+        if (glad_glGetTexGenfv && glad_glGetTexGenfv != wrap_glGetTexGenfv) { real_glGetTexGenfv = glad_glGetTexGenfv; glad_glGetTexGenfv = wrap_glGetTexGenfv; swapped++; }
+        if (glad_glGetTexGeniv && glad_glGetTexGeniv != wrap_glGetTexGeniv) { real_glGetTexGeniv = glad_glGetTexGeniv; glad_glGetTexGeniv = wrap_glGetTexGeniv; swapped++; }
+        if (glad_glIsList && glad_glIsList != wrap_glIsList) { real_glIsList = glad_glIsList; glad_glIsList = wrap_glIsList; swapped++; }
+        if (glad_glFrustum && glad_glFrustum != wrap_glFrustum) { real_glFrustum = glad_glFrustum; glad_glFrustum = wrap_glFrustum; swapped++; }
+        if (glad_glLoadIdentity && glad_glLoadIdentity != wrap_glLoadIdentity) { real_glLoadIdentity = glad_glLoadIdentity; glad_glLoadIdentity = wrap_glLoadIdentity; swapped++; }
+        if (glad_glLoadMatrixf && glad_glLoadMatrixf != wrap_glLoadMatrixf) { real_glLoadMatrixf = glad_glLoadMatrixf; glad_glLoadMatrixf = wrap_glLoadMatrixf; swapped++; }
+        if (glad_glLoadMatrixd && glad_glLoadMatrixd != wrap_glLoadMatrixd) { real_glLoadMatrixd = glad_glLoadMatrixd; glad_glLoadMatrixd = wrap_glLoadMatrixd; swapped++; }
+        if (glad_glMatrixMode && glad_glMatrixMode != wrap_glMatrixMode) { real_glMatrixMode = glad_glMatrixMode; glad_glMatrixMode = wrap_glMatrixMode; swapped++; }
+        if (glad_glMultMatrixf && glad_glMultMatrixf != wrap_glMultMatrixf) { real_glMultMatrixf = glad_glMultMatrixf; glad_glMultMatrixf = wrap_glMultMatrixf; swapped++; }
+        if (glad_glMultMatrixd && glad_glMultMatrixd != wrap_glMultMatrixd) { real_glMultMatrixd = glad_glMultMatrixd; glad_glMultMatrixd = wrap_glMultMatrixd; swapped++; }
+        if (glad_glOrtho && glad_glOrtho != wrap_glOrtho) { real_glOrtho = glad_glOrtho; glad_glOrtho = wrap_glOrtho; swapped++; }
+        if (glad_glPopMatrix && glad_glPopMatrix != wrap_glPopMatrix) { real_glPopMatrix = glad_glPopMatrix; glad_glPopMatrix = wrap_glPopMatrix; swapped++; }
+        if (glad_glPushMatrix && glad_glPushMatrix != wrap_glPushMatrix) { real_glPushMatrix = glad_glPushMatrix; glad_glPushMatrix = wrap_glPushMatrix; swapped++; }
+        if (glad_glRotated && glad_glRotated != wrap_glRotated) { real_glRotated = glad_glRotated; glad_glRotated = wrap_glRotated; swapped++; }
+        if (glad_glRotatef && glad_glRotatef != wrap_glRotatef) { real_glRotatef = glad_glRotatef; glad_glRotatef = wrap_glRotatef; swapped++; }
+        if (glad_glScaled && glad_glScaled != wrap_glScaled) { real_glScaled = glad_glScaled; glad_glScaled = wrap_glScaled; swapped++; }
+        if (glad_glScalef && glad_glScalef != wrap_glScalef) { real_glScalef = glad_glScalef; glad_glScalef = wrap_glScalef; swapped++; }
+        if (glad_glTranslated && glad_glTranslated != wrap_glTranslated) { real_glTranslated = glad_glTranslated; glad_glTranslated = wrap_glTranslated; swapped++; }
+        if (glad_glTranslatef && glad_glTranslatef != wrap_glTranslatef) { real_glTranslatef = glad_glTranslatef; glad_glTranslatef = wrap_glTranslatef; swapped++; }
+        if (glad_glDrawArrays && glad_glDrawArrays != wrap_glDrawArrays) { real_glDrawArrays = glad_glDrawArrays; glad_glDrawArrays = wrap_glDrawArrays; swapped++; }
+        if (glad_glDrawElements && glad_glDrawElements != wrap_glDrawElements) { real_glDrawElements = glad_glDrawElements; glad_glDrawElements = wrap_glDrawElements; swapped++; }
+        if (glad_glGetPointerv && glad_glGetPointerv != wrap_glGetPointerv) { real_glGetPointerv = glad_glGetPointerv; glad_glGetPointerv = wrap_glGetPointerv; swapped++; }
+        if (glad_glPolygonOffset && glad_glPolygonOffset != wrap_glPolygonOffset) { real_glPolygonOffset = glad_glPolygonOffset; glad_glPolygonOffset = wrap_glPolygonOffset; swapped++; }
+        if (glad_glCopyTexImage1D && glad_glCopyTexImage1D != wrap_glCopyTexImage1D) { real_glCopyTexImage1D = glad_glCopyTexImage1D; glad_glCopyTexImage1D = wrap_glCopyTexImage1D; swapped++; }
+        if (glad_glCopyTexImage2D && glad_glCopyTexImage2D != wrap_glCopyTexImage2D) { real_glCopyTexImage2D = glad_glCopyTexImage2D; glad_glCopyTexImage2D = wrap_glCopyTexImage2D; swapped++; }
+        if (glad_glCopyTexSubImage1D && glad_glCopyTexSubImage1D != wrap_glCopyTexSubImage1D) { real_glCopyTexSubImage1D = glad_glCopyTexSubImage1D; glad_glCopyTexSubImage1D = wrap_glCopyTexSubImage1D; swapped++; }
+        if (glad_glCopyTexSubImage2D && glad_glCopyTexSubImage2D != wrap_glCopyTexSubImage2D) { real_glCopyTexSubImage2D = glad_glCopyTexSubImage2D; glad_glCopyTexSubImage2D = wrap_glCopyTexSubImage2D; swapped++; }
+        if (glad_glTexSubImage1D && glad_glTexSubImage1D != wrap_glTexSubImage1D) { real_glTexSubImage1D = glad_glTexSubImage1D; glad_glTexSubImage1D = wrap_glTexSubImage1D; swapped++; }
+        if (glad_glTexSubImage2D && glad_glTexSubImage2D != wrap_glTexSubImage2D) { real_glTexSubImage2D = glad_glTexSubImage2D; glad_glTexSubImage2D = wrap_glTexSubImage2D; swapped++; }
+        if (glad_glBindTexture && glad_glBindTexture != wrap_glBindTexture) { real_glBindTexture = glad_glBindTexture; glad_glBindTexture = wrap_glBindTexture; swapped++; }
+        if (glad_glDeleteTextures && glad_glDeleteTextures != wrap_glDeleteTextures) { real_glDeleteTextures = glad_glDeleteTextures; glad_glDeleteTextures = wrap_glDeleteTextures; swapped++; }
+        if (glad_glGenTextures && glad_glGenTextures != wrap_glGenTextures) { real_glGenTextures = glad_glGenTextures; glad_glGenTextures = wrap_glGenTextures; swapped++; }
+        if (glad_glIsTexture && glad_glIsTexture != wrap_glIsTexture) { real_glIsTexture = glad_glIsTexture; glad_glIsTexture = wrap_glIsTexture; swapped++; }
+        if (glad_glArrayElement && glad_glArrayElement != wrap_glArrayElement) { real_glArrayElement = glad_glArrayElement; glad_glArrayElement = wrap_glArrayElement; swapped++; }
+        if (glad_glColorPointer && glad_glColorPointer != wrap_glColorPointer) { real_glColorPointer = glad_glColorPointer; glad_glColorPointer = wrap_glColorPointer; swapped++; }
+        if (glad_glDisableClientState && glad_glDisableClientState != wrap_glDisableClientState) { real_glDisableClientState = glad_glDisableClientState; glad_glDisableClientState = wrap_glDisableClientState; swapped++; }
+        if (glad_glEdgeFlagPointer && glad_glEdgeFlagPointer != wrap_glEdgeFlagPointer) { real_glEdgeFlagPointer = glad_glEdgeFlagPointer; glad_glEdgeFlagPointer = wrap_glEdgeFlagPointer; swapped++; }
+        if (glad_glEnableClientState && glad_glEnableClientState != wrap_glEnableClientState) { real_glEnableClientState = glad_glEnableClientState; glad_glEnableClientState = wrap_glEnableClientState; swapped++; }
+        if (glad_glIndexPointer && glad_glIndexPointer != wrap_glIndexPointer) { real_glIndexPointer = glad_glIndexPointer; glad_glIndexPointer = wrap_glIndexPointer; swapped++; }
+        if (glad_glInterleavedArrays && glad_glInterleavedArrays != wrap_glInterleavedArrays) { real_glInterleavedArrays = glad_glInterleavedArrays; glad_glInterleavedArrays = wrap_glInterleavedArrays; swapped++; }
+        if (glad_glNormalPointer && glad_glNormalPointer != wrap_glNormalPointer) { real_glNormalPointer = glad_glNormalPointer; glad_glNormalPointer = wrap_glNormalPointer; swapped++; }
+        if (glad_glTexCoordPointer && glad_glTexCoordPointer != wrap_glTexCoordPointer) { real_glTexCoordPointer = glad_glTexCoordPointer; glad_glTexCoordPointer = wrap_glTexCoordPointer; swapped++; }
+        if (glad_glVertexPointer && glad_glVertexPointer != wrap_glVertexPointer) { real_glVertexPointer = glad_glVertexPointer; glad_glVertexPointer = wrap_glVertexPointer; swapped++; }
+        if (glad_glAreTexturesResident && glad_glAreTexturesResident != wrap_glAreTexturesResident) { real_glAreTexturesResident = glad_glAreTexturesResident; glad_glAreTexturesResident = wrap_glAreTexturesResident; swapped++; }
+        if (glad_glPrioritizeTextures && glad_glPrioritizeTextures != wrap_glPrioritizeTextures) { real_glPrioritizeTextures = glad_glPrioritizeTextures; glad_glPrioritizeTextures = wrap_glPrioritizeTextures; swapped++; }
+        if (glad_glIndexub && glad_glIndexub != wrap_glIndexub) { real_glIndexub = glad_glIndexub; glad_glIndexub = wrap_glIndexub; swapped++; }
+        if (glad_glIndexubv && glad_glIndexubv != wrap_glIndexubv) { real_glIndexubv = glad_glIndexubv; glad_glIndexubv = wrap_glIndexubv; swapped++; }
+        if (glad_glPopClientAttrib && glad_glPopClientAttrib != wrap_glPopClientAttrib) { real_glPopClientAttrib = glad_glPopClientAttrib; glad_glPopClientAttrib = wrap_glPopClientAttrib; swapped++; }
+        if (glad_glPushClientAttrib && glad_glPushClientAttrib != wrap_glPushClientAttrib) { real_glPushClientAttrib = glad_glPushClientAttrib; glad_glPushClientAttrib = wrap_glPushClientAttrib; swapped++; }
+        if (glad_glDrawRangeElements && glad_glDrawRangeElements != wrap_glDrawRangeElements) { real_glDrawRangeElements = glad_glDrawRangeElements; glad_glDrawRangeElements = wrap_glDrawRangeElements; swapped++; }
+        if (glad_glTexImage3D && glad_glTexImage3D != wrap_glTexImage3D) { real_glTexImage3D = glad_glTexImage3D; glad_glTexImage3D = wrap_glTexImage3D; swapped++; }
+        if (glad_glTexSubImage3D && glad_glTexSubImage3D != wrap_glTexSubImage3D) { real_glTexSubImage3D = glad_glTexSubImage3D; glad_glTexSubImage3D = wrap_glTexSubImage3D; swapped++; }
+        if (glad_glCopyTexSubImage3D && glad_glCopyTexSubImage3D != wrap_glCopyTexSubImage3D) { real_glCopyTexSubImage3D = glad_glCopyTexSubImage3D; glad_glCopyTexSubImage3D = wrap_glCopyTexSubImage3D; swapped++; }
+        if (glad_glActiveTexture && glad_glActiveTexture != wrap_glActiveTexture) { real_glActiveTexture = glad_glActiveTexture; glad_glActiveTexture = wrap_glActiveTexture; swapped++; }
+        if (glad_glSampleCoverage && glad_glSampleCoverage != wrap_glSampleCoverage) { real_glSampleCoverage = glad_glSampleCoverage; glad_glSampleCoverage = wrap_glSampleCoverage; swapped++; }
+        if (glad_glCompressedTexImage3D && glad_glCompressedTexImage3D != wrap_glCompressedTexImage3D) { real_glCompressedTexImage3D = glad_glCompressedTexImage3D; glad_glCompressedTexImage3D = wrap_glCompressedTexImage3D; swapped++; }
+        if (glad_glCompressedTexImage2D && glad_glCompressedTexImage2D != wrap_glCompressedTexImage2D) { real_glCompressedTexImage2D = glad_glCompressedTexImage2D; glad_glCompressedTexImage2D = wrap_glCompressedTexImage2D; swapped++; }
+        if (glad_glCompressedTexImage1D && glad_glCompressedTexImage1D != wrap_glCompressedTexImage1D) { real_glCompressedTexImage1D = glad_glCompressedTexImage1D; glad_glCompressedTexImage1D = wrap_glCompressedTexImage1D; swapped++; }
+        if (glad_glCompressedTexSubImage3D && glad_glCompressedTexSubImage3D != wrap_glCompressedTexSubImage3D) { real_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D; glad_glCompressedTexSubImage3D = wrap_glCompressedTexSubImage3D; swapped++; }
+        if (glad_glCompressedTexSubImage2D && glad_glCompressedTexSubImage2D != wrap_glCompressedTexSubImage2D) { real_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D; glad_glCompressedTexSubImage2D = wrap_glCompressedTexSubImage2D; swapped++; }
+        if (glad_glCompressedTexSubImage1D && glad_glCompressedTexSubImage1D != wrap_glCompressedTexSubImage1D) { real_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D; glad_glCompressedTexSubImage1D = wrap_glCompressedTexSubImage1D; swapped++; }
+        if (glad_glGetCompressedTexImage && glad_glGetCompressedTexImage != wrap_glGetCompressedTexImage) { real_glGetCompressedTexImage = glad_glGetCompressedTexImage; glad_glGetCompressedTexImage = wrap_glGetCompressedTexImage; swapped++; }
+        if (glad_glClientActiveTexture && glad_glClientActiveTexture != wrap_glClientActiveTexture) { real_glClientActiveTexture = glad_glClientActiveTexture; glad_glClientActiveTexture = wrap_glClientActiveTexture; swapped++; }
+        if (glad_glMultiTexCoord1d && glad_glMultiTexCoord1d != wrap_glMultiTexCoord1d) { real_glMultiTexCoord1d = glad_glMultiTexCoord1d; glad_glMultiTexCoord1d = wrap_glMultiTexCoord1d; swapped++; }
+        if (glad_glMultiTexCoord1dv && glad_glMultiTexCoord1dv != wrap_glMultiTexCoord1dv) { real_glMultiTexCoord1dv = glad_glMultiTexCoord1dv; glad_glMultiTexCoord1dv = wrap_glMultiTexCoord1dv; swapped++; }
+        if (glad_glMultiTexCoord1f && glad_glMultiTexCoord1f != wrap_glMultiTexCoord1f) { real_glMultiTexCoord1f = glad_glMultiTexCoord1f; glad_glMultiTexCoord1f = wrap_glMultiTexCoord1f; swapped++; }
+        if (glad_glMultiTexCoord1fv && glad_glMultiTexCoord1fv != wrap_glMultiTexCoord1fv) { real_glMultiTexCoord1fv = glad_glMultiTexCoord1fv; glad_glMultiTexCoord1fv = wrap_glMultiTexCoord1fv; swapped++; }
+        if (glad_glMultiTexCoord1i && glad_glMultiTexCoord1i != wrap_glMultiTexCoord1i) { real_glMultiTexCoord1i = glad_glMultiTexCoord1i; glad_glMultiTexCoord1i = wrap_glMultiTexCoord1i; swapped++; }
+        if (glad_glMultiTexCoord1iv && glad_glMultiTexCoord1iv != wrap_glMultiTexCoord1iv) { real_glMultiTexCoord1iv = glad_glMultiTexCoord1iv; glad_glMultiTexCoord1iv = wrap_glMultiTexCoord1iv; swapped++; }
+        if (glad_glMultiTexCoord1s && glad_glMultiTexCoord1s != wrap_glMultiTexCoord1s) { real_glMultiTexCoord1s = glad_glMultiTexCoord1s; glad_glMultiTexCoord1s = wrap_glMultiTexCoord1s; swapped++; }
+        if (glad_glMultiTexCoord1sv && glad_glMultiTexCoord1sv != wrap_glMultiTexCoord1sv) { real_glMultiTexCoord1sv = glad_glMultiTexCoord1sv; glad_glMultiTexCoord1sv = wrap_glMultiTexCoord1sv; swapped++; }
+        if (glad_glMultiTexCoord2d && glad_glMultiTexCoord2d != wrap_glMultiTexCoord2d) { real_glMultiTexCoord2d = glad_glMultiTexCoord2d; glad_glMultiTexCoord2d = wrap_glMultiTexCoord2d; swapped++; }
+        if (glad_glMultiTexCoord2dv && glad_glMultiTexCoord2dv != wrap_glMultiTexCoord2dv) { real_glMultiTexCoord2dv = glad_glMultiTexCoord2dv; glad_glMultiTexCoord2dv = wrap_glMultiTexCoord2dv; swapped++; }
+        if (glad_glMultiTexCoord2f && glad_glMultiTexCoord2f != wrap_glMultiTexCoord2f) { real_glMultiTexCoord2f = glad_glMultiTexCoord2f; glad_glMultiTexCoord2f = wrap_glMultiTexCoord2f; swapped++; }
+        if (glad_glMultiTexCoord2fv && glad_glMultiTexCoord2fv != wrap_glMultiTexCoord2fv) { real_glMultiTexCoord2fv = glad_glMultiTexCoord2fv; glad_glMultiTexCoord2fv = wrap_glMultiTexCoord2fv; swapped++; }
+        if (glad_glMultiTexCoord2i && glad_glMultiTexCoord2i != wrap_glMultiTexCoord2i) { real_glMultiTexCoord2i = glad_glMultiTexCoord2i; glad_glMultiTexCoord2i = wrap_glMultiTexCoord2i; swapped++; }
+        if (glad_glMultiTexCoord2iv && glad_glMultiTexCoord2iv != wrap_glMultiTexCoord2iv) { real_glMultiTexCoord2iv = glad_glMultiTexCoord2iv; glad_glMultiTexCoord2iv = wrap_glMultiTexCoord2iv; swapped++; }
+        if (glad_glMultiTexCoord2s && glad_glMultiTexCoord2s != wrap_glMultiTexCoord2s) { real_glMultiTexCoord2s = glad_glMultiTexCoord2s; glad_glMultiTexCoord2s = wrap_glMultiTexCoord2s; swapped++; }
+        if (glad_glMultiTexCoord2sv && glad_glMultiTexCoord2sv != wrap_glMultiTexCoord2sv) { real_glMultiTexCoord2sv = glad_glMultiTexCoord2sv; glad_glMultiTexCoord2sv = wrap_glMultiTexCoord2sv; swapped++; }
+        if (glad_glMultiTexCoord3d && glad_glMultiTexCoord3d != wrap_glMultiTexCoord3d) { real_glMultiTexCoord3d = glad_glMultiTexCoord3d; glad_glMultiTexCoord3d = wrap_glMultiTexCoord3d; swapped++; }
+        if (glad_glMultiTexCoord3dv && glad_glMultiTexCoord3dv != wrap_glMultiTexCoord3dv) { real_glMultiTexCoord3dv = glad_glMultiTexCoord3dv; glad_glMultiTexCoord3dv = wrap_glMultiTexCoord3dv; swapped++; }
+        if (glad_glMultiTexCoord3f && glad_glMultiTexCoord3f != wrap_glMultiTexCoord3f) { real_glMultiTexCoord3f = glad_glMultiTexCoord3f; glad_glMultiTexCoord3f = wrap_glMultiTexCoord3f; swapped++; }
+        if (glad_glMultiTexCoord3fv && glad_glMultiTexCoord3fv != wrap_glMultiTexCoord3fv) { real_glMultiTexCoord3fv = glad_glMultiTexCoord3fv; glad_glMultiTexCoord3fv = wrap_glMultiTexCoord3fv; swapped++; }
+        if (glad_glMultiTexCoord3i && glad_glMultiTexCoord3i != wrap_glMultiTexCoord3i) { real_glMultiTexCoord3i = glad_glMultiTexCoord3i; glad_glMultiTexCoord3i = wrap_glMultiTexCoord3i; swapped++; }
+        if (glad_glMultiTexCoord3iv && glad_glMultiTexCoord3iv != wrap_glMultiTexCoord3iv) { real_glMultiTexCoord3iv = glad_glMultiTexCoord3iv; glad_glMultiTexCoord3iv = wrap_glMultiTexCoord3iv; swapped++; }
+        if (glad_glMultiTexCoord3s && glad_glMultiTexCoord3s != wrap_glMultiTexCoord3s) { real_glMultiTexCoord3s = glad_glMultiTexCoord3s; glad_glMultiTexCoord3s = wrap_glMultiTexCoord3s; swapped++; }
+        if (glad_glMultiTexCoord3sv && glad_glMultiTexCoord3sv != wrap_glMultiTexCoord3sv) { real_glMultiTexCoord3sv = glad_glMultiTexCoord3sv; glad_glMultiTexCoord3sv = wrap_glMultiTexCoord3sv; swapped++; }
+        if (glad_glMultiTexCoord4d && glad_glMultiTexCoord4d != wrap_glMultiTexCoord4d) { real_glMultiTexCoord4d = glad_glMultiTexCoord4d; glad_glMultiTexCoord4d = wrap_glMultiTexCoord4d; swapped++; }
+        if (glad_glMultiTexCoord4dv && glad_glMultiTexCoord4dv != wrap_glMultiTexCoord4dv) { real_glMultiTexCoord4dv = glad_glMultiTexCoord4dv; glad_glMultiTexCoord4dv = wrap_glMultiTexCoord4dv; swapped++; }
+        if (glad_glMultiTexCoord4f && glad_glMultiTexCoord4f != wrap_glMultiTexCoord4f) { real_glMultiTexCoord4f = glad_glMultiTexCoord4f; glad_glMultiTexCoord4f = wrap_glMultiTexCoord4f; swapped++; }
+        if (glad_glMultiTexCoord4fv && glad_glMultiTexCoord4fv != wrap_glMultiTexCoord4fv) { real_glMultiTexCoord4fv = glad_glMultiTexCoord4fv; glad_glMultiTexCoord4fv = wrap_glMultiTexCoord4fv; swapped++; }
+        if (glad_glMultiTexCoord4i && glad_glMultiTexCoord4i != wrap_glMultiTexCoord4i) { real_glMultiTexCoord4i = glad_glMultiTexCoord4i; glad_glMultiTexCoord4i = wrap_glMultiTexCoord4i; swapped++; }
+        if (glad_glMultiTexCoord4iv && glad_glMultiTexCoord4iv != wrap_glMultiTexCoord4iv) { real_glMultiTexCoord4iv = glad_glMultiTexCoord4iv; glad_glMultiTexCoord4iv = wrap_glMultiTexCoord4iv; swapped++; }
+        if (glad_glMultiTexCoord4s && glad_glMultiTexCoord4s != wrap_glMultiTexCoord4s) { real_glMultiTexCoord4s = glad_glMultiTexCoord4s; glad_glMultiTexCoord4s = wrap_glMultiTexCoord4s; swapped++; }
+        if (glad_glMultiTexCoord4sv && glad_glMultiTexCoord4sv != wrap_glMultiTexCoord4sv) { real_glMultiTexCoord4sv = glad_glMultiTexCoord4sv; glad_glMultiTexCoord4sv = wrap_glMultiTexCoord4sv; swapped++; }
+        if (glad_glLoadTransposeMatrixf && glad_glLoadTransposeMatrixf != wrap_glLoadTransposeMatrixf) { real_glLoadTransposeMatrixf = glad_glLoadTransposeMatrixf; glad_glLoadTransposeMatrixf = wrap_glLoadTransposeMatrixf; swapped++; }
+        if (glad_glLoadTransposeMatrixd && glad_glLoadTransposeMatrixd != wrap_glLoadTransposeMatrixd) { real_glLoadTransposeMatrixd = glad_glLoadTransposeMatrixd; glad_glLoadTransposeMatrixd = wrap_glLoadTransposeMatrixd; swapped++; }
+        if (glad_glMultTransposeMatrixf && glad_glMultTransposeMatrixf != wrap_glMultTransposeMatrixf) { real_glMultTransposeMatrixf = glad_glMultTransposeMatrixf; glad_glMultTransposeMatrixf = wrap_glMultTransposeMatrixf; swapped++; }
+        if (glad_glMultTransposeMatrixd && glad_glMultTransposeMatrixd != wrap_glMultTransposeMatrixd) { real_glMultTransposeMatrixd = glad_glMultTransposeMatrixd; glad_glMultTransposeMatrixd = wrap_glMultTransposeMatrixd; swapped++; }
+        if (glad_glBlendFuncSeparate && glad_glBlendFuncSeparate != wrap_glBlendFuncSeparate) { real_glBlendFuncSeparate = glad_glBlendFuncSeparate; glad_glBlendFuncSeparate = wrap_glBlendFuncSeparate; swapped++; }
+        if (glad_glMultiDrawArrays && glad_glMultiDrawArrays != wrap_glMultiDrawArrays) { real_glMultiDrawArrays = glad_glMultiDrawArrays; glad_glMultiDrawArrays = wrap_glMultiDrawArrays; swapped++; }
+        if (glad_glMultiDrawElements && glad_glMultiDrawElements != wrap_glMultiDrawElements) { real_glMultiDrawElements = glad_glMultiDrawElements; glad_glMultiDrawElements = wrap_glMultiDrawElements; swapped++; }
+        if (glad_glPointParameterf && glad_glPointParameterf != wrap_glPointParameterf) { real_glPointParameterf = glad_glPointParameterf; glad_glPointParameterf = wrap_glPointParameterf; swapped++; }
+        if (glad_glPointParameterfv && glad_glPointParameterfv != wrap_glPointParameterfv) { real_glPointParameterfv = glad_glPointParameterfv; glad_glPointParameterfv = wrap_glPointParameterfv; swapped++; }
+        if (glad_glPointParameteri && glad_glPointParameteri != wrap_glPointParameteri) { real_glPointParameteri = glad_glPointParameteri; glad_glPointParameteri = wrap_glPointParameteri; swapped++; }
+        if (glad_glPointParameteriv && glad_glPointParameteriv != wrap_glPointParameteriv) { real_glPointParameteriv = glad_glPointParameteriv; glad_glPointParameteriv = wrap_glPointParameteriv; swapped++; }
+        if (glad_glFogCoordf && glad_glFogCoordf != wrap_glFogCoordf) { real_glFogCoordf = glad_glFogCoordf; glad_glFogCoordf = wrap_glFogCoordf; swapped++; }
+        if (glad_glFogCoordfv && glad_glFogCoordfv != wrap_glFogCoordfv) { real_glFogCoordfv = glad_glFogCoordfv; glad_glFogCoordfv = wrap_glFogCoordfv; swapped++; }
+        if (glad_glFogCoordd && glad_glFogCoordd != wrap_glFogCoordd) { real_glFogCoordd = glad_glFogCoordd; glad_glFogCoordd = wrap_glFogCoordd; swapped++; }
+        if (glad_glFogCoorddv && glad_glFogCoorddv != wrap_glFogCoorddv) { real_glFogCoorddv = glad_glFogCoorddv; glad_glFogCoorddv = wrap_glFogCoorddv; swapped++; }
+        if (glad_glFogCoordPointer && glad_glFogCoordPointer != wrap_glFogCoordPointer) { real_glFogCoordPointer = glad_glFogCoordPointer; glad_glFogCoordPointer = wrap_glFogCoordPointer; swapped++; }
+        if (glad_glSecondaryColor3b && glad_glSecondaryColor3b != wrap_glSecondaryColor3b) { real_glSecondaryColor3b = glad_glSecondaryColor3b; glad_glSecondaryColor3b = wrap_glSecondaryColor3b; swapped++; }
+        if (glad_glSecondaryColor3bv && glad_glSecondaryColor3bv != wrap_glSecondaryColor3bv) { real_glSecondaryColor3bv = glad_glSecondaryColor3bv; glad_glSecondaryColor3bv = wrap_glSecondaryColor3bv; swapped++; }
+        if (glad_glSecondaryColor3d && glad_glSecondaryColor3d != wrap_glSecondaryColor3d) { real_glSecondaryColor3d = glad_glSecondaryColor3d; glad_glSecondaryColor3d = wrap_glSecondaryColor3d; swapped++; }
+        if (glad_glSecondaryColor3dv && glad_glSecondaryColor3dv != wrap_glSecondaryColor3dv) { real_glSecondaryColor3dv = glad_glSecondaryColor3dv; glad_glSecondaryColor3dv = wrap_glSecondaryColor3dv; swapped++; }
+        if (glad_glSecondaryColor3f && glad_glSecondaryColor3f != wrap_glSecondaryColor3f) { real_glSecondaryColor3f = glad_glSecondaryColor3f; glad_glSecondaryColor3f = wrap_glSecondaryColor3f; swapped++; }
+        if (glad_glSecondaryColor3fv && glad_glSecondaryColor3fv != wrap_glSecondaryColor3fv) { real_glSecondaryColor3fv = glad_glSecondaryColor3fv; glad_glSecondaryColor3fv = wrap_glSecondaryColor3fv; swapped++; }
+        if (glad_glSecondaryColor3i && glad_glSecondaryColor3i != wrap_glSecondaryColor3i) { real_glSecondaryColor3i = glad_glSecondaryColor3i; glad_glSecondaryColor3i = wrap_glSecondaryColor3i; swapped++; }
+        if (glad_glSecondaryColor3iv && glad_glSecondaryColor3iv != wrap_glSecondaryColor3iv) { real_glSecondaryColor3iv = glad_glSecondaryColor3iv; glad_glSecondaryColor3iv = wrap_glSecondaryColor3iv; swapped++; }
+        if (glad_glSecondaryColor3s && glad_glSecondaryColor3s != wrap_glSecondaryColor3s) { real_glSecondaryColor3s = glad_glSecondaryColor3s; glad_glSecondaryColor3s = wrap_glSecondaryColor3s; swapped++; }
+        if (glad_glSecondaryColor3sv && glad_glSecondaryColor3sv != wrap_glSecondaryColor3sv) { real_glSecondaryColor3sv = glad_glSecondaryColor3sv; glad_glSecondaryColor3sv = wrap_glSecondaryColor3sv; swapped++; }
+        if (glad_glSecondaryColor3ub && glad_glSecondaryColor3ub != wrap_glSecondaryColor3ub) { real_glSecondaryColor3ub = glad_glSecondaryColor3ub; glad_glSecondaryColor3ub = wrap_glSecondaryColor3ub; swapped++; }
+        if (glad_glSecondaryColor3ubv && glad_glSecondaryColor3ubv != wrap_glSecondaryColor3ubv) { real_glSecondaryColor3ubv = glad_glSecondaryColor3ubv; glad_glSecondaryColor3ubv = wrap_glSecondaryColor3ubv; swapped++; }
+        if (glad_glSecondaryColor3ui && glad_glSecondaryColor3ui != wrap_glSecondaryColor3ui) { real_glSecondaryColor3ui = glad_glSecondaryColor3ui; glad_glSecondaryColor3ui = wrap_glSecondaryColor3ui; swapped++; }
+        if (glad_glSecondaryColor3uiv && glad_glSecondaryColor3uiv != wrap_glSecondaryColor3uiv) { real_glSecondaryColor3uiv = glad_glSecondaryColor3uiv; glad_glSecondaryColor3uiv = wrap_glSecondaryColor3uiv; swapped++; }
+        if (glad_glSecondaryColor3us && glad_glSecondaryColor3us != wrap_glSecondaryColor3us) { real_glSecondaryColor3us = glad_glSecondaryColor3us; glad_glSecondaryColor3us = wrap_glSecondaryColor3us; swapped++; }
+        if (glad_glSecondaryColor3usv && glad_glSecondaryColor3usv != wrap_glSecondaryColor3usv) { real_glSecondaryColor3usv = glad_glSecondaryColor3usv; glad_glSecondaryColor3usv = wrap_glSecondaryColor3usv; swapped++; }
+        if (glad_glSecondaryColorPointer && glad_glSecondaryColorPointer != wrap_glSecondaryColorPointer) { real_glSecondaryColorPointer = glad_glSecondaryColorPointer; glad_glSecondaryColorPointer = wrap_glSecondaryColorPointer; swapped++; }
+        if (glad_glWindowPos2d && glad_glWindowPos2d != wrap_glWindowPos2d) { real_glWindowPos2d = glad_glWindowPos2d; glad_glWindowPos2d = wrap_glWindowPos2d; swapped++; }
+        if (glad_glWindowPos2dv && glad_glWindowPos2dv != wrap_glWindowPos2dv) { real_glWindowPos2dv = glad_glWindowPos2dv; glad_glWindowPos2dv = wrap_glWindowPos2dv; swapped++; }
+        if (glad_glWindowPos2f && glad_glWindowPos2f != wrap_glWindowPos2f) { real_glWindowPos2f = glad_glWindowPos2f; glad_glWindowPos2f = wrap_glWindowPos2f; swapped++; }
+        if (glad_glWindowPos2fv && glad_glWindowPos2fv != wrap_glWindowPos2fv) { real_glWindowPos2fv = glad_glWindowPos2fv; glad_glWindowPos2fv = wrap_glWindowPos2fv; swapped++; }
+        if (glad_glWindowPos2i && glad_glWindowPos2i != wrap_glWindowPos2i) { real_glWindowPos2i = glad_glWindowPos2i; glad_glWindowPos2i = wrap_glWindowPos2i; swapped++; }
+        if (glad_glWindowPos2iv && glad_glWindowPos2iv != wrap_glWindowPos2iv) { real_glWindowPos2iv = glad_glWindowPos2iv; glad_glWindowPos2iv = wrap_glWindowPos2iv; swapped++; }
+        if (glad_glWindowPos2s && glad_glWindowPos2s != wrap_glWindowPos2s) { real_glWindowPos2s = glad_glWindowPos2s; glad_glWindowPos2s = wrap_glWindowPos2s; swapped++; }
+        if (glad_glWindowPos2sv && glad_glWindowPos2sv != wrap_glWindowPos2sv) { real_glWindowPos2sv = glad_glWindowPos2sv; glad_glWindowPos2sv = wrap_glWindowPos2sv; swapped++; }
+        if (glad_glWindowPos3d && glad_glWindowPos3d != wrap_glWindowPos3d) { real_glWindowPos3d = glad_glWindowPos3d; glad_glWindowPos3d = wrap_glWindowPos3d; swapped++; }
+        if (glad_glWindowPos3dv && glad_glWindowPos3dv != wrap_glWindowPos3dv) { real_glWindowPos3dv = glad_glWindowPos3dv; glad_glWindowPos3dv = wrap_glWindowPos3dv; swapped++; }
+        if (glad_glWindowPos3f && glad_glWindowPos3f != wrap_glWindowPos3f) { real_glWindowPos3f = glad_glWindowPos3f; glad_glWindowPos3f = wrap_glWindowPos3f; swapped++; }
+        if (glad_glWindowPos3fv && glad_glWindowPos3fv != wrap_glWindowPos3fv) { real_glWindowPos3fv = glad_glWindowPos3fv; glad_glWindowPos3fv = wrap_glWindowPos3fv; swapped++; }
+        if (glad_glWindowPos3i && glad_glWindowPos3i != wrap_glWindowPos3i) { real_glWindowPos3i = glad_glWindowPos3i; glad_glWindowPos3i = wrap_glWindowPos3i; swapped++; }
+        if (glad_glWindowPos3iv && glad_glWindowPos3iv != wrap_glWindowPos3iv) { real_glWindowPos3iv = glad_glWindowPos3iv; glad_glWindowPos3iv = wrap_glWindowPos3iv; swapped++; }
+        if (glad_glWindowPos3s && glad_glWindowPos3s != wrap_glWindowPos3s) { real_glWindowPos3s = glad_glWindowPos3s; glad_glWindowPos3s = wrap_glWindowPos3s; swapped++; }
+        if (glad_glWindowPos3sv && glad_glWindowPos3sv != wrap_glWindowPos3sv) { real_glWindowPos3sv = glad_glWindowPos3sv; glad_glWindowPos3sv = wrap_glWindowPos3sv; swapped++; }
+        if (glad_glBlendColor && glad_glBlendColor != wrap_glBlendColor) { real_glBlendColor = glad_glBlendColor; glad_glBlendColor = wrap_glBlendColor; swapped++; }
+        if (glad_glBlendEquation && glad_glBlendEquation != wrap_glBlendEquation) { real_glBlendEquation = glad_glBlendEquation; glad_glBlendEquation = wrap_glBlendEquation; swapped++; }
+        if (glad_glGenQueries && glad_glGenQueries != wrap_glGenQueries) { real_glGenQueries = glad_glGenQueries; glad_glGenQueries = wrap_glGenQueries; swapped++; }
+        if (glad_glDeleteQueries && glad_glDeleteQueries != wrap_glDeleteQueries) { real_glDeleteQueries = glad_glDeleteQueries; glad_glDeleteQueries = wrap_glDeleteQueries; swapped++; }
+        if (glad_glIsQuery && glad_glIsQuery != wrap_glIsQuery) { real_glIsQuery = glad_glIsQuery; glad_glIsQuery = wrap_glIsQuery; swapped++; }
+        if (glad_glBeginQuery && glad_glBeginQuery != wrap_glBeginQuery) { real_glBeginQuery = glad_glBeginQuery; glad_glBeginQuery = wrap_glBeginQuery; swapped++; }
+        if (glad_glEndQuery && glad_glEndQuery != wrap_glEndQuery) { real_glEndQuery = glad_glEndQuery; glad_glEndQuery = wrap_glEndQuery; swapped++; }
+        if (glad_glGetQueryiv && glad_glGetQueryiv != wrap_glGetQueryiv) { real_glGetQueryiv = glad_glGetQueryiv; glad_glGetQueryiv = wrap_glGetQueryiv; swapped++; }
+        if (glad_glGetQueryObjectiv && glad_glGetQueryObjectiv != wrap_glGetQueryObjectiv) { real_glGetQueryObjectiv = glad_glGetQueryObjectiv; glad_glGetQueryObjectiv = wrap_glGetQueryObjectiv; swapped++; }
+        if (glad_glGetQueryObjectuiv && glad_glGetQueryObjectuiv != wrap_glGetQueryObjectuiv) { real_glGetQueryObjectuiv = glad_glGetQueryObjectuiv; glad_glGetQueryObjectuiv = wrap_glGetQueryObjectuiv; swapped++; }
+        if (glad_glBindBuffer && glad_glBindBuffer != wrap_glBindBuffer) { real_glBindBuffer = glad_glBindBuffer; glad_glBindBuffer = wrap_glBindBuffer; swapped++; }
+        if (glad_glDeleteBuffers && glad_glDeleteBuffers != wrap_glDeleteBuffers) { real_glDeleteBuffers = glad_glDeleteBuffers; glad_glDeleteBuffers = wrap_glDeleteBuffers; swapped++; }
+        if (glad_glGenBuffers && glad_glGenBuffers != wrap_glGenBuffers) { real_glGenBuffers = glad_glGenBuffers; glad_glGenBuffers = wrap_glGenBuffers; swapped++; }
+        if (glad_glIsBuffer && glad_glIsBuffer != wrap_glIsBuffer) { real_glIsBuffer = glad_glIsBuffer; glad_glIsBuffer = wrap_glIsBuffer; swapped++; }
+        if (glad_glBufferData && glad_glBufferData != wrap_glBufferData) { real_glBufferData = glad_glBufferData; glad_glBufferData = wrap_glBufferData; swapped++; }
+        if (glad_glBufferSubData && glad_glBufferSubData != wrap_glBufferSubData) { real_glBufferSubData = glad_glBufferSubData; glad_glBufferSubData = wrap_glBufferSubData; swapped++; }
+        if (glad_glGetBufferSubData && glad_glGetBufferSubData != wrap_glGetBufferSubData) { real_glGetBufferSubData = glad_glGetBufferSubData; glad_glGetBufferSubData = wrap_glGetBufferSubData; swapped++; }
+        if (glad_glMapBuffer && glad_glMapBuffer != wrap_glMapBuffer) { real_glMapBuffer = glad_glMapBuffer; glad_glMapBuffer = wrap_glMapBuffer; swapped++; }
+        if (glad_glUnmapBuffer && glad_glUnmapBuffer != wrap_glUnmapBuffer) { real_glUnmapBuffer = glad_glUnmapBuffer; glad_glUnmapBuffer = wrap_glUnmapBuffer; swapped++; }
+        if (glad_glGetBufferParameteriv && glad_glGetBufferParameteriv != wrap_glGetBufferParameteriv) { real_glGetBufferParameteriv = glad_glGetBufferParameteriv; glad_glGetBufferParameteriv = wrap_glGetBufferParameteriv; swapped++; }
+        if (glad_glGetBufferPointerv && glad_glGetBufferPointerv != wrap_glGetBufferPointerv) { real_glGetBufferPointerv = glad_glGetBufferPointerv; glad_glGetBufferPointerv = wrap_glGetBufferPointerv; swapped++; }
+        if (glad_glBlendEquationSeparate && glad_glBlendEquationSeparate != wrap_glBlendEquationSeparate) { real_glBlendEquationSeparate = glad_glBlendEquationSeparate; glad_glBlendEquationSeparate = wrap_glBlendEquationSeparate; swapped++; }
+        if (glad_glDrawBuffers && glad_glDrawBuffers != wrap_glDrawBuffers) { real_glDrawBuffers = glad_glDrawBuffers; glad_glDrawBuffers = wrap_glDrawBuffers; swapped++; }
+        if (glad_glStencilOpSeparate && glad_glStencilOpSeparate != wrap_glStencilOpSeparate) { real_glStencilOpSeparate = glad_glStencilOpSeparate; glad_glStencilOpSeparate = wrap_glStencilOpSeparate; swapped++; }
+        if (glad_glStencilFuncSeparate && glad_glStencilFuncSeparate != wrap_glStencilFuncSeparate) { real_glStencilFuncSeparate = glad_glStencilFuncSeparate; glad_glStencilFuncSeparate = wrap_glStencilFuncSeparate; swapped++; }
+        if (glad_glStencilMaskSeparate && glad_glStencilMaskSeparate != wrap_glStencilMaskSeparate) { real_glStencilMaskSeparate = glad_glStencilMaskSeparate; glad_glStencilMaskSeparate = wrap_glStencilMaskSeparate; swapped++; }
+        if (glad_glAttachShader && glad_glAttachShader != wrap_glAttachShader) { real_glAttachShader = glad_glAttachShader; glad_glAttachShader = wrap_glAttachShader; swapped++; }
+        if (glad_glBindAttribLocation && glad_glBindAttribLocation != wrap_glBindAttribLocation) { real_glBindAttribLocation = glad_glBindAttribLocation; glad_glBindAttribLocation = wrap_glBindAttribLocation; swapped++; }
+        if (glad_glCompileShader && glad_glCompileShader != wrap_glCompileShader) { real_glCompileShader = glad_glCompileShader; glad_glCompileShader = wrap_glCompileShader; swapped++; }
+        if (glad_glCreateProgram && glad_glCreateProgram != wrap_glCreateProgram) { real_glCreateProgram = glad_glCreateProgram; glad_glCreateProgram = wrap_glCreateProgram; swapped++; }
+        if (glad_glCreateShader && glad_glCreateShader != wrap_glCreateShader) { real_glCreateShader = glad_glCreateShader; glad_glCreateShader = wrap_glCreateShader; swapped++; }
+        if (glad_glDeleteProgram && glad_glDeleteProgram != wrap_glDeleteProgram) { real_glDeleteProgram = glad_glDeleteProgram; glad_glDeleteProgram = wrap_glDeleteProgram; swapped++; }
+        if (glad_glDeleteShader && glad_glDeleteShader != wrap_glDeleteShader) { real_glDeleteShader = glad_glDeleteShader; glad_glDeleteShader = wrap_glDeleteShader; swapped++; }
+        if (glad_glDetachShader && glad_glDetachShader != wrap_glDetachShader) { real_glDetachShader = glad_glDetachShader; glad_glDetachShader = wrap_glDetachShader; swapped++; }
+        if (glad_glDisableVertexAttribArray && glad_glDisableVertexAttribArray != wrap_glDisableVertexAttribArray) { real_glDisableVertexAttribArray = glad_glDisableVertexAttribArray; glad_glDisableVertexAttribArray = wrap_glDisableVertexAttribArray; swapped++; }
+        if (glad_glEnableVertexAttribArray && glad_glEnableVertexAttribArray != wrap_glEnableVertexAttribArray) { real_glEnableVertexAttribArray = glad_glEnableVertexAttribArray; glad_glEnableVertexAttribArray = wrap_glEnableVertexAttribArray; swapped++; }
+        if (glad_glGetActiveAttrib && glad_glGetActiveAttrib != wrap_glGetActiveAttrib) { real_glGetActiveAttrib = glad_glGetActiveAttrib; glad_glGetActiveAttrib = wrap_glGetActiveAttrib; swapped++; }
+        if (glad_glGetActiveUniform && glad_glGetActiveUniform != wrap_glGetActiveUniform) { real_glGetActiveUniform = glad_glGetActiveUniform; glad_glGetActiveUniform = wrap_glGetActiveUniform; swapped++; }
+        if (glad_glGetAttachedShaders && glad_glGetAttachedShaders != wrap_glGetAttachedShaders) { real_glGetAttachedShaders = glad_glGetAttachedShaders; glad_glGetAttachedShaders = wrap_glGetAttachedShaders; swapped++; }
+        if (glad_glGetAttribLocation && glad_glGetAttribLocation != wrap_glGetAttribLocation) { real_glGetAttribLocation = glad_glGetAttribLocation; glad_glGetAttribLocation = wrap_glGetAttribLocation; swapped++; }
+        if (glad_glGetProgramiv && glad_glGetProgramiv != wrap_glGetProgramiv) { real_glGetProgramiv = glad_glGetProgramiv; glad_glGetProgramiv = wrap_glGetProgramiv; swapped++; }
+        if (glad_glGetProgramInfoLog && glad_glGetProgramInfoLog != wrap_glGetProgramInfoLog) { real_glGetProgramInfoLog = glad_glGetProgramInfoLog; glad_glGetProgramInfoLog = wrap_glGetProgramInfoLog; swapped++; }
+        if (glad_glGetShaderiv && glad_glGetShaderiv != wrap_glGetShaderiv) { real_glGetShaderiv = glad_glGetShaderiv; glad_glGetShaderiv = wrap_glGetShaderiv; swapped++; }
+        if (glad_glGetShaderInfoLog && glad_glGetShaderInfoLog != wrap_glGetShaderInfoLog) { real_glGetShaderInfoLog = glad_glGetShaderInfoLog; glad_glGetShaderInfoLog = wrap_glGetShaderInfoLog; swapped++; }
+        if (glad_glGetShaderSource && glad_glGetShaderSource != wrap_glGetShaderSource) { real_glGetShaderSource = glad_glGetShaderSource; glad_glGetShaderSource = wrap_glGetShaderSource; swapped++; }
+        if (glad_glGetUniformLocation && glad_glGetUniformLocation != wrap_glGetUniformLocation) { real_glGetUniformLocation = glad_glGetUniformLocation; glad_glGetUniformLocation = wrap_glGetUniformLocation; swapped++; }
+        if (glad_glGetUniformfv && glad_glGetUniformfv != wrap_glGetUniformfv) { real_glGetUniformfv = glad_glGetUniformfv; glad_glGetUniformfv = wrap_glGetUniformfv; swapped++; }
+        if (glad_glGetUniformiv && glad_glGetUniformiv != wrap_glGetUniformiv) { real_glGetUniformiv = glad_glGetUniformiv; glad_glGetUniformiv = wrap_glGetUniformiv; swapped++; }
+        if (glad_glGetVertexAttribdv && glad_glGetVertexAttribdv != wrap_glGetVertexAttribdv) { real_glGetVertexAttribdv = glad_glGetVertexAttribdv; glad_glGetVertexAttribdv = wrap_glGetVertexAttribdv; swapped++; }
+        if (glad_glGetVertexAttribfv && glad_glGetVertexAttribfv != wrap_glGetVertexAttribfv) { real_glGetVertexAttribfv = glad_glGetVertexAttribfv; glad_glGetVertexAttribfv = wrap_glGetVertexAttribfv; swapped++; }
+        if (glad_glGetVertexAttribiv && glad_glGetVertexAttribiv != wrap_glGetVertexAttribiv) { real_glGetVertexAttribiv = glad_glGetVertexAttribiv; glad_glGetVertexAttribiv = wrap_glGetVertexAttribiv; swapped++; }
+        if (glad_glGetVertexAttribPointerv && glad_glGetVertexAttribPointerv != wrap_glGetVertexAttribPointerv) { real_glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv; glad_glGetVertexAttribPointerv = wrap_glGetVertexAttribPointerv; swapped++; }
+        if (glad_glIsProgram && glad_glIsProgram != wrap_glIsProgram) { real_glIsProgram = glad_glIsProgram; glad_glIsProgram = wrap_glIsProgram; swapped++; }
+        if (glad_glIsShader && glad_glIsShader != wrap_glIsShader) { real_glIsShader = glad_glIsShader; glad_glIsShader = wrap_glIsShader; swapped++; }
+        if (glad_glLinkProgram && glad_glLinkProgram != wrap_glLinkProgram) { real_glLinkProgram = glad_glLinkProgram; glad_glLinkProgram = wrap_glLinkProgram; swapped++; }
+        if (glad_glShaderSource && glad_glShaderSource != wrap_glShaderSource) { real_glShaderSource = glad_glShaderSource; glad_glShaderSource = wrap_glShaderSource; swapped++; }
+        if (glad_glUseProgram && glad_glUseProgram != wrap_glUseProgram) { real_glUseProgram = glad_glUseProgram; glad_glUseProgram = wrap_glUseProgram; swapped++; }
+        if (glad_glUniform1f && glad_glUniform1f != wrap_glUniform1f) { real_glUniform1f = glad_glUniform1f; glad_glUniform1f = wrap_glUniform1f; swapped++; }
+        if (glad_glUniform2f && glad_glUniform2f != wrap_glUniform2f) { real_glUniform2f = glad_glUniform2f; glad_glUniform2f = wrap_glUniform2f; swapped++; }
+        if (glad_glUniform3f && glad_glUniform3f != wrap_glUniform3f) { real_glUniform3f = glad_glUniform3f; glad_glUniform3f = wrap_glUniform3f; swapped++; }
+        if (glad_glUniform4f && glad_glUniform4f != wrap_glUniform4f) { real_glUniform4f = glad_glUniform4f; glad_glUniform4f = wrap_glUniform4f; swapped++; }
+        if (glad_glUniform1i && glad_glUniform1i != wrap_glUniform1i) { real_glUniform1i = glad_glUniform1i; glad_glUniform1i = wrap_glUniform1i; swapped++; }
+        if (glad_glUniform2i && glad_glUniform2i != wrap_glUniform2i) { real_glUniform2i = glad_glUniform2i; glad_glUniform2i = wrap_glUniform2i; swapped++; }
+        if (glad_glUniform3i && glad_glUniform3i != wrap_glUniform3i) { real_glUniform3i = glad_glUniform3i; glad_glUniform3i = wrap_glUniform3i; swapped++; }
+        if (glad_glUniform4i && glad_glUniform4i != wrap_glUniform4i) { real_glUniform4i = glad_glUniform4i; glad_glUniform4i = wrap_glUniform4i; swapped++; }
+        if (glad_glUniform1fv && glad_glUniform1fv != wrap_glUniform1fv) { real_glUniform1fv = glad_glUniform1fv; glad_glUniform1fv = wrap_glUniform1fv; swapped++; }
+        if (glad_glUniform2fv && glad_glUniform2fv != wrap_glUniform2fv) { real_glUniform2fv = glad_glUniform2fv; glad_glUniform2fv = wrap_glUniform2fv; swapped++; }
+        if (glad_glUniform3fv && glad_glUniform3fv != wrap_glUniform3fv) { real_glUniform3fv = glad_glUniform3fv; glad_glUniform3fv = wrap_glUniform3fv; swapped++; }
+        if (glad_glUniform4fv && glad_glUniform4fv != wrap_glUniform4fv) { real_glUniform4fv = glad_glUniform4fv; glad_glUniform4fv = wrap_glUniform4fv; swapped++; }
+        if (glad_glUniform1iv && glad_glUniform1iv != wrap_glUniform1iv) { real_glUniform1iv = glad_glUniform1iv; glad_glUniform1iv = wrap_glUniform1iv; swapped++; }
+        if (glad_glUniform2iv && glad_glUniform2iv != wrap_glUniform2iv) { real_glUniform2iv = glad_glUniform2iv; glad_glUniform2iv = wrap_glUniform2iv; swapped++; }
+        if (glad_glUniform3iv && glad_glUniform3iv != wrap_glUniform3iv) { real_glUniform3iv = glad_glUniform3iv; glad_glUniform3iv = wrap_glUniform3iv; swapped++; }
+        if (glad_glUniform4iv && glad_glUniform4iv != wrap_glUniform4iv) { real_glUniform4iv = glad_glUniform4iv; glad_glUniform4iv = wrap_glUniform4iv; swapped++; }
+        if (glad_glUniformMatrix2fv && glad_glUniformMatrix2fv != wrap_glUniformMatrix2fv) { real_glUniformMatrix2fv = glad_glUniformMatrix2fv; glad_glUniformMatrix2fv = wrap_glUniformMatrix2fv; swapped++; }
+        if (glad_glUniformMatrix3fv && glad_glUniformMatrix3fv != wrap_glUniformMatrix3fv) { real_glUniformMatrix3fv = glad_glUniformMatrix3fv; glad_glUniformMatrix3fv = wrap_glUniformMatrix3fv; swapped++; }
+        if (glad_glUniformMatrix4fv && glad_glUniformMatrix4fv != wrap_glUniformMatrix4fv) { real_glUniformMatrix4fv = glad_glUniformMatrix4fv; glad_glUniformMatrix4fv = wrap_glUniformMatrix4fv; swapped++; }
+        if (glad_glValidateProgram && glad_glValidateProgram != wrap_glValidateProgram) { real_glValidateProgram = glad_glValidateProgram; glad_glValidateProgram = wrap_glValidateProgram; swapped++; }
+        if (glad_glVertexAttrib1d && glad_glVertexAttrib1d != wrap_glVertexAttrib1d) { real_glVertexAttrib1d = glad_glVertexAttrib1d; glad_glVertexAttrib1d = wrap_glVertexAttrib1d; swapped++; }
+        if (glad_glVertexAttrib1dv && glad_glVertexAttrib1dv != wrap_glVertexAttrib1dv) { real_glVertexAttrib1dv = glad_glVertexAttrib1dv; glad_glVertexAttrib1dv = wrap_glVertexAttrib1dv; swapped++; }
+        if (glad_glVertexAttrib1f && glad_glVertexAttrib1f != wrap_glVertexAttrib1f) { real_glVertexAttrib1f = glad_glVertexAttrib1f; glad_glVertexAttrib1f = wrap_glVertexAttrib1f; swapped++; }
+        if (glad_glVertexAttrib1fv && glad_glVertexAttrib1fv != wrap_glVertexAttrib1fv) { real_glVertexAttrib1fv = glad_glVertexAttrib1fv; glad_glVertexAttrib1fv = wrap_glVertexAttrib1fv; swapped++; }
+        if (glad_glVertexAttrib1s && glad_glVertexAttrib1s != wrap_glVertexAttrib1s) { real_glVertexAttrib1s = glad_glVertexAttrib1s; glad_glVertexAttrib1s = wrap_glVertexAttrib1s; swapped++; }
+        if (glad_glVertexAttrib1sv && glad_glVertexAttrib1sv != wrap_glVertexAttrib1sv) { real_glVertexAttrib1sv = glad_glVertexAttrib1sv; glad_glVertexAttrib1sv = wrap_glVertexAttrib1sv; swapped++; }
+        if (glad_glVertexAttrib2d && glad_glVertexAttrib2d != wrap_glVertexAttrib2d) { real_glVertexAttrib2d = glad_glVertexAttrib2d; glad_glVertexAttrib2d = wrap_glVertexAttrib2d; swapped++; }
+        if (glad_glVertexAttrib2dv && glad_glVertexAttrib2dv != wrap_glVertexAttrib2dv) { real_glVertexAttrib2dv = glad_glVertexAttrib2dv; glad_glVertexAttrib2dv = wrap_glVertexAttrib2dv; swapped++; }
+        if (glad_glVertexAttrib2f && glad_glVertexAttrib2f != wrap_glVertexAttrib2f) { real_glVertexAttrib2f = glad_glVertexAttrib2f; glad_glVertexAttrib2f = wrap_glVertexAttrib2f; swapped++; }
+        if (glad_glVertexAttrib2fv && glad_glVertexAttrib2fv != wrap_glVertexAttrib2fv) { real_glVertexAttrib2fv = glad_glVertexAttrib2fv; glad_glVertexAttrib2fv = wrap_glVertexAttrib2fv; swapped++; }
+        if (glad_glVertexAttrib2s && glad_glVertexAttrib2s != wrap_glVertexAttrib2s) { real_glVertexAttrib2s = glad_glVertexAttrib2s; glad_glVertexAttrib2s = wrap_glVertexAttrib2s; swapped++; }
+        if (glad_glVertexAttrib2sv && glad_glVertexAttrib2sv != wrap_glVertexAttrib2sv) { real_glVertexAttrib2sv = glad_glVertexAttrib2sv; glad_glVertexAttrib2sv = wrap_glVertexAttrib2sv; swapped++; }
+        if (glad_glVertexAttrib3d && glad_glVertexAttrib3d != wrap_glVertexAttrib3d) { real_glVertexAttrib3d = glad_glVertexAttrib3d; glad_glVertexAttrib3d = wrap_glVertexAttrib3d; swapped++; }
+        if (glad_glVertexAttrib3dv && glad_glVertexAttrib3dv != wrap_glVertexAttrib3dv) { real_glVertexAttrib3dv = glad_glVertexAttrib3dv; glad_glVertexAttrib3dv = wrap_glVertexAttrib3dv; swapped++; }
+        if (glad_glVertexAttrib3f && glad_glVertexAttrib3f != wrap_glVertexAttrib3f) { real_glVertexAttrib3f = glad_glVertexAttrib3f; glad_glVertexAttrib3f = wrap_glVertexAttrib3f; swapped++; }
+        if (glad_glVertexAttrib3fv && glad_glVertexAttrib3fv != wrap_glVertexAttrib3fv) { real_glVertexAttrib3fv = glad_glVertexAttrib3fv; glad_glVertexAttrib3fv = wrap_glVertexAttrib3fv; swapped++; }
+        if (glad_glVertexAttrib3s && glad_glVertexAttrib3s != wrap_glVertexAttrib3s) { real_glVertexAttrib3s = glad_glVertexAttrib3s; glad_glVertexAttrib3s = wrap_glVertexAttrib3s; swapped++; }
+        if (glad_glVertexAttrib3sv && glad_glVertexAttrib3sv != wrap_glVertexAttrib3sv) { real_glVertexAttrib3sv = glad_glVertexAttrib3sv; glad_glVertexAttrib3sv = wrap_glVertexAttrib3sv; swapped++; }
+        if (glad_glVertexAttrib4Nbv && glad_glVertexAttrib4Nbv != wrap_glVertexAttrib4Nbv) { real_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv; glad_glVertexAttrib4Nbv = wrap_glVertexAttrib4Nbv; swapped++; }
+        if (glad_glVertexAttrib4Niv && glad_glVertexAttrib4Niv != wrap_glVertexAttrib4Niv) { real_glVertexAttrib4Niv = glad_glVertexAttrib4Niv; glad_glVertexAttrib4Niv = wrap_glVertexAttrib4Niv; swapped++; }
+        if (glad_glVertexAttrib4Nsv && glad_glVertexAttrib4Nsv != wrap_glVertexAttrib4Nsv) { real_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv; glad_glVertexAttrib4Nsv = wrap_glVertexAttrib4Nsv; swapped++; }
+        if (glad_glVertexAttrib4Nub && glad_glVertexAttrib4Nub != wrap_glVertexAttrib4Nub) { real_glVertexAttrib4Nub = glad_glVertexAttrib4Nub; glad_glVertexAttrib4Nub = wrap_glVertexAttrib4Nub; swapped++; }
+        if (glad_glVertexAttrib4Nubv && glad_glVertexAttrib4Nubv != wrap_glVertexAttrib4Nubv) { real_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv; glad_glVertexAttrib4Nubv = wrap_glVertexAttrib4Nubv; swapped++; }
+        if (glad_glVertexAttrib4Nuiv && glad_glVertexAttrib4Nuiv != wrap_glVertexAttrib4Nuiv) { real_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv; glad_glVertexAttrib4Nuiv = wrap_glVertexAttrib4Nuiv; swapped++; }
+        if (glad_glVertexAttrib4Nusv && glad_glVertexAttrib4Nusv != wrap_glVertexAttrib4Nusv) { real_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv; glad_glVertexAttrib4Nusv = wrap_glVertexAttrib4Nusv; swapped++; }
+        if (glad_glVertexAttrib4bv && glad_glVertexAttrib4bv != wrap_glVertexAttrib4bv) { real_glVertexAttrib4bv = glad_glVertexAttrib4bv; glad_glVertexAttrib4bv = wrap_glVertexAttrib4bv; swapped++; }
+        if (glad_glVertexAttrib4d && glad_glVertexAttrib4d != wrap_glVertexAttrib4d) { real_glVertexAttrib4d = glad_glVertexAttrib4d; glad_glVertexAttrib4d = wrap_glVertexAttrib4d; swapped++; }
+        if (glad_glVertexAttrib4dv && glad_glVertexAttrib4dv != wrap_glVertexAttrib4dv) { real_glVertexAttrib4dv = glad_glVertexAttrib4dv; glad_glVertexAttrib4dv = wrap_glVertexAttrib4dv; swapped++; }
+        if (glad_glVertexAttrib4f && glad_glVertexAttrib4f != wrap_glVertexAttrib4f) { real_glVertexAttrib4f = glad_glVertexAttrib4f; glad_glVertexAttrib4f = wrap_glVertexAttrib4f; swapped++; }
+        if (glad_glVertexAttrib4fv && glad_glVertexAttrib4fv != wrap_glVertexAttrib4fv) { real_glVertexAttrib4fv = glad_glVertexAttrib4fv; glad_glVertexAttrib4fv = wrap_glVertexAttrib4fv; swapped++; }
+        if (glad_glVertexAttrib4iv && glad_glVertexAttrib4iv != wrap_glVertexAttrib4iv) { real_glVertexAttrib4iv = glad_glVertexAttrib4iv; glad_glVertexAttrib4iv = wrap_glVertexAttrib4iv; swapped++; }
+        if (glad_glVertexAttrib4s && glad_glVertexAttrib4s != wrap_glVertexAttrib4s) { real_glVertexAttrib4s = glad_glVertexAttrib4s; glad_glVertexAttrib4s = wrap_glVertexAttrib4s; swapped++; }
+        if (glad_glVertexAttrib4sv && glad_glVertexAttrib4sv != wrap_glVertexAttrib4sv) { real_glVertexAttrib4sv = glad_glVertexAttrib4sv; glad_glVertexAttrib4sv = wrap_glVertexAttrib4sv; swapped++; }
+        if (glad_glVertexAttrib4ubv && glad_glVertexAttrib4ubv != wrap_glVertexAttrib4ubv) { real_glVertexAttrib4ubv = glad_glVertexAttrib4ubv; glad_glVertexAttrib4ubv = wrap_glVertexAttrib4ubv; swapped++; }
+        if (glad_glVertexAttrib4uiv && glad_glVertexAttrib4uiv != wrap_glVertexAttrib4uiv) { real_glVertexAttrib4uiv = glad_glVertexAttrib4uiv; glad_glVertexAttrib4uiv = wrap_glVertexAttrib4uiv; swapped++; }
+        if (glad_glVertexAttrib4usv && glad_glVertexAttrib4usv != wrap_glVertexAttrib4usv) { real_glVertexAttrib4usv = glad_glVertexAttrib4usv; glad_glVertexAttrib4usv = wrap_glVertexAttrib4usv; swapped++; }
+        if (glad_glVertexAttribPointer && glad_glVertexAttribPointer != wrap_glVertexAttribPointer) { real_glVertexAttribPointer = glad_glVertexAttribPointer; glad_glVertexAttribPointer = wrap_glVertexAttribPointer; swapped++; }
+        if (glad_glUniformMatrix2x3fv && glad_glUniformMatrix2x3fv != wrap_glUniformMatrix2x3fv) { real_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv; glad_glUniformMatrix2x3fv = wrap_glUniformMatrix2x3fv; swapped++; }
+        if (glad_glUniformMatrix3x2fv && glad_glUniformMatrix3x2fv != wrap_glUniformMatrix3x2fv) { real_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv; glad_glUniformMatrix3x2fv = wrap_glUniformMatrix3x2fv; swapped++; }
+        if (glad_glUniformMatrix2x4fv && glad_glUniformMatrix2x4fv != wrap_glUniformMatrix2x4fv) { real_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv; glad_glUniformMatrix2x4fv = wrap_glUniformMatrix2x4fv; swapped++; }
+        if (glad_glUniformMatrix4x2fv && glad_glUniformMatrix4x2fv != wrap_glUniformMatrix4x2fv) { real_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv; glad_glUniformMatrix4x2fv = wrap_glUniformMatrix4x2fv; swapped++; }
+        if (glad_glUniformMatrix3x4fv && glad_glUniformMatrix3x4fv != wrap_glUniformMatrix3x4fv) { real_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv; glad_glUniformMatrix3x4fv = wrap_glUniformMatrix3x4fv; swapped++; }
+        if (glad_glUniformMatrix4x3fv && glad_glUniformMatrix4x3fv != wrap_glUniformMatrix4x3fv) { real_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv; glad_glUniformMatrix4x3fv = wrap_glUniformMatrix4x3fv; swapped++; }
+        if (glad_glColorMaski && glad_glColorMaski != wrap_glColorMaski) { real_glColorMaski = glad_glColorMaski; glad_glColorMaski = wrap_glColorMaski; swapped++; }
+        if (glad_glGetBooleani_v && glad_glGetBooleani_v != wrap_glGetBooleani_v) { real_glGetBooleani_v = glad_glGetBooleani_v; glad_glGetBooleani_v = wrap_glGetBooleani_v; swapped++; }
+        if (glad_glGetIntegeri_v && glad_glGetIntegeri_v != wrap_glGetIntegeri_v) { real_glGetIntegeri_v = glad_glGetIntegeri_v; glad_glGetIntegeri_v = wrap_glGetIntegeri_v; swapped++; }
+        if (glad_glEnablei && glad_glEnablei != wrap_glEnablei) { real_glEnablei = glad_glEnablei; glad_glEnablei = wrap_glEnablei; swapped++; }
+        if (glad_glDisablei && glad_glDisablei != wrap_glDisablei) { real_glDisablei = glad_glDisablei; glad_glDisablei = wrap_glDisablei; swapped++; }
+        if (glad_glIsEnabledi && glad_glIsEnabledi != wrap_glIsEnabledi) { real_glIsEnabledi = glad_glIsEnabledi; glad_glIsEnabledi = wrap_glIsEnabledi; swapped++; }
+        if (glad_glBeginTransformFeedback && glad_glBeginTransformFeedback != wrap_glBeginTransformFeedback) { real_glBeginTransformFeedback = glad_glBeginTransformFeedback; glad_glBeginTransformFeedback = wrap_glBeginTransformFeedback; swapped++; }
+        if (glad_glEndTransformFeedback && glad_glEndTransformFeedback != wrap_glEndTransformFeedback) { real_glEndTransformFeedback = glad_glEndTransformFeedback; glad_glEndTransformFeedback = wrap_glEndTransformFeedback; swapped++; }
+        if (glad_glBindBufferRange && glad_glBindBufferRange != wrap_glBindBufferRange) { real_glBindBufferRange = glad_glBindBufferRange; glad_glBindBufferRange = wrap_glBindBufferRange; swapped++; }
+        if (glad_glBindBufferBase && glad_glBindBufferBase != wrap_glBindBufferBase) { real_glBindBufferBase = glad_glBindBufferBase; glad_glBindBufferBase = wrap_glBindBufferBase; swapped++; }
+        if (glad_glTransformFeedbackVaryings && glad_glTransformFeedbackVaryings != wrap_glTransformFeedbackVaryings) { real_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings; glad_glTransformFeedbackVaryings = wrap_glTransformFeedbackVaryings; swapped++; }
+        if (glad_glGetTransformFeedbackVarying && glad_glGetTransformFeedbackVarying != wrap_glGetTransformFeedbackVarying) { real_glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying; glad_glGetTransformFeedbackVarying = wrap_glGetTransformFeedbackVarying; swapped++; }
+        if (glad_glClampColor && glad_glClampColor != wrap_glClampColor) { real_glClampColor = glad_glClampColor; glad_glClampColor = wrap_glClampColor; swapped++; }
+        if (glad_glBeginConditionalRender && glad_glBeginConditionalRender != wrap_glBeginConditionalRender) { real_glBeginConditionalRender = glad_glBeginConditionalRender; glad_glBeginConditionalRender = wrap_glBeginConditionalRender; swapped++; }
+        if (glad_glEndConditionalRender && glad_glEndConditionalRender != wrap_glEndConditionalRender) { real_glEndConditionalRender = glad_glEndConditionalRender; glad_glEndConditionalRender = wrap_glEndConditionalRender; swapped++; }
+        if (glad_glVertexAttribIPointer && glad_glVertexAttribIPointer != wrap_glVertexAttribIPointer) { real_glVertexAttribIPointer = glad_glVertexAttribIPointer; glad_glVertexAttribIPointer = wrap_glVertexAttribIPointer; swapped++; }
+        if (glad_glGetVertexAttribIiv && glad_glGetVertexAttribIiv != wrap_glGetVertexAttribIiv) { real_glGetVertexAttribIiv = glad_glGetVertexAttribIiv; glad_glGetVertexAttribIiv = wrap_glGetVertexAttribIiv; swapped++; }
+        if (glad_glGetVertexAttribIuiv && glad_glGetVertexAttribIuiv != wrap_glGetVertexAttribIuiv) { real_glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv; glad_glGetVertexAttribIuiv = wrap_glGetVertexAttribIuiv; swapped++; }
+        if (glad_glVertexAttribI1i && glad_glVertexAttribI1i != wrap_glVertexAttribI1i) { real_glVertexAttribI1i = glad_glVertexAttribI1i; glad_glVertexAttribI1i = wrap_glVertexAttribI1i; swapped++; }
+        if (glad_glVertexAttribI2i && glad_glVertexAttribI2i != wrap_glVertexAttribI2i) { real_glVertexAttribI2i = glad_glVertexAttribI2i; glad_glVertexAttribI2i = wrap_glVertexAttribI2i; swapped++; }
+        if (glad_glVertexAttribI3i && glad_glVertexAttribI3i != wrap_glVertexAttribI3i) { real_glVertexAttribI3i = glad_glVertexAttribI3i; glad_glVertexAttribI3i = wrap_glVertexAttribI3i; swapped++; }
+        if (glad_glVertexAttribI4i && glad_glVertexAttribI4i != wrap_glVertexAttribI4i) { real_glVertexAttribI4i = glad_glVertexAttribI4i; glad_glVertexAttribI4i = wrap_glVertexAttribI4i; swapped++; }
+        if (glad_glVertexAttribI1ui && glad_glVertexAttribI1ui != wrap_glVertexAttribI1ui) { real_glVertexAttribI1ui = glad_glVertexAttribI1ui; glad_glVertexAttribI1ui = wrap_glVertexAttribI1ui; swapped++; }
+        if (glad_glVertexAttribI2ui && glad_glVertexAttribI2ui != wrap_glVertexAttribI2ui) { real_glVertexAttribI2ui = glad_glVertexAttribI2ui; glad_glVertexAttribI2ui = wrap_glVertexAttribI2ui; swapped++; }
+        if (glad_glVertexAttribI3ui && glad_glVertexAttribI3ui != wrap_glVertexAttribI3ui) { real_glVertexAttribI3ui = glad_glVertexAttribI3ui; glad_glVertexAttribI3ui = wrap_glVertexAttribI3ui; swapped++; }
+        if (glad_glVertexAttribI4ui && glad_glVertexAttribI4ui != wrap_glVertexAttribI4ui) { real_glVertexAttribI4ui = glad_glVertexAttribI4ui; glad_glVertexAttribI4ui = wrap_glVertexAttribI4ui; swapped++; }
+        if (glad_glVertexAttribI1iv && glad_glVertexAttribI1iv != wrap_glVertexAttribI1iv) { real_glVertexAttribI1iv = glad_glVertexAttribI1iv; glad_glVertexAttribI1iv = wrap_glVertexAttribI1iv; swapped++; }
+        if (glad_glVertexAttribI2iv && glad_glVertexAttribI2iv != wrap_glVertexAttribI2iv) { real_glVertexAttribI2iv = glad_glVertexAttribI2iv; glad_glVertexAttribI2iv = wrap_glVertexAttribI2iv; swapped++; }
+        if (glad_glVertexAttribI3iv && glad_glVertexAttribI3iv != wrap_glVertexAttribI3iv) { real_glVertexAttribI3iv = glad_glVertexAttribI3iv; glad_glVertexAttribI3iv = wrap_glVertexAttribI3iv; swapped++; }
+        if (glad_glVertexAttribI4iv && glad_glVertexAttribI4iv != wrap_glVertexAttribI4iv) { real_glVertexAttribI4iv = glad_glVertexAttribI4iv; glad_glVertexAttribI4iv = wrap_glVertexAttribI4iv; swapped++; }
+        if (glad_glVertexAttribI1uiv && glad_glVertexAttribI1uiv != wrap_glVertexAttribI1uiv) { real_glVertexAttribI1uiv = glad_glVertexAttribI1uiv; glad_glVertexAttribI1uiv = wrap_glVertexAttribI1uiv; swapped++; }
+        if (glad_glVertexAttribI2uiv && glad_glVertexAttribI2uiv != wrap_glVertexAttribI2uiv) { real_glVertexAttribI2uiv = glad_glVertexAttribI2uiv; glad_glVertexAttribI2uiv = wrap_glVertexAttribI2uiv; swapped++; }
+        if (glad_glVertexAttribI3uiv && glad_glVertexAttribI3uiv != wrap_glVertexAttribI3uiv) { real_glVertexAttribI3uiv = glad_glVertexAttribI3uiv; glad_glVertexAttribI3uiv = wrap_glVertexAttribI3uiv; swapped++; }
+        if (glad_glVertexAttribI4uiv && glad_glVertexAttribI4uiv != wrap_glVertexAttribI4uiv) { real_glVertexAttribI4uiv = glad_glVertexAttribI4uiv; glad_glVertexAttribI4uiv = wrap_glVertexAttribI4uiv; swapped++; }
+        if (glad_glVertexAttribI4bv && glad_glVertexAttribI4bv != wrap_glVertexAttribI4bv) { real_glVertexAttribI4bv = glad_glVertexAttribI4bv; glad_glVertexAttribI4bv = wrap_glVertexAttribI4bv; swapped++; }
+        if (glad_glVertexAttribI4sv && glad_glVertexAttribI4sv != wrap_glVertexAttribI4sv) { real_glVertexAttribI4sv = glad_glVertexAttribI4sv; glad_glVertexAttribI4sv = wrap_glVertexAttribI4sv; swapped++; }
+        if (glad_glVertexAttribI4ubv && glad_glVertexAttribI4ubv != wrap_glVertexAttribI4ubv) { real_glVertexAttribI4ubv = glad_glVertexAttribI4ubv; glad_glVertexAttribI4ubv = wrap_glVertexAttribI4ubv; swapped++; }
+        if (glad_glVertexAttribI4usv && glad_glVertexAttribI4usv != wrap_glVertexAttribI4usv) { real_glVertexAttribI4usv = glad_glVertexAttribI4usv; glad_glVertexAttribI4usv = wrap_glVertexAttribI4usv; swapped++; }
+        if (glad_glGetUniformuiv && glad_glGetUniformuiv != wrap_glGetUniformuiv) { real_glGetUniformuiv = glad_glGetUniformuiv; glad_glGetUniformuiv = wrap_glGetUniformuiv; swapped++; }
+        if (glad_glBindFragDataLocation && glad_glBindFragDataLocation != wrap_glBindFragDataLocation) { real_glBindFragDataLocation = glad_glBindFragDataLocation; glad_glBindFragDataLocation = wrap_glBindFragDataLocation; swapped++; }
+        if (glad_glGetFragDataLocation && glad_glGetFragDataLocation != wrap_glGetFragDataLocation) { real_glGetFragDataLocation = glad_glGetFragDataLocation; glad_glGetFragDataLocation = wrap_glGetFragDataLocation; swapped++; }
+        if (glad_glUniform1ui && glad_glUniform1ui != wrap_glUniform1ui) { real_glUniform1ui = glad_glUniform1ui; glad_glUniform1ui = wrap_glUniform1ui; swapped++; }
+        if (glad_glUniform2ui && glad_glUniform2ui != wrap_glUniform2ui) { real_glUniform2ui = glad_glUniform2ui; glad_glUniform2ui = wrap_glUniform2ui; swapped++; }
+        if (glad_glUniform3ui && glad_glUniform3ui != wrap_glUniform3ui) { real_glUniform3ui = glad_glUniform3ui; glad_glUniform3ui = wrap_glUniform3ui; swapped++; }
+        if (glad_glUniform4ui && glad_glUniform4ui != wrap_glUniform4ui) { real_glUniform4ui = glad_glUniform4ui; glad_glUniform4ui = wrap_glUniform4ui; swapped++; }
+        if (glad_glUniform1uiv && glad_glUniform1uiv != wrap_glUniform1uiv) { real_glUniform1uiv = glad_glUniform1uiv; glad_glUniform1uiv = wrap_glUniform1uiv; swapped++; }
+        if (glad_glUniform2uiv && glad_glUniform2uiv != wrap_glUniform2uiv) { real_glUniform2uiv = glad_glUniform2uiv; glad_glUniform2uiv = wrap_glUniform2uiv; swapped++; }
+        if (glad_glUniform3uiv && glad_glUniform3uiv != wrap_glUniform3uiv) { real_glUniform3uiv = glad_glUniform3uiv; glad_glUniform3uiv = wrap_glUniform3uiv; swapped++; }
+        if (glad_glUniform4uiv && glad_glUniform4uiv != wrap_glUniform4uiv) { real_glUniform4uiv = glad_glUniform4uiv; glad_glUniform4uiv = wrap_glUniform4uiv; swapped++; }
+        if (glad_glTexParameterIiv && glad_glTexParameterIiv != wrap_glTexParameterIiv) { real_glTexParameterIiv = glad_glTexParameterIiv; glad_glTexParameterIiv = wrap_glTexParameterIiv; swapped++; }
+        if (glad_glTexParameterIuiv && glad_glTexParameterIuiv != wrap_glTexParameterIuiv) { real_glTexParameterIuiv = glad_glTexParameterIuiv; glad_glTexParameterIuiv = wrap_glTexParameterIuiv; swapped++; }
+        if (glad_glGetTexParameterIiv && glad_glGetTexParameterIiv != wrap_glGetTexParameterIiv) { real_glGetTexParameterIiv = glad_glGetTexParameterIiv; glad_glGetTexParameterIiv = wrap_glGetTexParameterIiv; swapped++; }
+        if (glad_glGetTexParameterIuiv && glad_glGetTexParameterIuiv != wrap_glGetTexParameterIuiv) { real_glGetTexParameterIuiv = glad_glGetTexParameterIuiv; glad_glGetTexParameterIuiv = wrap_glGetTexParameterIuiv; swapped++; }
+        if (glad_glClearBufferiv && glad_glClearBufferiv != wrap_glClearBufferiv) { real_glClearBufferiv = glad_glClearBufferiv; glad_glClearBufferiv = wrap_glClearBufferiv; swapped++; }
+        if (glad_glClearBufferuiv && glad_glClearBufferuiv != wrap_glClearBufferuiv) { real_glClearBufferuiv = glad_glClearBufferuiv; glad_glClearBufferuiv = wrap_glClearBufferuiv; swapped++; }
+        if (glad_glClearBufferfv && glad_glClearBufferfv != wrap_glClearBufferfv) { real_glClearBufferfv = glad_glClearBufferfv; glad_glClearBufferfv = wrap_glClearBufferfv; swapped++; }
+        if (glad_glClearBufferfi && glad_glClearBufferfi != wrap_glClearBufferfi) { real_glClearBufferfi = glad_glClearBufferfi; glad_glClearBufferfi = wrap_glClearBufferfi; swapped++; }
+        if (glad_glGetStringi && glad_glGetStringi != wrap_glGetStringi) { real_glGetStringi = glad_glGetStringi; glad_glGetStringi = wrap_glGetStringi; swapped++; }
+        if (glad_glIsRenderbuffer && glad_glIsRenderbuffer != wrap_glIsRenderbuffer) { real_glIsRenderbuffer = glad_glIsRenderbuffer; glad_glIsRenderbuffer = wrap_glIsRenderbuffer; swapped++; }
+        if (glad_glBindRenderbuffer && glad_glBindRenderbuffer != wrap_glBindRenderbuffer) { real_glBindRenderbuffer = glad_glBindRenderbuffer; glad_glBindRenderbuffer = wrap_glBindRenderbuffer; swapped++; }
+        if (glad_glDeleteRenderbuffers && glad_glDeleteRenderbuffers != wrap_glDeleteRenderbuffers) { real_glDeleteRenderbuffers = glad_glDeleteRenderbuffers; glad_glDeleteRenderbuffers = wrap_glDeleteRenderbuffers; swapped++; }
+        if (glad_glGenRenderbuffers && glad_glGenRenderbuffers != wrap_glGenRenderbuffers) { real_glGenRenderbuffers = glad_glGenRenderbuffers; glad_glGenRenderbuffers = wrap_glGenRenderbuffers; swapped++; }
+        if (glad_glRenderbufferStorage && glad_glRenderbufferStorage != wrap_glRenderbufferStorage) { real_glRenderbufferStorage = glad_glRenderbufferStorage; glad_glRenderbufferStorage = wrap_glRenderbufferStorage; swapped++; }
+        if (glad_glGetRenderbufferParameteriv && glad_glGetRenderbufferParameteriv != wrap_glGetRenderbufferParameteriv) { real_glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv; glad_glGetRenderbufferParameteriv = wrap_glGetRenderbufferParameteriv; swapped++; }
+        if (glad_glIsFramebuffer && glad_glIsFramebuffer != wrap_glIsFramebuffer) { real_glIsFramebuffer = glad_glIsFramebuffer; glad_glIsFramebuffer = wrap_glIsFramebuffer; swapped++; }
+        if (glad_glBindFramebuffer && glad_glBindFramebuffer != wrap_glBindFramebuffer) { real_glBindFramebuffer = glad_glBindFramebuffer; glad_glBindFramebuffer = wrap_glBindFramebuffer; swapped++; }
+        if (glad_glDeleteFramebuffers && glad_glDeleteFramebuffers != wrap_glDeleteFramebuffers) { real_glDeleteFramebuffers = glad_glDeleteFramebuffers; glad_glDeleteFramebuffers = wrap_glDeleteFramebuffers; swapped++; }
+        if (glad_glGenFramebuffers && glad_glGenFramebuffers != wrap_glGenFramebuffers) { real_glGenFramebuffers = glad_glGenFramebuffers; glad_glGenFramebuffers = wrap_glGenFramebuffers; swapped++; }
+        if (glad_glCheckFramebufferStatus && glad_glCheckFramebufferStatus != wrap_glCheckFramebufferStatus) { real_glCheckFramebufferStatus = glad_glCheckFramebufferStatus; glad_glCheckFramebufferStatus = wrap_glCheckFramebufferStatus; swapped++; }
+        if (glad_glFramebufferTexture1D && glad_glFramebufferTexture1D != wrap_glFramebufferTexture1D) { real_glFramebufferTexture1D = glad_glFramebufferTexture1D; glad_glFramebufferTexture1D = wrap_glFramebufferTexture1D; swapped++; }
+        if (glad_glFramebufferTexture2D && glad_glFramebufferTexture2D != wrap_glFramebufferTexture2D) { real_glFramebufferTexture2D = glad_glFramebufferTexture2D; glad_glFramebufferTexture2D = wrap_glFramebufferTexture2D; swapped++; }
+        if (glad_glFramebufferTexture3D && glad_glFramebufferTexture3D != wrap_glFramebufferTexture3D) { real_glFramebufferTexture3D = glad_glFramebufferTexture3D; glad_glFramebufferTexture3D = wrap_glFramebufferTexture3D; swapped++; }
+        if (glad_glFramebufferRenderbuffer && glad_glFramebufferRenderbuffer != wrap_glFramebufferRenderbuffer) { real_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer; glad_glFramebufferRenderbuffer = wrap_glFramebufferRenderbuffer; swapped++; }
+        if (glad_glGetFramebufferAttachmentParameteriv && glad_glGetFramebufferAttachmentParameteriv != wrap_glGetFramebufferAttachmentParameteriv) { real_glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv; glad_glGetFramebufferAttachmentParameteriv = wrap_glGetFramebufferAttachmentParameteriv; swapped++; }
+        if (glad_glGenerateMipmap && glad_glGenerateMipmap != wrap_glGenerateMipmap) { real_glGenerateMipmap = glad_glGenerateMipmap; glad_glGenerateMipmap = wrap_glGenerateMipmap; swapped++; }
+        if (glad_glBlitFramebuffer && glad_glBlitFramebuffer != wrap_glBlitFramebuffer) { real_glBlitFramebuffer = glad_glBlitFramebuffer; glad_glBlitFramebuffer = wrap_glBlitFramebuffer; swapped++; }
+        if (glad_glRenderbufferStorageMultisample && glad_glRenderbufferStorageMultisample != wrap_glRenderbufferStorageMultisample) { real_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample; glad_glRenderbufferStorageMultisample = wrap_glRenderbufferStorageMultisample; swapped++; }
+        if (glad_glFramebufferTextureLayer && glad_glFramebufferTextureLayer != wrap_glFramebufferTextureLayer) { real_glFramebufferTextureLayer = glad_glFramebufferTextureLayer; glad_glFramebufferTextureLayer = wrap_glFramebufferTextureLayer; swapped++; }
+        if (glad_glMapBufferRange && glad_glMapBufferRange != wrap_glMapBufferRange) { real_glMapBufferRange = glad_glMapBufferRange; glad_glMapBufferRange = wrap_glMapBufferRange; swapped++; }
+        if (glad_glFlushMappedBufferRange && glad_glFlushMappedBufferRange != wrap_glFlushMappedBufferRange) { real_glFlushMappedBufferRange = glad_glFlushMappedBufferRange; glad_glFlushMappedBufferRange = wrap_glFlushMappedBufferRange; swapped++; }
+        if (glad_glBindVertexArray && glad_glBindVertexArray != wrap_glBindVertexArray) { real_glBindVertexArray = glad_glBindVertexArray; glad_glBindVertexArray = wrap_glBindVertexArray; swapped++; }
+        if (glad_glDeleteVertexArrays && glad_glDeleteVertexArrays != wrap_glDeleteVertexArrays) { real_glDeleteVertexArrays = glad_glDeleteVertexArrays; glad_glDeleteVertexArrays = wrap_glDeleteVertexArrays; swapped++; }
+        if (glad_glGenVertexArrays && glad_glGenVertexArrays != wrap_glGenVertexArrays) { real_glGenVertexArrays = glad_glGenVertexArrays; glad_glGenVertexArrays = wrap_glGenVertexArrays; swapped++; }
+        if (glad_glIsVertexArray && glad_glIsVertexArray != wrap_glIsVertexArray) { real_glIsVertexArray = glad_glIsVertexArray; glad_glIsVertexArray = wrap_glIsVertexArray; swapped++; }
+        if (glad_glDrawArraysInstanced && glad_glDrawArraysInstanced != wrap_glDrawArraysInstanced) { real_glDrawArraysInstanced = glad_glDrawArraysInstanced; glad_glDrawArraysInstanced = wrap_glDrawArraysInstanced; swapped++; }
+        if (glad_glDrawElementsInstanced && glad_glDrawElementsInstanced != wrap_glDrawElementsInstanced) { real_glDrawElementsInstanced = glad_glDrawElementsInstanced; glad_glDrawElementsInstanced = wrap_glDrawElementsInstanced; swapped++; }
+        if (glad_glTexBuffer && glad_glTexBuffer != wrap_glTexBuffer) { real_glTexBuffer = glad_glTexBuffer; glad_glTexBuffer = wrap_glTexBuffer; swapped++; }
+        if (glad_glPrimitiveRestartIndex && glad_glPrimitiveRestartIndex != wrap_glPrimitiveRestartIndex) { real_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex; glad_glPrimitiveRestartIndex = wrap_glPrimitiveRestartIndex; swapped++; }
+        if (glad_glCopyBufferSubData && glad_glCopyBufferSubData != wrap_glCopyBufferSubData) { real_glCopyBufferSubData = glad_glCopyBufferSubData; glad_glCopyBufferSubData = wrap_glCopyBufferSubData; swapped++; }
+        if (glad_glGetUniformIndices && glad_glGetUniformIndices != wrap_glGetUniformIndices) { real_glGetUniformIndices = glad_glGetUniformIndices; glad_glGetUniformIndices = wrap_glGetUniformIndices; swapped++; }
+        if (glad_glGetActiveUniformsiv && glad_glGetActiveUniformsiv != wrap_glGetActiveUniformsiv) { real_glGetActiveUniformsiv = glad_glGetActiveUniformsiv; glad_glGetActiveUniformsiv = wrap_glGetActiveUniformsiv; swapped++; }
+        if (glad_glGetActiveUniformName && glad_glGetActiveUniformName != wrap_glGetActiveUniformName) { real_glGetActiveUniformName = glad_glGetActiveUniformName; glad_glGetActiveUniformName = wrap_glGetActiveUniformName; swapped++; }
+        if (glad_glGetUniformBlockIndex && glad_glGetUniformBlockIndex != wrap_glGetUniformBlockIndex) { real_glGetUniformBlockIndex = glad_glGetUniformBlockIndex; glad_glGetUniformBlockIndex = wrap_glGetUniformBlockIndex; swapped++; }
+        if (glad_glGetActiveUniformBlockiv && glad_glGetActiveUniformBlockiv != wrap_glGetActiveUniformBlockiv) { real_glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv; glad_glGetActiveUniformBlockiv = wrap_glGetActiveUniformBlockiv; swapped++; }
+        if (glad_glGetActiveUniformBlockName && glad_glGetActiveUniformBlockName != wrap_glGetActiveUniformBlockName) { real_glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName; glad_glGetActiveUniformBlockName = wrap_glGetActiveUniformBlockName; swapped++; }
+        if (glad_glUniformBlockBinding && glad_glUniformBlockBinding != wrap_glUniformBlockBinding) { real_glUniformBlockBinding = glad_glUniformBlockBinding; glad_glUniformBlockBinding = wrap_glUniformBlockBinding; swapped++; }
+        if (glad_glDrawElementsBaseVertex && glad_glDrawElementsBaseVertex != wrap_glDrawElementsBaseVertex) { real_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex; glad_glDrawElementsBaseVertex = wrap_glDrawElementsBaseVertex; swapped++; }
+        if (glad_glDrawRangeElementsBaseVertex && glad_glDrawRangeElementsBaseVertex != wrap_glDrawRangeElementsBaseVertex) { real_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex; glad_glDrawRangeElementsBaseVertex = wrap_glDrawRangeElementsBaseVertex; swapped++; }
+        if (glad_glDrawElementsInstancedBaseVertex && glad_glDrawElementsInstancedBaseVertex != wrap_glDrawElementsInstancedBaseVertex) { real_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex; glad_glDrawElementsInstancedBaseVertex = wrap_glDrawElementsInstancedBaseVertex; swapped++; }
+        if (glad_glMultiDrawElementsBaseVertex && glad_glMultiDrawElementsBaseVertex != wrap_glMultiDrawElementsBaseVertex) { real_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex; glad_glMultiDrawElementsBaseVertex = wrap_glMultiDrawElementsBaseVertex; swapped++; }
+        if (glad_glProvokingVertex && glad_glProvokingVertex != wrap_glProvokingVertex) { real_glProvokingVertex = glad_glProvokingVertex; glad_glProvokingVertex = wrap_glProvokingVertex; swapped++; }
+        if (glad_glFenceSync && glad_glFenceSync != wrap_glFenceSync) { real_glFenceSync = glad_glFenceSync; glad_glFenceSync = wrap_glFenceSync; swapped++; }
+        if (glad_glIsSync && glad_glIsSync != wrap_glIsSync) { real_glIsSync = glad_glIsSync; glad_glIsSync = wrap_glIsSync; swapped++; }
+        if (glad_glDeleteSync && glad_glDeleteSync != wrap_glDeleteSync) { real_glDeleteSync = glad_glDeleteSync; glad_glDeleteSync = wrap_glDeleteSync; swapped++; }
+        if (glad_glClientWaitSync && glad_glClientWaitSync != wrap_glClientWaitSync) { real_glClientWaitSync = glad_glClientWaitSync; glad_glClientWaitSync = wrap_glClientWaitSync; swapped++; }
+        if (glad_glWaitSync && glad_glWaitSync != wrap_glWaitSync) { real_glWaitSync = glad_glWaitSync; glad_glWaitSync = wrap_glWaitSync; swapped++; }
+        if (glad_glGetInteger64v && glad_glGetInteger64v != wrap_glGetInteger64v) { real_glGetInteger64v = glad_glGetInteger64v; glad_glGetInteger64v = wrap_glGetInteger64v; swapped++; }
+        if (glad_glGetSynciv && glad_glGetSynciv != wrap_glGetSynciv) { real_glGetSynciv = glad_glGetSynciv; glad_glGetSynciv = wrap_glGetSynciv; swapped++; }
+        if (glad_glGetInteger64i_v && glad_glGetInteger64i_v != wrap_glGetInteger64i_v) { real_glGetInteger64i_v = glad_glGetInteger64i_v; glad_glGetInteger64i_v = wrap_glGetInteger64i_v; swapped++; }
+        if (glad_glGetBufferParameteri64v && glad_glGetBufferParameteri64v != wrap_glGetBufferParameteri64v) { real_glGetBufferParameteri64v = glad_glGetBufferParameteri64v; glad_glGetBufferParameteri64v = wrap_glGetBufferParameteri64v; swapped++; }
+        if (glad_glFramebufferTexture && glad_glFramebufferTexture != wrap_glFramebufferTexture) { real_glFramebufferTexture = glad_glFramebufferTexture; glad_glFramebufferTexture = wrap_glFramebufferTexture; swapped++; }
+        if (glad_glTexImage2DMultisample && glad_glTexImage2DMultisample != wrap_glTexImage2DMultisample) { real_glTexImage2DMultisample = glad_glTexImage2DMultisample; glad_glTexImage2DMultisample = wrap_glTexImage2DMultisample; swapped++; }
+        if (glad_glTexImage3DMultisample && glad_glTexImage3DMultisample != wrap_glTexImage3DMultisample) { real_glTexImage3DMultisample = glad_glTexImage3DMultisample; glad_glTexImage3DMultisample = wrap_glTexImage3DMultisample; swapped++; }
+        if (glad_glGetMultisamplefv && glad_glGetMultisamplefv != wrap_glGetMultisamplefv) { real_glGetMultisamplefv = glad_glGetMultisamplefv; glad_glGetMultisamplefv = wrap_glGetMultisamplefv; swapped++; }
+        if (glad_glSampleMaski && glad_glSampleMaski != wrap_glSampleMaski) { real_glSampleMaski = glad_glSampleMaski; glad_glSampleMaski = wrap_glSampleMaski; swapped++; }
+        if (glad_glBindFragDataLocationIndexed && glad_glBindFragDataLocationIndexed != wrap_glBindFragDataLocationIndexed) { real_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed; glad_glBindFragDataLocationIndexed = wrap_glBindFragDataLocationIndexed; swapped++; }
+        if (glad_glGetFragDataIndex && glad_glGetFragDataIndex != wrap_glGetFragDataIndex) { real_glGetFragDataIndex = glad_glGetFragDataIndex; glad_glGetFragDataIndex = wrap_glGetFragDataIndex; swapped++; }
+        if (glad_glGenSamplers && glad_glGenSamplers != wrap_glGenSamplers) { real_glGenSamplers = glad_glGenSamplers; glad_glGenSamplers = wrap_glGenSamplers; swapped++; }
+        if (glad_glDeleteSamplers && glad_glDeleteSamplers != wrap_glDeleteSamplers) { real_glDeleteSamplers = glad_glDeleteSamplers; glad_glDeleteSamplers = wrap_glDeleteSamplers; swapped++; }
+        if (glad_glIsSampler && glad_glIsSampler != wrap_glIsSampler) { real_glIsSampler = glad_glIsSampler; glad_glIsSampler = wrap_glIsSampler; swapped++; }
+        if (glad_glBindSampler && glad_glBindSampler != wrap_glBindSampler) { real_glBindSampler = glad_glBindSampler; glad_glBindSampler = wrap_glBindSampler; swapped++; }
+        if (glad_glSamplerParameteri && glad_glSamplerParameteri != wrap_glSamplerParameteri) { real_glSamplerParameteri = glad_glSamplerParameteri; glad_glSamplerParameteri = wrap_glSamplerParameteri; swapped++; }
+        if (glad_glSamplerParameteriv && glad_glSamplerParameteriv != wrap_glSamplerParameteriv) { real_glSamplerParameteriv = glad_glSamplerParameteriv; glad_glSamplerParameteriv = wrap_glSamplerParameteriv; swapped++; }
+        if (glad_glSamplerParameterf && glad_glSamplerParameterf != wrap_glSamplerParameterf) { real_glSamplerParameterf = glad_glSamplerParameterf; glad_glSamplerParameterf = wrap_glSamplerParameterf; swapped++; }
+        if (glad_glSamplerParameterfv && glad_glSamplerParameterfv != wrap_glSamplerParameterfv) { real_glSamplerParameterfv = glad_glSamplerParameterfv; glad_glSamplerParameterfv = wrap_glSamplerParameterfv; swapped++; }
+        if (glad_glSamplerParameterIiv && glad_glSamplerParameterIiv != wrap_glSamplerParameterIiv) { real_glSamplerParameterIiv = glad_glSamplerParameterIiv; glad_glSamplerParameterIiv = wrap_glSamplerParameterIiv; swapped++; }
+        if (glad_glSamplerParameterIuiv && glad_glSamplerParameterIuiv != wrap_glSamplerParameterIuiv) { real_glSamplerParameterIuiv = glad_glSamplerParameterIuiv; glad_glSamplerParameterIuiv = wrap_glSamplerParameterIuiv; swapped++; }
+        if (glad_glGetSamplerParameteriv && glad_glGetSamplerParameteriv != wrap_glGetSamplerParameteriv) { real_glGetSamplerParameteriv = glad_glGetSamplerParameteriv; glad_glGetSamplerParameteriv = wrap_glGetSamplerParameteriv; swapped++; }
+        if (glad_glGetSamplerParameterIiv && glad_glGetSamplerParameterIiv != wrap_glGetSamplerParameterIiv) { real_glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv; glad_glGetSamplerParameterIiv = wrap_glGetSamplerParameterIiv; swapped++; }
+        if (glad_glGetSamplerParameterfv && glad_glGetSamplerParameterfv != wrap_glGetSamplerParameterfv) { real_glGetSamplerParameterfv = glad_glGetSamplerParameterfv; glad_glGetSamplerParameterfv = wrap_glGetSamplerParameterfv; swapped++; }
+        if (glad_glGetSamplerParameterIuiv && glad_glGetSamplerParameterIuiv != wrap_glGetSamplerParameterIuiv) { real_glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv; glad_glGetSamplerParameterIuiv = wrap_glGetSamplerParameterIuiv; swapped++; }
+        if (glad_glQueryCounter && glad_glQueryCounter != wrap_glQueryCounter) { real_glQueryCounter = glad_glQueryCounter; glad_glQueryCounter = wrap_glQueryCounter; swapped++; }
+        if (glad_glGetQueryObjecti64v && glad_glGetQueryObjecti64v != wrap_glGetQueryObjecti64v) { real_glGetQueryObjecti64v = glad_glGetQueryObjecti64v; glad_glGetQueryObjecti64v = wrap_glGetQueryObjecti64v; swapped++; }
+        if (glad_glGetQueryObjectui64v && glad_glGetQueryObjectui64v != wrap_glGetQueryObjectui64v) { real_glGetQueryObjectui64v = glad_glGetQueryObjectui64v; glad_glGetQueryObjectui64v = wrap_glGetQueryObjectui64v; swapped++; }
+        if (glad_glVertexAttribDivisor && glad_glVertexAttribDivisor != wrap_glVertexAttribDivisor) { real_glVertexAttribDivisor = glad_glVertexAttribDivisor; glad_glVertexAttribDivisor = wrap_glVertexAttribDivisor; swapped++; }
+        if (glad_glVertexAttribP1ui && glad_glVertexAttribP1ui != wrap_glVertexAttribP1ui) { real_glVertexAttribP1ui = glad_glVertexAttribP1ui; glad_glVertexAttribP1ui = wrap_glVertexAttribP1ui; swapped++; }
+        if (glad_glVertexAttribP1uiv && glad_glVertexAttribP1uiv != wrap_glVertexAttribP1uiv) { real_glVertexAttribP1uiv = glad_glVertexAttribP1uiv; glad_glVertexAttribP1uiv = wrap_glVertexAttribP1uiv; swapped++; }
+        if (glad_glVertexAttribP2ui && glad_glVertexAttribP2ui != wrap_glVertexAttribP2ui) { real_glVertexAttribP2ui = glad_glVertexAttribP2ui; glad_glVertexAttribP2ui = wrap_glVertexAttribP2ui; swapped++; }
+        if (glad_glVertexAttribP2uiv && glad_glVertexAttribP2uiv != wrap_glVertexAttribP2uiv) { real_glVertexAttribP2uiv = glad_glVertexAttribP2uiv; glad_glVertexAttribP2uiv = wrap_glVertexAttribP2uiv; swapped++; }
+        if (glad_glVertexAttribP3ui && glad_glVertexAttribP3ui != wrap_glVertexAttribP3ui) { real_glVertexAttribP3ui = glad_glVertexAttribP3ui; glad_glVertexAttribP3ui = wrap_glVertexAttribP3ui; swapped++; }
+        if (glad_glVertexAttribP3uiv && glad_glVertexAttribP3uiv != wrap_glVertexAttribP3uiv) { real_glVertexAttribP3uiv = glad_glVertexAttribP3uiv; glad_glVertexAttribP3uiv = wrap_glVertexAttribP3uiv; swapped++; }
+        if (glad_glVertexAttribP4ui && glad_glVertexAttribP4ui != wrap_glVertexAttribP4ui) { real_glVertexAttribP4ui = glad_glVertexAttribP4ui; glad_glVertexAttribP4ui = wrap_glVertexAttribP4ui; swapped++; }
+        if (glad_glVertexAttribP4uiv && glad_glVertexAttribP4uiv != wrap_glVertexAttribP4uiv) { real_glVertexAttribP4uiv = glad_glVertexAttribP4uiv; glad_glVertexAttribP4uiv = wrap_glVertexAttribP4uiv; swapped++; }
+        if (glad_glVertexP2ui && glad_glVertexP2ui != wrap_glVertexP2ui) { real_glVertexP2ui = glad_glVertexP2ui; glad_glVertexP2ui = wrap_glVertexP2ui; swapped++; }
+        if (glad_glVertexP2uiv && glad_glVertexP2uiv != wrap_glVertexP2uiv) { real_glVertexP2uiv = glad_glVertexP2uiv; glad_glVertexP2uiv = wrap_glVertexP2uiv; swapped++; }
+        if (glad_glVertexP3ui && glad_glVertexP3ui != wrap_glVertexP3ui) { real_glVertexP3ui = glad_glVertexP3ui; glad_glVertexP3ui = wrap_glVertexP3ui; swapped++; }
+        if (glad_glVertexP3uiv && glad_glVertexP3uiv != wrap_glVertexP3uiv) { real_glVertexP3uiv = glad_glVertexP3uiv; glad_glVertexP3uiv = wrap_glVertexP3uiv; swapped++; }
+        if (glad_glVertexP4ui && glad_glVertexP4ui != wrap_glVertexP4ui) { real_glVertexP4ui = glad_glVertexP4ui; glad_glVertexP4ui = wrap_glVertexP4ui; swapped++; }
+        if (glad_glVertexP4uiv && glad_glVertexP4uiv != wrap_glVertexP4uiv) { real_glVertexP4uiv = glad_glVertexP4uiv; glad_glVertexP4uiv = wrap_glVertexP4uiv; swapped++; }
+        if (glad_glTexCoordP1ui && glad_glTexCoordP1ui != wrap_glTexCoordP1ui) { real_glTexCoordP1ui = glad_glTexCoordP1ui; glad_glTexCoordP1ui = wrap_glTexCoordP1ui; swapped++; }
+        if (glad_glTexCoordP1uiv && glad_glTexCoordP1uiv != wrap_glTexCoordP1uiv) { real_glTexCoordP1uiv = glad_glTexCoordP1uiv; glad_glTexCoordP1uiv = wrap_glTexCoordP1uiv; swapped++; }
+        if (glad_glTexCoordP2ui && glad_glTexCoordP2ui != wrap_glTexCoordP2ui) { real_glTexCoordP2ui = glad_glTexCoordP2ui; glad_glTexCoordP2ui = wrap_glTexCoordP2ui; swapped++; }
+        if (glad_glTexCoordP2uiv && glad_glTexCoordP2uiv != wrap_glTexCoordP2uiv) { real_glTexCoordP2uiv = glad_glTexCoordP2uiv; glad_glTexCoordP2uiv = wrap_glTexCoordP2uiv; swapped++; }
+        if (glad_glTexCoordP3ui && glad_glTexCoordP3ui != wrap_glTexCoordP3ui) { real_glTexCoordP3ui = glad_glTexCoordP3ui; glad_glTexCoordP3ui = wrap_glTexCoordP3ui; swapped++; }
+        if (glad_glTexCoordP3uiv && glad_glTexCoordP3uiv != wrap_glTexCoordP3uiv) { real_glTexCoordP3uiv = glad_glTexCoordP3uiv; glad_glTexCoordP3uiv = wrap_glTexCoordP3uiv; swapped++; }
+        if (glad_glTexCoordP4ui && glad_glTexCoordP4ui != wrap_glTexCoordP4ui) { real_glTexCoordP4ui = glad_glTexCoordP4ui; glad_glTexCoordP4ui = wrap_glTexCoordP4ui; swapped++; }
+        if (glad_glTexCoordP4uiv && glad_glTexCoordP4uiv != wrap_glTexCoordP4uiv) { real_glTexCoordP4uiv = glad_glTexCoordP4uiv; glad_glTexCoordP4uiv = wrap_glTexCoordP4uiv; swapped++; }
+        if (glad_glMultiTexCoordP1ui && glad_glMultiTexCoordP1ui != wrap_glMultiTexCoordP1ui) { real_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui; glad_glMultiTexCoordP1ui = wrap_glMultiTexCoordP1ui; swapped++; }
+        if (glad_glMultiTexCoordP1uiv && glad_glMultiTexCoordP1uiv != wrap_glMultiTexCoordP1uiv) { real_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv; glad_glMultiTexCoordP1uiv = wrap_glMultiTexCoordP1uiv; swapped++; }
+        if (glad_glMultiTexCoordP2ui && glad_glMultiTexCoordP2ui != wrap_glMultiTexCoordP2ui) { real_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui; glad_glMultiTexCoordP2ui = wrap_glMultiTexCoordP2ui; swapped++; }
+        if (glad_glMultiTexCoordP2uiv && glad_glMultiTexCoordP2uiv != wrap_glMultiTexCoordP2uiv) { real_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv; glad_glMultiTexCoordP2uiv = wrap_glMultiTexCoordP2uiv; swapped++; }
+        if (glad_glMultiTexCoordP3ui && glad_glMultiTexCoordP3ui != wrap_glMultiTexCoordP3ui) { real_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui; glad_glMultiTexCoordP3ui = wrap_glMultiTexCoordP3ui; swapped++; }
+        if (glad_glMultiTexCoordP3uiv && glad_glMultiTexCoordP3uiv != wrap_glMultiTexCoordP3uiv) { real_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv; glad_glMultiTexCoordP3uiv = wrap_glMultiTexCoordP3uiv; swapped++; }
+        if (glad_glMultiTexCoordP4ui && glad_glMultiTexCoordP4ui != wrap_glMultiTexCoordP4ui) { real_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui; glad_glMultiTexCoordP4ui = wrap_glMultiTexCoordP4ui; swapped++; }
+        if (glad_glMultiTexCoordP4uiv && glad_glMultiTexCoordP4uiv != wrap_glMultiTexCoordP4uiv) { real_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv; glad_glMultiTexCoordP4uiv = wrap_glMultiTexCoordP4uiv; swapped++; }
+        if (glad_glNormalP3ui && glad_glNormalP3ui != wrap_glNormalP3ui) { real_glNormalP3ui = glad_glNormalP3ui; glad_glNormalP3ui = wrap_glNormalP3ui; swapped++; }
+        if (glad_glNormalP3uiv && glad_glNormalP3uiv != wrap_glNormalP3uiv) { real_glNormalP3uiv = glad_glNormalP3uiv; glad_glNormalP3uiv = wrap_glNormalP3uiv; swapped++; }
+        if (glad_glColorP3ui && glad_glColorP3ui != wrap_glColorP3ui) { real_glColorP3ui = glad_glColorP3ui; glad_glColorP3ui = wrap_glColorP3ui; swapped++; }
+        if (glad_glColorP3uiv && glad_glColorP3uiv != wrap_glColorP3uiv) { real_glColorP3uiv = glad_glColorP3uiv; glad_glColorP3uiv = wrap_glColorP3uiv; swapped++; }
+        if (glad_glColorP4ui && glad_glColorP4ui != wrap_glColorP4ui) { real_glColorP4ui = glad_glColorP4ui; glad_glColorP4ui = wrap_glColorP4ui; swapped++; }
+        if (glad_glColorP4uiv && glad_glColorP4uiv != wrap_glColorP4uiv) { real_glColorP4uiv = glad_glColorP4uiv; glad_glColorP4uiv = wrap_glColorP4uiv; swapped++; }
+        if (glad_glSecondaryColorP3ui && glad_glSecondaryColorP3ui != wrap_glSecondaryColorP3ui) { real_glSecondaryColorP3ui = glad_glSecondaryColorP3ui; glad_glSecondaryColorP3ui = wrap_glSecondaryColorP3ui; swapped++; }
+        if (glad_glSecondaryColorP3uiv && glad_glSecondaryColorP3uiv != wrap_glSecondaryColorP3uiv) { real_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv; glad_glSecondaryColorP3uiv = wrap_glSecondaryColorP3uiv; swapped++; }
+        if (glad_glMinSampleShading && glad_glMinSampleShading != wrap_glMinSampleShading) { real_glMinSampleShading = glad_glMinSampleShading; glad_glMinSampleShading = wrap_glMinSampleShading; swapped++; }
+        if (glad_glBlendEquationi && glad_glBlendEquationi != wrap_glBlendEquationi) { real_glBlendEquationi = glad_glBlendEquationi; glad_glBlendEquationi = wrap_glBlendEquationi; swapped++; }
+        if (glad_glBlendEquationSeparatei && glad_glBlendEquationSeparatei != wrap_glBlendEquationSeparatei) { real_glBlendEquationSeparatei = glad_glBlendEquationSeparatei; glad_glBlendEquationSeparatei = wrap_glBlendEquationSeparatei; swapped++; }
+        if (glad_glBlendFunci && glad_glBlendFunci != wrap_glBlendFunci) { real_glBlendFunci = glad_glBlendFunci; glad_glBlendFunci = wrap_glBlendFunci; swapped++; }
+        if (glad_glBlendFuncSeparatei && glad_glBlendFuncSeparatei != wrap_glBlendFuncSeparatei) { real_glBlendFuncSeparatei = glad_glBlendFuncSeparatei; glad_glBlendFuncSeparatei = wrap_glBlendFuncSeparatei; swapped++; }
+        if (glad_glDrawArraysIndirect && glad_glDrawArraysIndirect != wrap_glDrawArraysIndirect) { real_glDrawArraysIndirect = glad_glDrawArraysIndirect; glad_glDrawArraysIndirect = wrap_glDrawArraysIndirect; swapped++; }
+        if (glad_glDrawElementsIndirect && glad_glDrawElementsIndirect != wrap_glDrawElementsIndirect) { real_glDrawElementsIndirect = glad_glDrawElementsIndirect; glad_glDrawElementsIndirect = wrap_glDrawElementsIndirect; swapped++; }
+        if (glad_glUniform1d && glad_glUniform1d != wrap_glUniform1d) { real_glUniform1d = glad_glUniform1d; glad_glUniform1d = wrap_glUniform1d; swapped++; }
+        if (glad_glUniform2d && glad_glUniform2d != wrap_glUniform2d) { real_glUniform2d = glad_glUniform2d; glad_glUniform2d = wrap_glUniform2d; swapped++; }
+        if (glad_glUniform3d && glad_glUniform3d != wrap_glUniform3d) { real_glUniform3d = glad_glUniform3d; glad_glUniform3d = wrap_glUniform3d; swapped++; }
+        if (glad_glUniform4d && glad_glUniform4d != wrap_glUniform4d) { real_glUniform4d = glad_glUniform4d; glad_glUniform4d = wrap_glUniform4d; swapped++; }
+        if (glad_glUniform1dv && glad_glUniform1dv != wrap_glUniform1dv) { real_glUniform1dv = glad_glUniform1dv; glad_glUniform1dv = wrap_glUniform1dv; swapped++; }
+        if (glad_glUniform2dv && glad_glUniform2dv != wrap_glUniform2dv) { real_glUniform2dv = glad_glUniform2dv; glad_glUniform2dv = wrap_glUniform2dv; swapped++; }
+        if (glad_glUniform3dv && glad_glUniform3dv != wrap_glUniform3dv) { real_glUniform3dv = glad_glUniform3dv; glad_glUniform3dv = wrap_glUniform3dv; swapped++; }
+        if (glad_glUniform4dv && glad_glUniform4dv != wrap_glUniform4dv) { real_glUniform4dv = glad_glUniform4dv; glad_glUniform4dv = wrap_glUniform4dv; swapped++; }
+        if (glad_glUniformMatrix2dv && glad_glUniformMatrix2dv != wrap_glUniformMatrix2dv) { real_glUniformMatrix2dv = glad_glUniformMatrix2dv; glad_glUniformMatrix2dv = wrap_glUniformMatrix2dv; swapped++; }
+        if (glad_glUniformMatrix3dv && glad_glUniformMatrix3dv != wrap_glUniformMatrix3dv) { real_glUniformMatrix3dv = glad_glUniformMatrix3dv; glad_glUniformMatrix3dv = wrap_glUniformMatrix3dv; swapped++; }
+        if (glad_glUniformMatrix4dv && glad_glUniformMatrix4dv != wrap_glUniformMatrix4dv) { real_glUniformMatrix4dv = glad_glUniformMatrix4dv; glad_glUniformMatrix4dv = wrap_glUniformMatrix4dv; swapped++; }
+        if (glad_glUniformMatrix2x3dv && glad_glUniformMatrix2x3dv != wrap_glUniformMatrix2x3dv) { real_glUniformMatrix2x3dv = glad_glUniformMatrix2x3dv; glad_glUniformMatrix2x3dv = wrap_glUniformMatrix2x3dv; swapped++; }
+        if (glad_glUniformMatrix2x4dv && glad_glUniformMatrix2x4dv != wrap_glUniformMatrix2x4dv) { real_glUniformMatrix2x4dv = glad_glUniformMatrix2x4dv; glad_glUniformMatrix2x4dv = wrap_glUniformMatrix2x4dv; swapped++; }
+        if (glad_glUniformMatrix3x2dv && glad_glUniformMatrix3x2dv != wrap_glUniformMatrix3x2dv) { real_glUniformMatrix3x2dv = glad_glUniformMatrix3x2dv; glad_glUniformMatrix3x2dv = wrap_glUniformMatrix3x2dv; swapped++; }
+        if (glad_glUniformMatrix3x4dv && glad_glUniformMatrix3x4dv != wrap_glUniformMatrix3x4dv) { real_glUniformMatrix3x4dv = glad_glUniformMatrix3x4dv; glad_glUniformMatrix3x4dv = wrap_glUniformMatrix3x4dv; swapped++; }
+        if (glad_glUniformMatrix4x2dv && glad_glUniformMatrix4x2dv != wrap_glUniformMatrix4x2dv) { real_glUniformMatrix4x2dv = glad_glUniformMatrix4x2dv; glad_glUniformMatrix4x2dv = wrap_glUniformMatrix4x2dv; swapped++; }
+        if (glad_glUniformMatrix4x3dv && glad_glUniformMatrix4x3dv != wrap_glUniformMatrix4x3dv) { real_glUniformMatrix4x3dv = glad_glUniformMatrix4x3dv; glad_glUniformMatrix4x3dv = wrap_glUniformMatrix4x3dv; swapped++; }
+        if (glad_glGetUniformdv && glad_glGetUniformdv != wrap_glGetUniformdv) { real_glGetUniformdv = glad_glGetUniformdv; glad_glGetUniformdv = wrap_glGetUniformdv; swapped++; }
+        if (glad_glGetSubroutineUniformLocation && glad_glGetSubroutineUniformLocation != wrap_glGetSubroutineUniformLocation) { real_glGetSubroutineUniformLocation = glad_glGetSubroutineUniformLocation; glad_glGetSubroutineUniformLocation = wrap_glGetSubroutineUniformLocation; swapped++; }
+        if (glad_glGetSubroutineIndex && glad_glGetSubroutineIndex != wrap_glGetSubroutineIndex) { real_glGetSubroutineIndex = glad_glGetSubroutineIndex; glad_glGetSubroutineIndex = wrap_glGetSubroutineIndex; swapped++; }
+        if (glad_glGetActiveSubroutineUniformiv && glad_glGetActiveSubroutineUniformiv != wrap_glGetActiveSubroutineUniformiv) { real_glGetActiveSubroutineUniformiv = glad_glGetActiveSubroutineUniformiv; glad_glGetActiveSubroutineUniformiv = wrap_glGetActiveSubroutineUniformiv; swapped++; }
+        if (glad_glGetActiveSubroutineUniformName && glad_glGetActiveSubroutineUniformName != wrap_glGetActiveSubroutineUniformName) { real_glGetActiveSubroutineUniformName = glad_glGetActiveSubroutineUniformName; glad_glGetActiveSubroutineUniformName = wrap_glGetActiveSubroutineUniformName; swapped++; }
+        if (glad_glGetActiveSubroutineName && glad_glGetActiveSubroutineName != wrap_glGetActiveSubroutineName) { real_glGetActiveSubroutineName = glad_glGetActiveSubroutineName; glad_glGetActiveSubroutineName = wrap_glGetActiveSubroutineName; swapped++; }
+        if (glad_glUniformSubroutinesuiv && glad_glUniformSubroutinesuiv != wrap_glUniformSubroutinesuiv) { real_glUniformSubroutinesuiv = glad_glUniformSubroutinesuiv; glad_glUniformSubroutinesuiv = wrap_glUniformSubroutinesuiv; swapped++; }
+        if (glad_glGetUniformSubroutineuiv && glad_glGetUniformSubroutineuiv != wrap_glGetUniformSubroutineuiv) { real_glGetUniformSubroutineuiv = glad_glGetUniformSubroutineuiv; glad_glGetUniformSubroutineuiv = wrap_glGetUniformSubroutineuiv; swapped++; }
+        if (glad_glGetProgramStageiv && glad_glGetProgramStageiv != wrap_glGetProgramStageiv) { real_glGetProgramStageiv = glad_glGetProgramStageiv; glad_glGetProgramStageiv = wrap_glGetProgramStageiv; swapped++; }
+        if (glad_glPatchParameteri && glad_glPatchParameteri != wrap_glPatchParameteri) { real_glPatchParameteri = glad_glPatchParameteri; glad_glPatchParameteri = wrap_glPatchParameteri; swapped++; }
+        if (glad_glPatchParameterfv && glad_glPatchParameterfv != wrap_glPatchParameterfv) { real_glPatchParameterfv = glad_glPatchParameterfv; glad_glPatchParameterfv = wrap_glPatchParameterfv; swapped++; }
+        if (glad_glBindTransformFeedback && glad_glBindTransformFeedback != wrap_glBindTransformFeedback) { real_glBindTransformFeedback = glad_glBindTransformFeedback; glad_glBindTransformFeedback = wrap_glBindTransformFeedback; swapped++; }
+        if (glad_glDeleteTransformFeedbacks && glad_glDeleteTransformFeedbacks != wrap_glDeleteTransformFeedbacks) { real_glDeleteTransformFeedbacks = glad_glDeleteTransformFeedbacks; glad_glDeleteTransformFeedbacks = wrap_glDeleteTransformFeedbacks; swapped++; }
+        if (glad_glGenTransformFeedbacks && glad_glGenTransformFeedbacks != wrap_glGenTransformFeedbacks) { real_glGenTransformFeedbacks = glad_glGenTransformFeedbacks; glad_glGenTransformFeedbacks = wrap_glGenTransformFeedbacks; swapped++; }
+        if (glad_glIsTransformFeedback && glad_glIsTransformFeedback != wrap_glIsTransformFeedback) { real_glIsTransformFeedback = glad_glIsTransformFeedback; glad_glIsTransformFeedback = wrap_glIsTransformFeedback; swapped++; }
+        if (glad_glPauseTransformFeedback && glad_glPauseTransformFeedback != wrap_glPauseTransformFeedback) { real_glPauseTransformFeedback = glad_glPauseTransformFeedback; glad_glPauseTransformFeedback = wrap_glPauseTransformFeedback; swapped++; }
+        if (glad_glResumeTransformFeedback && glad_glResumeTransformFeedback != wrap_glResumeTransformFeedback) { real_glResumeTransformFeedback = glad_glResumeTransformFeedback; glad_glResumeTransformFeedback = wrap_glResumeTransformFeedback; swapped++; }
+        if (glad_glDrawTransformFeedback && glad_glDrawTransformFeedback != wrap_glDrawTransformFeedback) { real_glDrawTransformFeedback = glad_glDrawTransformFeedback; glad_glDrawTransformFeedback = wrap_glDrawTransformFeedback; swapped++; }
+        if (glad_glDrawTransformFeedbackStream && glad_glDrawTransformFeedbackStream != wrap_glDrawTransformFeedbackStream) { real_glDrawTransformFeedbackStream = glad_glDrawTransformFeedbackStream; glad_glDrawTransformFeedbackStream = wrap_glDrawTransformFeedbackStream; swapped++; }
+        if (glad_glBeginQueryIndexed && glad_glBeginQueryIndexed != wrap_glBeginQueryIndexed) { real_glBeginQueryIndexed = glad_glBeginQueryIndexed; glad_glBeginQueryIndexed = wrap_glBeginQueryIndexed; swapped++; }
+        if (glad_glEndQueryIndexed && glad_glEndQueryIndexed != wrap_glEndQueryIndexed) { real_glEndQueryIndexed = glad_glEndQueryIndexed; glad_glEndQueryIndexed = wrap_glEndQueryIndexed; swapped++; }
+        if (glad_glGetQueryIndexediv && glad_glGetQueryIndexediv != wrap_glGetQueryIndexediv) { real_glGetQueryIndexediv = glad_glGetQueryIndexediv; glad_glGetQueryIndexediv = wrap_glGetQueryIndexediv; swapped++; }
+        if (glad_glReleaseShaderCompiler && glad_glReleaseShaderCompiler != wrap_glReleaseShaderCompiler) { real_glReleaseShaderCompiler = glad_glReleaseShaderCompiler; glad_glReleaseShaderCompiler = wrap_glReleaseShaderCompiler; swapped++; }
+        if (glad_glShaderBinary && glad_glShaderBinary != wrap_glShaderBinary) { real_glShaderBinary = glad_glShaderBinary; glad_glShaderBinary = wrap_glShaderBinary; swapped++; }
+        if (glad_glGetShaderPrecisionFormat && glad_glGetShaderPrecisionFormat != wrap_glGetShaderPrecisionFormat) { real_glGetShaderPrecisionFormat = glad_glGetShaderPrecisionFormat; glad_glGetShaderPrecisionFormat = wrap_glGetShaderPrecisionFormat; swapped++; }
+        if (glad_glDepthRangef && glad_glDepthRangef != wrap_glDepthRangef) { real_glDepthRangef = glad_glDepthRangef; glad_glDepthRangef = wrap_glDepthRangef; swapped++; }
+        if (glad_glClearDepthf && glad_glClearDepthf != wrap_glClearDepthf) { real_glClearDepthf = glad_glClearDepthf; glad_glClearDepthf = wrap_glClearDepthf; swapped++; }
+        if (glad_glGetProgramBinary && glad_glGetProgramBinary != wrap_glGetProgramBinary) { real_glGetProgramBinary = glad_glGetProgramBinary; glad_glGetProgramBinary = wrap_glGetProgramBinary; swapped++; }
+        if (glad_glProgramBinary && glad_glProgramBinary != wrap_glProgramBinary) { real_glProgramBinary = glad_glProgramBinary; glad_glProgramBinary = wrap_glProgramBinary; swapped++; }
+        if (glad_glProgramParameteri && glad_glProgramParameteri != wrap_glProgramParameteri) { real_glProgramParameteri = glad_glProgramParameteri; glad_glProgramParameteri = wrap_glProgramParameteri; swapped++; }
+        if (glad_glUseProgramStages && glad_glUseProgramStages != wrap_glUseProgramStages) { real_glUseProgramStages = glad_glUseProgramStages; glad_glUseProgramStages = wrap_glUseProgramStages; swapped++; }
+        if (glad_glActiveShaderProgram && glad_glActiveShaderProgram != wrap_glActiveShaderProgram) { real_glActiveShaderProgram = glad_glActiveShaderProgram; glad_glActiveShaderProgram = wrap_glActiveShaderProgram; swapped++; }
+        if (glad_glCreateShaderProgramv && glad_glCreateShaderProgramv != wrap_glCreateShaderProgramv) { real_glCreateShaderProgramv = glad_glCreateShaderProgramv; glad_glCreateShaderProgramv = wrap_glCreateShaderProgramv; swapped++; }
+        if (glad_glBindProgramPipeline && glad_glBindProgramPipeline != wrap_glBindProgramPipeline) { real_glBindProgramPipeline = glad_glBindProgramPipeline; glad_glBindProgramPipeline = wrap_glBindProgramPipeline; swapped++; }
+        if (glad_glDeleteProgramPipelines && glad_glDeleteProgramPipelines != wrap_glDeleteProgramPipelines) { real_glDeleteProgramPipelines = glad_glDeleteProgramPipelines; glad_glDeleteProgramPipelines = wrap_glDeleteProgramPipelines; swapped++; }
+        if (glad_glGenProgramPipelines && glad_glGenProgramPipelines != wrap_glGenProgramPipelines) { real_glGenProgramPipelines = glad_glGenProgramPipelines; glad_glGenProgramPipelines = wrap_glGenProgramPipelines; swapped++; }
+        if (glad_glIsProgramPipeline && glad_glIsProgramPipeline != wrap_glIsProgramPipeline) { real_glIsProgramPipeline = glad_glIsProgramPipeline; glad_glIsProgramPipeline = wrap_glIsProgramPipeline; swapped++; }
+        if (glad_glGetProgramPipelineiv && glad_glGetProgramPipelineiv != wrap_glGetProgramPipelineiv) { real_glGetProgramPipelineiv = glad_glGetProgramPipelineiv; glad_glGetProgramPipelineiv = wrap_glGetProgramPipelineiv; swapped++; }
+        if (glad_glProgramUniform1i && glad_glProgramUniform1i != wrap_glProgramUniform1i) { real_glProgramUniform1i = glad_glProgramUniform1i; glad_glProgramUniform1i = wrap_glProgramUniform1i; swapped++; }
+        if (glad_glProgramUniform1iv && glad_glProgramUniform1iv != wrap_glProgramUniform1iv) { real_glProgramUniform1iv = glad_glProgramUniform1iv; glad_glProgramUniform1iv = wrap_glProgramUniform1iv; swapped++; }
+        if (glad_glProgramUniform1f && glad_glProgramUniform1f != wrap_glProgramUniform1f) { real_glProgramUniform1f = glad_glProgramUniform1f; glad_glProgramUniform1f = wrap_glProgramUniform1f; swapped++; }
+        if (glad_glProgramUniform1fv && glad_glProgramUniform1fv != wrap_glProgramUniform1fv) { real_glProgramUniform1fv = glad_glProgramUniform1fv; glad_glProgramUniform1fv = wrap_glProgramUniform1fv; swapped++; }
+        if (glad_glProgramUniform1d && glad_glProgramUniform1d != wrap_glProgramUniform1d) { real_glProgramUniform1d = glad_glProgramUniform1d; glad_glProgramUniform1d = wrap_glProgramUniform1d; swapped++; }
+        if (glad_glProgramUniform1dv && glad_glProgramUniform1dv != wrap_glProgramUniform1dv) { real_glProgramUniform1dv = glad_glProgramUniform1dv; glad_glProgramUniform1dv = wrap_glProgramUniform1dv; swapped++; }
+        if (glad_glProgramUniform1ui && glad_glProgramUniform1ui != wrap_glProgramUniform1ui) { real_glProgramUniform1ui = glad_glProgramUniform1ui; glad_glProgramUniform1ui = wrap_glProgramUniform1ui; swapped++; }
+        if (glad_glProgramUniform1uiv && glad_glProgramUniform1uiv != wrap_glProgramUniform1uiv) { real_glProgramUniform1uiv = glad_glProgramUniform1uiv; glad_glProgramUniform1uiv = wrap_glProgramUniform1uiv; swapped++; }
+        if (glad_glProgramUniform2i && glad_glProgramUniform2i != wrap_glProgramUniform2i) { real_glProgramUniform2i = glad_glProgramUniform2i; glad_glProgramUniform2i = wrap_glProgramUniform2i; swapped++; }
+        if (glad_glProgramUniform2iv && glad_glProgramUniform2iv != wrap_glProgramUniform2iv) { real_glProgramUniform2iv = glad_glProgramUniform2iv; glad_glProgramUniform2iv = wrap_glProgramUniform2iv; swapped++; }
+        if (glad_glProgramUniform2f && glad_glProgramUniform2f != wrap_glProgramUniform2f) { real_glProgramUniform2f = glad_glProgramUniform2f; glad_glProgramUniform2f = wrap_glProgramUniform2f; swapped++; }
+        if (glad_glProgramUniform2fv && glad_glProgramUniform2fv != wrap_glProgramUniform2fv) { real_glProgramUniform2fv = glad_glProgramUniform2fv; glad_glProgramUniform2fv = wrap_glProgramUniform2fv; swapped++; }
+        if (glad_glProgramUniform2d && glad_glProgramUniform2d != wrap_glProgramUniform2d) { real_glProgramUniform2d = glad_glProgramUniform2d; glad_glProgramUniform2d = wrap_glProgramUniform2d; swapped++; }
+        if (glad_glProgramUniform2dv && glad_glProgramUniform2dv != wrap_glProgramUniform2dv) { real_glProgramUniform2dv = glad_glProgramUniform2dv; glad_glProgramUniform2dv = wrap_glProgramUniform2dv; swapped++; }
+        if (glad_glProgramUniform2ui && glad_glProgramUniform2ui != wrap_glProgramUniform2ui) { real_glProgramUniform2ui = glad_glProgramUniform2ui; glad_glProgramUniform2ui = wrap_glProgramUniform2ui; swapped++; }
+        if (glad_glProgramUniform2uiv && glad_glProgramUniform2uiv != wrap_glProgramUniform2uiv) { real_glProgramUniform2uiv = glad_glProgramUniform2uiv; glad_glProgramUniform2uiv = wrap_glProgramUniform2uiv; swapped++; }
+        if (glad_glProgramUniform3i && glad_glProgramUniform3i != wrap_glProgramUniform3i) { real_glProgramUniform3i = glad_glProgramUniform3i; glad_glProgramUniform3i = wrap_glProgramUniform3i; swapped++; }
+        if (glad_glProgramUniform3iv && glad_glProgramUniform3iv != wrap_glProgramUniform3iv) { real_glProgramUniform3iv = glad_glProgramUniform3iv; glad_glProgramUniform3iv = wrap_glProgramUniform3iv; swapped++; }
+        if (glad_glProgramUniform3f && glad_glProgramUniform3f != wrap_glProgramUniform3f) { real_glProgramUniform3f = glad_glProgramUniform3f; glad_glProgramUniform3f = wrap_glProgramUniform3f; swapped++; }
+        if (glad_glProgramUniform3fv && glad_glProgramUniform3fv != wrap_glProgramUniform3fv) { real_glProgramUniform3fv = glad_glProgramUniform3fv; glad_glProgramUniform3fv = wrap_glProgramUniform3fv; swapped++; }
+        if (glad_glProgramUniform3d && glad_glProgramUniform3d != wrap_glProgramUniform3d) { real_glProgramUniform3d = glad_glProgramUniform3d; glad_glProgramUniform3d = wrap_glProgramUniform3d; swapped++; }
+        if (glad_glProgramUniform3dv && glad_glProgramUniform3dv != wrap_glProgramUniform3dv) { real_glProgramUniform3dv = glad_glProgramUniform3dv; glad_glProgramUniform3dv = wrap_glProgramUniform3dv; swapped++; }
+        if (glad_glProgramUniform3ui && glad_glProgramUniform3ui != wrap_glProgramUniform3ui) { real_glProgramUniform3ui = glad_glProgramUniform3ui; glad_glProgramUniform3ui = wrap_glProgramUniform3ui; swapped++; }
+        if (glad_glProgramUniform3uiv && glad_glProgramUniform3uiv != wrap_glProgramUniform3uiv) { real_glProgramUniform3uiv = glad_glProgramUniform3uiv; glad_glProgramUniform3uiv = wrap_glProgramUniform3uiv; swapped++; }
+        if (glad_glProgramUniform4i && glad_glProgramUniform4i != wrap_glProgramUniform4i) { real_glProgramUniform4i = glad_glProgramUniform4i; glad_glProgramUniform4i = wrap_glProgramUniform4i; swapped++; }
+        if (glad_glProgramUniform4iv && glad_glProgramUniform4iv != wrap_glProgramUniform4iv) { real_glProgramUniform4iv = glad_glProgramUniform4iv; glad_glProgramUniform4iv = wrap_glProgramUniform4iv; swapped++; }
+        if (glad_glProgramUniform4f && glad_glProgramUniform4f != wrap_glProgramUniform4f) { real_glProgramUniform4f = glad_glProgramUniform4f; glad_glProgramUniform4f = wrap_glProgramUniform4f; swapped++; }
+        if (glad_glProgramUniform4fv && glad_glProgramUniform4fv != wrap_glProgramUniform4fv) { real_glProgramUniform4fv = glad_glProgramUniform4fv; glad_glProgramUniform4fv = wrap_glProgramUniform4fv; swapped++; }
+        if (glad_glProgramUniform4d && glad_glProgramUniform4d != wrap_glProgramUniform4d) { real_glProgramUniform4d = glad_glProgramUniform4d; glad_glProgramUniform4d = wrap_glProgramUniform4d; swapped++; }
+        if (glad_glProgramUniform4dv && glad_glProgramUniform4dv != wrap_glProgramUniform4dv) { real_glProgramUniform4dv = glad_glProgramUniform4dv; glad_glProgramUniform4dv = wrap_glProgramUniform4dv; swapped++; }
+        if (glad_glProgramUniform4ui && glad_glProgramUniform4ui != wrap_glProgramUniform4ui) { real_glProgramUniform4ui = glad_glProgramUniform4ui; glad_glProgramUniform4ui = wrap_glProgramUniform4ui; swapped++; }
+        if (glad_glProgramUniform4uiv && glad_glProgramUniform4uiv != wrap_glProgramUniform4uiv) { real_glProgramUniform4uiv = glad_glProgramUniform4uiv; glad_glProgramUniform4uiv = wrap_glProgramUniform4uiv; swapped++; }
+        if (glad_glProgramUniformMatrix2fv && glad_glProgramUniformMatrix2fv != wrap_glProgramUniformMatrix2fv) { real_glProgramUniformMatrix2fv = glad_glProgramUniformMatrix2fv; glad_glProgramUniformMatrix2fv = wrap_glProgramUniformMatrix2fv; swapped++; }
+        if (glad_glProgramUniformMatrix3fv && glad_glProgramUniformMatrix3fv != wrap_glProgramUniformMatrix3fv) { real_glProgramUniformMatrix3fv = glad_glProgramUniformMatrix3fv; glad_glProgramUniformMatrix3fv = wrap_glProgramUniformMatrix3fv; swapped++; }
+        if (glad_glProgramUniformMatrix4fv && glad_glProgramUniformMatrix4fv != wrap_glProgramUniformMatrix4fv) { real_glProgramUniformMatrix4fv = glad_glProgramUniformMatrix4fv; glad_glProgramUniformMatrix4fv = wrap_glProgramUniformMatrix4fv; swapped++; }
+        if (glad_glProgramUniformMatrix2dv && glad_glProgramUniformMatrix2dv != wrap_glProgramUniformMatrix2dv) { real_glProgramUniformMatrix2dv = glad_glProgramUniformMatrix2dv; glad_glProgramUniformMatrix2dv = wrap_glProgramUniformMatrix2dv; swapped++; }
+        if (glad_glProgramUniformMatrix3dv && glad_glProgramUniformMatrix3dv != wrap_glProgramUniformMatrix3dv) { real_glProgramUniformMatrix3dv = glad_glProgramUniformMatrix3dv; glad_glProgramUniformMatrix3dv = wrap_glProgramUniformMatrix3dv; swapped++; }
+        if (glad_glProgramUniformMatrix4dv && glad_glProgramUniformMatrix4dv != wrap_glProgramUniformMatrix4dv) { real_glProgramUniformMatrix4dv = glad_glProgramUniformMatrix4dv; glad_glProgramUniformMatrix4dv = wrap_glProgramUniformMatrix4dv; swapped++; }
+        if (glad_glProgramUniformMatrix2x3fv && glad_glProgramUniformMatrix2x3fv != wrap_glProgramUniformMatrix2x3fv) { real_glProgramUniformMatrix2x3fv = glad_glProgramUniformMatrix2x3fv; glad_glProgramUniformMatrix2x3fv = wrap_glProgramUniformMatrix2x3fv; swapped++; }
+        if (glad_glProgramUniformMatrix3x2fv && glad_glProgramUniformMatrix3x2fv != wrap_glProgramUniformMatrix3x2fv) { real_glProgramUniformMatrix3x2fv = glad_glProgramUniformMatrix3x2fv; glad_glProgramUniformMatrix3x2fv = wrap_glProgramUniformMatrix3x2fv; swapped++; }
+        if (glad_glProgramUniformMatrix2x4fv && glad_glProgramUniformMatrix2x4fv != wrap_glProgramUniformMatrix2x4fv) { real_glProgramUniformMatrix2x4fv = glad_glProgramUniformMatrix2x4fv; glad_glProgramUniformMatrix2x4fv = wrap_glProgramUniformMatrix2x4fv; swapped++; }
+        if (glad_glProgramUniformMatrix4x2fv && glad_glProgramUniformMatrix4x2fv != wrap_glProgramUniformMatrix4x2fv) { real_glProgramUniformMatrix4x2fv = glad_glProgramUniformMatrix4x2fv; glad_glProgramUniformMatrix4x2fv = wrap_glProgramUniformMatrix4x2fv; swapped++; }
+        if (glad_glProgramUniformMatrix3x4fv && glad_glProgramUniformMatrix3x4fv != wrap_glProgramUniformMatrix3x4fv) { real_glProgramUniformMatrix3x4fv = glad_glProgramUniformMatrix3x4fv; glad_glProgramUniformMatrix3x4fv = wrap_glProgramUniformMatrix3x4fv; swapped++; }
+        if (glad_glProgramUniformMatrix4x3fv && glad_glProgramUniformMatrix4x3fv != wrap_glProgramUniformMatrix4x3fv) { real_glProgramUniformMatrix4x3fv = glad_glProgramUniformMatrix4x3fv; glad_glProgramUniformMatrix4x3fv = wrap_glProgramUniformMatrix4x3fv; swapped++; }
+        if (glad_glProgramUniformMatrix2x3dv && glad_glProgramUniformMatrix2x3dv != wrap_glProgramUniformMatrix2x3dv) { real_glProgramUniformMatrix2x3dv = glad_glProgramUniformMatrix2x3dv; glad_glProgramUniformMatrix2x3dv = wrap_glProgramUniformMatrix2x3dv; swapped++; }
+        if (glad_glProgramUniformMatrix3x2dv && glad_glProgramUniformMatrix3x2dv != wrap_glProgramUniformMatrix3x2dv) { real_glProgramUniformMatrix3x2dv = glad_glProgramUniformMatrix3x2dv; glad_glProgramUniformMatrix3x2dv = wrap_glProgramUniformMatrix3x2dv; swapped++; }
+        if (glad_glProgramUniformMatrix2x4dv && glad_glProgramUniformMatrix2x4dv != wrap_glProgramUniformMatrix2x4dv) { real_glProgramUniformMatrix2x4dv = glad_glProgramUniformMatrix2x4dv; glad_glProgramUniformMatrix2x4dv = wrap_glProgramUniformMatrix2x4dv; swapped++; }
+        if (glad_glProgramUniformMatrix4x2dv && glad_glProgramUniformMatrix4x2dv != wrap_glProgramUniformMatrix4x2dv) { real_glProgramUniformMatrix4x2dv = glad_glProgramUniformMatrix4x2dv; glad_glProgramUniformMatrix4x2dv = wrap_glProgramUniformMatrix4x2dv; swapped++; }
+        if (glad_glProgramUniformMatrix3x4dv && glad_glProgramUniformMatrix3x4dv != wrap_glProgramUniformMatrix3x4dv) { real_glProgramUniformMatrix3x4dv = glad_glProgramUniformMatrix3x4dv; glad_glProgramUniformMatrix3x4dv = wrap_glProgramUniformMatrix3x4dv; swapped++; }
+        if (glad_glProgramUniformMatrix4x3dv && glad_glProgramUniformMatrix4x3dv != wrap_glProgramUniformMatrix4x3dv) { real_glProgramUniformMatrix4x3dv = glad_glProgramUniformMatrix4x3dv; glad_glProgramUniformMatrix4x3dv = wrap_glProgramUniformMatrix4x3dv; swapped++; }
+        if (glad_glValidateProgramPipeline && glad_glValidateProgramPipeline != wrap_glValidateProgramPipeline) { real_glValidateProgramPipeline = glad_glValidateProgramPipeline; glad_glValidateProgramPipeline = wrap_glValidateProgramPipeline; swapped++; }
+        if (glad_glGetProgramPipelineInfoLog && glad_glGetProgramPipelineInfoLog != wrap_glGetProgramPipelineInfoLog) { real_glGetProgramPipelineInfoLog = glad_glGetProgramPipelineInfoLog; glad_glGetProgramPipelineInfoLog = wrap_glGetProgramPipelineInfoLog; swapped++; }
+        if (glad_glVertexAttribL1d && glad_glVertexAttribL1d != wrap_glVertexAttribL1d) { real_glVertexAttribL1d = glad_glVertexAttribL1d; glad_glVertexAttribL1d = wrap_glVertexAttribL1d; swapped++; }
+        if (glad_glVertexAttribL2d && glad_glVertexAttribL2d != wrap_glVertexAttribL2d) { real_glVertexAttribL2d = glad_glVertexAttribL2d; glad_glVertexAttribL2d = wrap_glVertexAttribL2d; swapped++; }
+        if (glad_glVertexAttribL3d && glad_glVertexAttribL3d != wrap_glVertexAttribL3d) { real_glVertexAttribL3d = glad_glVertexAttribL3d; glad_glVertexAttribL3d = wrap_glVertexAttribL3d; swapped++; }
+        if (glad_glVertexAttribL4d && glad_glVertexAttribL4d != wrap_glVertexAttribL4d) { real_glVertexAttribL4d = glad_glVertexAttribL4d; glad_glVertexAttribL4d = wrap_glVertexAttribL4d; swapped++; }
+        if (glad_glVertexAttribL1dv && glad_glVertexAttribL1dv != wrap_glVertexAttribL1dv) { real_glVertexAttribL1dv = glad_glVertexAttribL1dv; glad_glVertexAttribL1dv = wrap_glVertexAttribL1dv; swapped++; }
+        if (glad_glVertexAttribL2dv && glad_glVertexAttribL2dv != wrap_glVertexAttribL2dv) { real_glVertexAttribL2dv = glad_glVertexAttribL2dv; glad_glVertexAttribL2dv = wrap_glVertexAttribL2dv; swapped++; }
+        if (glad_glVertexAttribL3dv && glad_glVertexAttribL3dv != wrap_glVertexAttribL3dv) { real_glVertexAttribL3dv = glad_glVertexAttribL3dv; glad_glVertexAttribL3dv = wrap_glVertexAttribL3dv; swapped++; }
+        if (glad_glVertexAttribL4dv && glad_glVertexAttribL4dv != wrap_glVertexAttribL4dv) { real_glVertexAttribL4dv = glad_glVertexAttribL4dv; glad_glVertexAttribL4dv = wrap_glVertexAttribL4dv; swapped++; }
+        if (glad_glVertexAttribLPointer && glad_glVertexAttribLPointer != wrap_glVertexAttribLPointer) { real_glVertexAttribLPointer = glad_glVertexAttribLPointer; glad_glVertexAttribLPointer = wrap_glVertexAttribLPointer; swapped++; }
+        if (glad_glGetVertexAttribLdv && glad_glGetVertexAttribLdv != wrap_glGetVertexAttribLdv) { real_glGetVertexAttribLdv = glad_glGetVertexAttribLdv; glad_glGetVertexAttribLdv = wrap_glGetVertexAttribLdv; swapped++; }
+        if (glad_glViewportArrayv && glad_glViewportArrayv != wrap_glViewportArrayv) { real_glViewportArrayv = glad_glViewportArrayv; glad_glViewportArrayv = wrap_glViewportArrayv; swapped++; }
+        if (glad_glViewportIndexedf && glad_glViewportIndexedf != wrap_glViewportIndexedf) { real_glViewportIndexedf = glad_glViewportIndexedf; glad_glViewportIndexedf = wrap_glViewportIndexedf; swapped++; }
+        if (glad_glViewportIndexedfv && glad_glViewportIndexedfv != wrap_glViewportIndexedfv) { real_glViewportIndexedfv = glad_glViewportIndexedfv; glad_glViewportIndexedfv = wrap_glViewportIndexedfv; swapped++; }
+        if (glad_glScissorArrayv && glad_glScissorArrayv != wrap_glScissorArrayv) { real_glScissorArrayv = glad_glScissorArrayv; glad_glScissorArrayv = wrap_glScissorArrayv; swapped++; }
+        if (glad_glScissorIndexed && glad_glScissorIndexed != wrap_glScissorIndexed) { real_glScissorIndexed = glad_glScissorIndexed; glad_glScissorIndexed = wrap_glScissorIndexed; swapped++; }
+        if (glad_glScissorIndexedv && glad_glScissorIndexedv != wrap_glScissorIndexedv) { real_glScissorIndexedv = glad_glScissorIndexedv; glad_glScissorIndexedv = wrap_glScissorIndexedv; swapped++; }
+        if (glad_glDepthRangeArrayv && glad_glDepthRangeArrayv != wrap_glDepthRangeArrayv) { real_glDepthRangeArrayv = glad_glDepthRangeArrayv; glad_glDepthRangeArrayv = wrap_glDepthRangeArrayv; swapped++; }
+        if (glad_glDepthRangeIndexed && glad_glDepthRangeIndexed != wrap_glDepthRangeIndexed) { real_glDepthRangeIndexed = glad_glDepthRangeIndexed; glad_glDepthRangeIndexed = wrap_glDepthRangeIndexed; swapped++; }
+        if (glad_glGetFloati_v && glad_glGetFloati_v != wrap_glGetFloati_v) { real_glGetFloati_v = glad_glGetFloati_v; glad_glGetFloati_v = wrap_glGetFloati_v; swapped++; }
+        if (glad_glGetDoublei_v && glad_glGetDoublei_v != wrap_glGetDoublei_v) { real_glGetDoublei_v = glad_glGetDoublei_v; glad_glGetDoublei_v = wrap_glGetDoublei_v; swapped++; }
+        if (glad_glDrawArraysInstancedBaseInstance && glad_glDrawArraysInstancedBaseInstance != wrap_glDrawArraysInstancedBaseInstance) { real_glDrawArraysInstancedBaseInstance = glad_glDrawArraysInstancedBaseInstance; glad_glDrawArraysInstancedBaseInstance = wrap_glDrawArraysInstancedBaseInstance; swapped++; }
+        if (glad_glDrawElementsInstancedBaseInstance && glad_glDrawElementsInstancedBaseInstance != wrap_glDrawElementsInstancedBaseInstance) { real_glDrawElementsInstancedBaseInstance = glad_glDrawElementsInstancedBaseInstance; glad_glDrawElementsInstancedBaseInstance = wrap_glDrawElementsInstancedBaseInstance; swapped++; }
+        if (glad_glDrawElementsInstancedBaseVertexBaseInstance && glad_glDrawElementsInstancedBaseVertexBaseInstance != wrap_glDrawElementsInstancedBaseVertexBaseInstance) { real_glDrawElementsInstancedBaseVertexBaseInstance = glad_glDrawElementsInstancedBaseVertexBaseInstance; glad_glDrawElementsInstancedBaseVertexBaseInstance = wrap_glDrawElementsInstancedBaseVertexBaseInstance; swapped++; }
+        if (glad_glGetInternalformativ && glad_glGetInternalformativ != wrap_glGetInternalformativ) { real_glGetInternalformativ = glad_glGetInternalformativ; glad_glGetInternalformativ = wrap_glGetInternalformativ; swapped++; }
+        if (glad_glGetActiveAtomicCounterBufferiv && glad_glGetActiveAtomicCounterBufferiv != wrap_glGetActiveAtomicCounterBufferiv) { real_glGetActiveAtomicCounterBufferiv = glad_glGetActiveAtomicCounterBufferiv; glad_glGetActiveAtomicCounterBufferiv = wrap_glGetActiveAtomicCounterBufferiv; swapped++; }
+        if (glad_glBindImageTexture && glad_glBindImageTexture != wrap_glBindImageTexture) { real_glBindImageTexture = glad_glBindImageTexture; glad_glBindImageTexture = wrap_glBindImageTexture; swapped++; }
+        if (glad_glMemoryBarrier && glad_glMemoryBarrier != wrap_glMemoryBarrier) { real_glMemoryBarrier = glad_glMemoryBarrier; glad_glMemoryBarrier = wrap_glMemoryBarrier; swapped++; }
+        if (glad_glTexStorage1D && glad_glTexStorage1D != wrap_glTexStorage1D) { real_glTexStorage1D = glad_glTexStorage1D; glad_glTexStorage1D = wrap_glTexStorage1D; swapped++; }
+        if (glad_glTexStorage2D && glad_glTexStorage2D != wrap_glTexStorage2D) { real_glTexStorage2D = glad_glTexStorage2D; glad_glTexStorage2D = wrap_glTexStorage2D; swapped++; }
+        if (glad_glTexStorage3D && glad_glTexStorage3D != wrap_glTexStorage3D) { real_glTexStorage3D = glad_glTexStorage3D; glad_glTexStorage3D = wrap_glTexStorage3D; swapped++; }
+        if (glad_glDrawTransformFeedbackInstanced && glad_glDrawTransformFeedbackInstanced != wrap_glDrawTransformFeedbackInstanced) { real_glDrawTransformFeedbackInstanced = glad_glDrawTransformFeedbackInstanced; glad_glDrawTransformFeedbackInstanced = wrap_glDrawTransformFeedbackInstanced; swapped++; }
+        if (glad_glDrawTransformFeedbackStreamInstanced && glad_glDrawTransformFeedbackStreamInstanced != wrap_glDrawTransformFeedbackStreamInstanced) { real_glDrawTransformFeedbackStreamInstanced = glad_glDrawTransformFeedbackStreamInstanced; glad_glDrawTransformFeedbackStreamInstanced = wrap_glDrawTransformFeedbackStreamInstanced; swapped++; }
+        if (glad_glClearBufferData && glad_glClearBufferData != wrap_glClearBufferData) { real_glClearBufferData = glad_glClearBufferData; glad_glClearBufferData = wrap_glClearBufferData; swapped++; }
+        if (glad_glClearBufferSubData && glad_glClearBufferSubData != wrap_glClearBufferSubData) { real_glClearBufferSubData = glad_glClearBufferSubData; glad_glClearBufferSubData = wrap_glClearBufferSubData; swapped++; }
+        if (glad_glDispatchCompute && glad_glDispatchCompute != wrap_glDispatchCompute) { real_glDispatchCompute = glad_glDispatchCompute; glad_glDispatchCompute = wrap_glDispatchCompute; swapped++; }
+        if (glad_glDispatchComputeIndirect && glad_glDispatchComputeIndirect != wrap_glDispatchComputeIndirect) { real_glDispatchComputeIndirect = glad_glDispatchComputeIndirect; glad_glDispatchComputeIndirect = wrap_glDispatchComputeIndirect; swapped++; }
+        if (glad_glCopyImageSubData && glad_glCopyImageSubData != wrap_glCopyImageSubData) { real_glCopyImageSubData = glad_glCopyImageSubData; glad_glCopyImageSubData = wrap_glCopyImageSubData; swapped++; }
+        if (glad_glFramebufferParameteri && glad_glFramebufferParameteri != wrap_glFramebufferParameteri) { real_glFramebufferParameteri = glad_glFramebufferParameteri; glad_glFramebufferParameteri = wrap_glFramebufferParameteri; swapped++; }
+        if (glad_glGetFramebufferParameteriv && glad_glGetFramebufferParameteriv != wrap_glGetFramebufferParameteriv) { real_glGetFramebufferParameteriv = glad_glGetFramebufferParameteriv; glad_glGetFramebufferParameteriv = wrap_glGetFramebufferParameteriv; swapped++; }
+        if (glad_glGetInternalformati64v && glad_glGetInternalformati64v != wrap_glGetInternalformati64v) { real_glGetInternalformati64v = glad_glGetInternalformati64v; glad_glGetInternalformati64v = wrap_glGetInternalformati64v; swapped++; }
+        if (glad_glInvalidateTexSubImage && glad_glInvalidateTexSubImage != wrap_glInvalidateTexSubImage) { real_glInvalidateTexSubImage = glad_glInvalidateTexSubImage; glad_glInvalidateTexSubImage = wrap_glInvalidateTexSubImage; swapped++; }
+        if (glad_glInvalidateTexImage && glad_glInvalidateTexImage != wrap_glInvalidateTexImage) { real_glInvalidateTexImage = glad_glInvalidateTexImage; glad_glInvalidateTexImage = wrap_glInvalidateTexImage; swapped++; }
+        if (glad_glInvalidateBufferSubData && glad_glInvalidateBufferSubData != wrap_glInvalidateBufferSubData) { real_glInvalidateBufferSubData = glad_glInvalidateBufferSubData; glad_glInvalidateBufferSubData = wrap_glInvalidateBufferSubData; swapped++; }
+        if (glad_glInvalidateBufferData && glad_glInvalidateBufferData != wrap_glInvalidateBufferData) { real_glInvalidateBufferData = glad_glInvalidateBufferData; glad_glInvalidateBufferData = wrap_glInvalidateBufferData; swapped++; }
+        if (glad_glInvalidateFramebuffer && glad_glInvalidateFramebuffer != wrap_glInvalidateFramebuffer) { real_glInvalidateFramebuffer = glad_glInvalidateFramebuffer; glad_glInvalidateFramebuffer = wrap_glInvalidateFramebuffer; swapped++; }
+        if (glad_glInvalidateSubFramebuffer && glad_glInvalidateSubFramebuffer != wrap_glInvalidateSubFramebuffer) { real_glInvalidateSubFramebuffer = glad_glInvalidateSubFramebuffer; glad_glInvalidateSubFramebuffer = wrap_glInvalidateSubFramebuffer; swapped++; }
+        if (glad_glMultiDrawArraysIndirect && glad_glMultiDrawArraysIndirect != wrap_glMultiDrawArraysIndirect) { real_glMultiDrawArraysIndirect = glad_glMultiDrawArraysIndirect; glad_glMultiDrawArraysIndirect = wrap_glMultiDrawArraysIndirect; swapped++; }
+        if (glad_glMultiDrawElementsIndirect && glad_glMultiDrawElementsIndirect != wrap_glMultiDrawElementsIndirect) { real_glMultiDrawElementsIndirect = glad_glMultiDrawElementsIndirect; glad_glMultiDrawElementsIndirect = wrap_glMultiDrawElementsIndirect; swapped++; }
+        if (glad_glGetProgramInterfaceiv && glad_glGetProgramInterfaceiv != wrap_glGetProgramInterfaceiv) { real_glGetProgramInterfaceiv = glad_glGetProgramInterfaceiv; glad_glGetProgramInterfaceiv = wrap_glGetProgramInterfaceiv; swapped++; }
+        if (glad_glGetProgramResourceIndex && glad_glGetProgramResourceIndex != wrap_glGetProgramResourceIndex) { real_glGetProgramResourceIndex = glad_glGetProgramResourceIndex; glad_glGetProgramResourceIndex = wrap_glGetProgramResourceIndex; swapped++; }
+        if (glad_glGetProgramResourceName && glad_glGetProgramResourceName != wrap_glGetProgramResourceName) { real_glGetProgramResourceName = glad_glGetProgramResourceName; glad_glGetProgramResourceName = wrap_glGetProgramResourceName; swapped++; }
+        if (glad_glGetProgramResourceiv && glad_glGetProgramResourceiv != wrap_glGetProgramResourceiv) { real_glGetProgramResourceiv = glad_glGetProgramResourceiv; glad_glGetProgramResourceiv = wrap_glGetProgramResourceiv; swapped++; }
+        if (glad_glGetProgramResourceLocation && glad_glGetProgramResourceLocation != wrap_glGetProgramResourceLocation) { real_glGetProgramResourceLocation = glad_glGetProgramResourceLocation; glad_glGetProgramResourceLocation = wrap_glGetProgramResourceLocation; swapped++; }
+        if (glad_glGetProgramResourceLocationIndex && glad_glGetProgramResourceLocationIndex != wrap_glGetProgramResourceLocationIndex) { real_glGetProgramResourceLocationIndex = glad_glGetProgramResourceLocationIndex; glad_glGetProgramResourceLocationIndex = wrap_glGetProgramResourceLocationIndex; swapped++; }
+        if (glad_glShaderStorageBlockBinding && glad_glShaderStorageBlockBinding != wrap_glShaderStorageBlockBinding) { real_glShaderStorageBlockBinding = glad_glShaderStorageBlockBinding; glad_glShaderStorageBlockBinding = wrap_glShaderStorageBlockBinding; swapped++; }
+        if (glad_glTexBufferRange && glad_glTexBufferRange != wrap_glTexBufferRange) { real_glTexBufferRange = glad_glTexBufferRange; glad_glTexBufferRange = wrap_glTexBufferRange; swapped++; }
+        if (glad_glTexStorage2DMultisample && glad_glTexStorage2DMultisample != wrap_glTexStorage2DMultisample) { real_glTexStorage2DMultisample = glad_glTexStorage2DMultisample; glad_glTexStorage2DMultisample = wrap_glTexStorage2DMultisample; swapped++; }
+        if (glad_glTexStorage3DMultisample && glad_glTexStorage3DMultisample != wrap_glTexStorage3DMultisample) { real_glTexStorage3DMultisample = glad_glTexStorage3DMultisample; glad_glTexStorage3DMultisample = wrap_glTexStorage3DMultisample; swapped++; }
+        if (glad_glTextureView && glad_glTextureView != wrap_glTextureView) { real_glTextureView = glad_glTextureView; glad_glTextureView = wrap_glTextureView; swapped++; }
+        if (glad_glBindVertexBuffer && glad_glBindVertexBuffer != wrap_glBindVertexBuffer) { real_glBindVertexBuffer = glad_glBindVertexBuffer; glad_glBindVertexBuffer = wrap_glBindVertexBuffer; swapped++; }
+        if (glad_glVertexAttribFormat && glad_glVertexAttribFormat != wrap_glVertexAttribFormat) { real_glVertexAttribFormat = glad_glVertexAttribFormat; glad_glVertexAttribFormat = wrap_glVertexAttribFormat; swapped++; }
+        if (glad_glVertexAttribIFormat && glad_glVertexAttribIFormat != wrap_glVertexAttribIFormat) { real_glVertexAttribIFormat = glad_glVertexAttribIFormat; glad_glVertexAttribIFormat = wrap_glVertexAttribIFormat; swapped++; }
+        if (glad_glVertexAttribLFormat && glad_glVertexAttribLFormat != wrap_glVertexAttribLFormat) { real_glVertexAttribLFormat = glad_glVertexAttribLFormat; glad_glVertexAttribLFormat = wrap_glVertexAttribLFormat; swapped++; }
+        if (glad_glVertexAttribBinding && glad_glVertexAttribBinding != wrap_glVertexAttribBinding) { real_glVertexAttribBinding = glad_glVertexAttribBinding; glad_glVertexAttribBinding = wrap_glVertexAttribBinding; swapped++; }
+        if (glad_glVertexBindingDivisor && glad_glVertexBindingDivisor != wrap_glVertexBindingDivisor) { real_glVertexBindingDivisor = glad_glVertexBindingDivisor; glad_glVertexBindingDivisor = wrap_glVertexBindingDivisor; swapped++; }
+        if (glad_glDebugMessageControl && glad_glDebugMessageControl != wrap_glDebugMessageControl) { real_glDebugMessageControl = glad_glDebugMessageControl; glad_glDebugMessageControl = wrap_glDebugMessageControl; swapped++; }
+        if (glad_glDebugMessageInsert && glad_glDebugMessageInsert != wrap_glDebugMessageInsert) { real_glDebugMessageInsert = glad_glDebugMessageInsert; glad_glDebugMessageInsert = wrap_glDebugMessageInsert; swapped++; }
+        if (glad_glDebugMessageCallback && glad_glDebugMessageCallback != wrap_glDebugMessageCallback) { real_glDebugMessageCallback = glad_glDebugMessageCallback; glad_glDebugMessageCallback = wrap_glDebugMessageCallback; swapped++; }
+        if (glad_glGetDebugMessageLog && glad_glGetDebugMessageLog != wrap_glGetDebugMessageLog) { real_glGetDebugMessageLog = glad_glGetDebugMessageLog; glad_glGetDebugMessageLog = wrap_glGetDebugMessageLog; swapped++; }
+        if (glad_glPushDebugGroup && glad_glPushDebugGroup != wrap_glPushDebugGroup) { real_glPushDebugGroup = glad_glPushDebugGroup; glad_glPushDebugGroup = wrap_glPushDebugGroup; swapped++; }
+        if (glad_glPopDebugGroup && glad_glPopDebugGroup != wrap_glPopDebugGroup) { real_glPopDebugGroup = glad_glPopDebugGroup; glad_glPopDebugGroup = wrap_glPopDebugGroup; swapped++; }
+        if (glad_glObjectLabel && glad_glObjectLabel != wrap_glObjectLabel) { real_glObjectLabel = glad_glObjectLabel; glad_glObjectLabel = wrap_glObjectLabel; swapped++; }
+        if (glad_glGetObjectLabel && glad_glGetObjectLabel != wrap_glGetObjectLabel) { real_glGetObjectLabel = glad_glGetObjectLabel; glad_glGetObjectLabel = wrap_glGetObjectLabel; swapped++; }
+        if (glad_glObjectPtrLabel && glad_glObjectPtrLabel != wrap_glObjectPtrLabel) { real_glObjectPtrLabel = glad_glObjectPtrLabel; glad_glObjectPtrLabel = wrap_glObjectPtrLabel; swapped++; }
+        if (glad_glGetObjectPtrLabel && glad_glGetObjectPtrLabel != wrap_glGetObjectPtrLabel) { real_glGetObjectPtrLabel = glad_glGetObjectPtrLabel; glad_glGetObjectPtrLabel = wrap_glGetObjectPtrLabel; swapped++; }
+        if (glad_glBufferStorage && glad_glBufferStorage != wrap_glBufferStorage) { real_glBufferStorage = glad_glBufferStorage; glad_glBufferStorage = wrap_glBufferStorage; swapped++; }
+        if (glad_glClearTexImage && glad_glClearTexImage != wrap_glClearTexImage) { real_glClearTexImage = glad_glClearTexImage; glad_glClearTexImage = wrap_glClearTexImage; swapped++; }
+        if (glad_glClearTexSubImage && glad_glClearTexSubImage != wrap_glClearTexSubImage) { real_glClearTexSubImage = glad_glClearTexSubImage; glad_glClearTexSubImage = wrap_glClearTexSubImage; swapped++; }
+        if (glad_glBindBuffersBase && glad_glBindBuffersBase != wrap_glBindBuffersBase) { real_glBindBuffersBase = glad_glBindBuffersBase; glad_glBindBuffersBase = wrap_glBindBuffersBase; swapped++; }
+        if (glad_glBindBuffersRange && glad_glBindBuffersRange != wrap_glBindBuffersRange) { real_glBindBuffersRange = glad_glBindBuffersRange; glad_glBindBuffersRange = wrap_glBindBuffersRange; swapped++; }
+        if (glad_glBindTextures && glad_glBindTextures != wrap_glBindTextures) { real_glBindTextures = glad_glBindTextures; glad_glBindTextures = wrap_glBindTextures; swapped++; }
+        if (glad_glBindSamplers && glad_glBindSamplers != wrap_glBindSamplers) { real_glBindSamplers = glad_glBindSamplers; glad_glBindSamplers = wrap_glBindSamplers; swapped++; }
+        if (glad_glBindImageTextures && glad_glBindImageTextures != wrap_glBindImageTextures) { real_glBindImageTextures = glad_glBindImageTextures; glad_glBindImageTextures = wrap_glBindImageTextures; swapped++; }
+        if (glad_glBindVertexBuffers && glad_glBindVertexBuffers != wrap_glBindVertexBuffers) { real_glBindVertexBuffers = glad_glBindVertexBuffers; glad_glBindVertexBuffers = wrap_glBindVertexBuffers; swapped++; }
+        if (glad_glClipControl && glad_glClipControl != wrap_glClipControl) { real_glClipControl = glad_glClipControl; glad_glClipControl = wrap_glClipControl; swapped++; }
+        if (glad_glCreateTransformFeedbacks && glad_glCreateTransformFeedbacks != wrap_glCreateTransformFeedbacks) { real_glCreateTransformFeedbacks = glad_glCreateTransformFeedbacks; glad_glCreateTransformFeedbacks = wrap_glCreateTransformFeedbacks; swapped++; }
+        if (glad_glTransformFeedbackBufferBase && glad_glTransformFeedbackBufferBase != wrap_glTransformFeedbackBufferBase) { real_glTransformFeedbackBufferBase = glad_glTransformFeedbackBufferBase; glad_glTransformFeedbackBufferBase = wrap_glTransformFeedbackBufferBase; swapped++; }
+        if (glad_glTransformFeedbackBufferRange && glad_glTransformFeedbackBufferRange != wrap_glTransformFeedbackBufferRange) { real_glTransformFeedbackBufferRange = glad_glTransformFeedbackBufferRange; glad_glTransformFeedbackBufferRange = wrap_glTransformFeedbackBufferRange; swapped++; }
+        if (glad_glGetTransformFeedbackiv && glad_glGetTransformFeedbackiv != wrap_glGetTransformFeedbackiv) { real_glGetTransformFeedbackiv = glad_glGetTransformFeedbackiv; glad_glGetTransformFeedbackiv = wrap_glGetTransformFeedbackiv; swapped++; }
+        if (glad_glGetTransformFeedbacki_v && glad_glGetTransformFeedbacki_v != wrap_glGetTransformFeedbacki_v) { real_glGetTransformFeedbacki_v = glad_glGetTransformFeedbacki_v; glad_glGetTransformFeedbacki_v = wrap_glGetTransformFeedbacki_v; swapped++; }
+        if (glad_glGetTransformFeedbacki64_v && glad_glGetTransformFeedbacki64_v != wrap_glGetTransformFeedbacki64_v) { real_glGetTransformFeedbacki64_v = glad_glGetTransformFeedbacki64_v; glad_glGetTransformFeedbacki64_v = wrap_glGetTransformFeedbacki64_v; swapped++; }
+        if (glad_glCreateBuffers && glad_glCreateBuffers != wrap_glCreateBuffers) { real_glCreateBuffers = glad_glCreateBuffers; glad_glCreateBuffers = wrap_glCreateBuffers; swapped++; }
+        if (glad_glNamedBufferStorage && glad_glNamedBufferStorage != wrap_glNamedBufferStorage) { real_glNamedBufferStorage = glad_glNamedBufferStorage; glad_glNamedBufferStorage = wrap_glNamedBufferStorage; swapped++; }
+        if (glad_glNamedBufferData && glad_glNamedBufferData != wrap_glNamedBufferData) { real_glNamedBufferData = glad_glNamedBufferData; glad_glNamedBufferData = wrap_glNamedBufferData; swapped++; }
+        if (glad_glNamedBufferSubData && glad_glNamedBufferSubData != wrap_glNamedBufferSubData) { real_glNamedBufferSubData = glad_glNamedBufferSubData; glad_glNamedBufferSubData = wrap_glNamedBufferSubData; swapped++; }
+        if (glad_glCopyNamedBufferSubData && glad_glCopyNamedBufferSubData != wrap_glCopyNamedBufferSubData) { real_glCopyNamedBufferSubData = glad_glCopyNamedBufferSubData; glad_glCopyNamedBufferSubData = wrap_glCopyNamedBufferSubData; swapped++; }
+        if (glad_glClearNamedBufferData && glad_glClearNamedBufferData != wrap_glClearNamedBufferData) { real_glClearNamedBufferData = glad_glClearNamedBufferData; glad_glClearNamedBufferData = wrap_glClearNamedBufferData; swapped++; }
+        if (glad_glClearNamedBufferSubData && glad_glClearNamedBufferSubData != wrap_glClearNamedBufferSubData) { real_glClearNamedBufferSubData = glad_glClearNamedBufferSubData; glad_glClearNamedBufferSubData = wrap_glClearNamedBufferSubData; swapped++; }
+        if (glad_glMapNamedBuffer && glad_glMapNamedBuffer != wrap_glMapNamedBuffer) { real_glMapNamedBuffer = glad_glMapNamedBuffer; glad_glMapNamedBuffer = wrap_glMapNamedBuffer; swapped++; }
+        if (glad_glMapNamedBufferRange && glad_glMapNamedBufferRange != wrap_glMapNamedBufferRange) { real_glMapNamedBufferRange = glad_glMapNamedBufferRange; glad_glMapNamedBufferRange = wrap_glMapNamedBufferRange; swapped++; }
+        if (glad_glUnmapNamedBuffer && glad_glUnmapNamedBuffer != wrap_glUnmapNamedBuffer) { real_glUnmapNamedBuffer = glad_glUnmapNamedBuffer; glad_glUnmapNamedBuffer = wrap_glUnmapNamedBuffer; swapped++; }
+        if (glad_glFlushMappedNamedBufferRange && glad_glFlushMappedNamedBufferRange != wrap_glFlushMappedNamedBufferRange) { real_glFlushMappedNamedBufferRange = glad_glFlushMappedNamedBufferRange; glad_glFlushMappedNamedBufferRange = wrap_glFlushMappedNamedBufferRange; swapped++; }
+        if (glad_glGetNamedBufferParameteriv && glad_glGetNamedBufferParameteriv != wrap_glGetNamedBufferParameteriv) { real_glGetNamedBufferParameteriv = glad_glGetNamedBufferParameteriv; glad_glGetNamedBufferParameteriv = wrap_glGetNamedBufferParameteriv; swapped++; }
+        if (glad_glGetNamedBufferParameteri64v && glad_glGetNamedBufferParameteri64v != wrap_glGetNamedBufferParameteri64v) { real_glGetNamedBufferParameteri64v = glad_glGetNamedBufferParameteri64v; glad_glGetNamedBufferParameteri64v = wrap_glGetNamedBufferParameteri64v; swapped++; }
+        if (glad_glGetNamedBufferPointerv && glad_glGetNamedBufferPointerv != wrap_glGetNamedBufferPointerv) { real_glGetNamedBufferPointerv = glad_glGetNamedBufferPointerv; glad_glGetNamedBufferPointerv = wrap_glGetNamedBufferPointerv; swapped++; }
+        if (glad_glGetNamedBufferSubData && glad_glGetNamedBufferSubData != wrap_glGetNamedBufferSubData) { real_glGetNamedBufferSubData = glad_glGetNamedBufferSubData; glad_glGetNamedBufferSubData = wrap_glGetNamedBufferSubData; swapped++; }
+        if (glad_glCreateFramebuffers && glad_glCreateFramebuffers != wrap_glCreateFramebuffers) { real_glCreateFramebuffers = glad_glCreateFramebuffers; glad_glCreateFramebuffers = wrap_glCreateFramebuffers; swapped++; }
+        if (glad_glNamedFramebufferRenderbuffer && glad_glNamedFramebufferRenderbuffer != wrap_glNamedFramebufferRenderbuffer) { real_glNamedFramebufferRenderbuffer = glad_glNamedFramebufferRenderbuffer; glad_glNamedFramebufferRenderbuffer = wrap_glNamedFramebufferRenderbuffer; swapped++; }
+        if (glad_glNamedFramebufferParameteri && glad_glNamedFramebufferParameteri != wrap_glNamedFramebufferParameteri) { real_glNamedFramebufferParameteri = glad_glNamedFramebufferParameteri; glad_glNamedFramebufferParameteri = wrap_glNamedFramebufferParameteri; swapped++; }
+        if (glad_glNamedFramebufferTexture && glad_glNamedFramebufferTexture != wrap_glNamedFramebufferTexture) { real_glNamedFramebufferTexture = glad_glNamedFramebufferTexture; glad_glNamedFramebufferTexture = wrap_glNamedFramebufferTexture; swapped++; }
+        if (glad_glNamedFramebufferTextureLayer && glad_glNamedFramebufferTextureLayer != wrap_glNamedFramebufferTextureLayer) { real_glNamedFramebufferTextureLayer = glad_glNamedFramebufferTextureLayer; glad_glNamedFramebufferTextureLayer = wrap_glNamedFramebufferTextureLayer; swapped++; }
+        if (glad_glNamedFramebufferDrawBuffer && glad_glNamedFramebufferDrawBuffer != wrap_glNamedFramebufferDrawBuffer) { real_glNamedFramebufferDrawBuffer = glad_glNamedFramebufferDrawBuffer; glad_glNamedFramebufferDrawBuffer = wrap_glNamedFramebufferDrawBuffer; swapped++; }
+        if (glad_glNamedFramebufferDrawBuffers && glad_glNamedFramebufferDrawBuffers != wrap_glNamedFramebufferDrawBuffers) { real_glNamedFramebufferDrawBuffers = glad_glNamedFramebufferDrawBuffers; glad_glNamedFramebufferDrawBuffers = wrap_glNamedFramebufferDrawBuffers; swapped++; }
+        if (glad_glNamedFramebufferReadBuffer && glad_glNamedFramebufferReadBuffer != wrap_glNamedFramebufferReadBuffer) { real_glNamedFramebufferReadBuffer = glad_glNamedFramebufferReadBuffer; glad_glNamedFramebufferReadBuffer = wrap_glNamedFramebufferReadBuffer; swapped++; }
+        if (glad_glInvalidateNamedFramebufferData && glad_glInvalidateNamedFramebufferData != wrap_glInvalidateNamedFramebufferData) { real_glInvalidateNamedFramebufferData = glad_glInvalidateNamedFramebufferData; glad_glInvalidateNamedFramebufferData = wrap_glInvalidateNamedFramebufferData; swapped++; }
+        if (glad_glInvalidateNamedFramebufferSubData && glad_glInvalidateNamedFramebufferSubData != wrap_glInvalidateNamedFramebufferSubData) { real_glInvalidateNamedFramebufferSubData = glad_glInvalidateNamedFramebufferSubData; glad_glInvalidateNamedFramebufferSubData = wrap_glInvalidateNamedFramebufferSubData; swapped++; }
+        if (glad_glClearNamedFramebufferiv && glad_glClearNamedFramebufferiv != wrap_glClearNamedFramebufferiv) { real_glClearNamedFramebufferiv = glad_glClearNamedFramebufferiv; glad_glClearNamedFramebufferiv = wrap_glClearNamedFramebufferiv; swapped++; }
+        if (glad_glClearNamedFramebufferuiv && glad_glClearNamedFramebufferuiv != wrap_glClearNamedFramebufferuiv) { real_glClearNamedFramebufferuiv = glad_glClearNamedFramebufferuiv; glad_glClearNamedFramebufferuiv = wrap_glClearNamedFramebufferuiv; swapped++; }
+        if (glad_glClearNamedFramebufferfv && glad_glClearNamedFramebufferfv != wrap_glClearNamedFramebufferfv) { real_glClearNamedFramebufferfv = glad_glClearNamedFramebufferfv; glad_glClearNamedFramebufferfv = wrap_glClearNamedFramebufferfv; swapped++; }
+        if (glad_glClearNamedFramebufferfi && glad_glClearNamedFramebufferfi != wrap_glClearNamedFramebufferfi) { real_glClearNamedFramebufferfi = glad_glClearNamedFramebufferfi; glad_glClearNamedFramebufferfi = wrap_glClearNamedFramebufferfi; swapped++; }
+        if (glad_glBlitNamedFramebuffer && glad_glBlitNamedFramebuffer != wrap_glBlitNamedFramebuffer) { real_glBlitNamedFramebuffer = glad_glBlitNamedFramebuffer; glad_glBlitNamedFramebuffer = wrap_glBlitNamedFramebuffer; swapped++; }
+        if (glad_glCheckNamedFramebufferStatus && glad_glCheckNamedFramebufferStatus != wrap_glCheckNamedFramebufferStatus) { real_glCheckNamedFramebufferStatus = glad_glCheckNamedFramebufferStatus; glad_glCheckNamedFramebufferStatus = wrap_glCheckNamedFramebufferStatus; swapped++; }
+        if (glad_glGetNamedFramebufferParameteriv && glad_glGetNamedFramebufferParameteriv != wrap_glGetNamedFramebufferParameteriv) { real_glGetNamedFramebufferParameteriv = glad_glGetNamedFramebufferParameteriv; glad_glGetNamedFramebufferParameteriv = wrap_glGetNamedFramebufferParameteriv; swapped++; }
+        if (glad_glGetNamedFramebufferAttachmentParameteriv && glad_glGetNamedFramebufferAttachmentParameteriv != wrap_glGetNamedFramebufferAttachmentParameteriv) { real_glGetNamedFramebufferAttachmentParameteriv = glad_glGetNamedFramebufferAttachmentParameteriv; glad_glGetNamedFramebufferAttachmentParameteriv = wrap_glGetNamedFramebufferAttachmentParameteriv; swapped++; }
+        if (glad_glCreateRenderbuffers && glad_glCreateRenderbuffers != wrap_glCreateRenderbuffers) { real_glCreateRenderbuffers = glad_glCreateRenderbuffers; glad_glCreateRenderbuffers = wrap_glCreateRenderbuffers; swapped++; }
+        if (glad_glNamedRenderbufferStorage && glad_glNamedRenderbufferStorage != wrap_glNamedRenderbufferStorage) { real_glNamedRenderbufferStorage = glad_glNamedRenderbufferStorage; glad_glNamedRenderbufferStorage = wrap_glNamedRenderbufferStorage; swapped++; }
+        if (glad_glNamedRenderbufferStorageMultisample && glad_glNamedRenderbufferStorageMultisample != wrap_glNamedRenderbufferStorageMultisample) { real_glNamedRenderbufferStorageMultisample = glad_glNamedRenderbufferStorageMultisample; glad_glNamedRenderbufferStorageMultisample = wrap_glNamedRenderbufferStorageMultisample; swapped++; }
+        if (glad_glGetNamedRenderbufferParameteriv && glad_glGetNamedRenderbufferParameteriv != wrap_glGetNamedRenderbufferParameteriv) { real_glGetNamedRenderbufferParameteriv = glad_glGetNamedRenderbufferParameteriv; glad_glGetNamedRenderbufferParameteriv = wrap_glGetNamedRenderbufferParameteriv; swapped++; }
+        if (glad_glCreateTextures && glad_glCreateTextures != wrap_glCreateTextures) { real_glCreateTextures = glad_glCreateTextures; glad_glCreateTextures = wrap_glCreateTextures; swapped++; }
+        if (glad_glTextureBuffer && glad_glTextureBuffer != wrap_glTextureBuffer) { real_glTextureBuffer = glad_glTextureBuffer; glad_glTextureBuffer = wrap_glTextureBuffer; swapped++; }
+        if (glad_glTextureBufferRange && glad_glTextureBufferRange != wrap_glTextureBufferRange) { real_glTextureBufferRange = glad_glTextureBufferRange; glad_glTextureBufferRange = wrap_glTextureBufferRange; swapped++; }
+        if (glad_glTextureStorage1D && glad_glTextureStorage1D != wrap_glTextureStorage1D) { real_glTextureStorage1D = glad_glTextureStorage1D; glad_glTextureStorage1D = wrap_glTextureStorage1D; swapped++; }
+        if (glad_glTextureStorage2D && glad_glTextureStorage2D != wrap_glTextureStorage2D) { real_glTextureStorage2D = glad_glTextureStorage2D; glad_glTextureStorage2D = wrap_glTextureStorage2D; swapped++; }
+        if (glad_glTextureStorage3D && glad_glTextureStorage3D != wrap_glTextureStorage3D) { real_glTextureStorage3D = glad_glTextureStorage3D; glad_glTextureStorage3D = wrap_glTextureStorage3D; swapped++; }
+        if (glad_glTextureStorage2DMultisample && glad_glTextureStorage2DMultisample != wrap_glTextureStorage2DMultisample) { real_glTextureStorage2DMultisample = glad_glTextureStorage2DMultisample; glad_glTextureStorage2DMultisample = wrap_glTextureStorage2DMultisample; swapped++; }
+        if (glad_glTextureStorage3DMultisample && glad_glTextureStorage3DMultisample != wrap_glTextureStorage3DMultisample) { real_glTextureStorage3DMultisample = glad_glTextureStorage3DMultisample; glad_glTextureStorage3DMultisample = wrap_glTextureStorage3DMultisample; swapped++; }
+        if (glad_glTextureSubImage1D && glad_glTextureSubImage1D != wrap_glTextureSubImage1D) { real_glTextureSubImage1D = glad_glTextureSubImage1D; glad_glTextureSubImage1D = wrap_glTextureSubImage1D; swapped++; }
+        if (glad_glTextureSubImage2D && glad_glTextureSubImage2D != wrap_glTextureSubImage2D) { real_glTextureSubImage2D = glad_glTextureSubImage2D; glad_glTextureSubImage2D = wrap_glTextureSubImage2D; swapped++; }
+        if (glad_glTextureSubImage3D && glad_glTextureSubImage3D != wrap_glTextureSubImage3D) { real_glTextureSubImage3D = glad_glTextureSubImage3D; glad_glTextureSubImage3D = wrap_glTextureSubImage3D; swapped++; }
+        if (glad_glCompressedTextureSubImage1D && glad_glCompressedTextureSubImage1D != wrap_glCompressedTextureSubImage1D) { real_glCompressedTextureSubImage1D = glad_glCompressedTextureSubImage1D; glad_glCompressedTextureSubImage1D = wrap_glCompressedTextureSubImage1D; swapped++; }
+        if (glad_glCompressedTextureSubImage2D && glad_glCompressedTextureSubImage2D != wrap_glCompressedTextureSubImage2D) { real_glCompressedTextureSubImage2D = glad_glCompressedTextureSubImage2D; glad_glCompressedTextureSubImage2D = wrap_glCompressedTextureSubImage2D; swapped++; }
+        if (glad_glCompressedTextureSubImage3D && glad_glCompressedTextureSubImage3D != wrap_glCompressedTextureSubImage3D) { real_glCompressedTextureSubImage3D = glad_glCompressedTextureSubImage3D; glad_glCompressedTextureSubImage3D = wrap_glCompressedTextureSubImage3D; swapped++; }
+        if (glad_glCopyTextureSubImage1D && glad_glCopyTextureSubImage1D != wrap_glCopyTextureSubImage1D) { real_glCopyTextureSubImage1D = glad_glCopyTextureSubImage1D; glad_glCopyTextureSubImage1D = wrap_glCopyTextureSubImage1D; swapped++; }
+        if (glad_glCopyTextureSubImage2D && glad_glCopyTextureSubImage2D != wrap_glCopyTextureSubImage2D) { real_glCopyTextureSubImage2D = glad_glCopyTextureSubImage2D; glad_glCopyTextureSubImage2D = wrap_glCopyTextureSubImage2D; swapped++; }
+        if (glad_glCopyTextureSubImage3D && glad_glCopyTextureSubImage3D != wrap_glCopyTextureSubImage3D) { real_glCopyTextureSubImage3D = glad_glCopyTextureSubImage3D; glad_glCopyTextureSubImage3D = wrap_glCopyTextureSubImage3D; swapped++; }
+        if (glad_glTextureParameterf && glad_glTextureParameterf != wrap_glTextureParameterf) { real_glTextureParameterf = glad_glTextureParameterf; glad_glTextureParameterf = wrap_glTextureParameterf; swapped++; }
+        if (glad_glTextureParameterfv && glad_glTextureParameterfv != wrap_glTextureParameterfv) { real_glTextureParameterfv = glad_glTextureParameterfv; glad_glTextureParameterfv = wrap_glTextureParameterfv; swapped++; }
+        if (glad_glTextureParameteri && glad_glTextureParameteri != wrap_glTextureParameteri) { real_glTextureParameteri = glad_glTextureParameteri; glad_glTextureParameteri = wrap_glTextureParameteri; swapped++; }
+        if (glad_glTextureParameterIiv && glad_glTextureParameterIiv != wrap_glTextureParameterIiv) { real_glTextureParameterIiv = glad_glTextureParameterIiv; glad_glTextureParameterIiv = wrap_glTextureParameterIiv; swapped++; }
+        if (glad_glTextureParameterIuiv && glad_glTextureParameterIuiv != wrap_glTextureParameterIuiv) { real_glTextureParameterIuiv = glad_glTextureParameterIuiv; glad_glTextureParameterIuiv = wrap_glTextureParameterIuiv; swapped++; }
+        if (glad_glTextureParameteriv && glad_glTextureParameteriv != wrap_glTextureParameteriv) { real_glTextureParameteriv = glad_glTextureParameteriv; glad_glTextureParameteriv = wrap_glTextureParameteriv; swapped++; }
+        if (glad_glGenerateTextureMipmap && glad_glGenerateTextureMipmap != wrap_glGenerateTextureMipmap) { real_glGenerateTextureMipmap = glad_glGenerateTextureMipmap; glad_glGenerateTextureMipmap = wrap_glGenerateTextureMipmap; swapped++; }
+        if (glad_glBindTextureUnit && glad_glBindTextureUnit != wrap_glBindTextureUnit) { real_glBindTextureUnit = glad_glBindTextureUnit; glad_glBindTextureUnit = wrap_glBindTextureUnit; swapped++; }
+        if (glad_glGetTextureImage && glad_glGetTextureImage != wrap_glGetTextureImage) { real_glGetTextureImage = glad_glGetTextureImage; glad_glGetTextureImage = wrap_glGetTextureImage; swapped++; }
+        if (glad_glGetCompressedTextureImage && glad_glGetCompressedTextureImage != wrap_glGetCompressedTextureImage) { real_glGetCompressedTextureImage = glad_glGetCompressedTextureImage; glad_glGetCompressedTextureImage = wrap_glGetCompressedTextureImage; swapped++; }
+        if (glad_glGetTextureLevelParameterfv && glad_glGetTextureLevelParameterfv != wrap_glGetTextureLevelParameterfv) { real_glGetTextureLevelParameterfv = glad_glGetTextureLevelParameterfv; glad_glGetTextureLevelParameterfv = wrap_glGetTextureLevelParameterfv; swapped++; }
+        if (glad_glGetTextureLevelParameteriv && glad_glGetTextureLevelParameteriv != wrap_glGetTextureLevelParameteriv) { real_glGetTextureLevelParameteriv = glad_glGetTextureLevelParameteriv; glad_glGetTextureLevelParameteriv = wrap_glGetTextureLevelParameteriv; swapped++; }
+        if (glad_glGetTextureParameterfv && glad_glGetTextureParameterfv != wrap_glGetTextureParameterfv) { real_glGetTextureParameterfv = glad_glGetTextureParameterfv; glad_glGetTextureParameterfv = wrap_glGetTextureParameterfv; swapped++; }
+        if (glad_glGetTextureParameterIiv && glad_glGetTextureParameterIiv != wrap_glGetTextureParameterIiv) { real_glGetTextureParameterIiv = glad_glGetTextureParameterIiv; glad_glGetTextureParameterIiv = wrap_glGetTextureParameterIiv; swapped++; }
+        if (glad_glGetTextureParameterIuiv && glad_glGetTextureParameterIuiv != wrap_glGetTextureParameterIuiv) { real_glGetTextureParameterIuiv = glad_glGetTextureParameterIuiv; glad_glGetTextureParameterIuiv = wrap_glGetTextureParameterIuiv; swapped++; }
+        if (glad_glGetTextureParameteriv && glad_glGetTextureParameteriv != wrap_glGetTextureParameteriv) { real_glGetTextureParameteriv = glad_glGetTextureParameteriv; glad_glGetTextureParameteriv = wrap_glGetTextureParameteriv; swapped++; }
+        if (glad_glCreateVertexArrays && glad_glCreateVertexArrays != wrap_glCreateVertexArrays) { real_glCreateVertexArrays = glad_glCreateVertexArrays; glad_glCreateVertexArrays = wrap_glCreateVertexArrays; swapped++; }
+        if (glad_glDisableVertexArrayAttrib && glad_glDisableVertexArrayAttrib != wrap_glDisableVertexArrayAttrib) { real_glDisableVertexArrayAttrib = glad_glDisableVertexArrayAttrib; glad_glDisableVertexArrayAttrib = wrap_glDisableVertexArrayAttrib; swapped++; }
+        if (glad_glEnableVertexArrayAttrib && glad_glEnableVertexArrayAttrib != wrap_glEnableVertexArrayAttrib) { real_glEnableVertexArrayAttrib = glad_glEnableVertexArrayAttrib; glad_glEnableVertexArrayAttrib = wrap_glEnableVertexArrayAttrib; swapped++; }
+        if (glad_glVertexArrayElementBuffer && glad_glVertexArrayElementBuffer != wrap_glVertexArrayElementBuffer) { real_glVertexArrayElementBuffer = glad_glVertexArrayElementBuffer; glad_glVertexArrayElementBuffer = wrap_glVertexArrayElementBuffer; swapped++; }
+        if (glad_glVertexArrayVertexBuffer && glad_glVertexArrayVertexBuffer != wrap_glVertexArrayVertexBuffer) { real_glVertexArrayVertexBuffer = glad_glVertexArrayVertexBuffer; glad_glVertexArrayVertexBuffer = wrap_glVertexArrayVertexBuffer; swapped++; }
+        if (glad_glVertexArrayVertexBuffers && glad_glVertexArrayVertexBuffers != wrap_glVertexArrayVertexBuffers) { real_glVertexArrayVertexBuffers = glad_glVertexArrayVertexBuffers; glad_glVertexArrayVertexBuffers = wrap_glVertexArrayVertexBuffers; swapped++; }
+        if (glad_glVertexArrayAttribBinding && glad_glVertexArrayAttribBinding != wrap_glVertexArrayAttribBinding) { real_glVertexArrayAttribBinding = glad_glVertexArrayAttribBinding; glad_glVertexArrayAttribBinding = wrap_glVertexArrayAttribBinding; swapped++; }
+        if (glad_glVertexArrayAttribFormat && glad_glVertexArrayAttribFormat != wrap_glVertexArrayAttribFormat) { real_glVertexArrayAttribFormat = glad_glVertexArrayAttribFormat; glad_glVertexArrayAttribFormat = wrap_glVertexArrayAttribFormat; swapped++; }
+        if (glad_glVertexArrayAttribIFormat && glad_glVertexArrayAttribIFormat != wrap_glVertexArrayAttribIFormat) { real_glVertexArrayAttribIFormat = glad_glVertexArrayAttribIFormat; glad_glVertexArrayAttribIFormat = wrap_glVertexArrayAttribIFormat; swapped++; }
+        if (glad_glVertexArrayAttribLFormat && glad_glVertexArrayAttribLFormat != wrap_glVertexArrayAttribLFormat) { real_glVertexArrayAttribLFormat = glad_glVertexArrayAttribLFormat; glad_glVertexArrayAttribLFormat = wrap_glVertexArrayAttribLFormat; swapped++; }
+        if (glad_glVertexArrayBindingDivisor && glad_glVertexArrayBindingDivisor != wrap_glVertexArrayBindingDivisor) { real_glVertexArrayBindingDivisor = glad_glVertexArrayBindingDivisor; glad_glVertexArrayBindingDivisor = wrap_glVertexArrayBindingDivisor; swapped++; }
+        if (glad_glGetVertexArrayiv && glad_glGetVertexArrayiv != wrap_glGetVertexArrayiv) { real_glGetVertexArrayiv = glad_glGetVertexArrayiv; glad_glGetVertexArrayiv = wrap_glGetVertexArrayiv; swapped++; }
+        if (glad_glGetVertexArrayIndexediv && glad_glGetVertexArrayIndexediv != wrap_glGetVertexArrayIndexediv) { real_glGetVertexArrayIndexediv = glad_glGetVertexArrayIndexediv; glad_glGetVertexArrayIndexediv = wrap_glGetVertexArrayIndexediv; swapped++; }
+        if (glad_glGetVertexArrayIndexed64iv && glad_glGetVertexArrayIndexed64iv != wrap_glGetVertexArrayIndexed64iv) { real_glGetVertexArrayIndexed64iv = glad_glGetVertexArrayIndexed64iv; glad_glGetVertexArrayIndexed64iv = wrap_glGetVertexArrayIndexed64iv; swapped++; }
+        if (glad_glCreateSamplers && glad_glCreateSamplers != wrap_glCreateSamplers) { real_glCreateSamplers = glad_glCreateSamplers; glad_glCreateSamplers = wrap_glCreateSamplers; swapped++; }
+        if (glad_glCreateProgramPipelines && glad_glCreateProgramPipelines != wrap_glCreateProgramPipelines) { real_glCreateProgramPipelines = glad_glCreateProgramPipelines; glad_glCreateProgramPipelines = wrap_glCreateProgramPipelines; swapped++; }
+        if (glad_glCreateQueries && glad_glCreateQueries != wrap_glCreateQueries) { real_glCreateQueries = glad_glCreateQueries; glad_glCreateQueries = wrap_glCreateQueries; swapped++; }
+        if (glad_glGetQueryBufferObjecti64v && glad_glGetQueryBufferObjecti64v != wrap_glGetQueryBufferObjecti64v) { real_glGetQueryBufferObjecti64v = glad_glGetQueryBufferObjecti64v; glad_glGetQueryBufferObjecti64v = wrap_glGetQueryBufferObjecti64v; swapped++; }
+        if (glad_glGetQueryBufferObjectiv && glad_glGetQueryBufferObjectiv != wrap_glGetQueryBufferObjectiv) { real_glGetQueryBufferObjectiv = glad_glGetQueryBufferObjectiv; glad_glGetQueryBufferObjectiv = wrap_glGetQueryBufferObjectiv; swapped++; }
+        if (glad_glGetQueryBufferObjectui64v && glad_glGetQueryBufferObjectui64v != wrap_glGetQueryBufferObjectui64v) { real_glGetQueryBufferObjectui64v = glad_glGetQueryBufferObjectui64v; glad_glGetQueryBufferObjectui64v = wrap_glGetQueryBufferObjectui64v; swapped++; }
+        if (glad_glGetQueryBufferObjectuiv && glad_glGetQueryBufferObjectuiv != wrap_glGetQueryBufferObjectuiv) { real_glGetQueryBufferObjectuiv = glad_glGetQueryBufferObjectuiv; glad_glGetQueryBufferObjectuiv = wrap_glGetQueryBufferObjectuiv; swapped++; }
+        if (glad_glMemoryBarrierByRegion && glad_glMemoryBarrierByRegion != wrap_glMemoryBarrierByRegion) { real_glMemoryBarrierByRegion = glad_glMemoryBarrierByRegion; glad_glMemoryBarrierByRegion = wrap_glMemoryBarrierByRegion; swapped++; }
+        if (glad_glGetTextureSubImage && glad_glGetTextureSubImage != wrap_glGetTextureSubImage) { real_glGetTextureSubImage = glad_glGetTextureSubImage; glad_glGetTextureSubImage = wrap_glGetTextureSubImage; swapped++; }
+        if (glad_glGetCompressedTextureSubImage && glad_glGetCompressedTextureSubImage != wrap_glGetCompressedTextureSubImage) { real_glGetCompressedTextureSubImage = glad_glGetCompressedTextureSubImage; glad_glGetCompressedTextureSubImage = wrap_glGetCompressedTextureSubImage; swapped++; }
+        if (glad_glGetGraphicsResetStatus && glad_glGetGraphicsResetStatus != wrap_glGetGraphicsResetStatus) { real_glGetGraphicsResetStatus = glad_glGetGraphicsResetStatus; glad_glGetGraphicsResetStatus = wrap_glGetGraphicsResetStatus; swapped++; }
+        if (glad_glGetnCompressedTexImage && glad_glGetnCompressedTexImage != wrap_glGetnCompressedTexImage) { real_glGetnCompressedTexImage = glad_glGetnCompressedTexImage; glad_glGetnCompressedTexImage = wrap_glGetnCompressedTexImage; swapped++; }
+        if (glad_glGetnTexImage && glad_glGetnTexImage != wrap_glGetnTexImage) { real_glGetnTexImage = glad_glGetnTexImage; glad_glGetnTexImage = wrap_glGetnTexImage; swapped++; }
+        if (glad_glGetnUniformdv && glad_glGetnUniformdv != wrap_glGetnUniformdv) { real_glGetnUniformdv = glad_glGetnUniformdv; glad_glGetnUniformdv = wrap_glGetnUniformdv; swapped++; }
+        if (glad_glGetnUniformfv && glad_glGetnUniformfv != wrap_glGetnUniformfv) { real_glGetnUniformfv = glad_glGetnUniformfv; glad_glGetnUniformfv = wrap_glGetnUniformfv; swapped++; }
+        if (glad_glGetnUniformiv && glad_glGetnUniformiv != wrap_glGetnUniformiv) { real_glGetnUniformiv = glad_glGetnUniformiv; glad_glGetnUniformiv = wrap_glGetnUniformiv; swapped++; }
+        if (glad_glGetnUniformuiv && glad_glGetnUniformuiv != wrap_glGetnUniformuiv) { real_glGetnUniformuiv = glad_glGetnUniformuiv; glad_glGetnUniformuiv = wrap_glGetnUniformuiv; swapped++; }
+        if (glad_glReadnPixels && glad_glReadnPixels != wrap_glReadnPixels) { real_glReadnPixels = glad_glReadnPixels; glad_glReadnPixels = wrap_glReadnPixels; swapped++; }
+        if (glad_glGetnMapdv && glad_glGetnMapdv != wrap_glGetnMapdv) { real_glGetnMapdv = glad_glGetnMapdv; glad_glGetnMapdv = wrap_glGetnMapdv; swapped++; }
+        if (glad_glGetnMapfv && glad_glGetnMapfv != wrap_glGetnMapfv) { real_glGetnMapfv = glad_glGetnMapfv; glad_glGetnMapfv = wrap_glGetnMapfv; swapped++; }
+        if (glad_glGetnMapiv && glad_glGetnMapiv != wrap_glGetnMapiv) { real_glGetnMapiv = glad_glGetnMapiv; glad_glGetnMapiv = wrap_glGetnMapiv; swapped++; }
+        if (glad_glGetnPixelMapfv && glad_glGetnPixelMapfv != wrap_glGetnPixelMapfv) { real_glGetnPixelMapfv = glad_glGetnPixelMapfv; glad_glGetnPixelMapfv = wrap_glGetnPixelMapfv; swapped++; }
+        if (glad_glGetnPixelMapuiv && glad_glGetnPixelMapuiv != wrap_glGetnPixelMapuiv) { real_glGetnPixelMapuiv = glad_glGetnPixelMapuiv; glad_glGetnPixelMapuiv = wrap_glGetnPixelMapuiv; swapped++; }
+        if (glad_glGetnPixelMapusv && glad_glGetnPixelMapusv != wrap_glGetnPixelMapusv) { real_glGetnPixelMapusv = glad_glGetnPixelMapusv; glad_glGetnPixelMapusv = wrap_glGetnPixelMapusv; swapped++; }
+        if (glad_glGetnPolygonStipple && glad_glGetnPolygonStipple != wrap_glGetnPolygonStipple) { real_glGetnPolygonStipple = glad_glGetnPolygonStipple; glad_glGetnPolygonStipple = wrap_glGetnPolygonStipple; swapped++; }
+        if (glad_glGetnColorTable && glad_glGetnColorTable != wrap_glGetnColorTable) { real_glGetnColorTable = glad_glGetnColorTable; glad_glGetnColorTable = wrap_glGetnColorTable; swapped++; }
+        if (glad_glGetnConvolutionFilter && glad_glGetnConvolutionFilter != wrap_glGetnConvolutionFilter) { real_glGetnConvolutionFilter = glad_glGetnConvolutionFilter; glad_glGetnConvolutionFilter = wrap_glGetnConvolutionFilter; swapped++; }
+        if (glad_glGetnSeparableFilter && glad_glGetnSeparableFilter != wrap_glGetnSeparableFilter) { real_glGetnSeparableFilter = glad_glGetnSeparableFilter; glad_glGetnSeparableFilter = wrap_glGetnSeparableFilter; swapped++; }
+        if (glad_glGetnHistogram && glad_glGetnHistogram != wrap_glGetnHistogram) { real_glGetnHistogram = glad_glGetnHistogram; glad_glGetnHistogram = wrap_glGetnHistogram; swapped++; }
+        if (glad_glGetnMinmax && glad_glGetnMinmax != wrap_glGetnMinmax) { real_glGetnMinmax = glad_glGetnMinmax; glad_glGetnMinmax = wrap_glGetnMinmax; swapped++; }
+        if (glad_glTextureBarrier && glad_glTextureBarrier != wrap_glTextureBarrier) { real_glTextureBarrier = glad_glTextureBarrier; glad_glTextureBarrier = wrap_glTextureBarrier; swapped++; }
+        if (glad_glSpecializeShader && glad_glSpecializeShader != wrap_glSpecializeShader) { real_glSpecializeShader = glad_glSpecializeShader; glad_glSpecializeShader = wrap_glSpecializeShader; swapped++; }
+        if (glad_glMultiDrawArraysIndirectCount && glad_glMultiDrawArraysIndirectCount != wrap_glMultiDrawArraysIndirectCount) { real_glMultiDrawArraysIndirectCount = glad_glMultiDrawArraysIndirectCount; glad_glMultiDrawArraysIndirectCount = wrap_glMultiDrawArraysIndirectCount; swapped++; }
+        if (glad_glMultiDrawElementsIndirectCount && glad_glMultiDrawElementsIndirectCount != wrap_glMultiDrawElementsIndirectCount) { real_glMultiDrawElementsIndirectCount = glad_glMultiDrawElementsIndirectCount; glad_glMultiDrawElementsIndirectCount = wrap_glMultiDrawElementsIndirectCount; swapped++; }
+        if (glad_glPolygonOffsetClamp && glad_glPolygonOffsetClamp != wrap_glPolygonOffsetClamp) { real_glPolygonOffsetClamp = glad_glPolygonOffsetClamp; glad_glPolygonOffsetClamp = wrap_glPolygonOffsetClamp; swapped++; }
+        if (glad_glMaxShaderCompilerThreadsKHR && glad_glMaxShaderCompilerThreadsKHR != wrap_glMaxShaderCompilerThreadsKHR) { real_glMaxShaderCompilerThreadsKHR = glad_glMaxShaderCompilerThreadsKHR; glad_glMaxShaderCompilerThreadsKHR = wrap_glMaxShaderCompilerThreadsKHR; swapped++; }
+    } else {
+        if (glad_glCullFace == wrap_glCullFace) { glad_glCullFace = real_glCullFace; swapped++; }
+        if (glad_glFrontFace == wrap_glFrontFace) { glad_glFrontFace = real_glFrontFace; swapped++; }
+        if (glad_glHint == wrap_glHint) { glad_glHint = real_glHint; swapped++; }
+        if (glad_glLineWidth == wrap_glLineWidth) { glad_glLineWidth = real_glLineWidth; swapped++; }
+        if (glad_glPointSize == wrap_glPointSize) { glad_glPointSize = real_glPointSize; swapped++; }
+        if (glad_glPolygonMode == wrap_glPolygonMode) { glad_glPolygonMode = real_glPolygonMode; swapped++; }
+        if (glad_glScissor == wrap_glScissor) { glad_glScissor = real_glScissor; swapped++; }
+        if (glad_glTexParameterf == wrap_glTexParameterf) { glad_glTexParameterf = real_glTexParameterf; swapped++; }
+        if (glad_glTexParameterfv == wrap_glTexParameterfv) { glad_glTexParameterfv = real_glTexParameterfv; swapped++; }
+        if (glad_glTexParameteri == wrap_glTexParameteri) { glad_glTexParameteri = real_glTexParameteri; swapped++; }
+        if (glad_glTexParameteriv == wrap_glTexParameteriv) { glad_glTexParameteriv = real_glTexParameteriv; swapped++; }
+        if (glad_glTexImage1D == wrap_glTexImage1D) { glad_glTexImage1D = real_glTexImage1D; swapped++; }
+        if (glad_glTexImage2D == wrap_glTexImage2D) { glad_glTexImage2D = real_glTexImage2D; swapped++; }
+        if (glad_glDrawBuffer == wrap_glDrawBuffer) { glad_glDrawBuffer = real_glDrawBuffer; swapped++; }
+        if (glad_glClear == wrap_glClear) { glad_glClear = real_glClear; swapped++; }
+        if (glad_glClearColor == wrap_glClearColor) { glad_glClearColor = real_glClearColor; swapped++; }
+        if (glad_glClearStencil == wrap_glClearStencil) { glad_glClearStencil = real_glClearStencil; swapped++; }
+        if (glad_glClearDepth == wrap_glClearDepth) { glad_glClearDepth = real_glClearDepth; swapped++; }
+        if (glad_glStencilMask == wrap_glStencilMask) { glad_glStencilMask = real_glStencilMask; swapped++; }
+        if (glad_glColorMask == wrap_glColorMask) { glad_glColorMask = real_glColorMask; swapped++; }
+        if (glad_glDepthMask == wrap_glDepthMask) { glad_glDepthMask = real_glDepthMask; swapped++; }
+        if (glad_glDisable == wrap_glDisable) { glad_glDisable = real_glDisable; swapped++; }
+        if (glad_glEnable == wrap_glEnable) { glad_glEnable = real_glEnable; swapped++; }
+        if (glad_glFinish == wrap_glFinish) { glad_glFinish = real_glFinish; swapped++; }
+        if (glad_glFlush == wrap_glFlush) { glad_glFlush = real_glFlush; swapped++; }
+        if (glad_glBlendFunc == wrap_glBlendFunc) { glad_glBlendFunc = real_glBlendFunc; swapped++; }
+        if (glad_glLogicOp == wrap_glLogicOp) { glad_glLogicOp = real_glLogicOp; swapped++; }
+        if (glad_glStencilFunc == wrap_glStencilFunc) { glad_glStencilFunc = real_glStencilFunc; swapped++; }
+        if (glad_glStencilOp == wrap_glStencilOp) { glad_glStencilOp = real_glStencilOp; swapped++; }
+        if (glad_glDepthFunc == wrap_glDepthFunc) { glad_glDepthFunc = real_glDepthFunc; swapped++; }
+        if (glad_glPixelStoref == wrap_glPixelStoref) { glad_glPixelStoref = real_glPixelStoref; swapped++; }
+        if (glad_glPixelStorei == wrap_glPixelStorei) { glad_glPixelStorei = real_glPixelStorei; swapped++; }
+        if (glad_glReadBuffer == wrap_glReadBuffer) { glad_glReadBuffer = real_glReadBuffer; swapped++; }
+        if (glad_glReadPixels == wrap_glReadPixels) { glad_glReadPixels = real_glReadPixels; swapped++; }
+        if (glad_glGetBooleanv == wrap_glGetBooleanv) { glad_glGetBooleanv = real_glGetBooleanv; swapped++; }
+        if (glad_glGetDoublev == wrap_glGetDoublev) { glad_glGetDoublev = real_glGetDoublev; swapped++; }
+        if (glad_glGetError == wrap_glGetError) { glad_glGetError = real_glGetError; swapped++; }
+        if (glad_glGetFloatv == wrap_glGetFloatv) { glad_glGetFloatv = real_glGetFloatv; swapped++; }
+        if (glad_glGetIntegerv == wrap_glGetIntegerv) { glad_glGetIntegerv = real_glGetIntegerv; swapped++; }
+        if (glad_glGetString == wrap_glGetString) { glad_glGetString = real_glGetString; swapped++; }
+        if (glad_glGetTexImage == wrap_glGetTexImage) { glad_glGetTexImage = real_glGetTexImage; swapped++; }
+        if (glad_glGetTexParameterfv == wrap_glGetTexParameterfv) { glad_glGetTexParameterfv = real_glGetTexParameterfv; swapped++; }
+        if (glad_glGetTexParameteriv == wrap_glGetTexParameteriv) { glad_glGetTexParameteriv = real_glGetTexParameteriv; swapped++; }
+        if (glad_glGetTexLevelParameterfv == wrap_glGetTexLevelParameterfv) { glad_glGetTexLevelParameterfv = real_glGetTexLevelParameterfv; swapped++; }
+        if (glad_glGetTexLevelParameteriv == wrap_glGetTexLevelParameteriv) { glad_glGetTexLevelParameteriv = real_glGetTexLevelParameteriv; swapped++; }
+        if (glad_glIsEnabled == wrap_glIsEnabled) { glad_glIsEnabled = real_glIsEnabled; swapped++; }
+        if (glad_glDepthRange == wrap_glDepthRange) { glad_glDepthRange = real_glDepthRange; swapped++; }
+        if (glad_glViewport == wrap_glViewport) { glad_glViewport = real_glViewport; swapped++; }
+        if (glad_glNewList == wrap_glNewList) { glad_glNewList = real_glNewList; swapped++; }
+        if (glad_glEndList == wrap_glEndList) { glad_glEndList = real_glEndList; swapped++; }
+        if (glad_glCallList == wrap_glCallList) { glad_glCallList = real_glCallList; swapped++; }
+        if (glad_glCallLists == wrap_glCallLists) { glad_glCallLists = real_glCallLists; swapped++; }
+        if (glad_glDeleteLists == wrap_glDeleteLists) { glad_glDeleteLists = real_glDeleteLists; swapped++; }
+        if (glad_glGenLists == wrap_glGenLists) { glad_glGenLists = real_glGenLists; swapped++; }
+        if (glad_glListBase == wrap_glListBase) { glad_glListBase = real_glListBase; swapped++; }
+        if (glad_glBegin == wrap_glBegin) { glad_glBegin = real_glBegin; swapped++; }
+        if (glad_glBitmap == wrap_glBitmap) { glad_glBitmap = real_glBitmap; swapped++; }
+        if (glad_glColor3b == wrap_glColor3b) { glad_glColor3b = real_glColor3b; swapped++; }
+        if (glad_glColor3bv == wrap_glColor3bv) { glad_glColor3bv = real_glColor3bv; swapped++; }
+        if (glad_glColor3d == wrap_glColor3d) { glad_glColor3d = real_glColor3d; swapped++; }
+        if (glad_glColor3dv == wrap_glColor3dv) { glad_glColor3dv = real_glColor3dv; swapped++; }
+        if (glad_glColor3f == wrap_glColor3f) { glad_glColor3f = real_glColor3f; swapped++; }
+        if (glad_glColor3fv == wrap_glColor3fv) { glad_glColor3fv = real_glColor3fv; swapped++; }
+        if (glad_glColor3i == wrap_glColor3i) { glad_glColor3i = real_glColor3i; swapped++; }
+        if (glad_glColor3iv == wrap_glColor3iv) { glad_glColor3iv = real_glColor3iv; swapped++; }
+        if (glad_glColor3s == wrap_glColor3s) { glad_glColor3s = real_glColor3s; swapped++; }
+        if (glad_glColor3sv == wrap_glColor3sv) { glad_glColor3sv = real_glColor3sv; swapped++; }
+        if (glad_glColor3ub == wrap_glColor3ub) { glad_glColor3ub = real_glColor3ub; swapped++; }
+        if (glad_glColor3ubv == wrap_glColor3ubv) { glad_glColor3ubv = real_glColor3ubv; swapped++; }
+        if (glad_glColor3ui == wrap_glColor3ui) { glad_glColor3ui = real_glColor3ui; swapped++; }
+        if (glad_glColor3uiv == wrap_glColor3uiv) { glad_glColor3uiv = real_glColor3uiv; swapped++; }
+        if (glad_glColor3us == wrap_glColor3us) { glad_glColor3us = real_glColor3us; swapped++; }
+        if (glad_glColor3usv == wrap_glColor3usv) { glad_glColor3usv = real_glColor3usv; swapped++; }
+        if (glad_glColor4b == wrap_glColor4b) { glad_glColor4b = real_glColor4b; swapped++; }
+        if (glad_glColor4bv == wrap_glColor4bv) { glad_glColor4bv = real_glColor4bv; swapped++; }
+        if (glad_glColor4d == wrap_glColor4d) { glad_glColor4d = real_glColor4d; swapped++; }
+        if (glad_glColor4dv == wrap_glColor4dv) { glad_glColor4dv = real_glColor4dv; swapped++; }
+        if (glad_glColor4f == wrap_glColor4f) { glad_glColor4f = real_glColor4f; swapped++; }
+        if (glad_glColor4fv == wrap_glColor4fv) { glad_glColor4fv = real_glColor4fv; swapped++; }
+        if (glad_glColor4i == wrap_glColor4i) { glad_glColor4i = real_glColor4i; swapped++; }
+        if (glad_glColor4iv == wrap_glColor4iv) { glad_glColor4iv = real_glColor4iv; swapped++; }
+        if (glad_glColor4s == wrap_glColor4s) { glad_glColor4s = real_glColor4s; swapped++; }
+        if (glad_glColor4sv == wrap_glColor4sv) { glad_glColor4sv = real_glColor4sv; swapped++; }
+        if (glad_glColor4ub == wrap_glColor4ub) { glad_glColor4ub = real_glColor4ub; swapped++; }
+        if (glad_glColor4ubv == wrap_glColor4ubv) { glad_glColor4ubv = real_glColor4ubv; swapped++; }
+        if (glad_glColor4ui == wrap_glColor4ui) { glad_glColor4ui = real_glColor4ui; swapped++; }
+        if (glad_glColor4uiv == wrap_glColor4uiv) { glad_glColor4uiv = real_glColor4uiv; swapped++; }
+        if (glad_glColor4us == wrap_glColor4us) { glad_glColor4us = real_glColor4us; swapped++; }
+        if (glad_glColor4usv == wrap_glColor4usv) { glad_glColor4usv = real_glColor4usv; swapped++; }
+        if (glad_glEdgeFlag == wrap_glEdgeFlag) { glad_glEdgeFlag = real_glEdgeFlag; swapped++; }
+        if (glad_glEdgeFlagv == wrap_glEdgeFlagv) { glad_glEdgeFlagv = real_glEdgeFlagv; swapped++; }
+        if (glad_glEnd == wrap_glEnd) { glad_glEnd = real_glEnd; swapped++; }
+        if (glad_glIndexd == wrap_glIndexd) { glad_glIndexd = real_glIndexd; swapped++; }
+        if (glad_glIndexdv == wrap_glIndexdv) { glad_glIndexdv = real_glIndexdv; swapped++; }
+        if (glad_glIndexf == wrap_glIndexf) { glad_glIndexf = real_glIndexf; swapped++; }
+        if (glad_glIndexfv == wrap_glIndexfv) { glad_glIndexfv = real_glIndexfv; swapped++; }
+        if (glad_glIndexi == wrap_glIndexi) { glad_glIndexi = real_glIndexi; swapped++; }
+        if (glad_glIndexiv == wrap_glIndexiv) { glad_glIndexiv = real_glIndexiv; swapped++; }
+        if (glad_glIndexs == wrap_glIndexs) { glad_glIndexs = real_glIndexs; swapped++; }
+        if (glad_glIndexsv == wrap_glIndexsv) { glad_glIndexsv = real_glIndexsv; swapped++; }
+        if (glad_glNormal3b == wrap_glNormal3b) { glad_glNormal3b = real_glNormal3b; swapped++; }
+        if (glad_glNormal3bv == wrap_glNormal3bv) { glad_glNormal3bv = real_glNormal3bv; swapped++; }
+        if (glad_glNormal3d == wrap_glNormal3d) { glad_glNormal3d = real_glNormal3d; swapped++; }
+        if (glad_glNormal3dv == wrap_glNormal3dv) { glad_glNormal3dv = real_glNormal3dv; swapped++; }
+        if (glad_glNormal3f == wrap_glNormal3f) { glad_glNormal3f = real_glNormal3f; swapped++; }
+        if (glad_glNormal3fv == wrap_glNormal3fv) { glad_glNormal3fv = real_glNormal3fv; swapped++; }
+        if (glad_glNormal3i == wrap_glNormal3i) { glad_glNormal3i = real_glNormal3i; swapped++; }
+        if (glad_glNormal3iv == wrap_glNormal3iv) { glad_glNormal3iv = real_glNormal3iv; swapped++; }
+        if (glad_glNormal3s == wrap_glNormal3s) { glad_glNormal3s = real_glNormal3s; swapped++; }
+        if (glad_glNormal3sv == wrap_glNormal3sv) { glad_glNormal3sv = real_glNormal3sv; swapped++; }
+        if (glad_glRasterPos2d == wrap_glRasterPos2d) { glad_glRasterPos2d = real_glRasterPos2d; swapped++; }
+        if (glad_glRasterPos2dv == wrap_glRasterPos2dv) { glad_glRasterPos2dv = real_glRasterPos2dv; swapped++; }
+        if (glad_glRasterPos2f == wrap_glRasterPos2f) { glad_glRasterPos2f = real_glRasterPos2f; swapped++; }
+        if (glad_glRasterPos2fv == wrap_glRasterPos2fv) { glad_glRasterPos2fv = real_glRasterPos2fv; swapped++; }
+        if (glad_glRasterPos2i == wrap_glRasterPos2i) { glad_glRasterPos2i = real_glRasterPos2i; swapped++; }
+        if (glad_glRasterPos2iv == wrap_glRasterPos2iv) { glad_glRasterPos2iv = real_glRasterPos2iv; swapped++; }
+        if (glad_glRasterPos2s == wrap_glRasterPos2s) { glad_glRasterPos2s = real_glRasterPos2s; swapped++; }
+        if (glad_glRasterPos2sv == wrap_glRasterPos2sv) { glad_glRasterPos2sv = real_glRasterPos2sv; swapped++; }
+        if (glad_glRasterPos3d == wrap_glRasterPos3d) { glad_glRasterPos3d = real_glRasterPos3d; swapped++; }
+        if (glad_glRasterPos3dv == wrap_glRasterPos3dv) { glad_glRasterPos3dv = real_glRasterPos3dv; swapped++; }
+        if (glad_glRasterPos3f == wrap_glRasterPos3f) { glad_glRasterPos3f = real_glRasterPos3f; swapped++; }
+        if (glad_glRasterPos3fv == wrap_glRasterPos3fv) { glad_glRasterPos3fv = real_glRasterPos3fv; swapped++; }
+        if (glad_glRasterPos3i == wrap_glRasterPos3i) { glad_glRasterPos3i = real_glRasterPos3i; swapped++; }
+        if (glad_glRasterPos3iv == wrap_glRasterPos3iv) { glad_glRasterPos3iv = real_glRasterPos3iv; swapped++; }
+        if (glad_glRasterPos3s == wrap_glRasterPos3s) { glad_glRasterPos3s = real_glRasterPos3s; swapped++; }
+        if (glad_glRasterPos3sv == wrap_glRasterPos3sv) { glad_glRasterPos3sv = real_glRasterPos3sv; swapped++; }
+        if (glad_glRasterPos4d == wrap_glRasterPos4d) { glad_glRasterPos4d = real_glRasterPos4d; swapped++; }
+        if (glad_glRasterPos4dv == wrap_glRasterPos4dv) { glad_glRasterPos4dv = real_glRasterPos4dv; swapped++; }
+        if (glad_glRasterPos4f == wrap_glRasterPos4f) { glad_glRasterPos4f = real_glRasterPos4f; swapped++; }
+        if (glad_glRasterPos4fv == wrap_glRasterPos4fv) { glad_glRasterPos4fv = real_glRasterPos4fv; swapped++; }
+        if (glad_glRasterPos4i == wrap_glRasterPos4i) { glad_glRasterPos4i = real_glRasterPos4i; swapped++; }
+        if (glad_glRasterPos4iv == wrap_glRasterPos4iv) { glad_glRasterPos4iv = real_glRasterPos4iv; swapped++; }
+        if (glad_glRasterPos4s == wrap_glRasterPos4s) { glad_glRasterPos4s = real_glRasterPos4s; swapped++; }
+        if (glad_glRasterPos4sv == wrap_glRasterPos4sv) { glad_glRasterPos4sv = real_glRasterPos4sv; swapped++; }
+        if (glad_glRectd == wrap_glRectd) { glad_glRectd = real_glRectd; swapped++; }
+        if (glad_glRectdv == wrap_glRectdv) { glad_glRectdv = real_glRectdv; swapped++; }
+        if (glad_glRectf == wrap_glRectf) { glad_glRectf = real_glRectf; swapped++; }
+        if (glad_glRectfv == wrap_glRectfv) { glad_glRectfv = real_glRectfv; swapped++; }
+        if (glad_glRecti == wrap_glRecti) { glad_glRecti = real_glRecti; swapped++; }
+        if (glad_glRectiv == wrap_glRectiv) { glad_glRectiv = real_glRectiv; swapped++; }
+        if (glad_glRects == wrap_glRects) { glad_glRects = real_glRects; swapped++; }
+        if (glad_glRectsv == wrap_glRectsv) { glad_glRectsv = real_glRectsv; swapped++; }
+        if (glad_glTexCoord1d == wrap_glTexCoord1d) { glad_glTexCoord1d = real_glTexCoord1d; swapped++; }
+        if (glad_glTexCoord1dv == wrap_glTexCoord1dv) { glad_glTexCoord1dv = real_glTexCoord1dv; swapped++; }
+        if (glad_glTexCoord1f == wrap_glTexCoord1f) { glad_glTexCoord1f = real_glTexCoord1f; swapped++; }
+        if (glad_glTexCoord1fv == wrap_glTexCoord1fv) { glad_glTexCoord1fv = real_glTexCoord1fv; swapped++; }
+        if (glad_glTexCoord1i == wrap_glTexCoord1i) { glad_glTexCoord1i = real_glTexCoord1i; swapped++; }
+        if (glad_glTexCoord1iv == wrap_glTexCoord1iv) { glad_glTexCoord1iv = real_glTexCoord1iv; swapped++; }
+        if (glad_glTexCoord1s == wrap_glTexCoord1s) { glad_glTexCoord1s = real_glTexCoord1s; swapped++; }
+        if (glad_glTexCoord1sv == wrap_glTexCoord1sv) { glad_glTexCoord1sv = real_glTexCoord1sv; swapped++; }
+        if (glad_glTexCoord2d == wrap_glTexCoord2d) { glad_glTexCoord2d = real_glTexCoord2d; swapped++; }
+        if (glad_glTexCoord2dv == wrap_glTexCoord2dv) { glad_glTexCoord2dv = real_glTexCoord2dv; swapped++; }
+        if (glad_glTexCoord2f == wrap_glTexCoord2f) { glad_glTexCoord2f = real_glTexCoord2f; swapped++; }
+        if (glad_glTexCoord2fv == wrap_glTexCoord2fv) { glad_glTexCoord2fv = real_glTexCoord2fv; swapped++; }
+        if (glad_glTexCoord2i == wrap_glTexCoord2i) { glad_glTexCoord2i = real_glTexCoord2i; swapped++; }
+        if (glad_glTexCoord2iv == wrap_glTexCoord2iv) { glad_glTexCoord2iv = real_glTexCoord2iv; swapped++; }
+        if (glad_glTexCoord2s == wrap_glTexCoord2s) { glad_glTexCoord2s = real_glTexCoord2s; swapped++; }
+        if (glad_glTexCoord2sv == wrap_glTexCoord2sv) { glad_glTexCoord2sv = real_glTexCoord2sv; swapped++; }
+        if (glad_glTexCoord3d == wrap_glTexCoord3d) { glad_glTexCoord3d = real_glTexCoord3d; swapped++; }
+        if (glad_glTexCoord3dv == wrap_glTexCoord3dv) { glad_glTexCoord3dv = real_glTexCoord3dv; swapped++; }
+        if (glad_glTexCoord3f == wrap_glTexCoord3f) { glad_glTexCoord3f = real_glTexCoord3f; swapped++; }
+        if (glad_glTexCoord3fv == wrap_glTexCoord3fv) { glad_glTexCoord3fv = real_glTexCoord3fv; swapped++; }
+        if (glad_glTexCoord3i == wrap_glTexCoord3i) { glad_glTexCoord3i = real_glTexCoord3i; swapped++; }
+        if (glad_glTexCoord3iv == wrap_glTexCoord3iv) { glad_glTexCoord3iv = real_glTexCoord3iv; swapped++; }
+        if (glad_glTexCoord3s == wrap_glTexCoord3s) { glad_glTexCoord3s = real_glTexCoord3s; swapped++; }
+        if (glad_glTexCoord3sv == wrap_glTexCoord3sv) { glad_glTexCoord3sv = real_glTexCoord3sv; swapped++; }
+        if (glad_glTexCoord4d == wrap_glTexCoord4d) { glad_glTexCoord4d = real_glTexCoord4d; swapped++; }
+        if (glad_glTexCoord4dv == wrap_glTexCoord4dv) { glad_glTexCoord4dv = real_glTexCoord4dv; swapped++; }
+        if (glad_glTexCoord4f == wrap_glTexCoord4f) { glad_glTexCoord4f = real_glTexCoord4f; swapped++; }
+        if (glad_glTexCoord4fv == wrap_glTexCoord4fv) { glad_glTexCoord4fv = real_glTexCoord4fv; swapped++; }
+        if (glad_glTexCoord4i == wrap_glTexCoord4i) { glad_glTexCoord4i = real_glTexCoord4i; swapped++; }
+        if (glad_glTexCoord4iv == wrap_glTexCoord4iv) { glad_glTexCoord4iv = real_glTexCoord4iv; swapped++; }
+        if (glad_glTexCoord4s == wrap_glTexCoord4s) { glad_glTexCoord4s = real_glTexCoord4s; swapped++; }
+        if (glad_glTexCoord4sv == wrap_glTexCoord4sv) { glad_glTexCoord4sv = real_glTexCoord4sv; swapped++; }
+        if (glad_glVertex2d == wrap_glVertex2d) { glad_glVertex2d = real_glVertex2d; swapped++; }
+        if (glad_glVertex2dv == wrap_glVertex2dv) { glad_glVertex2dv = real_glVertex2dv; swapped++; }
+        if (glad_glVertex2f == wrap_glVertex2f) { glad_glVertex2f = real_glVertex2f; swapped++; }
+        if (glad_glVertex2fv == wrap_glVertex2fv) { glad_glVertex2fv = real_glVertex2fv; swapped++; }
+        if (glad_glVertex2i == wrap_glVertex2i) { glad_glVertex2i = real_glVertex2i; swapped++; }
+        if (glad_glVertex2iv == wrap_glVertex2iv) { glad_glVertex2iv = real_glVertex2iv; swapped++; }
+        if (glad_glVertex2s == wrap_glVertex2s) { glad_glVertex2s = real_glVertex2s; swapped++; }
+        if (glad_glVertex2sv == wrap_glVertex2sv) { glad_glVertex2sv = real_glVertex2sv; swapped++; }
+        if (glad_glVertex3d == wrap_glVertex3d) { glad_glVertex3d = real_glVertex3d; swapped++; }
+        if (glad_glVertex3dv == wrap_glVertex3dv) { glad_glVertex3dv = real_glVertex3dv; swapped++; }
+        if (glad_glVertex3f == wrap_glVertex3f) { glad_glVertex3f = real_glVertex3f; swapped++; }
+        if (glad_glVertex3fv == wrap_glVertex3fv) { glad_glVertex3fv = real_glVertex3fv; swapped++; }
+        if (glad_glVertex3i == wrap_glVertex3i) { glad_glVertex3i = real_glVertex3i; swapped++; }
+        if (glad_glVertex3iv == wrap_glVertex3iv) { glad_glVertex3iv = real_glVertex3iv; swapped++; }
+        if (glad_glVertex3s == wrap_glVertex3s) { glad_glVertex3s = real_glVertex3s; swapped++; }
+        if (glad_glVertex3sv == wrap_glVertex3sv) { glad_glVertex3sv = real_glVertex3sv; swapped++; }
+        if (glad_glVertex4d == wrap_glVertex4d) { glad_glVertex4d = real_glVertex4d; swapped++; }
+        if (glad_glVertex4dv == wrap_glVertex4dv) { glad_glVertex4dv = real_glVertex4dv; swapped++; }
+        if (glad_glVertex4f == wrap_glVertex4f) { glad_glVertex4f = real_glVertex4f; swapped++; }
+        if (glad_glVertex4fv == wrap_glVertex4fv) { glad_glVertex4fv = real_glVertex4fv; swapped++; }
+        if (glad_glVertex4i == wrap_glVertex4i) { glad_glVertex4i = real_glVertex4i; swapped++; }
+        if (glad_glVertex4iv == wrap_glVertex4iv) { glad_glVertex4iv = real_glVertex4iv; swapped++; }
+        if (glad_glVertex4s == wrap_glVertex4s) { glad_glVertex4s = real_glVertex4s; swapped++; }
+        if (glad_glVertex4sv == wrap_glVertex4sv) { glad_glVertex4sv = real_glVertex4sv; swapped++; }
+        if (glad_glClipPlane == wrap_glClipPlane) { glad_glClipPlane = real_glClipPlane; swapped++; }
+        if (glad_glColorMaterial == wrap_glColorMaterial) { glad_glColorMaterial = real_glColorMaterial; swapped++; }
+        if (glad_glFogf == wrap_glFogf) { glad_glFogf = real_glFogf; swapped++; }
+        if (glad_glFogfv == wrap_glFogfv) { glad_glFogfv = real_glFogfv; swapped++; }
+        if (glad_glFogi == wrap_glFogi) { glad_glFogi = real_glFogi; swapped++; }
+        if (glad_glFogiv == wrap_glFogiv) { glad_glFogiv = real_glFogiv; swapped++; }
+        if (glad_glLightf == wrap_glLightf) { glad_glLightf = real_glLightf; swapped++; }
+        if (glad_glLightfv == wrap_glLightfv) { glad_glLightfv = real_glLightfv; swapped++; }
+        if (glad_glLighti == wrap_glLighti) { glad_glLighti = real_glLighti; swapped++; }
+        if (glad_glLightiv == wrap_glLightiv) { glad_glLightiv = real_glLightiv; swapped++; }
+        if (glad_glLightModelf == wrap_glLightModelf) { glad_glLightModelf = real_glLightModelf; swapped++; }
+        if (glad_glLightModelfv == wrap_glLightModelfv) { glad_glLightModelfv = real_glLightModelfv; swapped++; }
+        if (glad_glLightModeli == wrap_glLightModeli) { glad_glLightModeli = real_glLightModeli; swapped++; }
+        if (glad_glLightModeliv == wrap_glLightModeliv) { glad_glLightModeliv = real_glLightModeliv; swapped++; }
+        if (glad_glLineStipple == wrap_glLineStipple) { glad_glLineStipple = real_glLineStipple; swapped++; }
+        if (glad_glMaterialf == wrap_glMaterialf) { glad_glMaterialf = real_glMaterialf; swapped++; }
+        if (glad_glMaterialfv == wrap_glMaterialfv) { glad_glMaterialfv = real_glMaterialfv; swapped++; }
+        if (glad_glMateriali == wrap_glMateriali) { glad_glMateriali = real_glMateriali; swapped++; }
+        if (glad_glMaterialiv == wrap_glMaterialiv) { glad_glMaterialiv = real_glMaterialiv; swapped++; }
+        if (glad_glPolygonStipple == wrap_glPolygonStipple) { glad_glPolygonStipple = real_glPolygonStipple; swapped++; }
+        if (glad_glShadeModel == wrap_glShadeModel) { glad_glShadeModel = real_glShadeModel; swapped++; }
+        if (glad_glTexEnvf == wrap_glTexEnvf) { glad_glTexEnvf = real_glTexEnvf; swapped++; }
+        if (glad_glTexEnvfv == wrap_glTexEnvfv) { glad_glTexEnvfv = real_glTexEnvfv; swapped++; }
+        if (glad_glTexEnvi == wrap_glTexEnvi) { glad_glTexEnvi = real_glTexEnvi; swapped++; }
+        if (glad_glTexEnviv == wrap_glTexEnviv) { glad_glTexEnviv = real_glTexEnviv; swapped++; }
+        if (glad_glTexGend == wrap_glTexGend) { glad_glTexGend = real_glTexGend; swapped++; }
+        if (glad_glTexGendv == wrap_glTexGendv) { glad_glTexGendv = real_glTexGendv; swapped++; }
+        if (glad_glTexGenf == wrap_glTexGenf) { glad_glTexGenf = real_glTexGenf; swapped++; }
+        if (glad_glTexGenfv == wrap_glTexGenfv) { glad_glTexGenfv = real_glTexGenfv; swapped++; }
+        if (glad_glTexGeni == wrap_glTexGeni) { glad_glTexGeni = real_glTexGeni; swapped++; }
+        if (glad_glTexGeniv == wrap_glTexGeniv) { glad_glTexGeniv = real_glTexGeniv; swapped++; }
+        if (glad_glFeedbackBuffer == wrap_glFeedbackBuffer) { glad_glFeedbackBuffer = real_glFeedbackBuffer; swapped++; }
+        if (glad_glSelectBuffer == wrap_glSelectBuffer) { glad_glSelectBuffer = real_glSelectBuffer; swapped++; }
+        if (glad_glRenderMode == wrap_glRenderMode) { glad_glRenderMode = real_glRenderMode; swapped++; }
+        if (glad_glInitNames == wrap_glInitNames) { glad_glInitNames = real_glInitNames; swapped++; }
+        if (glad_glLoadName == wrap_glLoadName) { glad_glLoadName = real_glLoadName; swapped++; }
+        if (glad_glPassThrough == wrap_glPassThrough) { glad_glPassThrough = real_glPassThrough; swapped++; }
+        if (glad_glPopName == wrap_glPopName) { glad_glPopName = real_glPopName; swapped++; }
+        if (glad_glPushName == wrap_glPushName) { glad_glPushName = real_glPushName; swapped++; }
+        if (glad_glClearAccum == wrap_glClearAccum) { glad_glClearAccum = real_glClearAccum; swapped++; }
+        if (glad_glClearIndex == wrap_glClearIndex) { glad_glClearIndex = real_glClearIndex; swapped++; }
+        if (glad_glIndexMask == wrap_glIndexMask) { glad_glIndexMask = real_glIndexMask; swapped++; }
+        if (glad_glAccum == wrap_glAccum) { glad_glAccum = real_glAccum; swapped++; }
+        if (glad_glPopAttrib == wrap_glPopAttrib) { glad_glPopAttrib = real_glPopAttrib; swapped++; }
+        if (glad_glPushAttrib == wrap_glPushAttrib) { glad_glPushAttrib = real_glPushAttrib; swapped++; }
+        if (glad_glMap1d == wrap_glMap1d) { glad_glMap1d = real_glMap1d; swapped++; }
+        if (glad_glMap1f == wrap_glMap1f) { glad_glMap1f = real_glMap1f; swapped++; }
+        if (glad_glMap2d == wrap_glMap2d) { glad_glMap2d = real_glMap2d; swapped++; }
+        if (glad_glMap2f == wrap_glMap2f) { glad_glMap2f = real_glMap2f; swapped++; }
+        if (glad_glMapGrid1d == wrap_glMapGrid1d) { glad_glMapGrid1d = real_glMapGrid1d; swapped++; }
+        if (glad_glMapGrid1f == wrap_glMapGrid1f) { glad_glMapGrid1f = real_glMapGrid1f; swapped++; }
+        if (glad_glMapGrid2d == wrap_glMapGrid2d) { glad_glMapGrid2d = real_glMapGrid2d; swapped++; }
+        if (glad_glMapGrid2f == wrap_glMapGrid2f) { glad_glMapGrid2f = real_glMapGrid2f; swapped++; }
+        if (glad_glEvalCoord1d == wrap_glEvalCoord1d) { glad_glEvalCoord1d = real_glEvalCoord1d; swapped++; }
+        if (glad_glEvalCoord1dv == wrap_glEvalCoord1dv) { glad_glEvalCoord1dv = real_glEvalCoord1dv; swapped++; }
+        if (glad_glEvalCoord1f == wrap_glEvalCoord1f) { glad_glEvalCoord1f = real_glEvalCoord1f; swapped++; }
+        if (glad_glEvalCoord1fv == wrap_glEvalCoord1fv) { glad_glEvalCoord1fv = real_glEvalCoord1fv; swapped++; }
+        if (glad_glEvalCoord2d == wrap_glEvalCoord2d) { glad_glEvalCoord2d = real_glEvalCoord2d; swapped++; }
+        if (glad_glEvalCoord2dv == wrap_glEvalCoord2dv) { glad_glEvalCoord2dv = real_glEvalCoord2dv; swapped++; }
+        if (glad_glEvalCoord2f == wrap_glEvalCoord2f) { glad_glEvalCoord2f = real_glEvalCoord2f; swapped++; }
+        if (glad_glEvalCoord2fv == wrap_glEvalCoord2fv) { glad_glEvalCoord2fv = real_glEvalCoord2fv; swapped++; }
+        if (glad_glEvalMesh1 == wrap_glEvalMesh1) { glad_glEvalMesh1 = real_glEvalMesh1; swapped++; }
+        if (glad_glEvalPoint1 == wrap_glEvalPoint1) { glad_glEvalPoint1 = real_glEvalPoint1; swapped++; }
+        if (glad_glEvalMesh2 == wrap_glEvalMesh2) { glad_glEvalMesh2 = real_glEvalMesh2; swapped++; }
+        if (glad_glEvalPoint2 == wrap_glEvalPoint2) { glad_glEvalPoint2 = real_glEvalPoint2; swapped++; }
+        if (glad_glAlphaFunc == wrap_glAlphaFunc) { glad_glAlphaFunc = real_glAlphaFunc; swapped++; }
+        if (glad_glPixelZoom == wrap_glPixelZoom) { glad_glPixelZoom = real_glPixelZoom; swapped++; }
+        if (glad_glPixelTransferf == wrap_glPixelTransferf) { glad_glPixelTransferf = real_glPixelTransferf; swapped++; }
+        if (glad_glPixelTransferi == wrap_glPixelTransferi) { glad_glPixelTransferi = real_glPixelTransferi; swapped++; }
+        if (glad_glPixelMapfv == wrap_glPixelMapfv) { glad_glPixelMapfv = real_glPixelMapfv; swapped++; }
+        if (glad_glPixelMapuiv == wrap_glPixelMapuiv) { glad_glPixelMapuiv = real_glPixelMapuiv; swapped++; }
+        if (glad_glPixelMapusv == wrap_glPixelMapusv) { glad_glPixelMapusv = real_glPixelMapusv; swapped++; }
+        if (glad_glCopyPixels == wrap_glCopyPixels) { glad_glCopyPixels = real_glCopyPixels; swapped++; }
+        if (glad_glDrawPixels == wrap_glDrawPixels) { glad_glDrawPixels = real_glDrawPixels; swapped++; }
+        if (glad_glGetClipPlane == wrap_glGetClipPlane) { glad_glGetClipPlane = real_glGetClipPlane; swapped++; }
+        if (glad_glGetLightfv == wrap_glGetLightfv) { glad_glGetLightfv = real_glGetLightfv; swapped++; }
+        if (glad_glGetLightiv == wrap_glGetLightiv) { glad_glGetLightiv = real_glGetLightiv; swapped++; }
+        if (glad_glGetMapdv == wrap_glGetMapdv) { glad_glGetMapdv = real_glGetMapdv; swapped++; }
+        if (glad_glGetMapfv == wrap_glGetMapfv) { glad_glGetMapfv = real_glGetMapfv; swapped++; }
+        if (glad_glGetMapiv == wrap_glGetMapiv) { glad_glGetMapiv = real_glGetMapiv; swapped++; }
+        if (glad_glGetMaterialfv == wrap_glGetMaterialfv) { glad_glGetMaterialfv = real_glGetMaterialfv; swapped++; }
+        if (glad_glGetMaterialiv == wrap_glGetMaterialiv) { glad_glGetMaterialiv = real_glGetMaterialiv; swapped++; }
+        if (glad_glGetPixelMapfv == wrap_glGetPixelMapfv) { glad_glGetPixelMapfv = real_glGetPixelMapfv; swapped++; }
+        if (glad_glGetPixelMapuiv == wrap_glGetPixelMapuiv) { glad_glGetPixelMapuiv = real_glGetPixelMapuiv; swapped++; }
+        if (glad_glGetPixelMapusv == wrap_glGetPixelMapusv) { glad_glGetPixelMapusv = real_glGetPixelMapusv; swapped++; }
+        if (glad_glGetPolygonStipple == wrap_glGetPolygonStipple) { glad_glGetPolygonStipple = real_glGetPolygonStipple; swapped++; }
+        if (glad_glGetTexEnvfv == wrap_glGetTexEnvfv) { glad_glGetTexEnvfv = real_glGetTexEnvfv; swapped++; }
+        if (glad_glGetTexEnviv == wrap_glGetTexEnviv) { glad_glGetTexEnviv = real_glGetTexEnviv; swapped++; }
+        if (glad_glGetTexGendv == wrap_glGetTexGendv) { glad_glGetTexGendv = real_glGetTexGendv; swapped++; }
+        if (glad_glGetTexGenfv == wrap_glGetTexGenfv) { glad_glGetTexGenfv = real_glGetTexGenfv; swapped++; }
+        if (glad_glGetTexGeniv == wrap_glGetTexGeniv) { glad_glGetTexGeniv = real_glGetTexGeniv; swapped++; }
+        if (glad_glIsList == wrap_glIsList) { glad_glIsList = real_glIsList; swapped++; }
+        if (glad_glFrustum == wrap_glFrustum) { glad_glFrustum = real_glFrustum; swapped++; }
+        if (glad_glLoadIdentity == wrap_glLoadIdentity) { glad_glLoadIdentity = real_glLoadIdentity; swapped++; }
+        if (glad_glLoadMatrixf == wrap_glLoadMatrixf) { glad_glLoadMatrixf = real_glLoadMatrixf; swapped++; }
+        if (glad_glLoadMatrixd == wrap_glLoadMatrixd) { glad_glLoadMatrixd = real_glLoadMatrixd; swapped++; }
+        if (glad_glMatrixMode == wrap_glMatrixMode) { glad_glMatrixMode = real_glMatrixMode; swapped++; }
+        if (glad_glMultMatrixf == wrap_glMultMatrixf) { glad_glMultMatrixf = real_glMultMatrixf; swapped++; }
+        if (glad_glMultMatrixd == wrap_glMultMatrixd) { glad_glMultMatrixd = real_glMultMatrixd; swapped++; }
+        if (glad_glOrtho == wrap_glOrtho) { glad_glOrtho = real_glOrtho; swapped++; }
+        if (glad_glPopMatrix == wrap_glPopMatrix) { glad_glPopMatrix = real_glPopMatrix; swapped++; }
+        if (glad_glPushMatrix == wrap_glPushMatrix) { glad_glPushMatrix = real_glPushMatrix; swapped++; }
+        if (glad_glRotated == wrap_glRotated) { glad_glRotated = real_glRotated; swapped++; }
+        if (glad_glRotatef == wrap_glRotatef) { glad_glRotatef = real_glRotatef; swapped++; }
+        if (glad_glScaled == wrap_glScaled) { glad_glScaled = real_glScaled; swapped++; }
+        if (glad_glScalef == wrap_glScalef) { glad_glScalef = real_glScalef; swapped++; }
+        if (glad_glTranslated == wrap_glTranslated) { glad_glTranslated = real_glTranslated; swapped++; }
+        if (glad_glTranslatef == wrap_glTranslatef) { glad_glTranslatef = real_glTranslatef; swapped++; }
+        if (glad_glDrawArrays == wrap_glDrawArrays) { glad_glDrawArrays = real_glDrawArrays; swapped++; }
+        if (glad_glDrawElements == wrap_glDrawElements) { glad_glDrawElements = real_glDrawElements; swapped++; }
+        if (glad_glGetPointerv == wrap_glGetPointerv) { glad_glGetPointerv = real_glGetPointerv; swapped++; }
+        if (glad_glPolygonOffset == wrap_glPolygonOffset) { glad_glPolygonOffset = real_glPolygonOffset; swapped++; }
+        if (glad_glCopyTexImage1D == wrap_glCopyTexImage1D) { glad_glCopyTexImage1D = real_glCopyTexImage1D; swapped++; }
+        if (glad_glCopyTexImage2D == wrap_glCopyTexImage2D) { glad_glCopyTexImage2D = real_glCopyTexImage2D; swapped++; }
+        if (glad_glCopyTexSubImage1D == wrap_glCopyTexSubImage1D) { glad_glCopyTexSubImage1D = real_glCopyTexSubImage1D; swapped++; }
+        if (glad_glCopyTexSubImage2D == wrap_glCopyTexSubImage2D) { glad_glCopyTexSubImage2D = real_glCopyTexSubImage2D; swapped++; }
+        if (glad_glTexSubImage1D == wrap_glTexSubImage1D) { glad_glTexSubImage1D = real_glTexSubImage1D; swapped++; }
+        if (glad_glTexSubImage2D == wrap_glTexSubImage2D) { glad_glTexSubImage2D = real_glTexSubImage2D; swapped++; }
+        if (glad_glBindTexture == wrap_glBindTexture) { glad_glBindTexture = real_glBindTexture; swapped++; }
+        if (glad_glDeleteTextures == wrap_glDeleteTextures) { glad_glDeleteTextures = real_glDeleteTextures; swapped++; }
+        if (glad_glGenTextures == wrap_glGenTextures) { glad_glGenTextures = real_glGenTextures; swapped++; }
+        if (glad_glIsTexture == wrap_glIsTexture) { glad_glIsTexture = real_glIsTexture; swapped++; }
+        if (glad_glArrayElement == wrap_glArrayElement) { glad_glArrayElement = real_glArrayElement; swapped++; }
+        if (glad_glColorPointer == wrap_glColorPointer) { glad_glColorPointer = real_glColorPointer; swapped++; }
+        if (glad_glDisableClientState == wrap_glDisableClientState) { glad_glDisableClientState = real_glDisableClientState; swapped++; }
+        if (glad_glEdgeFlagPointer == wrap_glEdgeFlagPointer) { glad_glEdgeFlagPointer = real_glEdgeFlagPointer; swapped++; }
+        if (glad_glEnableClientState == wrap_glEnableClientState) { glad_glEnableClientState = real_glEnableClientState; swapped++; }
+        if (glad_glIndexPointer == wrap_glIndexPointer) { glad_glIndexPointer = real_glIndexPointer; swapped++; }
+        if (glad_glInterleavedArrays == wrap_glInterleavedArrays) { glad_glInterleavedArrays = real_glInterleavedArrays; swapped++; }
+        if (glad_glNormalPointer == wrap_glNormalPointer) { glad_glNormalPointer = real_glNormalPointer; swapped++; }
+        if (glad_glTexCoordPointer == wrap_glTexCoordPointer) { glad_glTexCoordPointer = real_glTexCoordPointer; swapped++; }
+        if (glad_glVertexPointer == wrap_glVertexPointer) { glad_glVertexPointer = real_glVertexPointer; swapped++; }
+        if (glad_glAreTexturesResident == wrap_glAreTexturesResident) { glad_glAreTexturesResident = real_glAreTexturesResident; swapped++; }
+        if (glad_glPrioritizeTextures == wrap_glPrioritizeTextures) { glad_glPrioritizeTextures = real_glPrioritizeTextures; swapped++; }
+        if (glad_glIndexub == wrap_glIndexub) { glad_glIndexub = real_glIndexub; swapped++; }
+        if (glad_glIndexubv == wrap_glIndexubv) { glad_glIndexubv = real_glIndexubv; swapped++; }
+        if (glad_glPopClientAttrib == wrap_glPopClientAttrib) { glad_glPopClientAttrib = real_glPopClientAttrib; swapped++; }
+        if (glad_glPushClientAttrib == wrap_glPushClientAttrib) { glad_glPushClientAttrib = real_glPushClientAttrib; swapped++; }
+        if (glad_glDrawRangeElements == wrap_glDrawRangeElements) { glad_glDrawRangeElements = real_glDrawRangeElements; swapped++; }
+        if (glad_glTexImage3D == wrap_glTexImage3D) { glad_glTexImage3D = real_glTexImage3D; swapped++; }
+        if (glad_glTexSubImage3D == wrap_glTexSubImage3D) { glad_glTexSubImage3D = real_glTexSubImage3D; swapped++; }
+        if (glad_glCopyTexSubImage3D == wrap_glCopyTexSubImage3D) { glad_glCopyTexSubImage3D = real_glCopyTexSubImage3D; swapped++; }
+        if (glad_glActiveTexture == wrap_glActiveTexture) { glad_glActiveTexture = real_glActiveTexture; swapped++; }
+        if (glad_glSampleCoverage == wrap_glSampleCoverage) { glad_glSampleCoverage = real_glSampleCoverage; swapped++; }
+        if (glad_glCompressedTexImage3D == wrap_glCompressedTexImage3D) { glad_glCompressedTexImage3D = real_glCompressedTexImage3D; swapped++; }
+        if (glad_glCompressedTexImage2D == wrap_glCompressedTexImage2D) { glad_glCompressedTexImage2D = real_glCompressedTexImage2D; swapped++; }
+        if (glad_glCompressedTexImage1D == wrap_glCompressedTexImage1D) { glad_glCompressedTexImage1D = real_glCompressedTexImage1D; swapped++; }
+        if (glad_glCompressedTexSubImage3D == wrap_glCompressedTexSubImage3D) { glad_glCompressedTexSubImage3D = real_glCompressedTexSubImage3D; swapped++; }
+        if (glad_glCompressedTexSubImage2D == wrap_glCompressedTexSubImage2D) { glad_glCompressedTexSubImage2D = real_glCompressedTexSubImage2D; swapped++; }
+        if (glad_glCompressedTexSubImage1D == wrap_glCompressedTexSubImage1D) { glad_glCompressedTexSubImage1D = real_glCompressedTexSubImage1D; swapped++; }
+        if (glad_glGetCompressedTexImage == wrap_glGetCompressedTexImage) { glad_glGetCompressedTexImage = real_glGetCompressedTexImage; swapped++; }
+        if (glad_glClientActiveTexture == wrap_glClientActiveTexture) { glad_glClientActiveTexture = real_glClientActiveTexture; swapped++; }
+        if (glad_glMultiTexCoord1d == wrap_glMultiTexCoord1d) { glad_glMultiTexCoord1d = real_glMultiTexCoord1d; swapped++; }
+        if (glad_glMultiTexCoord1dv == wrap_glMultiTexCoord1dv) { glad_glMultiTexCoord1dv = real_glMultiTexCoord1dv; swapped++; }
+        if (glad_glMultiTexCoord1f == wrap_glMultiTexCoord1f) { glad_glMultiTexCoord1f = real_glMultiTexCoord1f; swapped++; }
+        if (glad_glMultiTexCoord1fv == wrap_glMultiTexCoord1fv) { glad_glMultiTexCoord1fv = real_glMultiTexCoord1fv; swapped++; }
+        if (glad_glMultiTexCoord1i == wrap_glMultiTexCoord1i) { glad_glMultiTexCoord1i = real_glMultiTexCoord1i; swapped++; }
+        if (glad_glMultiTexCoord1iv == wrap_glMultiTexCoord1iv) { glad_glMultiTexCoord1iv = real_glMultiTexCoord1iv; swapped++; }
+        if (glad_glMultiTexCoord1s == wrap_glMultiTexCoord1s) { glad_glMultiTexCoord1s = real_glMultiTexCoord1s; swapped++; }
+        if (glad_glMultiTexCoord1sv == wrap_glMultiTexCoord1sv) { glad_glMultiTexCoord1sv = real_glMultiTexCoord1sv; swapped++; }
+        if (glad_glMultiTexCoord2d == wrap_glMultiTexCoord2d) { glad_glMultiTexCoord2d = real_glMultiTexCoord2d; swapped++; }
+        if (glad_glMultiTexCoord2dv == wrap_glMultiTexCoord2dv) { glad_glMultiTexCoord2dv = real_glMultiTexCoord2dv; swapped++; }
+        if (glad_glMultiTexCoord2f == wrap_glMultiTexCoord2f) { glad_glMultiTexCoord2f = real_glMultiTexCoord2f; swapped++; }
+        if (glad_glMultiTexCoord2fv == wrap_glMultiTexCoord2fv) { glad_glMultiTexCoord2fv = real_glMultiTexCoord2fv; swapped++; }
+        if (glad_glMultiTexCoord2i == wrap_glMultiTexCoord2i) { glad_glMultiTexCoord2i = real_glMultiTexCoord2i; swapped++; }
+        if (glad_glMultiTexCoord2iv == wrap_glMultiTexCoord2iv) { glad_glMultiTexCoord2iv = real_glMultiTexCoord2iv; swapped++; }
+        if (glad_glMultiTexCoord2s == wrap_glMultiTexCoord2s) { glad_glMultiTexCoord2s = real_glMultiTexCoord2s; swapped++; }
+        if (glad_glMultiTexCoord2sv == wrap_glMultiTexCoord2sv) { glad_glMultiTexCoord2sv = real_glMultiTexCoord2sv; swapped++; }
+        if (glad_glMultiTexCoord3d == wrap_glMultiTexCoord3d) { glad_glMultiTexCoord3d = real_glMultiTexCoord3d; swapped++; }
+        if (glad_glMultiTexCoord3dv == wrap_glMultiTexCoord3dv) { glad_glMultiTexCoord3dv = real_glMultiTexCoord3dv; swapped++; }
+        if (glad_glMultiTexCoord3f == wrap_glMultiTexCoord3f) { glad_glMultiTexCoord3f = real_glMultiTexCoord3f; swapped++; }
+        if (glad_glMultiTexCoord3fv == wrap_glMultiTexCoord3fv) { glad_glMultiTexCoord3fv = real_glMultiTexCoord3fv; swapped++; }
+        if (glad_glMultiTexCoord3i == wrap_glMultiTexCoord3i) { glad_glMultiTexCoord3i = real_glMultiTexCoord3i; swapped++; }
+        if (glad_glMultiTexCoord3iv == wrap_glMultiTexCoord3iv) { glad_glMultiTexCoord3iv = real_glMultiTexCoord3iv; swapped++; }
+        if (glad_glMultiTexCoord3s == wrap_glMultiTexCoord3s) { glad_glMultiTexCoord3s = real_glMultiTexCoord3s; swapped++; }
+        if (glad_glMultiTexCoord3sv == wrap_glMultiTexCoord3sv) { glad_glMultiTexCoord3sv = real_glMultiTexCoord3sv; swapped++; }
+        if (glad_glMultiTexCoord4d == wrap_glMultiTexCoord4d) { glad_glMultiTexCoord4d = real_glMultiTexCoord4d; swapped++; }
+        if (glad_glMultiTexCoord4dv == wrap_glMultiTexCoord4dv) { glad_glMultiTexCoord4dv = real_glMultiTexCoord4dv; swapped++; }
+        if (glad_glMultiTexCoord4f == wrap_glMultiTexCoord4f) { glad_glMultiTexCoord4f = real_glMultiTexCoord4f; swapped++; }
+        if (glad_glMultiTexCoord4fv == wrap_glMultiTexCoord4fv) { glad_glMultiTexCoord4fv = real_glMultiTexCoord4fv; swapped++; }
+        if (glad_glMultiTexCoord4i == wrap_glMultiTexCoord4i) { glad_glMultiTexCoord4i = real_glMultiTexCoord4i; swapped++; }
+        if (glad_glMultiTexCoord4iv == wrap_glMultiTexCoord4iv) { glad_glMultiTexCoord4iv = real_glMultiTexCoord4iv; swapped++; }
+        if (glad_glMultiTexCoord4s == wrap_glMultiTexCoord4s) { glad_glMultiTexCoord4s = real_glMultiTexCoord4s; swapped++; }
+        if (glad_glMultiTexCoord4sv == wrap_glMultiTexCoord4sv) { glad_glMultiTexCoord4sv = real_glMultiTexCoord4sv; swapped++; }
+        if (glad_glLoadTransposeMatrixf == wrap_glLoadTransposeMatrixf) { glad_glLoadTransposeMatrixf = real_glLoadTransposeMatrixf; swapped++; }
+        if (glad_glLoadTransposeMatrixd == wrap_glLoadTransposeMatrixd) { glad_glLoadTransposeMatrixd = real_glLoadTransposeMatrixd; swapped++; }
+        if (glad_glMultTransposeMatrixf == wrap_glMultTransposeMatrixf) { glad_glMultTransposeMatrixf = real_glMultTransposeMatrixf; swapped++; }
+        if (glad_glMultTransposeMatrixd == wrap_glMultTransposeMatrixd) { glad_glMultTransposeMatrixd = real_glMultTransposeMatrixd; swapped++; }
+        if (glad_glBlendFuncSeparate == wrap_glBlendFuncSeparate) { glad_glBlendFuncSeparate = real_glBlendFuncSeparate; swapped++; }
+        if (glad_glMultiDrawArrays == wrap_glMultiDrawArrays) { glad_glMultiDrawArrays = real_glMultiDrawArrays; swapped++; }
+        if (glad_glMultiDrawElements == wrap_glMultiDrawElements) { glad_glMultiDrawElements = real_glMultiDrawElements; swapped++; }
+        if (glad_glPointParameterf == wrap_glPointParameterf) { glad_glPointParameterf = real_glPointParameterf; swapped++; }
+        if (glad_glPointParameterfv == wrap_glPointParameterfv) { glad_glPointParameterfv = real_glPointParameterfv; swapped++; }
+        if (glad_glPointParameteri == wrap_glPointParameteri) { glad_glPointParameteri = real_glPointParameteri; swapped++; }
+        if (glad_glPointParameteriv == wrap_glPointParameteriv) { glad_glPointParameteriv = real_glPointParameteriv; swapped++; }
+        if (glad_glFogCoordf == wrap_glFogCoordf) { glad_glFogCoordf = real_glFogCoordf; swapped++; }
+        if (glad_glFogCoordfv == wrap_glFogCoordfv) { glad_glFogCoordfv = real_glFogCoordfv; swapped++; }
+        if (glad_glFogCoordd == wrap_glFogCoordd) { glad_glFogCoordd = real_glFogCoordd; swapped++; }
+        if (glad_glFogCoorddv == wrap_glFogCoorddv) { glad_glFogCoorddv = real_glFogCoorddv; swapped++; }
+        if (glad_glFogCoordPointer == wrap_glFogCoordPointer) { glad_glFogCoordPointer = real_glFogCoordPointer; swapped++; }
+        if (glad_glSecondaryColor3b == wrap_glSecondaryColor3b) { glad_glSecondaryColor3b = real_glSecondaryColor3b; swapped++; }
+        if (glad_glSecondaryColor3bv == wrap_glSecondaryColor3bv) { glad_glSecondaryColor3bv = real_glSecondaryColor3bv; swapped++; }
+        if (glad_glSecondaryColor3d == wrap_glSecondaryColor3d) { glad_glSecondaryColor3d = real_glSecondaryColor3d; swapped++; }
+        if (glad_glSecondaryColor3dv == wrap_glSecondaryColor3dv) { glad_glSecondaryColor3dv = real_glSecondaryColor3dv; swapped++; }
+        if (glad_glSecondaryColor3f == wrap_glSecondaryColor3f) { glad_glSecondaryColor3f = real_glSecondaryColor3f; swapped++; }
+        if (glad_glSecondaryColor3fv == wrap_glSecondaryColor3fv) { glad_glSecondaryColor3fv = real_glSecondaryColor3fv; swapped++; }
+        if (glad_glSecondaryColor3i == wrap_glSecondaryColor3i) { glad_glSecondaryColor3i = real_glSecondaryColor3i; swapped++; }
+        if (glad_glSecondaryColor3iv == wrap_glSecondaryColor3iv) { glad_glSecondaryColor3iv = real_glSecondaryColor3iv; swapped++; }
+        if (glad_glSecondaryColor3s == wrap_glSecondaryColor3s) { glad_glSecondaryColor3s = real_glSecondaryColor3s; swapped++; }
+        if (glad_glSecondaryColor3sv == wrap_glSecondaryColor3sv) { glad_glSecondaryColor3sv = real_glSecondaryColor3sv; swapped++; }
+        if (glad_glSecondaryColor3ub == wrap_glSecondaryColor3ub) { glad_glSecondaryColor3ub = real_glSecondaryColor3ub; swapped++; }
+        if (glad_glSecondaryColor3ubv == wrap_glSecondaryColor3ubv) { glad_glSecondaryColor3ubv = real_glSecondaryColor3ubv; swapped++; }
+        if (glad_glSecondaryColor3ui == wrap_glSecondaryColor3ui) { glad_glSecondaryColor3ui = real_glSecondaryColor3ui; swapped++; }
+        if (glad_glSecondaryColor3uiv == wrap_glSecondaryColor3uiv) { glad_glSecondaryColor3uiv = real_glSecondaryColor3uiv; swapped++; }
+        if (glad_glSecondaryColor3us == wrap_glSecondaryColor3us) { glad_glSecondaryColor3us = real_glSecondaryColor3us; swapped++; }
+        if (glad_glSecondaryColor3usv == wrap_glSecondaryColor3usv) { glad_glSecondaryColor3usv = real_glSecondaryColor3usv; swapped++; }
+        if (glad_glSecondaryColorPointer == wrap_glSecondaryColorPointer) { glad_glSecondaryColorPointer = real_glSecondaryColorPointer; swapped++; }
+        if (glad_glWindowPos2d == wrap_glWindowPos2d) { glad_glWindowPos2d = real_glWindowPos2d; swapped++; }
+        if (glad_glWindowPos2dv == wrap_glWindowPos2dv) { glad_glWindowPos2dv = real_glWindowPos2dv; swapped++; }
+        if (glad_glWindowPos2f == wrap_glWindowPos2f) { glad_glWindowPos2f = real_glWindowPos2f; swapped++; }
+        if (glad_glWindowPos2fv == wrap_glWindowPos2fv) { glad_glWindowPos2fv = real_glWindowPos2fv; swapped++; }
+        if (glad_glWindowPos2i == wrap_glWindowPos2i) { glad_glWindowPos2i = real_glWindowPos2i; swapped++; }
+        if (glad_glWindowPos2iv == wrap_glWindowPos2iv) { glad_glWindowPos2iv = real_glWindowPos2iv; swapped++; }
+        if (glad_glWindowPos2s == wrap_glWindowPos2s) { glad_glWindowPos2s = real_glWindowPos2s; swapped++; }
+        if (glad_glWindowPos2sv == wrap_glWindowPos2sv) { glad_glWindowPos2sv = real_glWindowPos2sv; swapped++; }
+        if (glad_glWindowPos3d == wrap_glWindowPos3d) { glad_glWindowPos3d = real_glWindowPos3d; swapped++; }
+        if (glad_glWindowPos3dv == wrap_glWindowPos3dv) { glad_glWindowPos3dv = real_glWindowPos3dv; swapped++; }
+        if (glad_glWindowPos3f == wrap_glWindowPos3f) { glad_glWindowPos3f = real_glWindowPos3f; swapped++; }
+        if (glad_glWindowPos3fv == wrap_glWindowPos3fv) { glad_glWindowPos3fv = real_glWindowPos3fv; swapped++; }
+        if (glad_glWindowPos3i == wrap_glWindowPos3i) { glad_glWindowPos3i = real_glWindowPos3i; swapped++; }
+        if (glad_glWindowPos3iv == wrap_glWindowPos3iv) { glad_glWindowPos3iv = real_glWindowPos3iv; swapped++; }
+        if (glad_glWindowPos3s == wrap_glWindowPos3s) { glad_glWindowPos3s = real_glWindowPos3s; swapped++; }
+        if (glad_glWindowPos3sv == wrap_glWindowPos3sv) { glad_glWindowPos3sv = real_glWindowPos3sv; swapped++; }
+        if (glad_glBlendColor == wrap_glBlendColor) { glad_glBlendColor = real_glBlendColor; swapped++; }
+        if (glad_glBlendEquation == wrap_glBlendEquation) { glad_glBlendEquation = real_glBlendEquation; swapped++; }
+        if (glad_glGenQueries == wrap_glGenQueries) { glad_glGenQueries = real_glGenQueries; swapped++; }
+        if (glad_glDeleteQueries == wrap_glDeleteQueries) { glad_glDeleteQueries = real_glDeleteQueries; swapped++; }
+        if (glad_glIsQuery == wrap_glIsQuery) { glad_glIsQuery = real_glIsQuery; swapped++; }
+        if (glad_glBeginQuery == wrap_glBeginQuery) { glad_glBeginQuery = real_glBeginQuery; swapped++; }
+        if (glad_glEndQuery == wrap_glEndQuery) { glad_glEndQuery = real_glEndQuery; swapped++; }
+        if (glad_glGetQueryiv == wrap_glGetQueryiv) { glad_glGetQueryiv = real_glGetQueryiv; swapped++; }
+        if (glad_glGetQueryObjectiv == wrap_glGetQueryObjectiv) { glad_glGetQueryObjectiv = real_glGetQueryObjectiv; swapped++; }
+        if (glad_glGetQueryObjectuiv == wrap_glGetQueryObjectuiv) { glad_glGetQueryObjectuiv = real_glGetQueryObjectuiv; swapped++; }
+        if (glad_glBindBuffer == wrap_glBindBuffer) { glad_glBindBuffer = real_glBindBuffer; swapped++; }
+        if (glad_glDeleteBuffers == wrap_glDeleteBuffers) { glad_glDeleteBuffers = real_glDeleteBuffers; swapped++; }
+        if (glad_glGenBuffers == wrap_glGenBuffers) { glad_glGenBuffers = real_glGenBuffers; swapped++; }
+        if (glad_glIsBuffer == wrap_glIsBuffer) { glad_glIsBuffer = real_glIsBuffer; swapped++; }
+        if (glad_glBufferData == wrap_glBufferData) { glad_glBufferData = real_glBufferData; swapped++; }
+        if (glad_glBufferSubData == wrap_glBufferSubData) { glad_glBufferSubData = real_glBufferSubData; swapped++; }
+        if (glad_glGetBufferSubData == wrap_glGetBufferSubData) { glad_glGetBufferSubData = real_glGetBufferSubData; swapped++; }
+        if (glad_glMapBuffer == wrap_glMapBuffer) { glad_glMapBuffer = real_glMapBuffer; swapped++; }
+        if (glad_glUnmapBuffer == wrap_glUnmapBuffer) { glad_glUnmapBuffer = real_glUnmapBuffer; swapped++; }
+        if (glad_glGetBufferParameteriv == wrap_glGetBufferParameteriv) { glad_glGetBufferParameteriv = real_glGetBufferParameteriv; swapped++; }
+        if (glad_glGetBufferPointerv == wrap_glGetBufferPointerv) { glad_glGetBufferPointerv = real_glGetBufferPointerv; swapped++; }
+        if (glad_glBlendEquationSeparate == wrap_glBlendEquationSeparate) { glad_glBlendEquationSeparate = real_glBlendEquationSeparate; swapped++; }
+        if (glad_glDrawBuffers == wrap_glDrawBuffers) { glad_glDrawBuffers = real_glDrawBuffers; swapped++; }
+        if (glad_glStencilOpSeparate == wrap_glStencilOpSeparate) { glad_glStencilOpSeparate = real_glStencilOpSeparate; swapped++; }
+        if (glad_glStencilFuncSeparate == wrap_glStencilFuncSeparate) { glad_glStencilFuncSeparate = real_glStencilFuncSeparate; swapped++; }
+        if (glad_glStencilMaskSeparate == wrap_glStencilMaskSeparate) { glad_glStencilMaskSeparate = real_glStencilMaskSeparate; swapped++; }
+        if (glad_glAttachShader == wrap_glAttachShader) { glad_glAttachShader = real_glAttachShader; swapped++; }
+        if (glad_glBindAttribLocation == wrap_glBindAttribLocation) { glad_glBindAttribLocation = real_glBindAttribLocation; swapped++; }
+        if (glad_glCompileShader == wrap_glCompileShader) { glad_glCompileShader = real_glCompileShader; swapped++; }
+        if (glad_glCreateProgram == wrap_glCreateProgram) { glad_glCreateProgram = real_glCreateProgram; swapped++; }
+        if (glad_glCreateShader == wrap_glCreateShader) { glad_glCreateShader = real_glCreateShader; swapped++; }
+        if (glad_glDeleteProgram == wrap_glDeleteProgram) { glad_glDeleteProgram = real_glDeleteProgram; swapped++; }
+        if (glad_glDeleteShader == wrap_glDeleteShader) { glad_glDeleteShader = real_glDeleteShader; swapped++; }
+        if (glad_glDetachShader == wrap_glDetachShader) { glad_glDetachShader = real_glDetachShader; swapped++; }
+        if (glad_glDisableVertexAttribArray == wrap_glDisableVertexAttribArray) { glad_glDisableVertexAttribArray = real_glDisableVertexAttribArray; swapped++; }
+        if (glad_glEnableVertexAttribArray == wrap_glEnableVertexAttribArray) { glad_glEnableVertexAttribArray = real_glEnableVertexAttribArray; swapped++; }
+        if (glad_glGetActiveAttrib == wrap_glGetActiveAttrib) { glad_glGetActiveAttrib = real_glGetActiveAttrib; swapped++; }
+        if (glad_glGetActiveUniform == wrap_glGetActiveUniform) { glad_glGetActiveUniform = real_glGetActiveUniform; swapped++; }
+        if (glad_glGetAttachedShaders == wrap_glGetAttachedShaders) { glad_glGetAttachedShaders = real_glGetAttachedShaders; swapped++; }
+        if (glad_glGetAttribLocation == wrap_glGetAttribLocation) { glad_glGetAttribLocation = real_glGetAttribLocation; swapped++; }
+        if (glad_glGetProgramiv == wrap_glGetProgramiv) { glad_glGetProgramiv = real_glGetProgramiv; swapped++; }
+        if (glad_glGetProgramInfoLog == wrap_glGetProgramInfoLog) { glad_glGetProgramInfoLog = real_glGetProgramInfoLog; swapped++; }
+        if (glad_glGetShaderiv == wrap_glGetShaderiv) { glad_glGetShaderiv = real_glGetShaderiv; swapped++; }
+        if (glad_glGetShaderInfoLog == wrap_glGetShaderInfoLog) { glad_glGetShaderInfoLog = real_glGetShaderInfoLog; swapped++; }
+        if (glad_glGetShaderSource == wrap_glGetShaderSource) { glad_glGetShaderSource = real_glGetShaderSource; swapped++; }
+        if (glad_glGetUniformLocation == wrap_glGetUniformLocation) { glad_glGetUniformLocation = real_glGetUniformLocation; swapped++; }
+        if (glad_glGetUniformfv == wrap_glGetUniformfv) { glad_glGetUniformfv = real_glGetUniformfv; swapped++; }
+        if (glad_glGetUniformiv == wrap_glGetUniformiv) { glad_glGetUniformiv = real_glGetUniformiv; swapped++; }
+        if (glad_glGetVertexAttribdv == wrap_glGetVertexAttribdv) { glad_glGetVertexAttribdv = real_glGetVertexAttribdv; swapped++; }
+        if (glad_glGetVertexAttribfv == wrap_glGetVertexAttribfv) { glad_glGetVertexAttribfv = real_glGetVertexAttribfv; swapped++; }
+        if (glad_glGetVertexAttribiv == wrap_glGetVertexAttribiv) { glad_glGetVertexAttribiv = real_glGetVertexAttribiv; swapped++; }
+        if (glad_glGetVertexAttribPointerv == wrap_glGetVertexAttribPointerv) { glad_glGetVertexAttribPointerv = real_glGetVertexAttribPointerv; swapped++; }
+        if (glad_glIsProgram == wrap_glIsProgram) { glad_glIsProgram = real_glIsProgram; swapped++; }
+        if (glad_glIsShader == wrap_glIsShader) { glad_glIsShader = real_glIsShader; swapped++; }
+        if (glad_glLinkProgram == wrap_glLinkProgram) { glad_glLinkProgram = real_glLinkProgram; swapped++; }
+        if (glad_glShaderSource == wrap_glShaderSource) { glad_glShaderSource = real_glShaderSource; swapped++; }
+        if (glad_glUseProgram == wrap_glUseProgram) { glad_glUseProgram = real_glUseProgram; swapped++; }
+        if (glad_glUniform1f == wrap_glUniform1f) { glad_glUniform1f = real_glUniform1f; swapped++; }
+        if (glad_glUniform2f == wrap_glUniform2f) { glad_glUniform2f = real_glUniform2f; swapped++; }
+        if (glad_glUniform3f == wrap_glUniform3f) { glad_glUniform3f = real_glUniform3f; swapped++; }
+        if (glad_glUniform4f == wrap_glUniform4f) { glad_glUniform4f = real_glUniform4f; swapped++; }
+        if (glad_glUniform1i == wrap_glUniform1i) { glad_glUniform1i = real_glUniform1i; swapped++; }
+        if (glad_glUniform2i == wrap_glUniform2i) { glad_glUniform2i = real_glUniform2i; swapped++; }
+        if (glad_glUniform3i == wrap_glUniform3i) { glad_glUniform3i = real_glUniform3i; swapped++; }
+        if (glad_glUniform4i == wrap_glUniform4i) { glad_glUniform4i = real_glUniform4i; swapped++; }
+        if (glad_glUniform1fv == wrap_glUniform1fv) { glad_glUniform1fv = real_glUniform1fv; swapped++; }
+        if (glad_glUniform2fv == wrap_glUniform2fv) { glad_glUniform2fv = real_glUniform2fv; swapped++; }
+        if (glad_glUniform3fv == wrap_glUniform3fv) { glad_glUniform3fv = real_glUniform3fv; swapped++; }
+        if (glad_glUniform4fv == wrap_glUniform4fv) { glad_glUniform4fv = real_glUniform4fv; swapped++; }
+        if (glad_glUniform1iv == wrap_glUniform1iv) { glad_glUniform1iv = real_glUniform1iv; swapped++; }
+        if (glad_glUniform2iv == wrap_glUniform2iv) { glad_glUniform2iv = real_glUniform2iv; swapped++; }
+        if (glad_glUniform3iv == wrap_glUniform3iv) { glad_glUniform3iv = real_glUniform3iv; swapped++; }
+        if (glad_glUniform4iv == wrap_glUniform4iv) { glad_glUniform4iv = real_glUniform4iv; swapped++; }
+        if (glad_glUniformMatrix2fv == wrap_glUniformMatrix2fv) { glad_glUniformMatrix2fv = real_glUniformMatrix2fv; swapped++; }
+        if (glad_glUniformMatrix3fv == wrap_glUniformMatrix3fv) { glad_glUniformMatrix3fv = real_glUniformMatrix3fv; swapped++; }
+        if (glad_glUniformMatrix4fv == wrap_glUniformMatrix4fv) { glad_glUniformMatrix4fv = real_glUniformMatrix4fv; swapped++; }
+        if (glad_glValidateProgram == wrap_glValidateProgram) { glad_glValidateProgram = real_glValidateProgram; swapped++; }
+        if (glad_glVertexAttrib1d == wrap_glVertexAttrib1d) { glad_glVertexAttrib1d = real_glVertexAttrib1d; swapped++; }
+        if (glad_glVertexAttrib1dv == wrap_glVertexAttrib1dv) { glad_glVertexAttrib1dv = real_glVertexAttrib1dv; swapped++; }
+        if (glad_glVertexAttrib1f == wrap_glVertexAttrib1f) { glad_glVertexAttrib1f = real_glVertexAttrib1f; swapped++; }
+        if (glad_glVertexAttrib1fv == wrap_glVertexAttrib1fv) { glad_glVertexAttrib1fv = real_glVertexAttrib1fv; swapped++; }
+        if (glad_glVertexAttrib1s == wrap_glVertexAttrib1s) { glad_glVertexAttrib1s = real_glVertexAttrib1s; swapped++; }
+        if (glad_glVertexAttrib1sv == wrap_glVertexAttrib1sv) { glad_glVertexAttrib1sv = real_glVertexAttrib1sv; swapped++; }
+        if (glad_glVertexAttrib2d == wrap_glVertexAttrib2d) { glad_glVertexAttrib2d = real_glVertexAttrib2d; swapped++; }
+        if (glad_glVertexAttrib2dv == wrap_glVertexAttrib2dv) { glad_glVertexAttrib2dv = real_glVertexAttrib2dv; swapped++; }
+        if (glad_glVertexAttrib2f == wrap_glVertexAttrib2f) { glad_glVertexAttrib2f = real_glVertexAttrib2f; swapped++; }
+        if (glad_glVertexAttrib2fv == wrap_glVertexAttrib2fv) { glad_glVertexAttrib2fv = real_glVertexAttrib2fv; swapped++; }
+        if (glad_glVertexAttrib2s == wrap_glVertexAttrib2s) { glad_glVertexAttrib2s = real_glVertexAttrib2s; swapped++; }
+        if (glad_glVertexAttrib2sv == wrap_glVertexAttrib2sv) { glad_glVertexAttrib2sv = real_glVertexAttrib2sv; swapped++; }
+        if (glad_glVertexAttrib3d == wrap_glVertexAttrib3d) { glad_glVertexAttrib3d = real_glVertexAttrib3d; swapped++; }
+        if (glad_glVertexAttrib3dv == wrap_glVertexAttrib3dv) { glad_glVertexAttrib3dv = real_glVertexAttrib3dv; swapped++; }
+        if (glad_glVertexAttrib3f == wrap_glVertexAttrib3f) { glad_glVertexAttrib3f = real_glVertexAttrib3f; swapped++; }
+        if (glad_glVertexAttrib3fv == wrap_glVertexAttrib3fv) { glad_glVertexAttrib3fv = real_glVertexAttrib3fv; swapped++; }
+        if (glad_glVertexAttrib3s == wrap_glVertexAttrib3s) { glad_glVertexAttrib3s = real_glVertexAttrib3s; swapped++; }
+        if (glad_glVertexAttrib3sv == wrap_glVertexAttrib3sv) { glad_glVertexAttrib3sv = real_glVertexAttrib3sv; swapped++; }
+        if (glad_glVertexAttrib4Nbv == wrap_glVertexAttrib4Nbv) { glad_glVertexAttrib4Nbv = real_glVertexAttrib4Nbv; swapped++; }
+        if (glad_glVertexAttrib4Niv == wrap_glVertexAttrib4Niv) { glad_glVertexAttrib4Niv = real_glVertexAttrib4Niv; swapped++; }
+        if (glad_glVertexAttrib4Nsv == wrap_glVertexAttrib4Nsv) { glad_glVertexAttrib4Nsv = real_glVertexAttrib4Nsv; swapped++; }
+        if (glad_glVertexAttrib4Nub == wrap_glVertexAttrib4Nub) { glad_glVertexAttrib4Nub = real_glVertexAttrib4Nub; swapped++; }
+        if (glad_glVertexAttrib4Nubv == wrap_glVertexAttrib4Nubv) { glad_glVertexAttrib4Nubv = real_glVertexAttrib4Nubv; swapped++; }
+        if (glad_glVertexAttrib4Nuiv == wrap_glVertexAttrib4Nuiv) { glad_glVertexAttrib4Nuiv = real_glVertexAttrib4Nuiv; swapped++; }
+        if (glad_glVertexAttrib4Nusv == wrap_glVertexAttrib4Nusv) { glad_glVertexAttrib4Nusv = real_glVertexAttrib4Nusv; swapped++; }
+        if (glad_glVertexAttrib4bv == wrap_glVertexAttrib4bv) { glad_glVertexAttrib4bv = real_glVertexAttrib4bv; swapped++; }
+        if (glad_glVertexAttrib4d == wrap_glVertexAttrib4d) { glad_glVertexAttrib4d = real_glVertexAttrib4d; swapped++; }
+        if (glad_glVertexAttrib4dv == wrap_glVertexAttrib4dv) { glad_glVertexAttrib4dv = real_glVertexAttrib4dv; swapped++; }
+        if (glad_glVertexAttrib4f == wrap_glVertexAttrib4f) { glad_glVertexAttrib4f = real_glVertexAttrib4f; swapped++; }
+        if (glad_glVertexAttrib4fv == wrap_glVertexAttrib4fv) { glad_glVertexAttrib4fv = real_glVertexAttrib4fv; swapped++; }
+        if (glad_glVertexAttrib4iv == wrap_glVertexAttrib4iv) { glad_glVertexAttrib4iv = real_glVertexAttrib4iv; swapped++; }
+        if (glad_glVertexAttrib4s == wrap_glVertexAttrib4s) { glad_glVertexAttrib4s = real_glVertexAttrib4s; swapped++; }
+        if (glad_glVertexAttrib4sv == wrap_glVertexAttrib4sv) { glad_glVertexAttrib4sv = real_glVertexAttrib4sv; swapped++; }
+        if (glad_glVertexAttrib4ubv == wrap_glVertexAttrib4ubv) { glad_glVertexAttrib4ubv = real_glVertexAttrib4ubv; swapped++; }
+        if (glad_glVertexAttrib4uiv == wrap_glVertexAttrib4uiv) { glad_glVertexAttrib4uiv = real_glVertexAttrib4uiv; swapped++; }
+        if (glad_glVertexAttrib4usv == wrap_glVertexAttrib4usv) { glad_glVertexAttrib4usv = real_glVertexAttrib4usv; swapped++; }
+        if (glad_glVertexAttribPointer == wrap_glVertexAttribPointer) { glad_glVertexAttribPointer = real_glVertexAttribPointer; swapped++; }
+        if (glad_glUniformMatrix2x3fv == wrap_glUniformMatrix2x3fv) { glad_glUniformMatrix2x3fv = real_glUniformMatrix2x3fv; swapped++; }
+        if (glad_glUniformMatrix3x2fv == wrap_glUniformMatrix3x2fv) { glad_glUniformMatrix3x2fv = real_glUniformMatrix3x2fv; swapped++; }
+        if (glad_glUniformMatrix2x4fv == wrap_glUniformMatrix2x4fv) { glad_glUniformMatrix2x4fv = real_glUniformMatrix2x4fv; swapped++; }
+        if (glad_glUniformMatrix4x2fv == wrap_glUniformMatrix4x2fv) { glad_glUniformMatrix4x2fv = real_glUniformMatrix4x2fv; swapped++; }
+        if (glad_glUniformMatrix3x4fv == wrap_glUniformMatrix3x4fv) { glad_glUniformMatrix3x4fv = real_glUniformMatrix3x4fv; swapped++; }
+        if (glad_glUniformMatrix4x3fv == wrap_glUniformMatrix4x3fv) { glad_glUniformMatrix4x3fv = real_glUniformMatrix4x3fv; swapped++; }
+        if (glad_glColorMaski == wrap_glColorMaski) { glad_glColorMaski = real_glColorMaski; swapped++; }
+        if (glad_glGetBooleani_v == wrap_glGetBooleani_v) { glad_glGetBooleani_v = real_glGetBooleani_v; swapped++; }
+        if (glad_glGetIntegeri_v == wrap_glGetIntegeri_v) { glad_glGetIntegeri_v = real_glGetIntegeri_v; swapped++; }
+        if (glad_glEnablei == wrap_glEnablei) { glad_glEnablei = real_glEnablei; swapped++; }
+        if (glad_glDisablei == wrap_glDisablei) { glad_glDisablei = real_glDisablei; swapped++; }
+        if (glad_glIsEnabledi == wrap_glIsEnabledi) { glad_glIsEnabledi = real_glIsEnabledi; swapped++; }
+        if (glad_glBeginTransformFeedback == wrap_glBeginTransformFeedback) { glad_glBeginTransformFeedback = real_glBeginTransformFeedback; swapped++; }
+        if (glad_glEndTransformFeedback == wrap_glEndTransformFeedback) { glad_glEndTransformFeedback = real_glEndTransformFeedback; swapped++; }
+        if (glad_glBindBufferRange == wrap_glBindBufferRange) { glad_glBindBufferRange = real_glBindBufferRange; swapped++; }
+        if (glad_glBindBufferBase == wrap_glBindBufferBase) { glad_glBindBufferBase = real_glBindBufferBase; swapped++; }
+        if (glad_glTransformFeedbackVaryings == wrap_glTransformFeedbackVaryings) { glad_glTransformFeedbackVaryings = real_glTransformFeedbackVaryings; swapped++; }
+        if (glad_glGetTransformFeedbackVarying == wrap_glGetTransformFeedbackVarying) { glad_glGetTransformFeedbackVarying = real_glGetTransformFeedbackVarying; swapped++; }
+        if (glad_glClampColor == wrap_glClampColor) { glad_glClampColor = real_glClampColor; swapped++; }
+        if (glad_glBeginConditionalRender == wrap_glBeginConditionalRender) { glad_glBeginConditionalRender = real_glBeginConditionalRender; swapped++; }
+        if (glad_glEndConditionalRender == wrap_glEndConditionalRender) { glad_glEndConditionalRender = real_glEndConditionalRender; swapped++; }
+        if (glad_glVertexAttribIPointer == wrap_glVertexAttribIPointer) { glad_glVertexAttribIPointer = real_glVertexAttribIPointer; swapped++; }
+        if (glad_glGetVertexAttribIiv == wrap_glGetVertexAttribIiv) { glad_glGetVertexAttribIiv = real_glGetVertexAttribIiv; swapped++; }
+        if (glad_glGetVertexAttribIuiv == wrap_glGetVertexAttribIuiv) { glad_glGetVertexAttribIuiv = real_glGetVertexAttribIuiv; swapped++; }
+        if (glad_glVertexAttribI1i == wrap_glVertexAttribI1i) { glad_glVertexAttribI1i = real_glVertexAttribI1i; swapped++; }
+        if (glad_glVertexAttribI2i == wrap_glVertexAttribI2i) { glad_glVertexAttribI2i = real_glVertexAttribI2i; swapped++; }
+        if (glad_glVertexAttribI3i == wrap_glVertexAttribI3i) { glad_glVertexAttribI3i = real_glVertexAttribI3i; swapped++; }
+        if (glad_glVertexAttribI4i == wrap_glVertexAttribI4i) { glad_glVertexAttribI4i = real_glVertexAttribI4i; swapped++; }
+        if (glad_glVertexAttribI1ui == wrap_glVertexAttribI1ui) { glad_glVertexAttribI1ui = real_glVertexAttribI1ui; swapped++; }
+        if (glad_glVertexAttribI2ui == wrap_glVertexAttribI2ui) { glad_glVertexAttribI2ui = real_glVertexAttribI2ui; swapped++; }
+        if (glad_glVertexAttribI3ui == wrap_glVertexAttribI3ui) { glad_glVertexAttribI3ui = real_glVertexAttribI3ui; swapped++; }
+        if (glad_glVertexAttribI4ui == wrap_glVertexAttribI4ui) { glad_glVertexAttribI4ui = real_glVertexAttribI4ui; swapped++; }
+        if (glad_glVertexAttribI1iv == wrap_glVertexAttribI1iv) { glad_glVertexAttribI1iv = real_glVertexAttribI1iv; swapped++; }
+        if (glad_glVertexAttribI2iv == wrap_glVertexAttribI2iv) { glad_glVertexAttribI2iv = real_glVertexAttribI2iv; swapped++; }
+        if (glad_glVertexAttribI3iv == wrap_glVertexAttribI3iv) { glad_glVertexAttribI3iv = real_glVertexAttribI3iv; swapped++; }
+        if (glad_glVertexAttribI4iv == wrap_glVertexAttribI4iv) { glad_glVertexAttribI4iv = real_glVertexAttribI4iv; swapped++; }
+        if (glad_glVertexAttribI1uiv == wrap_glVertexAttribI1uiv) { glad_glVertexAttribI1uiv = real_glVertexAttribI1uiv; swapped++; }
+        if (glad_glVertexAttribI2uiv == wrap_glVertexAttribI2uiv) { glad_glVertexAttribI2uiv = real_glVertexAttribI2uiv; swapped++; }
+        if (glad_glVertexAttribI3uiv == wrap_glVertexAttribI3uiv) { glad_glVertexAttribI3uiv = real_glVertexAttribI3uiv; swapped++; }
+        if (glad_glVertexAttribI4uiv == wrap_glVertexAttribI4uiv) { glad_glVertexAttribI4uiv = real_glVertexAttribI4uiv; swapped++; }
+        if (glad_glVertexAttribI4bv == wrap_glVertexAttribI4bv) { glad_glVertexAttribI4bv = real_glVertexAttribI4bv; swapped++; }
+        if (glad_glVertexAttribI4sv == wrap_glVertexAttribI4sv) { glad_glVertexAttribI4sv = real_glVertexAttribI4sv; swapped++; }
+        if (glad_glVertexAttribI4ubv == wrap_glVertexAttribI4ubv) { glad_glVertexAttribI4ubv = real_glVertexAttribI4ubv; swapped++; }
+        if (glad_glVertexAttribI4usv == wrap_glVertexAttribI4usv) { glad_glVertexAttribI4usv = real_glVertexAttribI4usv; swapped++; }
+        if (glad_glGetUniformuiv == wrap_glGetUniformuiv) { glad_glGetUniformuiv = real_glGetUniformuiv; swapped++; }
+        if (glad_glBindFragDataLocation == wrap_glBindFragDataLocation) { glad_glBindFragDataLocation = real_glBindFragDataLocation; swapped++; }
+        if (glad_glGetFragDataLocation == wrap_glGetFragDataLocation) { glad_glGetFragDataLocation = real_glGetFragDataLocation; swapped++; }
+        if (glad_glUniform1ui == wrap_glUniform1ui) { glad_glUniform1ui = real_glUniform1ui; swapped++; }
+        if (glad_glUniform2ui == wrap_glUniform2ui) { glad_glUniform2ui = real_glUniform2ui; swapped++; }
+        if (glad_glUniform3ui == wrap_glUniform3ui) { glad_glUniform3ui = real_glUniform3ui; swapped++; }
+        if (glad_glUniform4ui == wrap_glUniform4ui) { glad_glUniform4ui = real_glUniform4ui; swapped++; }
+        if (glad_glUniform1uiv == wrap_glUniform1uiv) { glad_glUniform1uiv = real_glUniform1uiv; swapped++; }
+        if (glad_glUniform2uiv == wrap_glUniform2uiv) { glad_glUniform2uiv = real_glUniform2uiv; swapped++; }
+        if (glad_glUniform3uiv == wrap_glUniform3uiv) { glad_glUniform3uiv = real_glUniform3uiv; swapped++; }
+        if (glad_glUniform4uiv == wrap_glUniform4uiv) { glad_glUniform4uiv = real_glUniform4uiv; swapped++; }
+        if (glad_glTexParameterIiv == wrap_glTexParameterIiv) { glad_glTexParameterIiv = real_glTexParameterIiv; swapped++; }
+        if (glad_glTexParameterIuiv == wrap_glTexParameterIuiv) { glad_glTexParameterIuiv = real_glTexParameterIuiv; swapped++; }
+        if (glad_glGetTexParameterIiv == wrap_glGetTexParameterIiv) { glad_glGetTexParameterIiv = real_glGetTexParameterIiv; swapped++; }
+        if (glad_glGetTexParameterIuiv == wrap_glGetTexParameterIuiv) { glad_glGetTexParameterIuiv = real_glGetTexParameterIuiv; swapped++; }
+        if (glad_glClearBufferiv == wrap_glClearBufferiv) { glad_glClearBufferiv = real_glClearBufferiv; swapped++; }
+        if (glad_glClearBufferuiv == wrap_glClearBufferuiv) { glad_glClearBufferuiv = real_glClearBufferuiv; swapped++; }
+        if (glad_glClearBufferfv == wrap_glClearBufferfv) { glad_glClearBufferfv = real_glClearBufferfv; swapped++; }
+        if (glad_glClearBufferfi == wrap_glClearBufferfi) { glad_glClearBufferfi = real_glClearBufferfi; swapped++; }
+        if (glad_glGetStringi == wrap_glGetStringi) { glad_glGetStringi = real_glGetStringi; swapped++; }
+        if (glad_glIsRenderbuffer == wrap_glIsRenderbuffer) { glad_glIsRenderbuffer = real_glIsRenderbuffer; swapped++; }
+        if (glad_glBindRenderbuffer == wrap_glBindRenderbuffer) { glad_glBindRenderbuffer = real_glBindRenderbuffer; swapped++; }
+        if (glad_glDeleteRenderbuffers == wrap_glDeleteRenderbuffers) { glad_glDeleteRenderbuffers = real_glDeleteRenderbuffers; swapped++; }
+        if (glad_glGenRenderbuffers == wrap_glGenRenderbuffers) { glad_glGenRenderbuffers = real_glGenRenderbuffers; swapped++; }
+        if (glad_glRenderbufferStorage == wrap_glRenderbufferStorage) { glad_glRenderbufferStorage = real_glRenderbufferStorage; swapped++; }
+        if (glad_glGetRenderbufferParameteriv == wrap_glGetRenderbufferParameteriv) { glad_glGetRenderbufferParameteriv = real_glGetRenderbufferParameteriv; swapped++; }
+        if (glad_glIsFramebuffer == wrap_glIsFramebuffer) { glad_glIsFramebuffer = real_glIsFramebuffer; swapped++; }
+        if (glad_glBindFramebuffer == wrap_glBindFramebuffer) { glad_glBindFramebuffer = real_glBindFramebuffer; swapped++; }
+        if (glad_glDeleteFramebuffers == wrap_glDeleteFramebuffers) { glad_glDeleteFramebuffers = real_glDeleteFramebuffers; swapped++; }
+        if (glad_glGenFramebuffers == wrap_glGenFramebuffers) { glad_glGenFramebuffers = real_glGenFramebuffers; swapped++; }
+        if (glad_glCheckFramebufferStatus == wrap_glCheckFramebufferStatus) { glad_glCheckFramebufferStatus = real_glCheckFramebufferStatus; swapped++; }
+        if (glad_glFramebufferTexture1D == wrap_glFramebufferTexture1D) { glad_glFramebufferTexture1D = real_glFramebufferTexture1D; swapped++; }
+        if (glad_glFramebufferTexture2D == wrap_glFramebufferTexture2D) { glad_glFramebufferTexture2D = real_glFramebufferTexture2D; swapped++; }
+        if (glad_glFramebufferTexture3D == wrap_glFramebufferTexture3D) { glad_glFramebufferTexture3D = real_glFramebufferTexture3D; swapped++; }
+        if (glad_glFramebufferRenderbuffer == wrap_glFramebufferRenderbuffer) { glad_glFramebufferRenderbuffer = real_glFramebufferRenderbuffer; swapped++; }
+        if (glad_glGetFramebufferAttachmentParameteriv == wrap_glGetFramebufferAttachmentParameteriv) { glad_glGetFramebufferAttachmentParameteriv = real_glGetFramebufferAttachmentParameteriv; swapped++; }
+        if (glad_glGenerateMipmap == wrap_glGenerateMipmap) { glad_glGenerateMipmap = real_glGenerateMipmap; swapped++; }
+        if (glad_glBlitFramebuffer == wrap_glBlitFramebuffer) { glad_glBlitFramebuffer = real_glBlitFramebuffer; swapped++; }
+        if (glad_glRenderbufferStorageMultisample == wrap_glRenderbufferStorageMultisample) { glad_glRenderbufferStorageMultisample = real_glRenderbufferStorageMultisample; swapped++; }
+        if (glad_glFramebufferTextureLayer == wrap_glFramebufferTextureLayer) { glad_glFramebufferTextureLayer = real_glFramebufferTextureLayer; swapped++; }
+        if (glad_glMapBufferRange == wrap_glMapBufferRange) { glad_glMapBufferRange = real_glMapBufferRange; swapped++; }
+        if (glad_glFlushMappedBufferRange == wrap_glFlushMappedBufferRange) { glad_glFlushMappedBufferRange = real_glFlushMappedBufferRange; swapped++; }
+        if (glad_glBindVertexArray == wrap_glBindVertexArray) { glad_glBindVertexArray = real_glBindVertexArray; swapped++; }
+        if (glad_glDeleteVertexArrays == wrap_glDeleteVertexArrays) { glad_glDeleteVertexArrays = real_glDeleteVertexArrays; swapped++; }
+        if (glad_glGenVertexArrays == wrap_glGenVertexArrays) { glad_glGenVertexArrays = real_glGenVertexArrays; swapped++; }
+        if (glad_glIsVertexArray == wrap_glIsVertexArray) { glad_glIsVertexArray = real_glIsVertexArray; swapped++; }
+        if (glad_glDrawArraysInstanced == wrap_glDrawArraysInstanced) { glad_glDrawArraysInstanced = real_glDrawArraysInstanced; swapped++; }
+        if (glad_glDrawElementsInstanced == wrap_glDrawElementsInstanced) { glad_glDrawElementsInstanced = real_glDrawElementsInstanced; swapped++; }
+        if (glad_glTexBuffer == wrap_glTexBuffer) { glad_glTexBuffer = real_glTexBuffer; swapped++; }
+        if (glad_glPrimitiveRestartIndex == wrap_glPrimitiveRestartIndex) { glad_glPrimitiveRestartIndex = real_glPrimitiveRestartIndex; swapped++; }
+        if (glad_glCopyBufferSubData == wrap_glCopyBufferSubData) { glad_glCopyBufferSubData = real_glCopyBufferSubData; swapped++; }
+        if (glad_glGetUniformIndices == wrap_glGetUniformIndices) { glad_glGetUniformIndices = real_glGetUniformIndices; swapped++; }
+        if (glad_glGetActiveUniformsiv == wrap_glGetActiveUniformsiv) { glad_glGetActiveUniformsiv = real_glGetActiveUniformsiv; swapped++; }
+        if (glad_glGetActiveUniformName == wrap_glGetActiveUniformName) { glad_glGetActiveUniformName = real_glGetActiveUniformName; swapped++; }
+        if (glad_glGetUniformBlockIndex == wrap_glGetUniformBlockIndex) { glad_glGetUniformBlockIndex = real_glGetUniformBlockIndex; swapped++; }
+        if (glad_glGetActiveUniformBlockiv == wrap_glGetActiveUniformBlockiv) { glad_glGetActiveUniformBlockiv = real_glGetActiveUniformBlockiv; swapped++; }
+        if (glad_glGetActiveUniformBlockName == wrap_glGetActiveUniformBlockName) { glad_glGetActiveUniformBlockName = real_glGetActiveUniformBlockName; swapped++; }
+        if (glad_glUniformBlockBinding == wrap_glUniformBlockBinding) { glad_glUniformBlockBinding = real_glUniformBlockBinding; swapped++; }
+        if (glad_glDrawElementsBaseVertex == wrap_glDrawElementsBaseVertex) { glad_glDrawElementsBaseVertex = real_glDrawElementsBaseVertex; swapped++; }
+        if (glad_glDrawRangeElementsBaseVertex == wrap_glDrawRangeElementsBaseVertex) { glad_glDrawRangeElementsBaseVertex = real_glDrawRangeElementsBaseVertex; swapped++; }
+        if (glad_glDrawElementsInstancedBaseVertex == wrap_glDrawElementsInstancedBaseVertex) { glad_glDrawElementsInstancedBaseVertex = real_glDrawElementsInstancedBaseVertex; swapped++; }
+        if (glad_glMultiDrawElementsBaseVertex == wrap_glMultiDrawElementsBaseVertex) { glad_glMultiDrawElementsBaseVertex = real_glMultiDrawElementsBaseVertex; swapped++; }
+        if (glad_glProvokingVertex == wrap_glProvokingVertex) { glad_glProvokingVertex = real_glProvokingVertex; swapped++; }
+        if (glad_glFenceSync == wrap_glFenceSync) { glad_glFenceSync = real_glFenceSync; swapped++; }
+        if (glad_glIsSync == wrap_glIsSync) { glad_glIsSync = real_glIsSync; swapped++; }
+        if (glad_glDeleteSync == wrap_glDeleteSync) { glad_glDeleteSync = real_glDeleteSync; swapped++; }
+        if (glad_glClientWaitSync == wrap_glClientWaitSync) { glad_glClientWaitSync = real_glClientWaitSync; swapped++; }
+        if (glad_glWaitSync == wrap_glWaitSync) { glad_glWaitSync = real_glWaitSync; swapped++; }
+        if (glad_glGetInteger64v == wrap_glGetInteger64v) { glad_glGetInteger64v = real_glGetInteger64v; swapped++; }
+        if (glad_glGetSynciv == wrap_glGetSynciv) { glad_glGetSynciv = real_glGetSynciv; swapped++; }
+        if (glad_glGetInteger64i_v == wrap_glGetInteger64i_v) { glad_glGetInteger64i_v = real_glGetInteger64i_v; swapped++; }
+        if (glad_glGetBufferParameteri64v == wrap_glGetBufferParameteri64v) { glad_glGetBufferParameteri64v = real_glGetBufferParameteri64v; swapped++; }
+        if (glad_glFramebufferTexture == wrap_glFramebufferTexture) { glad_glFramebufferTexture = real_glFramebufferTexture; swapped++; }
+        if (glad_glTexImage2DMultisample == wrap_glTexImage2DMultisample) { glad_glTexImage2DMultisample = real_glTexImage2DMultisample; swapped++; }
+        if (glad_glTexImage3DMultisample == wrap_glTexImage3DMultisample) { glad_glTexImage3DMultisample = real_glTexImage3DMultisample; swapped++; }
+        if (glad_glGetMultisamplefv == wrap_glGetMultisamplefv) { glad_glGetMultisamplefv = real_glGetMultisamplefv; swapped++; }
+        if (glad_glSampleMaski == wrap_glSampleMaski) { glad_glSampleMaski = real_glSampleMaski; swapped++; }
+        if (glad_glBindFragDataLocationIndexed == wrap_glBindFragDataLocationIndexed) { glad_glBindFragDataLocationIndexed = real_glBindFragDataLocationIndexed; swapped++; }
+        if (glad_glGetFragDataIndex == wrap_glGetFragDataIndex) { glad_glGetFragDataIndex = real_glGetFragDataIndex; swapped++; }
+        if (glad_glGenSamplers == wrap_glGenSamplers) { glad_glGenSamplers = real_glGenSamplers; swapped++; }
+        if (glad_glDeleteSamplers == wrap_glDeleteSamplers) { glad_glDeleteSamplers = real_glDeleteSamplers; swapped++; }
+        if (glad_glIsSampler == wrap_glIsSampler) { glad_glIsSampler = real_glIsSampler; swapped++; }
+        if (glad_glBindSampler == wrap_glBindSampler) { glad_glBindSampler = real_glBindSampler; swapped++; }
+        if (glad_glSamplerParameteri == wrap_glSamplerParameteri) { glad_glSamplerParameteri = real_glSamplerParameteri; swapped++; }
+        if (glad_glSamplerParameteriv == wrap_glSamplerParameteriv) { glad_glSamplerParameteriv = real_glSamplerParameteriv; swapped++; }
+        if (glad_glSamplerParameterf == wrap_glSamplerParameterf) { glad_glSamplerParameterf = real_glSamplerParameterf; swapped++; }
+        if (glad_glSamplerParameterfv == wrap_glSamplerParameterfv) { glad_glSamplerParameterfv = real_glSamplerParameterfv; swapped++; }
+        if (glad_glSamplerParameterIiv == wrap_glSamplerParameterIiv) { glad_glSamplerParameterIiv = real_glSamplerParameterIiv; swapped++; }
+        if (glad_glSamplerParameterIuiv == wrap_glSamplerParameterIuiv) { glad_glSamplerParameterIuiv = real_glSamplerParameterIuiv; swapped++; }
+        if (glad_glGetSamplerParameteriv == wrap_glGetSamplerParameteriv) { glad_glGetSamplerParameteriv = real_glGetSamplerParameteriv; swapped++; }
+        if (glad_glGetSamplerParameterIiv == wrap_glGetSamplerParameterIiv) { glad_glGetSamplerParameterIiv = real_glGetSamplerParameterIiv; swapped++; }
+        if (glad_glGetSamplerParameterfv == wrap_glGetSamplerParameterfv) { glad_glGetSamplerParameterfv = real_glGetSamplerParameterfv; swapped++; }
+        if (glad_glGetSamplerParameterIuiv == wrap_glGetSamplerParameterIuiv) { glad_glGetSamplerParameterIuiv = real_glGetSamplerParameterIuiv; swapped++; }
+        if (glad_glQueryCounter == wrap_glQueryCounter) { glad_glQueryCounter = real_glQueryCounter; swapped++; }
+        if (glad_glGetQueryObjecti64v == wrap_glGetQueryObjecti64v) { glad_glGetQueryObjecti64v = real_glGetQueryObjecti64v; swapped++; }
+        if (glad_glGetQueryObjectui64v == wrap_glGetQueryObjectui64v) { glad_glGetQueryObjectui64v = real_glGetQueryObjectui64v; swapped++; }
+        if (glad_glVertexAttribDivisor == wrap_glVertexAttribDivisor) { glad_glVertexAttribDivisor = real_glVertexAttribDivisor; swapped++; }
+        if (glad_glVertexAttribP1ui == wrap_glVertexAttribP1ui) { glad_glVertexAttribP1ui = real_glVertexAttribP1ui; swapped++; }
+        if (glad_glVertexAttribP1uiv == wrap_glVertexAttribP1uiv) { glad_glVertexAttribP1uiv = real_glVertexAttribP1uiv; swapped++; }
+        if (glad_glVertexAttribP2ui == wrap_glVertexAttribP2ui) { glad_glVertexAttribP2ui = real_glVertexAttribP2ui; swapped++; }
+        if (glad_glVertexAttribP2uiv == wrap_glVertexAttribP2uiv) { glad_glVertexAttribP2uiv = real_glVertexAttribP2uiv; swapped++; }
+        if (glad_glVertexAttribP3ui == wrap_glVertexAttribP3ui) { glad_glVertexAttribP3ui = real_glVertexAttribP3ui; swapped++; }
+        if (glad_glVertexAttribP3uiv == wrap_glVertexAttribP3uiv) { glad_glVertexAttribP3uiv = real_glVertexAttribP3uiv; swapped++; }
+        if (glad_glVertexAttribP4ui == wrap_glVertexAttribP4ui) { glad_glVertexAttribP4ui = real_glVertexAttribP4ui; swapped++; }
+        if (glad_glVertexAttribP4uiv == wrap_glVertexAttribP4uiv) { glad_glVertexAttribP4uiv = real_glVertexAttribP4uiv; swapped++; }
+        if (glad_glVertexP2ui == wrap_glVertexP2ui) { glad_glVertexP2ui = real_glVertexP2ui; swapped++; }
+        if (glad_glVertexP2uiv == wrap_glVertexP2uiv) { glad_glVertexP2uiv = real_glVertexP2uiv; swapped++; }
+        if (glad_glVertexP3ui == wrap_glVertexP3ui) { glad_glVertexP3ui = real_glVertexP3ui; swapped++; }
+        if (glad_glVertexP3uiv == wrap_glVertexP3uiv) { glad_glVertexP3uiv = real_glVertexP3uiv; swapped++; }
+        if (glad_glVertexP4ui == wrap_glVertexP4ui) { glad_glVertexP4ui = real_glVertexP4ui; swapped++; }
+        if (glad_glVertexP4uiv == wrap_glVertexP4uiv) { glad_glVertexP4uiv = real_glVertexP4uiv; swapped++; }
+        if (glad_glTexCoordP1ui == wrap_glTexCoordP1ui) { glad_glTexCoordP1ui = real_glTexCoordP1ui; swapped++; }
+        if (glad_glTexCoordP1uiv == wrap_glTexCoordP1uiv) { glad_glTexCoordP1uiv = real_glTexCoordP1uiv; swapped++; }
+        if (glad_glTexCoordP2ui == wrap_glTexCoordP2ui) { glad_glTexCoordP2ui = real_glTexCoordP2ui; swapped++; }
+        if (glad_glTexCoordP2uiv == wrap_glTexCoordP2uiv) { glad_glTexCoordP2uiv = real_glTexCoordP2uiv; swapped++; }
+        if (glad_glTexCoordP3ui == wrap_glTexCoordP3ui) { glad_glTexCoordP3ui = real_glTexCoordP3ui; swapped++; }
+        if (glad_glTexCoordP3uiv == wrap_glTexCoordP3uiv) { glad_glTexCoordP3uiv = real_glTexCoordP3uiv; swapped++; }
+        if (glad_glTexCoordP4ui == wrap_glTexCoordP4ui) { glad_glTexCoordP4ui = real_glTexCoordP4ui; swapped++; }
+        if (glad_glTexCoordP4uiv == wrap_glTexCoordP4uiv) { glad_glTexCoordP4uiv = real_glTexCoordP4uiv; swapped++; }
+        if (glad_glMultiTexCoordP1ui == wrap_glMultiTexCoordP1ui) { glad_glMultiTexCoordP1ui = real_glMultiTexCoordP1ui; swapped++; }
+        if (glad_glMultiTexCoordP1uiv == wrap_glMultiTexCoordP1uiv) { glad_glMultiTexCoordP1uiv = real_glMultiTexCoordP1uiv; swapped++; }
+        if (glad_glMultiTexCoordP2ui == wrap_glMultiTexCoordP2ui) { glad_glMultiTexCoordP2ui = real_glMultiTexCoordP2ui; swapped++; }
+        if (glad_glMultiTexCoordP2uiv == wrap_glMultiTexCoordP2uiv) { glad_glMultiTexCoordP2uiv = real_glMultiTexCoordP2uiv; swapped++; }
+        if (glad_glMultiTexCoordP3ui == wrap_glMultiTexCoordP3ui) { glad_glMultiTexCoordP3ui = real_glMultiTexCoordP3ui; swapped++; }
+        if (glad_glMultiTexCoordP3uiv == wrap_glMultiTexCoordP3uiv) { glad_glMultiTexCoordP3uiv = real_glMultiTexCoordP3uiv; swapped++; }
+        if (glad_glMultiTexCoordP4ui == wrap_glMultiTexCoordP4ui) { glad_glMultiTexCoordP4ui = real_glMultiTexCoordP4ui; swapped++; }
+        if (glad_glMultiTexCoordP4uiv == wrap_glMultiTexCoordP4uiv) { glad_glMultiTexCoordP4uiv = real_glMultiTexCoordP4uiv; swapped++; }
+        if (glad_glNormalP3ui == wrap_glNormalP3ui) { glad_glNormalP3ui = real_glNormalP3ui; swapped++; }
+        if (glad_glNormalP3uiv == wrap_glNormalP3uiv) { glad_glNormalP3uiv = real_glNormalP3uiv; swapped++; }
+        if (glad_glColorP3ui == wrap_glColorP3ui) { glad_glColorP3ui = real_glColorP3ui; swapped++; }
+        if (glad_glColorP3uiv == wrap_glColorP3uiv) { glad_glColorP3uiv = real_glColorP3uiv; swapped++; }
+        if (glad_glColorP4ui == wrap_glColorP4ui) { glad_glColorP4ui = real_glColorP4ui; swapped++; }
+        if (glad_glColorP4uiv == wrap_glColorP4uiv) { glad_glColorP4uiv = real_glColorP4uiv; swapped++; }
+        if (glad_glSecondaryColorP3ui == wrap_glSecondaryColorP3ui) { glad_glSecondaryColorP3ui = real_glSecondaryColorP3ui; swapped++; }
+        if (glad_glSecondaryColorP3uiv == wrap_glSecondaryColorP3uiv) { glad_glSecondaryColorP3uiv = real_glSecondaryColorP3uiv; swapped++; }
+        if (glad_glMinSampleShading == wrap_glMinSampleShading) { glad_glMinSampleShading = real_glMinSampleShading; swapped++; }
+        if (glad_glBlendEquationi == wrap_glBlendEquationi) { glad_glBlendEquationi = real_glBlendEquationi; swapped++; }
+        if (glad_glBlendEquationSeparatei == wrap_glBlendEquationSeparatei) { glad_glBlendEquationSeparatei = real_glBlendEquationSeparatei; swapped++; }
+        if (glad_glBlendFunci == wrap_glBlendFunci) { glad_glBlendFunci = real_glBlendFunci; swapped++; }
+        if (glad_glBlendFuncSeparatei == wrap_glBlendFuncSeparatei) { glad_glBlendFuncSeparatei = real_glBlendFuncSeparatei; swapped++; }
+        if (glad_glDrawArraysIndirect == wrap_glDrawArraysIndirect) { glad_glDrawArraysIndirect = real_glDrawArraysIndirect; swapped++; }
+        if (glad_glDrawElementsIndirect == wrap_glDrawElementsIndirect) { glad_glDrawElementsIndirect = real_glDrawElementsIndirect; swapped++; }
+        if (glad_glUniform1d == wrap_glUniform1d) { glad_glUniform1d = real_glUniform1d; swapped++; }
+        if (glad_glUniform2d == wrap_glUniform2d) { glad_glUniform2d = real_glUniform2d; swapped++; }
+        if (glad_glUniform3d == wrap_glUniform3d) { glad_glUniform3d = real_glUniform3d; swapped++; }
+        if (glad_glUniform4d == wrap_glUniform4d) { glad_glUniform4d = real_glUniform4d; swapped++; }
+        if (glad_glUniform1dv == wrap_glUniform1dv) { glad_glUniform1dv = real_glUniform1dv; swapped++; }
+        if (glad_glUniform2dv == wrap_glUniform2dv) { glad_glUniform2dv = real_glUniform2dv; swapped++; }
+        if (glad_glUniform3dv == wrap_glUniform3dv) { glad_glUniform3dv = real_glUniform3dv; swapped++; }
+        if (glad_glUniform4dv == wrap_glUniform4dv) { glad_glUniform4dv = real_glUniform4dv; swapped++; }
+        if (glad_glUniformMatrix2dv == wrap_glUniformMatrix2dv) { glad_glUniformMatrix2dv = real_glUniformMatrix2dv; swapped++; }
+        if (glad_glUniformMatrix3dv == wrap_glUniformMatrix3dv) { glad_glUniformMatrix3dv = real_glUniformMatrix3dv; swapped++; }
+        if (glad_glUniformMatrix4dv == wrap_glUniformMatrix4dv) { glad_glUniformMatrix4dv = real_glUniformMatrix4dv; swapped++; }
+        if (glad_glUniformMatrix2x3dv == wrap_glUniformMatrix2x3dv) { glad_glUniformMatrix2x3dv = real_glUniformMatrix2x3dv; swapped++; }
+        if (glad_glUniformMatrix2x4dv == wrap_glUniformMatrix2x4dv) { glad_glUniformMatrix2x4dv = real_glUniformMatrix2x4dv; swapped++; }
+        if (glad_glUniformMatrix3x2dv == wrap_glUniformMatrix3x2dv) { glad_glUniformMatrix3x2dv = real_glUniformMatrix3x2dv; swapped++; }
+        if (glad_glUniformMatrix3x4dv == wrap_glUniformMatrix3x4dv) { glad_glUniformMatrix3x4dv = real_glUniformMatrix3x4dv; swapped++; }
+        if (glad_glUniformMatrix4x2dv == wrap_glUniformMatrix4x2dv) { glad_glUniformMatrix4x2dv = real_glUniformMatrix4x2dv; swapped++; }
+        if (glad_glUniformMatrix4x3dv == wrap_glUniformMatrix4x3dv) { glad_glUniformMatrix4x3dv = real_glUniformMatrix4x3dv; swapped++; }
+        if (glad_glGetUniformdv == wrap_glGetUniformdv) { glad_glGetUniformdv = real_glGetUniformdv; swapped++; }
+        if (glad_glGetSubroutineUniformLocation == wrap_glGetSubroutineUniformLocation) { glad_glGetSubroutineUniformLocation = real_glGetSubroutineUniformLocation; swapped++; }
+        if (glad_glGetSubroutineIndex == wrap_glGetSubroutineIndex) { glad_glGetSubroutineIndex = real_glGetSubroutineIndex; swapped++; }
+        if (glad_glGetActiveSubroutineUniformiv == wrap_glGetActiveSubroutineUniformiv) { glad_glGetActiveSubroutineUniformiv = real_glGetActiveSubroutineUniformiv; swapped++; }
+        if (glad_glGetActiveSubroutineUniformName == wrap_glGetActiveSubroutineUniformName) { glad_glGetActiveSubroutineUniformName = real_glGetActiveSubroutineUniformName; swapped++; }
+        if (glad_glGetActiveSubroutineName == wrap_glGetActiveSubroutineName) { glad_glGetActiveSubroutineName = real_glGetActiveSubroutineName; swapped++; }
+        if (glad_glUniformSubroutinesuiv == wrap_glUniformSubroutinesuiv) { glad_glUniformSubroutinesuiv = real_glUniformSubroutinesuiv; swapped++; }
+        if (glad_glGetUniformSubroutineuiv == wrap_glGetUniformSubroutineuiv) { glad_glGetUniformSubroutineuiv = real_glGetUniformSubroutineuiv; swapped++; }
+        if (glad_glGetProgramStageiv == wrap_glGetProgramStageiv) { glad_glGetProgramStageiv = real_glGetProgramStageiv; swapped++; }
+        if (glad_glPatchParameteri == wrap_glPatchParameteri) { glad_glPatchParameteri = real_glPatchParameteri; swapped++; }
+        if (glad_glPatchParameterfv == wrap_glPatchParameterfv) { glad_glPatchParameterfv = real_glPatchParameterfv; swapped++; }
+        if (glad_glBindTransformFeedback == wrap_glBindTransformFeedback) { glad_glBindTransformFeedback = real_glBindTransformFeedback; swapped++; }
+        if (glad_glDeleteTransformFeedbacks == wrap_glDeleteTransformFeedbacks) { glad_glDeleteTransformFeedbacks = real_glDeleteTransformFeedbacks; swapped++; }
+        if (glad_glGenTransformFeedbacks == wrap_glGenTransformFeedbacks) { glad_glGenTransformFeedbacks = real_glGenTransformFeedbacks; swapped++; }
+        if (glad_glIsTransformFeedback == wrap_glIsTransformFeedback) { glad_glIsTransformFeedback = real_glIsTransformFeedback; swapped++; }
+        if (glad_glPauseTransformFeedback == wrap_glPauseTransformFeedback) { glad_glPauseTransformFeedback = real_glPauseTransformFeedback; swapped++; }
+        if (glad_glResumeTransformFeedback == wrap_glResumeTransformFeedback) { glad_glResumeTransformFeedback = real_glResumeTransformFeedback; swapped++; }
+        if (glad_glDrawTransformFeedback == wrap_glDrawTransformFeedback) { glad_glDrawTransformFeedback = real_glDrawTransformFeedback; swapped++; }
+        if (glad_glDrawTransformFeedbackStream == wrap_glDrawTransformFeedbackStream) { glad_glDrawTransformFeedbackStream = real_glDrawTransformFeedbackStream; swapped++; }
+        if (glad_glBeginQueryIndexed == wrap_glBeginQueryIndexed) { glad_glBeginQueryIndexed = real_glBeginQueryIndexed; swapped++; }
+        if (glad_glEndQueryIndexed == wrap_glEndQueryIndexed) { glad_glEndQueryIndexed = real_glEndQueryIndexed; swapped++; }
+        if (glad_glGetQueryIndexediv == wrap_glGetQueryIndexediv) { glad_glGetQueryIndexediv = real_glGetQueryIndexediv; swapped++; }
+        if (glad_glReleaseShaderCompiler == wrap_glReleaseShaderCompiler) { glad_glReleaseShaderCompiler = real_glReleaseShaderCompiler; swapped++; }
+        if (glad_glShaderBinary == wrap_glShaderBinary) { glad_glShaderBinary = real_glShaderBinary; swapped++; }
+        if (glad_glGetShaderPrecisionFormat == wrap_glGetShaderPrecisionFormat) { glad_glGetShaderPrecisionFormat = real_glGetShaderPrecisionFormat; swapped++; }
+        if (glad_glDepthRangef == wrap_glDepthRangef) { glad_glDepthRangef = real_glDepthRangef; swapped++; }
+        if (glad_glClearDepthf == wrap_glClearDepthf) { glad_glClearDepthf = real_glClearDepthf; swapped++; }
+        if (glad_glGetProgramBinary == wrap_glGetProgramBinary) { glad_glGetProgramBinary = real_glGetProgramBinary; swapped++; }
+        if (glad_glProgramBinary == wrap_glProgramBinary) { glad_glProgramBinary = real_glProgramBinary; swapped++; }
+        if (glad_glProgramParameteri == wrap_glProgramParameteri) { glad_glProgramParameteri = real_glProgramParameteri; swapped++; }
+        if (glad_glUseProgramStages == wrap_glUseProgramStages) { glad_glUseProgramStages = real_glUseProgramStages; swapped++; }
+        if (glad_glActiveShaderProgram == wrap_glActiveShaderProgram) { glad_glActiveShaderProgram = real_glActiveShaderProgram; swapped++; }
+        if (glad_glCreateShaderProgramv == wrap_glCreateShaderProgramv) { glad_glCreateShaderProgramv = real_glCreateShaderProgramv; swapped++; }
+        if (glad_glBindProgramPipeline == wrap_glBindProgramPipeline) { glad_glBindProgramPipeline = real_glBindProgramPipeline; swapped++; }
+        if (glad_glDeleteProgramPipelines == wrap_glDeleteProgramPipelines) { glad_glDeleteProgramPipelines = real_glDeleteProgramPipelines; swapped++; }
+        if (glad_glGenProgramPipelines == wrap_glGenProgramPipelines) { glad_glGenProgramPipelines = real_glGenProgramPipelines; swapped++; }
+        if (glad_glIsProgramPipeline == wrap_glIsProgramPipeline) { glad_glIsProgramPipeline = real_glIsProgramPipeline; swapped++; }
+        if (glad_glGetProgramPipelineiv == wrap_glGetProgramPipelineiv) { glad_glGetProgramPipelineiv = real_glGetProgramPipelineiv; swapped++; }
+        if (glad_glProgramUniform1i == wrap_glProgramUniform1i) { glad_glProgramUniform1i = real_glProgramUniform1i; swapped++; }
+        if (glad_glProgramUniform1iv == wrap_glProgramUniform1iv) { glad_glProgramUniform1iv = real_glProgramUniform1iv; swapped++; }
+        if (glad_glProgramUniform1f == wrap_glProgramUniform1f) { glad_glProgramUniform1f = real_glProgramUniform1f; swapped++; }
+        if (glad_glProgramUniform1fv == wrap_glProgramUniform1fv) { glad_glProgramUniform1fv = real_glProgramUniform1fv; swapped++; }
+        if (glad_glProgramUniform1d == wrap_glProgramUniform1d) { glad_glProgramUniform1d = real_glProgramUniform1d; swapped++; }
+        if (glad_glProgramUniform1dv == wrap_glProgramUniform1dv) { glad_glProgramUniform1dv = real_glProgramUniform1dv; swapped++; }
+        if (glad_glProgramUniform1ui == wrap_glProgramUniform1ui) { glad_glProgramUniform1ui = real_glProgramUniform1ui; swapped++; }
+        if (glad_glProgramUniform1uiv == wrap_glProgramUniform1uiv) { glad_glProgramUniform1uiv = real_glProgramUniform1uiv; swapped++; }
+        if (glad_glProgramUniform2i == wrap_glProgramUniform2i) { glad_glProgramUniform2i = real_glProgramUniform2i; swapped++; }
+        if (glad_glProgramUniform2iv == wrap_glProgramUniform2iv) { glad_glProgramUniform2iv = real_glProgramUniform2iv; swapped++; }
+        if (glad_glProgramUniform2f == wrap_glProgramUniform2f) { glad_glProgramUniform2f = real_glProgramUniform2f; swapped++; }
+        if (glad_glProgramUniform2fv == wrap_glProgramUniform2fv) { glad_glProgramUniform2fv = real_glProgramUniform2fv; swapped++; }
+        if (glad_glProgramUniform2d == wrap_glProgramUniform2d) { glad_glProgramUniform2d = real_glProgramUniform2d; swapped++; }
+        if (glad_glProgramUniform2dv == wrap_glProgramUniform2dv) { glad_glProgramUniform2dv = real_glProgramUniform2dv; swapped++; }
+        if (glad_glProgramUniform2ui == wrap_glProgramUniform2ui) { glad_glProgramUniform2ui = real_glProgramUniform2ui; swapped++; }
+        if (glad_glProgramUniform2uiv == wrap_glProgramUniform2uiv) { glad_glProgramUniform2uiv = real_glProgramUniform2uiv; swapped++; }
+        if (glad_glProgramUniform3i == wrap_glProgramUniform3i) { glad_glProgramUniform3i = real_glProgramUniform3i; swapped++; }
+        if (glad_glProgramUniform3iv == wrap_glProgramUniform3iv) { glad_glProgramUniform3iv = real_glProgramUniform3iv; swapped++; }
+        if (glad_glProgramUniform3f == wrap_glProgramUniform3f) { glad_glProgramUniform3f = real_glProgramUniform3f; swapped++; }
+        if (glad_glProgramUniform3fv == wrap_glProgramUniform3fv) { glad_glProgramUniform3fv = real_glProgramUniform3fv; swapped++; }
+        if (glad_glProgramUniform3d == wrap_glProgramUniform3d) { glad_glProgramUniform3d = real_glProgramUniform3d; swapped++; }
+        if (glad_glProgramUniform3dv == wrap_glProgramUniform3dv) { glad_glProgramUniform3dv = real_glProgramUniform3dv; swapped++; }
+        if (glad_glProgramUniform3ui == wrap_glProgramUniform3ui) { glad_glProgramUniform3ui = real_glProgramUniform3ui; swapped++; }
+        if (glad_glProgramUniform3uiv == wrap_glProgramUniform3uiv) { glad_glProgramUniform3uiv = real_glProgramUniform3uiv; swapped++; }
+        if (glad_glProgramUniform4i == wrap_glProgramUniform4i) { glad_glProgramUniform4i = real_glProgramUniform4i; swapped++; }
+        if (glad_glProgramUniform4iv == wrap_glProgramUniform4iv) { glad_glProgramUniform4iv = real_glProgramUniform4iv; swapped++; }
+        if (glad_glProgramUniform4f == wrap_glProgramUniform4f) { glad_glProgramUniform4f = real_glProgramUniform4f; swapped++; }
+        if (glad_glProgramUniform4fv == wrap_glProgramUniform4fv) { glad_glProgramUniform4fv = real_glProgramUniform4fv; swapped++; }
+        if (glad_glProgramUniform4d == wrap_glProgramUniform4d) { glad_glProgramUniform4d = real_glProgramUniform4d; swapped++; }
+        if (glad_glProgramUniform4dv == wrap_glProgramUniform4dv) { glad_glProgramUniform4dv = real_glProgramUniform4dv; swapped++; }
+        if (glad_glProgramUniform4ui == wrap_glProgramUniform4ui) { glad_glProgramUniform4ui = real_glProgramUniform4ui; swapped++; }
+        if (glad_glProgramUniform4uiv == wrap_glProgramUniform4uiv) { glad_glProgramUniform4uiv = real_glProgramUniform4uiv; swapped++; }
+        if (glad_glProgramUniformMatrix2fv == wrap_glProgramUniformMatrix2fv) { glad_glProgramUniformMatrix2fv = real_glProgramUniformMatrix2fv; swapped++; }
+        if (glad_glProgramUniformMatrix3fv == wrap_glProgramUniformMatrix3fv) { glad_glProgramUniformMatrix3fv = real_glProgramUniformMatrix3fv; swapped++; }
+        if (glad_glProgramUniformMatrix4fv == wrap_glProgramUniformMatrix4fv) { glad_glProgramUniformMatrix4fv = real_glProgramUniformMatrix4fv; swapped++; }
+        if (glad_glProgramUniformMatrix2dv == wrap_glProgramUniformMatrix2dv) { glad_glProgramUniformMatrix2dv = real_glProgramUniformMatrix2dv; swapped++; }
+        if (glad_glProgramUniformMatrix3dv == wrap_glProgramUniformMatrix3dv) { glad_glProgramUniformMatrix3dv = real_glProgramUniformMatrix3dv; swapped++; }
+        if (glad_glProgramUniformMatrix4dv == wrap_glProgramUniformMatrix4dv) { glad_glProgramUniformMatrix4dv = real_glProgramUniformMatrix4dv; swapped++; }
+        if (glad_glProgramUniformMatrix2x3fv == wrap_glProgramUniformMatrix2x3fv) { glad_glProgramUniformMatrix2x3fv = real_glProgramUniformMatrix2x3fv; swapped++; }
+        if (glad_glProgramUniformMatrix3x2fv == wrap_glProgramUniformMatrix3x2fv) { glad_glProgramUniformMatrix3x2fv = real_glProgramUniformMatrix3x2fv; swapped++; }
+        if (glad_glProgramUniformMatrix2x4fv == wrap_glProgramUniformMatrix2x4fv) { glad_glProgramUniformMatrix2x4fv = real_glProgramUniformMatrix2x4fv; swapped++; }
+        if (glad_glProgramUniformMatrix4x2fv == wrap_glProgramUniformMatrix4x2fv) { glad_glProgramUniformMatrix4x2fv = real_glProgramUniformMatrix4x2fv; swapped++; }
+        if (glad_glProgramUniformMatrix3x4fv == wrap_glProgramUniformMatrix3x4fv) { glad_glProgramUniformMatrix3x4fv = real_glProgramUniformMatrix3x4fv; swapped++; }
+        if (glad_glProgramUniformMatrix4x3fv == wrap_glProgramUniformMatrix4x3fv) { glad_glProgramUniformMatrix4x3fv = real_glProgramUniformMatrix4x3fv; swapped++; }
+        if (glad_glProgramUniformMatrix2x3dv == wrap_glProgramUniformMatrix2x3dv) { glad_glProgramUniformMatrix2x3dv = real_glProgramUniformMatrix2x3dv; swapped++; }
+        if (glad_glProgramUniformMatrix3x2dv == wrap_glProgramUniformMatrix3x2dv) { glad_glProgramUniformMatrix3x2dv = real_glProgramUniformMatrix3x2dv; swapped++; }
+        if (glad_glProgramUniformMatrix2x4dv == wrap_glProgramUniformMatrix2x4dv) { glad_glProgramUniformMatrix2x4dv = real_glProgramUniformMatrix2x4dv; swapped++; }
+        if (glad_glProgramUniformMatrix4x2dv == wrap_glProgramUniformMatrix4x2dv) { glad_glProgramUniformMatrix4x2dv = real_glProgramUniformMatrix4x2dv; swapped++; }
+        if (glad_glProgramUniformMatrix3x4dv == wrap_glProgramUniformMatrix3x4dv) { glad_glProgramUniformMatrix3x4dv = real_glProgramUniformMatrix3x4dv; swapped++; }
+        if (glad_glProgramUniformMatrix4x3dv == wrap_glProgramUniformMatrix4x3dv) { glad_glProgramUniformMatrix4x3dv = real_glProgramUniformMatrix4x3dv; swapped++; }
+        if (glad_glValidateProgramPipeline == wrap_glValidateProgramPipeline) { glad_glValidateProgramPipeline = real_glValidateProgramPipeline; swapped++; }
+        if (glad_glGetProgramPipelineInfoLog == wrap_glGetProgramPipelineInfoLog) { glad_glGetProgramPipelineInfoLog = real_glGetProgramPipelineInfoLog; swapped++; }
+        if (glad_glVertexAttribL1d == wrap_glVertexAttribL1d) { glad_glVertexAttribL1d = real_glVertexAttribL1d; swapped++; }
+        if (glad_glVertexAttribL2d == wrap_glVertexAttribL2d) { glad_glVertexAttribL2d = real_glVertexAttribL2d; swapped++; }
+        if (glad_glVertexAttribL3d == wrap_glVertexAttribL3d) { glad_glVertexAttribL3d = real_glVertexAttribL3d; swapped++; }
+        if (glad_glVertexAttribL4d == wrap_glVertexAttribL4d) { glad_glVertexAttribL4d = real_glVertexAttribL4d; swapped++; }
+        if (glad_glVertexAttribL1dv == wrap_glVertexAttribL1dv) { glad_glVertexAttribL1dv = real_glVertexAttribL1dv; swapped++; }
+        if (glad_glVertexAttribL2dv == wrap_glVertexAttribL2dv) { glad_glVertexAttribL2dv = real_glVertexAttribL2dv; swapped++; }
+        if (glad_glVertexAttribL3dv == wrap_glVertexAttribL3dv) { glad_glVertexAttribL3dv = real_glVertexAttribL3dv; swapped++; }
+        if (glad_glVertexAttribL4dv == wrap_glVertexAttribL4dv) { glad_glVertexAttribL4dv = real_glVertexAttribL4dv; swapped++; }
+        if (glad_glVertexAttribLPointer == wrap_glVertexAttribLPointer) { glad_glVertexAttribLPointer = real_glVertexAttribLPointer; swapped++; }
+        if (glad_glGetVertexAttribLdv == wrap_glGetVertexAttribLdv) { glad_glGetVertexAttribLdv = real_glGetVertexAttribLdv; swapped++; }
+        if (glad_glViewportArrayv == wrap_glViewportArrayv) { glad_glViewportArrayv = real_glViewportArrayv; swapped++; }
+        if (glad_glViewportIndexedf == wrap_glViewportIndexedf) { glad_glViewportIndexedf = real_glViewportIndexedf; swapped++; }
+        if (glad_glViewportIndexedfv == wrap_glViewportIndexedfv) { glad_glViewportIndexedfv = real_glViewportIndexedfv; swapped++; }
+        if (glad_glScissorArrayv == wrap_glScissorArrayv) { glad_glScissorArrayv = real_glScissorArrayv; swapped++; }
+        if (glad_glScissorIndexed == wrap_glScissorIndexed) { glad_glScissorIndexed = real_glScissorIndexed; swapped++; }
+        if (glad_glScissorIndexedv == wrap_glScissorIndexedv) { glad_glScissorIndexedv = real_glScissorIndexedv; swapped++; }
+        if (glad_glDepthRangeArrayv == wrap_glDepthRangeArrayv) { glad_glDepthRangeArrayv = real_glDepthRangeArrayv; swapped++; }
+        if (glad_glDepthRangeIndexed == wrap_glDepthRangeIndexed) { glad_glDepthRangeIndexed = real_glDepthRangeIndexed; swapped++; }
+        if (glad_glGetFloati_v == wrap_glGetFloati_v) { glad_glGetFloati_v = real_glGetFloati_v; swapped++; }
+        if (glad_glGetDoublei_v == wrap_glGetDoublei_v) { glad_glGetDoublei_v = real_glGetDoublei_v; swapped++; }
+        if (glad_glDrawArraysInstancedBaseInstance == wrap_glDrawArraysInstancedBaseInstance) { glad_glDrawArraysInstancedBaseInstance = real_glDrawArraysInstancedBaseInstance; swapped++; }
+        if (glad_glDrawElementsInstancedBaseInstance == wrap_glDrawElementsInstancedBaseInstance) { glad_glDrawElementsInstancedBaseInstance = real_glDrawElementsInstancedBaseInstance; swapped++; }
+        if (glad_glDrawElementsInstancedBaseVertexBaseInstance == wrap_glDrawElementsInstancedBaseVertexBaseInstance) { glad_glDrawElementsInstancedBaseVertexBaseInstance = real_glDrawElementsInstancedBaseVertexBaseInstance; swapped++; }
+        if (glad_glGetInternalformativ == wrap_glGetInternalformativ) { glad_glGetInternalformativ = real_glGetInternalformativ; swapped++; }
+        if (glad_glGetActiveAtomicCounterBufferiv == wrap_glGetActiveAtomicCounterBufferiv) { glad_glGetActiveAtomicCounterBufferiv = real_glGetActiveAtomicCounterBufferiv; swapped++; }
+        if (glad_glBindImageTexture == wrap_glBindImageTexture) { glad_glBindImageTexture = real_glBindImageTexture; swapped++; }
+        if (glad_glMemoryBarrier == wrap_glMemoryBarrier) { glad_glMemoryBarrier = real_glMemoryBarrier; swapped++; }
+        if (glad_glTexStorage1D == wrap_glTexStorage1D) { glad_glTexStorage1D = real_glTexStorage1D; swapped++; }
+        if (glad_glTexStorage2D == wrap_glTexStorage2D) { glad_glTexStorage2D = real_glTexStorage2D; swapped++; }
+        if (glad_glTexStorage3D == wrap_glTexStorage3D) { glad_glTexStorage3D = real_glTexStorage3D; swapped++; }
+        if (glad_glDrawTransformFeedbackInstanced == wrap_glDrawTransformFeedbackInstanced) { glad_glDrawTransformFeedbackInstanced = real_glDrawTransformFeedbackInstanced; swapped++; }
+        if (glad_glDrawTransformFeedbackStreamInstanced == wrap_glDrawTransformFeedbackStreamInstanced) { glad_glDrawTransformFeedbackStreamInstanced = real_glDrawTransformFeedbackStreamInstanced; swapped++; }
+        if (glad_glClearBufferData == wrap_glClearBufferData) { glad_glClearBufferData = real_glClearBufferData; swapped++; }
+        if (glad_glClearBufferSubData == wrap_glClearBufferSubData) { glad_glClearBufferSubData = real_glClearBufferSubData; swapped++; }
+        if (glad_glDispatchCompute == wrap_glDispatchCompute) { glad_glDispatchCompute = real_glDispatchCompute; swapped++; }
+        if (glad_glDispatchComputeIndirect == wrap_glDispatchComputeIndirect) { glad_glDispatchComputeIndirect = real_glDispatchComputeIndirect; swapped++; }
+        if (glad_glCopyImageSubData == wrap_glCopyImageSubData) { glad_glCopyImageSubData = real_glCopyImageSubData; swapped++; }
+        if (glad_glFramebufferParameteri == wrap_glFramebufferParameteri) { glad_glFramebufferParameteri = real_glFramebufferParameteri; swapped++; }
+        if (glad_glGetFramebufferParameteriv == wrap_glGetFramebufferParameteriv) { glad_glGetFramebufferParameteriv = real_glGetFramebufferParameteriv; swapped++; }
+        if (glad_glGetInternalformati64v == wrap_glGetInternalformati64v) { glad_glGetInternalformati64v = real_glGetInternalformati64v; swapped++; }
+        if (glad_glInvalidateTexSubImage == wrap_glInvalidateTexSubImage) { glad_glInvalidateTexSubImage = real_glInvalidateTexSubImage; swapped++; }
+        if (glad_glInvalidateTexImage == wrap_glInvalidateTexImage) { glad_glInvalidateTexImage = real_glInvalidateTexImage; swapped++; }
+        if (glad_glInvalidateBufferSubData == wrap_glInvalidateBufferSubData) { glad_glInvalidateBufferSubData = real_glInvalidateBufferSubData; swapped++; }
+        if (glad_glInvalidateBufferData == wrap_glInvalidateBufferData) { glad_glInvalidateBufferData = real_glInvalidateBufferData; swapped++; }
+        if (glad_glInvalidateFramebuffer == wrap_glInvalidateFramebuffer) { glad_glInvalidateFramebuffer = real_glInvalidateFramebuffer; swapped++; }
+        if (glad_glInvalidateSubFramebuffer == wrap_glInvalidateSubFramebuffer) { glad_glInvalidateSubFramebuffer = real_glInvalidateSubFramebuffer; swapped++; }
+        if (glad_glMultiDrawArraysIndirect == wrap_glMultiDrawArraysIndirect) { glad_glMultiDrawArraysIndirect = real_glMultiDrawArraysIndirect; swapped++; }
+        if (glad_glMultiDrawElementsIndirect == wrap_glMultiDrawElementsIndirect) { glad_glMultiDrawElementsIndirect = real_glMultiDrawElementsIndirect; swapped++; }
+        if (glad_glGetProgramInterfaceiv == wrap_glGetProgramInterfaceiv) { glad_glGetProgramInterfaceiv = real_glGetProgramInterfaceiv; swapped++; }
+        if (glad_glGetProgramResourceIndex == wrap_glGetProgramResourceIndex) { glad_glGetProgramResourceIndex = real_glGetProgramResourceIndex; swapped++; }
+        if (glad_glGetProgramResourceName == wrap_glGetProgramResourceName) { glad_glGetProgramResourceName = real_glGetProgramResourceName; swapped++; }
+        if (glad_glGetProgramResourceiv == wrap_glGetProgramResourceiv) { glad_glGetProgramResourceiv = real_glGetProgramResourceiv; swapped++; }
+        if (glad_glGetProgramResourceLocation == wrap_glGetProgramResourceLocation) { glad_glGetProgramResourceLocation = real_glGetProgramResourceLocation; swapped++; }
+        if (glad_glGetProgramResourceLocationIndex == wrap_glGetProgramResourceLocationIndex) { glad_glGetProgramResourceLocationIndex = real_glGetProgramResourceLocationIndex; swapped++; }
+        if (glad_glShaderStorageBlockBinding == wrap_glShaderStorageBlockBinding) { glad_glShaderStorageBlockBinding = real_glShaderStorageBlockBinding; swapped++; }
+        if (glad_glTexBufferRange == wrap_glTexBufferRange) { glad_glTexBufferRange = real_glTexBufferRange; swapped++; }
+        if (glad_glTexStorage2DMultisample == wrap_glTexStorage2DMultisample) { glad_glTexStorage2DMultisample = real_glTexStorage2DMultisample; swapped++; }
+        if (glad_glTexStorage3DMultisample == wrap_glTexStorage3DMultisample) { glad_glTexStorage3DMultisample = real_glTexStorage3DMultisample; swapped++; }
+        if (glad_glTextureView == wrap_glTextureView) { glad_glTextureView = real_glTextureView; swapped++; }
+        if (glad_glBindVertexBuffer == wrap_glBindVertexBuffer) { glad_glBindVertexBuffer = real_glBindVertexBuffer; swapped++; }
+        if (glad_glVertexAttribFormat == wrap_glVertexAttribFormat) { glad_glVertexAttribFormat = real_glVertexAttribFormat; swapped++; }
+        if (glad_glVertexAttribIFormat == wrap_glVertexAttribIFormat) { glad_glVertexAttribIFormat = real_glVertexAttribIFormat; swapped++; }
+        if (glad_glVertexAttribLFormat == wrap_glVertexAttribLFormat) { glad_glVertexAttribLFormat = real_glVertexAttribLFormat; swapped++; }
+        if (glad_glVertexAttribBinding == wrap_glVertexAttribBinding) { glad_glVertexAttribBinding = real_glVertexAttribBinding; swapped++; }
+        if (glad_glVertexBindingDivisor == wrap_glVertexBindingDivisor) { glad_glVertexBindingDivisor = real_glVertexBindingDivisor; swapped++; }
+        if (glad_glDebugMessageControl == wrap_glDebugMessageControl) { glad_glDebugMessageControl = real_glDebugMessageControl; swapped++; }
+        if (glad_glDebugMessageInsert == wrap_glDebugMessageInsert) { glad_glDebugMessageInsert = real_glDebugMessageInsert; swapped++; }
+        if (glad_glDebugMessageCallback == wrap_glDebugMessageCallback) { glad_glDebugMessageCallback = real_glDebugMessageCallback; swapped++; }
+        if (glad_glGetDebugMessageLog == wrap_glGetDebugMessageLog) { glad_glGetDebugMessageLog = real_glGetDebugMessageLog; swapped++; }
+        if (glad_glPushDebugGroup == wrap_glPushDebugGroup) { glad_glPushDebugGroup = real_glPushDebugGroup; swapped++; }
+        if (glad_glPopDebugGroup == wrap_glPopDebugGroup) { glad_glPopDebugGroup = real_glPopDebugGroup; swapped++; }
+        if (glad_glObjectLabel == wrap_glObjectLabel) { glad_glObjectLabel = real_glObjectLabel; swapped++; }
+        if (glad_glGetObjectLabel == wrap_glGetObjectLabel) { glad_glGetObjectLabel = real_glGetObjectLabel; swapped++; }
+        if (glad_glObjectPtrLabel == wrap_glObjectPtrLabel) { glad_glObjectPtrLabel = real_glObjectPtrLabel; swapped++; }
+        if (glad_glGetObjectPtrLabel == wrap_glGetObjectPtrLabel) { glad_glGetObjectPtrLabel = real_glGetObjectPtrLabel; swapped++; }
+        if (glad_glBufferStorage == wrap_glBufferStorage) { glad_glBufferStorage = real_glBufferStorage; swapped++; }
+        if (glad_glClearTexImage == wrap_glClearTexImage) { glad_glClearTexImage = real_glClearTexImage; swapped++; }
+        if (glad_glClearTexSubImage == wrap_glClearTexSubImage) { glad_glClearTexSubImage = real_glClearTexSubImage; swapped++; }
+        if (glad_glBindBuffersBase == wrap_glBindBuffersBase) { glad_glBindBuffersBase = real_glBindBuffersBase; swapped++; }
+        if (glad_glBindBuffersRange == wrap_glBindBuffersRange) { glad_glBindBuffersRange = real_glBindBuffersRange; swapped++; }
+        if (glad_glBindTextures == wrap_glBindTextures) { glad_glBindTextures = real_glBindTextures; swapped++; }
+        if (glad_glBindSamplers == wrap_glBindSamplers) { glad_glBindSamplers = real_glBindSamplers; swapped++; }
+        if (glad_glBindImageTextures == wrap_glBindImageTextures) { glad_glBindImageTextures = real_glBindImageTextures; swapped++; }
+        if (glad_glBindVertexBuffers == wrap_glBindVertexBuffers) { glad_glBindVertexBuffers = real_glBindVertexBuffers; swapped++; }
+        if (glad_glClipControl == wrap_glClipControl) { glad_glClipControl = real_glClipControl; swapped++; }
+        if (glad_glCreateTransformFeedbacks == wrap_glCreateTransformFeedbacks) { glad_glCreateTransformFeedbacks = real_glCreateTransformFeedbacks; swapped++; }
+        if (glad_glTransformFeedbackBufferBase == wrap_glTransformFeedbackBufferBase) { glad_glTransformFeedbackBufferBase = real_glTransformFeedbackBufferBase; swapped++; }
+        if (glad_glTransformFeedbackBufferRange == wrap_glTransformFeedbackBufferRange) { glad_glTransformFeedbackBufferRange = real_glTransformFeedbackBufferRange; swapped++; }
+        if (glad_glGetTransformFeedbackiv == wrap_glGetTransformFeedbackiv) { glad_glGetTransformFeedbackiv = real_glGetTransformFeedbackiv; swapped++; }
+        if (glad_glGetTransformFeedbacki_v == wrap_glGetTransformFeedbacki_v) { glad_glGetTransformFeedbacki_v = real_glGetTransformFeedbacki_v; swapped++; }
+        if (glad_glGetTransformFeedbacki64_v == wrap_glGetTransformFeedbacki64_v) { glad_glGetTransformFeedbacki64_v = real_glGetTransformFeedbacki64_v; swapped++; }
+        if (glad_glCreateBuffers == wrap_glCreateBuffers) { glad_glCreateBuffers = real_glCreateBuffers; swapped++; }
+        if (glad_glNamedBufferStorage == wrap_glNamedBufferStorage) { glad_glNamedBufferStorage = real_glNamedBufferStorage; swapped++; }
+        if (glad_glNamedBufferData == wrap_glNamedBufferData) { glad_glNamedBufferData = real_glNamedBufferData; swapped++; }
+        if (glad_glNamedBufferSubData == wrap_glNamedBufferSubData) { glad_glNamedBufferSubData = real_glNamedBufferSubData; swapped++; }
+        if (glad_glCopyNamedBufferSubData == wrap_glCopyNamedBufferSubData) { glad_glCopyNamedBufferSubData = real_glCopyNamedBufferSubData; swapped++; }
+        if (glad_glClearNamedBufferData == wrap_glClearNamedBufferData) { glad_glClearNamedBufferData = real_glClearNamedBufferData; swapped++; }
+        if (glad_glClearNamedBufferSubData == wrap_glClearNamedBufferSubData) { glad_glClearNamedBufferSubData = real_glClearNamedBufferSubData; swapped++; }
+        if (glad_glMapNamedBuffer == wrap_glMapNamedBuffer) { glad_glMapNamedBuffer = real_glMapNamedBuffer; swapped++; }
+        if (glad_glMapNamedBufferRange == wrap_glMapNamedBufferRange) { glad_glMapNamedBufferRange = real_glMapNamedBufferRange; swapped++; }
+        if (glad_glUnmapNamedBuffer == wrap_glUnmapNamedBuffer) { glad_glUnmapNamedBuffer = real_glUnmapNamedBuffer; swapped++; }
+        if (glad_glFlushMappedNamedBufferRange == wrap_glFlushMappedNamedBufferRange) { glad_glFlushMappedNamedBufferRange = real_glFlushMappedNamedBufferRange; swapped++; }
+        if (glad_glGetNamedBufferParameteriv == wrap_glGetNamedBufferParameteriv) { glad_glGetNamedBufferParameteriv = real_glGetNamedBufferParameteriv; swapped++; }
+        if (glad_glGetNamedBufferParameteri64v == wrap_glGetNamedBufferParameteri64v) { glad_glGetNamedBufferParameteri64v = real_glGetNamedBufferParameteri64v; swapped++; }
+        if (glad_glGetNamedBufferPointerv == wrap_glGetNamedBufferPointerv) { glad_glGetNamedBufferPointerv = real_glGetNamedBufferPointerv; swapped++; }
+        if (glad_glGetNamedBufferSubData == wrap_glGetNamedBufferSubData) { glad_glGetNamedBufferSubData = real_glGetNamedBufferSubData; swapped++; }
+        if (glad_glCreateFramebuffers == wrap_glCreateFramebuffers) { glad_glCreateFramebuffers = real_glCreateFramebuffers; swapped++; }
+        if (glad_glNamedFramebufferRenderbuffer == wrap_glNamedFramebufferRenderbuffer) { glad_glNamedFramebufferRenderbuffer = real_glNamedFramebufferRenderbuffer; swapped++; }
+        if (glad_glNamedFramebufferParameteri == wrap_glNamedFramebufferParameteri) { glad_glNamedFramebufferParameteri = real_glNamedFramebufferParameteri; swapped++; }
+        if (glad_glNamedFramebufferTexture == wrap_glNamedFramebufferTexture) { glad_glNamedFramebufferTexture = real_glNamedFramebufferTexture; swapped++; }
+        if (glad_glNamedFramebufferTextureLayer == wrap_glNamedFramebufferTextureLayer) { glad_glNamedFramebufferTextureLayer = real_glNamedFramebufferTextureLayer; swapped++; }
+        if (glad_glNamedFramebufferDrawBuffer == wrap_glNamedFramebufferDrawBuffer) { glad_glNamedFramebufferDrawBuffer = real_glNamedFramebufferDrawBuffer; swapped++; }
+        if (glad_glNamedFramebufferDrawBuffers == wrap_glNamedFramebufferDrawBuffers) { glad_glNamedFramebufferDrawBuffers = real_glNamedFramebufferDrawBuffers; swapped++; }
+        if (glad_glNamedFramebufferReadBuffer == wrap_glNamedFramebufferReadBuffer) { glad_glNamedFramebufferReadBuffer = real_glNamedFramebufferReadBuffer; swapped++; }
+        if (glad_glInvalidateNamedFramebufferData == wrap_glInvalidateNamedFramebufferData) { glad_glInvalidateNamedFramebufferData = real_glInvalidateNamedFramebufferData; swapped++; }
+        if (glad_glInvalidateNamedFramebufferSubData == wrap_glInvalidateNamedFramebufferSubData) { glad_glInvalidateNamedFramebufferSubData = real_glInvalidateNamedFramebufferSubData; swapped++; }
+        if (glad_glClearNamedFramebufferiv == wrap_glClearNamedFramebufferiv) { glad_glClearNamedFramebufferiv = real_glClearNamedFramebufferiv; swapped++; }
+        if (glad_glClearNamedFramebufferuiv == wrap_glClearNamedFramebufferuiv) { glad_glClearNamedFramebufferuiv = real_glClearNamedFramebufferuiv; swapped++; }
+        if (glad_glClearNamedFramebufferfv == wrap_glClearNamedFramebufferfv) { glad_glClearNamedFramebufferfv = real_glClearNamedFramebufferfv; swapped++; }
+        if (glad_glClearNamedFramebufferfi == wrap_glClearNamedFramebufferfi) { glad_glClearNamedFramebufferfi = real_glClearNamedFramebufferfi; swapped++; }
+        if (glad_glBlitNamedFramebuffer == wrap_glBlitNamedFramebuffer) { glad_glBlitNamedFramebuffer = real_glBlitNamedFramebuffer; swapped++; }
+        if (glad_glCheckNamedFramebufferStatus == wrap_glCheckNamedFramebufferStatus) { glad_glCheckNamedFramebufferStatus = real_glCheckNamedFramebufferStatus; swapped++; }
+        if (glad_glGetNamedFramebufferParameteriv == wrap_glGetNamedFramebufferParameteriv) { glad_glGetNamedFramebufferParameteriv = real_glGetNamedFramebufferParameteriv; swapped++; }
+        if (glad_glGetNamedFramebufferAttachmentParameteriv == wrap_glGetNamedFramebufferAttachmentParameteriv) { glad_glGetNamedFramebufferAttachmentParameteriv = real_glGetNamedFramebufferAttachmentParameteriv; swapped++; }
+        if (glad_glCreateRenderbuffers == wrap_glCreateRenderbuffers) { glad_glCreateRenderbuffers = real_glCreateRenderbuffers; swapped++; }
+        if (glad_glNamedRenderbufferStorage == wrap_glNamedRenderbufferStorage) { glad_glNamedRenderbufferStorage = real_glNamedRenderbufferStorage; swapped++; }
+        if (glad_glNamedRenderbufferStorageMultisample == wrap_glNamedRenderbufferStorageMultisample) { glad_glNamedRenderbufferStorageMultisample = real_glNamedRenderbufferStorageMultisample; swapped++; }
+        if (glad_glGetNamedRenderbufferParameteriv == wrap_glGetNamedRenderbufferParameteriv) { glad_glGetNamedRenderbufferParameteriv = real_glGetNamedRenderbufferParameteriv; swapped++; }
+        if (glad_glCreateTextures == wrap_glCreateTextures) { glad_glCreateTextures = real_glCreateTextures; swapped++; }
+        if (glad_glTextureBuffer == wrap_glTextureBuffer) { glad_glTextureBuffer = real_glTextureBuffer; swapped++; }
+        if (glad_glTextureBufferRange == wrap_glTextureBufferRange) { glad_glTextureBufferRange = real_glTextureBufferRange; swapped++; }
+        if (glad_glTextureStorage1D == wrap_glTextureStorage1D) { glad_glTextureStorage1D = real_glTextureStorage1D; swapped++; }
+        if (glad_glTextureStorage2D == wrap_glTextureStorage2D) { glad_glTextureStorage2D = real_glTextureStorage2D; swapped++; }
+        if (glad_glTextureStorage3D == wrap_glTextureStorage3D) { glad_glTextureStorage3D = real_glTextureStorage3D; swapped++; }
+        if (glad_glTextureStorage2DMultisample == wrap_glTextureStorage2DMultisample) { glad_glTextureStorage2DMultisample = real_glTextureStorage2DMultisample; swapped++; }
+        if (glad_glTextureStorage3DMultisample == wrap_glTextureStorage3DMultisample) { glad_glTextureStorage3DMultisample = real_glTextureStorage3DMultisample; swapped++; }
+        if (glad_glTextureSubImage1D == wrap_glTextureSubImage1D) { glad_glTextureSubImage1D = real_glTextureSubImage1D; swapped++; }
+        if (glad_glTextureSubImage2D == wrap_glTextureSubImage2D) { glad_glTextureSubImage2D = real_glTextureSubImage2D; swapped++; }
+        if (glad_glTextureSubImage3D == wrap_glTextureSubImage3D) { glad_glTextureSubImage3D = real_glTextureSubImage3D; swapped++; }
+        if (glad_glCompressedTextureSubImage1D == wrap_glCompressedTextureSubImage1D) { glad_glCompressedTextureSubImage1D = real_glCompressedTextureSubImage1D; swapped++; }
+        if (glad_glCompressedTextureSubImage2D == wrap_glCompressedTextureSubImage2D) { glad_glCompressedTextureSubImage2D = real_glCompressedTextureSubImage2D; swapped++; }
+        if (glad_glCompressedTextureSubImage3D == wrap_glCompressedTextureSubImage3D) { glad_glCompressedTextureSubImage3D = real_glCompressedTextureSubImage3D; swapped++; }
+        if (glad_glCopyTextureSubImage1D == wrap_glCopyTextureSubImage1D) { glad_glCopyTextureSubImage1D = real_glCopyTextureSubImage1D; swapped++; }
+        if (glad_glCopyTextureSubImage2D == wrap_glCopyTextureSubImage2D) { glad_glCopyTextureSubImage2D = real_glCopyTextureSubImage2D; swapped++; }
+        if (glad_glCopyTextureSubImage3D == wrap_glCopyTextureSubImage3D) { glad_glCopyTextureSubImage3D = real_glCopyTextureSubImage3D; swapped++; }
+        if (glad_glTextureParameterf == wrap_glTextureParameterf) { glad_glTextureParameterf = real_glTextureParameterf; swapped++; }
+        if (glad_glTextureParameterfv == wrap_glTextureParameterfv) { glad_glTextureParameterfv = real_glTextureParameterfv; swapped++; }
+        if (glad_glTextureParameteri == wrap_glTextureParameteri) { glad_glTextureParameteri = real_glTextureParameteri; swapped++; }
+        if (glad_glTextureParameterIiv == wrap_glTextureParameterIiv) { glad_glTextureParameterIiv = real_glTextureParameterIiv; swapped++; }
+        if (glad_glTextureParameterIuiv == wrap_glTextureParameterIuiv) { glad_glTextureParameterIuiv = real_glTextureParameterIuiv; swapped++; }
+        if (glad_glTextureParameteriv == wrap_glTextureParameteriv) { glad_glTextureParameteriv = real_glTextureParameteriv; swapped++; }
+        if (glad_glGenerateTextureMipmap == wrap_glGenerateTextureMipmap) { glad_glGenerateTextureMipmap = real_glGenerateTextureMipmap; swapped++; }
+        if (glad_glBindTextureUnit == wrap_glBindTextureUnit) { glad_glBindTextureUnit = real_glBindTextureUnit; swapped++; }
+        if (glad_glGetTextureImage == wrap_glGetTextureImage) { glad_glGetTextureImage = real_glGetTextureImage; swapped++; }
+        if (glad_glGetCompressedTextureImage == wrap_glGetCompressedTextureImage) { glad_glGetCompressedTextureImage = real_glGetCompressedTextureImage; swapped++; }
+        if (glad_glGetTextureLevelParameterfv == wrap_glGetTextureLevelParameterfv) { glad_glGetTextureLevelParameterfv = real_glGetTextureLevelParameterfv; swapped++; }
+        if (glad_glGetTextureLevelParameteriv == wrap_glGetTextureLevelParameteriv) { glad_glGetTextureLevelParameteriv = real_glGetTextureLevelParameteriv; swapped++; }
+        if (glad_glGetTextureParameterfv == wrap_glGetTextureParameterfv) { glad_glGetTextureParameterfv = real_glGetTextureParameterfv; swapped++; }
+        if (glad_glGetTextureParameterIiv == wrap_glGetTextureParameterIiv) { glad_glGetTextureParameterIiv = real_glGetTextureParameterIiv; swapped++; }
+        if (glad_glGetTextureParameterIuiv == wrap_glGetTextureParameterIuiv) { glad_glGetTextureParameterIuiv = real_glGetTextureParameterIuiv; swapped++; }
+        if (glad_glGetTextureParameteriv == wrap_glGetTextureParameteriv) { glad_glGetTextureParameteriv = real_glGetTextureParameteriv; swapped++; }
+        if (glad_glCreateVertexArrays == wrap_glCreateVertexArrays) { glad_glCreateVertexArrays = real_glCreateVertexArrays; swapped++; }
+        if (glad_glDisableVertexArrayAttrib == wrap_glDisableVertexArrayAttrib) { glad_glDisableVertexArrayAttrib = real_glDisableVertexArrayAttrib; swapped++; }
+        if (glad_glEnableVertexArrayAttrib == wrap_glEnableVertexArrayAttrib) { glad_glEnableVertexArrayAttrib = real_glEnableVertexArrayAttrib; swapped++; }
+        if (glad_glVertexArrayElementBuffer == wrap_glVertexArrayElementBuffer) { glad_glVertexArrayElementBuffer = real_glVertexArrayElementBuffer; swapped++; }
+        if (glad_glVertexArrayVertexBuffer == wrap_glVertexArrayVertexBuffer) { glad_glVertexArrayVertexBuffer = real_glVertexArrayVertexBuffer; swapped++; }
+        if (glad_glVertexArrayVertexBuffers == wrap_glVertexArrayVertexBuffers) { glad_glVertexArrayVertexBuffers = real_glVertexArrayVertexBuffers; swapped++; }
+        if (glad_glVertexArrayAttribBinding == wrap_glVertexArrayAttribBinding) { glad_glVertexArrayAttribBinding = real_glVertexArrayAttribBinding; swapped++; }
+        if (glad_glVertexArrayAttribFormat == wrap_glVertexArrayAttribFormat) { glad_glVertexArrayAttribFormat = real_glVertexArrayAttribFormat; swapped++; }
+        if (glad_glVertexArrayAttribIFormat == wrap_glVertexArrayAttribIFormat) { glad_glVertexArrayAttribIFormat = real_glVertexArrayAttribIFormat; swapped++; }
+        if (glad_glVertexArrayAttribLFormat == wrap_glVertexArrayAttribLFormat) { glad_glVertexArrayAttribLFormat = real_glVertexArrayAttribLFormat; swapped++; }
+        if (glad_glVertexArrayBindingDivisor == wrap_glVertexArrayBindingDivisor) { glad_glVertexArrayBindingDivisor = real_glVertexArrayBindingDivisor; swapped++; }
+        if (glad_glGetVertexArrayiv == wrap_glGetVertexArrayiv) { glad_glGetVertexArrayiv = real_glGetVertexArrayiv; swapped++; }
+        if (glad_glGetVertexArrayIndexediv == wrap_glGetVertexArrayIndexediv) { glad_glGetVertexArrayIndexediv = real_glGetVertexArrayIndexediv; swapped++; }
+        if (glad_glGetVertexArrayIndexed64iv == wrap_glGetVertexArrayIndexed64iv) { glad_glGetVertexArrayIndexed64iv = real_glGetVertexArrayIndexed64iv; swapped++; }
+        if (glad_glCreateSamplers == wrap_glCreateSamplers) { glad_glCreateSamplers = real_glCreateSamplers; swapped++; }
+        if (glad_glCreateProgramPipelines == wrap_glCreateProgramPipelines) { glad_glCreateProgramPipelines = real_glCreateProgramPipelines; swapped++; }
+        if (glad_glCreateQueries == wrap_glCreateQueries) { glad_glCreateQueries = real_glCreateQueries; swapped++; }
+        if (glad_glGetQueryBufferObjecti64v == wrap_glGetQueryBufferObjecti64v) { glad_glGetQueryBufferObjecti64v = real_glGetQueryBufferObjecti64v; swapped++; }
+        if (glad_glGetQueryBufferObjectiv == wrap_glGetQueryBufferObjectiv) { glad_glGetQueryBufferObjectiv = real_glGetQueryBufferObjectiv; swapped++; }
+        if (glad_glGetQueryBufferObjectui64v == wrap_glGetQueryBufferObjectui64v) { glad_glGetQueryBufferObjectui64v = real_glGetQueryBufferObjectui64v; swapped++; }
+        if (glad_glGetQueryBufferObjectuiv == wrap_glGetQueryBufferObjectuiv) { glad_glGetQueryBufferObjectuiv = real_glGetQueryBufferObjectuiv; swapped++; }
+        if (glad_glMemoryBarrierByRegion == wrap_glMemoryBarrierByRegion) { glad_glMemoryBarrierByRegion = real_glMemoryBarrierByRegion; swapped++; }
+        if (glad_glGetTextureSubImage == wrap_glGetTextureSubImage) { glad_glGetTextureSubImage = real_glGetTextureSubImage; swapped++; }
+        if (glad_glGetCompressedTextureSubImage == wrap_glGetCompressedTextureSubImage) { glad_glGetCompressedTextureSubImage = real_glGetCompressedTextureSubImage; swapped++; }
+        if (glad_glGetGraphicsResetStatus == wrap_glGetGraphicsResetStatus) { glad_glGetGraphicsResetStatus = real_glGetGraphicsResetStatus; swapped++; }
+        if (glad_glGetnCompressedTexImage == wrap_glGetnCompressedTexImage) { glad_glGetnCompressedTexImage = real_glGetnCompressedTexImage; swapped++; }
+        if (glad_glGetnTexImage == wrap_glGetnTexImage) { glad_glGetnTexImage = real_glGetnTexImage; swapped++; }
+        if (glad_glGetnUniformdv == wrap_glGetnUniformdv) { glad_glGetnUniformdv = real_glGetnUniformdv; swapped++; }
+        if (glad_glGetnUniformfv == wrap_glGetnUniformfv) { glad_glGetnUniformfv = real_glGetnUniformfv; swapped++; }
+        if (glad_glGetnUniformiv == wrap_glGetnUniformiv) { glad_glGetnUniformiv = real_glGetnUniformiv; swapped++; }
+        if (glad_glGetnUniformuiv == wrap_glGetnUniformuiv) { glad_glGetnUniformuiv = real_glGetnUniformuiv; swapped++; }
+        if (glad_glReadnPixels == wrap_glReadnPixels) { glad_glReadnPixels = real_glReadnPixels; swapped++; }
+        if (glad_glGetnMapdv == wrap_glGetnMapdv) { glad_glGetnMapdv = real_glGetnMapdv; swapped++; }
+        if (glad_glGetnMapfv == wrap_glGetnMapfv) { glad_glGetnMapfv = real_glGetnMapfv; swapped++; }
+        if (glad_glGetnMapiv == wrap_glGetnMapiv) { glad_glGetnMapiv = real_glGetnMapiv; swapped++; }
+        if (glad_glGetnPixelMapfv == wrap_glGetnPixelMapfv) { glad_glGetnPixelMapfv = real_glGetnPixelMapfv; swapped++; }
+        if (glad_glGetnPixelMapuiv == wrap_glGetnPixelMapuiv) { glad_glGetnPixelMapuiv = real_glGetnPixelMapuiv; swapped++; }
+        if (glad_glGetnPixelMapusv == wrap_glGetnPixelMapusv) { glad_glGetnPixelMapusv = real_glGetnPixelMapusv; swapped++; }
+        if (glad_glGetnPolygonStipple == wrap_glGetnPolygonStipple) { glad_glGetnPolygonStipple = real_glGetnPolygonStipple; swapped++; }
+        if (glad_glGetnColorTable == wrap_glGetnColorTable) { glad_glGetnColorTable = real_glGetnColorTable; swapped++; }
+        if (glad_glGetnConvolutionFilter == wrap_glGetnConvolutionFilter) { glad_glGetnConvolutionFilter = real_glGetnConvolutionFilter; swapped++; }
+        if (glad_glGetnSeparableFilter == wrap_glGetnSeparableFilter) { glad_glGetnSeparableFilter = real_glGetnSeparableFilter; swapped++; }
+        if (glad_glGetnHistogram == wrap_glGetnHistogram) { glad_glGetnHistogram = real_glGetnHistogram; swapped++; }
+        if (glad_glGetnMinmax == wrap_glGetnMinmax) { glad_glGetnMinmax = real_glGetnMinmax; swapped++; }
+        if (glad_glTextureBarrier == wrap_glTextureBarrier) { glad_glTextureBarrier = real_glTextureBarrier; swapped++; }
+        if (glad_glSpecializeShader == wrap_glSpecializeShader) { glad_glSpecializeShader = real_glSpecializeShader; swapped++; }
+        if (glad_glMultiDrawArraysIndirectCount == wrap_glMultiDrawArraysIndirectCount) { glad_glMultiDrawArraysIndirectCount = real_glMultiDrawArraysIndirectCount; swapped++; }
+        if (glad_glMultiDrawElementsIndirectCount == wrap_glMultiDrawElementsIndirectCount) { glad_glMultiDrawElementsIndirectCount = real_glMultiDrawElementsIndirectCount; swapped++; }
+        if (glad_glPolygonOffsetClamp == wrap_glPolygonOffsetClamp) { glad_glPolygonOffsetClamp = real_glPolygonOffsetClamp; swapped++; }
+        if (glad_glMaxShaderCompilerThreadsKHR == wrap_glMaxShaderCompilerThreadsKHR) { glad_glMaxShaderCompilerThreadsKHR = real_glMaxShaderCompilerThreadsKHR; swapped++; }
+    }
+    return swapped;
+}
@@ -0,0 +1,343 @@
+#include "gl_replay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gl_capture.h"
+
+// -- Reading -- //
+static const void* take(GlReplay* replay, size_t size) {
+    if (replay->failed || (size_t)(replay->end - replay->cursor) < size) {
+        replay->failed = 1;
+        return NULL;
+    }
+    const void* data = replay->cursor;
+    replay->cursor += size;
+    return data;
+}
+
+uint32_t gl_replay_u32(GlReplay* replay) {
+    uint32_t value = 0;
+    const void* data = take(replay, sizeof(value));
+    if (data) {
+        memcpy(&value, data, sizeof(value));
+    }
+    return value;
+}
+
+uint64_t gl_replay_u64(GlReplay* replay) {
+    uint64_t value = 0;
+    const void* data = take(replay, sizeof(value));
+    if (data) {
+        memcpy(&value, data, sizeof(value));
+    }
+    return value;
+}
+
+float gl_replay_f32(GlReplay* replay) {
+    float value = 0.0f;
+    const void* data = take(replay, sizeof(value));
+    if (data) {
+        memcpy(&value, data, sizeof(value));
+    }
+    return value;
+}
+
+double gl_replay_f64(GlReplay* replay) {
+    double value = 0.0;
+    const void* data = take(replay, sizeof(value));
+    if (data) {
+        memcpy(&value, data, sizeof(value));
+    }
+    return value;
+}
+
+const void* gl_replay_bytes(GlReplay* replay, uint64_t* size) {
+    uint64_t length = gl_replay_u64(replay);
+    if (size) {
+        *size = length == GL_CAPTURE_NULL ? 0 : length;
+    }
+    if (length == GL_CAPTURE_NULL) {
+        return NULL;
+    }
+    return take(replay, length);
+}
+
+void* gl_replay_scratch(GlReplay* replay, size_t size) {
+    if (size > replay->scratch_size) {
+        void* scratch = realloc(replay->scratch, size);
+        if (!scratch) {
+            printf("ERROR::GL_REPLAY::OUT_OF_MEMORY\n");
+            replay->failed = 1;
+            return NULL;
+        }
+        replay->scratch = scratch;
+        replay->scratch_size = size;
+    }
+    return replay->scratch;
+}
+
+const GLchar* const* gl_replay_strings(GlReplay* replay, GLsizei count, const GLint** lengths) {
+    count = count > 0 ? count : 0;
+    char* scratch = (char*)gl_replay_scratch(replay, count * (sizeof(GLchar*) + sizeof(GLint)) + 1);
+    if (!scratch) {
+        *lengths = NULL;
+        return NULL;
+    }
+    const GLchar** strings = (const GLchar**)scratch;
+    GLint* sizes = (GLint*)(scratch + count * sizeof(GLchar*));
+    for (GLsizei i = 0; i < count; i++) {
+        uint64_t size = 0;
+        strings[i] = (const GLchar*)gl_replay_bytes(replay, &size);
+        sizes[i] = size ? (GLint)(size - 1) : 0;
+    }
+    *lengths = sizes;
+    return strings;
+}
+
+// -- Object names -- //
+static GLuint* map_slot(GlReplay* replay, GlNameKind kind, uint32_t captured) {
+    GlNameMap* map = &replay->maps[kind];
+    if (captured >= map->capacity) {
+        uint32_t capacity = map->capacity ? map->capacity : 256;
+        while (capacity <= captured) {
+            capacity *= 2;
+        }
+        GLuint* names = (GLuint*)realloc(map->names, capacity * sizeof(GLuint));
+        if (!names) {
+            printf("ERROR::GL_REPLAY::OUT_OF_MEMORY\n");
+            replay->failed = 1;
+            return NULL;
+        }
+        memset(names + map->capacity, 0, (capacity - map->capacity) * sizeof(GLuint));
+        map->names = names;
+        map->capacity = capacity;
+    }
+    return &map->names[captured];
+}
+
+static GLuint remap(const GlReplay* replay, GlNameKind kind, uint32_t captured) {
+    const GlNameMap* map = &replay->maps[kind];
+    if (captured < map->capacity && map->names[captured]) {
+        return map->names[captured];
+    }
+    return captured;
+}
+
+GLuint gl_replay_name(GlReplay* replay, GlNameKind kind) {
+    return remap(replay, kind, gl_replay_u32(replay));
+}
+
+const GLuint* gl_replay_names(GlReplay* replay, GlNameKind kind, GLsizei count) {
+    count = count > 0 ? count : 0;
+    GLuint* names = (GLuint*)gl_replay_scratch(replay, count * sizeof(GLuint) + 1);
+    if (!names) {
+        return NULL;
+    }
+    for (GLsizei i = 0; i < count; i++) {
+        names[i] = gl_replay_name(replay, kind);
+    }
+    return names;
+}
+
+void gl_replay_created(GlReplay* replay, GlNameKind kind, GLsizei count, const GLuint* created) {
+    for (GLsizei i = 0; i < count; i++) {
+        GLuint* slot = map_slot(replay, kind, gl_replay_u32(replay));
+        if (slot) {
+            *slot = created[i];
+        }
+    }
+}
+
+GLsync gl_replay_sync(GlReplay* replay) {
+    uint64_t captured = gl_replay_u64(replay);
+    for (int i = 0; i < replay->sync_count; i++) {
+        if (replay->syncs[i].captured == captured) {
+            return replay->syncs[i].sync;
+        }
+    }
+    return NULL;
+}
+
+void gl_replay_created_sync(GlReplay* replay, GLsync sync) {
+    uint64_t captured = gl_replay_u64(replay);
+    // drivers reuse the addresses of deleted syncs, so this stays small
+    for (int i = 0; i < replay->sync_count; i++) {
+        if (replay->syncs[i].captured == captured) {
+            replay->syncs[i].sync = sync;
+            return;
+        }
+    }
+    if (replay->sync_count == replay->sync_capacity) {
+        int capacity = replay->sync_capacity ? replay->sync_capacity * 2 : 16;
+        GlSyncEntry* syncs = (GlSyncEntry*)realloc(replay->syncs, capacity * sizeof(GlSyncEntry));
+        if (!syncs) {
+            printf("ERROR::GL_REPLAY::OUT_OF_MEMORY\n");
+            replay->failed = 1;
+            return;
+        }
+        replay->syncs = syncs;
+        replay->sync_capacity = capacity;
+    }
+    replay->syncs[replay->sync_count++] = (GlSyncEntry){ captured, sync };
+}
+
+// -- Images -- //
+const void* gl_replay_image(GlReplay* replay) {
+    GLint alignment = (GLint)gl_replay_u32(replay);
+    GLint row_length = (GLint)gl_replay_u32(replay);
+    GLint skip_pixels = (GLint)gl_replay_u32(replay);
+    GLint skip_rows = (GLint)gl_replay_u32(replay);
+    if (replay->failed) {
+        return NULL;
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, row_length);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, skip_pixels);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, skip_rows);
+    if (gl_replay_u32(replay)) {
+        return (const void*)(uintptr_t)gl_replay_u64(replay);
+    }
+    return gl_replay_bytes(replay, NULL);
+}
+
+// -- Mappings -- //
+void gl_replay_mapped(GlReplay* replay, GLenum target, void* pointer, GLsizeiptr length) {
+    GLuint buffer = gl_capture_bound_buffer(target);
+    GlReplayMapping* free_slot = NULL;
+    for (int i = 0; i < 16; i++) {
+        GlReplayMapping* mapping = &replay->mappings[i];
+        if (mapping->pointer && mapping->buffer == buffer) {
+            free_slot = mapping;
+            break;
+        }
+        free_slot = !mapping->pointer && !free_slot ? mapping : free_slot;
+    }
+    if (free_slot) {
+        free_slot->buffer = buffer;
+        free_slot->pointer = (char*)pointer;
+        free_slot->length = pointer ? length : 0;
+    }
+}
+
+void gl_replay_mapped_contents(GlReplay* replay, GLenum target, GLintptr offset) {
+    uint64_t size = 0;
+    const void* data = gl_replay_bytes(replay, &size);
+    GLuint buffer = gl_capture_bound_buffer(target);
+    for (int i = 0; i < 16; i++) {
+        GlReplayMapping* mapping = &replay->mappings[i];
+        if (mapping->pointer && mapping->buffer == buffer) {
+            if (!data) {
+                return;
+            }
+            if (offset < 0 || offset > mapping->length || size > (uint64_t)(mapping->length - offset)) {
+                printf("ERROR::GL_REPLAY::MAPPED_WRITE_OUT_OF_RANGE\n");
+                replay->failed = 1;
+                return;
+            }
+            memcpy(mapping->pointer + offset, data, size);
+            return;
+        }
+    }
+}
+
+// -- Stream -- //
+int gl_replay_open(GlReplay* replay, const char* path) {
+    memset(replay, 0, sizeof(*replay));
+    if (file_load(path, &replay->file) != 0) {
+        printf("ERROR::GL_REPLAY::FILE_NOT_READ %s\n", path);
+        return -1;
+    }
+    replay->cursor = replay->file.data;
+    replay->end = replay->file.data + replay->file.size;
+
+    const char* magic = (const char*)take(replay, 8);
+    uint32_t version = gl_replay_u32(replay);
+    if (!magic || memcmp(magic, "GSLCAP\0\0", 8) != 0 || version != GL_CAPTURE_VERSION) {
+        printf("ERROR::GL_REPLAY::NOT_A_CAPTURE %s\n", path);
+        gl_replay_close(replay);
+        return -1;
+    }
+    replay->width = (int)gl_replay_u32(replay);
+    replay->height = (int)gl_replay_u32(replay);
+    replay->frame_count = (int)gl_replay_u32(replay);
+    replay->function_count = (int)gl_replay_u32(replay);
+
+    replay->names = (const char**)calloc(replay->function_count + 1, sizeof(const char*));
+    replay->functions = (int*)calloc(replay->function_count + 1, sizeof(int));
+    if (!replay->names || !replay->functions) {
+        printf("ERROR::GL_REPLAY::OUT_OF_MEMORY\n");
+        gl_replay_close(replay);
+        return -1;
+    }
+    for (int i = 0; i < replay->function_count && !replay->failed; i++) {
+        const char* name = replay->cursor;
+        const char* nul = (const char*)memchr(name, '\0', replay->end - name);
+        if (!nul) {
+            replay->failed = 1;
+            break;
+        }
+        replay->cursor = nul + 1;
+        replay->names[i] = name;
+        replay->functions[i] = -1;
+        for (int j = 0; j < gl_replay_function_count; j++) {
+            if (strcmp(gl_replay_function_names[j], name) == 0) {
+                replay->functions[i] = j;
+                break;
+            }
+        }
+    }
+    if (replay->failed) {
+        printf("ERROR::GL_REPLAY::NOT_A_CAPTURE %s\n", path);
+        gl_replay_close(replay);
+        return -1;
+    }
+    return 0;
+}
+
+void gl_replay_close(GlReplay* replay) {
+    file_release(&replay->file);
+    for (int i = 0; i < GL_NAME_KINDS; i++) {
+        free(replay->maps[i].names);
+    }
+    free(replay->names);
+    free(replay->functions);
+    free(replay->syncs);
+    free(replay->scratch);
+    memset(replay, 0, sizeof(*replay));
+}
+
+int gl_replay_frame(GlReplay* replay) {
+    while (replay->cursor < replay->end) {
+        uint16_t id = 0;
+        const void* data = take(replay, sizeof(id));
+        if (!data) {
+            break;
+        }
+        memcpy(&id, data, sizeof(id));
+
+        if (id == GL_CAPTURE_FRAME) {
+            replay->frames++;
+            if (!replay->first_frame) {
+                replay->first_frame = replay->cursor;
+            }
+            return 1;
+        }
+        if (id >= replay->function_count || replay->functions[id] < 0 || !gl_replay_calls[replay->functions[id]]) {
+            printf("ERROR::GL_REPLAY::UNKNOWN_FUNCTION %s\n", id < replay->function_count ? replay->names[id] : "?");
+            return -1;
+        }
+        gl_replay_calls[replay->functions[id]](replay);
+        replay->calls++;
+        if (replay->failed) {
+            printf("ERROR::GL_REPLAY::TRUNCATED in %s\n", replay->names[id]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void gl_replay_rewind(GlReplay* replay) {
+    if (replay->first_frame) {
+        replay->cursor = replay->first_frame;
+    }
+}
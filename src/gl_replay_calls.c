@@ -0,0 +1,6331 @@
+// generated by tools/gl_intercept.py from include/glad/glad.h, do not edit
+#include "gl_replay.h"
+#include <stddef.h>
+
+#define FUNCTION_COUNT 1049
+
+const char* const gl_replay_function_names[FUNCTION_COUNT] = {
+    "glCullFace",
+    "glFrontFace",
+    "glHint",
+    "glLineWidth",
+    "glPointSize",
+    "glPolygonMode",
+    "glScissor",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glDrawBuffer",
+    "glClear",
+    "glClearColor",
+    "glClearStencil",
+    "glClearDepth",
+    "glStencilMask",
+    "glColorMask",
+    "glDepthMask",
+    "glDisable",
+    "glEnable",
+    "glFinish",
+    "glFlush",
+    "glBlendFunc",
+    "glLogicOp",
+    "glStencilFunc",
+    "glStencilOp",
+    "glDepthFunc",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glReadBuffer",
+    "glReadPixels",
+    "glGetBooleanv",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloatv",
+    "glGetIntegerv",
+    "glGetString",
+    "glGetTexImage",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glIsEnabled",
+    "glDepthRange",
+    "glViewport",
+    "glNewList",
+    "glEndList",
+    "glCallList",
+    "glCallLists",
+    "glDeleteLists",
+    "glGenLists",
+    "glListBase",
+    "glBegin",
+    "glBitmap",
+    "glColor3b",
+    "glColor3bv",
+    "glColor3d",
+    "glColor3dv",
+    "glColor3f",
+    "glColor3fv",
+    "glColor3i",
+    "glColor3iv",
+    "glColor3s",
+    "glColor3sv",
+    "glColor3ub",
+    "glColor3ubv",
+    "glColor3ui",
+    "glColor3uiv",
+    "glColor3us",
+    "glColor3usv",
+    "glColor4b",
+    "glColor4bv",
+    "glColor4d",
+    "glColor4dv",
+    "glColor4f",
+    "glColor4fv",
+    "glColor4i",
+    "glColor4iv",
+    "glColor4s",
+    "glColor4sv",
+    "glColor4ub",
+    "glColor4ubv",
+    "glColor4ui",
+    "glColor4uiv",
+    "glColor4us",
+    "glColor4usv",
+    "glEdgeFlag",
+    "glEdgeFlagv",
+    "glEnd",
+    "glIndexd",
+    "glIndexdv",
+    "glIndexf",
+    "glIndexfv",
+    "glIndexi",
+    "glIndexiv",
+    "glIndexs",
+    "glIndexsv",
+    "glNormal3b",
+    "glNormal3bv",
+    "glNormal3d",
+    "glNormal3dv",
+    "glNormal3f",
+    "glNormal3fv",
+    "glNormal3i",
+    "glNormal3iv",
+    "glNormal3s",
+    "glNormal3sv",
+    "glRasterPos2d",
+    "glRasterPos2dv",
+    "glRasterPos2f",
+    "glRasterPos2fv",
+    "glRasterPos2i",
+    "glRasterPos2iv",
+    "glRasterPos2s",
+    "glRasterPos2sv",
+    "glRasterPos3d",
+    "glRasterPos3dv",
+    "glRasterPos3f",
+    "glRasterPos3fv",
+    "glRasterPos3i",
+    "glRasterPos3iv",
+    "glRasterPos3s",
+    "glRasterPos3sv",
+    "glRasterPos4d",
+    "glRasterPos4dv",
+    "glRasterPos4f",
+    "glRasterPos4fv",
+    "glRasterPos4i",
+    "glRasterPos4iv",
+    "glRasterPos4s",
+    "glRasterPos4sv",
+    "glRectd",
+    "glRectdv",
+    "glRectf",
+    "glRectfv",
+    "glRecti",
+    "glRectiv",
+    "glRects",
+    "glRectsv",
+    "glTexCoord1d",
+    "glTexCoord1dv",
+    "glTexCoord1f",
+    "glTexCoord1fv",
+    "glTexCoord1i",
+    "glTexCoord1iv",
+    "glTexCoord1s",
+    "glTexCoord1sv",
+    "glTexCoord2d",
+    "glTexCoord2dv",
+    "glTexCoord2f",
+    "glTexCoord2fv",
+    "glTexCoord2i",
+    "glTexCoord2iv",
+    "glTexCoord2s",
+    "glTexCoord2sv",
+    "glTexCoord3d",
+    "glTexCoord3dv",
+    "glTexCoord3f",
+    "glTexCoord3fv",
+    "glTexCoord3i",
+    "glTexCoord3iv",
+    "glTexCoord3s",
+    "glTexCoord3sv",
+    "glTexCoord4d",
+    "glTexCoord4dv",
+    "glTexCoord4f",
+    "glTexCoord4fv",
+    "glTexCoord4i",
+    "glTexCoord4iv",
+    "glTexCoord4s",
+    "glTexCoord4sv",
+    "glVertex2d",
+    "glVertex2dv",
+    "glVertex2f",
+    "glVertex2fv",
+    "glVertex2i",
+    "glVertex2iv",
+    "glVertex2s",
+    "glVertex2sv",
+    "glVertex3d",
+    "glVertex3dv",
+    "glVertex3f",
+    "glVertex3fv",
+    "glVertex3i",
+    "glVertex3iv",
+    "glVertex3s",
+    "glVertex3sv",
+    "glVertex4d",
+    "glVertex4dv",
+    "glVertex4f",
+    "glVertex4fv",
+    "glVertex4i",
+    "glVertex4iv",
+    "glVertex4s",
+    "glVertex4sv",
+    "glClipPlane",
+    "glColorMaterial",
+    "glFogf",
+    "glFogfv",
+    "glFogi",
+    "glFogiv",
+    "glLightf",
+    "glLightfv",
+    "glLighti",
+    "glLightiv",
+    "glLightModelf",
+    "glLightModelfv",
+    "glLightModeli",
+    "glLightModeliv",
+    "glLineStipple",
+    "glMaterialf",
+    "glMaterialfv",
+    "glMateriali",
+    "glMaterialiv",
+    "glPolygonStipple",
+    "glShadeModel",
+    "glTexEnvf",
+    "glTexEnvfv",
+    "glTexEnvi",
+    "glTexEnviv",
+    "glTexGend",
+    "glTexGendv",
+    "glTexGenf",
+    "glTexGenfv",
+    "glTexGeni",
+    "glTexGeniv",
+    "glFeedbackBuffer",
+    "glSelectBuffer",
+    "glRenderMode",
+    "glInitNames",
+    "glLoadName",
+    "glPassThrough",
+    "glPopName",
+    "glPushName",
+    "glClearAccum",
+    "glClearIndex",
+    "glIndexMask",
+    "glAccum",
+    "glPopAttrib",
+    "glPushAttrib",
+    "glMap1d",
+    "glMap1f",
+    "glMap2d",
+    "glMap2f",
+    "glMapGrid1d",
+    "glMapGrid1f",
+    "glMapGrid2d",
+    "glMapGrid2f",
+    "glEvalCoord1d",
+    "glEvalCoord1dv",
+    "glEvalCoord1f",
+    "glEvalCoord1fv",
+    "glEvalCoord2d",
+    "glEvalCoord2dv",
+    "glEvalCoord2f",
+    "glEvalCoord2fv",
+    "glEvalMesh1",
+    "glEvalPoint1",
+    "glEvalMesh2",
+    "glEvalPoint2",
+    "glAlphaFunc",
+    "glPixelZoom",
+    "glPixelTransferf",
+    "glPixelTransferi",
+    "glPixelMapfv",
+    "glPixelMapuiv",
+    "glPixelMapusv",
+    "glCopyPixels",
+    "glDrawPixels",
+    "glGetClipPlane",
+    "glGetLightfv",
+    "glGetLightiv",
+    "glGetMapdv",
+    "glGetMapfv",
+    "glGetMapiv",
+    "glGetMaterialfv",
+    "glGetMaterialiv",
+    "glGetPixelMapfv",
+    "glGetPixelMapuiv",
+    "glGetPixelMapusv",
+    "glGetPolygonStipple",
+    "glGetTexEnvfv",
+    "glGetTexEnviv",
+    "glGetTexGendv",
+    "glGetTexGenfv",
+    "glGetTexGeniv",
+    "glIsList",
+    "glFrustum",
+    "glLoadIdentity",
+    "glLoadMatrixf",
+    "glLoadMatrixd",
+    "glMatrixMode",
+    "glMultMatrixf",
+    "glMultMatrixd",
+    "glOrtho",
+    "glPopMatrix",
+    "glPushMatrix",
+    "glRotated",
+    "glRotatef",
+    "glScaled",
+    "glScalef",
+    "glTranslated",
+    "glTranslatef",
+    "glDrawArrays",
+    "glDrawElements",
+    "glGetPointerv",
+    "glPolygonOffset",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glBindTexture",
+    "glDeleteTextures",
+    "glGenTextures",
+    "glIsTexture",
+    "glArrayElement",
+    "glColorPointer",
+    "glDisableClientState",
+    "glEdgeFlagPointer",
+    "glEnableClientState",
+    "glIndexPointer",
+    "glInterleavedArrays",
+    "glNormalPointer",
+    "glTexCoordPointer",
+    "glVertexPointer",
+    "glAreTexturesResident",
+    "glPrioritizeTextures",
+    "glIndexub",
+    "glIndexubv",
+    "glPopClientAttrib",
+    "glPushClientAttrib",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glActiveTexture",
+    "glSampleCoverage",
+    "glCompressedTexImage3D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage1D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage1D",
+    "glGetCompressedTexImage",
+    "glClientActiveTexture",
+    "glMultiTexCoord1d",
+    "glMultiTexCoord1dv",
+    "glMultiTexCoord1f",
+    "glMultiTexCoord1fv",
+    "glMultiTexCoord1i",
+    "glMultiTexCoord1iv",
+    "glMultiTexCoord1s",
+    "glMultiTexCoord1sv",
+    "glMultiTexCoord2d",
+    "glMultiTexCoord2dv",
+    "glMultiTexCoord2f",
+    "glMultiTexCoord2fv",
+    "glMultiTexCoord2i",
+    "glMultiTexCoord2iv",
+    "glMultiTexCoord2s",
+    "glMultiTexCoord2sv",
+    "glMultiTexCoord3d",
+    "glMultiTexCoord3dv",
+    "glMultiTexCoord3f",
+    "glMultiTexCoord3fv",
+    "glMultiTexCoord3i",
+    "glMultiTexCoord3iv",
+    "glMultiTexCoord3s",
+    "glMultiTexCoord3sv",
+    "glMultiTexCoord4d",
+    "glMultiTexCoord4dv",
+    "glMultiTexCoord4f",
+    "glMultiTexCoord4fv",
+    "glMultiTexCoord4i",
+    "glMultiTexCoord4iv",
+    "glMultiTexCoord4s",
+    "glMultiTexCoord4sv",
+    "glLoadTransposeMatrixf",
+    "glLoadTransposeMatrixd",
+    "glMultTransposeMatrixf",
+    "glMultTransposeMatrixd",
+    "glBlendFuncSeparate",
+    "glMultiDrawArrays",
+    "glMultiDrawElements",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glFogCoordf",
+    "glFogCoordfv",
+    "glFogCoordd",
+    "glFogCoorddv",
+    "glFogCoordPointer",
+    "glSecondaryColor3b",
+    "glSecondaryColor3bv",
+    "glSecondaryColor3d",
+    "glSecondaryColor3dv",
+    "glSecondaryColor3f",
+    "glSecondaryColor3fv",
+    "glSecondaryColor3i",
+    "glSecondaryColor3iv",
+    "glSecondaryColor3s",
+    "glSecondaryColor3sv",
+    "glSecondaryColor3ub",
+    "glSecondaryColor3ubv",
+    "glSecondaryColor3ui",
+    "glSecondaryColor3uiv",
+    "glSecondaryColor3us",
+    "glSecondaryColor3usv",
+    "glSecondaryColorPointer",
+    "glWindowPos2d",
+    "glWindowPos2dv",
+    "glWindowPos2f",
+    "glWindowPos2fv",
+    "glWindowPos2i",
+    "glWindowPos2iv",
+    "glWindowPos2s",
+    "glWindowPos2sv",
+    "glWindowPos3d",
+    "glWindowPos3dv",
+    "glWindowPos3f",
+    "glWindowPos3fv",
+    "glWindowPos3i",
+    "glWindowPos3iv",
+    "glWindowPos3s",
+    "glWindowPos3sv",
+    "glBlendColor",
+    "glBlendEquation",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectuiv",
+    "glBindBuffer",
+    "glDeleteBuffers",
+    "glGenBuffers",
+    "glIsBuffer",
+    "glBufferData",
+    "glBufferSubData",
+    "glGetBufferSubData",
+    "glMapBuffer",
+    "glUnmapBuffer",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glBlendEquationSeparate",
+    "glDrawBuffers",
+    "glStencilOpSeparate",
+    "glStencilFuncSeparate",
+    "glStencilMaskSeparate",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glCompileShader",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDeleteProgram",
+    "glDeleteShader",
+    "glDetachShader",
+    "glDisableVertexAttribArray",
+    "glEnableVertexAttribArray",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderSource",
+    "glGetUniformLocation",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glIsProgram",
+    "glIsShader",
+    "glLinkProgram",
+    "glShaderSource",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform2f",
+    "glUniform3f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform2i",
+    "glUniform3i",
+    "glUniform4i",
+    "glUniform1fv",
+    "glUniform2fv",
+    "glUniform3fv",
+    "glUniform4fv",
+    "glUniform1iv",
+    "glUniform2iv",
+    "glUniform3iv",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glValidateProgram",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribPointer",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glColorMaski",
+    "glGetBooleani_v",
+    "glGetIntegeri_v",
+    "glEnablei",
+    "glDisablei",
+    "glIsEnabledi",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glClampColor",
+    "glBeginConditionalRender",
+    "glEndConditionalRender",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI1i",
+    "glVertexAttribI2i",
+    "glVertexAttribI3i",
+    "glVertexAttribI4i",
+    "glVertexAttribI1ui",
+    "glVertexAttribI2ui",
+    "glVertexAttribI3ui",
+    "glVertexAttribI4ui",
+    "glVertexAttribI1iv",
+    "glVertexAttribI2iv",
+    "glVertexAttribI3iv",
+    "glVertexAttribI4iv",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4usv",
+    "glGetUniformuiv",
+    "glBindFragDataLocation",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glIsRenderbuffer",
+    "glBindRenderbuffer",
+    "glDeleteRenderbuffers",
+    "glGenRenderbuffers",
+    "glRenderbufferStorage",
+    "glGetRenderbufferParameteriv",
+    "glIsFramebuffer",
+    "glBindFramebuffer",
+    "glDeleteFramebuffers",
+    "glGenFramebuffers",
+    "glCheckFramebufferStatus",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferRenderbuffer",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGenerateMipmap",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glTexBuffer",
+    "glPrimitiveRestartIndex",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetActiveUniformName",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glDrawElementsBaseVertex",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex",
+    "glMultiDrawElementsBaseVertex",
+    "glProvokingVertex",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glFramebufferTexture",
+    "glTexImage2DMultisample",
+    "glTexImage3DMultisample",
+    "glGetMultisamplefv",
+    "glSampleMaski",
+    "glBindFragDataLocationIndexed",
+    "glGetFragDataIndex",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameterIuiv",
+    "glQueryCounter",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectui64v",
+    "glVertexAttribDivisor",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glVertexP2ui",
+    "glVertexP2uiv",
+    "glVertexP3ui",
+    "glVertexP3uiv",
+    "glVertexP4ui",
+    "glVertexP4uiv",
+    "glTexCoordP1ui",
+    "glTexCoordP1uiv",
+    "glTexCoordP2ui",
+    "glTexCoordP2uiv",
+    "glTexCoordP3ui",
+    "glTexCoordP3uiv",
+    "glTexCoordP4ui",
+    "glTexCoordP4uiv",
+    "glMultiTexCoordP1ui",
+    "glMultiTexCoordP1uiv",
+    "glMultiTexCoordP2ui",
+    "glMultiTexCoordP2uiv",
+    "glMultiTexCoordP3ui",
+    "glMultiTexCoordP3uiv",
+    "glMultiTexCoordP4ui",
+    "glMultiTexCoordP4uiv",
+    "glNormalP3ui",
+    "glNormalP3uiv",
+    "glColorP3ui",
+    "glColorP3uiv",
+    "glColorP4ui",
+    "glColorP4uiv",
+    "glSecondaryColorP3ui",
+    "glSecondaryColorP3uiv",
+    "glMinSampleShading",
+    "glBlendEquationi",
+    "glBlendEquationSeparatei",
+    "glBlendFunci",
+    "glBlendFuncSeparatei",
+    "glDrawArraysIndirect",
+    "glDrawElementsIndirect",
+    "glUniform1d",
+    "glUniform2d",
+    "glUniform3d",
+    "glUniform4d",
+    "glUniform1dv",
+    "glUniform2dv",
+    "glUniform3dv",
+    "glUniform4dv",
+    "glUniformMatrix2dv",
+    "glUniformMatrix3dv",
+    "glUniformMatrix4dv",
+    "glUniformMatrix2x3dv",
+    "glUniformMatrix2x4dv",
+    "glUniformMatrix3x2dv",
+    "glUniformMatrix3x4dv",
+    "glUniformMatrix4x2dv",
+    "glUniformMatrix4x3dv",
+    "glGetUniformdv",
+    "glGetSubroutineUniformLocation",
+    "glGetSubroutineIndex",
+    "glGetActiveSubroutineUniformiv",
+    "glGetActiveSubroutineUniformName",
+    "glGetActiveSubroutineName",
+    "glUniformSubroutinesuiv",
+    "glGetUniformSubroutineuiv",
+    "glGetProgramStageiv",
+    "glPatchParameteri",
+    "glPatchParameterfv",
+    "glBindTransformFeedback",
+    "glDeleteTransformFeedbacks",
+    "glGenTransformFeedbacks",
+    "glIsTransformFeedback",
+    "glPauseTransformFeedback",
+    "glResumeTransformFeedback",
+    "glDrawTransformFeedback",
+    "glDrawTransformFeedbackStream",
+    "glBeginQueryIndexed",
+    "glEndQueryIndexed",
+    "glGetQueryIndexediv",
+    "glReleaseShaderCompiler",
+    "glShaderBinary",
+    "glGetShaderPrecisionFormat",
+    "glDepthRangef",
+    "glClearDepthf",
+    "glGetProgramBinary",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glUseProgramStages",
+    "glActiveShaderProgram",
+    "glCreateShaderProgramv",
+    "glBindProgramPipeline",
+    "glDeleteProgramPipelines",
+    "glGenProgramPipelines",
+    "glIsProgramPipeline",
+    "glGetProgramPipelineiv",
+    "glProgramUniform1i",
+    "glProgramUniform1iv",
+    "glProgramUniform1f",
+    "glProgramUniform1fv",
+    "glProgramUniform1d",
+    "glProgramUniform1dv",
+    "glProgramUniform1ui",
+    "glProgramUniform1uiv",
+    "glProgramUniform2i",
+    "glProgramUniform2iv",
+    "glProgramUniform2f",
+    "glProgramUniform2fv",
+    "glProgramUniform2d",
+    "glProgramUniform2dv",
+    "glProgramUniform2ui",
+    "glProgramUniform2uiv",
+    "glProgramUniform3i",
+    "glProgramUniform3iv",
+    "glProgramUniform3f",
+    "glProgramUniform3fv",
+    "glProgramUniform3d",
+    "glProgramUniform3dv",
+    "glProgramUniform3ui",
+    "glProgramUniform3uiv",
+    "glProgramUniform4i",
+    "glProgramUniform4iv",
+    "glProgramUniform4f",
+    "glProgramUniform4fv",
+    "glProgramUniform4d",
+    "glProgramUniform4dv",
+    "glProgramUniform4ui",
+    "glProgramUniform4uiv",
+    "glProgramUniformMatrix2fv",
+    "glProgramUniformMatrix3fv",
+    "glProgramUniformMatrix4fv",
+    "glProgramUniformMatrix2dv",
+    "glProgramUniformMatrix3dv",
+    "glProgramUniformMatrix4dv",
+    "glProgramUniformMatrix2x3fv",
+    "glProgramUniformMatrix3x2fv",
+    "glProgramUniformMatrix2x4fv",
+    "glProgramUniformMatrix4x2fv",
+    "glProgramUniformMatrix3x4fv",
+    "glProgramUniformMatrix4x3fv",
+    "glProgramUniformMatrix2x3dv",
+    "glProgramUniformMatrix3x2dv",
+    "glProgramUniformMatrix2x4dv",
+    "glProgramUniformMatrix4x2dv",
+    "glProgramUniformMatrix3x4dv",
+    "glProgramUniformMatrix4x3dv",
+    "glValidateProgramPipeline",
+    "glGetProgramPipelineInfoLog",
+    "glVertexAttribL1d",
+    "glVertexAttribL2d",
+    "glVertexAttribL3d",
+    "glVertexAttribL4d",
+    "glVertexAttribL1dv",
+    "glVertexAttribL2dv",
+    "glVertexAttribL3dv",
+    "glVertexAttribL4dv",
+    "glVertexAttribLPointer",
+    "glGetVertexAttribLdv",
+    "glViewportArrayv",
+    "glViewportIndexedf",
+    "glViewportIndexedfv",
+    "glScissorArrayv",
+    "glScissorIndexed",
+    "glScissorIndexedv",
+    "glDepthRangeArrayv",
+    "glDepthRangeIndexed",
+    "glGetFloati_v",
+    "glGetDoublei_v",
+    "glDrawArraysInstancedBaseInstance",
+    "glDrawElementsInstancedBaseInstance",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glGetInternalformativ",
+    "glGetActiveAtomicCounterBufferiv",
+    "glBindImageTexture",
+    "glMemoryBarrier",
+    "glTexStorage1D",
+    "glTexStorage2D",
+    "glTexStorage3D",
+    "glDrawTransformFeedbackInstanced",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glClearBufferData",
+    "glClearBufferSubData",
+    "glDispatchCompute",
+    "glDispatchComputeIndirect",
+    "glCopyImageSubData",
+    "glFramebufferParameteri",
+    "glGetFramebufferParameteriv",
+    "glGetInternalformati64v",
+    "glInvalidateTexSubImage",
+    "glInvalidateTexImage",
+    "glInvalidateBufferSubData",
+    "glInvalidateBufferData",
+    "glInvalidateFramebuffer",
+    "glInvalidateSubFramebuffer",
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElementsIndirect",
+    "glGetProgramInterfaceiv",
+    "glGetProgramResourceIndex",
+    "glGetProgramResourceName",
+    "glGetProgramResourceiv",
+    "glGetProgramResourceLocation",
+    "glGetProgramResourceLocationIndex",
+    "glShaderStorageBlockBinding",
+    "glTexBufferRange",
+    "glTexStorage2DMultisample",
+    "glTexStorage3DMultisample",
+    "glTextureView",
+    "glBindVertexBuffer",
+    "glVertexAttribFormat",
+    "glVertexAttribIFormat",
+    "glVertexAttribLFormat",
+    "glVertexAttribBinding",
+    "glVertexBindingDivisor",
+    "glDebugMessageControl",
+    "glDebugMessageInsert",
+    "glDebugMessageCallback",
+    "glGetDebugMessageLog",
+    "glPushDebugGroup",
+    "glPopDebugGroup",
+    "glObjectLabel",
+    "glGetObjectLabel",
+    "glObjectPtrLabel",
+    "glGetObjectPtrLabel",
+    "glBufferStorage",
+    "glClearTexImage",
+    "glClearTexSubImage",
+    "glBindBuffersBase",
+    "glBindBuffersRange",
+    "glBindTextures",
+    "glBindSamplers",
+    "glBindImageTextures",
+    "glBindVertexBuffers",
+    "glClipControl",
+    "glCreateTransformFeedbacks",
+    "glTransformFeedbackBufferBase",
+    "glTransformFeedbackBufferRange",
+    "glGetTransformFeedbackiv",
+    "glGetTransformFeedbacki_v",
+    "glGetTransformFeedbacki64_v",
+    "glCreateBuffers",
+    "glNamedBufferStorage",
+    "glNamedBufferData",
+    "glNamedBufferSubData",
+    "glCopyNamedBufferSubData",
+    "glClearNamedBufferData",
+    "glClearNamedBufferSubData",
+    "glMapNamedBuffer",
+    "glMapNamedBufferRange",
+    "glUnmapNamedBuffer",
+    "glFlushMappedNamedBufferRange",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedBufferParameteri64v",
+    "glGetNamedBufferPointerv",
+    "glGetNamedBufferSubData",
+    "glCreateFramebuffers",
+    "glNamedFramebufferRenderbuffer",
+    "glNamedFramebufferParameteri",
+    "glNamedFramebufferTexture",
+    "glNamedFramebufferTextureLayer",
+    "glNamedFramebufferDrawBuffer",
+    "glNamedFramebufferDrawBuffers",
+    "glNamedFramebufferReadBuffer",
+    "glInvalidateNamedFramebufferData",
+    "glInvalidateNamedFramebufferSubData",
+    "glClearNamedFramebufferiv",
+    "glClearNamedFramebufferuiv",
+    "glClearNamedFramebufferfv",
+    "glClearNamedFramebufferfi",
+    "glBlitNamedFramebuffer",
+    "glCheckNamedFramebufferStatus",
+    "glGetNamedFramebufferParameteriv",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glCreateRenderbuffers",
+    "glNamedRenderbufferStorage",
+    "glNamedRenderbufferStorageMultisample",
+    "glGetNamedRenderbufferParameteriv",
+    "glCreateTextures",
+    "glTextureBuffer",
+    "glTextureBufferRange",
+    "glTextureStorage1D",
+    "glTextureStorage2D",
+    "glTextureStorage3D",
+    "glTextureStorage2DMultisample",
+    "glTextureStorage3DMultisample",
+    "glTextureSubImage1D",
+    "glTextureSubImage2D",
+    "glTextureSubImage3D",
+    "glCompressedTextureSubImage1D",
+    "glCompressedTextureSubImage2D",
+    "glCompressedTextureSubImage3D",
+    "glCopyTextureSubImage1D",
+    "glCopyTextureSubImage2D",
+    "glCopyTextureSubImage3D",
+    "glTextureParameterf",
+    "glTextureParameterfv",
+    "glTextureParameteri",
+    "glTextureParameterIiv",
+    "glTextureParameterIuiv",
+    "glTextureParameteriv",
+    "glGenerateTextureMipmap",
+    "glBindTextureUnit",
+    "glGetTextureImage",
+    "glGetCompressedTextureImage",
+    "glGetTextureLevelParameterfv",
+    "glGetTextureLevelParameteriv",
+    "glGetTextureParameterfv",
+    "glGetTextureParameterIiv",
+    "glGetTextureParameterIuiv",
+    "glGetTextureParameteriv",
+    "glCreateVertexArrays",
+    "glDisableVertexArrayAttrib",
+    "glEnableVertexArrayAttrib",
+    "glVertexArrayElementBuffer",
+    "glVertexArrayVertexBuffer",
+    "glVertexArrayVertexBuffers",
+    "glVertexArrayAttribBinding",
+    "glVertexArrayAttribFormat",
+    "glVertexArrayAttribIFormat",
+    "glVertexArrayAttribLFormat",
+    "glVertexArrayBindingDivisor",
+    "glGetVertexArrayiv",
+    "glGetVertexArrayIndexediv",
+    "glGetVertexArrayIndexed64iv",
+    "glCreateSamplers",
+    "glCreateProgramPipelines",
+    "glCreateQueries",
+    "glGetQueryBufferObjecti64v",
+    "glGetQueryBufferObjectiv",
+    "glGetQueryBufferObjectui64v",
+    "glGetQueryBufferObjectuiv",
+    "glMemoryBarrierByRegion",
+    "glGetTextureSubImage",
+    "glGetCompressedTextureSubImage",
+    "glGetGraphicsResetStatus",
+    "glGetnCompressedTexImage",
+    "glGetnTexImage",
+    "glGetnUniformdv",
+    "glGetnUniformfv",
+    "glGetnUniformiv",
+    "glGetnUniformuiv",
+    "glReadnPixels",
+    "glGetnMapdv",
+    "glGetnMapfv",
+    "glGetnMapiv",
+    "glGetnPixelMapfv",
+    "glGetnPixelMapuiv",
+    "glGetnPixelMapusv",
+    "glGetnPolygonStipple",
+    "glGetnColorTable",
+    "glGetnConvolutionFilter",
+    "glGetnSeparableFilter",
+    "glGetnHistogram",
+    "glGetnMinmax",
+    "glTextureBarrier",
+    "glSpecializeShader",
+    "glMultiDrawArraysIndirectCount",
+    "glMultiDrawElementsIndirectCount",
+    "glPolygonOffsetClamp",
+    "glMaxShaderCompilerThreadsKHR",
+};
+const int gl_replay_function_count = FUNCTION_COUNT;
+
+// -- Readers -- //
+static void replay_glCullFace(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glCullFace(mode);
+}
+
+static void replay_glFrontFace(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glFrontFace(mode);
+}
+
+static void replay_glHint(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glHint(target, mode);
+}
+
+static void replay_glLineWidth(GlReplay* replay) {
+    GLfloat width = (GLfloat)gl_replay_f32(replay);
+    glLineWidth(width);
+}
+
+static void replay_glPointSize(GlReplay* replay) {
+    GLfloat size = (GLfloat)gl_replay_f32(replay);
+    glPointSize(size);
+}
+
+static void replay_glPolygonMode(GlReplay* replay) {
+    GLenum face = (GLenum)gl_replay_u32(replay);
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glPolygonMode(face, mode);
+}
+
+static void replay_glScissor(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glScissor(x, y, width, height);
+}
+
+static void replay_glTexParameterf(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glTexParameterf(target, pname, param);
+}
+
+static void replay_glTexParameteri(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glTexParameteri(target, pname, param);
+}
+
+static void replay_glTexImage2D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint internalformat = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLint border = (GLint)gl_replay_u32(replay);
+    GLenum format = (GLenum)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* pixels = gl_replay_image(replay);
+    glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void replay_glDrawBuffer(GlReplay* replay) {
+    GLenum buf = (GLenum)gl_replay_u32(replay);
+    glDrawBuffer(buf);
+}
+
+static void replay_glClear(GlReplay* replay) {
+    GLbitfield mask = (GLbitfield)gl_replay_u32(replay);
+    glClear(mask);
+}
+
+static void replay_glClearColor(GlReplay* replay) {
+    GLfloat red = (GLfloat)gl_replay_f32(replay);
+    GLfloat green = (GLfloat)gl_replay_f32(replay);
+    GLfloat blue = (GLfloat)gl_replay_f32(replay);
+    GLfloat alpha = (GLfloat)gl_replay_f32(replay);
+    glClearColor(red, green, blue, alpha);
+}
+
+static void replay_glClearStencil(GlReplay* replay) {
+    GLint s = (GLint)gl_replay_u32(replay);
+    glClearStencil(s);
+}
+
+static void replay_glClearDepth(GlReplay* replay) {
+    GLdouble depth = (GLdouble)gl_replay_f64(replay);
+    glClearDepth(depth);
+}
+
+static void replay_glStencilMask(GlReplay* replay) {
+    GLuint mask = (GLuint)gl_replay_u32(replay);
+    glStencilMask(mask);
+}
+
+static void replay_glColorMask(GlReplay* replay) {
+    GLboolean red = (GLboolean)gl_replay_u32(replay);
+    GLboolean green = (GLboolean)gl_replay_u32(replay);
+    GLboolean blue = (GLboolean)gl_replay_u32(replay);
+    GLboolean alpha = (GLboolean)gl_replay_u32(replay);
+    glColorMask(red, green, blue, alpha);
+}
+
+static void replay_glDepthMask(GlReplay* replay) {
+    GLboolean flag = (GLboolean)gl_replay_u32(replay);
+    glDepthMask(flag);
+}
+
+static void replay_glDisable(GlReplay* replay) {
+    GLenum cap = (GLenum)gl_replay_u32(replay);
+    glDisable(cap);
+}
+
+static void replay_glEnable(GlReplay* replay) {
+    GLenum cap = (GLenum)gl_replay_u32(replay);
+    glEnable(cap);
+}
+
+static void replay_glFinish(GlReplay* replay) {
+    (void)replay;
+    glFinish();
+}
+
+static void replay_glFlush(GlReplay* replay) {
+    (void)replay;
+    glFlush();
+}
+
+static void replay_glBlendFunc(GlReplay* replay) {
+    GLenum sfactor = (GLenum)gl_replay_u32(replay);
+    GLenum dfactor = (GLenum)gl_replay_u32(replay);
+    glBlendFunc(sfactor, dfactor);
+}
+
+static void replay_glLogicOp(GlReplay* replay) {
+    GLenum opcode = (GLenum)gl_replay_u32(replay);
+    glLogicOp(opcode);
+}
+
+static void replay_glStencilFunc(GlReplay* replay) {
+    GLenum func = (GLenum)gl_replay_u32(replay);
+    GLint ref = (GLint)gl_replay_u32(replay);
+    GLuint mask = (GLuint)gl_replay_u32(replay);
+    glStencilFunc(func, ref, mask);
+}
+
+static void replay_glStencilOp(GlReplay* replay) {
+    GLenum fail = (GLenum)gl_replay_u32(replay);
+    GLenum zfail = (GLenum)gl_replay_u32(replay);
+    GLenum zpass = (GLenum)gl_replay_u32(replay);
+    glStencilOp(fail, zfail, zpass);
+}
+
+static void replay_glDepthFunc(GlReplay* replay) {
+    GLenum func = (GLenum)gl_replay_u32(replay);
+    glDepthFunc(func);
+}
+
+static void replay_glPixelStoref(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glPixelStoref(pname, param);
+}
+
+static void replay_glPixelStorei(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glPixelStorei(pname, param);
+}
+
+static void replay_glReadBuffer(GlReplay* replay) {
+    GLenum src = (GLenum)gl_replay_u32(replay);
+    glReadBuffer(src);
+}
+
+static void replay_glDepthRange(GlReplay* replay) {
+    GLdouble n = (GLdouble)gl_replay_f64(replay);
+    GLdouble f = (GLdouble)gl_replay_f64(replay);
+    glDepthRange(n, f);
+}
+
+static void replay_glViewport(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glViewport(x, y, width, height);
+}
+
+static void replay_glNewList(GlReplay* replay) {
+    GLuint list = (GLuint)gl_replay_u32(replay);
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glNewList(list, mode);
+}
+
+static void replay_glEndList(GlReplay* replay) {
+    (void)replay;
+    glEndList();
+}
+
+static void replay_glCallList(GlReplay* replay) {
+    GLuint list = (GLuint)gl_replay_u32(replay);
+    glCallList(list);
+}
+
+static void replay_glDeleteLists(GlReplay* replay) {
+    GLuint list = (GLuint)gl_replay_u32(replay);
+    GLsizei range = (GLsizei)gl_replay_u32(replay);
+    glDeleteLists(list, range);
+}
+
+static void replay_glGenLists(GlReplay* replay) {
+    GLsizei range = (GLsizei)gl_replay_u32(replay);
+    glGenLists(range);
+}
+
+static void replay_glListBase(GlReplay* replay) {
+    GLuint base = (GLuint)gl_replay_u32(replay);
+    glListBase(base);
+}
+
+static void replay_glBegin(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glBegin(mode);
+}
+
+static void replay_glColor3b(GlReplay* replay) {
+    GLbyte red = (GLbyte)gl_replay_u32(replay);
+    GLbyte green = (GLbyte)gl_replay_u32(replay);
+    GLbyte blue = (GLbyte)gl_replay_u32(replay);
+    glColor3b(red, green, blue);
+}
+
+static void replay_glColor3d(GlReplay* replay) {
+    GLdouble red = (GLdouble)gl_replay_f64(replay);
+    GLdouble green = (GLdouble)gl_replay_f64(replay);
+    GLdouble blue = (GLdouble)gl_replay_f64(replay);
+    glColor3d(red, green, blue);
+}
+
+static void replay_glColor3f(GlReplay* replay) {
+    GLfloat red = (GLfloat)gl_replay_f32(replay);
+    GLfloat green = (GLfloat)gl_replay_f32(replay);
+    GLfloat blue = (GLfloat)gl_replay_f32(replay);
+    glColor3f(red, green, blue);
+}
+
+static void replay_glColor3i(GlReplay* replay) {
+    GLint red = (GLint)gl_replay_u32(replay);
+    GLint green = (GLint)gl_replay_u32(replay);
+    GLint blue = (GLint)gl_replay_u32(replay);
+    glColor3i(red, green, blue);
+}
+
+static void replay_glColor3s(GlReplay* replay) {
+    GLshort red = (GLshort)gl_replay_u32(replay);
+    GLshort green = (GLshort)gl_replay_u32(replay);
+    GLshort blue = (GLshort)gl_replay_u32(replay);
+    glColor3s(red, green, blue);
+}
+
+static void replay_glColor3ub(GlReplay* replay) {
+    GLubyte red = (GLubyte)gl_replay_u32(replay);
+    GLubyte green = (GLubyte)gl_replay_u32(replay);
+    GLubyte blue = (GLubyte)gl_replay_u32(replay);
+    glColor3ub(red, green, blue);
+}
+
+static void replay_glColor3ui(GlReplay* replay) {
+    GLuint red = (GLuint)gl_replay_u32(replay);
+    GLuint green = (GLuint)gl_replay_u32(replay);
+    GLuint blue = (GLuint)gl_replay_u32(replay);
+    glColor3ui(red, green, blue);
+}
+
+static void replay_glColor3us(GlReplay* replay) {
+    GLushort red = (GLushort)gl_replay_u32(replay);
+    GLushort green = (GLushort)gl_replay_u32(replay);
+    GLushort blue = (GLushort)gl_replay_u32(replay);
+    glColor3us(red, green, blue);
+}
+
+static void replay_glColor4b(GlReplay* replay) {
+    GLbyte red = (GLbyte)gl_replay_u32(replay);
+    GLbyte green = (GLbyte)gl_replay_u32(replay);
+    GLbyte blue = (GLbyte)gl_replay_u32(replay);
+    GLbyte alpha = (GLbyte)gl_replay_u32(replay);
+    glColor4b(red, green, blue, alpha);
+}
+
+static void replay_glColor4d(GlReplay* replay) {
+    GLdouble red = (GLdouble)gl_replay_f64(replay);
+    GLdouble green = (GLdouble)gl_replay_f64(replay);
+    GLdouble blue = (GLdouble)gl_replay_f64(replay);
+    GLdouble alpha = (GLdouble)gl_replay_f64(replay);
+    glColor4d(red, green, blue, alpha);
+}
+
+static void replay_glColor4f(GlReplay* replay) {
+    GLfloat red = (GLfloat)gl_replay_f32(replay);
+    GLfloat green = (GLfloat)gl_replay_f32(replay);
+    GLfloat blue = (GLfloat)gl_replay_f32(replay);
+    GLfloat alpha = (GLfloat)gl_replay_f32(replay);
+    glColor4f(red, green, blue, alpha);
+}
+
+static void replay_glColor4i(GlReplay* replay) {
+    GLint red = (GLint)gl_replay_u32(replay);
+    GLint green = (GLint)gl_replay_u32(replay);
+    GLint blue = (GLint)gl_replay_u32(replay);
+    GLint alpha = (GLint)gl_replay_u32(replay);
+    glColor4i(red, green, blue, alpha);
+}
+
+static void replay_glColor4s(GlReplay* replay) {
+    GLshort red = (GLshort)gl_replay_u32(replay);
+    GLshort green = (GLshort)gl_replay_u32(replay);
+    GLshort blue = (GLshort)gl_replay_u32(replay);
+    GLshort alpha = (GLshort)gl_replay_u32(replay);
+    glColor4s(red, green, blue, alpha);
+}
+
+static void replay_glColor4ub(GlReplay* replay) {
+    GLubyte red = (GLubyte)gl_replay_u32(replay);
+    GLubyte green = (GLubyte)gl_replay_u32(replay);
+    GLubyte blue = (GLubyte)gl_replay_u32(replay);
+    GLubyte alpha = (GLubyte)gl_replay_u32(replay);
+    glColor4ub(red, green, blue, alpha);
+}
+
+static void replay_glColor4ui(GlReplay* replay) {
+    GLuint red = (GLuint)gl_replay_u32(replay);
+    GLuint green = (GLuint)gl_replay_u32(replay);
+    GLuint blue = (GLuint)gl_replay_u32(replay);
+    GLuint alpha = (GLuint)gl_replay_u32(replay);
+    glColor4ui(red, green, blue, alpha);
+}
+
+static void replay_glColor4us(GlReplay* replay) {
+    GLushort red = (GLushort)gl_replay_u32(replay);
+    GLushort green = (GLushort)gl_replay_u32(replay);
+    GLushort blue = (GLushort)gl_replay_u32(replay);
+    GLushort alpha = (GLushort)gl_replay_u32(replay);
+    glColor4us(red, green, blue, alpha);
+}
+
+static void replay_glEdgeFlag(GlReplay* replay) {
+    GLboolean flag = (GLboolean)gl_replay_u32(replay);
+    glEdgeFlag(flag);
+}
+
+static void replay_glEnd(GlReplay* replay) {
+    (void)replay;
+    glEnd();
+}
+
+static void replay_glIndexd(GlReplay* replay) {
+    GLdouble c = (GLdouble)gl_replay_f64(replay);
+    glIndexd(c);
+}
+
+static void replay_glIndexf(GlReplay* replay) {
+    GLfloat c = (GLfloat)gl_replay_f32(replay);
+    glIndexf(c);
+}
+
+static void replay_glIndexi(GlReplay* replay) {
+    GLint c = (GLint)gl_replay_u32(replay);
+    glIndexi(c);
+}
+
+static void replay_glIndexs(GlReplay* replay) {
+    GLshort c = (GLshort)gl_replay_u32(replay);
+    glIndexs(c);
+}
+
+static void replay_glNormal3b(GlReplay* replay) {
+    GLbyte nx = (GLbyte)gl_replay_u32(replay);
+    GLbyte ny = (GLbyte)gl_replay_u32(replay);
+    GLbyte nz = (GLbyte)gl_replay_u32(replay);
+    glNormal3b(nx, ny, nz);
+}
+
+static void replay_glNormal3d(GlReplay* replay) {
+    GLdouble nx = (GLdouble)gl_replay_f64(replay);
+    GLdouble ny = (GLdouble)gl_replay_f64(replay);
+    GLdouble nz = (GLdouble)gl_replay_f64(replay);
+    glNormal3d(nx, ny, nz);
+}
+
+static void replay_glNormal3f(GlReplay* replay) {
+    GLfloat nx = (GLfloat)gl_replay_f32(replay);
+    GLfloat ny = (GLfloat)gl_replay_f32(replay);
+    GLfloat nz = (GLfloat)gl_replay_f32(replay);
+    glNormal3f(nx, ny, nz);
+}
+
+static void replay_glNormal3i(GlReplay* replay) {
+    GLint nx = (GLint)gl_replay_u32(replay);
+    GLint ny = (GLint)gl_replay_u32(replay);
+    GLint nz = (GLint)gl_replay_u32(replay);
+    glNormal3i(nx, ny, nz);
+}
+
+static void replay_glNormal3s(GlReplay* replay) {
+    GLshort nx = (GLshort)gl_replay_u32(replay);
+    GLshort ny = (GLshort)gl_replay_u32(replay);
+    GLshort nz = (GLshort)gl_replay_u32(replay);
+    glNormal3s(nx, ny, nz);
+}
+
+static void replay_glRasterPos2d(GlReplay* replay) {
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    glRasterPos2d(x, y);
+}
+
+static void replay_glRasterPos2f(GlReplay* replay) {
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    glRasterPos2f(x, y);
+}
+
+static void replay_glRasterPos2i(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    glRasterPos2i(x, y);
+}
+
+static void replay_glRasterPos2s(GlReplay* replay) {
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    glRasterPos2s(x, y);
+}
+
+static void replay_glRasterPos3d(GlReplay* replay) {
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    glRasterPos3d(x, y, z);
+}
+
+static void replay_glRasterPos3f(GlReplay* replay) {
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat z = (GLfloat)gl_replay_f32(replay);
+    glRasterPos3f(x, y, z);
+}
+
+static void replay_glRasterPos3i(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLint z = (GLint)gl_replay_u32(replay);
+    glRasterPos3i(x, y, z);
+}
+
+static void replay_glRasterPos3s(GlReplay* replay) {
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    GLshort z = (GLshort)gl_replay_u32(replay);
+    glRasterPos3s(x, y, z);
+}
+
+static void replay_glRasterPos4d(GlReplay* replay) {
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    GLdouble w = (GLdouble)gl_replay_f64(replay);
+    glRasterPos4d(x, y, z, w);
+}
+
+static void replay_glRasterPos4f(GlReplay* replay) {
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat z = (GLfloat)gl_replay_f32(replay);
+    GLfloat w = (GLfloat)gl_replay_f32(replay);
+    glRasterPos4f(x, y, z, w);
+}
+
+static void replay_glRasterPos4i(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLint z = (GLint)gl_replay_u32(replay);
+    GLint w = (GLint)gl_replay_u32(replay);
+    glRasterPos4i(x, y, z, w);
+}
+
+static void replay_glRasterPos4s(GlReplay* replay) {
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    GLshort z = (GLshort)gl_replay_u32(replay);
+    GLshort w = (GLshort)gl_replay_u32(replay);
+    glRasterPos4s(x, y, z, w);
+}
+
+static void replay_glRectd(GlReplay* replay) {
+    GLdouble x1 = (GLdouble)gl_replay_f64(replay);
+    GLdouble y1 = (GLdouble)gl_replay_f64(replay);
+    GLdouble x2 = (GLdouble)gl_replay_f64(replay);
+    GLdouble y2 = (GLdouble)gl_replay_f64(replay);
+    glRectd(x1, y1, x2, y2);
+}
+
+static void replay_glRectf(GlReplay* replay) {
+    GLfloat x1 = (GLfloat)gl_replay_f32(replay);
+    GLfloat y1 = (GLfloat)gl_replay_f32(replay);
+    GLfloat x2 = (GLfloat)gl_replay_f32(replay);
+    GLfloat y2 = (GLfloat)gl_replay_f32(replay);
+    glRectf(x1, y1, x2, y2);
+}
+
+static void replay_glRecti(GlReplay* replay) {
+    GLint x1 = (GLint)gl_replay_u32(replay);
+    GLint y1 = (GLint)gl_replay_u32(replay);
+    GLint x2 = (GLint)gl_replay_u32(replay);
+    GLint y2 = (GLint)gl_replay_u32(replay);
+    glRecti(x1, y1, x2, y2);
+}
+
+static void replay_glRects(GlReplay* replay) {
+    GLshort x1 = (GLshort)gl_replay_u32(replay);
+    GLshort y1 = (GLshort)gl_replay_u32(replay);
+    GLshort x2 = (GLshort)gl_replay_u32(replay);
+    GLshort y2 = (GLshort)gl_replay_u32(replay);
+    glRects(x1, y1, x2, y2);
+}
+
+static void replay_glTexCoord1d(GlReplay* replay) {
+    GLdouble s = (GLdouble)gl_replay_f64(replay);
+    glTexCoord1d(s);
+}
+
+static void replay_glTexCoord1f(GlReplay* replay) {
+    GLfloat s = (GLfloat)gl_replay_f32(replay);
+    glTexCoord1f(s);
+}
+
+static void replay_glTexCoord1i(GlReplay* replay) {
+    GLint s = (GLint)gl_replay_u32(replay);
+    glTexCoord1i(s);
+}
+
+static void replay_glTexCoord1s(GlReplay* replay) {
+    GLshort s = (GLshort)gl_replay_u32(replay);
+    glTexCoord1s(s);
+}
+
+static void replay_glTexCoord2d(GlReplay* replay) {
+    GLdouble s = (GLdouble)gl_replay_f64(replay);
+    GLdouble t = (GLdouble)gl_replay_f64(replay);
+    glTexCoord2d(s, t);
+}
+
+static void replay_glTexCoord2f(GlReplay* replay) {
+    GLfloat s = (GLfloat)gl_replay_f32(replay);
+    GLfloat t = (GLfloat)gl_replay_f32(replay);
+    glTexCoord2f(s, t);
+}
+
+static void replay_glTexCoord2i(GlReplay* replay) {
+    GLint s = (GLint)gl_replay_u32(replay);
+    GLint t = (GLint)gl_replay_u32(replay);
+    glTexCoord2i(s, t);
+}
+
+static void replay_glTexCoord2s(GlReplay* replay) {
+    GLshort s = (GLshort)gl_replay_u32(replay);
+    GLshort t = (GLshort)gl_replay_u32(replay);
+    glTexCoord2s(s, t);
+}
+
+static void replay_glTexCoord3d(GlReplay* replay) {
+    GLdouble s = (GLdouble)gl_replay_f64(replay);
+    GLdouble t = (GLdouble)gl_replay_f64(replay);
+    GLdouble r = (GLdouble)gl_replay_f64(replay);
+    glTexCoord3d(s, t, r);
+}
+
+static void replay_glTexCoord3f(GlReplay* replay) {
+    GLfloat s = (GLfloat)gl_replay_f32(replay);
+    GLfloat t = (GLfloat)gl_replay_f32(replay);
+    GLfloat r = (GLfloat)gl_replay_f32(replay);
+    glTexCoord3f(s, t, r);
+}
+
+static void replay_glTexCoord3i(GlReplay* replay) {
+    GLint s = (GLint)gl_replay_u32(replay);
+    GLint t = (GLint)gl_replay_u32(replay);
+    GLint r = (GLint)gl_replay_u32(replay);
+    glTexCoord3i(s, t, r);
+}
+
+static void replay_glTexCoord3s(GlReplay* replay) {
+    GLshort s = (GLshort)gl_replay_u32(replay);
+    GLshort t = (GLshort)gl_replay_u32(replay);
+    GLshort r = (GLshort)gl_replay_u32(replay);
+    glTexCoord3s(s, t, r);
+}
+
+static void replay_glTexCoord4d(GlReplay* replay) {
+    GLdouble s = (GLdouble)gl_replay_f64(replay);
+    GLdouble t = (GLdouble)gl_replay_f64(replay);
+    GLdouble r = (GLdouble)gl_replay_f64(replay);
+    GLdouble q = (GLdouble)gl_replay_f64(replay);
+    glTexCoord4d(s, t, r, q);
+}
+
+static void replay_glTexCoord4f(GlReplay* replay) {
+    GLfloat s = (GLfloat)gl_replay_f32(replay);
+    GLfloat t = (GLfloat)gl_replay_f32(replay);
+    GLfloat r = (GLfloat)gl_replay_f32(replay);
+    GLfloat q = (GLfloat)gl_replay_f32(replay);
+    glTexCoord4f(s, t, r, q);
+}
+
+static void replay_glTexCoord4i(GlReplay* replay) {
+    GLint s = (GLint)gl_replay_u32(replay);
+    GLint t = (GLint)gl_replay_u32(replay);
+    GLint r = (GLint)gl_replay_u32(replay);
+    GLint q = (GLint)gl_replay_u32(replay);
+    glTexCoord4i(s, t, r, q);
+}
+
+static void replay_glTexCoord4s(GlReplay* replay) {
+    GLshort s = (GLshort)gl_replay_u32(replay);
+    GLshort t = (GLshort)gl_replay_u32(replay);
+    GLshort r = (GLshort)gl_replay_u32(replay);
+    GLshort q = (GLshort)gl_replay_u32(replay);
+    glTexCoord4s(s, t, r, q);
+}
+
+static void replay_glVertex2d(GlReplay* replay) {
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    glVertex2d(x, y);
+}
+
+static void replay_glVertex2f(GlReplay* replay) {
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    glVertex2f(x, y);
+}
+
+static void replay_glVertex2i(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    glVertex2i(x, y);
+}
+
+static void replay_glVertex2s(GlReplay* replay) {
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    glVertex2s(x, y);
+}
+
+static void replay_glVertex3d(GlReplay* replay) {
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    glVertex3d(x, y, z);
+}
+
+static void replay_glVertex3f(GlReplay* replay) {
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat z = (GLfloat)gl_replay_f32(replay);
+    glVertex3f(x, y, z);
+}
+
+static void replay_glVertex3i(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLint z = (GLint)gl_replay_u32(replay);
+    glVertex3i(x, y, z);
+}
+
+static void replay_glVertex3s(GlReplay* replay) {
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    GLshort z = (GLshort)gl_replay_u32(replay);
+    glVertex3s(x, y, z);
+}
+
+static void replay_glVertex4d(GlReplay* replay) {
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    GLdouble w = (GLdouble)gl_replay_f64(replay);
+    glVertex4d(x, y, z, w);
+}
+
+static void replay_glVertex4f(GlReplay* replay) {
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat z = (GLfloat)gl_replay_f32(replay);
+    GLfloat w = (GLfloat)gl_replay_f32(replay);
+    glVertex4f(x, y, z, w);
+}
+
+static void replay_glVertex4i(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLint z = (GLint)gl_replay_u32(replay);
+    GLint w = (GLint)gl_replay_u32(replay);
+    glVertex4i(x, y, z, w);
+}
+
+static void replay_glVertex4s(GlReplay* replay) {
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    GLshort z = (GLshort)gl_replay_u32(replay);
+    GLshort w = (GLshort)gl_replay_u32(replay);
+    glVertex4s(x, y, z, w);
+}
+
+static void replay_glColorMaterial(GlReplay* replay) {
+    GLenum face = (GLenum)gl_replay_u32(replay);
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glColorMaterial(face, mode);
+}
+
+static void replay_glFogf(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glFogf(pname, param);
+}
+
+static void replay_glFogi(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glFogi(pname, param);
+}
+
+static void replay_glLightf(GlReplay* replay) {
+    GLenum light = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glLightf(light, pname, param);
+}
+
+static void replay_glLighti(GlReplay* replay) {
+    GLenum light = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glLighti(light, pname, param);
+}
+
+static void replay_glLightModelf(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glLightModelf(pname, param);
+}
+
+static void replay_glLightModeli(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glLightModeli(pname, param);
+}
+
+static void replay_glLineStipple(GlReplay* replay) {
+    GLint factor = (GLint)gl_replay_u32(replay);
+    GLushort pattern = (GLushort)gl_replay_u32(replay);
+    glLineStipple(factor, pattern);
+}
+
+static void replay_glMaterialf(GlReplay* replay) {
+    GLenum face = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glMaterialf(face, pname, param);
+}
+
+static void replay_glMateriali(GlReplay* replay) {
+    GLenum face = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glMateriali(face, pname, param);
+}
+
+static void replay_glShadeModel(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glShadeModel(mode);
+}
+
+static void replay_glTexEnvf(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glTexEnvf(target, pname, param);
+}
+
+static void replay_glTexEnvi(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glTexEnvi(target, pname, param);
+}
+
+static void replay_glTexGend(GlReplay* replay) {
+    GLenum coord = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLdouble param = (GLdouble)gl_replay_f64(replay);
+    glTexGend(coord, pname, param);
+}
+
+static void replay_glTexGenf(GlReplay* replay) {
+    GLenum coord = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glTexGenf(coord, pname, param);
+}
+
+static void replay_glTexGeni(GlReplay* replay) {
+    GLenum coord = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glTexGeni(coord, pname, param);
+}
+
+static void replay_glRenderMode(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glRenderMode(mode);
+}
+
+static void replay_glInitNames(GlReplay* replay) {
+    (void)replay;
+    glInitNames();
+}
+
+static void replay_glLoadName(GlReplay* replay) {
+    GLuint name = (GLuint)gl_replay_u32(replay);
+    glLoadName(name);
+}
+
+static void replay_glPassThrough(GlReplay* replay) {
+    GLfloat token = (GLfloat)gl_replay_f32(replay);
+    glPassThrough(token);
+}
+
+static void replay_glPopName(GlReplay* replay) {
+    (void)replay;
+    glPopName();
+}
+
+static void replay_glPushName(GlReplay* replay) {
+    GLuint name = (GLuint)gl_replay_u32(replay);
+    glPushName(name);
+}
+
+static void replay_glClearAccum(GlReplay* replay) {
+    GLfloat red = (GLfloat)gl_replay_f32(replay);
+    GLfloat green = (GLfloat)gl_replay_f32(replay);
+    GLfloat blue = (GLfloat)gl_replay_f32(replay);
+    GLfloat alpha = (GLfloat)gl_replay_f32(replay);
+    glClearAccum(red, green, blue, alpha);
+}
+
+static void replay_glClearIndex(GlReplay* replay) {
+    GLfloat c = (GLfloat)gl_replay_f32(replay);
+    glClearIndex(c);
+}
+
+static void replay_glIndexMask(GlReplay* replay) {
+    GLuint mask = (GLuint)gl_replay_u32(replay);
+    glIndexMask(mask);
+}
+
+static void replay_glAccum(GlReplay* replay) {
+    GLenum op = (GLenum)gl_replay_u32(replay);
+    GLfloat value = (GLfloat)gl_replay_f32(replay);
+    glAccum(op, value);
+}
+
+static void replay_glPopAttrib(GlReplay* replay) {
+    (void)replay;
+    glPopAttrib();
+}
+
+static void replay_glPushAttrib(GlReplay* replay) {
+    GLbitfield mask = (GLbitfield)gl_replay_u32(replay);
+    glPushAttrib(mask);
+}
+
+static void replay_glMapGrid1d(GlReplay* replay) {
+    GLint un = (GLint)gl_replay_u32(replay);
+    GLdouble u1 = (GLdouble)gl_replay_f64(replay);
+    GLdouble u2 = (GLdouble)gl_replay_f64(replay);
+    glMapGrid1d(un, u1, u2);
+}
+
+static void replay_glMapGrid1f(GlReplay* replay) {
+    GLint un = (GLint)gl_replay_u32(replay);
+    GLfloat u1 = (GLfloat)gl_replay_f32(replay);
+    GLfloat u2 = (GLfloat)gl_replay_f32(replay);
+    glMapGrid1f(un, u1, u2);
+}
+
+static void replay_glMapGrid2d(GlReplay* replay) {
+    GLint un = (GLint)gl_replay_u32(replay);
+    GLdouble u1 = (GLdouble)gl_replay_f64(replay);
+    GLdouble u2 = (GLdouble)gl_replay_f64(replay);
+    GLint vn = (GLint)gl_replay_u32(replay);
+    GLdouble v1 = (GLdouble)gl_replay_f64(replay);
+    GLdouble v2 = (GLdouble)gl_replay_f64(replay);
+    glMapGrid2d(un, u1, u2, vn, v1, v2);
+}
+
+static void replay_glMapGrid2f(GlReplay* replay) {
+    GLint un = (GLint)gl_replay_u32(replay);
+    GLfloat u1 = (GLfloat)gl_replay_f32(replay);
+    GLfloat u2 = (GLfloat)gl_replay_f32(replay);
+    GLint vn = (GLint)gl_replay_u32(replay);
+    GLfloat v1 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v2 = (GLfloat)gl_replay_f32(replay);
+    glMapGrid2f(un, u1, u2, vn, v1, v2);
+}
+
+static void replay_glEvalCoord1d(GlReplay* replay) {
+    GLdouble u = (GLdouble)gl_replay_f64(replay);
+    glEvalCoord1d(u);
+}
+
+static void replay_glEvalCoord1f(GlReplay* replay) {
+    GLfloat u = (GLfloat)gl_replay_f32(replay);
+    glEvalCoord1f(u);
+}
+
+static void replay_glEvalCoord2d(GlReplay* replay) {
+    GLdouble u = (GLdouble)gl_replay_f64(replay);
+    GLdouble v = (GLdouble)gl_replay_f64(replay);
+    glEvalCoord2d(u, v);
+}
+
+static void replay_glEvalCoord2f(GlReplay* replay) {
+    GLfloat u = (GLfloat)gl_replay_f32(replay);
+    GLfloat v = (GLfloat)gl_replay_f32(replay);
+    glEvalCoord2f(u, v);
+}
+
+static void replay_glEvalMesh1(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLint i1 = (GLint)gl_replay_u32(replay);
+    GLint i2 = (GLint)gl_replay_u32(replay);
+    glEvalMesh1(mode, i1, i2);
+}
+
+static void replay_glEvalPoint1(GlReplay* replay) {
+    GLint i = (GLint)gl_replay_u32(replay);
+    glEvalPoint1(i);
+}
+
+static void replay_glEvalMesh2(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLint i1 = (GLint)gl_replay_u32(replay);
+    GLint i2 = (GLint)gl_replay_u32(replay);
+    GLint j1 = (GLint)gl_replay_u32(replay);
+    GLint j2 = (GLint)gl_replay_u32(replay);
+    glEvalMesh2(mode, i1, i2, j1, j2);
+}
+
+static void replay_glEvalPoint2(GlReplay* replay) {
+    GLint i = (GLint)gl_replay_u32(replay);
+    GLint j = (GLint)gl_replay_u32(replay);
+    glEvalPoint2(i, j);
+}
+
+static void replay_glAlphaFunc(GlReplay* replay) {
+    GLenum func = (GLenum)gl_replay_u32(replay);
+    GLfloat ref = (GLfloat)gl_replay_f32(replay);
+    glAlphaFunc(func, ref);
+}
+
+static void replay_glPixelZoom(GlReplay* replay) {
+    GLfloat xfactor = (GLfloat)gl_replay_f32(replay);
+    GLfloat yfactor = (GLfloat)gl_replay_f32(replay);
+    glPixelZoom(xfactor, yfactor);
+}
+
+static void replay_glPixelTransferf(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glPixelTransferf(pname, param);
+}
+
+static void replay_glPixelTransferi(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glPixelTransferi(pname, param);
+}
+
+static void replay_glCopyPixels(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    glCopyPixels(x, y, width, height, type);
+}
+
+static void replay_glFrustum(GlReplay* replay) {
+    GLdouble left = (GLdouble)gl_replay_f64(replay);
+    GLdouble right = (GLdouble)gl_replay_f64(replay);
+    GLdouble bottom = (GLdouble)gl_replay_f64(replay);
+    GLdouble top = (GLdouble)gl_replay_f64(replay);
+    GLdouble zNear = (GLdouble)gl_replay_f64(replay);
+    GLdouble zFar = (GLdouble)gl_replay_f64(replay);
+    glFrustum(left, right, bottom, top, zNear, zFar);
+}
+
+static void replay_glLoadIdentity(GlReplay* replay) {
+    (void)replay;
+    glLoadIdentity();
+}
+
+static void replay_glMatrixMode(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glMatrixMode(mode);
+}
+
+static void replay_glOrtho(GlReplay* replay) {
+    GLdouble left = (GLdouble)gl_replay_f64(replay);
+    GLdouble right = (GLdouble)gl_replay_f64(replay);
+    GLdouble bottom = (GLdouble)gl_replay_f64(replay);
+    GLdouble top = (GLdouble)gl_replay_f64(replay);
+    GLdouble zNear = (GLdouble)gl_replay_f64(replay);
+    GLdouble zFar = (GLdouble)gl_replay_f64(replay);
+    glOrtho(left, right, bottom, top, zNear, zFar);
+}
+
+static void replay_glPopMatrix(GlReplay* replay) {
+    (void)replay;
+    glPopMatrix();
+}
+
+static void replay_glPushMatrix(GlReplay* replay) {
+    (void)replay;
+    glPushMatrix();
+}
+
+static void replay_glRotated(GlReplay* replay) {
+    GLdouble angle = (GLdouble)gl_replay_f64(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    glRotated(angle, x, y, z);
+}
+
+static void replay_glRotatef(GlReplay* replay) {
+    GLfloat angle = (GLfloat)gl_replay_f32(replay);
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat z = (GLfloat)gl_replay_f32(replay);
+    glRotatef(angle, x, y, z);
+}
+
+static void replay_glScaled(GlReplay* replay) {
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    glScaled(x, y, z);
+}
+
+static void replay_glScalef(GlReplay* replay) {
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat z = (GLfloat)gl_replay_f32(replay);
+    glScalef(x, y, z);
+}
+
+static void replay_glTranslated(GlReplay* replay) {
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    glTranslated(x, y, z);
+}
+
+static void replay_glTranslatef(GlReplay* replay) {
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat z = (GLfloat)gl_replay_f32(replay);
+    glTranslatef(x, y, z);
+}
+
+static void replay_glDrawArrays(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLint first = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    glDrawArrays(mode, first, count);
+}
+
+static void replay_glDrawElements(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indices = (const void*)(uintptr_t)gl_replay_u64(replay);
+    glDrawElements(mode, count, type, indices);
+}
+
+static void replay_glPolygonOffset(GlReplay* replay) {
+    GLfloat factor = (GLfloat)gl_replay_f32(replay);
+    GLfloat units = (GLfloat)gl_replay_f32(replay);
+    glPolygonOffset(factor, units);
+}
+
+static void replay_glCopyTexImage1D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLint border = (GLint)gl_replay_u32(replay);
+    glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+
+static void replay_glCopyTexImage2D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLint border = (GLint)gl_replay_u32(replay);
+    glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+static void replay_glCopyTexSubImage1D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint xoffset = (GLint)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+
+static void replay_glCopyTexSubImage2D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint xoffset = (GLint)gl_replay_u32(replay);
+    GLint yoffset = (GLint)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void replay_glTexSubImage2D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint xoffset = (GLint)gl_replay_u32(replay);
+    GLint yoffset = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLenum format = (GLenum)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* pixels = gl_replay_image(replay);
+    glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void replay_glBindTexture(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    glBindTexture(target, texture);
+}
+
+static void replay_glDeleteTextures(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    const GLuint* textures = gl_replay_names(replay, GL_NAME_TEXTURE, n);
+    glDeleteTextures(n, textures);
+}
+
+static void replay_glGenTextures(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* textures = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!textures) {
+        return;
+    }
+    glGenTextures(n, textures);
+    gl_replay_created(replay, GL_NAME_TEXTURE, n, textures);
+}
+
+static void replay_glArrayElement(GlReplay* replay) {
+    GLint i = (GLint)gl_replay_u32(replay);
+    glArrayElement(i);
+}
+
+static void replay_glDisableClientState(GlReplay* replay) {
+    GLenum array = (GLenum)gl_replay_u32(replay);
+    glDisableClientState(array);
+}
+
+static void replay_glEnableClientState(GlReplay* replay) {
+    GLenum array = (GLenum)gl_replay_u32(replay);
+    glEnableClientState(array);
+}
+
+static void replay_glIndexub(GlReplay* replay) {
+    GLubyte c = (GLubyte)gl_replay_u32(replay);
+    glIndexub(c);
+}
+
+static void replay_glPopClientAttrib(GlReplay* replay) {
+    (void)replay;
+    glPopClientAttrib();
+}
+
+static void replay_glPushClientAttrib(GlReplay* replay) {
+    GLbitfield mask = (GLbitfield)gl_replay_u32(replay);
+    glPushClientAttrib(mask);
+}
+
+static void replay_glDrawRangeElements(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLuint start = (GLuint)gl_replay_u32(replay);
+    GLuint end = (GLuint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indices = (const void*)(uintptr_t)gl_replay_u64(replay);
+    glDrawRangeElements(mode, start, end, count, type, indices);
+}
+
+static void replay_glCopyTexSubImage3D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint xoffset = (GLint)gl_replay_u32(replay);
+    GLint yoffset = (GLint)gl_replay_u32(replay);
+    GLint zoffset = (GLint)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void replay_glActiveTexture(GlReplay* replay) {
+    GLenum texture = (GLenum)gl_replay_u32(replay);
+    glActiveTexture(texture);
+}
+
+static void replay_glSampleCoverage(GlReplay* replay) {
+    GLfloat value = (GLfloat)gl_replay_f32(replay);
+    GLboolean invert = (GLboolean)gl_replay_u32(replay);
+    glSampleCoverage(value, invert);
+}
+
+static void replay_glClientActiveTexture(GlReplay* replay) {
+    GLenum texture = (GLenum)gl_replay_u32(replay);
+    glClientActiveTexture(texture);
+}
+
+static void replay_glMultiTexCoord1d(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLdouble s = (GLdouble)gl_replay_f64(replay);
+    glMultiTexCoord1d(target, s);
+}
+
+static void replay_glMultiTexCoord1f(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLfloat s = (GLfloat)gl_replay_f32(replay);
+    glMultiTexCoord1f(target, s);
+}
+
+static void replay_glMultiTexCoord1i(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint s = (GLint)gl_replay_u32(replay);
+    glMultiTexCoord1i(target, s);
+}
+
+static void replay_glMultiTexCoord1s(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLshort s = (GLshort)gl_replay_u32(replay);
+    glMultiTexCoord1s(target, s);
+}
+
+static void replay_glMultiTexCoord2d(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLdouble s = (GLdouble)gl_replay_f64(replay);
+    GLdouble t = (GLdouble)gl_replay_f64(replay);
+    glMultiTexCoord2d(target, s, t);
+}
+
+static void replay_glMultiTexCoord2f(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLfloat s = (GLfloat)gl_replay_f32(replay);
+    GLfloat t = (GLfloat)gl_replay_f32(replay);
+    glMultiTexCoord2f(target, s, t);
+}
+
+static void replay_glMultiTexCoord2i(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint s = (GLint)gl_replay_u32(replay);
+    GLint t = (GLint)gl_replay_u32(replay);
+    glMultiTexCoord2i(target, s, t);
+}
+
+static void replay_glMultiTexCoord2s(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLshort s = (GLshort)gl_replay_u32(replay);
+    GLshort t = (GLshort)gl_replay_u32(replay);
+    glMultiTexCoord2s(target, s, t);
+}
+
+static void replay_glMultiTexCoord3d(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLdouble s = (GLdouble)gl_replay_f64(replay);
+    GLdouble t = (GLdouble)gl_replay_f64(replay);
+    GLdouble r = (GLdouble)gl_replay_f64(replay);
+    glMultiTexCoord3d(target, s, t, r);
+}
+
+static void replay_glMultiTexCoord3f(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLfloat s = (GLfloat)gl_replay_f32(replay);
+    GLfloat t = (GLfloat)gl_replay_f32(replay);
+    GLfloat r = (GLfloat)gl_replay_f32(replay);
+    glMultiTexCoord3f(target, s, t, r);
+}
+
+static void replay_glMultiTexCoord3i(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint s = (GLint)gl_replay_u32(replay);
+    GLint t = (GLint)gl_replay_u32(replay);
+    GLint r = (GLint)gl_replay_u32(replay);
+    glMultiTexCoord3i(target, s, t, r);
+}
+
+static void replay_glMultiTexCoord3s(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLshort s = (GLshort)gl_replay_u32(replay);
+    GLshort t = (GLshort)gl_replay_u32(replay);
+    GLshort r = (GLshort)gl_replay_u32(replay);
+    glMultiTexCoord3s(target, s, t, r);
+}
+
+static void replay_glMultiTexCoord4d(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLdouble s = (GLdouble)gl_replay_f64(replay);
+    GLdouble t = (GLdouble)gl_replay_f64(replay);
+    GLdouble r = (GLdouble)gl_replay_f64(replay);
+    GLdouble q = (GLdouble)gl_replay_f64(replay);
+    glMultiTexCoord4d(target, s, t, r, q);
+}
+
+static void replay_glMultiTexCoord4f(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLfloat s = (GLfloat)gl_replay_f32(replay);
+    GLfloat t = (GLfloat)gl_replay_f32(replay);
+    GLfloat r = (GLfloat)gl_replay_f32(replay);
+    GLfloat q = (GLfloat)gl_replay_f32(replay);
+    glMultiTexCoord4f(target, s, t, r, q);
+}
+
+static void replay_glMultiTexCoord4i(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLint s = (GLint)gl_replay_u32(replay);
+    GLint t = (GLint)gl_replay_u32(replay);
+    GLint r = (GLint)gl_replay_u32(replay);
+    GLint q = (GLint)gl_replay_u32(replay);
+    glMultiTexCoord4i(target, s, t, r, q);
+}
+
+static void replay_glMultiTexCoord4s(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLshort s = (GLshort)gl_replay_u32(replay);
+    GLshort t = (GLshort)gl_replay_u32(replay);
+    GLshort r = (GLshort)gl_replay_u32(replay);
+    GLshort q = (GLshort)gl_replay_u32(replay);
+    glMultiTexCoord4s(target, s, t, r, q);
+}
+
+static void replay_glBlendFuncSeparate(GlReplay* replay) {
+    GLenum sfactorRGB = (GLenum)gl_replay_u32(replay);
+    GLenum dfactorRGB = (GLenum)gl_replay_u32(replay);
+    GLenum sfactorAlpha = (GLenum)gl_replay_u32(replay);
+    GLenum dfactorAlpha = (GLenum)gl_replay_u32(replay);
+    glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void replay_glPointParameterf(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glPointParameterf(pname, param);
+}
+
+static void replay_glPointParameteri(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glPointParameteri(pname, param);
+}
+
+static void replay_glFogCoordf(GlReplay* replay) {
+    GLfloat coord = (GLfloat)gl_replay_f32(replay);
+    glFogCoordf(coord);
+}
+
+static void replay_glFogCoordd(GlReplay* replay) {
+    GLdouble coord = (GLdouble)gl_replay_f64(replay);
+    glFogCoordd(coord);
+}
+
+static void replay_glSecondaryColor3b(GlReplay* replay) {
+    GLbyte red = (GLbyte)gl_replay_u32(replay);
+    GLbyte green = (GLbyte)gl_replay_u32(replay);
+    GLbyte blue = (GLbyte)gl_replay_u32(replay);
+    glSecondaryColor3b(red, green, blue);
+}
+
+static void replay_glSecondaryColor3d(GlReplay* replay) {
+    GLdouble red = (GLdouble)gl_replay_f64(replay);
+    GLdouble green = (GLdouble)gl_replay_f64(replay);
+    GLdouble blue = (GLdouble)gl_replay_f64(replay);
+    glSecondaryColor3d(red, green, blue);
+}
+
+static void replay_glSecondaryColor3f(GlReplay* replay) {
+    GLfloat red = (GLfloat)gl_replay_f32(replay);
+    GLfloat green = (GLfloat)gl_replay_f32(replay);
+    GLfloat blue = (GLfloat)gl_replay_f32(replay);
+    glSecondaryColor3f(red, green, blue);
+}
+
+static void replay_glSecondaryColor3i(GlReplay* replay) {
+    GLint red = (GLint)gl_replay_u32(replay);
+    GLint green = (GLint)gl_replay_u32(replay);
+    GLint blue = (GLint)gl_replay_u32(replay);
+    glSecondaryColor3i(red, green, blue);
+}
+
+static void replay_glSecondaryColor3s(GlReplay* replay) {
+    GLshort red = (GLshort)gl_replay_u32(replay);
+    GLshort green = (GLshort)gl_replay_u32(replay);
+    GLshort blue = (GLshort)gl_replay_u32(replay);
+    glSecondaryColor3s(red, green, blue);
+}
+
+static void replay_glSecondaryColor3ub(GlReplay* replay) {
+    GLubyte red = (GLubyte)gl_replay_u32(replay);
+    GLubyte green = (GLubyte)gl_replay_u32(replay);
+    GLubyte blue = (GLubyte)gl_replay_u32(replay);
+    glSecondaryColor3ub(red, green, blue);
+}
+
+static void replay_glSecondaryColor3ui(GlReplay* replay) {
+    GLuint red = (GLuint)gl_replay_u32(replay);
+    GLuint green = (GLuint)gl_replay_u32(replay);
+    GLuint blue = (GLuint)gl_replay_u32(replay);
+    glSecondaryColor3ui(red, green, blue);
+}
+
+static void replay_glSecondaryColor3us(GlReplay* replay) {
+    GLushort red = (GLushort)gl_replay_u32(replay);
+    GLushort green = (GLushort)gl_replay_u32(replay);
+    GLushort blue = (GLushort)gl_replay_u32(replay);
+    glSecondaryColor3us(red, green, blue);
+}
+
+static void replay_glWindowPos2d(GlReplay* replay) {
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    glWindowPos2d(x, y);
+}
+
+static void replay_glWindowPos2f(GlReplay* replay) {
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    glWindowPos2f(x, y);
+}
+
+static void replay_glWindowPos2i(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    glWindowPos2i(x, y);
+}
+
+static void replay_glWindowPos2s(GlReplay* replay) {
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    glWindowPos2s(x, y);
+}
+
+static void replay_glWindowPos3d(GlReplay* replay) {
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    glWindowPos3d(x, y, z);
+}
+
+static void replay_glWindowPos3f(GlReplay* replay) {
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat z = (GLfloat)gl_replay_f32(replay);
+    glWindowPos3f(x, y, z);
+}
+
+static void replay_glWindowPos3i(GlReplay* replay) {
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLint z = (GLint)gl_replay_u32(replay);
+    glWindowPos3i(x, y, z);
+}
+
+static void replay_glWindowPos3s(GlReplay* replay) {
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    GLshort z = (GLshort)gl_replay_u32(replay);
+    glWindowPos3s(x, y, z);
+}
+
+static void replay_glBlendColor(GlReplay* replay) {
+    GLfloat red = (GLfloat)gl_replay_f32(replay);
+    GLfloat green = (GLfloat)gl_replay_f32(replay);
+    GLfloat blue = (GLfloat)gl_replay_f32(replay);
+    GLfloat alpha = (GLfloat)gl_replay_f32(replay);
+    glBlendColor(red, green, blue, alpha);
+}
+
+static void replay_glBlendEquation(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glBlendEquation(mode);
+}
+
+static void replay_glGenQueries(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* ids = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!ids) {
+        return;
+    }
+    glGenQueries(n, ids);
+    gl_replay_created(replay, GL_NAME_QUERY, n, ids);
+}
+
+static void replay_glDeleteQueries(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    const GLuint* ids = gl_replay_names(replay, GL_NAME_QUERY, n);
+    glDeleteQueries(n, ids);
+}
+
+static void replay_glBeginQuery(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint id = gl_replay_name(replay, GL_NAME_QUERY);
+    glBeginQuery(target, id);
+}
+
+static void replay_glEndQuery(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    glEndQuery(target);
+}
+
+static void replay_glBindBuffer(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    glBindBuffer(target, buffer);
+}
+
+static void replay_glDeleteBuffers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    const GLuint* buffers = gl_replay_names(replay, GL_NAME_BUFFER, n);
+    glDeleteBuffers(n, buffers);
+}
+
+static void replay_glGenBuffers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* buffers = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!buffers) {
+        return;
+    }
+    glGenBuffers(n, buffers);
+    gl_replay_created(replay, GL_NAME_BUFFER, n, buffers);
+}
+
+static void replay_glBufferData(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    const void* data = gl_replay_bytes(replay, NULL);
+    GLenum usage = (GLenum)gl_replay_u32(replay);
+    glBufferData(target, size, data, usage);
+}
+
+static void replay_glBufferSubData(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    const void* data = gl_replay_bytes(replay, NULL);
+    glBufferSubData(target, offset, size, data);
+}
+
+static void replay_glUnmapBuffer(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    gl_replay_mapped_contents(replay, target, 0);
+    glUnmapBuffer(target);
+    gl_replay_mapped(replay, target, NULL, 0);
+}
+
+static void replay_glBlendEquationSeparate(GlReplay* replay) {
+    GLenum modeRGB = (GLenum)gl_replay_u32(replay);
+    GLenum modeAlpha = (GLenum)gl_replay_u32(replay);
+    glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+static void replay_glDrawBuffers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    const GLenum* bufs = (const GLenum*)gl_replay_bytes(replay, NULL);
+    glDrawBuffers(n, bufs);
+}
+
+static void replay_glStencilOpSeparate(GlReplay* replay) {
+    GLenum face = (GLenum)gl_replay_u32(replay);
+    GLenum sfail = (GLenum)gl_replay_u32(replay);
+    GLenum dpfail = (GLenum)gl_replay_u32(replay);
+    GLenum dppass = (GLenum)gl_replay_u32(replay);
+    glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+static void replay_glStencilFuncSeparate(GlReplay* replay) {
+    GLenum face = (GLenum)gl_replay_u32(replay);
+    GLenum func = (GLenum)gl_replay_u32(replay);
+    GLint ref = (GLint)gl_replay_u32(replay);
+    GLuint mask = (GLuint)gl_replay_u32(replay);
+    glStencilFuncSeparate(face, func, ref, mask);
+}
+
+static void replay_glStencilMaskSeparate(GlReplay* replay) {
+    GLenum face = (GLenum)gl_replay_u32(replay);
+    GLuint mask = (GLuint)gl_replay_u32(replay);
+    glStencilMaskSeparate(face, mask);
+}
+
+static void replay_glAttachShader(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLuint shader = gl_replay_name(replay, GL_NAME_SHADER);
+    glAttachShader(program, shader);
+}
+
+static void replay_glBindAttribLocation(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    const GLchar* name = (const GLchar*)gl_replay_bytes(replay, NULL);
+    glBindAttribLocation(program, index, name);
+}
+
+static void replay_glCompileShader(GlReplay* replay) {
+    GLuint shader = gl_replay_name(replay, GL_NAME_SHADER);
+    glCompileShader(shader);
+}
+
+static void replay_glCreateProgram(GlReplay* replay) {
+    GLuint intercept_result = glCreateProgram();
+    gl_replay_created(replay, GL_NAME_PROGRAM, 1, &intercept_result);
+}
+
+static void replay_glCreateShader(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint intercept_result = glCreateShader(type);
+    gl_replay_created(replay, GL_NAME_SHADER, 1, &intercept_result);
+}
+
+static void replay_glDeleteProgram(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    glDeleteProgram(program);
+}
+
+static void replay_glDeleteShader(GlReplay* replay) {
+    GLuint shader = gl_replay_name(replay, GL_NAME_SHADER);
+    glDeleteShader(shader);
+}
+
+static void replay_glDetachShader(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLuint shader = gl_replay_name(replay, GL_NAME_SHADER);
+    glDetachShader(program, shader);
+}
+
+static void replay_glDisableVertexAttribArray(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    glDisableVertexAttribArray(index);
+}
+
+static void replay_glEnableVertexAttribArray(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    glEnableVertexAttribArray(index);
+}
+
+static void replay_glLinkProgram(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    glLinkProgram(program);
+}
+
+static void replay_glShaderSource(GlReplay* replay) {
+    GLuint shader = gl_replay_name(replay, GL_NAME_SHADER);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLint* length = NULL;
+    const GLchar* const* string = gl_replay_strings(replay, count, &length);
+    glShaderSource(shader, count, string, length);
+}
+
+static void replay_glUseProgram(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    glUseProgram(program);
+}
+
+static void replay_glUniform1f(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLfloat v0 = (GLfloat)gl_replay_f32(replay);
+    glUniform1f(location, v0);
+}
+
+static void replay_glUniform2f(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLfloat v0 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v1 = (GLfloat)gl_replay_f32(replay);
+    glUniform2f(location, v0, v1);
+}
+
+static void replay_glUniform3f(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLfloat v0 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v1 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v2 = (GLfloat)gl_replay_f32(replay);
+    glUniform3f(location, v0, v1, v2);
+}
+
+static void replay_glUniform4f(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLfloat v0 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v1 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v2 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v3 = (GLfloat)gl_replay_f32(replay);
+    glUniform4f(location, v0, v1, v2, v3);
+}
+
+static void replay_glUniform1i(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLint v0 = (GLint)gl_replay_u32(replay);
+    glUniform1i(location, v0);
+}
+
+static void replay_glUniform2i(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLint v0 = (GLint)gl_replay_u32(replay);
+    GLint v1 = (GLint)gl_replay_u32(replay);
+    glUniform2i(location, v0, v1);
+}
+
+static void replay_glUniform3i(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLint v0 = (GLint)gl_replay_u32(replay);
+    GLint v1 = (GLint)gl_replay_u32(replay);
+    GLint v2 = (GLint)gl_replay_u32(replay);
+    glUniform3i(location, v0, v1, v2);
+}
+
+static void replay_glUniform4i(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLint v0 = (GLint)gl_replay_u32(replay);
+    GLint v1 = (GLint)gl_replay_u32(replay);
+    GLint v2 = (GLint)gl_replay_u32(replay);
+    GLint v3 = (GLint)gl_replay_u32(replay);
+    glUniform4i(location, v0, v1, v2, v3);
+}
+
+static void replay_glUniform1fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniform1fv(location, count, value);
+}
+
+static void replay_glUniform2fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniform2fv(location, count, value);
+}
+
+static void replay_glUniform3fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniform3fv(location, count, value);
+}
+
+static void replay_glUniform4fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniform4fv(location, count, value);
+}
+
+static void replay_glUniform1iv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLint * value = (const GLint *)gl_replay_bytes(replay, NULL);
+    glUniform1iv(location, count, value);
+}
+
+static void replay_glUniform2iv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLint * value = (const GLint *)gl_replay_bytes(replay, NULL);
+    glUniform2iv(location, count, value);
+}
+
+static void replay_glUniform3iv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLint * value = (const GLint *)gl_replay_bytes(replay, NULL);
+    glUniform3iv(location, count, value);
+}
+
+static void replay_glUniform4iv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLint * value = (const GLint *)gl_replay_bytes(replay, NULL);
+    glUniform4iv(location, count, value);
+}
+
+static void replay_glUniformMatrix2fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix2fv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix3fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix3fv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix4fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix4fv(location, count, transpose, value);
+}
+
+static void replay_glValidateProgram(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    glValidateProgram(program);
+}
+
+static void replay_glVertexAttrib1d(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    glVertexAttrib1d(index, x);
+}
+
+static void replay_glVertexAttrib1f(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    glVertexAttrib1f(index, x);
+}
+
+static void replay_glVertexAttrib1s(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    glVertexAttrib1s(index, x);
+}
+
+static void replay_glVertexAttrib2d(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    glVertexAttrib2d(index, x, y);
+}
+
+static void replay_glVertexAttrib2f(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    glVertexAttrib2f(index, x, y);
+}
+
+static void replay_glVertexAttrib2s(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    glVertexAttrib2s(index, x, y);
+}
+
+static void replay_glVertexAttrib3d(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    glVertexAttrib3d(index, x, y, z);
+}
+
+static void replay_glVertexAttrib3f(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat z = (GLfloat)gl_replay_f32(replay);
+    glVertexAttrib3f(index, x, y, z);
+}
+
+static void replay_glVertexAttrib3s(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    GLshort z = (GLshort)gl_replay_u32(replay);
+    glVertexAttrib3s(index, x, y, z);
+}
+
+static void replay_glVertexAttrib4Nub(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLubyte x = (GLubyte)gl_replay_u32(replay);
+    GLubyte y = (GLubyte)gl_replay_u32(replay);
+    GLubyte z = (GLubyte)gl_replay_u32(replay);
+    GLubyte w = (GLubyte)gl_replay_u32(replay);
+    glVertexAttrib4Nub(index, x, y, z, w);
+}
+
+static void replay_glVertexAttrib4d(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    GLdouble w = (GLdouble)gl_replay_f64(replay);
+    glVertexAttrib4d(index, x, y, z, w);
+}
+
+static void replay_glVertexAttrib4f(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat z = (GLfloat)gl_replay_f32(replay);
+    GLfloat w = (GLfloat)gl_replay_f32(replay);
+    glVertexAttrib4f(index, x, y, z, w);
+}
+
+static void replay_glVertexAttrib4s(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLshort x = (GLshort)gl_replay_u32(replay);
+    GLshort y = (GLshort)gl_replay_u32(replay);
+    GLshort z = (GLshort)gl_replay_u32(replay);
+    GLshort w = (GLshort)gl_replay_u32(replay);
+    glVertexAttrib4s(index, x, y, z, w);
+}
+
+static void replay_glVertexAttribPointer(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLint size = (GLint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLboolean normalized = (GLboolean)gl_replay_u32(replay);
+    GLsizei stride = (GLsizei)gl_replay_u32(replay);
+    const void* pointer = (const void*)(uintptr_t)gl_replay_u64(replay);
+    glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static void replay_glUniformMatrix2x3fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix2x3fv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix3x2fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix3x2fv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix2x4fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix2x4fv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix4x2fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix4x2fv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix3x4fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix3x4fv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix4x3fv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix4x3fv(location, count, transpose, value);
+}
+
+static void replay_glColorMaski(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLboolean r = (GLboolean)gl_replay_u32(replay);
+    GLboolean g = (GLboolean)gl_replay_u32(replay);
+    GLboolean b = (GLboolean)gl_replay_u32(replay);
+    GLboolean a = (GLboolean)gl_replay_u32(replay);
+    glColorMaski(index, r, g, b, a);
+}
+
+static void replay_glEnablei(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    glEnablei(target, index);
+}
+
+static void replay_glDisablei(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    glDisablei(target, index);
+}
+
+static void replay_glBeginTransformFeedback(GlReplay* replay) {
+    GLenum primitiveMode = (GLenum)gl_replay_u32(replay);
+    glBeginTransformFeedback(primitiveMode);
+}
+
+static void replay_glEndTransformFeedback(GlReplay* replay) {
+    (void)replay;
+    glEndTransformFeedback();
+}
+
+static void replay_glBindBufferRange(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    glBindBufferRange(target, index, buffer, offset, size);
+}
+
+static void replay_glBindBufferBase(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    glBindBufferBase(target, index, buffer);
+}
+
+static void replay_glClampColor(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum clamp = (GLenum)gl_replay_u32(replay);
+    glClampColor(target, clamp);
+}
+
+static void replay_glBeginConditionalRender(GlReplay* replay) {
+    GLuint id = (GLuint)gl_replay_u32(replay);
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glBeginConditionalRender(id, mode);
+}
+
+static void replay_glEndConditionalRender(GlReplay* replay) {
+    (void)replay;
+    glEndConditionalRender();
+}
+
+static void replay_glVertexAttribIPointer(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLint size = (GLint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLsizei stride = (GLsizei)gl_replay_u32(replay);
+    const void* pointer = (const void*)(uintptr_t)gl_replay_u64(replay);
+    glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+static void replay_glVertexAttribI1i(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    glVertexAttribI1i(index, x);
+}
+
+static void replay_glVertexAttribI2i(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    glVertexAttribI2i(index, x, y);
+}
+
+static void replay_glVertexAttribI3i(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLint z = (GLint)gl_replay_u32(replay);
+    glVertexAttribI3i(index, x, y, z);
+}
+
+static void replay_glVertexAttribI4i(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLint z = (GLint)gl_replay_u32(replay);
+    GLint w = (GLint)gl_replay_u32(replay);
+    glVertexAttribI4i(index, x, y, z, w);
+}
+
+static void replay_glVertexAttribI1ui(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLuint x = (GLuint)gl_replay_u32(replay);
+    glVertexAttribI1ui(index, x);
+}
+
+static void replay_glVertexAttribI2ui(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLuint x = (GLuint)gl_replay_u32(replay);
+    GLuint y = (GLuint)gl_replay_u32(replay);
+    glVertexAttribI2ui(index, x, y);
+}
+
+static void replay_glVertexAttribI3ui(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLuint x = (GLuint)gl_replay_u32(replay);
+    GLuint y = (GLuint)gl_replay_u32(replay);
+    GLuint z = (GLuint)gl_replay_u32(replay);
+    glVertexAttribI3ui(index, x, y, z);
+}
+
+static void replay_glVertexAttribI4ui(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLuint x = (GLuint)gl_replay_u32(replay);
+    GLuint y = (GLuint)gl_replay_u32(replay);
+    GLuint z = (GLuint)gl_replay_u32(replay);
+    GLuint w = (GLuint)gl_replay_u32(replay);
+    glVertexAttribI4ui(index, x, y, z, w);
+}
+
+static void replay_glBindFragDataLocation(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLuint color = (GLuint)gl_replay_u32(replay);
+    const GLchar* name = (const GLchar*)gl_replay_bytes(replay, NULL);
+    glBindFragDataLocation(program, color, name);
+}
+
+static void replay_glUniform1ui(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLuint v0 = (GLuint)gl_replay_u32(replay);
+    glUniform1ui(location, v0);
+}
+
+static void replay_glUniform2ui(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLuint v0 = (GLuint)gl_replay_u32(replay);
+    GLuint v1 = (GLuint)gl_replay_u32(replay);
+    glUniform2ui(location, v0, v1);
+}
+
+static void replay_glUniform3ui(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLuint v0 = (GLuint)gl_replay_u32(replay);
+    GLuint v1 = (GLuint)gl_replay_u32(replay);
+    GLuint v2 = (GLuint)gl_replay_u32(replay);
+    glUniform3ui(location, v0, v1, v2);
+}
+
+static void replay_glUniform4ui(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLuint v0 = (GLuint)gl_replay_u32(replay);
+    GLuint v1 = (GLuint)gl_replay_u32(replay);
+    GLuint v2 = (GLuint)gl_replay_u32(replay);
+    GLuint v3 = (GLuint)gl_replay_u32(replay);
+    glUniform4ui(location, v0, v1, v2, v3);
+}
+
+static void replay_glUniform1uiv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLuint * value = (const GLuint *)gl_replay_bytes(replay, NULL);
+    glUniform1uiv(location, count, value);
+}
+
+static void replay_glUniform2uiv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLuint * value = (const GLuint *)gl_replay_bytes(replay, NULL);
+    glUniform2uiv(location, count, value);
+}
+
+static void replay_glUniform3uiv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLuint * value = (const GLuint *)gl_replay_bytes(replay, NULL);
+    glUniform3uiv(location, count, value);
+}
+
+static void replay_glUniform4uiv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLuint * value = (const GLuint *)gl_replay_bytes(replay, NULL);
+    glUniform4uiv(location, count, value);
+}
+
+static void replay_glClearBufferfi(GlReplay* replay) {
+    GLenum buffer = (GLenum)gl_replay_u32(replay);
+    GLint drawbuffer = (GLint)gl_replay_u32(replay);
+    GLfloat depth = (GLfloat)gl_replay_f32(replay);
+    GLint stencil = (GLint)gl_replay_u32(replay);
+    glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+static void replay_glBindRenderbuffer(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint renderbuffer = gl_replay_name(replay, GL_NAME_RENDERBUFFER);
+    glBindRenderbuffer(target, renderbuffer);
+}
+
+static void replay_glDeleteRenderbuffers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    const GLuint* renderbuffers = gl_replay_names(replay, GL_NAME_RENDERBUFFER, n);
+    glDeleteRenderbuffers(n, renderbuffers);
+}
+
+static void replay_glGenRenderbuffers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* renderbuffers = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!renderbuffers) {
+        return;
+    }
+    glGenRenderbuffers(n, renderbuffers);
+    gl_replay_created(replay, GL_NAME_RENDERBUFFER, n, renderbuffers);
+}
+
+static void replay_glRenderbufferStorage(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glRenderbufferStorage(target, internalformat, width, height);
+}
+
+static void replay_glBindFramebuffer(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint framebuffer = gl_replay_name(replay, GL_NAME_FRAMEBUFFER);
+    glBindFramebuffer(target, framebuffer);
+}
+
+static void replay_glDeleteFramebuffers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    const GLuint* framebuffers = gl_replay_names(replay, GL_NAME_FRAMEBUFFER, n);
+    glDeleteFramebuffers(n, framebuffers);
+}
+
+static void replay_glGenFramebuffers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* framebuffers = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!framebuffers) {
+        return;
+    }
+    glGenFramebuffers(n, framebuffers);
+    gl_replay_created(replay, GL_NAME_FRAMEBUFFER, n, framebuffers);
+}
+
+static void replay_glFramebufferTexture1D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum attachment = (GLenum)gl_replay_u32(replay);
+    GLenum textarget = (GLenum)gl_replay_u32(replay);
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+
+static void replay_glFramebufferTexture2D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum attachment = (GLenum)gl_replay_u32(replay);
+    GLenum textarget = (GLenum)gl_replay_u32(replay);
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+static void replay_glFramebufferTexture3D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum attachment = (GLenum)gl_replay_u32(replay);
+    GLenum textarget = (GLenum)gl_replay_u32(replay);
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint zoffset = (GLint)gl_replay_u32(replay);
+    glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+
+static void replay_glFramebufferRenderbuffer(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum attachment = (GLenum)gl_replay_u32(replay);
+    GLenum renderbuffertarget = (GLenum)gl_replay_u32(replay);
+    GLuint renderbuffer = gl_replay_name(replay, GL_NAME_RENDERBUFFER);
+    glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void replay_glGenerateMipmap(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    glGenerateMipmap(target);
+}
+
+static void replay_glBlitFramebuffer(GlReplay* replay) {
+    GLint srcX0 = (GLint)gl_replay_u32(replay);
+    GLint srcY0 = (GLint)gl_replay_u32(replay);
+    GLint srcX1 = (GLint)gl_replay_u32(replay);
+    GLint srcY1 = (GLint)gl_replay_u32(replay);
+    GLint dstX0 = (GLint)gl_replay_u32(replay);
+    GLint dstY0 = (GLint)gl_replay_u32(replay);
+    GLint dstX1 = (GLint)gl_replay_u32(replay);
+    GLint dstY1 = (GLint)gl_replay_u32(replay);
+    GLbitfield mask = (GLbitfield)gl_replay_u32(replay);
+    GLenum filter = (GLenum)gl_replay_u32(replay);
+    glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void replay_glRenderbufferStorageMultisample(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizei samples = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+static void replay_glFramebufferTextureLayer(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum attachment = (GLenum)gl_replay_u32(replay);
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint layer = (GLint)gl_replay_u32(replay);
+    glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+static void replay_glMapBufferRange(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr length = (GLsizeiptr)gl_replay_u64(replay);
+    GLbitfield access = (GLbitfield)gl_replay_u32(replay);
+    void * intercept_result = glMapBufferRange(target, offset, length, access);
+    gl_replay_mapped(replay, target, intercept_result, length);
+}
+
+static void replay_glFlushMappedBufferRange(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr length = (GLsizeiptr)gl_replay_u64(replay);
+    gl_replay_mapped_contents(replay, target, offset);
+    glFlushMappedBufferRange(target, offset, length);
+}
+
+static void replay_glBindVertexArray(GlReplay* replay) {
+    GLuint array = gl_replay_name(replay, GL_NAME_VERTEX_ARRAY);
+    glBindVertexArray(array);
+}
+
+static void replay_glDeleteVertexArrays(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    const GLuint* arrays = gl_replay_names(replay, GL_NAME_VERTEX_ARRAY, n);
+    glDeleteVertexArrays(n, arrays);
+}
+
+static void replay_glGenVertexArrays(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* arrays = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!arrays) {
+        return;
+    }
+    glGenVertexArrays(n, arrays);
+    gl_replay_created(replay, GL_NAME_VERTEX_ARRAY, n, arrays);
+}
+
+static void replay_glDrawArraysInstanced(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLint first = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLsizei instancecount = (GLsizei)gl_replay_u32(replay);
+    glDrawArraysInstanced(mode, first, count, instancecount);
+}
+
+static void replay_glDrawElementsInstanced(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indices = (const void*)(uintptr_t)gl_replay_u64(replay);
+    GLsizei instancecount = (GLsizei)gl_replay_u32(replay);
+    glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+static void replay_glTexBuffer(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    glTexBuffer(target, internalformat, buffer);
+}
+
+static void replay_glPrimitiveRestartIndex(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    glPrimitiveRestartIndex(index);
+}
+
+static void replay_glCopyBufferSubData(GlReplay* replay) {
+    GLenum readTarget = (GLenum)gl_replay_u32(replay);
+    GLenum writeTarget = (GLenum)gl_replay_u32(replay);
+    GLintptr readOffset = (GLintptr)gl_replay_u64(replay);
+    GLintptr writeOffset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static void replay_glUniformBlockBinding(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLuint uniformBlockIndex = (GLuint)gl_replay_u32(replay);
+    GLuint uniformBlockBinding = (GLuint)gl_replay_u32(replay);
+    glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+
+static void replay_glDrawElementsBaseVertex(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indices = (const void*)(uintptr_t)gl_replay_u64(replay);
+    GLint basevertex = (GLint)gl_replay_u32(replay);
+    glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+static void replay_glDrawRangeElementsBaseVertex(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLuint start = (GLuint)gl_replay_u32(replay);
+    GLuint end = (GLuint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indices = (const void*)(uintptr_t)gl_replay_u64(replay);
+    GLint basevertex = (GLint)gl_replay_u32(replay);
+    glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+
+static void replay_glDrawElementsInstancedBaseVertex(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indices = (const void*)(uintptr_t)gl_replay_u64(replay);
+    GLsizei instancecount = (GLsizei)gl_replay_u32(replay);
+    GLint basevertex = (GLint)gl_replay_u32(replay);
+    glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+
+static void replay_glProvokingVertex(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glProvokingVertex(mode);
+}
+
+static void replay_glFenceSync(GlReplay* replay) {
+    GLenum condition = (GLenum)gl_replay_u32(replay);
+    GLbitfield flags = (GLbitfield)gl_replay_u32(replay);
+    GLsync intercept_result = glFenceSync(condition, flags);
+    gl_replay_created_sync(replay, intercept_result);
+}
+
+static void replay_glDeleteSync(GlReplay* replay) {
+    GLsync sync = gl_replay_sync(replay);
+    glDeleteSync(sync);
+}
+
+static void replay_glClientWaitSync(GlReplay* replay) {
+    GLsync sync = gl_replay_sync(replay);
+    GLbitfield flags = (GLbitfield)gl_replay_u32(replay);
+    GLuint64 timeout = (GLuint64)gl_replay_u64(replay);
+    glClientWaitSync(sync, flags, timeout);
+}
+
+static void replay_glWaitSync(GlReplay* replay) {
+    GLsync sync = gl_replay_sync(replay);
+    GLbitfield flags = (GLbitfield)gl_replay_u32(replay);
+    GLuint64 timeout = (GLuint64)gl_replay_u64(replay);
+    glWaitSync(sync, flags, timeout);
+}
+
+static void replay_glFramebufferTexture(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum attachment = (GLenum)gl_replay_u32(replay);
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    glFramebufferTexture(target, attachment, texture, level);
+}
+
+static void replay_glTexImage2DMultisample(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizei samples = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLboolean fixedsamplelocations = (GLboolean)gl_replay_u32(replay);
+    glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void replay_glTexImage3DMultisample(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizei samples = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLsizei depth = (GLsizei)gl_replay_u32(replay);
+    GLboolean fixedsamplelocations = (GLboolean)gl_replay_u32(replay);
+    glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void replay_glSampleMaski(GlReplay* replay) {
+    GLuint maskNumber = (GLuint)gl_replay_u32(replay);
+    GLbitfield mask = (GLbitfield)gl_replay_u32(replay);
+    glSampleMaski(maskNumber, mask);
+}
+
+static void replay_glBindFragDataLocationIndexed(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLuint colorNumber = (GLuint)gl_replay_u32(replay);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    const GLchar* name = (const GLchar*)gl_replay_bytes(replay, NULL);
+    glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+
+static void replay_glBindSampler(GlReplay* replay) {
+    GLuint unit = (GLuint)gl_replay_u32(replay);
+    GLuint sampler = gl_replay_name(replay, GL_NAME_SAMPLER);
+    glBindSampler(unit, sampler);
+}
+
+static void replay_glSamplerParameteri(GlReplay* replay) {
+    GLuint sampler = gl_replay_name(replay, GL_NAME_SAMPLER);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glSamplerParameteri(sampler, pname, param);
+}
+
+static void replay_glSamplerParameterf(GlReplay* replay) {
+    GLuint sampler = gl_replay_name(replay, GL_NAME_SAMPLER);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glSamplerParameterf(sampler, pname, param);
+}
+
+static void replay_glQueryCounter(GlReplay* replay) {
+    GLuint id = gl_replay_name(replay, GL_NAME_QUERY);
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    glQueryCounter(id, target);
+}
+
+static void replay_glVertexAttribDivisor(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLuint divisor = (GLuint)gl_replay_u32(replay);
+    glVertexAttribDivisor(index, divisor);
+}
+
+static void replay_glVertexAttribP1ui(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLboolean normalized = (GLboolean)gl_replay_u32(replay);
+    GLuint value = (GLuint)gl_replay_u32(replay);
+    glVertexAttribP1ui(index, type, normalized, value);
+}
+
+static void replay_glVertexAttribP2ui(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLboolean normalized = (GLboolean)gl_replay_u32(replay);
+    GLuint value = (GLuint)gl_replay_u32(replay);
+    glVertexAttribP2ui(index, type, normalized, value);
+}
+
+static void replay_glVertexAttribP3ui(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLboolean normalized = (GLboolean)gl_replay_u32(replay);
+    GLuint value = (GLuint)gl_replay_u32(replay);
+    glVertexAttribP3ui(index, type, normalized, value);
+}
+
+static void replay_glVertexAttribP4ui(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLboolean normalized = (GLboolean)gl_replay_u32(replay);
+    GLuint value = (GLuint)gl_replay_u32(replay);
+    glVertexAttribP4ui(index, type, normalized, value);
+}
+
+static void replay_glVertexP2ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint value = (GLuint)gl_replay_u32(replay);
+    glVertexP2ui(type, value);
+}
+
+static void replay_glVertexP3ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint value = (GLuint)gl_replay_u32(replay);
+    glVertexP3ui(type, value);
+}
+
+static void replay_glVertexP4ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint value = (GLuint)gl_replay_u32(replay);
+    glVertexP4ui(type, value);
+}
+
+static void replay_glTexCoordP1ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint coords = (GLuint)gl_replay_u32(replay);
+    glTexCoordP1ui(type, coords);
+}
+
+static void replay_glTexCoordP2ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint coords = (GLuint)gl_replay_u32(replay);
+    glTexCoordP2ui(type, coords);
+}
+
+static void replay_glTexCoordP3ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint coords = (GLuint)gl_replay_u32(replay);
+    glTexCoordP3ui(type, coords);
+}
+
+static void replay_glTexCoordP4ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint coords = (GLuint)gl_replay_u32(replay);
+    glTexCoordP4ui(type, coords);
+}
+
+static void replay_glMultiTexCoordP1ui(GlReplay* replay) {
+    GLenum texture = (GLenum)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint coords = (GLuint)gl_replay_u32(replay);
+    glMultiTexCoordP1ui(texture, type, coords);
+}
+
+static void replay_glMultiTexCoordP2ui(GlReplay* replay) {
+    GLenum texture = (GLenum)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint coords = (GLuint)gl_replay_u32(replay);
+    glMultiTexCoordP2ui(texture, type, coords);
+}
+
+static void replay_glMultiTexCoordP3ui(GlReplay* replay) {
+    GLenum texture = (GLenum)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint coords = (GLuint)gl_replay_u32(replay);
+    glMultiTexCoordP3ui(texture, type, coords);
+}
+
+static void replay_glMultiTexCoordP4ui(GlReplay* replay) {
+    GLenum texture = (GLenum)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint coords = (GLuint)gl_replay_u32(replay);
+    glMultiTexCoordP4ui(texture, type, coords);
+}
+
+static void replay_glNormalP3ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint coords = (GLuint)gl_replay_u32(replay);
+    glNormalP3ui(type, coords);
+}
+
+static void replay_glColorP3ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint color = (GLuint)gl_replay_u32(replay);
+    glColorP3ui(type, color);
+}
+
+static void replay_glColorP4ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint color = (GLuint)gl_replay_u32(replay);
+    glColorP4ui(type, color);
+}
+
+static void replay_glSecondaryColorP3ui(GlReplay* replay) {
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint color = (GLuint)gl_replay_u32(replay);
+    glSecondaryColorP3ui(type, color);
+}
+
+static void replay_glMinSampleShading(GlReplay* replay) {
+    GLfloat value = (GLfloat)gl_replay_f32(replay);
+    glMinSampleShading(value);
+}
+
+static void replay_glBlendEquationi(GlReplay* replay) {
+    GLuint buf = (GLuint)gl_replay_u32(replay);
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    glBlendEquationi(buf, mode);
+}
+
+static void replay_glBlendEquationSeparatei(GlReplay* replay) {
+    GLuint buf = (GLuint)gl_replay_u32(replay);
+    GLenum modeRGB = (GLenum)gl_replay_u32(replay);
+    GLenum modeAlpha = (GLenum)gl_replay_u32(replay);
+    glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+
+static void replay_glBlendFunci(GlReplay* replay) {
+    GLuint buf = (GLuint)gl_replay_u32(replay);
+    GLenum src = (GLenum)gl_replay_u32(replay);
+    GLenum dst = (GLenum)gl_replay_u32(replay);
+    glBlendFunci(buf, src, dst);
+}
+
+static void replay_glBlendFuncSeparatei(GlReplay* replay) {
+    GLuint buf = (GLuint)gl_replay_u32(replay);
+    GLenum srcRGB = (GLenum)gl_replay_u32(replay);
+    GLenum dstRGB = (GLenum)gl_replay_u32(replay);
+    GLenum srcAlpha = (GLenum)gl_replay_u32(replay);
+    GLenum dstAlpha = (GLenum)gl_replay_u32(replay);
+    glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void replay_glDrawArraysIndirect(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    const void* indirect = (const void*)(uintptr_t)gl_replay_u64(replay);
+    glDrawArraysIndirect(mode, indirect);
+}
+
+static void replay_glDrawElementsIndirect(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indirect = (const void*)(uintptr_t)gl_replay_u64(replay);
+    glDrawElementsIndirect(mode, type, indirect);
+}
+
+static void replay_glUniform1d(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    glUniform1d(location, x);
+}
+
+static void replay_glUniform2d(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    glUniform2d(location, x, y);
+}
+
+static void replay_glUniform3d(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    glUniform3d(location, x, y, z);
+}
+
+static void replay_glUniform4d(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    GLdouble w = (GLdouble)gl_replay_f64(replay);
+    glUniform4d(location, x, y, z, w);
+}
+
+static void replay_glUniform1dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniform1dv(location, count, value);
+}
+
+static void replay_glUniform2dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniform2dv(location, count, value);
+}
+
+static void replay_glUniform3dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniform3dv(location, count, value);
+}
+
+static void replay_glUniform4dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniform4dv(location, count, value);
+}
+
+static void replay_glUniformMatrix2dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix2dv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix3dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix3dv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix4dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix4dv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix2x3dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix2x3dv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix2x4dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix2x4dv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix3x2dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix3x2dv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix3x4dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix3x4dv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix4x2dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix4x2dv(location, count, transpose, value);
+}
+
+static void replay_glUniformMatrix4x3dv(GlReplay* replay) {
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glUniformMatrix4x3dv(location, count, transpose, value);
+}
+
+static void replay_glPatchParameteri(GlReplay* replay) {
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint value = (GLint)gl_replay_u32(replay);
+    glPatchParameteri(pname, value);
+}
+
+static void replay_glBindTransformFeedback(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint id = (GLuint)gl_replay_u32(replay);
+    glBindTransformFeedback(target, id);
+}
+
+static void replay_glPauseTransformFeedback(GlReplay* replay) {
+    (void)replay;
+    glPauseTransformFeedback();
+}
+
+static void replay_glResumeTransformFeedback(GlReplay* replay) {
+    (void)replay;
+    glResumeTransformFeedback();
+}
+
+static void replay_glDrawTransformFeedback(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLuint id = (GLuint)gl_replay_u32(replay);
+    glDrawTransformFeedback(mode, id);
+}
+
+static void replay_glDrawTransformFeedbackStream(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLuint id = (GLuint)gl_replay_u32(replay);
+    GLuint stream = (GLuint)gl_replay_u32(replay);
+    glDrawTransformFeedbackStream(mode, id, stream);
+}
+
+static void replay_glBeginQueryIndexed(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLuint id = gl_replay_name(replay, GL_NAME_QUERY);
+    glBeginQueryIndexed(target, index, id);
+}
+
+static void replay_glEndQueryIndexed(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    glEndQueryIndexed(target, index);
+}
+
+static void replay_glReleaseShaderCompiler(GlReplay* replay) {
+    (void)replay;
+    glReleaseShaderCompiler();
+}
+
+static void replay_glDepthRangef(GlReplay* replay) {
+    GLfloat n = (GLfloat)gl_replay_f32(replay);
+    GLfloat f = (GLfloat)gl_replay_f32(replay);
+    glDepthRangef(n, f);
+}
+
+static void replay_glClearDepthf(GlReplay* replay) {
+    GLfloat d = (GLfloat)gl_replay_f32(replay);
+    glClearDepthf(d);
+}
+
+static void replay_glProgramBinary(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLenum binaryFormat = (GLenum)gl_replay_u32(replay);
+    const void* binary = gl_replay_bytes(replay, NULL);
+    GLsizei length = (GLsizei)gl_replay_u32(replay);
+    glProgramBinary(program, binaryFormat, binary, length);
+}
+
+static void replay_glProgramParameteri(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint value = (GLint)gl_replay_u32(replay);
+    glProgramParameteri(program, pname, value);
+}
+
+static void replay_glUseProgramStages(GlReplay* replay) {
+    GLuint pipeline = gl_replay_name(replay, GL_NAME_PIPELINE);
+    GLbitfield stages = (GLbitfield)gl_replay_u32(replay);
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    glUseProgramStages(pipeline, stages, program);
+}
+
+static void replay_glActiveShaderProgram(GlReplay* replay) {
+    GLuint pipeline = gl_replay_name(replay, GL_NAME_PIPELINE);
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    glActiveShaderProgram(pipeline, program);
+}
+
+static void replay_glBindProgramPipeline(GlReplay* replay) {
+    GLuint pipeline = gl_replay_name(replay, GL_NAME_PIPELINE);
+    glBindProgramPipeline(pipeline);
+}
+
+static void replay_glDeleteProgramPipelines(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    const GLuint* pipelines = gl_replay_names(replay, GL_NAME_PIPELINE, n);
+    glDeleteProgramPipelines(n, pipelines);
+}
+
+static void replay_glGenProgramPipelines(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* pipelines = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!pipelines) {
+        return;
+    }
+    glGenProgramPipelines(n, pipelines);
+    gl_replay_created(replay, GL_NAME_PIPELINE, n, pipelines);
+}
+
+static void replay_glProgramUniform1i(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLint v0 = (GLint)gl_replay_u32(replay);
+    glProgramUniform1i(program, location, v0);
+}
+
+static void replay_glProgramUniform1iv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLint * value = (const GLint *)gl_replay_bytes(replay, NULL);
+    glProgramUniform1iv(program, location, count, value);
+}
+
+static void replay_glProgramUniform1f(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLfloat v0 = (GLfloat)gl_replay_f32(replay);
+    glProgramUniform1f(program, location, v0);
+}
+
+static void replay_glProgramUniform1fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniform1fv(program, location, count, value);
+}
+
+static void replay_glProgramUniform1d(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLdouble v0 = (GLdouble)gl_replay_f64(replay);
+    glProgramUniform1d(program, location, v0);
+}
+
+static void replay_glProgramUniform1dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniform1dv(program, location, count, value);
+}
+
+static void replay_glProgramUniform1ui(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLuint v0 = (GLuint)gl_replay_u32(replay);
+    glProgramUniform1ui(program, location, v0);
+}
+
+static void replay_glProgramUniform1uiv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLuint * value = (const GLuint *)gl_replay_bytes(replay, NULL);
+    glProgramUniform1uiv(program, location, count, value);
+}
+
+static void replay_glProgramUniform2i(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLint v0 = (GLint)gl_replay_u32(replay);
+    GLint v1 = (GLint)gl_replay_u32(replay);
+    glProgramUniform2i(program, location, v0, v1);
+}
+
+static void replay_glProgramUniform2iv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLint * value = (const GLint *)gl_replay_bytes(replay, NULL);
+    glProgramUniform2iv(program, location, count, value);
+}
+
+static void replay_glProgramUniform2f(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLfloat v0 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v1 = (GLfloat)gl_replay_f32(replay);
+    glProgramUniform2f(program, location, v0, v1);
+}
+
+static void replay_glProgramUniform2fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniform2fv(program, location, count, value);
+}
+
+static void replay_glProgramUniform2d(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLdouble v0 = (GLdouble)gl_replay_f64(replay);
+    GLdouble v1 = (GLdouble)gl_replay_f64(replay);
+    glProgramUniform2d(program, location, v0, v1);
+}
+
+static void replay_glProgramUniform2dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniform2dv(program, location, count, value);
+}
+
+static void replay_glProgramUniform2ui(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLuint v0 = (GLuint)gl_replay_u32(replay);
+    GLuint v1 = (GLuint)gl_replay_u32(replay);
+    glProgramUniform2ui(program, location, v0, v1);
+}
+
+static void replay_glProgramUniform2uiv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLuint * value = (const GLuint *)gl_replay_bytes(replay, NULL);
+    glProgramUniform2uiv(program, location, count, value);
+}
+
+static void replay_glProgramUniform3i(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLint v0 = (GLint)gl_replay_u32(replay);
+    GLint v1 = (GLint)gl_replay_u32(replay);
+    GLint v2 = (GLint)gl_replay_u32(replay);
+    glProgramUniform3i(program, location, v0, v1, v2);
+}
+
+static void replay_glProgramUniform3iv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLint * value = (const GLint *)gl_replay_bytes(replay, NULL);
+    glProgramUniform3iv(program, location, count, value);
+}
+
+static void replay_glProgramUniform3f(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLfloat v0 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v1 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v2 = (GLfloat)gl_replay_f32(replay);
+    glProgramUniform3f(program, location, v0, v1, v2);
+}
+
+static void replay_glProgramUniform3fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniform3fv(program, location, count, value);
+}
+
+static void replay_glProgramUniform3d(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLdouble v0 = (GLdouble)gl_replay_f64(replay);
+    GLdouble v1 = (GLdouble)gl_replay_f64(replay);
+    GLdouble v2 = (GLdouble)gl_replay_f64(replay);
+    glProgramUniform3d(program, location, v0, v1, v2);
+}
+
+static void replay_glProgramUniform3dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniform3dv(program, location, count, value);
+}
+
+static void replay_glProgramUniform3ui(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLuint v0 = (GLuint)gl_replay_u32(replay);
+    GLuint v1 = (GLuint)gl_replay_u32(replay);
+    GLuint v2 = (GLuint)gl_replay_u32(replay);
+    glProgramUniform3ui(program, location, v0, v1, v2);
+}
+
+static void replay_glProgramUniform3uiv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLuint * value = (const GLuint *)gl_replay_bytes(replay, NULL);
+    glProgramUniform3uiv(program, location, count, value);
+}
+
+static void replay_glProgramUniform4i(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLint v0 = (GLint)gl_replay_u32(replay);
+    GLint v1 = (GLint)gl_replay_u32(replay);
+    GLint v2 = (GLint)gl_replay_u32(replay);
+    GLint v3 = (GLint)gl_replay_u32(replay);
+    glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+
+static void replay_glProgramUniform4iv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLint * value = (const GLint *)gl_replay_bytes(replay, NULL);
+    glProgramUniform4iv(program, location, count, value);
+}
+
+static void replay_glProgramUniform4f(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLfloat v0 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v1 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v2 = (GLfloat)gl_replay_f32(replay);
+    GLfloat v3 = (GLfloat)gl_replay_f32(replay);
+    glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+
+static void replay_glProgramUniform4fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniform4fv(program, location, count, value);
+}
+
+static void replay_glProgramUniform4d(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLdouble v0 = (GLdouble)gl_replay_f64(replay);
+    GLdouble v1 = (GLdouble)gl_replay_f64(replay);
+    GLdouble v2 = (GLdouble)gl_replay_f64(replay);
+    GLdouble v3 = (GLdouble)gl_replay_f64(replay);
+    glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+
+static void replay_glProgramUniform4dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniform4dv(program, location, count, value);
+}
+
+static void replay_glProgramUniform4ui(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLuint v0 = (GLuint)gl_replay_u32(replay);
+    GLuint v1 = (GLuint)gl_replay_u32(replay);
+    GLuint v2 = (GLuint)gl_replay_u32(replay);
+    GLuint v3 = (GLuint)gl_replay_u32(replay);
+    glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+
+static void replay_glProgramUniform4uiv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    const GLuint * value = (const GLuint *)gl_replay_bytes(replay, NULL);
+    glProgramUniform4uiv(program, location, count, value);
+}
+
+static void replay_glProgramUniformMatrix2fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix3fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix4fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix2dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix3dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix4dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix2x3fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix3x2fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix2x4fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix4x2fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix3x4fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix4x3fv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLfloat * value = (const GLfloat *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix2x3dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix3x2dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix2x4dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix4x2dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix3x4dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+
+static void replay_glProgramUniformMatrix4x3dv(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLint location = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLboolean transpose = (GLboolean)gl_replay_u32(replay);
+    const GLdouble * value = (const GLdouble *)gl_replay_bytes(replay, NULL);
+    glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+
+static void replay_glValidateProgramPipeline(GlReplay* replay) {
+    GLuint pipeline = gl_replay_name(replay, GL_NAME_PIPELINE);
+    glValidateProgramPipeline(pipeline);
+}
+
+static void replay_glVertexAttribL1d(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    glVertexAttribL1d(index, x);
+}
+
+static void replay_glVertexAttribL2d(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    glVertexAttribL2d(index, x, y);
+}
+
+static void replay_glVertexAttribL3d(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    glVertexAttribL3d(index, x, y, z);
+}
+
+static void replay_glVertexAttribL4d(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLdouble x = (GLdouble)gl_replay_f64(replay);
+    GLdouble y = (GLdouble)gl_replay_f64(replay);
+    GLdouble z = (GLdouble)gl_replay_f64(replay);
+    GLdouble w = (GLdouble)gl_replay_f64(replay);
+    glVertexAttribL4d(index, x, y, z, w);
+}
+
+static void replay_glVertexAttribLPointer(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLint size = (GLint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLsizei stride = (GLsizei)gl_replay_u32(replay);
+    const void* pointer = (const void*)(uintptr_t)gl_replay_u64(replay);
+    glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+
+static void replay_glViewportIndexedf(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLfloat x = (GLfloat)gl_replay_f32(replay);
+    GLfloat y = (GLfloat)gl_replay_f32(replay);
+    GLfloat w = (GLfloat)gl_replay_f32(replay);
+    GLfloat h = (GLfloat)gl_replay_f32(replay);
+    glViewportIndexedf(index, x, y, w, h);
+}
+
+static void replay_glScissorIndexed(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLint left = (GLint)gl_replay_u32(replay);
+    GLint bottom = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glScissorIndexed(index, left, bottom, width, height);
+}
+
+static void replay_glDepthRangeIndexed(GlReplay* replay) {
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLdouble n = (GLdouble)gl_replay_f64(replay);
+    GLdouble f = (GLdouble)gl_replay_f64(replay);
+    glDepthRangeIndexed(index, n, f);
+}
+
+static void replay_glDrawArraysInstancedBaseInstance(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLint first = (GLint)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLsizei instancecount = (GLsizei)gl_replay_u32(replay);
+    GLuint baseinstance = (GLuint)gl_replay_u32(replay);
+    glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+
+static void replay_glDrawElementsInstancedBaseInstance(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indices = (const void*)(uintptr_t)gl_replay_u64(replay);
+    GLsizei instancecount = (GLsizei)gl_replay_u32(replay);
+    GLuint baseinstance = (GLuint)gl_replay_u32(replay);
+    glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+
+static void replay_glDrawElementsInstancedBaseVertexBaseInstance(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLsizei count = (GLsizei)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indices = (const void*)(uintptr_t)gl_replay_u64(replay);
+    GLsizei instancecount = (GLsizei)gl_replay_u32(replay);
+    GLint basevertex = (GLint)gl_replay_u32(replay);
+    GLuint baseinstance = (GLuint)gl_replay_u32(replay);
+    glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+
+static void replay_glBindImageTexture(GlReplay* replay) {
+    GLuint unit = (GLuint)gl_replay_u32(replay);
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLboolean layered = (GLboolean)gl_replay_u32(replay);
+    GLint layer = (GLint)gl_replay_u32(replay);
+    GLenum access = (GLenum)gl_replay_u32(replay);
+    GLenum format = (GLenum)gl_replay_u32(replay);
+    glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+
+static void replay_glMemoryBarrier(GlReplay* replay) {
+    GLbitfield barriers = (GLbitfield)gl_replay_u32(replay);
+    glMemoryBarrier(barriers);
+}
+
+static void replay_glTexStorage1D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizei levels = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    glTexStorage1D(target, levels, internalformat, width);
+}
+
+static void replay_glTexStorage2D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizei levels = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glTexStorage2D(target, levels, internalformat, width, height);
+}
+
+static void replay_glTexStorage3D(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizei levels = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLsizei depth = (GLsizei)gl_replay_u32(replay);
+    glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+
+static void replay_glDrawTransformFeedbackInstanced(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLuint id = (GLuint)gl_replay_u32(replay);
+    GLsizei instancecount = (GLsizei)gl_replay_u32(replay);
+    glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+
+static void replay_glDrawTransformFeedbackStreamInstanced(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLuint id = (GLuint)gl_replay_u32(replay);
+    GLuint stream = (GLuint)gl_replay_u32(replay);
+    GLsizei instancecount = (GLsizei)gl_replay_u32(replay);
+    glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+
+static void replay_glDispatchCompute(GlReplay* replay) {
+    GLuint num_groups_x = (GLuint)gl_replay_u32(replay);
+    GLuint num_groups_y = (GLuint)gl_replay_u32(replay);
+    GLuint num_groups_z = (GLuint)gl_replay_u32(replay);
+    glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+
+static void replay_glDispatchComputeIndirect(GlReplay* replay) {
+    GLintptr indirect = (GLintptr)gl_replay_u64(replay);
+    glDispatchComputeIndirect(indirect);
+}
+
+static void replay_glCopyImageSubData(GlReplay* replay) {
+    GLuint srcName = (GLuint)gl_replay_u32(replay);
+    GLenum srcTarget = (GLenum)gl_replay_u32(replay);
+    GLint srcLevel = (GLint)gl_replay_u32(replay);
+    GLint srcX = (GLint)gl_replay_u32(replay);
+    GLint srcY = (GLint)gl_replay_u32(replay);
+    GLint srcZ = (GLint)gl_replay_u32(replay);
+    GLuint dstName = (GLuint)gl_replay_u32(replay);
+    GLenum dstTarget = (GLenum)gl_replay_u32(replay);
+    GLint dstLevel = (GLint)gl_replay_u32(replay);
+    GLint dstX = (GLint)gl_replay_u32(replay);
+    GLint dstY = (GLint)gl_replay_u32(replay);
+    GLint dstZ = (GLint)gl_replay_u32(replay);
+    GLsizei srcWidth = (GLsizei)gl_replay_u32(replay);
+    GLsizei srcHeight = (GLsizei)gl_replay_u32(replay);
+    GLsizei srcDepth = (GLsizei)gl_replay_u32(replay);
+    glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+
+static void replay_glFramebufferParameteri(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glFramebufferParameteri(target, pname, param);
+}
+
+static void replay_glInvalidateTexSubImage(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint xoffset = (GLint)gl_replay_u32(replay);
+    GLint yoffset = (GLint)gl_replay_u32(replay);
+    GLint zoffset = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLsizei depth = (GLsizei)gl_replay_u32(replay);
+    glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+
+static void replay_glInvalidateTexImage(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    glInvalidateTexImage(texture, level);
+}
+
+static void replay_glInvalidateBufferSubData(GlReplay* replay) {
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr length = (GLsizeiptr)gl_replay_u64(replay);
+    glInvalidateBufferSubData(buffer, offset, length);
+}
+
+static void replay_glInvalidateBufferData(GlReplay* replay) {
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    glInvalidateBufferData(buffer);
+}
+
+static void replay_glMultiDrawArraysIndirect(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    const void* indirect = (const void*)(uintptr_t)gl_replay_u64(replay);
+    GLsizei drawcount = (GLsizei)gl_replay_u32(replay);
+    GLsizei stride = (GLsizei)gl_replay_u32(replay);
+    glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+
+static void replay_glMultiDrawElementsIndirect(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indirect = (const void*)(uintptr_t)gl_replay_u64(replay);
+    GLsizei drawcount = (GLsizei)gl_replay_u32(replay);
+    GLsizei stride = (GLsizei)gl_replay_u32(replay);
+    glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+
+static void replay_glShaderStorageBlockBinding(GlReplay* replay) {
+    GLuint program = gl_replay_name(replay, GL_NAME_PROGRAM);
+    GLuint storageBlockIndex = (GLuint)gl_replay_u32(replay);
+    GLuint storageBlockBinding = (GLuint)gl_replay_u32(replay);
+    glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+
+static void replay_glTexBufferRange(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+
+static void replay_glTexStorage2DMultisample(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizei samples = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLboolean fixedsamplelocations = (GLboolean)gl_replay_u32(replay);
+    glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void replay_glTexStorage3DMultisample(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizei samples = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLsizei depth = (GLsizei)gl_replay_u32(replay);
+    GLboolean fixedsamplelocations = (GLboolean)gl_replay_u32(replay);
+    glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void replay_glTextureView(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLuint origtexture = (GLuint)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLuint minlevel = (GLuint)gl_replay_u32(replay);
+    GLuint numlevels = (GLuint)gl_replay_u32(replay);
+    GLuint minlayer = (GLuint)gl_replay_u32(replay);
+    GLuint numlayers = (GLuint)gl_replay_u32(replay);
+    glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+
+static void replay_glBindVertexBuffer(GlReplay* replay) {
+    GLuint bindingindex = (GLuint)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizei stride = (GLsizei)gl_replay_u32(replay);
+    glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+
+static void replay_glVertexAttribFormat(GlReplay* replay) {
+    GLuint attribindex = (GLuint)gl_replay_u32(replay);
+    GLint size = (GLint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLboolean normalized = (GLboolean)gl_replay_u32(replay);
+    GLuint relativeoffset = (GLuint)gl_replay_u32(replay);
+    glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+
+static void replay_glVertexAttribIFormat(GlReplay* replay) {
+    GLuint attribindex = (GLuint)gl_replay_u32(replay);
+    GLint size = (GLint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint relativeoffset = (GLuint)gl_replay_u32(replay);
+    glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+
+static void replay_glVertexAttribLFormat(GlReplay* replay) {
+    GLuint attribindex = (GLuint)gl_replay_u32(replay);
+    GLint size = (GLint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint relativeoffset = (GLuint)gl_replay_u32(replay);
+    glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+
+static void replay_glVertexAttribBinding(GlReplay* replay) {
+    GLuint attribindex = (GLuint)gl_replay_u32(replay);
+    GLuint bindingindex = (GLuint)gl_replay_u32(replay);
+    glVertexAttribBinding(attribindex, bindingindex);
+}
+
+static void replay_glVertexBindingDivisor(GlReplay* replay) {
+    GLuint bindingindex = (GLuint)gl_replay_u32(replay);
+    GLuint divisor = (GLuint)gl_replay_u32(replay);
+    glVertexBindingDivisor(bindingindex, divisor);
+}
+
+static void replay_glPopDebugGroup(GlReplay* replay) {
+    (void)replay;
+    glPopDebugGroup();
+}
+
+static void replay_glBufferStorage(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    const void* data = gl_replay_bytes(replay, NULL);
+    GLbitfield flags = (GLbitfield)gl_replay_u32(replay);
+    glBufferStorage(target, size, data, flags);
+}
+
+static void replay_glClipControl(GlReplay* replay) {
+    GLenum origin = (GLenum)gl_replay_u32(replay);
+    GLenum depth = (GLenum)gl_replay_u32(replay);
+    glClipControl(origin, depth);
+}
+
+static void replay_glTransformFeedbackBufferBase(GlReplay* replay) {
+    GLuint xfb = (GLuint)gl_replay_u32(replay);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+
+static void replay_glTransformFeedbackBufferRange(GlReplay* replay) {
+    GLuint xfb = (GLuint)gl_replay_u32(replay);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+
+static void replay_glCreateBuffers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* buffers = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!buffers) {
+        return;
+    }
+    glCreateBuffers(n, buffers);
+    gl_replay_created(replay, GL_NAME_BUFFER, n, buffers);
+}
+
+static void replay_glNamedBufferStorage(GlReplay* replay) {
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    const void* data = gl_replay_bytes(replay, NULL);
+    GLbitfield flags = (GLbitfield)gl_replay_u32(replay);
+    glNamedBufferStorage(buffer, size, data, flags);
+}
+
+static void replay_glNamedBufferData(GlReplay* replay) {
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    const void* data = gl_replay_bytes(replay, NULL);
+    GLenum usage = (GLenum)gl_replay_u32(replay);
+    glNamedBufferData(buffer, size, data, usage);
+}
+
+static void replay_glNamedBufferSubData(GlReplay* replay) {
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    const void* data = gl_replay_bytes(replay, NULL);
+    glNamedBufferSubData(buffer, offset, size, data);
+}
+
+static void replay_glCopyNamedBufferSubData(GlReplay* replay) {
+    GLuint readBuffer = (GLuint)gl_replay_u32(replay);
+    GLuint writeBuffer = (GLuint)gl_replay_u32(replay);
+    GLintptr readOffset = (GLintptr)gl_replay_u64(replay);
+    GLintptr writeOffset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void replay_glUnmapNamedBuffer(GlReplay* replay) {
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    glUnmapNamedBuffer(buffer);
+}
+
+static void replay_glFlushMappedNamedBufferRange(GlReplay* replay) {
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr length = (GLsizeiptr)gl_replay_u64(replay);
+    glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+
+static void replay_glCreateFramebuffers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* framebuffers = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!framebuffers) {
+        return;
+    }
+    glCreateFramebuffers(n, framebuffers);
+    gl_replay_created(replay, GL_NAME_FRAMEBUFFER, n, framebuffers);
+}
+
+static void replay_glNamedFramebufferRenderbuffer(GlReplay* replay) {
+    GLuint framebuffer = gl_replay_name(replay, GL_NAME_FRAMEBUFFER);
+    GLenum attachment = (GLenum)gl_replay_u32(replay);
+    GLenum renderbuffertarget = (GLenum)gl_replay_u32(replay);
+    GLuint renderbuffer = gl_replay_name(replay, GL_NAME_RENDERBUFFER);
+    glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void replay_glNamedFramebufferParameteri(GlReplay* replay) {
+    GLuint framebuffer = gl_replay_name(replay, GL_NAME_FRAMEBUFFER);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+
+static void replay_glNamedFramebufferTexture(GlReplay* replay) {
+    GLuint framebuffer = gl_replay_name(replay, GL_NAME_FRAMEBUFFER);
+    GLenum attachment = (GLenum)gl_replay_u32(replay);
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+
+static void replay_glNamedFramebufferTextureLayer(GlReplay* replay) {
+    GLuint framebuffer = gl_replay_name(replay, GL_NAME_FRAMEBUFFER);
+    GLenum attachment = (GLenum)gl_replay_u32(replay);
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint layer = (GLint)gl_replay_u32(replay);
+    glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+
+static void replay_glNamedFramebufferDrawBuffer(GlReplay* replay) {
+    GLuint framebuffer = gl_replay_name(replay, GL_NAME_FRAMEBUFFER);
+    GLenum buf = (GLenum)gl_replay_u32(replay);
+    glNamedFramebufferDrawBuffer(framebuffer, buf);
+}
+
+static void replay_glNamedFramebufferReadBuffer(GlReplay* replay) {
+    GLuint framebuffer = gl_replay_name(replay, GL_NAME_FRAMEBUFFER);
+    GLenum src = (GLenum)gl_replay_u32(replay);
+    glNamedFramebufferReadBuffer(framebuffer, src);
+}
+
+static void replay_glClearNamedFramebufferfi(GlReplay* replay) {
+    GLuint framebuffer = gl_replay_name(replay, GL_NAME_FRAMEBUFFER);
+    GLenum buffer = (GLenum)gl_replay_u32(replay);
+    GLint drawbuffer = (GLint)gl_replay_u32(replay);
+    GLfloat depth = (GLfloat)gl_replay_f32(replay);
+    GLint stencil = (GLint)gl_replay_u32(replay);
+    glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+
+static void replay_glBlitNamedFramebuffer(GlReplay* replay) {
+    GLuint readFramebuffer = gl_replay_name(replay, GL_NAME_FRAMEBUFFER);
+    GLuint drawFramebuffer = gl_replay_name(replay, GL_NAME_FRAMEBUFFER);
+    GLint srcX0 = (GLint)gl_replay_u32(replay);
+    GLint srcY0 = (GLint)gl_replay_u32(replay);
+    GLint srcX1 = (GLint)gl_replay_u32(replay);
+    GLint srcY1 = (GLint)gl_replay_u32(replay);
+    GLint dstX0 = (GLint)gl_replay_u32(replay);
+    GLint dstY0 = (GLint)gl_replay_u32(replay);
+    GLint dstX1 = (GLint)gl_replay_u32(replay);
+    GLint dstY1 = (GLint)gl_replay_u32(replay);
+    GLbitfield mask = (GLbitfield)gl_replay_u32(replay);
+    GLenum filter = (GLenum)gl_replay_u32(replay);
+    glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void replay_glCreateRenderbuffers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* renderbuffers = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!renderbuffers) {
+        return;
+    }
+    glCreateRenderbuffers(n, renderbuffers);
+    gl_replay_created(replay, GL_NAME_RENDERBUFFER, n, renderbuffers);
+}
+
+static void replay_glNamedRenderbufferStorage(GlReplay* replay) {
+    GLuint renderbuffer = gl_replay_name(replay, GL_NAME_RENDERBUFFER);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+
+static void replay_glNamedRenderbufferStorageMultisample(GlReplay* replay) {
+    GLuint renderbuffer = gl_replay_name(replay, GL_NAME_RENDERBUFFER);
+    GLsizei samples = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+
+static void replay_glCreateTextures(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* textures = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!textures) {
+        return;
+    }
+    glCreateTextures(target, n, textures);
+    gl_replay_created(replay, GL_NAME_TEXTURE, n, textures);
+}
+
+static void replay_glTextureBuffer(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    glTextureBuffer(texture, internalformat, buffer);
+}
+
+static void replay_glTextureBufferRange(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizeiptr size = (GLsizeiptr)gl_replay_u64(replay);
+    glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+
+static void replay_glTextureStorage1D(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLsizei levels = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    glTextureStorage1D(texture, levels, internalformat, width);
+}
+
+static void replay_glTextureStorage2D(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLsizei levels = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+
+static void replay_glTextureStorage3D(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLsizei levels = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLsizei depth = (GLsizei)gl_replay_u32(replay);
+    glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+
+static void replay_glTextureStorage2DMultisample(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLsizei samples = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLboolean fixedsamplelocations = (GLboolean)gl_replay_u32(replay);
+    glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void replay_glTextureStorage3DMultisample(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLsizei samples = (GLsizei)gl_replay_u32(replay);
+    GLenum internalformat = (GLenum)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    GLsizei depth = (GLsizei)gl_replay_u32(replay);
+    GLboolean fixedsamplelocations = (GLboolean)gl_replay_u32(replay);
+    glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void replay_glCopyTextureSubImage1D(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint xoffset = (GLint)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+
+static void replay_glCopyTextureSubImage2D(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint xoffset = (GLint)gl_replay_u32(replay);
+    GLint yoffset = (GLint)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void replay_glCopyTextureSubImage3D(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLint level = (GLint)gl_replay_u32(replay);
+    GLint xoffset = (GLint)gl_replay_u32(replay);
+    GLint yoffset = (GLint)gl_replay_u32(replay);
+    GLint zoffset = (GLint)gl_replay_u32(replay);
+    GLint x = (GLint)gl_replay_u32(replay);
+    GLint y = (GLint)gl_replay_u32(replay);
+    GLsizei width = (GLsizei)gl_replay_u32(replay);
+    GLsizei height = (GLsizei)gl_replay_u32(replay);
+    glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void replay_glTextureParameterf(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLfloat param = (GLfloat)gl_replay_f32(replay);
+    glTextureParameterf(texture, pname, param);
+}
+
+static void replay_glTextureParameteri(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    GLenum pname = (GLenum)gl_replay_u32(replay);
+    GLint param = (GLint)gl_replay_u32(replay);
+    glTextureParameteri(texture, pname, param);
+}
+
+static void replay_glGenerateTextureMipmap(GlReplay* replay) {
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    glGenerateTextureMipmap(texture);
+}
+
+static void replay_glBindTextureUnit(GlReplay* replay) {
+    GLuint unit = (GLuint)gl_replay_u32(replay);
+    GLuint texture = gl_replay_name(replay, GL_NAME_TEXTURE);
+    glBindTextureUnit(unit, texture);
+}
+
+static void replay_glCreateVertexArrays(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* arrays = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!arrays) {
+        return;
+    }
+    glCreateVertexArrays(n, arrays);
+    gl_replay_created(replay, GL_NAME_VERTEX_ARRAY, n, arrays);
+}
+
+static void replay_glDisableVertexArrayAttrib(GlReplay* replay) {
+    GLuint vaobj = gl_replay_name(replay, GL_NAME_VERTEX_ARRAY);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    glDisableVertexArrayAttrib(vaobj, index);
+}
+
+static void replay_glEnableVertexArrayAttrib(GlReplay* replay) {
+    GLuint vaobj = gl_replay_name(replay, GL_NAME_VERTEX_ARRAY);
+    GLuint index = (GLuint)gl_replay_u32(replay);
+    glEnableVertexArrayAttrib(vaobj, index);
+}
+
+static void replay_glVertexArrayElementBuffer(GlReplay* replay) {
+    GLuint vaobj = gl_replay_name(replay, GL_NAME_VERTEX_ARRAY);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    glVertexArrayElementBuffer(vaobj, buffer);
+}
+
+static void replay_glVertexArrayVertexBuffer(GlReplay* replay) {
+    GLuint vaobj = gl_replay_name(replay, GL_NAME_VERTEX_ARRAY);
+    GLuint bindingindex = (GLuint)gl_replay_u32(replay);
+    GLuint buffer = gl_replay_name(replay, GL_NAME_BUFFER);
+    GLintptr offset = (GLintptr)gl_replay_u64(replay);
+    GLsizei stride = (GLsizei)gl_replay_u32(replay);
+    glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+
+static void replay_glVertexArrayAttribBinding(GlReplay* replay) {
+    GLuint vaobj = gl_replay_name(replay, GL_NAME_VERTEX_ARRAY);
+    GLuint attribindex = (GLuint)gl_replay_u32(replay);
+    GLuint bindingindex = (GLuint)gl_replay_u32(replay);
+    glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+
+static void replay_glVertexArrayAttribFormat(GlReplay* replay) {
+    GLuint vaobj = gl_replay_name(replay, GL_NAME_VERTEX_ARRAY);
+    GLuint attribindex = (GLuint)gl_replay_u32(replay);
+    GLint size = (GLint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLboolean normalized = (GLboolean)gl_replay_u32(replay);
+    GLuint relativeoffset = (GLuint)gl_replay_u32(replay);
+    glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+
+static void replay_glVertexArrayAttribIFormat(GlReplay* replay) {
+    GLuint vaobj = gl_replay_name(replay, GL_NAME_VERTEX_ARRAY);
+    GLuint attribindex = (GLuint)gl_replay_u32(replay);
+    GLint size = (GLint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint relativeoffset = (GLuint)gl_replay_u32(replay);
+    glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void replay_glVertexArrayAttribLFormat(GlReplay* replay) {
+    GLuint vaobj = gl_replay_name(replay, GL_NAME_VERTEX_ARRAY);
+    GLuint attribindex = (GLuint)gl_replay_u32(replay);
+    GLint size = (GLint)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    GLuint relativeoffset = (GLuint)gl_replay_u32(replay);
+    glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void replay_glVertexArrayBindingDivisor(GlReplay* replay) {
+    GLuint vaobj = gl_replay_name(replay, GL_NAME_VERTEX_ARRAY);
+    GLuint bindingindex = (GLuint)gl_replay_u32(replay);
+    GLuint divisor = (GLuint)gl_replay_u32(replay);
+    glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+
+static void replay_glCreateSamplers(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* samplers = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!samplers) {
+        return;
+    }
+    glCreateSamplers(n, samplers);
+    gl_replay_created(replay, GL_NAME_SAMPLER, n, samplers);
+}
+
+static void replay_glCreateProgramPipelines(GlReplay* replay) {
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* pipelines = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!pipelines) {
+        return;
+    }
+    glCreateProgramPipelines(n, pipelines);
+    gl_replay_created(replay, GL_NAME_PIPELINE, n, pipelines);
+}
+
+static void replay_glCreateQueries(GlReplay* replay) {
+    GLenum target = (GLenum)gl_replay_u32(replay);
+    GLsizei n = (GLsizei)gl_replay_u32(replay);
+    GLuint* ids = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);
+    if (!ids) {
+        return;
+    }
+    glCreateQueries(target, n, ids);
+    gl_replay_created(replay, GL_NAME_QUERY, n, ids);
+}
+
+static void replay_glMemoryBarrierByRegion(GlReplay* replay) {
+    GLbitfield barriers = (GLbitfield)gl_replay_u32(replay);
+    glMemoryBarrierByRegion(barriers);
+}
+
+static void replay_glTextureBarrier(GlReplay* replay) {
+    (void)replay;
+    glTextureBarrier();
+}
+
+static void replay_glMultiDrawArraysIndirectCount(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    const void* indirect = (const void*)(uintptr_t)gl_replay_u64(replay);
+    GLintptr drawcount = (GLintptr)gl_replay_u64(replay);
+    GLsizei maxdrawcount = (GLsizei)gl_replay_u32(replay);
+    GLsizei stride = (GLsizei)gl_replay_u32(replay);
+    glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+}
+
+static void replay_glMultiDrawElementsIndirectCount(GlReplay* replay) {
+    GLenum mode = (GLenum)gl_replay_u32(replay);
+    GLenum type = (GLenum)gl_replay_u32(replay);
+    const void* indirect = (const void*)(uintptr_t)gl_replay_u64(replay);
+    GLintptr drawcount = (GLintptr)gl_replay_u64(replay);
+    GLsizei maxdrawcount = (GLsizei)gl_replay_u32(replay);
+    GLsizei stride = (GLsizei)gl_replay_u32(replay);
+    glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+
+static void replay_glPolygonOffsetClamp(GlReplay* replay) {
+    GLfloat factor = (GLfloat)gl_replay_f32(replay);
+    GLfloat units = (GLfloat)gl_replay_f32(replay);
+    GLfloat clamp = (GLfloat)gl_replay_f32(replay);
+    glPolygonOffsetClamp(factor, units, clamp);
+}
+
+static void replay_glMaxShaderCompilerThreadsKHR(GlReplay* replay) {
+    GLuint count = (GLuint)gl_replay_u32(replay);
+    glMaxShaderCompilerThreadsKHR(count);
+}
+
+void (*const gl_replay_calls[FUNCTION_COUNT])(GlReplay* replay) = {
+    replay_glCullFace,
+    replay_glFrontFace,
+    replay_glHint,
+    replay_glLineWidth,
+    replay_glPointSize,
+    replay_glPolygonMode,
+    replay_glScissor,
+    replay_glTexParameterf,
+    NULL,
+    replay_glTexParameteri,
+    NULL,
+    NULL,
+    replay_glTexImage2D,
+    replay_glDrawBuffer,
+    replay_glClear,
+    replay_glClearColor,
+    replay_glClearStencil,
+    replay_glClearDepth,
+    replay_glStencilMask,
+    replay_glColorMask,
+    replay_glDepthMask,
+    replay_glDisable,
+    replay_glEnable,
+    replay_glFinish,
+    replay_glFlush,
+    replay_glBlendFunc,
+    replay_glLogicOp,
+    replay_glStencilFunc,
+    replay_glStencilOp,
+    replay_glDepthFunc,
+    replay_glPixelStoref,
+    replay_glPixelStorei,
+    replay_glReadBuffer,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glDepthRange,
+    replay_glViewport,
+    replay_glNewList,
+    replay_glEndList,
+    replay_glCallList,
+    NULL,
+    replay_glDeleteLists,
+    replay_glGenLists,
+    replay_glListBase,
+    replay_glBegin,
+    NULL,
+    replay_glColor3b,
+    NULL,
+    replay_glColor3d,
+    NULL,
+    replay_glColor3f,
+    NULL,
+    replay_glColor3i,
+    NULL,
+    replay_glColor3s,
+    NULL,
+    replay_glColor3ub,
+    NULL,
+    replay_glColor3ui,
+    NULL,
+    replay_glColor3us,
+    NULL,
+    replay_glColor4b,
+    NULL,
+    replay_glColor4d,
+    NULL,
+    replay_glColor4f,
+    NULL,
+    replay_glColor4i,
+    NULL,
+    replay_glColor4s,
+    NULL,
+    replay_glColor4ub,
+    NULL,
+    replay_glColor4ui,
+    NULL,
+    replay_glColor4us,
+    NULL,
+    replay_glEdgeFlag,
+    NULL,
+    replay_glEnd,
+    replay_glIndexd,
+    NULL,
+    replay_glIndexf,
+    NULL,
+    replay_glIndexi,
+    NULL,
+    replay_glIndexs,
+    NULL,
+    replay_glNormal3b,
+    NULL,
+    replay_glNormal3d,
+    NULL,
+    replay_glNormal3f,
+    NULL,
+    replay_glNormal3i,
+    NULL,
+    replay_glNormal3s,
+    NULL,
+    replay_glRasterPos2d,
+    NULL,
+    replay_glRasterPos2f,
+    NULL,
+    replay_glRasterPos2i,
+    NULL,
+    replay_glRasterPos2s,
+    NULL,
+    replay_glRasterPos3d,
+    NULL,
+    replay_glRasterPos3f,
+    NULL,
+    replay_glRasterPos3i,
+    NULL,
+    replay_glRasterPos3s,
+    NULL,
+    replay_glRasterPos4d,
+    NULL,
+    replay_glRasterPos4f,
+    NULL,
+    replay_glRasterPos4i,
+    NULL,
+    replay_glRasterPos4s,
+    NULL,
+    replay_glRectd,
+    NULL,
+    replay_glRectf,
+    NULL,
+    replay_glRecti,
+    NULL,
+    replay_glRects,
+    NULL,
+    replay_glTexCoord1d,
+    NULL,
+    replay_glTexCoord1f,
+    NULL,
+    replay_glTexCoord1i,
+    NULL,
+    replay_glTexCoord1s,
+    NULL,
+    replay_glTexCoord2d,
+    NULL,
+    replay_glTexCoord2f,
+    NULL,
+    replay_glTexCoord2i,
+    NULL,
+    replay_glTexCoord2s,
+    NULL,
+    replay_glTexCoord3d,
+    NULL,
+    replay_glTexCoord3f,
+    NULL,
+    replay_glTexCoord3i,
+    NULL,
+    replay_glTexCoord3s,
+    NULL,
+    replay_glTexCoord4d,
+    NULL,
+    replay_glTexCoord4f,
+    NULL,
+    replay_glTexCoord4i,
+    NULL,
+    replay_glTexCoord4s,
+    NULL,
+    replay_glVertex2d,
+    NULL,
+    replay_glVertex2f,
+    NULL,
+    replay_glVertex2i,
+    NULL,
+    replay_glVertex2s,
+    NULL,
+    replay_glVertex3d,
+    NULL,
+    replay_glVertex3f,
+    NULL,
+    replay_glVertex3i,
+    NULL,
+    replay_glVertex3s,
+    NULL,
+    replay_glVertex4d,
+    NULL,
+    replay_glVertex4f,
+    NULL,
+    replay_glVertex4i,
+    NULL,
+    replay_glVertex4s,
+    NULL,
+    NULL,
+    replay_glColorMaterial,
+    replay_glFogf,
+    NULL,
+    replay_glFogi,
+    NULL,
+    replay_glLightf,
+    NULL,
+    replay_glLighti,
+    NULL,
+    replay_glLightModelf,
+    NULL,
+    replay_glLightModeli,
+    NULL,
+    replay_glLineStipple,
+    replay_glMaterialf,
+    NULL,
+    replay_glMateriali,
+    NULL,
+    NULL,
+    replay_glShadeModel,
+    replay_glTexEnvf,
+    NULL,
+    replay_glTexEnvi,
+    NULL,
+    replay_glTexGend,
+    NULL,
+    replay_glTexGenf,
+    NULL,
+    replay_glTexGeni,
+    NULL,
+    NULL,
+    NULL,
+    replay_glRenderMode,
+    replay_glInitNames,
+    replay_glLoadName,
+    replay_glPassThrough,
+    replay_glPopName,
+    replay_glPushName,
+    replay_glClearAccum,
+    replay_glClearIndex,
+    replay_glIndexMask,
+    replay_glAccum,
+    replay_glPopAttrib,
+    replay_glPushAttrib,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glMapGrid1d,
+    replay_glMapGrid1f,
+    replay_glMapGrid2d,
+    replay_glMapGrid2f,
+    replay_glEvalCoord1d,
+    NULL,
+    replay_glEvalCoord1f,
+    NULL,
+    replay_glEvalCoord2d,
+    NULL,
+    replay_glEvalCoord2f,
+    NULL,
+    replay_glEvalMesh1,
+    replay_glEvalPoint1,
+    replay_glEvalMesh2,
+    replay_glEvalPoint2,
+    replay_glAlphaFunc,
+    replay_glPixelZoom,
+    replay_glPixelTransferf,
+    replay_glPixelTransferi,
+    NULL,
+    NULL,
+    NULL,
+    replay_glCopyPixels,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glFrustum,
+    replay_glLoadIdentity,
+    NULL,
+    NULL,
+    replay_glMatrixMode,
+    NULL,
+    NULL,
+    replay_glOrtho,
+    replay_glPopMatrix,
+    replay_glPushMatrix,
+    replay_glRotated,
+    replay_glRotatef,
+    replay_glScaled,
+    replay_glScalef,
+    replay_glTranslated,
+    replay_glTranslatef,
+    replay_glDrawArrays,
+    replay_glDrawElements,
+    NULL,
+    replay_glPolygonOffset,
+    replay_glCopyTexImage1D,
+    replay_glCopyTexImage2D,
+    replay_glCopyTexSubImage1D,
+    replay_glCopyTexSubImage2D,
+    NULL,
+    replay_glTexSubImage2D,
+    replay_glBindTexture,
+    replay_glDeleteTextures,
+    replay_glGenTextures,
+    NULL,
+    replay_glArrayElement,
+    NULL,
+    replay_glDisableClientState,
+    NULL,
+    replay_glEnableClientState,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glIndexub,
+    NULL,
+    replay_glPopClientAttrib,
+    replay_glPushClientAttrib,
+    replay_glDrawRangeElements,
+    NULL,
+    NULL,
+    replay_glCopyTexSubImage3D,
+    replay_glActiveTexture,
+    replay_glSampleCoverage,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glClientActiveTexture,
+    replay_glMultiTexCoord1d,
+    NULL,
+    replay_glMultiTexCoord1f,
+    NULL,
+    replay_glMultiTexCoord1i,
+    NULL,
+    replay_glMultiTexCoord1s,
+    NULL,
+    replay_glMultiTexCoord2d,
+    NULL,
+    replay_glMultiTexCoord2f,
+    NULL,
+    replay_glMultiTexCoord2i,
+    NULL,
+    replay_glMultiTexCoord2s,
+    NULL,
+    replay_glMultiTexCoord3d,
+    NULL,
+    replay_glMultiTexCoord3f,
+    NULL,
+    replay_glMultiTexCoord3i,
+    NULL,
+    replay_glMultiTexCoord3s,
+    NULL,
+    replay_glMultiTexCoord4d,
+    NULL,
+    replay_glMultiTexCoord4f,
+    NULL,
+    replay_glMultiTexCoord4i,
+    NULL,
+    replay_glMultiTexCoord4s,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glBlendFuncSeparate,
+    NULL,
+    NULL,
+    replay_glPointParameterf,
+    NULL,
+    replay_glPointParameteri,
+    NULL,
+    replay_glFogCoordf,
+    NULL,
+    replay_glFogCoordd,
+    NULL,
+    NULL,
+    replay_glSecondaryColor3b,
+    NULL,
+    replay_glSecondaryColor3d,
+    NULL,
+    replay_glSecondaryColor3f,
+    NULL,
+    replay_glSecondaryColor3i,
+    NULL,
+    replay_glSecondaryColor3s,
+    NULL,
+    replay_glSecondaryColor3ub,
+    NULL,
+    replay_glSecondaryColor3ui,
+    NULL,
+    replay_glSecondaryColor3us,
+    NULL,
+    NULL,
+    replay_glWindowPos2d,
+    NULL,
+    replay_glWindowPos2f,
+    NULL,
+    replay_glWindowPos2i,
+    NULL,
+    replay_glWindowPos2s,
+    NULL,
+    replay_glWindowPos3d,
+    NULL,
+    replay_glWindowPos3f,
+    NULL,
+    replay_glWindowPos3i,
+    NULL,
+    replay_glWindowPos3s,
+    NULL,
+    replay_glBlendColor,
+    replay_glBlendEquation,
+    replay_glGenQueries,
+    replay_glDeleteQueries,
+    NULL,
+    replay_glBeginQuery,
+    replay_glEndQuery,
+    NULL,
+    NULL,
+    NULL,
+    replay_glBindBuffer,
+    replay_glDeleteBuffers,
+    replay_glGenBuffers,
+    NULL,
+    replay_glBufferData,
+    replay_glBufferSubData,
+    NULL,
+    NULL,
+    replay_glUnmapBuffer,
+    NULL,
+    NULL,
+    replay_glBlendEquationSeparate,
+    replay_glDrawBuffers,
+    replay_glStencilOpSeparate,
+    replay_glStencilFuncSeparate,
+    replay_glStencilMaskSeparate,
+    replay_glAttachShader,
+    replay_glBindAttribLocation,
+    replay_glCompileShader,
+    replay_glCreateProgram,
+    replay_glCreateShader,
+    replay_glDeleteProgram,
+    replay_glDeleteShader,
+    replay_glDetachShader,
+    replay_glDisableVertexAttribArray,
+    replay_glEnableVertexAttribArray,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glLinkProgram,
+    replay_glShaderSource,
+    replay_glUseProgram,
+    replay_glUniform1f,
+    replay_glUniform2f,
+    replay_glUniform3f,
+    replay_glUniform4f,
+    replay_glUniform1i,
+    replay_glUniform2i,
+    replay_glUniform3i,
+    replay_glUniform4i,
+    replay_glUniform1fv,
+    replay_glUniform2fv,
+    replay_glUniform3fv,
+    replay_glUniform4fv,
+    replay_glUniform1iv,
+    replay_glUniform2iv,
+    replay_glUniform3iv,
+    replay_glUniform4iv,
+    replay_glUniformMatrix2fv,
+    replay_glUniformMatrix3fv,
+    replay_glUniformMatrix4fv,
+    replay_glValidateProgram,
+    replay_glVertexAttrib1d,
+    NULL,
+    replay_glVertexAttrib1f,
+    NULL,
+    replay_glVertexAttrib1s,
+    NULL,
+    replay_glVertexAttrib2d,
+    NULL,
+    replay_glVertexAttrib2f,
+    NULL,
+    replay_glVertexAttrib2s,
+    NULL,
+    replay_glVertexAttrib3d,
+    NULL,
+    replay_glVertexAttrib3f,
+    NULL,
+    replay_glVertexAttrib3s,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glVertexAttrib4Nub,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glVertexAttrib4d,
+    NULL,
+    replay_glVertexAttrib4f,
+    NULL,
+    NULL,
+    replay_glVertexAttrib4s,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glVertexAttribPointer,
+    replay_glUniformMatrix2x3fv,
+    replay_glUniformMatrix3x2fv,
+    replay_glUniformMatrix2x4fv,
+    replay_glUniformMatrix4x2fv,
+    replay_glUniformMatrix3x4fv,
+    replay_glUniformMatrix4x3fv,
+    replay_glColorMaski,
+    NULL,
+    NULL,
+    replay_glEnablei,
+    replay_glDisablei,
+    NULL,
+    replay_glBeginTransformFeedback,
+    replay_glEndTransformFeedback,
+    replay_glBindBufferRange,
+    replay_glBindBufferBase,
+    NULL,
+    NULL,
+    replay_glClampColor,
+    replay_glBeginConditionalRender,
+    replay_glEndConditionalRender,
+    replay_glVertexAttribIPointer,
+    NULL,
+    NULL,
+    replay_glVertexAttribI1i,
+    replay_glVertexAttribI2i,
+    replay_glVertexAttribI3i,
+    replay_glVertexAttribI4i,
+    replay_glVertexAttribI1ui,
+    replay_glVertexAttribI2ui,
+    replay_glVertexAttribI3ui,
+    replay_glVertexAttribI4ui,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glBindFragDataLocation,
+    NULL,
+    replay_glUniform1ui,
+    replay_glUniform2ui,
+    replay_glUniform3ui,
+    replay_glUniform4ui,
+    replay_glUniform1uiv,
+    replay_glUniform2uiv,
+    replay_glUniform3uiv,
+    replay_glUniform4uiv,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glClearBufferfi,
+    NULL,
+    NULL,
+    replay_glBindRenderbuffer,
+    replay_glDeleteRenderbuffers,
+    replay_glGenRenderbuffers,
+    replay_glRenderbufferStorage,
+    NULL,
+    NULL,
+    replay_glBindFramebuffer,
+    replay_glDeleteFramebuffers,
+    replay_glGenFramebuffers,
+    NULL,
+    replay_glFramebufferTexture1D,
+    replay_glFramebufferTexture2D,
+    replay_glFramebufferTexture3D,
+    replay_glFramebufferRenderbuffer,
+    NULL,
+    replay_glGenerateMipmap,
+    replay_glBlitFramebuffer,
+    replay_glRenderbufferStorageMultisample,
+    replay_glFramebufferTextureLayer,
+    replay_glMapBufferRange,
+    replay_glFlushMappedBufferRange,
+    replay_glBindVertexArray,
+    replay_glDeleteVertexArrays,
+    replay_glGenVertexArrays,
+    NULL,
+    replay_glDrawArraysInstanced,
+    replay_glDrawElementsInstanced,
+    replay_glTexBuffer,
+    replay_glPrimitiveRestartIndex,
+    replay_glCopyBufferSubData,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glUniformBlockBinding,
+    replay_glDrawElementsBaseVertex,
+    replay_glDrawRangeElementsBaseVertex,
+    replay_glDrawElementsInstancedBaseVertex,
+    NULL,
+    replay_glProvokingVertex,
+    replay_glFenceSync,
+    NULL,
+    replay_glDeleteSync,
+    replay_glClientWaitSync,
+    replay_glWaitSync,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glFramebufferTexture,
+    replay_glTexImage2DMultisample,
+    replay_glTexImage3DMultisample,
+    NULL,
+    replay_glSampleMaski,
+    replay_glBindFragDataLocationIndexed,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glBindSampler,
+    replay_glSamplerParameteri,
+    NULL,
+    replay_glSamplerParameterf,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glQueryCounter,
+    NULL,
+    NULL,
+    replay_glVertexAttribDivisor,
+    replay_glVertexAttribP1ui,
+    NULL,
+    replay_glVertexAttribP2ui,
+    NULL,
+    replay_glVertexAttribP3ui,
+    NULL,
+    replay_glVertexAttribP4ui,
+    NULL,
+    replay_glVertexP2ui,
+    NULL,
+    replay_glVertexP3ui,
+    NULL,
+    replay_glVertexP4ui,
+    NULL,
+    replay_glTexCoordP1ui,
+    NULL,
+    replay_glTexCoordP2ui,
+    NULL,
+    replay_glTexCoordP3ui,
+    NULL,
+    replay_glTexCoordP4ui,
+    NULL,
+    replay_glMultiTexCoordP1ui,
+    NULL,
+    replay_glMultiTexCoordP2ui,
+    NULL,
+    replay_glMultiTexCoordP3ui,
+    NULL,
+    replay_glMultiTexCoordP4ui,
+    NULL,
+    replay_glNormalP3ui,
+    NULL,
+    replay_glColorP3ui,
+    NULL,
+    replay_glColorP4ui,
+    NULL,
+    replay_glSecondaryColorP3ui,
+    NULL,
+    replay_glMinSampleShading,
+    replay_glBlendEquationi,
+    replay_glBlendEquationSeparatei,
+    replay_glBlendFunci,
+    replay_glBlendFuncSeparatei,
+    replay_glDrawArraysIndirect,
+    replay_glDrawElementsIndirect,
+    replay_glUniform1d,
+    replay_glUniform2d,
+    replay_glUniform3d,
+    replay_glUniform4d,
+    replay_glUniform1dv,
+    replay_glUniform2dv,
+    replay_glUniform3dv,
+    replay_glUniform4dv,
+    replay_glUniformMatrix2dv,
+    replay_glUniformMatrix3dv,
+    replay_glUniformMatrix4dv,
+    replay_glUniformMatrix2x3dv,
+    replay_glUniformMatrix2x4dv,
+    replay_glUniformMatrix3x2dv,
+    replay_glUniformMatrix3x4dv,
+    replay_glUniformMatrix4x2dv,
+    replay_glUniformMatrix4x3dv,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glPatchParameteri,
+    NULL,
+    replay_glBindTransformFeedback,
+    NULL,
+    NULL,
+    NULL,
+    replay_glPauseTransformFeedback,
+    replay_glResumeTransformFeedback,
+    replay_glDrawTransformFeedback,
+    replay_glDrawTransformFeedbackStream,
+    replay_glBeginQueryIndexed,
+    replay_glEndQueryIndexed,
+    NULL,
+    replay_glReleaseShaderCompiler,
+    NULL,
+    NULL,
+    replay_glDepthRangef,
+    replay_glClearDepthf,
+    NULL,
+    replay_glProgramBinary,
+    replay_glProgramParameteri,
+    replay_glUseProgramStages,
+    replay_glActiveShaderProgram,
+    NULL,
+    replay_glBindProgramPipeline,
+    replay_glDeleteProgramPipelines,
+    replay_glGenProgramPipelines,
+    NULL,
+    NULL,
+    replay_glProgramUniform1i,
+    replay_glProgramUniform1iv,
+    replay_glProgramUniform1f,
+    replay_glProgramUniform1fv,
+    replay_glProgramUniform1d,
+    replay_glProgramUniform1dv,
+    replay_glProgramUniform1ui,
+    replay_glProgramUniform1uiv,
+    replay_glProgramUniform2i,
+    replay_glProgramUniform2iv,
+    replay_glProgramUniform2f,
+    replay_glProgramUniform2fv,
+    replay_glProgramUniform2d,
+    replay_glProgramUniform2dv,
+    replay_glProgramUniform2ui,
+    replay_glProgramUniform2uiv,
+    replay_glProgramUniform3i,
+    replay_glProgramUniform3iv,
+    replay_glProgramUniform3f,
+    replay_glProgramUniform3fv,
+    replay_glProgramUniform3d,
+    replay_glProgramUniform3dv,
+    replay_glProgramUniform3ui,
+    replay_glProgramUniform3uiv,
+    replay_glProgramUniform4i,
+    replay_glProgramUniform4iv,
+    replay_glProgramUniform4f,
+    replay_glProgramUniform4fv,
+    replay_glProgramUniform4d,
+    replay_glProgramUniform4dv,
+    replay_glProgramUniform4ui,
+    replay_glProgramUniform4uiv,
+    replay_glProgramUniformMatrix2fv,
+    replay_glProgramUniformMatrix3fv,
+    replay_glProgramUniformMatrix4fv,
+    replay_glProgramUniformMatrix2dv,
+    replay_glProgramUniformMatrix3dv,
+    replay_glProgramUniformMatrix4dv,
+    replay_glProgramUniformMatrix2x3fv,
+    replay_glProgramUniformMatrix3x2fv,
+    replay_glProgramUniformMatrix2x4fv,
+    replay_glProgramUniformMatrix4x2fv,
+    replay_glProgramUniformMatrix3x4fv,
+    replay_glProgramUniformMatrix4x3fv,
+    replay_glProgramUniformMatrix2x3dv,
+    replay_glProgramUniformMatrix3x2dv,
+    replay_glProgramUniformMatrix2x4dv,
+    replay_glProgramUniformMatrix4x2dv,
+    replay_glProgramUniformMatrix3x4dv,
+    replay_glProgramUniformMatrix4x3dv,
+    replay_glValidateProgramPipeline,
+    NULL,
+    replay_glVertexAttribL1d,
+    replay_glVertexAttribL2d,
+    replay_glVertexAttribL3d,
+    replay_glVertexAttribL4d,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glVertexAttribLPointer,
+    NULL,
+    NULL,
+    replay_glViewportIndexedf,
+    NULL,
+    NULL,
+    replay_glScissorIndexed,
+    NULL,
+    NULL,
+    replay_glDepthRangeIndexed,
+    NULL,
+    NULL,
+    replay_glDrawArraysInstancedBaseInstance,
+    replay_glDrawElementsInstancedBaseInstance,
+    replay_glDrawElementsInstancedBaseVertexBaseInstance,
+    NULL,
+    NULL,
+    replay_glBindImageTexture,
+    replay_glMemoryBarrier,
+    replay_glTexStorage1D,
+    replay_glTexStorage2D,
+    replay_glTexStorage3D,
+    replay_glDrawTransformFeedbackInstanced,
+    replay_glDrawTransformFeedbackStreamInstanced,
+    NULL,
+    NULL,
+    replay_glDispatchCompute,
+    replay_glDispatchComputeIndirect,
+    replay_glCopyImageSubData,
+    replay_glFramebufferParameteri,
+    NULL,
+    NULL,
+    replay_glInvalidateTexSubImage,
+    replay_glInvalidateTexImage,
+    replay_glInvalidateBufferSubData,
+    replay_glInvalidateBufferData,
+    NULL,
+    NULL,
+    replay_glMultiDrawArraysIndirect,
+    replay_glMultiDrawElementsIndirect,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glShaderStorageBlockBinding,
+    replay_glTexBufferRange,
+    replay_glTexStorage2DMultisample,
+    replay_glTexStorage3DMultisample,
+    replay_glTextureView,
+    replay_glBindVertexBuffer,
+    replay_glVertexAttribFormat,
+    replay_glVertexAttribIFormat,
+    replay_glVertexAttribLFormat,
+    replay_glVertexAttribBinding,
+    replay_glVertexBindingDivisor,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glPopDebugGroup,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glBufferStorage,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glClipControl,
+    NULL,
+    replay_glTransformFeedbackBufferBase,
+    replay_glTransformFeedbackBufferRange,
+    NULL,
+    NULL,
+    NULL,
+    replay_glCreateBuffers,
+    replay_glNamedBufferStorage,
+    replay_glNamedBufferData,
+    replay_glNamedBufferSubData,
+    replay_glCopyNamedBufferSubData,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glUnmapNamedBuffer,
+    replay_glFlushMappedNamedBufferRange,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glCreateFramebuffers,
+    replay_glNamedFramebufferRenderbuffer,
+    replay_glNamedFramebufferParameteri,
+    replay_glNamedFramebufferTexture,
+    replay_glNamedFramebufferTextureLayer,
+    replay_glNamedFramebufferDrawBuffer,
+    NULL,
+    replay_glNamedFramebufferReadBuffer,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glClearNamedFramebufferfi,
+    replay_glBlitNamedFramebuffer,
+    NULL,
+    NULL,
+    NULL,
+    replay_glCreateRenderbuffers,
+    replay_glNamedRenderbufferStorage,
+    replay_glNamedRenderbufferStorageMultisample,
+    NULL,
+    replay_glCreateTextures,
+    replay_glTextureBuffer,
+    replay_glTextureBufferRange,
+    replay_glTextureStorage1D,
+    replay_glTextureStorage2D,
+    replay_glTextureStorage3D,
+    replay_glTextureStorage2DMultisample,
+    replay_glTextureStorage3DMultisample,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glCopyTextureSubImage1D,
+    replay_glCopyTextureSubImage2D,
+    replay_glCopyTextureSubImage3D,
+    replay_glTextureParameterf,
+    NULL,
+    replay_glTextureParameteri,
+    NULL,
+    NULL,
+    NULL,
+    replay_glGenerateTextureMipmap,
+    replay_glBindTextureUnit,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glCreateVertexArrays,
+    replay_glDisableVertexArrayAttrib,
+    replay_glEnableVertexArrayAttrib,
+    replay_glVertexArrayElementBuffer,
+    replay_glVertexArrayVertexBuffer,
+    NULL,
+    replay_glVertexArrayAttribBinding,
+    replay_glVertexArrayAttribFormat,
+    replay_glVertexArrayAttribIFormat,
+    replay_glVertexArrayAttribLFormat,
+    replay_glVertexArrayBindingDivisor,
+    NULL,
+    NULL,
+    NULL,
+    replay_glCreateSamplers,
+    replay_glCreateProgramPipelines,
+    replay_glCreateQueries,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glMemoryBarrierByRegion,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    replay_glTextureBarrier,
+    NULL,
+    replay_glMultiDrawArraysIndirectCount,
+    replay_glMultiDrawElementsIndirectCount,
+    replay_glPolygonOffsetClamp,
+    replay_glMaxShaderCompilerThreadsKHR,
+};
@@ -0,0 +1,175 @@
+#include "gl_state.h"
+#include <stddef.h>
+
+#define UNKNOWN_NAME 0xFFFFFFFFu
+
+typedef struct {
+    GLuint program;
+    GLuint vertex_array;
+    GLuint array_buffer;
+    GLuint element_buffer; // part of the VAO state, forgotten on every VAO change
+    int blend;             // -1 unknown
+    GLenum blend_src;
+    GLenum blend_dst;
+    GLint viewport[4];
+    int viewport_known;
+    GLfloat clear_color[4];
+    int clear_color_known;
+} GLState;
+
+static GLState state;
+static GLStateStats stats;
+
+void gl_state_reset(void) {
+    state.program = UNKNOWN_NAME;
+    state.vertex_array = UNKNOWN_NAME;
+    state.array_buffer = UNKNOWN_NAME;
+    state.element_buffer = UNKNOWN_NAME;
+    state.blend = -1;
+    state.blend_src = 0;
+    state.blend_dst = 0;
+    state.viewport_known = 0;
+    state.clear_color_known = 0;
+}
+
+// -- Binds -- //
+void gl_state_use_program(GLuint program) {
+    if (state.program == program) {
+        stats.elided++;
+        return;
+    }
+    glUseProgram(program);
+    state.program = program;
+    stats.issued++;
+}
+
+void gl_state_bind_vertex_array(GLuint vertex_array) {
+    if (state.vertex_array == vertex_array) {
+        stats.elided++;
+        return;
+    }
+    glBindVertexArray(vertex_array);
+    state.vertex_array = vertex_array;
+    state.element_buffer = UNKNOWN_NAME;
+    stats.issued++;
+}
+
+void gl_state_bind_buffer(GLenum target, GLuint buffer) {
+    GLuint* cached = NULL;
+    if (target == GL_ARRAY_BUFFER) {
+        cached = &state.array_buffer;
+    } else if (target == GL_ELEMENT_ARRAY_BUFFER) {
+        cached = &state.element_buffer;
+    }
+
+    if (cached && *cached == buffer) {
+        stats.elided++;
+        return;
+    }
+    glBindBuffer(target, buffer);
+    if (cached) {
+        *cached = buffer;
+    }
+    stats.issued++;
+}
+
+// -- Fixed function state -- //
+void gl_state_set_blend(int enabled) {
+    enabled = enabled != 0;
+    if (state.blend == enabled) {
+        stats.elided++;
+        return;
+    }
+    if (enabled) {
+        glEnable(GL_BLEND);
+    } else {
+        glDisable(GL_BLEND);
+    }
+    state.blend = enabled;
+    stats.issued++;
+}
+
+void gl_state_blend_func(GLenum src, GLenum dst) {
+    if (state.blend_src == src && state.blend_dst == dst) {
+        stats.elided++;
+        return;
+    }
+    glBlendFunc(src, dst);
+    state.blend_src = src;
+    state.blend_dst = dst;
+    stats.issued++;
+}
+
+void gl_state_viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (state.viewport_known &&
+        state.viewport[0] == x && state.viewport[1] == y &&
+        state.viewport[2] == width && state.viewport[3] == height) {
+        stats.elided++;
+        return;
+    }
+    glViewport(x, y, width, height);
+    state.viewport[0] = x;
+    state.viewport[1] = y;
+    state.viewport[2] = width;
+    state.viewport[3] = height;
+    state.viewport_known = 1;
+    stats.issued++;
+}
+
+void gl_state_clear_color(GLfloat r, GLfloat g, GLfloat b, GLfloat a) {
+    if (state.clear_color_known &&
+        state.clear_color[0] == r && state.clear_color[1] == g &&
+        state.clear_color[2] == b && state.clear_color[3] == a) {
+        stats.elided++;
+        return;
+    }
+    glClearColor(r, g, b, a);
+    state.clear_color[0] = r;
+    state.clear_color[1] = g;
+    state.clear_color[2] = b;
+    state.clear_color[3] = a;
+    state.clear_color_known = 1;
+    stats.issued++;
+}
+
+// -- Deletion -- //
+void gl_state_delete_program(GLuint program) {
+    // a deleted program stays in use until another one is bound, but its name
+    // can be handed out again, so the cache must not match it anymore
+    if (state.program == program) {
+        state.program = UNKNOWN_NAME;
+    }
+    glDeleteProgram(program);
+}
+
+void gl_state_delete_vertex_arrays(GLsizei count, const GLuint* vertex_arrays) {
+    for (GLsizei i = 0; i < count; i++) {
+        if (state.vertex_array == vertex_arrays[i]) {
+            state.vertex_array = 0;
+            state.element_buffer = UNKNOWN_NAME;
+        }
+    }
+    glDeleteVertexArrays(count, vertex_arrays);
+}
+
+void gl_state_delete_buffers(GLsizei count, const GLuint* buffers) {
+    for (GLsizei i = 0; i < count; i++) {
+        if (state.array_buffer == buffers[i]) {
+            state.array_buffer = 0;
+        }
+        if (state.element_buffer == buffers[i]) {
+            state.element_buffer = 0;
+        }
+    }
+    glDeleteBuffers(count, buffers);
+}
+
+// -- Stats -- //
+GLStateStats gl_state_stats(void) {
+    return stats;
+}
+
+void gl_state_reset_stats(void) {
+    stats.issued = 0;
+    stats.elided = 0;
+}
@@ -0,0 +1,232 @@
+#include "gpu_profiler.h"
+#include <stdio.h>
+#include <string.h>
+#include "timer.h"
+
+int gpu_profiler_init(GpuProfiler* profiler, int window_frames) {
+    memset(profiler, 0, sizeof(*profiler));
+    if (!GLAD_GL_VERSION_3_3) {
+        printf("ERROR::GPU_PROFILER::TIMER_QUERIES_NOT_SUPPORTED\n");
+        return -1;
+    }
+    profiler->window_frames = window_frames > 0 ? window_frames : 1;
+    for (int i = 0; i < GPU_PROFILER_FRAMES; i++) {
+        glGenQueries(GPU_PROFILER_MAX_SCOPES * 2, profiler->queries[i]);
+    }
+    return 0;
+}
+
+void gpu_profiler_destroy(GpuProfiler* profiler) {
+    if (!profiler) {
+        return;
+    }
+    for (int i = 0; i < GPU_PROFILER_FRAMES; i++) {
+        glDeleteQueries(GPU_PROFILER_MAX_SCOPES * 2, profiler->queries[i]);
+    }
+}
+
+// -- Aggregation -- //
+static GpuScopeTotals* find_totals(GpuProfiler* profiler, const char* name, int depth) {
+    for (int i = 0; i < profiler->total_count; i++) {
+        GpuScopeTotals* totals = &profiler->totals[i];
+        if (totals->depth == depth && (totals->name == name || strcmp(totals->name, name) == 0)) {
+            return totals;
+        }
+    }
+    if (profiler->total_count == GPU_PROFILER_MAX_SCOPES) {
+        return NULL;
+    }
+    GpuScopeTotals* totals = &profiler->totals[profiler->total_count++];
+    memset(totals, 0, sizeof(*totals));
+    totals->name = name;
+    totals->depth = depth;
+    return totals;
+}
+
+static void publish_window(GpuProfiler* profiler) {
+    double frames = (double)profiler->window_count;
+    for (int i = 0; i < profiler->total_count; i++) {
+        const GpuScopeTotals* totals = &profiler->totals[i];
+        GpuScopeStats* stats = &profiler->results[i];
+        stats->name = totals->name;
+        stats->depth = totals->depth;
+        stats->calls = totals->calls / frames;
+        stats->gpu_avg_ms = totals->gpu_sum_ms / frames;
+        stats->gpu_max_ms = totals->gpu_max_ms;
+        stats->cpu_avg_ms = totals->cpu_sum_ms / frames;
+        stats->cpu_max_ms = totals->cpu_max_ms;
+    }
+    profiler->result_count = profiler->total_count;
+    profiler->result_frames = profiler->window_count;
+    profiler->total_count = 0;
+    profiler->window_count = 0;
+}
+
+// reads back the frame in slot, if the GPU is done with it
+static void collect(GpuProfiler* profiler, int slot) {
+    GpuProfilerFrame* frame = &profiler->frames[slot];
+    if (!frame->pending || frame->scope_count == 0) {
+        frame->pending = 0;
+        return;
+    }
+    frame->pending = 0;
+
+    // scope 0 is "frame", its end timestamp is the last one written
+    GLint available = 0;
+    glGetQueryObjectiv(profiler->queries[slot][1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        profiler->dropped++;
+        return;
+    }
+
+    for (int i = 0; i < frame->scope_count; i++) {
+        const GpuScopeRecord* record = &frame->scopes[i];
+        GLuint64 begin = 0, end = 0;
+        glGetQueryObjectui64v(profiler->queries[slot][i * 2], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(profiler->queries[slot][i * 2 + 1], GL_QUERY_RESULT, &end);
+
+        GpuScopeTotals* totals = find_totals(profiler, record->name, record->depth);
+        if (!totals) {
+            continue;
+        }
+        totals->calls++;
+        totals->frame_gpu_ms += (end - begin) / 1e6;
+        totals->frame_cpu_ms += record->cpu_end_ms - record->cpu_begin_ms;
+    }
+
+    for (int i = 0; i < profiler->total_count; i++) {
+        GpuScopeTotals* totals = &profiler->totals[i];
+        totals->gpu_sum_ms += totals->frame_gpu_ms;
+        totals->cpu_sum_ms += totals->frame_cpu_ms;
+        totals->gpu_max_ms = totals->frame_gpu_ms > totals->gpu_max_ms ? totals->frame_gpu_ms : totals->gpu_max_ms;
+        totals->cpu_max_ms = totals->frame_cpu_ms > totals->cpu_max_ms ? totals->frame_cpu_ms : totals->cpu_max_ms;
+        totals->frame_gpu_ms = 0.0;
+        totals->frame_cpu_ms = 0.0;
+    }
+
+    if (++profiler->window_count == profiler->window_frames) {
+        publish_window(profiler);
+    }
+}
+
+// -- Frames -- //
+void gpu_profiler_begin_frame(GpuProfiler* profiler) {
+    if (!profiler) {
+        return;
+    }
+    int slot = (int)(profiler->frame % GPU_PROFILER_FRAMES);
+    collect(profiler, slot);
+
+    profiler->frames[slot].scope_count = 0;
+    profiler->depth = 0;
+    profiler->overflow = 0;
+    gpu_profiler_push(profiler, "frame");
+}
+
+void gpu_profiler_end_frame(GpuProfiler* profiler) {
+    if (!profiler) {
+        return;
+    }
+    while (profiler->depth > 0 || profiler->overflow > 0) {
+        gpu_profiler_pop(profiler);
+    }
+    profiler->frames[profiler->frame % GPU_PROFILER_FRAMES].pending = 1;
+    profiler->frame++;
+}
+
+// -- Scopes -- //
+void gpu_profiler_push(GpuProfiler* profiler, const char* name) {
+    if (!profiler) {
+        return;
+    }
+    int slot = (int)(profiler->frame % GPU_PROFILER_FRAMES);
+    GpuProfilerFrame* frame = &profiler->frames[slot];
+    // once a scope is skipped, everything inside it is skipped too
+    if (profiler->overflow > 0 || profiler->depth == GPU_PROFILER_MAX_DEPTH || frame->scope_count == GPU_PROFILER_MAX_SCOPES) {
+        profiler->overflow++;
+        return;
+    }
+
+    int index = frame->scope_count++;
+    GpuScopeRecord* record = &frame->scopes[index];
+    record->name = name;
+    record->depth = profiler->depth;
+    record->cpu_begin_ms = timer_now_ms();
+    glQueryCounter(profiler->queries[slot][index * 2], GL_TIMESTAMP);
+    profiler->stack[profiler->depth++] = index;
+}
+
+void gpu_profiler_pop(GpuProfiler* profiler) {
+    if (!profiler) {
+        return;
+    }
+    if (profiler->overflow > 0) {
+        profiler->overflow--;
+        return;
+    }
+    if (profiler->depth == 0) {
+        return;
+    }
+    int slot = (int)(profiler->frame % GPU_PROFILER_FRAMES);
+    int index = profiler->stack[--profiler->depth];
+    glQueryCounter(profiler->queries[slot][index * 2 + 1], GL_TIMESTAMP);
+    profiler->frames[slot].scopes[index].cpu_end_ms = timer_now_ms();
+}
+
+// -- Results -- //
+void gpu_profiler_flush(GpuProfiler* profiler) {
+    if (!profiler) {
+        return;
+    }
+    glFinish();
+    // oldest first, every slot holds a frame not collected yet
+    for (unsigned long back = GPU_PROFILER_FRAMES; back > 0; back--) {
+        if (profiler->frame >= back) {
+            collect(profiler, (int)((profiler->frame - back) % GPU_PROFILER_FRAMES));
+        }
+    }
+    if (profiler->window_count > 0) {
+        publish_window(profiler);
+    }
+}
+
+const GpuScopeStats* gpu_profiler_results(const GpuProfiler* profiler, int* count) {
+    *count = profiler->result_count;
+    return profiler->results;
+}
+
+void gpu_profiler_print(const GpuProfiler* profiler) {
+    if (!profiler) {
+        return;
+    }
+    if (profiler->result_count == 0) {
+        printf("gpu profiler: no data, %lu frames dropped\n", profiler->dropped);
+        return;
+    }
+    printf("gpu profiler: last %d frames, %lu dropped\n", profiler->result_frames, profiler->dropped);
+    printf("  %-24s %6s %10s %10s %10s %10s\n", "scope", "calls", "gpu avg", "gpu max", "cpu avg", "cpu max");
+    for (int i = 0; i < profiler->result_count; i++) {
+        const GpuScopeStats* stats = &profiler->results[i];
+        printf("  %*s%-*s %6.1f %10.3f %10.3f %10.3f %10.3f\n", stats->depth * 2, "", 24 - stats->depth * 2,
+               stats->name, stats->calls, stats->gpu_avg_ms, stats->gpu_max_ms, stats->cpu_avg_ms, stats->cpu_max_ms);
+    }
+}
+
+int gpu_profiler_write_csv(const GpuProfiler* profiler, const char* path) {
+    if (profiler->result_count == 0) {
+        printf("ERROR::GPU_PROFILER::NO_DATA %s not written\n", path);
+        return -1;
+    }
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("ERROR::GPU_PROFILER::FILE_NOT_WRITTEN %s\n", path);
+        return -1;
+    }
+    fprintf(file, "scope,depth,calls,gpu_avg_ms,gpu_max_ms,cpu_avg_ms,cpu_max_ms\n");
+    for (int i = 0; i < profiler->result_count; i++) {
+        const GpuScopeStats* stats = &profiler->results[i];
+        fprintf(file, "%s,%d,%.2f,%.4f,%.4f,%.4f,%.4f\n", stats->name, stats->depth, stats->calls,
+                stats->gpu_avg_ms, stats->gpu_max_ms, stats->cpu_avg_ms, stats->cpu_max_ms);
+    }
+    return fclose(file) == 0 ? 0 : -1;
+}
@@ -0,0 +1,119 @@
+#include "headless.h"
+#include <stdio.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include "glad/glad.h"
+#include "gl_state.h"
+#include "trace.h"
+
+static int debug_context = 0;
+
+void headless_set_debug(int debug) {
+    debug_context = debug;
+}
+
+// -- Display -- //
+static EGLDisplay get_surfaceless_display(void) {
+    PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    if (get_platform_display) {
+        EGLDisplay display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        if (display != EGL_NO_DISPLAY) {
+            return display;
+        }
+    }
+    // drivers without the surfaceless platform may still give us a default display
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+int headless_create(Headless* headless, int width, int height) {
+    headless->display = NULL;
+    headless->context = NULL;
+    headless->FBO = 0;
+    headless->color_RBO = 0;
+    headless->width = width;
+    headless->height = height;
+
+    EGLDisplay display = get_surfaceless_display();
+    EGLint major, minor;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+        fprintf(stderr, "ERROR::HEADLESS::EGL_INITIALIZE_FAILED 0x%x\n", eglGetError());
+        return -1;
+    }
+    headless->display = display;
+
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        fprintf(stderr, "ERROR::HEADLESS::OPENGL_API_NOT_AVAILABLE\n");
+        headless_destroy(headless);
+        return -1;
+    }
+
+    // same version and profile as the windowed path in main.c
+    const EGLint context_attribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_CONTEXT_OPENGL_DEBUG, debug_context ? EGL_TRUE : EGL_FALSE,
+        EGL_NONE
+    };
+
+    // no config and no surface: everything is drawn into our own FBO
+    EGLContext context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, context_attribs);
+    if (context == EGL_NO_CONTEXT) {
+        fprintf(stderr, "ERROR::HEADLESS::CONTEXT_CREATION_FAILED 0x%x\n", eglGetError());
+        headless_destroy(headless);
+        return -1;
+    }
+    headless->context = context;
+
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+        fprintf(stderr, "ERROR::HEADLESS::MAKE_CURRENT_FAILED 0x%x\n", eglGetError());
+        headless_destroy(headless);
+        return -1;
+    }
+
+    TRACE_BEGIN("glad load");
+    int loaded = gladLoadGLLoader((GLADloadproc)eglGetProcAddress);
+    TRACE_END();
+    if (!loaded) {
+        fprintf(stderr, "ERROR::HEADLESS::GLAD_LOAD_FAILED\n");
+        headless_destroy(headless);
+        return -1;
+    }
+    gl_state_reset();
+
+    // -- Framebuffer -- //
+    glGenRenderbuffers(1, &headless->color_RBO);
+    glBindRenderbuffer(GL_RENDERBUFFER, headless->color_RBO);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+    glGenFramebuffers(1, &headless->FBO);
+    glBindFramebuffer(GL_FRAMEBUFFER, headless->FBO);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, headless->color_RBO);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        fprintf(stderr, "ERROR::HEADLESS::FRAMEBUFFER_INCOMPLETE\n");
+        headless_destroy(headless);
+        return -1;
+    }
+
+    gl_state_viewport(0, 0, width, height);
+    return 0;
+}
+
+void headless_destroy(Headless* headless) {
+    if (headless->context) {
+        if (headless->FBO) glDeleteFramebuffers(1, &headless->FBO);
+        if (headless->color_RBO) glDeleteRenderbuffers(1, &headless->color_RBO);
+        eglMakeCurrent(headless->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(headless->display, headless->context);
+    }
+    if (headless->display) {
+        eglTerminate(headless->display);
+    }
+    headless->display = NULL;
+    headless->context = NULL;
+    headless->FBO = 0;
+    headless->color_RBO = 0;
+}
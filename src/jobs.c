@@ -0,0 +1,444 @@
+#include "jobs.h"
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "timer.h"
+#include "trace.h"
+
+#define DEQUE_MASK (JOB_DEQUE_SIZE - 1)
+#define IDLE_SPINS 64
+
+static _Thread_local JobWorker* current_worker;
+
+// -- Deque -- //
+// Chase-Lev with the C11 orderings from Le et al., "Correct and Efficient
+// Work-Stealing for Weak Memory Models". Only the owner pushes and takes.
+static int deque_push(JobDeque* deque, Job* job) {
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    if (bottom - top >= JOB_DEQUE_SIZE) {
+        return -1;
+    }
+    atomic_store_explicit(&deque->jobs[bottom & DEQUE_MASK], job, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    return 0;
+}
+
+static Job* deque_take(JobDeque* deque) {
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        // empty
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return NULL;
+    }
+    Job* job = atomic_load_explicit(&deque->jobs[bottom & DEQUE_MASK], memory_order_relaxed);
+    if (top == bottom) {
+        // last job: race the thieves for it
+        if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                     memory_order_seq_cst, memory_order_relaxed)) {
+            job = NULL;
+        }
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+    return job;
+}
+
+static Job* deque_steal(JobDeque* deque) {
+    long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (top >= bottom) {
+        return NULL;
+    }
+    Job* job = atomic_load_explicit(&deque->jobs[top & DEQUE_MASK], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed)) {
+        return NULL;
+    }
+    return job;
+}
+
+// -- Counters -- //
+static void counter_lock(JobCounter* counter) {
+    while (atomic_flag_test_and_set_explicit(&counter->lock, memory_order_acquire)) {
+        sched_yield();
+    }
+}
+
+static void counter_unlock(JobCounter* counter) {
+    atomic_flag_clear_explicit(&counter->lock, memory_order_release);
+}
+
+// -- Scheduling -- //
+static void submit(JobSystem* system, Job* job);
+
+// NULL when the next entry is still queued or deferred; the submitter waits
+// for it instead, since it never runs jobs
+static Job* allocate(JobSystem* system, JobWorker* worker) {
+    Job* job = &worker->pool[worker->pool_next % JOB_POOL_SIZE];
+    while (atomic_load_explicit(&job->live, memory_order_acquire)) {
+        if (worker != system->submitter) {
+            return NULL;
+        }
+        sched_yield();
+    }
+    worker->pool_next++;
+    atomic_store_explicit(&job->live, 1, memory_order_relaxed);
+    return job;
+}
+
+static void finish(JobSystem* system, JobCounter* counter) {
+    if (!counter) {
+        return;
+    }
+    // the decrement happens under the lock so job_wait can tell when the
+    // finishing thread is done touching the counter
+    counter_lock(counter);
+    Job* ready = NULL;
+    if (atomic_fetch_sub(&counter->pending, 1) == 1) {
+        ready = counter->dependents;
+        counter->dependents = NULL;
+    }
+    counter_unlock(counter);
+
+    while (ready) {
+        Job* next = ready->next;
+        submit(system, ready);
+        ready = next;
+    }
+}
+
+static void execute(JobSystem* system, JobWorker* worker, Job* job, int stolen) {
+    // copy out: once the counter drops the slot may be reused
+    JobFunction function = job->function;
+    void* data = job->data;
+    JobCounter* counter = job->counter;
+    atomic_store_explicit(&job->live, 0, memory_order_release);
+
+    double start = timer_now_ms();
+    TRACE_BEGIN("job");
+    function(data);
+    TRACE_END();
+    finish(system, counter);
+
+    if (worker) {
+        unsigned long elapsed = (unsigned long)((timer_now_ms() - start) * 1e6);
+        atomic_fetch_add_explicit(&worker->busy_ns, elapsed, memory_order_relaxed);
+        atomic_fetch_add_explicit(&worker->jobs, 1, memory_order_relaxed);
+        if (stolen) {
+            atomic_fetch_add_explicit(&worker->steals, 1, memory_order_relaxed);
+        }
+    }
+}
+
+static void submit(JobSystem* system, Job* job) {
+    JobWorker* worker = current_worker;
+    if (!worker || worker->system != system) {
+        execute(system, NULL, job, 0);
+        return;
+    }
+    while (deque_push(&worker->deque, job) != 0) {
+        if (worker != system->submitter) {
+            execute(system, worker, job, 0);
+            return;
+        }
+        // wait for the workers to make room
+        sched_yield();
+    }
+
+    // pairs with the sleeping / queued check in worker_main
+    atomic_fetch_add(&system->queued, 1);
+    if (atomic_load(&system->sleeping) > 0) {
+        pthread_mutex_lock(&system->mutex);
+        pthread_cond_signal(&system->wake);
+        pthread_mutex_unlock(&system->mutex);
+    }
+}
+
+static Job* find_job(JobSystem* system, JobWorker* worker, int* stolen) {
+    Job* job = deque_take(&worker->deque);
+    if (job) {
+        atomic_fetch_sub(&system->queued, 1);
+        *stolen = 0;
+        return job;
+    }
+    // everything the submit-only thread queues is here
+    if (system->submitter) {
+        job = deque_steal(&system->submitter->deque);
+        if (job) {
+            atomic_fetch_sub(&system->queued, 1);
+            *stolen = 1;
+            return job;
+        }
+    }
+
+    // xorshift picks where to start so thieves spread over the victims
+    worker->random ^= worker->random << 13;
+    worker->random ^= worker->random >> 17;
+    worker->random ^= worker->random << 5;
+    int start = (int)(worker->random % (unsigned int)system->worker_count);
+    for (int i = 0; i < system->worker_count; i++) {
+        int victim = (start + i) % system->worker_count;
+        if (victim == worker->index) {
+            continue;
+        }
+        job = deque_steal(&system->workers[victim].deque);
+        if (job) {
+            atomic_fetch_sub(&system->queued, 1);
+            *stolen = 1;
+            return job;
+        }
+    }
+    return NULL;
+}
+
+static void* worker_main(void* arg) {
+    JobWorker* worker = (JobWorker*)arg;
+    JobSystem* system = worker->system;
+    current_worker = worker;
+    TRACE_THREAD_NAME("job worker");
+
+    int idle = 0;
+    while (atomic_load(&system->running)) {
+        int stolen = 0;
+        Job* job = find_job(system, worker, &stolen);
+        if (job) {
+            execute(system, worker, job, stolen);
+            idle = 0;
+            continue;
+        }
+        if (++idle < IDLE_SPINS) {
+            sched_yield();
+            continue;
+        }
+
+        // park until something is queued
+        pthread_mutex_lock(&system->mutex);
+        atomic_fetch_add(&system->sleeping, 1);
+        while (atomic_load(&system->queued) <= 0 && atomic_load(&system->running)) {
+            pthread_cond_wait(&system->wake, &system->mutex);
+        }
+        atomic_fetch_sub(&system->sleeping, 1);
+        pthread_mutex_unlock(&system->mutex);
+        idle = 0;
+    }
+    return NULL;
+}
+
+// -- API -- //
+int job_system_init(JobSystem* system, int worker_count, int flags) {
+    if (worker_count <= 0) {
+        worker_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    worker_count = worker_count < 1 ? 1 : worker_count > JOB_MAX_WORKERS ? JOB_MAX_WORKERS : worker_count;
+
+    int submit_only = (flags & JOB_SUBMIT_ONLY) != 0;
+    // the submitter's deque and ring sit after the workers
+    system->workers = (JobWorker*)calloc(worker_count + submit_only, sizeof(JobWorker));
+    if (!system->workers) {
+        printf("ERROR::JOBS::OUT_OF_MEMORY\n");
+        return -1;
+    }
+    system->worker_count = worker_count;
+    system->submitter = NULL;
+    atomic_store(&system->running, 1);
+    atomic_store(&system->queued, 0);
+    atomic_store(&system->sleeping, 0);
+    pthread_mutex_init(&system->mutex, NULL);
+    pthread_cond_init(&system->wake, NULL);
+    system->stats_start_ms = timer_now_ms();
+
+    for (int i = 0; i < worker_count; i++) {
+        JobWorker* worker = &system->workers[i];
+        worker->system = system;
+        worker->index = i;
+        worker->random = 2654435761u * (unsigned int)(i + 1);
+    }
+    if (submit_only) {
+        system->submitter = &system->workers[worker_count];
+        system->submitter->system = system;
+        system->submitter->index = -1;
+        current_worker = system->submitter;
+    } else {
+        current_worker = &system->workers[0];
+    }
+
+    for (int i = submit_only ? 0 : 1; i < worker_count; i++) {
+        if (pthread_create(&system->workers[i].thread, NULL, worker_main, &system->workers[i]) != 0) {
+            printf("ERROR::JOBS::THREAD_CREATION_FAILED\n");
+            system->worker_count = i;
+            job_system_shutdown(system);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void job_system_shutdown(JobSystem* system) {
+    atomic_store(&system->running, 0);
+    pthread_mutex_lock(&system->mutex);
+    pthread_cond_broadcast(&system->wake);
+    pthread_mutex_unlock(&system->mutex);
+
+    for (int i = system->submitter ? 0 : 1; i < system->worker_count; i++) {
+        pthread_join(system->workers[i].thread, NULL);
+    }
+    if (current_worker && current_worker->system == system) {
+        current_worker = NULL;
+    }
+    pthread_mutex_destroy(&system->mutex);
+    pthread_cond_destroy(&system->wake);
+    free(system->workers);
+    system->workers = NULL;
+    system->submitter = NULL;
+    system->worker_count = 0;
+}
+
+static Job* make_job(JobSystem* system, JobFunction function, void* data, JobCounter* counter, Job* storage) {
+    JobWorker* worker = current_worker;
+    Job* job = worker && worker->system == system ? allocate(system, worker) : NULL;
+    job = job ? job : storage;
+    job->function = function;
+    job->data = data;
+    job->counter = counter;
+    job->next = NULL;
+    if (counter) {
+        atomic_fetch_add(&counter->pending, 1);
+    }
+    return job;
+}
+
+static void run_inline(JobSystem* system, Job* job) {
+    JobWorker* worker = current_worker;
+    execute(system, worker && worker->system == system ? worker : NULL, job, 0);
+}
+
+void job_run(JobSystem* system, JobFunction function, void* data, JobCounter* counter) {
+    // used from outside the system and when the ring is full of live jobs
+    Job inline_job;
+    Job* job = make_job(system, function, data, counter, &inline_job);
+    if (job == &inline_job) {
+        run_inline(system, job);
+        return;
+    }
+    submit(system, job);
+}
+
+void job_run_after(JobSystem* system, JobCounter* dependency, JobFunction function, void* data, JobCounter* counter) {
+    Job inline_job;
+    Job* job = make_job(system, function, data, counter, &inline_job);
+    if (job != &inline_job) {
+        counter_lock(dependency);
+        if (atomic_load(&dependency->pending) > 0) {
+            job->next = dependency->dependents;
+            dependency->dependents = job;
+            counter_unlock(dependency);
+            return;
+        }
+        counter_unlock(dependency);
+        submit(system, job);
+        return;
+    }
+    // outside the system, or with the ring full, nothing can be deferred
+    job_wait(system, dependency);
+    run_inline(system, job);
+}
+
+void job_wait(JobSystem* system, JobCounter* counter) {
+    JobWorker* worker = current_worker;
+    if (worker && (worker->system != system || worker == system->submitter)) {
+        worker = NULL;
+    }
+    int idle = 0;
+    while (atomic_load(&counter->pending) > 0) {
+        int stolen = 0;
+        Job* job = worker ? find_job(system, worker, &stolen) : NULL;
+        if (job) {
+            execute(system, worker, job, stolen);
+            idle = 0;
+        } else if (worker || ++idle < IDLE_SPINS) {
+            sched_yield();
+        } else {
+            // nothing to help with, give the core to the workers
+            usleep(50);
+        }
+    }
+    // the thread that dropped pending to zero may still hold the lock
+    counter_lock(counter);
+    counter_unlock(counter);
+}
+
+typedef struct {
+    JobRangeFunction function;
+    void* data;
+    long first;
+    long end;
+} JobRange;
+
+static void run_range(void* data) {
+    JobRange* range = (JobRange*)data;
+    range->function(range->data, range->first, range->end);
+}
+
+void job_parallel_for(JobSystem* system, long count, long grain, JobRangeFunction function, void* data) {
+    if (count <= 0) {
+        return;
+    }
+    if (grain < 1) {
+        grain = 1;
+    }
+    long chunks = (count + grain - 1) / grain;
+    if (chunks > JOB_PARALLEL_MAX_CHUNKS) {
+        chunks = JOB_PARALLEL_MAX_CHUNKS;
+        grain = (count + chunks - 1) / chunks;
+        chunks = (count + grain - 1) / grain;
+    }
+    if (!system->submitter && (chunks == 1 || system->worker_count == 1)) {
+        function(data, 0, count);
+        return;
+    }
+
+    JobRange ranges[JOB_PARALLEL_MAX_CHUNKS];
+    JobCounter counter = JOB_COUNTER_INIT;
+    for (long i = 0; i < chunks; i++) {
+        ranges[i].function = function;
+        ranges[i].data = data;
+        ranges[i].first = i * grain;
+        ranges[i].end = (i + 1) * grain < count ? (i + 1) * grain : count;
+        job_run(system, run_range, &ranges[i], &counter);
+    }
+    job_wait(system, &counter);
+}
+
+int job_worker_index(void) {
+    return current_worker ? current_worker->index : -1;
+}
+
+JobWorkerStats job_worker_stats(JobSystem* system, int worker) {
+    JobWorkerStats stats = {0};
+    if (worker < 0 || worker >= system->worker_count) {
+        return stats;
+    }
+    JobWorker* w = &system->workers[worker];
+    stats.jobs = atomic_load(&w->jobs);
+    stats.steals = atomic_load(&w->steals);
+    stats.busy_ms = atomic_load(&w->busy_ns) / 1e6;
+    double elapsed = timer_now_ms() - system->stats_start_ms;
+    stats.utilization = elapsed > 0.0 ? stats.busy_ms / elapsed : 0.0;
+    return stats;
+}
+
+void job_system_reset_stats(JobSystem* system) {
+    for (int i = 0; i < system->worker_count; i++) {
+        atomic_store(&system->workers[i].jobs, 0);
+        atomic_store(&system->workers[i].steals, 0);
+        atomic_store(&system->workers[i].busy_ns, 0);
+    }
+    system->stats_start_ms = timer_now_ms();
+}
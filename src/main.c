@@ -1,11 +1,31 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
 #include "glad/glad.h"
 #include <GLFW/glfw3.h>
 #include "window.h"
 #include "shader.h"
+#include "scene.h"
+#include "cull.h"
+#include "gl_state.h"
+#include "shader_cache.h"
+#include "shader_reload.h"
+#include "event_queue.h"
+#include "timer.h"
+#include "frame_pacing.h"
+#include "gpu_profiler.h"
+#include "trace.h"
+#include "gl_intercept.h"
+#include "gl_capture.h"
+#include "gl_debug.h"
+#ifdef GSL_HAS_EGL
+#include "headless.h"
+#endif
 
 /*
     This is a simple OpenGL program that creates a window and sets up a basic
@@ -13,97 +33,469 @@
     context using GLAD. The program also includes a vertex shader and a fragment
     shader, compiles them, and links them into a shader program. The main loop
     clears the screen and draws a triangle using the shader program.
+
+    Every frame the figures of the scene are culled against the view frustum
+    and only the visible ones are drawn. The scene is already in clip space,
+    so the view-projection is the identity for now.
+
+    The main thread only creates the window and waits for GLFW events (GLFW
+    wants them on the main thread). A render thread owns the context and
+    runs the loop; input and resizes reach it through an EventQueue (see
+    window.h), so a blocking swap never holds up event handling and slow
+    event handling never holds up a frame. With --single-thread the old
+    loop runs on the main thread instead (input, draw, swap, poll), to
+    compare. Both print the input-to-frame latency on exit: the time from an
+    event reaching its callback to the return of the swap of the first frame
+    that saw it.
+
+    Frame pacing (vsync, uncapped, a fixed fps cap, frames in flight, see
+    frame_pacing.h) comes from GSL_PACING or --pacing, e.g.
+    --pacing cap=120,inflight=1. The default is vsync with two frames in
+    flight. Frame time statistics are printed on exit.
+
+    The GPU time of the frame and its cull, clear, draw and swap scopes (see
+    gpu_profiler.h) is printed on exit next to the CPU time of the same
+    scopes; --profile FILE also writes it as CSV. --trace FILE writes the
+    CPU zones (startup, every phase of the loop, see trace.h) as a Chrome
+    trace for chrome://tracing or ui.perfetto.dev. --gl-stats counts and
+    times every GL call (builds with -DGSL_GL_INTERCEPT=ON, see
+    gl_intercept.h) and prints the most expensive ones on exit. --capture
+    FILE records every GL call of the run (same build option, see
+    gl_capture.h) for gsl_replay to play back headless. --gl-debug asks
+    for a debug context and summarizes the driver's messages (errors,
+    performance warnings, see gl_debug.h) per frame and on exit.
+
+    With --headless [--frames N] no window is created: the same scene is drawn
+    N times into an offscreen framebuffer (see headless.h) and the program exits.
 */
 
-int main() {
-    if (!glfwInit()) {
-        fprintf(stderr, "Error: no se pudo inicializar GLFW\n");
+typedef struct {
+    int frames;                // headless
+    FramePacingConfig pacing;
+    const char* profile_path;  // CSV of the GPU profiler, NULL for none
+    const char* trace_path;    // Chrome trace of the CPU zones, NULL for none
+    int gl_stats;              // intercept and time every GL call
+    const char* capture_path;  // GL command stream for gsl_replay, NULL for none
+    int gl_debug;              // debug context, driver messages summarized per frame
+} Options;
+
+#define PROFILER_WINDOW 120 // frames
+
+// prints the profiler results, including a partial last window, and writes
+// them to options->profile_path
+static void report_profile(GpuProfiler* profiler, const Options* options) {
+    gpu_profiler_flush(profiler);
+    gpu_profiler_print(profiler);
+    if (profiler && options->profile_path && gpu_profiler_write_csv(profiler, options->profile_path) == 0) {
+        printf("perfil de GPU escrito en %s\n", options->profile_path);
+    }
+}
+
+static void write_trace(const Options* options) {
+    if (options->trace_path && trace_write_chrome(options->trace_path) == 0) {
+        printf("traza escrita en %s\n", options->trace_path);
+    }
+}
+
+// right after GLAD is loaded, so the capture sees every object the program creates
+static int install_gl_hooks(const Options* options, int width, int height) {
+    if (options->gl_stats && gl_intercept_install() != 0) {
+        fprintf(stderr, "Error: --gl-stats necesita compilar con -DGSL_GL_INTERCEPT=ON\n");
         return -1;
     }
+    if (options->capture_path && gl_capture_start(options->capture_path, width, height) != 0) {
+        fprintf(stderr, "Error: --capture necesita compilar con -DGSL_GL_INTERCEPT=ON\n");
+        return -1;
+    }
+    if (options->gl_debug && gl_debug_install() != 0) {
+        fprintf(stderr, "Error: --gl-debug necesita GL 4.3 o KHR_debug\n");
+        return -1;
+    }
+    return 0;
+}
 
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+// end of frame, after the swap
+static void end_gl_frame(void) {
+    gl_intercept_frame();
+    gl_debug_frame();
+}
 
-    #ifdef __APPLE__
-        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_COMPAT_PROFILE);
-    #endif
+static void report_gl(const Options* options) {
+    if (options->gl_stats) {
+        gl_intercept_report(25);
+    }
+    if (options->gl_debug) {
+        gl_debug_report();
+    }
+}
 
-    // to create a window and OpenGL context
-    GLFWwindow* window;
-    window = glfwCreateWindow(640, 480, "Model shader", NULL, NULL);
+#ifdef GSL_HAS_EGL
+static int run_headless(const Options* options) {
+    Headless headless;
+    TRACE_THREAD_NAME("main");
+    headless_set_debug(options->gl_debug);
+    if (headless_create(&headless, 640, 480) != 0) {
+        fprintf(stderr, "Error: no se pudo crear el contexto headless\n");
+        return -1;
+    }
+    if (install_gl_hooks(options, headless.width, headless.height) != 0) {
+        headless_destroy(&headless);
+        return -1;
+    }
 
-    if (!window) {
-        fprintf(stderr, "Error: no se pudo crear la ventana\n");
-        glfwTerminate();
+    gl_state_set_blend(1);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    Scene scene;
+    TRACE_BEGIN("scene init");
+    int loaded = scene_init(&scene);
+    TRACE_END();
+    if (loaded != 0) {
+        fprintf(stderr, "Error: no se pudo cargar la escena\n");
+        headless_destroy(&headless);
         return -1;
     }
+    shader_cache_report();
+
+    Mat4 view_projection = mat4_identity();
+    Frustum frustum;
+    frustum_from_matrix(&frustum, &view_projection);
+
+    // there is no swap, vsync runs uncapped
+    FramePacer pacer;
+    frame_pacer_init(&pacer, &options->pacing);
+
+    GpuProfiler gpu_profiler;
+    GpuProfiler* profiler = gpu_profiler_init(&gpu_profiler, PROFILER_WINDOW) == 0 ? &gpu_profiler : NULL;
+    scene_profile(&scene, profiler);
 
-    // create context
-    glfwMakeContextCurrent(window);
+    for (int i = 0; i < options->frames; i++) {
+        TRACE_BEGIN("pace");
+        frame_pacer_begin(&pacer);
+        TRACE_END();
+        TRACE_BEGIN("frame");
+        gpu_profiler_begin_frame(profiler);
 
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        TRACE_BEGIN("cull");
+        gpu_profiler_push(profiler, "cull");
+        scene_cull(&scene, &frustum);
+        gpu_profiler_pop(profiler);
+        TRACE_END();
+
+        TRACE_BEGIN("draw");
+        scene_draw(&scene);
+        TRACE_END();
+
+        gpu_profiler_end_frame(profiler);
+        frame_pacer_end(&pacer);
+        end_gl_frame();
+        TRACE_END();
+    }
+    glFinish();
+    gl_capture_stop();
+    frame_pacer_print_stats(&pacer);
+    frame_pacer_destroy(&pacer);
+    report_profile(profiler, options);
+    gpu_profiler_destroy(profiler);
+    report_gl(options);
+
+    printf("%d cuadros renderizados en modo headless (%s)\n", options->frames, (const char*)glGetString(GL_RENDERER));
+
+    scene_destroy(&scene);
+    headless_destroy(&headless);
+    return 0;
+}
+#endif
+
+typedef struct {
+    unsigned long events;
+    double total_ms;
+    double max_ms;
+} InputLatency;
+
+/*
+    The frame loop, on whatever thread owns the context. poll is set for the
+    single threaded mode: GLFW events are polled after the swap and the loop
+    ends with the window. Otherwise it runs until the main thread sends
+    EVENT_CLOSE.
+*/
+static int render_loop(GLFWwindow* window, EventQueue* events, int poll, const Options* options, InputLatency* latency) {
+    TRACE_BEGIN("glad load");
+    int loaded = gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+    TRACE_END();
+    if (!loaded) {
         fprintf(stderr, "Error: no se pudo cargar GLAD\n");
-        glfwTerminate();
         return -1;
     }
+    if (install_gl_hooks(options, 640, 480) != 0) {
+        return -1;
+    }
+    gl_state_reset();
 
     // polygon mode, decomment the next line to see the wireframe
     // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glViewport(0, 0, 640, 480);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    gl_state_set_blend(1);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    gl_state_viewport(0, 0, 640, 480);
 
-    float vertices[] = {
-        // positions         // colors
-        // x     y     z     // r     g     b
-         0.5f, -0.5f, 0.0f,  1.0f, 0.0f, 0.0f,  // bottom right
-        -0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f,  // bottom left
-         0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f   // top
-    };
-
-
-    Shader model_shader = create_shader("/home/arki/graphics/shaders/model.vs", "/home/arki/graphics/shaders/model.fs");
+    Scene scene;
+    TRACE_BEGIN("scene init");
+    loaded = scene_init(&scene);
+    TRACE_END();
+    if (loaded != 0) {
+        fprintf(stderr, "Error: no se pudo cargar la escena\n");
+        return -1;
+    }
+    shader_cache_report();
 
-    unsigned int VAO;
-    unsigned int VBO;
+    // edit shaders/instanced.vs or model.fs while running to see them reload
+    ShaderWatcher watcher;
+    if (shader_watcher_start(&watcher) == 0) {
+        scene_watch(&scene, &watcher);
+    }
 
-    glGenVertexArrays(1, &VAO); // generate a vertex array object
-    glGenBuffers(1, &VBO); // generate a buffer object
+    Mat4 view_projection = mat4_identity();
+    Frustum frustum;
+    frustum_from_matrix(&frustum, &view_projection);
 
-    glBindVertexArray(VAO); // bind the vertex array object
-    glBindBuffer(GL_ARRAY_BUFFER, VBO); // bind the buffer object to the GL_ARRAY_BUFFER target
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW); // send the data to the GPU
+    FramePacer pacer;
+    frame_pacer_init(&pacer, &options->pacing);
+    glfwSwapInterval(frame_pacer_swap_interval(&pacer));
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0); // set the vertex attribute pointer
-    glEnableVertexAttribArray(0); // enable the vertex attribute array
+    GpuProfiler gpu_profiler;
+    GpuProfiler* profiler = gpu_profiler_init(&gpu_profiler, PROFILER_WINDOW) == 0 ? &gpu_profiler : NULL;
+    scene_profile(&scene, profiler);
 
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3*sizeof(float))); // set the vertex attribute pointer
-    glEnableVertexAttribArray(1); // enable the vertex attribute array
+    int running = 1;
+    while (running) {
+        // -- Pace -- //
+        TRACE_BEGIN("pace");
+        frame_pacer_begin(&pacer);
+        TRACE_END();
 
-    while(!glfwWindowShouldClose(window)) {
         // -- Input -- //
-        process_input(window);
+        TRACE_BEGIN("input");
+        unsigned long pending = 0;
+        double pending_ms = 0.0, oldest_ms = 0.0;
+        WindowEvent event;
+        while (event_queue_pop(events, &event)) {
+            if (event.type == EVENT_CLOSE) {
+                running = 0;
+                continue;
+            }
+            window_handle_event(window, &event);
+            oldest_ms = pending ? oldest_ms : event.time_ms;
+            pending_ms += event.time_ms;
+            pending++;
+        }
+        TRACE_END();
+        if (!running || (poll && glfwWindowShouldClose(window))) {
+            break;
+        }
+        TRACE_BEGIN("frame");
+        gpu_profiler_begin_frame(profiler);
+
+        // -- Hot reload -- //
+        TRACE_BEGIN("hot reload");
+        shader_watcher_update(&watcher);
+        TRACE_END();
 
-        // -- Style -- //
-        glClearColor(0.4, 0.4, 0.4, 0.5f); // set the clear color
-        glClear(GL_COLOR_BUFFER_BIT);
+        // -- Cull -- //
+        TRACE_BEGIN("cull");
+        gpu_profiler_push(profiler, "cull");
+        scene_cull(&scene, &frustum);
+        gpu_profiler_pop(profiler);
+        TRACE_END();
 
-        shader_use(&model_shader); // use the shader program
-        glBindVertexArray(VAO); // bind the vertex array object
-        glDrawArrays(GL_TRIANGLES, 0, 3); // draw the triangle
+        // -- Draw -- //
+        TRACE_BEGIN("draw");
+        scene_draw(&scene);
+        TRACE_END();
 
-        // -- Bind the shader program -- //
+        // -- Present -- //
+        TRACE_BEGIN("swap");
+        gpu_profiler_push(profiler, "swap");
         glfwSwapBuffers(window);
-        glfwPollEvents();
+        gpu_profiler_pop(profiler);
+        TRACE_END();
+        shader_watcher_frame_end(&watcher);
+        gpu_profiler_end_frame(profiler);
+        frame_pacer_end(&pacer);
+        end_gl_frame();
+        TRACE_END();
+        if (pending) {
+            double now = timer_now_ms();
+            latency->events += pending;
+            latency->total_ms += pending * now - pending_ms;
+            latency->max_ms = now - oldest_ms > latency->max_ms ? now - oldest_ms : latency->max_ms;
+        }
+        if (poll) {
+            TRACE_BEGIN("poll events");
+            glfwPollEvents();
+            TRACE_END();
+        }
     }
 
+    gl_capture_stop();
+    frame_pacer_print_stats(&pacer);
+    report_profile(profiler, options);
+    report_gl(options);
+
     // -- Dealocate -- //
-    glDeleteVertexArrays(1, &VAO); // delete the vertex array object
-    glDeleteBuffers(1, &VBO); // delete the buffer object
+    gpu_profiler_destroy(profiler);
+    frame_pacer_destroy(&pacer);
+    shader_watcher_stop(&watcher);
+    scene_destroy(&scene);
+    return 0;
+}
+
+typedef struct {
+    GLFWwindow* window;
+    EventQueue* events;
+    const Options* options;
+    pthread_t thread;
+    InputLatency latency;
+    int status;
+    atomic_int finished; // render_loop returned, nothing pops events anymore
+} RenderThread;
+
+static void* render_thread_main(void* data) {
+    RenderThread* render = (RenderThread*)data;
+    TRACE_THREAD_NAME("render");
+
+    glfwMakeContextCurrent(render->window);
+    render->status = render_loop(render->window, render->events, 0, render->options, &render->latency);
+    glfwMakeContextCurrent(NULL);
+    atomic_store(&render->finished, 1);
+
+    // when the loop failed the main thread is still waiting for events
+    glfwSetWindowShouldClose(render->window, 1);
+    glfwPostEmptyEvent();
+    return NULL;
+}
+
+int main(int argc, char** argv) {
+    int headless = 0;
+    int single_thread = 0;
+    Options options = { 600, frame_pacing_default(), NULL, NULL, 0, NULL, 0 };
+    TRACE_THREAD_NAME("main");
+
+    const char* pacing_env = getenv("GSL_PACING");
+    if (pacing_env && frame_pacing_parse(&options.pacing, pacing_env) != 0) {
+        fprintf(stderr, "Error: GSL_PACING invalido: %s\n", pacing_env);
+        return -1;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--headless") == 0) {
+            headless = 1;
+        } else if (strcmp(argv[i], "--single-thread") == 0) {
+            single_thread = 1;
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            options.frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--pacing") == 0 && i + 1 < argc) {
+            if (frame_pacing_parse(&options.pacing, argv[++i]) != 0) {
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+            options.profile_path = argv[++i];
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            options.trace_path = argv[++i];
+        } else if (strcmp(argv[i], "--gl-stats") == 0) {
+            options.gl_stats = 1;
+        } else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+            options.capture_path = argv[++i];
+        } else if (strcmp(argv[i], "--gl-debug") == 0) {
+            options.gl_debug = 1;
+        } else {
+            fprintf(stderr, "Uso: %s [--headless] [--frames N] [--single-thread] [--pacing vsync[=N]|uncapped|cap=FPS[,inflight=N][,spin=MS]] [--profile FILE] [--trace FILE] [--gl-stats] [--capture FILE] [--gl-debug]\n", argv[0]);
+            return -1;
+        }
+    }
+    trace_set_enabled(options.trace_path != NULL);
+
+    if (headless) {
+    #ifdef GSL_HAS_EGL
+        int status = run_headless(&options);
+        write_trace(&options);
+        return status;
+    #else
+        fprintf(stderr, "Error: compilado sin soporte EGL, el modo headless no esta disponible\n");
+        return -1;
+    #endif
+    }
+
+    if (!glfwInit()) {
+        fprintf(stderr, "Error: no se pudo inicializar GLFW\n");
+        return -1;
+    }
 
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    #ifdef __APPLE__
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_COMPAT_PROFILE);
+    #endif
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, options.gl_debug ? GLFW_TRUE : GLFW_FALSE);
+
+    // to create a window and OpenGL context
+    GLFWwindow* window;
+    TRACE_BEGIN("create window");
+    window = glfwCreateWindow(640, 480, "Model shader", NULL, NULL);
+    TRACE_END();
+
+    if (!window) {
+        fprintf(stderr, "Error: no se pudo crear la ventana\n");
+        glfwTerminate();
+        return -1;
+    }
+
+    EventQueue* events = event_queue_create();
+    if (!events) {
+        fprintf(stderr, "Error: sin memoria para la cola de eventos\n");
+        glfwTerminate();
+        return -1;
+    }
+    window_forward_events(window, events);
+
+    RenderThread render = { .window = window, .events = events, .options = &options };
+    if (single_thread) {
+        glfwMakeContextCurrent(window);
+        render.status = render_loop(window, events, 1, &options, &render.latency);
+    } else {
+        if (pthread_create(&render.thread, NULL, render_thread_main, &render) != 0) {
+            fprintf(stderr, "Error: no se pudo crear el hilo de render\n");
+            free(events);
+            glfwTerminate();
+            return -1;
+        }
+
+        // -- Events -- //
+        while (!glfwWindowShouldClose(window)) {
+            TRACE_BEGIN("wait events");
+            glfwWaitEvents();
+            TRACE_END();
+        }
+
+        // a render thread that already stopped would never make room
+        WindowEvent close = { .type = EVENT_CLOSE, .time_ms = timer_now_ms() };
+        while (!atomic_load(&render.finished) && event_queue_push(events, &close) != 0) {
+            sched_yield();
+        }
+        pthread_join(render.thread, NULL);
+    }
+
+    if (render.latency.events) {
+        printf("latencia entrada->cuadro (%s): %lu eventos, media %.2f ms, max %.2f ms, %u descartados\n",
+               single_thread ? "un hilo" : "hilo de render", render.latency.events,
+               render.latency.total_ms / render.latency.events, render.latency.max_ms,
+               atomic_load(&events->dropped));
+    }
+    write_trace(&options);
+
+    free(events);
     glfwTerminate();
-    return 0;
+    return render.status;
 }
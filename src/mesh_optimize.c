@@ -0,0 +1,357 @@
+#include "mesh_optimize.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// -- Analysis -- //
+MeshCacheStats mesh_analyze_vertex_cache(const unsigned int* indices, int index_count,
+                                         int vertex_count, int cache_size) {
+    MeshCacheStats stats = {0};
+    if (index_count < 3) {
+        return stats;
+    }
+
+    // timestamp of the last time each vertex entered the FIFO
+    int* entered = (int*)malloc(vertex_count * sizeof(int));
+    char* used = (char*)calloc(vertex_count, 1);
+    if (!entered || !used) {
+        printf("ERROR::MESH_OPTIMIZE::OUT_OF_MEMORY\n");
+        free(entered);
+        free(used);
+        return stats;
+    }
+    for (int i = 0; i < vertex_count; i++) {
+        entered[i] = -cache_size - 1;
+    }
+
+    int misses = 0;
+    int unique = 0;
+    for (int i = 0; i < index_count; i++) {
+        unsigned int v = indices[i];
+        if (misses - entered[v] > cache_size) {
+            entered[v] = misses;
+            misses++;
+        }
+        if (!used[v]) {
+            used[v] = 1;
+            unique++;
+        }
+    }
+
+    stats.acmr = misses / (float)(index_count / 3);
+    stats.atvr = unique ? misses / (float)unique : 0.0f;
+    free(entered);
+    free(used);
+    return stats;
+}
+
+// -- Tipsify -- //
+typedef struct {
+    int* offsets;   // vertex -> first entry in triangles
+    int* triangles; // triangles using each vertex
+    int* live;      // triangles not emitted yet per vertex
+} Adjacency;
+
+static void free_adjacency(Adjacency* adjacency) {
+    free(adjacency->offsets);
+    free(adjacency->triangles);
+    free(adjacency->live);
+}
+
+static int build_adjacency(Adjacency* adjacency, const unsigned int* indices, int index_count, int vertex_count) {
+    adjacency->offsets = (int*)calloc(vertex_count + 1, sizeof(int));
+    adjacency->triangles = (int*)malloc(index_count * sizeof(int));
+    adjacency->live = (int*)calloc(vertex_count, sizeof(int));
+    int* fill = (int*)malloc(vertex_count * sizeof(int));
+    if (!adjacency->offsets || !adjacency->triangles || !adjacency->live || !fill) {
+        free_adjacency(adjacency);
+        free(fill);
+        return -1;
+    }
+
+    for (int i = 0; i < index_count; i++) {
+        adjacency->live[indices[i]]++;
+    }
+    for (int v = 0; v < vertex_count; v++) {
+        adjacency->offsets[v + 1] = adjacency->offsets[v] + adjacency->live[v];
+    }
+
+    memcpy(fill, adjacency->offsets, vertex_count * sizeof(int));
+    for (int i = 0; i < index_count; i++) {
+        adjacency->triangles[fill[indices[i]]++] = i / 3;
+    }
+    free(fill);
+    return 0;
+}
+
+int mesh_optimize_vertex_cache(unsigned int* indices, int index_count, int vertex_count,
+                               int cache_size, int* clusters) {
+    int triangle_count = index_count / 3;
+    if (triangle_count == 0) {
+        return 0;
+    }
+
+    Adjacency adjacency;
+    if (build_adjacency(&adjacency, indices, index_count, vertex_count) != 0) {
+        printf("ERROR::MESH_OPTIMIZE::OUT_OF_MEMORY\n");
+        return -1;
+    }
+
+    int* cache_time = (int*)calloc(vertex_count, sizeof(int));
+    char* emitted = (char*)calloc(triangle_count, 1);
+    // every index is pushed once at most
+    int* dead_end = (int*)malloc(index_count * sizeof(int));
+    int* candidates = (int*)malloc(index_count * sizeof(int));
+    unsigned int* output = (unsigned int*)malloc(index_count * sizeof(unsigned int));
+    if (!cache_time || !emitted || !dead_end || !candidates || !output) {
+        printf("ERROR::MESH_OPTIMIZE::OUT_OF_MEMORY\n");
+        free(output);
+        free(candidates);
+        free(dead_end);
+        free(emitted);
+        free(cache_time);
+        free_adjacency(&adjacency);
+        return -1;
+    }
+
+    int dead_end_top = 0;
+    int time = cache_size + 1;
+    int cursor = 0;
+    int written = 0;
+    int cluster_count = 0;
+    int cluster_start = 0;
+    int fanning = 0;
+
+    if (clusters) {
+        clusters[cluster_count] = 0;
+    }
+    cluster_count++;
+
+    while (fanning >= 0) {
+        int candidate_count = 0;
+
+        // emit every live triangle around the fanning vertex
+        for (int a = adjacency.offsets[fanning]; a < adjacency.offsets[fanning + 1]; a++) {
+            int t = adjacency.triangles[a];
+            if (emitted[t]) {
+                continue;
+            }
+            for (int c = 0; c < 3; c++) {
+                unsigned int v = indices[t * 3 + c];
+                output[written++] = v;
+                dead_end[dead_end_top++] = v;
+                candidates[candidate_count++] = v;
+                adjacency.live[v]--;
+                if (time - cache_time[v] > cache_size) {
+                    cache_time[v] = time++;
+                }
+            }
+            emitted[t] = 1;
+        }
+
+        // next fanning vertex: the candidate that will still be in the cache
+        // after its remaining triangles are emitted, and the oldest of those
+        int next = -1;
+        int best = -1;
+        for (int i = 0; i < candidate_count; i++) {
+            int v = candidates[i];
+            if (adjacency.live[v] <= 0) {
+                continue;
+            }
+            int priority = 0;
+            if (time - cache_time[v] + 2 * adjacency.live[v] <= cache_size) {
+                priority = time - cache_time[v];
+            }
+            if (priority > best) {
+                best = priority;
+                next = v;
+            }
+        }
+
+        if (next == -1) {
+            // dead end: recently used vertices first, then scan forward
+            while (dead_end_top > 0) {
+                int v = dead_end[--dead_end_top];
+                if (adjacency.live[v] > 0) {
+                    next = v;
+                    break;
+                }
+            }
+            while (next == -1 && cursor < vertex_count) {
+                if (adjacency.live[cursor] > 0) {
+                    next = cursor;
+                }
+                cursor++;
+            }
+            if (next != -1 && written / 3 > cluster_start) {
+                cluster_start = written / 3;
+                if (clusters) {
+                    clusters[cluster_count] = cluster_start;
+                }
+                cluster_count++;
+            }
+        }
+        fanning = next;
+    }
+
+    memcpy(indices, output, written * sizeof(unsigned int));
+
+    free(output);
+    free(candidates);
+    free(dead_end);
+    free(emitted);
+    free(cache_time);
+    free_adjacency(&adjacency);
+    return cluster_count;
+}
+
+// -- Overdraw -- //
+typedef struct {
+    int first;
+    int count;
+    float sort_key;
+} Cluster;
+
+static int compare_clusters(const void* a, const void* b) {
+    float x = ((const Cluster*)a)->sort_key;
+    float y = ((const Cluster*)b)->sort_key;
+    // descending, outward facing clusters first
+    return (x < y) - (x > y);
+}
+
+int mesh_optimize_overdraw(unsigned int* indices, int index_count,
+                           const float* vertices, int vertex_stride,
+                           const int* clusters, int cluster_count) {
+    int triangle_count = index_count / 3;
+    if (cluster_count < 2) {
+        return 0;
+    }
+
+    Cluster* list = (Cluster*)malloc(cluster_count * sizeof(Cluster));
+    unsigned int* output = (unsigned int*)malloc(index_count * sizeof(unsigned int));
+    if (!list || !output) {
+        printf("ERROR::MESH_OPTIMIZE::OUT_OF_MEMORY\n");
+        free(output);
+        free(list);
+        return -1;
+    }
+
+    // mesh centroid, averaged over triangle corners
+    float center[3] = { 0.0f, 0.0f, 0.0f };
+    for (int i = 0; i < index_count; i++) {
+        const float* p = vertices + indices[i] * vertex_stride;
+        center[0] += p[0];
+        center[1] += p[1];
+        center[2] += p[2];
+    }
+    for (int c = 0; c < 3; c++) {
+        center[c] /= index_count;
+    }
+
+    for (int k = 0; k < cluster_count; k++) {
+        Cluster* cluster = &list[k];
+        cluster->first = clusters[k];
+        cluster->count = (k + 1 < cluster_count ? clusters[k + 1] : triangle_count) - clusters[k];
+
+        // area weighted centroid and normal of the cluster
+        float centroid[3] = { 0.0f, 0.0f, 0.0f };
+        float normal[3] = { 0.0f, 0.0f, 0.0f };
+        float area = 0.0f;
+        for (int t = cluster->first; t < cluster->first + cluster->count; t++) {
+            const float* a = vertices + indices[t * 3 + 0] * vertex_stride;
+            const float* b = vertices + indices[t * 3 + 1] * vertex_stride;
+            const float* c = vertices + indices[t * 3 + 2] * vertex_stride;
+            float e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+            float e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+            float n[3] = {
+                e1[1] * e2[2] - e1[2] * e2[1],
+                e1[2] * e2[0] - e1[0] * e2[2],
+                e1[0] * e2[1] - e1[1] * e2[0]
+            };
+            float w = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (int j = 0; j < 3; j++) {
+                centroid[j] += (a[j] + b[j] + c[j]) / 3.0f * w;
+                normal[j] += n[j];
+            }
+            area += w;
+        }
+
+        float length = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        cluster->sort_key = 0.0f;
+        if (area > 0.0f && length > 0.0f) {
+            for (int j = 0; j < 3; j++) {
+                cluster->sort_key += (centroid[j] / area - center[j]) * normal[j] / length;
+            }
+        }
+    }
+
+    qsort(list, cluster_count, sizeof(Cluster), compare_clusters);
+
+    int written = 0;
+    for (int k = 0; k < cluster_count; k++) {
+        memcpy(output + written, indices + list[k].first * 3, list[k].count * 3 * sizeof(unsigned int));
+        written += list[k].count * 3;
+    }
+    memcpy(indices, output, written * sizeof(unsigned int));
+
+    free(output);
+    free(list);
+    return 0;
+}
+
+// -- Vertex fetch -- //
+int mesh_optimize_vertex_fetch(float* vertices, int vertex_stride, int vertex_count,
+                               unsigned int* indices, int index_count) {
+    unsigned int* remap = (unsigned int*)malloc(vertex_count * sizeof(unsigned int));
+    float* reordered = (float*)malloc(vertex_count * vertex_stride * sizeof(float));
+    if (!remap || !reordered) {
+        printf("ERROR::MESH_OPTIMIZE::OUT_OF_MEMORY\n");
+        free(reordered);
+        free(remap);
+        return -1;
+    }
+    memset(remap, 0xFF, vertex_count * sizeof(unsigned int));
+
+    unsigned int next = 0;
+    for (int i = 0; i < index_count; i++) {
+        unsigned int v = indices[i];
+        if (remap[v] == 0xFFFFFFFFu) {
+            memcpy(reordered + next * vertex_stride, vertices + v * vertex_stride, vertex_stride * sizeof(float));
+            remap[v] = next++;
+        }
+        indices[i] = remap[v];
+    }
+
+    memcpy(vertices, reordered, next * vertex_stride * sizeof(float));
+    free(reordered);
+    free(remap);
+    return (int)next;
+}
+
+int mesh_optimize(float* vertices, int vertex_stride, int vertex_count,
+                  unsigned int* indices, int index_count) {
+    int* clusters = (int*)malloc((index_count / 3 + 1) * sizeof(int));
+    // the first two steps reorder indices before a later one can fail
+    unsigned int* original = (unsigned int*)malloc(index_count * sizeof(unsigned int));
+    if (!clusters || !original) {
+        printf("ERROR::MESH_OPTIMIZE::OUT_OF_MEMORY\n");
+        free(original);
+        free(clusters);
+        return -1;
+    }
+    memcpy(original, indices, index_count * sizeof(unsigned int));
+
+    int cluster_count = mesh_optimize_vertex_cache(indices, index_count, vertex_count, MESH_CACHE_SIZE, clusters);
+    int result = -1;
+    if (cluster_count >= 0 &&
+        mesh_optimize_overdraw(indices, index_count, vertices, vertex_stride, clusters, cluster_count) == 0) {
+        result = mesh_optimize_vertex_fetch(vertices, vertex_stride, vertex_count, indices, index_count);
+    }
+    if (result < 0) {
+        memcpy(indices, original, index_count * sizeof(unsigned int));
+    }
+    free(original);
+    free(clusters);
+    return result;
+}
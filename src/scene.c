@@ -0,0 +1,132 @@
+#include "scene.h"
+#include <stdlib.h>
+#include "glad/glad.h"
+#include "gl_state.h"
+
+#ifndef GSL_SHADER_DIR
+#define GSL_SHADER_DIR "shaders"
+#endif
+
+// bounding sphere of the triangle around its origin, before scaling
+#define SCENE_TRIANGLE_RADIUS 0.7072f
+
+int scene_init(Scene* scene) {
+    float vertices[] = {
+        // positions         // colors
+        // x     y     z     // r     g     b
+         0.5f, -0.5f, 0.0f,  1.0f, 0.0f, 0.0f,  // bottom right
+        -0.5f, -0.5f, 0.0f,  0.0f, 1.0f, 0.0f,  // bottom left
+         0.0f,  0.5f, 0.0f,  0.0f, 0.0f, 1.0f   // top
+    };
+
+    scene->instances = NULL;
+    scene->instance_count = 0;
+    scene->instance_capacity = 0;
+    scene->bounds = (CullSpheres){0};
+    scene->visible = NULL;
+    scene->visible_instances = NULL;
+    scene->visible_count = 0;
+    scene->visible_dirty = 0;
+    scene->profiler = NULL;
+
+    scene->model_shader = create_shader(GSL_SHADER_DIR "/instanced.vs", GSL_SHADER_DIR "/model.fs");
+    if (!scene->model_shader.ID) {
+        return -1;
+    }
+
+    figure_init(&scene->figure, vertices, 3, NULL, 0); // VAO + VBO with the positions and colors
+
+    // the original triangle: no offset, no scale, no tint
+    FigureInstance triangle = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    if (scene_add_instance(scene, &triangle) < 0) {
+        scene_destroy(scene);
+        return -1;
+    }
+    return 0;
+}
+
+int scene_add_instance(Scene* scene, const FigureInstance* instance) {
+    if (scene->instance_count == scene->instance_capacity) {
+        int capacity = scene->instance_capacity ? scene->instance_capacity * 2 : 16;
+        FigureInstance* instances = (FigureInstance*)realloc(scene->instances, capacity * sizeof(FigureInstance));
+        if (instances) {
+            scene->instances = instances;
+        }
+        FigureInstance* visible_instances = (FigureInstance*)realloc(scene->visible_instances, capacity * sizeof(FigureInstance));
+        if (visible_instances) {
+            scene->visible_instances = visible_instances;
+        }
+        unsigned int* visible = (unsigned int*)realloc(scene->visible, capacity * sizeof(unsigned int));
+        if (visible) {
+            scene->visible = visible;
+        }
+        if (!instances || !visible_instances || !visible) {
+            return -1;
+        }
+        scene->instance_capacity = capacity;
+    }
+
+    Vec3 center = { instance->x, instance->y, instance->z };
+    if (cull_spheres_push(&scene->bounds, center, SCENE_TRIANGLE_RADIUS * instance->scale) < 0) {
+        return -1;
+    }
+
+    int index = scene->instance_count++;
+    scene->instances[index] = *instance;
+
+    // visible until the next cull says otherwise
+    scene->visible[scene->visible_count] = index;
+    scene->visible_instances[scene->visible_count] = *instance;
+    scene->visible_count++;
+    scene->visible_dirty = 1;
+    return index;
+}
+
+int scene_watch(Scene* scene, ShaderWatcher* watcher) {
+    return shader_watch(watcher, &scene->model_shader, GSL_SHADER_DIR "/instanced.vs", GSL_SHADER_DIR "/model.fs");
+}
+
+void scene_cull(Scene* scene, const Frustum* frustum) {
+    int count = (int)cull_spheres(frustum, &scene->bounds, 0, scene->instance_count, scene->visible);
+    for (int i = 0; i < count; i++) {
+        scene->visible_instances[i] = scene->instances[scene->visible[i]];
+    }
+    scene->visible_count = count;
+    scene->visible_dirty = 1;
+}
+
+void scene_profile(Scene* scene, GpuProfiler* profiler) {
+    scene->profiler = profiler;
+}
+
+void scene_draw(Scene* scene) {
+    // -- Style -- //
+    gpu_profiler_push(scene->profiler, "clear");
+    gl_state_clear_color(0.4f, 0.4f, 0.4f, 0.5f); // set the clear color
+    glClear(GL_COLOR_BUFFER_BIT);
+    gpu_profiler_pop(scene->profiler);
+
+    gpu_profiler_push(scene->profiler, "draw");
+    if (scene->visible_dirty) {
+        figure_set_instances(&scene->figure, scene->visible_instances, scene->visible_count);
+        scene->visible_dirty = 0;
+    }
+    if (scene->visible_count > 0) {
+        shader_use(&scene->model_shader); // use the shader program
+        figure_draw_instanced(&scene->figure); // draw every visible triangle
+    }
+    gpu_profiler_pop(scene->profiler);
+}
+
+void scene_destroy(Scene* scene) {
+    // -- Dealocate -- //
+    figure_destroy(&scene->figure); // delete the vertex array and buffer objects
+    shader_destroy(&scene->model_shader);
+    cull_spheres_free(&scene->bounds);
+    free(scene->instances);
+    free(scene->visible);
+    free(scene->visible_instances);
+    scene->instances = NULL;
+    scene->visible = NULL;
+    scene->visible_instances = NULL;
+}
@@ -2,90 +2,298 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "glad/glad.h"
-#include <GLFW/glfw3.h>
+#include "gl_state.h"
+#include "shader_cache.h"
+#include "timer.h"
+#include "file.h"
+#include "trace.h"
 #include <string.h>
+#include <errno.h>
 
+// -- Uniform table -- //
+static unsigned int uniform_hash(const char* name, size_t length) {
+    // FNV-1a, 0 is reserved for empty slots
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+    return hash ? hash : 1;
+}
 
-Shader create_shader(const char* vertexPath, const char* fragmentPath) {
-    Shader shader;
-    // 1. Retrieve shader code from files
-    FILE* vShaderFile = fopen(vertexPath, "rb");
-    FILE* fShaderFile = fopen(fragmentPath, "rb");
-
-    if (!vShaderFile || !fShaderFile) {
-        printf("ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ\n");
-        exit(EXIT_FAILURE);
+static void uniform_insert(Shader* shader, unsigned int name, unsigned int length, int location) {
+    unsigned int hash = uniform_hash(shader->uniform_names + name, length);
+    unsigned int slot = hash & shader->uniform_mask;
+    // names that share a hash take the next free slots, lookups compare the names
+    while (shader->uniforms[slot].hash != 0) {
+        slot = (slot + 1) & shader->uniform_mask;
+    }
+    shader->uniforms[slot].hash = hash;
+    shader->uniforms[slot].location = location;
+    shader->uniforms[slot].name = name;
+    shader->uniforms[slot].length = length;
+}
+
+static void load_uniforms(Shader* shader) {
+    int count = 0;
+    int max_length = 0;
+    glGetProgramiv(shader->ID, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(shader->ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+
+    // arrays get two entries ("name" and "name[0]"), keep the table at most half full
+    unsigned int size = 8;
+    while (size < (unsigned int)count * 4) {
+        size <<= 1;
+    }
+    shader->uniforms = (ShaderUniform*)calloc(size, sizeof(ShaderUniform));
+    shader->uniform_names = (char*)malloc((size_t)count * (max_length + 1) + 1);
+    if (!shader->uniforms || !shader->uniform_names) {
+        // every lookup goes to the driver
+        free(shader->uniforms);
+        free(shader->uniform_names);
+        shader->uniforms = NULL;
+        shader->uniform_names = NULL;
+        return;
     }
+    shader->uniform_mask = size - 1;
 
-    // Get file sizes
-    fseek(vShaderFile, 0, SEEK_END);
-    long vShaderSize = ftell(vShaderFile);
-    rewind(vShaderFile);
+    unsigned int used = 0;
+    for (int i = 0; i < count; i++) {
+        char* name = shader->uniform_names + used;
+        GLsizei length = 0;
+        GLint array_size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(shader->ID, i, max_length + 1, &length, &array_size, &type, name);
 
-    fseek(fShaderFile, 0, SEEK_END);
-    long fShaderSize = ftell(fShaderFile);
-    rewind(fShaderFile);
+        // uniform block members have no location
+        int location = glGetUniformLocation(shader->ID, name);
+        if (location < 0) {
+            continue;
+        }
+
+        uniform_insert(shader, used, length, location);
+        if (length > 3 && strcmp(name + length - 3, "[0]") == 0) {
+            uniform_insert(shader, used, length - 3, location);
+        }
+        used += length + 1;
+    }
+}
 
-    // Allocate buffers
-    char* vertexCode = (char*)malloc(vShaderSize + 1);
-    char* fragmentCode = (char*)malloc(fShaderSize + 1);
+// -- Creation -- //
+PendingShader shader_compile_async(const char* vertexCode, size_t vertexLength,
+                                   const char* fragmentCode, size_t fragmentLength) {
+    PendingShader pending = {0};
+    pending.start_ms = timer_now_ms();
 
-    // Read files
-    fread(vertexCode, 1, vShaderSize, vShaderFile);
-    fread(fragmentCode, 1, fShaderSize, fShaderFile);
-    vertexCode[vShaderSize] = '\0';
-    fragmentCode[fShaderSize] = '\0';
+    // 1. Try the program binary cache before compiling anything
+    pending.cache_key = shader_cache_key(vertexCode, vertexLength, fragmentCode, fragmentLength);
+    pending.program = glCreateProgram();
+    if (shader_cache_load(pending.cache_key, pending.program)) {
+        return pending;
+    }
 
-    fclose(vShaderFile);
-    fclose(fShaderFile);
+    // let the driver use as many compiler threads as it wants
+    if (GLAD_GL_KHR_parallel_shader_compile) {
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+    }
 
-    // 2. Compile shaders
-    unsigned int vertex, fragment;
-    int success;
-    char infoLog[512];
+    // 2. Submit both compiles and the link, nothing here waits for the compiler
 
     // Vertex shader
-    vertex = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertex, 1, (const char* const*)&vertexCode, NULL);
-    glCompileShader(vertex);
-    check_compile_errors(vertex, "VERTEX");
+    pending.vertex = glCreateShader(GL_VERTEX_SHADER);
+    GLint vertexSize = (GLint)vertexLength;
+    glShaderSource(pending.vertex, 1, &vertexCode, &vertexSize);
+    glCompileShader(pending.vertex);
 
     // Fragment shader
-    fragment = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragment, 1, (const char* const*)&fragmentCode, NULL);
-    glCompileShader(fragment);
-    check_compile_errors(fragment, "FRAGMENT");
+    pending.fragment = glCreateShader(GL_FRAGMENT_SHADER);
+    GLint fragmentSize = (GLint)fragmentLength;
+    glShaderSource(pending.fragment, 1, &fragmentCode, &fragmentSize);
+    glCompileShader(pending.fragment);
 
     // Shader program
-    shader.ID = glCreateProgram();
-    glAttachShader(shader.ID, vertex);
-    glAttachShader(shader.ID, fragment);
-    glLinkProgram(shader.ID);
-    check_compile_errors(shader.ID, "PROGRAM");
+    shader_cache_prepare(pending.program);
+    glAttachShader(pending.program, pending.vertex);
+    glAttachShader(pending.program, pending.fragment);
+    glLinkProgram(pending.program);
+
+    return pending;
+}
+
+PendingShader shader_create_async(const char* vertexPath, const char* fragmentPath) {
+    PendingShader pending = {0};
+    FileView vertexFile, fragmentFile;
+
+    TRACE_BEGIN("shader read");
+    if (file_load(vertexPath, &vertexFile) != 0) {
+        printf("ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ %s: %s\n", vertexPath, strerror(errno));
+        TRACE_END();
+        return pending;
+    }
+    if (file_load(fragmentPath, &fragmentFile) != 0) {
+        printf("ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ %s: %s\n", fragmentPath, strerror(errno));
+        file_release(&vertexFile);
+        TRACE_END();
+        return pending;
+    }
+    TRACE_END();
+
+    // GL keeps its own copy of the sources, the files can go right away
+    TRACE_BEGIN("shader compile");
+    pending = shader_compile_async(vertexFile.data, vertexFile.size, fragmentFile.data, fragmentFile.size);
+    TRACE_END();
+
+    file_release(&vertexFile);
+    file_release(&fragmentFile);
+    return pending;
+}
+
+int shader_poll(PendingShader* pending) {
+    // failed, loaded from the cache, or no way to ask without blocking
+    if (!pending->vertex || !GLAD_GL_KHR_parallel_shader_compile) {
+        return 1;
+    }
+    int done = 0;
+    glGetProgramiv(pending->program, GL_COMPLETION_STATUS_KHR, &done);
+    return done;
+}
+
+Shader shader_wait(PendingShader* pending) {
+    Shader shader = {0};
+    if (!pending->program) {
+        return shader;
+    }
+    shader.ID = pending->program;
+    TRACE_BEGIN("shader wait");
+
+    if (pending->vertex) {
+        // 3. First status query, this is where we block if the driver is not done
+        check_compile_errors(pending->vertex, "VERTEX");
+        check_compile_errors(pending->fragment, "FRAGMENT");
+        check_compile_errors(shader.ID, "PROGRAM");
 
-    // Delete the shaders
-    glDeleteShader(vertex);
-    glDeleteShader(fragment);
+        // Delete the shaders
+        glDetachShader(shader.ID, pending->vertex);
+        glDetachShader(shader.ID, pending->fragment);
+        glDeleteShader(pending->vertex);
+        glDeleteShader(pending->fragment);
 
-    free(vertexCode);
-    free(fragmentCode);
+        // for async creates this also counts whatever the caller did before waiting
+        shader_cache_store(pending->cache_key, shader.ID, timer_now_ms() - pending->start_ms);
+    }
+    load_uniforms(&shader);
+    TRACE_END();
+
+    pending->program = 0;
+    pending->vertex = 0;
+    pending->fragment = 0;
+    return shader;
+}
 
+Shader create_shader(const char* vertexPath, const char* fragmentPath) {
+    TRACE_BEGIN("create_shader");
+    PendingShader pending = shader_create_async(vertexPath, fragmentPath);
+    Shader shader = shader_wait(&pending);
+    TRACE_END();
     return shader;
 }
 
+void shader_destroy(Shader* shader) {
+    gl_state_delete_program(shader->ID);
+    free(shader->uniforms);
+    free(shader->uniform_names);
+    shader->ID = 0;
+    shader->uniforms = NULL;
+    shader->uniform_names = NULL;
+    shader->uniform_mask = 0;
+}
+
 void shader_use(Shader* shader) {
-    glUseProgram(shader->ID);
+    gl_state_use_program(shader->ID);
+}
+
+UniformHandle shader_uniform_handle(Shader* shader, const char* name) {
+    // hash and length in one pass
+    unsigned int hash = 2166136261u;
+    int indexed = 0;
+    const char* c = name;
+    for (; *c; c++) {
+        hash ^= (unsigned char)*c;
+        hash *= 16777619u;
+        indexed |= (*c == '[');
+    }
+    hash = hash ? hash : 1;
+    unsigned int length = (unsigned int)(c - name);
+
+    if (shader->uniforms) {
+        unsigned int slot = hash & shader->uniform_mask;
+        while (shader->uniforms[slot].hash != 0) {
+            const ShaderUniform* uniform = &shader->uniforms[slot];
+            // a hash hit alone could be a different (or misspelled) name
+            if (uniform->hash == hash && uniform->length == length &&
+                memcmp(shader->uniform_names + uniform->name, name, length) == 0) {
+                return uniform->location;
+            }
+            slot = (slot + 1) & shader->uniform_mask;
+        }
+        // only "name[0]" is in the table, other array elements go to the driver
+        if (!indexed) {
+            return -1;
+        }
+    }
+    return glGetUniformLocation(shader->ID, name);
 }
 
 void shader_set_bool(Shader* shader, const char* name, int value) {
-    glUniform1i(glGetUniformLocation(shader->ID, name), value);
+    glUniform1i(shader_uniform_handle(shader, name), value);
 }
 void shader_set_int(Shader* shader, const char* name, int value) {
-    glUniform1i(glGetUniformLocation(shader->ID, name), value);
+    glUniform1i(shader_uniform_handle(shader, name), value);
 }
 
 void shader_set_float(Shader* shader, const char* name, float value) {
-    glUniform1f(glGetUniformLocation(shader->ID, name), value);
+    glUniform1f(shader_uniform_handle(shader, name), value);
+}
+
+void shader_set_vec3(Shader* shader, const char* name, float x, float y, float z) {
+    glUniform3f(shader_uniform_handle(shader, name), x, y, z);
+}
+
+void shader_set_vec4(Shader* shader, const char* name, float x, float y, float z, float w) {
+    glUniform4f(shader_uniform_handle(shader, name), x, y, z, w);
+}
+
+void shader_set_mat4(Shader* shader, const char* name, const float* matrix) {
+    glUniformMatrix4fv(shader_uniform_handle(shader, name), 1, GL_FALSE, matrix);
+}
+
+void shader_set_bool_h(Shader* shader, UniformHandle handle, int value) {
+    (void)shader;
+    glUniform1i(handle, value);
+}
+void shader_set_int_h(Shader* shader, UniformHandle handle, int value) {
+    (void)shader;
+    glUniform1i(handle, value);
+}
+
+void shader_set_float_h(Shader* shader, UniformHandle handle, float value) {
+    (void)shader;
+    glUniform1f(handle, value);
+}
+
+void shader_set_vec3_h(Shader* shader, UniformHandle handle, float x, float y, float z) {
+    (void)shader;
+    glUniform3f(handle, x, y, z);
+}
+
+void shader_set_vec4_h(Shader* shader, UniformHandle handle, float x, float y, float z, float w) {
+    (void)shader;
+    glUniform4f(handle, x, y, z, w);
+}
+
+void shader_set_mat4_h(Shader* shader, UniformHandle handle, const float* matrix) {
+    (void)shader;
+    glUniformMatrix4fv(handle, 1, GL_FALSE, matrix);
 }
 
 void check_compile_errors(unsigned int shader, const char* type) {
@@ -0,0 +1,184 @@
+#include "shader_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include "glad/glad.h"
+#include "timer.h"
+
+#define CACHE_MAGIC 0x42534c47u // "GLSB"
+#define CACHE_VERSION 1u
+
+typedef struct {
+    unsigned int magic;
+    unsigned int version;
+    unsigned long long key;
+    unsigned int format;
+    unsigned int length;
+    double compile_ms;
+} CacheHeader;
+
+static ShaderCacheStats stats;
+
+// -- Helpers -- //
+static unsigned long long hash_bytes(unsigned long long hash, const void* data, size_t length) {
+    // 64 bit FNV-1a
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static unsigned long long hash_string(unsigned long long hash, const char* string) {
+    // the terminator is hashed too so "ab"+"c" and "a"+"bc" differ
+    return string ? hash_bytes(hash, string, strlen(string) + 1) : hash;
+}
+
+static int cache_supported(void) {
+    if (!glProgramBinary || !glGetProgramBinary || !glProgramParameteri) {
+        return 0;
+    }
+    int formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    return formats > 0;
+}
+
+static const char* cache_dir(void) {
+    const char* dir = getenv("GSL_SHADER_CACHE_DIR");
+#ifdef GSL_SHADER_CACHE_DIR
+    if (!dir) {
+        dir = GSL_SHADER_CACHE_DIR;
+    }
+#endif
+    if (!dir || dir[0] == '\0') {
+        return NULL;
+    }
+    if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+        return NULL;
+    }
+    return dir;
+}
+
+static int cache_path(char* path, size_t size, unsigned long long key) {
+    const char* dir = cache_dir();
+    if (!dir) {
+        return 0;
+    }
+    return snprintf(path, size, "%s/%016llx.bin", dir, key) < (int)size;
+}
+
+// -- Cache -- //
+unsigned long long shader_cache_key(const char* vertex_code, size_t vertex_length,
+                                    const char* fragment_code, size_t fragment_length) {
+    unsigned long long hash = 14695981039346656037ull;
+    hash = hash_bytes(hash, &vertex_length, sizeof(vertex_length));
+    hash = hash_bytes(hash, vertex_code, vertex_length);
+    hash = hash_bytes(hash, &fragment_length, sizeof(fragment_length));
+    hash = hash_bytes(hash, fragment_code, fragment_length);
+    hash = hash_string(hash, (const char*)glGetString(GL_VENDOR));
+    hash = hash_string(hash, (const char*)glGetString(GL_RENDERER));
+    hash = hash_string(hash, (const char*)glGetString(GL_VERSION));
+    return hash;
+}
+
+int shader_cache_load(unsigned long long key, unsigned int program) {
+    char path[1024];
+    if (!cache_supported() || !cache_path(path, sizeof(path), key)) {
+        stats.misses++;
+        return 0;
+    }
+
+    double start = timer_now_ms();
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        stats.misses++;
+        return 0;
+    }
+
+    CacheHeader header;
+    void* binary = NULL;
+    int loaded = 0;
+    if (fread(&header, sizeof(header), 1, file) == 1 &&
+        header.magic == CACHE_MAGIC && header.version == CACHE_VERSION && header.key == key) {
+        binary = malloc(header.length);
+        if (binary && fread(binary, 1, header.length, file) == header.length) {
+            glProgramBinary(program, header.format, binary, (GLsizei)header.length);
+            int success = 0;
+            glGetProgramiv(program, GL_LINK_STATUS, &success);
+            loaded = success ? 1 : -1;
+        }
+    }
+    free(binary);
+    fclose(file);
+
+    if (loaded > 0) {
+        double load_ms = timer_now_ms() - start;
+        stats.hits++;
+        stats.load_ms += load_ms;
+        stats.saved_ms += header.compile_ms - load_ms;
+        return 1;
+    }
+    if (loaded < 0) {
+        stats.rejected++;
+    }
+    stats.misses++;
+    return 0;
+}
+
+void shader_cache_prepare(unsigned int program) {
+    if (glProgramParameteri) {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+}
+
+void shader_cache_store(unsigned long long key, unsigned int program, double compile_ms) {
+    char path[1024];
+    char temp_path[1040];
+    if (!cache_supported() || !cache_path(path, sizeof(path), key)) {
+        return;
+    }
+
+    int success = 0;
+    int length = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (!success || length <= 0) {
+        return;
+    }
+
+    CacheHeader header = { CACHE_MAGIC, CACHE_VERSION, key, 0, 0, compile_ms };
+    void* binary = malloc(length);
+    if (!binary) {
+        return;
+    }
+    GLsizei written = 0;
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &written, &format, binary);
+    header.format = format;
+    header.length = (unsigned int)written;
+
+    // write next to the final file and rename, a crash never leaves half an entry
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+    FILE* file = fopen(temp_path, "wb");
+    if (file) {
+        int ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                 fwrite(binary, 1, header.length, file) == header.length;
+        ok = (fclose(file) == 0) && ok;
+        if (!ok || rename(temp_path, path) != 0) {
+            remove(temp_path);
+        }
+    }
+    free(binary);
+}
+
+ShaderCacheStats shader_cache_stats(void) {
+    return stats;
+}
+
+void shader_cache_report(void) {
+    printf("shader cache: %d hits, %d misses (%d rejected), %.2f ms saved\n",
+           stats.hits, stats.misses, stats.rejected, stats.saved_ms);
+}
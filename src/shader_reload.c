@@ -0,0 +1,238 @@
+#define _GNU_SOURCE // pipe2
+#include "shader_reload.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#include "glad/glad.h"
+#include "file.h"
+#include "timer.h"
+
+// -- Watcher thread -- //
+static void mark_changed(ShaderWatcher* watcher, int wd, const char* name, double now) {
+    pthread_mutex_lock(&watcher->mutex);
+    for (int i = 0; i < watcher->count; i++) {
+        WatchedShader* entry = &watcher->shaders[i];
+        int vertex = entry->vertex_wd == wd && strcmp(entry->vertex_name, name) == 0;
+        int fragment = entry->fragment_wd == wd && strcmp(entry->fragment_name, name) == 0;
+        if ((vertex || fragment) && !entry->dirty) {
+            entry->dirty = 1;
+            entry->changed_ms = now;
+        }
+    }
+    pthread_mutex_unlock(&watcher->mutex);
+}
+
+static void* watcher_thread(void* arg) {
+    ShaderWatcher* watcher = (ShaderWatcher*)arg;
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    for (;;) {
+        struct pollfd fds[2] = {
+            { watcher->inotify_fd, POLLIN, 0 },
+            { watcher->wake_fds[0], POLLIN, 0 },
+        };
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (fds[1].revents) {
+            break;
+        }
+
+        ssize_t length = read(watcher->inotify_fd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            continue;
+        }
+        double now = timer_now_ms();
+
+        for (char* p = buffer; p < buffer + length;) {
+            struct inotify_event* event = (struct inotify_event*)p;
+            if (event->len > 0) {
+                mark_changed(watcher, event->wd, event->name, now);
+            }
+            p += sizeof(struct inotify_event) + event->len;
+        }
+    }
+    return NULL;
+}
+
+// -- Registration -- //
+static int watch_file(ShaderWatcher* watcher, char* path, const char** name) {
+    // editors often write a new file and rename it over the old one, so the
+    // directory is watched instead of the file itself
+    char dir[SHADER_WATCH_PATH_MAX];
+    char* slash = strrchr(path, '/');
+    if (slash) {
+        snprintf(dir, sizeof(dir), "%.*s", (int)(slash - path), path);
+        if (dir[0] == '\0') {
+            strcpy(dir, "/");
+        }
+        *name = slash + 1;
+    } else {
+        strcpy(dir, ".");
+        *name = path;
+    }
+    return inotify_add_watch(watcher->inotify_fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+}
+
+int shader_watcher_start(ShaderWatcher* watcher) {
+    memset(watcher, 0, sizeof(*watcher));
+    watcher->inotify_fd = inotify_init1(IN_CLOEXEC);
+    if (watcher->inotify_fd < 0) {
+        printf("ERROR::SHADER_RELOAD::INOTIFY_FAILED %s\n", strerror(errno));
+        return -1;
+    }
+    if (pipe2(watcher->wake_fds, O_CLOEXEC) != 0) {
+        printf("ERROR::SHADER_RELOAD::PIPE_FAILED %s\n", strerror(errno));
+        close(watcher->inotify_fd);
+        return -1;
+    }
+    pthread_mutex_init(&watcher->mutex, NULL);
+    if (pthread_create(&watcher->thread, NULL, watcher_thread, watcher) != 0) {
+        printf("ERROR::SHADER_RELOAD::THREAD_FAILED\n");
+        pthread_mutex_destroy(&watcher->mutex);
+        close(watcher->wake_fds[0]);
+        close(watcher->wake_fds[1]);
+        close(watcher->inotify_fd);
+        return -1;
+    }
+    watcher->running = 1;
+    return 0;
+}
+
+int shader_watch(ShaderWatcher* watcher, Shader* shader, const char* vertex_path, const char* fragment_path) {
+    if (!watcher->running || watcher->count == SHADER_WATCH_MAX) {
+        return -1;
+    }
+
+    pthread_mutex_lock(&watcher->mutex);
+    WatchedShader* entry = &watcher->shaders[watcher->count];
+    memset(entry, 0, sizeof(*entry));
+    entry->shader = shader;
+    snprintf(entry->vertex_path, sizeof(entry->vertex_path), "%s", vertex_path);
+    snprintf(entry->fragment_path, sizeof(entry->fragment_path), "%s", fragment_path);
+    entry->vertex_wd = watch_file(watcher, entry->vertex_path, &entry->vertex_name);
+    entry->fragment_wd = watch_file(watcher, entry->fragment_path, &entry->fragment_name);
+
+    int result = -1;
+    if (entry->vertex_wd >= 0 && entry->fragment_wd >= 0) {
+        watcher->count++;
+        result = 0;
+    } else {
+        printf("ERROR::SHADER_RELOAD::WATCH_FAILED %s\n", strerror(errno));
+    }
+    pthread_mutex_unlock(&watcher->mutex);
+    return result;
+}
+
+// -- Frame boundary -- //
+static void submit_rebuild(WatchedShader* entry) {
+    FileView vertex, fragment;
+    // the file may be mid-rename, the next event will bring us back here
+    if (file_load(entry->vertex_path, &vertex) != 0) {
+        return;
+    }
+    if (file_load(entry->fragment_path, &fragment) != 0) {
+        file_release(&vertex);
+        return;
+    }
+    entry->pending = shader_compile_async(vertex.data, vertex.size, fragment.data, fragment.size);
+    entry->compiling = 1;
+    file_release(&vertex);
+    file_release(&fragment);
+}
+
+static int finish_rebuild(WatchedShader* entry) {
+    entry->compiling = 0;
+    Shader rebuilt = shader_wait(&entry->pending);
+
+    int linked = 0;
+    glGetProgramiv(rebuilt.ID, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        printf("shader reload: %s + %s failed, keeping the previous program\n",
+               entry->vertex_name, entry->fragment_name);
+        shader_destroy(&rebuilt);
+        return 0;
+    }
+
+    shader_destroy(entry->shader);
+    *entry->shader = rebuilt;
+    // the latency runs until this frame has been drawn and swapped
+    entry->presented = 1;
+    return 1;
+}
+
+int shader_watcher_update(ShaderWatcher* watcher) {
+    int swapped = 0;
+    if (!watcher->running) {
+        return 0;
+    }
+
+    for (int i = 0; i < watcher->count; i++) {
+        WatchedShader* entry = &watcher->shaders[i];
+
+        if (entry->compiling && shader_poll(&entry->pending)) {
+            swapped += finish_rebuild(entry);
+        }
+        if (entry->compiling) {
+            continue;
+        }
+
+        pthread_mutex_lock(&watcher->mutex);
+        int dirty = entry->dirty;
+        double changed_ms = entry->changed_ms;
+        entry->dirty = 0;
+        pthread_mutex_unlock(&watcher->mutex);
+
+        if (dirty) {
+            entry->compile_changed_ms = changed_ms;
+            submit_rebuild(entry);
+        }
+    }
+    return swapped;
+}
+
+int shader_watcher_frame_end(ShaderWatcher* watcher) {
+    int presented = 0;
+    for (int i = 0; i < watcher->count; i++) {
+        WatchedShader* entry = &watcher->shaders[i];
+        if (!entry->presented) {
+            continue;
+        }
+        entry->presented = 0;
+        watcher->last_latency_ms = timer_now_ms() - entry->compile_changed_ms;
+        printf("shader reload: %s + %s on screen %.2f ms after the write\n",
+               entry->vertex_name, entry->fragment_name, watcher->last_latency_ms);
+        presented++;
+    }
+    return presented;
+}
+
+void shader_watcher_stop(ShaderWatcher* watcher) {
+    if (!watcher->running) {
+        return;
+    }
+    ssize_t written = write(watcher->wake_fds[1], "x", 1);
+    (void)written;
+    pthread_join(watcher->thread, NULL);
+
+    for (int i = 0; i < watcher->count; i++) {
+        if (watcher->shaders[i].compiling) {
+            Shader abandoned = shader_wait(&watcher->shaders[i].pending);
+            shader_destroy(&abandoned);
+        }
+    }
+
+    close(watcher->wake_fds[0]);
+    close(watcher->wake_fds[1]);
+    close(watcher->inotify_fd);
+    pthread_mutex_destroy(&watcher->mutex);
+    watcher->running = 0;
+}
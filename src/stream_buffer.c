@@ -0,0 +1,110 @@
+#include "stream_buffer.h"
+#include <stdio.h>
+#include <string.h>
+#include "gl_state.h"
+#include "timer.h"
+
+static void bind(StreamBuffer* stream) {
+    // the array and element targets go through the state cache
+    gl_state_bind_buffer(stream->target, stream->buffer);
+}
+
+int stream_buffer_init(StreamBuffer* stream, GLenum target, GLsizeiptr frame_size, int allow_persistent) {
+    memset(stream, 0, sizeof(*stream));
+    stream->target = target;
+    stream->frame_size = frame_size;
+    stream->persistent = allow_persistent && GLAD_GL_VERSION_4_4 && glBufferStorage;
+
+    glGenBuffers(1, &stream->buffer);
+    bind(stream);
+
+    if (stream->persistent) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        GLsizeiptr size = frame_size * STREAM_BUFFER_FRAMES;
+        glBufferStorage(target, size, NULL, flags);
+        stream->mapped = (char*)glMapBufferRange(target, 0, size, flags);
+        if (!stream->mapped) {
+            printf("ERROR::STREAM_BUFFER::PERSISTENT_MAP_FAILED\n");
+            stream_buffer_destroy(stream);
+            return -1;
+        }
+    } else {
+        glBufferData(target, frame_size, NULL, GL_STREAM_DRAW);
+    }
+    return 0;
+}
+
+void stream_buffer_begin(StreamBuffer* stream) {
+    stream->offset = 0;
+
+    if (!stream->persistent) {
+        // orphan: the driver hands us fresh storage while the GPU reads the old one
+        bind(stream);
+        glBufferData(stream->target, stream->frame_size, NULL, GL_STREAM_DRAW);
+        stream->mapped = (char*)glMapBufferRange(stream->target, 0, stream->frame_size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        return;
+    }
+
+    // everything issued so far may read the region we just finished
+    if (stream->started) {
+        stream->fences[stream->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        stream->frame = (stream->frame + 1) % STREAM_BUFFER_FRAMES;
+    }
+    stream->started = 1;
+
+    GLsync fence = stream->fences[stream->frame];
+    if (fence) {
+        double start = timer_now_ms();
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        while (result == GL_TIMEOUT_EXPIRED) {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+        }
+        stream->stall_ms += timer_now_ms() - start;
+        glDeleteSync(fence);
+        stream->fences[stream->frame] = NULL;
+    }
+}
+
+void* stream_buffer_alloc(StreamBuffer* stream, GLsizeiptr size, GLsizeiptr alignment, GLintptr* offset) {
+    if (!stream->mapped) {
+        return NULL;
+    }
+    GLsizeiptr start = stream->offset;
+    if (alignment > 1) {
+        start = (start + alignment - 1) / alignment * alignment;
+    }
+    if (start + size > stream->frame_size) {
+        return NULL;
+    }
+    stream->offset = start + size;
+
+    GLsizeiptr base = stream->persistent ? stream->frame * stream->frame_size : 0;
+    *offset = base + start;
+    return stream->mapped + base + start;
+}
+
+void stream_buffer_commit(StreamBuffer* stream) {
+    // coherent persistent mappings are visible without doing anything
+    if (!stream->persistent && stream->mapped) {
+        bind(stream);
+        glUnmapBuffer(stream->target);
+        stream->mapped = NULL;
+    }
+}
+
+void stream_buffer_destroy(StreamBuffer* stream) {
+    for (int i = 0; i < STREAM_BUFFER_FRAMES; i++) {
+        if (stream->fences[i]) {
+            glDeleteSync(stream->fences[i]);
+        }
+    }
+    if (stream->buffer) {
+        if (stream->mapped) {
+            bind(stream);
+            glUnmapBuffer(stream->target);
+        }
+        gl_state_delete_buffers(1, &stream->buffer);
+    }
+    memset(stream, 0, sizeof(*stream));
+}
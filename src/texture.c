@@ -0,0 +1,306 @@
+#include "texture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "file.h"
+#include "timer.h"
+#include "trace.h"
+#ifdef GSL_HAS_PNG
+#include <png.h>
+#endif
+
+#define DEFAULT_UPLOAD_BUDGET (16u << 20)
+
+// -- Decoding (any thread) -- //
+unsigned char* texture_decode_png(const char* path, int* width, int* height, size_t* file_bytes) {
+    FileView file;
+    if (file_load(path, &file) != 0) {
+        printf("ERROR::TEXTURE::FILE_NOT_READ %s\n", path);
+        return NULL;
+    }
+    if (file_bytes) {
+        *file_bytes = file.size;
+    }
+#ifdef GSL_HAS_PNG
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    unsigned char* pixels = NULL;
+    if (png_image_begin_read_from_memory(&image, file.data, file.size)) {
+        image.format = PNG_FORMAT_RGBA;
+        pixels = (unsigned char*)malloc(PNG_IMAGE_SIZE(image));
+        // a negative stride stores the rows bottom first, where GL puts row 0
+        if (pixels && !png_image_finish_read(&image, NULL, pixels, -(png_int_32)PNG_IMAGE_ROW_STRIDE(image), NULL)) {
+            free(pixels);
+            pixels = NULL;
+        }
+    }
+    if (!pixels) {
+        printf("ERROR::TEXTURE::DECODE_FAILED %s: %s\n", path, image.message[0] ? image.message : "out of memory");
+    }
+    png_image_free(&image);
+    file_release(&file);
+    *width = (int)image.width;
+    *height = (int)image.height;
+    return pixels;
+#else
+    file_release(&file);
+    *width = 0;
+    *height = 0;
+    printf("ERROR::TEXTURE::PNG_NOT_COMPILED %s (libpng was not found)\n", path);
+    return NULL;
+#endif
+}
+
+static void decode_job(void* data) {
+    TextureSlot* slot = (TextureSlot*)data;
+    TRACE_BEGIN("texture decode");
+    double start = timer_now_ms();
+    slot->pixels = texture_decode_png(slot->path, &slot->width, &slot->height, &slot->file_bytes);
+    slot->decode_ms = timer_now_ms() - start;
+    TRACE_END();
+    atomic_store_explicit(&slot->state, slot->pixels ? TEXTURE_DECODED : TEXTURE_FAILED, memory_order_release);
+}
+
+// -- Loader -- //
+static GLuint create_placeholder(void) {
+    static const unsigned char checker[] = {
+        128, 128, 128, 255,   255, 0, 255, 255,
+        255, 0, 255, 255,     128, 128, 128, 255,
+    };
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, checker);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return texture;
+}
+
+int texture_loader_init(TextureLoader* loader, JobSystem* jobs, int capacity, int max_decoding, size_t upload_budget) {
+    memset(loader, 0, sizeof(*loader));
+    loader->slots = (TextureSlot*)calloc(capacity > 0 ? capacity : 1, sizeof(TextureSlot));
+    if (!loader->slots) {
+        printf("ERROR::TEXTURE::OUT_OF_MEMORY\n");
+        return -1;
+    }
+    // worker 0 only runs jobs while it waits, alone it would never decode
+    loader->jobs = jobs && (jobs->submitter || jobs->worker_count > 1) ? jobs : NULL;
+    loader->capacity = capacity;
+    loader->max_decoding = max_decoding > 0 ? max_decoding : 2 * (loader->jobs ? jobs->worker_count : 1);
+    loader->upload_budget = upload_budget ? upload_budget : DEFAULT_UPLOAD_BUDGET;
+
+    GLuint buffers[TEXTURE_UPLOAD_BUFFERS];
+    glGenBuffers(TEXTURE_UPLOAD_BUFFERS, buffers);
+    for (int i = 0; i < TEXTURE_UPLOAD_BUFFERS; i++) {
+        loader->uploads[i].buffer = buffers[i];
+        loader->uploads[i].slot = -1;
+    }
+    loader->placeholder = create_placeholder();
+    return 0;
+}
+
+void texture_loader_destroy(TextureLoader* loader) {
+    if (loader->jobs) {
+        job_wait(loader->jobs, &loader->decodes);
+    }
+    for (int i = 0; i < TEXTURE_UPLOAD_BUFFERS; i++) {
+        if (loader->uploads[i].fence) {
+            glDeleteSync(loader->uploads[i].fence);
+        }
+        glDeleteBuffers(1, &loader->uploads[i].buffer);
+    }
+    for (int i = 0; i < loader->slot_count; i++) {
+        TextureSlot* slot = &loader->slots[i];
+        if (slot->texture) {
+            glDeleteTextures(1, &slot->texture);
+        }
+        free(slot->pixels);
+        free(slot->path);
+    }
+    glDeleteTextures(1, &loader->placeholder);
+    free(loader->slots);
+    memset(loader, 0, sizeof(*loader));
+}
+
+TextureHandle texture_load(TextureLoader* loader, const char* path) {
+    if (loader->slot_count == loader->capacity) {
+        printf("ERROR::TEXTURE::LOADER_FULL %s\n", path);
+        return -1;
+    }
+    TextureSlot* slot = &loader->slots[loader->slot_count];
+    size_t length = strlen(path) + 1;
+    slot->path = (char*)malloc(length);
+    if (!slot->path) {
+        printf("ERROR::TEXTURE::OUT_OF_MEMORY\n");
+        return -1;
+    }
+    memcpy(slot->path, path, length);
+    atomic_store(&slot->state, TEXTURE_QUEUED);
+    loader->stats.requested++;
+    return loader->slot_count++;
+}
+
+// -- Upload (GL thread) -- //
+static int mip_levels(int width, int height) {
+    int size = width > height ? width : height;
+    int levels = 1;
+    while (size > 1) {
+        size >>= 1;
+        levels++;
+    }
+    return levels;
+}
+
+static void start_upload(TextureLoader* loader, TextureUpload* upload, int index) {
+    TextureSlot* slot = &loader->slots[index];
+    GLsizeiptr size = (GLsizeiptr)slot->width * slot->height * 4;
+
+    glGenTextures(1, &slot->texture);
+    glBindTexture(GL_TEXTURE_2D, slot->texture);
+    if (GLAD_GL_VERSION_4_2) {
+        glTexStorage2D(GL_TEXTURE_2D, mip_levels(slot->width, slot->height), GL_RGBA8, slot->width, slot->height);
+    } else {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, slot->width, slot->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    }
+
+    // orphaning gives a fresh buffer even if the GPU still reads the last upload
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, upload->buffer);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+    void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (mapped) {
+        memcpy(mapped, slot->pixels, size);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, slot->width, slot->height, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)0);
+    } else {
+        // without a mapping the copy happens here, still correct, only slower
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, slot->width, slot->height, GL_RGBA, GL_UNSIGNED_BYTE, slot->pixels);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    upload->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    upload->slot = index;
+    atomic_store(&slot->state, TEXTURE_UPLOADING);
+
+    loader->stats.file_bytes += slot->file_bytes;
+    loader->stats.pixel_bytes += (uint64_t)size;
+    loader->stats.decode_ms += slot->decode_ms;
+    free(slot->pixels);
+    slot->pixels = NULL;
+    loader->in_flight--;
+}
+
+static TextureUpload* free_upload(TextureLoader* loader) {
+    for (int i = 0; i < TEXTURE_UPLOAD_BUFFERS; i++) {
+        if (!loader->uploads[i].fence) {
+            return &loader->uploads[i];
+        }
+    }
+    return NULL;
+}
+
+void texture_loader_update(TextureLoader* loader) {
+    TRACE_BEGIN("texture update");
+    double start = timer_now_ms();
+
+    // -- Finished uploads -- //
+    for (int i = 0; i < TEXTURE_UPLOAD_BUFFERS; i++) {
+        TextureUpload* upload = &loader->uploads[i];
+        if (upload->fence && glClientWaitSync(upload->fence, 0, 0) != GL_TIMEOUT_EXPIRED) {
+            glDeleteSync(upload->fence);
+            upload->fence = NULL;
+            atomic_store(&loader->slots[upload->slot].state, TEXTURE_READY);
+            loader->stats.ready++;
+            upload->slot = -1;
+        }
+    }
+
+    // -- New decodes -- //
+    while (loader->next_decode < loader->slot_count && loader->in_flight < loader->max_decoding) {
+        TextureSlot* slot = &loader->slots[loader->next_decode++];
+        atomic_store(&slot->state, TEXTURE_DECODING);
+        loader->in_flight++;
+        if (loader->jobs) {
+            job_run(loader->jobs, decode_job, slot, &loader->decodes);
+        } else {
+            decode_job(slot);
+        }
+    }
+
+    // -- Uploads, in load order as far as decoding allows -- //
+    size_t uploaded = 0;
+    for (int i = loader->next_upload; i < loader->next_decode && uploaded < loader->upload_budget; i++) {
+        TextureSlot* slot = &loader->slots[i];
+        int state = atomic_load_explicit(&slot->state, memory_order_acquire);
+        if (state == TEXTURE_FAILED && !slot->counted) {
+            slot->counted = 1;
+            loader->stats.failed++;
+            loader->in_flight--;
+        } else if (state == TEXTURE_DECODED) {
+            TextureUpload* upload = free_upload(loader);
+            if (!upload) {
+                break;
+            }
+            uploaded += (size_t)slot->width * slot->height * 4;
+            start_upload(loader, upload, i);
+        }
+        if (i == loader->next_upload && state != TEXTURE_DECODING && state != TEXTURE_DECODED) {
+            loader->next_upload++;
+        }
+    }
+
+    double elapsed = timer_now_ms() - start;
+    loader->stats.upload_ms += elapsed;
+    loader->stats.max_update_ms = elapsed > loader->stats.max_update_ms ? elapsed : loader->stats.max_update_ms;
+    TRACE_END();
+}
+
+int texture_loader_idle(const TextureLoader* loader) {
+    return loader->stats.ready + loader->stats.failed == loader->stats.requested;
+}
+
+void texture_loader_finish(TextureLoader* loader) {
+    while (!texture_loader_idle(loader)) {
+        texture_loader_update(loader);
+        if (texture_loader_idle(loader)) {
+            break;
+        }
+        // decodes first; once they are done only uploads are left to wait for
+        if (loader->jobs && atomic_load(&loader->decodes.pending) > 0) {
+            job_wait(loader->jobs, &loader->decodes);
+        } else {
+            glFinish();
+        }
+    }
+}
+
+// -- Lookup -- //
+GLuint texture_get(const TextureLoader* loader, TextureHandle handle) {
+    if (handle < 0 || handle >= loader->slot_count) {
+        return loader->placeholder;
+    }
+    const TextureSlot* slot = &loader->slots[handle];
+    return atomic_load(&slot->state) == TEXTURE_READY ? slot->texture : loader->placeholder;
+}
+
+TextureState texture_state(const TextureLoader* loader, TextureHandle handle) {
+    if (handle < 0 || handle >= loader->slot_count) {
+        return TEXTURE_FAILED;
+    }
+    return (TextureState)atomic_load(&loader->slots[handle].state);
+}
+
+TextureLoaderStats texture_loader_stats(const TextureLoader* loader) {
+    return loader->stats;
+}
@@ -0,0 +1,8 @@
+#include "timer.h"
+#include <time.h>
+
+double timer_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
@@ -0,0 +1,183 @@
+#include "trace.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static _Atomic(TraceRing*) rings = NULL;
+static atomic_int next_thread_id = 1;
+static atomic_int enabled = 0;
+static _Thread_local TraceRing* thread_ring = NULL;
+static _Thread_local const char* thread_name = NULL;
+static pthread_once_t exit_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t exit_key;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// -- Rings -- //
+static void release_ring(void* data) {
+    TraceRing* ring = (TraceRing*)data;
+    atomic_store_explicit(&ring->owned, 0, memory_order_release);
+}
+
+static void create_exit_key(void) {
+    pthread_key_create(&exit_key, release_ring);
+}
+
+// a ring left by an exited thread, NULL when there is none
+static TraceRing* take_free_ring(void) {
+    for (TraceRing* ring = atomic_load(&rings); ring; ring = ring->next) {
+        int owned = 0;
+        if (atomic_compare_exchange_strong(&ring->owned, &owned, 1)) {
+            atomic_store_explicit(&ring->written, 0, memory_order_relaxed);
+            return ring;
+        }
+    }
+    return NULL;
+}
+
+static TraceRing* get_ring(void) {
+    if (thread_ring) {
+        return thread_ring;
+    }
+    TraceRing* ring = take_free_ring();
+    if (!ring) {
+        ring = (TraceRing*)calloc(1, sizeof(TraceRing));
+        if (!ring) {
+            printf("ERROR::TRACE::OUT_OF_MEMORY\n");
+            return NULL;
+        }
+        atomic_init(&ring->owned, 1);
+        TraceRing* head = atomic_load(&rings);
+        do {
+            ring->next = head;
+        } while (!atomic_compare_exchange_weak(&rings, &head, ring));
+    }
+    ring->thread_id = atomic_fetch_add(&next_thread_id, 1);
+    ring->thread_name = thread_name;
+
+    // hands the ring back when the thread exits
+    pthread_once(&exit_key_once, create_exit_key);
+    pthread_setspecific(exit_key, ring);
+    thread_ring = ring;
+    return ring;
+}
+
+static void record(const char* name) {
+    if (!atomic_load_explicit(&enabled, memory_order_relaxed)) {
+        return;
+    }
+    TraceRing* ring = get_ring();
+    if (!ring) {
+        return;
+    }
+    // only this thread writes the ring
+    unsigned long written = atomic_load_explicit(&ring->written, memory_order_relaxed);
+    TraceEvent* event = &ring->events[written & (TRACE_RING_SIZE - 1)];
+    event->time_ns = now_ns();
+    event->name = name;
+    atomic_store_explicit(&ring->written, written + 1, memory_order_release);
+}
+
+void trace_begin(const char* name) {
+    record(name);
+}
+
+void trace_end(void) {
+    record(NULL);
+}
+
+void trace_thread_name(const char* name) {
+    thread_name = name;
+    if (thread_ring) {
+        thread_ring->thread_name = name;
+    }
+}
+
+void trace_set_enabled(int on) {
+    atomic_store(&enabled, on != 0);
+}
+
+int trace_enabled(void) {
+    return atomic_load(&enabled);
+}
+
+// -- Chrome trace -- //
+static void write_string(FILE* file, const char* text) {
+    fputc('"', file);
+    for (const char* c = text; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', file);
+        }
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+static void write_ring(FILE* file, const TraceRing* ring, uint64_t origin_ns, int* first) {
+    unsigned long written = atomic_load_explicit(&ring->written, memory_order_acquire);
+    unsigned long begin = written > TRACE_RING_SIZE ? written - TRACE_RING_SIZE : 0;
+
+    if (ring->thread_name) {
+        fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", *first ? "" : ",", ring->thread_id);
+        write_string(file, ring->thread_name);
+        fprintf(file, "}}");
+        *first = 0;
+    }
+
+    // ends whose begin was overwritten are skipped, open zones are closed at the last event
+    int depth = 0;
+    uint64_t last_ns = origin_ns;
+    for (unsigned long i = begin; i < written; i++) {
+        const TraceEvent* event = &ring->events[i & (TRACE_RING_SIZE - 1)];
+        if (!event->name && depth == 0) {
+            continue;
+        }
+        depth += event->name ? 1 : -1;
+        last_ns = event->time_ns > last_ns ? event->time_ns : last_ns;
+
+        fprintf(file, "%s\n{\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%.3f", *first ? "" : ",",
+                event->name ? 'B' : 'E', ring->thread_id, (event->time_ns - origin_ns) / 1e3);
+        if (event->name) {
+            fprintf(file, ",\"name\":");
+            write_string(file, event->name);
+        }
+        fprintf(file, "}");
+        *first = 0;
+    }
+    for (; depth > 0; depth--) {
+        fprintf(file, ",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%d,\"ts\":%.3f}", ring->thread_id, (last_ns - origin_ns) / 1e3);
+    }
+}
+
+int trace_write_chrome(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("ERROR::TRACE::FILE_NOT_WRITTEN %s\n", path);
+        return -1;
+    }
+
+    // timestamps relative to the oldest event still in a ring
+    uint64_t origin_ns = UINT64_MAX;
+    for (TraceRing* ring = atomic_load(&rings); ring; ring = ring->next) {
+        unsigned long written = atomic_load_explicit(&ring->written, memory_order_acquire);
+        if (written) {
+            unsigned long oldest = written > TRACE_RING_SIZE ? written - TRACE_RING_SIZE : 0;
+            uint64_t time_ns = ring->events[oldest & (TRACE_RING_SIZE - 1)].time_ns;
+            origin_ns = time_ns < origin_ns ? time_ns : origin_ns;
+        }
+    }
+    origin_ns = origin_ns == UINT64_MAX ? 0 : origin_ns;
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    int first = 1;
+    for (TraceRing* ring = atomic_load(&rings); ring; ring = ring->next) {
+        write_ring(file, ring, origin_ns, &first);
+    }
+    fprintf(file, "\n]}\n");
+    return fclose(file) == 0 ? 0 : -1;
+}
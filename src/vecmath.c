@@ -0,0 +1,483 @@
+#include "vecmath.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VECMATH_X86 1
+#include <immintrin.h>
+#endif
+
+// -- Vectors -- //
+Vec3 vec3_add(Vec3 a, Vec3 b) {
+    return (Vec3){ a.x + b.x, a.y + b.y, a.z + b.z };
+}
+
+Vec3 vec3_sub(Vec3 a, Vec3 b) {
+    return (Vec3){ a.x - b.x, a.y - b.y, a.z - b.z };
+}
+
+Vec3 vec3_scale(Vec3 v, float s) {
+    return (Vec3){ v.x * s, v.y * s, v.z * s };
+}
+
+float vec3_dot(Vec3 a, Vec3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+Vec3 vec3_cross(Vec3 a, Vec3 b) {
+    return (Vec3){ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+float vec3_length(Vec3 v) {
+    return sqrtf(vec3_dot(v, v));
+}
+
+Vec3 vec3_normalize(Vec3 v) {
+    float length = vec3_length(v);
+    return length > 0.0f ? vec3_scale(v, 1.0f / length) : v;
+}
+
+// -- Quaternions -- //
+Quat quat_identity(void) {
+    return (Quat){ 0.0f, 0.0f, 0.0f, 1.0f };
+}
+
+Quat quat_from_axis_angle(Vec3 axis, float radians) {
+    Vec3 n = vec3_normalize(axis);
+    float s = sinf(radians * 0.5f);
+    return (Quat){ n.x * s, n.y * s, n.z * s, cosf(radians * 0.5f) };
+}
+
+Quat quat_mul(Quat a, Quat b) {
+    return (Quat){
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+    };
+}
+
+Quat quat_normalize(Quat q) {
+    float length = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    if (length <= 0.0f) {
+        return quat_identity();
+    }
+    float inv = 1.0f / length;
+    return (Quat){ q.x * inv, q.y * inv, q.z * inv, q.w * inv };
+}
+
+Vec3 quat_rotate(Quat q, Vec3 v) {
+    // v + 2w (u x v) + 2 u x (u x v), u = q.xyz
+    Vec3 u = { q.x, q.y, q.z };
+    Vec3 t = vec3_scale(vec3_cross(u, v), 2.0f);
+    return vec3_add(vec3_add(v, vec3_scale(t, q.w)), vec3_cross(u, t));
+}
+
+// -- Matrices -- //
+Mat4 mat4_identity(void) {
+    Mat4 m;
+    memset(&m, 0, sizeof(m));
+    m.m[0] = m.m[5] = m.m[10] = m.m[15] = 1.0f;
+    return m;
+}
+
+Mat4 mat4_mul(const Mat4* a, const Mat4* b) {
+    Mat4 out;
+    for (int column = 0; column < 4; column++) {
+        for (int row = 0; row < 4; row++) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; k++) {
+                sum += a->m[k * 4 + row] * b->m[column * 4 + k];
+            }
+            out.m[column * 4 + row] = sum;
+        }
+    }
+    return out;
+}
+
+Vec4 mat4_mul_vec4(const Mat4* m, Vec4 v) {
+    const float* c = m->m;
+    return (Vec4){
+        c[0] * v.x + c[4] * v.y + c[8] * v.z + c[12] * v.w,
+        c[1] * v.x + c[5] * v.y + c[9] * v.z + c[13] * v.w,
+        c[2] * v.x + c[6] * v.y + c[10] * v.z + c[14] * v.w,
+        c[3] * v.x + c[7] * v.y + c[11] * v.z + c[15] * v.w,
+    };
+}
+
+Mat4 mat4_translation(Vec3 t) {
+    Mat4 m = mat4_identity();
+    m.m[12] = t.x;
+    m.m[13] = t.y;
+    m.m[14] = t.z;
+    return m;
+}
+
+Mat4 mat4_scaling(Vec3 s) {
+    Mat4 m = mat4_identity();
+    m.m[0] = s.x;
+    m.m[5] = s.y;
+    m.m[10] = s.z;
+    return m;
+}
+
+Mat4 mat4_from_quat(Quat q) {
+    return mat4_from_trs((Vec3){ 0.0f, 0.0f, 0.0f }, q, (Vec3){ 1.0f, 1.0f, 1.0f });
+}
+
+Mat4 mat4_from_trs(Vec3 t, Quat r, Vec3 s) {
+    float xx = r.x * r.x, yy = r.y * r.y, zz = r.z * r.z;
+    float xy = r.x * r.y, xz = r.x * r.z, yz = r.y * r.z;
+    float wx = r.w * r.x, wy = r.w * r.y, wz = r.w * r.z;
+
+    Mat4 m;
+    m.m[0] = (1.0f - 2.0f * (yy + zz)) * s.x;
+    m.m[1] = 2.0f * (xy + wz) * s.x;
+    m.m[2] = 2.0f * (xz - wy) * s.x;
+    m.m[3] = 0.0f;
+    m.m[4] = 2.0f * (xy - wz) * s.y;
+    m.m[5] = (1.0f - 2.0f * (xx + zz)) * s.y;
+    m.m[6] = 2.0f * (yz + wx) * s.y;
+    m.m[7] = 0.0f;
+    m.m[8] = 2.0f * (xz + wy) * s.z;
+    m.m[9] = 2.0f * (yz - wx) * s.z;
+    m.m[10] = (1.0f - 2.0f * (xx + yy)) * s.z;
+    m.m[11] = 0.0f;
+    m.m[12] = t.x;
+    m.m[13] = t.y;
+    m.m[14] = t.z;
+    m.m[15] = 1.0f;
+    return m;
+}
+
+Mat4 mat4_perspective(float fovy_radians, float aspect, float near, float far) {
+    float f = 1.0f / tanf(fovy_radians * 0.5f);
+    Mat4 m;
+    memset(&m, 0, sizeof(m));
+    m.m[0] = f / aspect;
+    m.m[5] = f;
+    m.m[10] = (far + near) / (near - far);
+    m.m[11] = -1.0f;
+    m.m[14] = 2.0f * far * near / (near - far);
+    return m;
+}
+
+Mat4 mat4_ortho(float left, float right, float bottom, float top, float near, float far) {
+    Mat4 m = mat4_identity();
+    m.m[0] = 2.0f / (right - left);
+    m.m[5] = 2.0f / (top - bottom);
+    m.m[10] = -2.0f / (far - near);
+    m.m[12] = -(right + left) / (right - left);
+    m.m[13] = -(top + bottom) / (top - bottom);
+    m.m[14] = -(far + near) / (far - near);
+    return m;
+}
+
+Mat4 mat4_look_at(Vec3 eye, Vec3 center, Vec3 up) {
+    Vec3 f = vec3_normalize(vec3_sub(center, eye));
+    Vec3 s = vec3_normalize(vec3_cross(f, up));
+    Vec3 u = vec3_cross(s, f);
+
+    Mat4 m = mat4_identity();
+    m.m[0] = s.x;
+    m.m[4] = s.y;
+    m.m[8] = s.z;
+    m.m[1] = u.x;
+    m.m[5] = u.y;
+    m.m[9] = u.z;
+    m.m[2] = -f.x;
+    m.m[6] = -f.y;
+    m.m[10] = -f.z;
+    m.m[12] = -vec3_dot(s, eye);
+    m.m[13] = -vec3_dot(u, eye);
+    m.m[14] = vec3_dot(f, eye);
+    return m;
+}
+
+// -- Scalar kernels -- //
+static void transform_points_scalar(const Mat4* m, const Vec3* points, Vec4* out, long count) {
+    for (long i = 0; i < count; i++) {
+        out[i] = mat4_mul_vec4(m, (Vec4){ points[i].x, points[i].y, points[i].z, 1.0f });
+    }
+}
+
+static void from_trs_scalar(const Vec3* translations, const Quat* rotations, const Vec3* scales, Mat4* out, long count) {
+    for (long i = 0; i < count; i++) {
+        out[i] = mat4_from_trs(translations[i], rotations[i], scales[i]);
+    }
+}
+
+static void mul_scalar(const Mat4* a, const Mat4* b, Mat4* out, long count) {
+    for (long i = 0; i < count; i++) {
+        out[i] = mat4_mul(a, &b[i]);
+    }
+}
+
+#ifdef VECMATH_X86
+// -- SSE kernels -- //
+static void transform_points_sse(const Mat4* m, const Vec3* points, Vec4* out, long count) {
+    const __m128 c0 = _mm_loadu_ps(m->m);
+    const __m128 c1 = _mm_loadu_ps(m->m + 4);
+    const __m128 c2 = _mm_loadu_ps(m->m + 8);
+    const __m128 c3 = _mm_loadu_ps(m->m + 12);
+    for (long i = 0; i < count; i++) {
+        __m128 r = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(points[i].x)), c3);
+        r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(points[i].y)));
+        r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(points[i].z)));
+        _mm_storeu_ps(&out[i].x, r);
+    }
+}
+
+// four matrices at a time: every element is computed for 4 lanes, then
+// transposed back so each lane's column lands in its own matrix
+static void from_trs_sse(const Vec3* translations, const Quat* rotations, const Vec3* scales, Mat4* out, long count) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 zero = _mm_setzero_ps();
+    long i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 qx = _mm_loadu_ps(&rotations[i].x);
+        __m128 qy = _mm_loadu_ps(&rotations[i + 1].x);
+        __m128 qz = _mm_loadu_ps(&rotations[i + 2].x);
+        __m128 qw = _mm_loadu_ps(&rotations[i + 3].x);
+        _MM_TRANSPOSE4_PS(qx, qy, qz, qw);
+
+        const Vec3* t = &translations[i];
+        const Vec3* s = &scales[i];
+        __m128 sx = _mm_set_ps(s[3].x, s[2].x, s[1].x, s[0].x);
+        __m128 sy = _mm_set_ps(s[3].y, s[2].y, s[1].y, s[0].y);
+        __m128 sz = _mm_set_ps(s[3].z, s[2].z, s[1].z, s[0].z);
+
+        __m128 xx = _mm_mul_ps(qx, qx), yy = _mm_mul_ps(qy, qy), zz = _mm_mul_ps(qz, qz);
+        __m128 xy = _mm_mul_ps(qx, qy), xz = _mm_mul_ps(qx, qz), yz = _mm_mul_ps(qy, qz);
+        __m128 wx = _mm_mul_ps(qw, qx), wy = _mm_mul_ps(qw, qy), wz = _mm_mul_ps(qw, qz);
+
+        __m128 m0 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+        __m128 m1 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+        __m128 m2 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+        __m128 m4 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+        __m128 m5 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+        __m128 m6 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+        __m128 m8 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+        __m128 m9 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+        __m128 m10 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+        __m128 m3 = zero, m7 = zero, m11 = zero;
+        __m128 m12 = _mm_set_ps(t[3].x, t[2].x, t[1].x, t[0].x);
+        __m128 m13 = _mm_set_ps(t[3].y, t[2].y, t[1].y, t[0].y);
+        __m128 m14 = _mm_set_ps(t[3].z, t[2].z, t[1].z, t[0].z);
+        __m128 m15 = one;
+
+        _MM_TRANSPOSE4_PS(m0, m1, m2, m3);
+        _MM_TRANSPOSE4_PS(m4, m5, m6, m7);
+        _MM_TRANSPOSE4_PS(m8, m9, m10, m11);
+        _MM_TRANSPOSE4_PS(m12, m13, m14, m15);
+        __m128 columns[4][4] = {
+            { m0, m4, m8, m12 }, { m1, m5, m9, m13 }, { m2, m6, m10, m14 }, { m3, m7, m11, m15 },
+        };
+        for (int lane = 0; lane < 4; lane++) {
+            for (int column = 0; column < 4; column++) {
+                _mm_storeu_ps(out[i + lane].m + column * 4, columns[lane][column]);
+            }
+        }
+    }
+    from_trs_scalar(translations + i, rotations + i, scales + i, out + i, count - i);
+}
+
+static void mul_sse(const Mat4* a, const Mat4* b, Mat4* out, long count) {
+    const __m128 a0 = _mm_loadu_ps(a->m);
+    const __m128 a1 = _mm_loadu_ps(a->m + 4);
+    const __m128 a2 = _mm_loadu_ps(a->m + 8);
+    const __m128 a3 = _mm_loadu_ps(a->m + 12);
+    for (long i = 0; i < count; i++) {
+        for (int column = 0; column < 4; column++) {
+            __m128 bc = _mm_loadu_ps(b[i].m + column * 4);
+            __m128 r = _mm_mul_ps(a0, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(0, 0, 0, 0)));
+            r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(1, 1, 1, 1))));
+            r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(2, 2, 2, 2))));
+            r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(3, 3, 3, 3))));
+            _mm_storeu_ps(out[i].m + column * 4, r);
+        }
+    }
+}
+
+// -- AVX2 kernels -- //
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+
+// two points per iteration: each 128-bit half holds one output Vec4
+AVX2_TARGET
+static void transform_points_avx2(const Mat4* m, const Vec3* points, Vec4* out, long count) {
+    const __m256 c0 = _mm256_broadcast_ps((const __m128*)m->m);
+    const __m256 c1 = _mm256_broadcast_ps((const __m128*)(m->m + 4));
+    const __m256 c2 = _mm256_broadcast_ps((const __m128*)(m->m + 8));
+    const __m256 c3 = _mm256_broadcast_ps((const __m128*)(m->m + 12));
+    const __m256i splat_x = _mm256_set_epi32(3, 3, 3, 3, 0, 0, 0, 0);
+    const __m256i splat_y = _mm256_set_epi32(4, 4, 4, 4, 1, 1, 1, 1);
+    const __m256i splat_z = _mm256_set_epi32(5, 5, 5, 5, 2, 2, 2, 2);
+    long i = 0;
+    // the 8 float load covers 2 points and 2 floats of the third
+    for (; i + 3 <= count; i += 2) {
+        __m256 p = _mm256_loadu_ps(&points[i].x);
+        __m256 r = _mm256_fmadd_ps(c0, _mm256_permutevar8x32_ps(p, splat_x), c3);
+        r = _mm256_fmadd_ps(c1, _mm256_permutevar8x32_ps(p, splat_y), r);
+        r = _mm256_fmadd_ps(c2, _mm256_permutevar8x32_ps(p, splat_z), r);
+        _mm256_storeu_ps(&out[i].x, r);
+    }
+    transform_points_sse(m, points + i, out + i, count - i);
+}
+
+// 4x4 transpose inside each 128-bit half: the low halves of the results are
+// the columns for lanes 0-3, the high halves for lanes 4-7
+AVX2_TARGET
+static void store_column_avx2(Mat4* out, int column, __m256 r0, __m256 r1, __m256 r2, __m256 r3) {
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    __m256 lanes[4] = {
+        _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)),
+        _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)),
+        _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+        _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)),
+    };
+    for (int lane = 0; lane < 4; lane++) {
+        _mm_storeu_ps(out[lane].m + column * 4, _mm256_castps256_ps128(lanes[lane]));
+        _mm_storeu_ps(out[lane + 4].m + column * 4, _mm256_extractf128_ps(lanes[lane], 1));
+    }
+}
+
+AVX2_TARGET
+static void from_trs_avx2(const Vec3* translations, const Quat* rotations, const Vec3* scales, Mat4* out, long count) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256i quat_index = _mm256_set_epi32(28, 24, 20, 16, 12, 8, 4, 0);
+    const __m256i vec3_index = _mm256_set_epi32(21, 18, 15, 12, 9, 6, 3, 0);
+    long i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const float* q = &rotations[i].x;
+        const float* t = &translations[i].x;
+        const float* s = &scales[i].x;
+        __m256 qx = _mm256_i32gather_ps(q, quat_index, 4);
+        __m256 qy = _mm256_i32gather_ps(q + 1, quat_index, 4);
+        __m256 qz = _mm256_i32gather_ps(q + 2, quat_index, 4);
+        __m256 qw = _mm256_i32gather_ps(q + 3, quat_index, 4);
+        __m256 sx = _mm256_i32gather_ps(s, vec3_index, 4);
+        __m256 sy = _mm256_i32gather_ps(s + 1, vec3_index, 4);
+        __m256 sz = _mm256_i32gather_ps(s + 2, vec3_index, 4);
+
+        __m256 xx = _mm256_mul_ps(qx, qx), yy = _mm256_mul_ps(qy, qy), zz = _mm256_mul_ps(qz, qz);
+        __m256 xy = _mm256_mul_ps(qx, qy), xz = _mm256_mul_ps(qx, qz), yz = _mm256_mul_ps(qy, qz);
+        __m256 wx = _mm256_mul_ps(qw, qx), wy = _mm256_mul_ps(qw, qy), wz = _mm256_mul_ps(qw, qz);
+
+        __m256 m0 = _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(yy, zz), one), sx);
+        __m256 m1 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), sx);
+        __m256 m2 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), sx);
+        __m256 m4 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), sy);
+        __m256 m5 = _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(xx, zz), one), sy);
+        __m256 m6 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), sy);
+        __m256 m8 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), sz);
+        __m256 m9 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), sz);
+        __m256 m10 = _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(xx, yy), one), sz);
+
+        store_column_avx2(out + i, 0, m0, m1, m2, zero);
+        store_column_avx2(out + i, 1, m4, m5, m6, zero);
+        store_column_avx2(out + i, 2, m8, m9, m10, zero);
+        store_column_avx2(out + i, 3, _mm256_i32gather_ps(t, vec3_index, 4),
+            _mm256_i32gather_ps(t + 1, vec3_index, 4), _mm256_i32gather_ps(t + 2, vec3_index, 4), one);
+    }
+    from_trs_sse(translations + i, rotations + i, scales + i, out + i, count - i);
+}
+
+// two output columns per iteration, one in each 128-bit half
+AVX2_TARGET
+static void mul_avx2(const Mat4* a, const Mat4* b, Mat4* out, long count) {
+    const __m256 a0 = _mm256_broadcast_ps((const __m128*)a->m);
+    const __m256 a1 = _mm256_broadcast_ps((const __m128*)(a->m + 4));
+    const __m256 a2 = _mm256_broadcast_ps((const __m128*)(a->m + 8));
+    const __m256 a3 = _mm256_broadcast_ps((const __m128*)(a->m + 12));
+    for (long i = 0; i < count; i++) {
+        for (int column = 0; column < 4; column += 2) {
+            __m256 bc = _mm256_loadu_ps(b[i].m + column * 4);
+            __m256 r = _mm256_mul_ps(a0, _mm256_shuffle_ps(bc, bc, _MM_SHUFFLE(0, 0, 0, 0)));
+            r = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(bc, bc, _MM_SHUFFLE(1, 1, 1, 1)), r);
+            r = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(bc, bc, _MM_SHUFFLE(2, 2, 2, 2)), r);
+            r = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(bc, bc, _MM_SHUFFLE(3, 3, 3, 3)), r);
+            _mm256_storeu_ps(out[i].m + column * 4, r);
+        }
+    }
+}
+#endif
+
+// -- Dispatch -- //
+static int selected = -1;
+
+VecmathIsa vecmath_isa_supported(void) {
+#ifdef VECMATH_X86
+    static int cached = -1;
+    if (cached < 0) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            cached = VECMATH_AVX2;
+        } else if (__builtin_cpu_supports("sse2")) {
+            cached = VECMATH_SSE;
+        } else {
+            cached = VECMATH_SCALAR;
+        }
+    }
+    return (VecmathIsa)cached;
+#else
+    return VECMATH_SCALAR;
+#endif
+}
+
+VecmathIsa vecmath_isa(void) {
+    if (selected < 0) {
+        selected = vecmath_isa_supported();
+    }
+    return (VecmathIsa)selected;
+}
+
+VecmathIsa vecmath_set_isa(VecmathIsa isa) {
+    VecmathIsa supported = vecmath_isa_supported();
+    selected = isa > supported ? supported : isa;
+    return (VecmathIsa)selected;
+}
+
+const char* vecmath_isa_name(VecmathIsa isa) {
+    switch (isa) {
+        case VECMATH_SCALAR: return "scalar";
+        case VECMATH_SSE: return "sse";
+        case VECMATH_AVX2: return "avx2";
+    }
+    return "unknown";
+}
+
+void mat4_transform_points_batch(const Mat4* m, const Vec3* points, Vec4* out, long count) {
+    switch (vecmath_isa()) {
+#ifdef VECMATH_X86
+        case VECMATH_AVX2: transform_points_avx2(m, points, out, count); return;
+        case VECMATH_SSE: transform_points_sse(m, points, out, count); return;
+#endif
+        default: transform_points_scalar(m, points, out, count); return;
+    }
+}
+
+void mat4_from_trs_batch(const Vec3* translations, const Quat* rotations, const Vec3* scales, Mat4* out, long count) {
+    switch (vecmath_isa()) {
+#ifdef VECMATH_X86
+        case VECMATH_AVX2: from_trs_avx2(translations, rotations, scales, out, count); return;
+        case VECMATH_SSE: from_trs_sse(translations, rotations, scales, out, count); return;
+#endif
+        default: from_trs_scalar(translations, rotations, scales, out, count); return;
+    }
+}
+
+void mat4_mul_batch(const Mat4* a, const Mat4* b, Mat4* out, long count) {
+    switch (vecmath_isa()) {
+#ifdef VECMATH_X86
+        case VECMATH_AVX2: mul_avx2(a, b, out, count); return;
+        case VECMATH_SSE: mul_sse(a, b, out, count); return;
+#endif
+        default: mul_scalar(a, b, out, count); return;
+    }
+}
@@ -0,0 +1,275 @@
+#include "vertex_format.h"
+#include <string.h>
+#include <math.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VERTEX_FORMAT_X86 1
+#include <immintrin.h>
+#endif
+
+typedef void (*PackKernel)(char* dst, int stride, const float* src, long count);
+
+// -- Layout -- //
+static int storage_size(VertexStorage storage) {
+    switch (storage) {
+        case VERTEX_FLOAT3: return 12;
+        case VERTEX_HALF4: return 8;
+        case VERTEX_SNORM16X4: return 8;
+        case VERTEX_UNORM8X4: return 4;
+        case VERTEX_SNORM_2_10_10_10: return 4;
+    }
+    return 0;
+}
+
+void vertex_format_init(VertexFormat* format, const VertexAttrib* attribs, int count) {
+    memset(format, 0, sizeof(*format));
+    format->count = count;
+    for (int i = 0; i < count; i++) {
+        format->attribs[i] = attribs[i];
+        format->offsets[i] = format->stride;
+        format->stride += storage_size(attribs[i].storage);
+    }
+    // keep every vertex 4 byte aligned
+    format->stride = (format->stride + 3) & ~3;
+}
+
+void vertex_format_apply(const VertexFormat* format, GLintptr base) {
+    for (int i = 0; i < format->count; i++) {
+        unsigned int location = format->attribs[i].location;
+        void* offset = (void*)(base + format->offsets[i]);
+
+        switch (format->attribs[i].storage) {
+            case VERTEX_FLOAT3:
+                glVertexAttribPointer(location, 3, GL_FLOAT, GL_FALSE, format->stride, offset);
+                break;
+            case VERTEX_HALF4:
+                glVertexAttribPointer(location, 4, GL_HALF_FLOAT, GL_FALSE, format->stride, offset);
+                break;
+            case VERTEX_SNORM16X4:
+                glVertexAttribPointer(location, 4, GL_SHORT, GL_TRUE, format->stride, offset);
+                break;
+            case VERTEX_UNORM8X4:
+                glVertexAttribPointer(location, 4, GL_UNSIGNED_BYTE, GL_TRUE, format->stride, offset);
+                break;
+            case VERTEX_SNORM_2_10_10_10:
+                glVertexAttribPointer(location, 4, GL_INT_2_10_10_10_REV, GL_TRUE, format->stride, offset);
+                break;
+        }
+        glEnableVertexAttribArray(location);
+    }
+}
+
+// -- Scalar kernels -- //
+static unsigned short float_to_half(float value) {
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    unsigned int sign = (bits >> 16) & 0x8000u;
+    int exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+    unsigned int mantissa = bits & 0x7FFFFFu;
+
+    if (((bits >> 23) & 0xFF) == 0xFF) {
+        // inf / nan
+        return (unsigned short)(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+    }
+    if (exponent >= 31) {
+        return (unsigned short)(sign | 0x7C00u);
+    }
+    if (exponent <= 0) {
+        if (exponent < -10) {
+            return (unsigned short)sign;
+        }
+        // subnormal, round to nearest even like F16C does
+        mantissa |= 0x800000u;
+        unsigned int shift = (unsigned int)(14 - exponent);
+        unsigned int half = mantissa >> shift;
+        unsigned int rest = mantissa & ((1u << shift) - 1);
+        unsigned int halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half & 1u))) {
+            half++;
+        }
+        return (unsigned short)(sign | half);
+    }
+
+    unsigned int half = sign | ((unsigned int)exponent << 10) | (mantissa >> 13);
+    unsigned int rest = mantissa & 0x1FFFu;
+    if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) {
+        half++; // may carry into the exponent, which is the correct rounding
+    }
+    return (unsigned short)half;
+}
+
+static float clampf(float value, float low, float high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+static void pack_float3_scalar(char* dst, int stride, const float* src, long count) {
+    for (long i = 0; i < count; i++) {
+        memcpy(dst + i * stride, src + i * 3, 12);
+    }
+}
+
+static void pack_half4_scalar(char* dst, int stride, const float* src, long count) {
+    for (long i = 0; i < count; i++) {
+        unsigned short out[4] = {
+            float_to_half(src[i * 3 + 0]), float_to_half(src[i * 3 + 1]), float_to_half(src[i * 3 + 2]), 0x3C00u
+        };
+        memcpy(dst + i * stride, out, sizeof(out));
+    }
+}
+
+static void pack_snorm16_scalar(char* dst, int stride, const float* src, long count) {
+    for (long i = 0; i < count; i++) {
+        short out[4];
+        for (int c = 0; c < 3; c++) {
+            out[c] = (short)lrintf(clampf(src[i * 3 + c], -1.0f, 1.0f) * 32767.0f);
+        }
+        out[3] = 32767;
+        memcpy(dst + i * stride, out, sizeof(out));
+    }
+}
+
+static void pack_unorm8_scalar(char* dst, int stride, const float* src, long count) {
+    for (long i = 0; i < count; i++) {
+        unsigned char out[4];
+        for (int c = 0; c < 3; c++) {
+            out[c] = (unsigned char)lrintf(clampf(src[i * 3 + c], 0.0f, 1.0f) * 255.0f);
+        }
+        out[3] = 255;
+        memcpy(dst + i * stride, out, sizeof(out));
+    }
+}
+
+static void pack_2_10_10_10_scalar(char* dst, int stride, const float* src, long count) {
+    for (long i = 0; i < count; i++) {
+        unsigned int out = 0;
+        for (int c = 0; c < 3; c++) {
+            int value = (int)lrintf(clampf(src[i * 3 + c], -1.0f, 1.0f) * 511.0f);
+            out |= ((unsigned int)value & 0x3FFu) << (10 * c);
+        }
+        // w = 0, only xyz are used for normals
+        memcpy(dst + i * stride, &out, sizeof(out));
+    }
+}
+
+// -- SIMD kernels -- //
+#ifdef VERTEX_FORMAT_X86
+// xyz of vertex i with w = 1; the last vertex is copied so we never read past the source
+static inline __m128 load_xyz1(const float* src, long i, long count) {
+    __m128 xyzw;
+    if (i + 1 < count) {
+        xyzw = _mm_loadu_ps(src + i * 3);
+    } else {
+        float last[4] = { src[i * 3], src[i * 3 + 1], src[i * 3 + 2], 0.0f };
+        xyzw = _mm_loadu_ps(last);
+    }
+    const __m128 mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+    return _mm_or_ps(_mm_and_ps(xyzw, mask), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+}
+
+__attribute__((target("f16c")))
+static void pack_half4_f16c(char* dst, int stride, const float* src, long count) {
+    for (long i = 0; i < count; i++) {
+        __m128i half = _mm_cvtps_ph(load_xyz1(src, i, count), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64((__m128i*)(dst + i * stride), half);
+    }
+}
+
+static void pack_snorm16_sse2(char* dst, int stride, const float* src, long count) {
+    const __m128 low = _mm_set1_ps(-1.0f);
+    const __m128 high = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    for (long i = 0; i < count; i++) {
+        __m128 v = _mm_min_ps(_mm_max_ps(load_xyz1(src, i, count), low), high);
+        __m128i ints = _mm_cvtps_epi32(_mm_mul_ps(v, scale));
+        _mm_storel_epi64((__m128i*)(dst + i * stride), _mm_packs_epi32(ints, ints));
+    }
+}
+
+static void pack_unorm8_sse2(char* dst, int stride, const float* src, long count) {
+    const __m128 low = _mm_setzero_ps();
+    const __m128 high = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    for (long i = 0; i < count; i++) {
+        __m128 v = _mm_min_ps(_mm_max_ps(load_xyz1(src, i, count), low), high);
+        __m128i ints = _mm_cvtps_epi32(_mm_mul_ps(v, scale));
+        __m128i shorts = _mm_packs_epi32(ints, ints);
+        __m128i bytes = _mm_packus_epi16(shorts, shorts);
+        int packed = _mm_cvtsi128_si32(bytes);
+        memcpy(dst + i * stride, &packed, sizeof(packed));
+    }
+}
+
+static void pack_2_10_10_10_sse2(char* dst, int stride, const float* src, long count) {
+    const __m128 low = _mm_set1_ps(-1.0f);
+    const __m128 high = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set_ps(0.0f, 511.0f, 511.0f, 511.0f);
+    const __m128i mask = _mm_set1_epi32(0x3FF);
+    for (long i = 0; i < count; i++) {
+        __m128 v = _mm_min_ps(_mm_max_ps(load_xyz1(src, i, count), low), high);
+        __m128i ints = _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(v, scale)), mask);
+        unsigned int lanes[4];
+        _mm_storeu_si128((__m128i*)lanes, ints);
+        unsigned int out = lanes[0] | (lanes[1] << 10) | (lanes[2] << 20);
+        memcpy(dst + i * stride, &out, sizeof(out));
+    }
+}
+
+static int has_f16c(void) {
+    static int cached = -1;
+    if (cached < 0) {
+        __builtin_cpu_init();
+        cached = __builtin_cpu_supports("f16c") ? 1 : 0;
+    }
+    return cached;
+}
+#endif
+
+// -- Dispatch -- //
+static PackKernel scalar_kernel(VertexStorage storage) {
+    switch (storage) {
+        case VERTEX_FLOAT3: return pack_float3_scalar;
+        case VERTEX_HALF4: return pack_half4_scalar;
+        case VERTEX_SNORM16X4: return pack_snorm16_scalar;
+        case VERTEX_UNORM8X4: return pack_unorm8_scalar;
+        case VERTEX_SNORM_2_10_10_10: return pack_2_10_10_10_scalar;
+    }
+    return NULL;
+}
+
+static PackKernel best_kernel(VertexStorage storage) {
+#ifdef VERTEX_FORMAT_X86
+    switch (storage) {
+        case VERTEX_HALF4: return has_f16c() ? pack_half4_f16c : pack_half4_scalar;
+        case VERTEX_SNORM16X4: return pack_snorm16_sse2;
+        case VERTEX_UNORM8X4: return pack_unorm8_sse2;
+        case VERTEX_SNORM_2_10_10_10: return pack_2_10_10_10_sse2;
+        default: break;
+    }
+#endif
+    return scalar_kernel(storage);
+}
+
+static void pack(const VertexFormat* format, void* dst, const float* const* sources, long vertex_count, int simd) {
+    // one attribute at a time keeps each kernel a tight loop over one source
+    for (int i = 0; i < format->count; i++) {
+        PackKernel kernel = simd ? best_kernel(format->attribs[i].storage) : scalar_kernel(format->attribs[i].storage);
+        kernel((char*)dst + format->offsets[i], format->stride, sources[i], vertex_count);
+    }
+}
+
+void vertex_format_pack(const VertexFormat* format, void* dst, const float* const* sources, long vertex_count) {
+    pack(format, dst, sources, vertex_count, 1);
+}
+
+void vertex_format_pack_scalar(const VertexFormat* format, void* dst, const float* const* sources, long vertex_count) {
+    pack(format, dst, sources, vertex_count, 0);
+}
+
+const char* vertex_format_simd_level(void) {
+#ifdef VERTEX_FORMAT_X86
+    return has_f16c() ? "f16c" : "sse2";
+#else
+    return "scalar";
+#endif
+}
@@ -3,18 +3,65 @@
 #include <stdlib.h>
 #include "glad/glad.h"
 #include <GLFW/glfw3.h>
+#include "gl_state.h"
+#include "timer.h"
+#include "trace.h"
 
 
-// -- Input -- //
-void process_input(GLFWwindow* window) {
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
-        // 1 = true, for falsy and truthy values
-        glfwSetWindowShouldClose(window, 1);
-    }
+static void forward(GLFWwindow* window, WindowEvent* event) {
+    EventQueue* events = (EventQueue*)glfwGetWindowUserPointer(window);
+    event->time_ms = timer_now_ms();
+    event_queue_push(events, event);
+}
+
+// -- Callbacks (main thread) -- //
+static void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    (void)scancode;
+    WindowEvent event = { .type = EVENT_KEY, .key = key, .action = action, .mods = mods };
+    forward(window, &event);
 }
 
-// -- Resize -- //
-void framebuffer_size_callback(GLFWwindow* window, int w, int h) {
-    glViewport(0, 0, w, h);
+static void mouse_button_callback(GLFWwindow* window, int button, int action, int mods) {
+    WindowEvent event = { .type = EVENT_MOUSE_BUTTON, .key = button, .action = action, .mods = mods };
+    forward(window, &event);
 }
 
+static void cursor_callback(GLFWwindow* window, double x, double y) {
+    WindowEvent event = { .type = EVENT_CURSOR, .x = x, .y = y };
+    forward(window, &event);
+}
+
+static void framebuffer_size_callback(GLFWwindow* window, int w, int h) {
+    WindowEvent event = { .type = EVENT_RESIZE, .width = w, .height = h };
+    forward(window, &event);
+}
+
+void window_forward_events(GLFWwindow* window, EventQueue* events) {
+    glfwSetWindowUserPointer(window, events);
+    glfwSetKeyCallback(window, key_callback);
+    glfwSetMouseButtonCallback(window, mouse_button_callback);
+    glfwSetCursorPosCallback(window, cursor_callback);
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+}
+
+// -- Input -- //
+void window_handle_event(GLFWwindow* window, const WindowEvent* event) {
+    switch (event->type) {
+        case EVENT_KEY:
+            if (event->key == GLFW_KEY_ESCAPE && event->action == GLFW_PRESS) {
+                // 1 = true, for falsy and truthy values
+                glfwSetWindowShouldClose(window, 1);
+                // wakes the main thread if it is waiting for events
+                glfwPostEmptyEvent();
+            }
+            break;
+        // -- Resize -- //
+        case EVENT_RESIZE:
+            TRACE_BEGIN("resize");
+            gl_state_viewport(0, 0, event->width, event->height);
+            TRACE_END();
+            break;
+        default:
+            break;
+    }
+}
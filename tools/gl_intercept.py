@@ -0,0 +1,399 @@
+#!/usr/bin/env python3
+"""
+Generates src/gl_intercept_wrappers.c from include/glad/glad.h: one wrapper
+per GL entry point that glad loads, plus the code that swaps them into the
+glad_gl* pointer table (see include/gl_intercept.h). The wrappers also write
+the capture stream (include/gl_capture.h); src/gl_replay_calls.c gets the
+matching readers that play it back (include/gl_replay.h).
+
+Run it again whenever glad is regenerated:
+
+    python3 tools/gl_intercept.py
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+GLAD_H = os.path.join(ROOT, "include", "glad", "glad.h")
+OUTPUT = os.path.join(ROOT, "src", "gl_intercept_wrappers.c")
+REPLAY_OUTPUT = os.path.join(ROOT, "src", "gl_replay_calls.c")
+
+TYPEDEF = re.compile(r"^typedef (.+?) \(APIENTRYP (PFNGL\w+PROC)\)\((.*)\);$")
+POINTER = re.compile(r"^GLAPI (PFNGL\w+PROC) glad_(gl\w+);$")
+
+
+def parse(path):
+    typedefs = {}
+    functions = []
+    with open(path) as header:
+        for line in header:
+            line = line.strip()
+            match = TYPEDEF.match(line)
+            if match:
+                typedefs[match.group(2)] = (match.group(1).strip(), match.group(3).strip())
+                continue
+            match = POINTER.match(line)
+            if match and match.group(1) in typedefs:
+                result, params = typedefs[match.group(1)]
+                functions.append((match.group(2), match.group(1), result, params))
+    return functions
+
+
+def split_params(params):
+    """[(type, name)] with the pointer stars kept in the type"""
+    if params == "void":
+        return []
+    result = []
+    for param in params.split(","):
+        name = re.search(r"(\w+)\s*$", param).group(1)
+        result.append((param[:param.rindex(name)].strip(), name))
+    return result
+
+
+# -- Capture classification -- #
+
+SCALARS = {}
+for type_name in ("GLenum", "GLboolean", "GLbitfield", "GLbyte", "GLshort", "GLint", "GLsizei", "GLubyte",
+                  "GLushort", "GLuint", "GLfixed", "GLclampx", "GLhalf", "GLhalfNV", "GLhandleARB", "GLcharARB"):
+    SCALARS[type_name] = "u32"
+for type_name in ("GLint64", "GLuint64", "GLint64EXT", "GLuint64EXT", "GLintptr", "GLsizeiptr", "GLintptrARB",
+                  "GLsizeiptrARB", "GLvdpauSurfaceNV"):
+    SCALARS[type_name] = "u64"
+for type_name in ("GLfloat", "GLclampf"):
+    SCALARS[type_name] = "f32"
+for type_name in ("GLdouble", "GLclampd"):
+    SCALARS[type_name] = "f64"
+
+NAME_PARAMS = {
+    "buffer": "GL_NAME_BUFFER",
+    "texture": "GL_NAME_TEXTURE",
+    "framebuffer": "GL_NAME_FRAMEBUFFER",
+    "readFramebuffer": "GL_NAME_FRAMEBUFFER",
+    "drawFramebuffer": "GL_NAME_FRAMEBUFFER",
+    "renderbuffer": "GL_NAME_RENDERBUFFER",
+    "program": "GL_NAME_PROGRAM",
+    "shader": "GL_NAME_SHADER",
+    "sampler": "GL_NAME_SAMPLER",
+    "pipeline": "GL_NAME_PIPELINE",
+    "vaobj": "GL_NAME_VERTEX_ARRAY",
+}
+
+# glGen*, glCreate* and glDelete* suffix -> kind
+OBJECT_KINDS = {
+    "Buffers": "GL_NAME_BUFFER",
+    "VertexArrays": "GL_NAME_VERTEX_ARRAY",
+    "Textures": "GL_NAME_TEXTURE",
+    "Framebuffers": "GL_NAME_FRAMEBUFFER",
+    "Renderbuffers": "GL_NAME_RENDERBUFFER",
+    "Queries": "GL_NAME_QUERY",
+    "Samplers": "GL_NAME_SAMPLER",
+    "ProgramPipelines": "GL_NAME_PIPELINE",
+}
+
+# queries change no state, replaying them only costs time
+SKIPPED = re.compile(r"^gl(Get|Is|Check|ReadPixels|ReadnPixels|AreTexturesResident)")
+
+BUFFER_PAYLOADS = {
+    "glBufferData": ("data", "size"),
+    "glBufferSubData": ("data", "size"),
+    "glNamedBufferData": ("data", "size"),
+    "glNamedBufferSubData": ("data", "size"),
+    "glBufferStorage": ("data", "size"),
+    "glNamedBufferStorage": ("data", "size"),
+    "glProgramBinary": ("binary", "length"),
+}
+
+UNIFORM_ARRAY = re.compile(r"^gl(?:Program)?Uniform(?:(\d)|Matrix(\d)(?:x(\d))?)(f|i|ui|d)v$")
+OFFSET_POINTERS = [
+    (re.compile(r"^glVertexAttrib[IL]?Pointer$"), "pointer"),
+    (re.compile(r"^gl(Multi)?Draw\w*Elements\w*$"), "indices"),
+    (re.compile(r"^gl(Multi)?Draw\w*Indirect\w*$"), "indirect"),
+]
+TEXTURE_IMAGES = ("glTexImage2D", "glTexSubImage2D")
+
+
+class Call:
+    """how one function is written to and read back from the capture stream"""
+
+    def __init__(self):
+        self.before = []   # capture code ahead of the real call
+        self.after = []    # capture code once the result is known
+        self.reads = []    # replay declarations, in stream order
+        self.args = []     # replay call arguments
+        self.replayed = []  # replay code after the call
+
+
+def name_kind(function, param_type, name):
+    if param_type != "GLuint":
+        return None
+    if name == "array" and "VertexArray" in function:
+        return "GL_NAME_VERTEX_ARRAY"
+    if name == "id" and "Quer" in function:
+        return "GL_NAME_QUERY"
+    return NAME_PARAMS.get(name)
+
+
+def object_kind(function, prefixes):
+    for prefix in prefixes:
+        if function.startswith(prefix):
+            return OBJECT_KINDS.get(function[len(prefix):])
+    return None
+
+
+def scalar(call, param_type, name):
+    kind = SCALARS[param_type]
+    call.before.append("gl_capture_%s(%s);" % (kind, name))
+    call.reads.append("%s %s = (%s)gl_replay_%s(replay);" % (param_type, name, param_type, kind))
+
+
+def uniform_elements(function):
+    match = UNIFORM_ARRAY.match(function)
+    if not match:
+        return None
+    vector, columns, rows, element = match.groups()
+    count = int(vector) if vector else int(columns) * int(rows or columns)
+    return count, 8 if element == "d" else 4
+
+
+def classify(function, result, params):
+    """a Call, or None when calls to function cannot be captured"""
+    if "(" in params or "GLDEBUGPROC" in params or "GLVULKANPROCNV" in params:
+        return None
+    call = Call()
+    params = split_params(params)
+    names = [name for _, name in params]
+    created = None
+
+    gen_kind = object_kind(function, ("glGen", "glCreate"))
+    delete_kind = object_kind(function, ("glDelete",))
+
+    for index, (param_type, name) in enumerate(params):
+        base = param_type.replace("const", "").strip()
+        call.args.append(name)
+        if "*" not in param_type:
+            if param_type == "GLsync":
+                call.before.append("gl_capture_u64((uint64_t)(uintptr_t)%s);" % name)
+                call.reads.append("GLsync %s = gl_replay_sync(replay);" % name)
+            elif name_kind(function, param_type, name):
+                call.before.append("gl_capture_u32(%s);" % name)
+                call.reads.append("GLuint %s = gl_replay_name(replay, %s);" % (name, name_kind(function, param_type, name)))
+            elif param_type in SCALARS:
+                scalar(call, param_type, name)
+            else:
+                return None
+            continue
+
+        last = index == len(params) - 1
+        if gen_kind and last and base == "GLuint *" and "n" in names:
+            call.after.append("for (GLsizei i = 0; i < n; i++) {")
+            call.after.append("    gl_capture_u32(%s[i]);" % name)
+            call.after.append("}")
+            call.reads.append("GLuint* %s = (GLuint*)gl_replay_scratch(replay, (size_t)(n > 0 ? n : 0) * sizeof(GLuint) + 1);" % name)
+            call.reads.append("if (!%s) {" % name)
+            call.reads.append("    return;")
+            call.reads.append("}")
+            created = (gen_kind, "n", name)
+        elif delete_kind and last and param_type == "const GLuint *" and "n" in names:
+            call.before.append("for (GLsizei i = 0; i < n; i++) {")
+            call.before.append("    gl_capture_u32(%s[i]);" % name)
+            call.before.append("}")
+            call.reads.append("const GLuint* %s = gl_replay_names(replay, %s, n);" % (name, delete_kind))
+        elif function in BUFFER_PAYLOADS and BUFFER_PAYLOADS[function][0] == name:
+            size = BUFFER_PAYLOADS[function][1]
+            call.before.append("gl_capture_bytes(%s, (uint64_t)%s);" % (name, size))
+            call.reads.append("const void* %s = gl_replay_bytes(replay, NULL);" % name)
+        elif uniform_elements(function) and name == "value":
+            count, element_size = uniform_elements(function)
+            call.before.append("gl_capture_bytes(%s, (uint64_t)count * %d);" % (name, count * element_size))
+            call.reads.append("%s %s = (%s)gl_replay_bytes(replay, NULL);" % (param_type, name, param_type))
+        elif function == "glShaderSource" and name == "string":
+            call.before.append("gl_capture_strings(count, string, length);")
+            call.reads.append("const GLint* length = NULL;")
+            call.reads.append("const GLchar* const* string = gl_replay_strings(replay, count, &length);")
+        elif function == "glShaderSource" and name == "length":
+            pass
+        elif function == "glDrawBuffers" and name == "bufs":
+            call.before.append("gl_capture_bytes(bufs, (uint64_t)n * sizeof(GLenum));")
+            call.reads.append("const GLenum* bufs = (const GLenum*)gl_replay_bytes(replay, NULL);")
+        elif param_type == "const GLchar *" and name == "name":
+            call.before.append("gl_capture_string(name, -1);")
+            call.reads.append("const GLchar* name = (const GLchar*)gl_replay_bytes(replay, NULL);")
+        elif param_type == "const void *" and any(pattern.match(function) and name == pointer
+                                                  for pattern, pointer in OFFSET_POINTERS):
+            call.before.append("gl_capture_u64((uint64_t)(uintptr_t)%s);" % name)
+            call.reads.append("const void* %s = (const void*)(uintptr_t)gl_replay_u64(replay);" % name)
+        elif function in TEXTURE_IMAGES and name == "pixels":
+            call.before.append("gl_capture_image(pixels, width, height, format, type);")
+            call.reads.append("const void* pixels = gl_replay_image(replay);")
+        else:
+            return None
+
+    if function == "glMapBufferRange":
+        call.after.append("gl_capture_mapped(target, intercept_result, offset, length, access);")
+        call.replayed.append("gl_replay_mapped(replay, target, intercept_result, length);")
+    elif function == "glFlushMappedBufferRange":
+        call.before.append("gl_capture_mapped_contents(target, 1, offset, length);")
+        call.reads.append("gl_replay_mapped_contents(replay, target, offset);")
+    elif function == "glUnmapBuffer":
+        call.before.append("gl_capture_mapped_contents(target, 0, 0, 0);")
+        call.reads.append("gl_replay_mapped_contents(replay, target, 0);")
+        call.replayed.append("gl_replay_mapped(replay, target, NULL, 0);")
+    elif function in ("glCreateProgram", "glCreateShader"):
+        kind = "GL_NAME_PROGRAM" if function == "glCreateProgram" else "GL_NAME_SHADER"
+        call.after.append("gl_capture_u32(intercept_result);")
+        call.replayed.append("gl_replay_created(replay, %s, 1, &intercept_result);" % kind)
+    elif function == "glFenceSync":
+        call.after.append("gl_capture_u64((uint64_t)(uintptr_t)intercept_result);")
+        call.replayed.append("gl_replay_created_sync(replay, intercept_result);")
+    elif "*" in result or result == "GLsync":
+        return None
+
+    if created:
+        call.replayed.append("gl_replay_created(replay, %s, %s, %s);" % created)
+    return call
+
+
+def wrapper(index, name, proc, result, params, call):
+    args = ", ".join(name for _, name in split_params(params))
+    lines = [
+        "static %s real_%s;" % (proc, name),
+        "static %s APIENTRY wrap_%s(%s) {" % (result, name, params),
+    ]
+    if call:
+        lines.append("    if (gl_capture_on) {")
+        lines.append("        gl_capture_call(%d);" % index)
+        lines.extend("        " + line for line in call.before)
+        lines.append("    }")
+    elif not SKIPPED.match(name):
+        lines.append("    if (gl_capture_on) {")
+        lines.append("        gl_capture_unsupported(%d);" % index)
+        lines.append("    }")
+    lines.append("    uint64_t intercept_start = now_ns();")
+    if result == "void":
+        lines.append("    real_%s(%s);" % (name, args))
+        lines.append("    record(%d, intercept_start);" % index)
+    else:
+        lines.append("    %s intercept_result = real_%s(%s);" % (result, name, args))
+        lines.append("    record(%d, intercept_start);" % index)
+    if call and call.after:
+        lines.append("    if (gl_capture_on) {")
+        lines.extend("        " + line for line in call.after)
+        lines.append("    }")
+    if result != "void":
+        lines.append("    return intercept_result;")
+    lines.append("}")
+    return "\n".join(lines)
+
+
+def replay_function(name, result, call):
+    lines = ["static void replay_%s(GlReplay* replay) {" % name]
+    if not call.reads and not call.replayed:
+        lines.append("    (void)replay;")
+    lines.extend("    " + line for line in call.reads)
+    invoke = "%s(%s);" % (name, ", ".join(call.args))
+    if any("intercept_result" in line for line in call.replayed):
+        lines.append("    %s intercept_result = %s" % (result, invoke))
+    else:
+        lines.append("    " + invoke)
+    lines.extend("    " + line for line in call.replayed)
+    lines.append("}")
+    return "\n".join(lines)
+
+
+def generate_replay(functions, calls):
+    out = []
+    out.append("// generated by tools/gl_intercept.py from include/glad/glad.h, do not edit")
+    out.append("#include \"gl_replay.h\"")
+    out.append("#include <stddef.h>")
+    out.append("")
+    out.append("#define FUNCTION_COUNT %d" % len(functions))
+    out.append("")
+    out.append("const char* const gl_replay_function_names[FUNCTION_COUNT] = {")
+    for name, _, _, _ in functions:
+        out.append("    \"%s\"," % name)
+    out.append("};")
+    out.append("const int gl_replay_function_count = FUNCTION_COUNT;")
+    out.append("")
+    out.append("// -- Readers -- //")
+    for (name, _, result, _), call in zip(functions, calls):
+        if call and not SKIPPED.match(name):
+            out.append(replay_function(name, result, call))
+            out.append("")
+    out.append("void (*const gl_replay_calls[FUNCTION_COUNT])(GlReplay* replay) = {")
+    for (name, _, _, _), call in zip(functions, calls):
+        out.append("    %s," % ("replay_" + name if call and not SKIPPED.match(name) else "NULL"))
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def generate(functions, calls):
+    out = []
+    out.append("// generated by tools/gl_intercept.py from include/glad/glad.h, do not edit")
+    out.append("#include \"gl_intercept.h\"")
+    out.append("#include <time.h>")
+    out.append("#include \"gl_capture.h\"")
+    out.append("")
+    out.append("#define FUNCTION_COUNT %d" % len(functions))
+    out.append("")
+    out.append("GlCallStats gl_intercept_calls[FUNCTION_COUNT] = {")
+    for name, _, _, _ in functions:
+        out.append("    { \"%s\", 0, 0, 0, 0 }," % name)
+    out.append("};")
+    out.append("const int gl_intercept_call_count = FUNCTION_COUNT;")
+    out.append("")
+    out.append("static uint64_t now_ns(void) {")
+    out.append("    struct timespec ts;")
+    out.append("    clock_gettime(CLOCK_MONOTONIC, &ts);")
+    out.append("    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;")
+    out.append("}")
+    out.append("")
+    out.append("static void record(int index, uint64_t start) {")
+    out.append("    uint64_t elapsed = now_ns() - start;")
+    out.append("    GlCallStats* stats = &gl_intercept_calls[index];")
+    out.append("    stats->frame_calls++;")
+    out.append("    stats->frame_time_ns += elapsed;")
+    out.append("}")
+    out.append("")
+    out.append("// -- Wrappers -- //")
+    for index, ((name, proc, result, params), call) in enumerate(zip(functions, calls)):
+        out.append(wrapper(index, name, proc, result, params, None if SKIPPED.match(name) else call))
+        out.append("")
+    out.append("// glGetIntegerv without the wrapper, for the capture's own state queries")
+    out.append("void gl_intercept_get_integerv(GLenum pname, GLint* data) {")
+    out.append("    (glad_glGetIntegerv == wrap_glGetIntegerv ? real_glGetIntegerv : glad_glGetIntegerv)(pname, data);")
+    out.append("}")
+    out.append("")
+    out.append("// -- Pointer table -- //")
+    out.append("int gl_intercept_swap(int install) {")
+    out.append("    int swapped = 0;")
+    out.append("    if (install) {")
+    for name, _, _, _ in functions:
+        out.append("        if (glad_%s && glad_%s != wrap_%s) { real_%s = glad_%s; glad_%s = wrap_%s; swapped++; }"
+                   % (name, name, name, name, name, name, name))
+    out.append("    } else {")
+    for name, _, _, _ in functions:
+        out.append("        if (glad_%s == wrap_%s) { glad_%s = real_%s; swapped++; }" % (name, name, name, name))
+    out.append("    }")
+    out.append("    return swapped;")
+    out.append("}")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    functions = parse(GLAD_H)
+    if not functions:
+        sys.exit("no GL entry points found in " + GLAD_H)
+    calls = [classify(name, result, params) for name, _, result, params in functions]
+    with open(OUTPUT, "w") as output:
+        output.write(generate(functions, calls))
+    with open(REPLAY_OUTPUT, "w") as output:
+        output.write(generate_replay(functions, calls))
+    replayable = sum(1 for (name, _, _, _), call in zip(functions, calls) if call and not SKIPPED.match(name))
+    print("%d wrappers written to %s" % (len(functions), os.path.relpath(OUTPUT, ROOT)))
+    print("%d readers written to %s" % (replayable, os.path.relpath(REPLAY_OUTPUT, ROOT)))
+
+
+if __name__ == "__main__":
+    main()